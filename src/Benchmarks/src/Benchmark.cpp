@@ -0,0 +1,82 @@
+#include "Benchmark.h"
+#include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fmt/format.h>
+
+namespace OpenLoco::Benchmarks
+{
+    using Clock = std::chrono::steady_clock;
+
+    static double measureNs(const Benchmark& benchmark, uint64_t numIterations)
+    {
+        const auto begin = Clock::now();
+        benchmark.function(numIterations);
+        const auto end = Clock::now();
+        return std::chrono::duration<double, std::nano>(end - begin).count();
+    }
+
+    // Doubles the iteration count until a run takes the minimum time, then scales it to fit.
+    static uint64_t calibrate(const Benchmark& benchmark, const Options& options)
+    {
+        const auto minTimeNs = options.minTimeMs * 1'000'000.0;
+        uint64_t numIterations = 1;
+        while (true)
+        {
+            const auto elapsedNs = measureNs(benchmark, numIterations);
+            if (elapsedNs >= minTimeNs || numIterations >= (uint64_t{ 1 } << 40))
+            {
+                return numIterations;
+            }
+            if (elapsedNs * 10 >= minTimeNs)
+            {
+                return static_cast<uint64_t>(numIterations * (minTimeNs / elapsedNs)) + 1;
+            }
+            numIterations *= 10;
+        }
+    }
+
+    Result run(const Benchmark& benchmark, const Options& options)
+    {
+        Result result;
+        result.name = benchmark.name;
+        result.numIterations = calibrate(benchmark, options);
+
+        std::vector<double> samples;
+        samples.reserve(std::max<uint32_t>(options.numRepetitions, 1));
+        for (uint32_t i = 0; i < std::max<uint32_t>(options.numRepetitions, 1); i++)
+        {
+            samples.push_back(measureNs(benchmark, result.numIterations) / result.numIterations);
+        }
+        std::sort(samples.begin(), samples.end());
+
+        result.minNs = samples.front();
+        result.medianNs = samples[samples.size() / 2];
+        result.maxNs = samples.back();
+        return result;
+    }
+
+    std::string formatJson(const std::vector<Result>& results, const Options& options)
+    {
+        std::string json = "{\n";
+        json += "  \"schemaVersion\": 1,\n";
+        json += fmt::format("  \"minTimeMs\": {},\n", options.minTimeMs);
+        json += fmt::format("  \"repetitions\": {},\n", options.numRepetitions);
+        json += "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const auto& result = results[i];
+            json += fmt::format(
+                "    {{ \"name\": \"{}\", \"iterations\": {}, \"minNs\": {:.3f}, \"medianNs\": {:.3f}, \"maxNs\": {:.3f} }}{}\n",
+                Utility::escapeJson(result.name),
+                result.numIterations,
+                result.minNs,
+                result.medianNs,
+                result.maxNs,
+                i + 1 < results.size() ? "," : "");
+        }
+        json += "  ]\n";
+        json += "}\n";
+        return json;
+    }
+}
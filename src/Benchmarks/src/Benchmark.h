@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OpenLoco::Benchmarks
+{
+    // Runs the measured operation the given number of times, setup belongs outside of the loop.
+    using Function = void (*)(uint64_t numIterations);
+
+    struct Benchmark
+    {
+        std::string name;
+        Function function;
+    };
+
+    struct Options
+    {
+        std::string filter;
+        std::string jsonPath;
+        // Each repetition runs for at least this long once the iteration count is calibrated
+        uint32_t minTimeMs = 50;
+        uint32_t numRepetitions = 5;
+    };
+
+    // Nanoseconds per iteration over the repetitions, the median is the one to track.
+    struct Result
+    {
+        std::string name;
+        uint64_t numIterations{};
+        double minNs{};
+        double medianNs{};
+        double maxNs{};
+    };
+
+    void addCoreBenchmarks(std::vector<Benchmark>& benchmarks);
+    void addMathBenchmarks(std::vector<Benchmark>& benchmarks);
+    void addUtilityBenchmarks(std::vector<Benchmark>& benchmarks);
+    void addSawyerBenchmarks(std::vector<Benchmark>& benchmarks);
+    void addDrawSpriteBenchmarks(std::vector<Benchmark>& benchmarks);
+
+    Result run(const Benchmark& benchmark, const Options& options);
+
+    // Benchmarks are written in the order they were run, which is sorted by name, so the
+    // output of two runs can be diffed line by line.
+    std::string formatJson(const std::vector<Result>& results, const Options& options);
+
+    // Keeps the compiler from optimising away a value that is otherwise unused.
+    template<typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile(""
+                     :
+                     : "m"(value)
+                     : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+}
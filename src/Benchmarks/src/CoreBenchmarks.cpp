@@ -0,0 +1,144 @@
+#include "Benchmark.h"
+#include <OpenLoco/Core/BitSet.hpp>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Core/Prng.h>
+#include <array>
+#include <cstddef>
+
+namespace OpenLoco::Benchmarks
+{
+    // Sized like the entity and station occupancy sets.
+    using LargeBitSet = BitSet<20000>;
+
+    static LargeBitSet makeSparseBitSet()
+    {
+        LargeBitSet bitset;
+        Core::Prng prng{ 0x12345678, 0x9ABCDEF0 };
+        for (auto i = 0; i < 500; i++)
+        {
+            bitset.set(prng.randNext(LargeBitSet{}.size() - 1), true);
+        }
+        return bitset;
+    }
+
+    static void prngRandNext(uint64_t numIterations)
+    {
+        Core::Prng prng{ 0x12345678, 0x9ABCDEF0 };
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(prng.randNext());
+        }
+    }
+
+    static void prngRandNextRange(uint64_t numIterations)
+    {
+        Core::Prng prng{ 0x12345678, 0x9ABCDEF0 };
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(prng.randNext(-100, 1000));
+        }
+    }
+
+    // One iteration writes 64 KiB in 64 byte blocks, the size of a small chunk of the save.
+    static void memoryStreamWrite(uint64_t numIterations)
+    {
+        std::array<std::byte, 64> block{};
+        MemoryStream stream;
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            stream.setPosition(0);
+            for (auto j = 0; j < 1024; j++)
+            {
+                stream.write(block.data(), block.size());
+            }
+            doNotOptimize(stream.data());
+        }
+    }
+
+    static void memoryStreamRead(uint64_t numIterations)
+    {
+        std::array<std::byte, 64> block{};
+        MemoryStream stream;
+        stream.resize(block.size() * 1024);
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            stream.setPosition(0);
+            for (auto j = 0; j < 1024; j++)
+            {
+                stream.read(block.data(), block.size());
+            }
+            doNotOptimize(block);
+        }
+    }
+
+    static void bitSetSetReset(uint64_t numIterations)
+    {
+        LargeBitSet bitset;
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            const auto index = (i * 7919) % bitset.size();
+            bitset.set(index, true);
+            doNotOptimize(bitset);
+            bitset.set(index, false);
+            doNotOptimize(bitset);
+        }
+    }
+
+    static void bitSetCount(uint64_t numIterations)
+    {
+        const auto bitset = makeSparseBitSet();
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(bitset.count());
+        }
+    }
+
+    static void bitSetFindNext(uint64_t numIterations)
+    {
+        const auto bitset = makeSparseBitSet();
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            size_t numSet = 0;
+            for (auto index = bitset.findFirst(); index < bitset.size(); index = bitset.findNext(index + 1))
+            {
+                numSet++;
+            }
+            doNotOptimize(numSet);
+        }
+    }
+
+    static void bitSetForEachSet(uint64_t numIterations)
+    {
+        const auto bitset = makeSparseBitSet();
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            size_t sum = 0;
+            bitset.forEachSet([&sum](size_t index) { sum += index; });
+            doNotOptimize(sum);
+        }
+    }
+
+    static void bitSetOr(uint64_t numIterations)
+    {
+        auto lhs = makeSparseBitSet();
+        const auto rhs = ~lhs;
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            lhs |= rhs;
+            doNotOptimize(lhs);
+        }
+    }
+
+    void addCoreBenchmarks(std::vector<Benchmark>& benchmarks)
+    {
+        benchmarks.push_back({ "Core.BitSet.count", bitSetCount });
+        benchmarks.push_back({ "Core.BitSet.findNext", bitSetFindNext });
+        benchmarks.push_back({ "Core.BitSet.forEachSet", bitSetForEachSet });
+        benchmarks.push_back({ "Core.BitSet.or", bitSetOr });
+        benchmarks.push_back({ "Core.BitSet.setReset", bitSetSetReset });
+        benchmarks.push_back({ "Core.MemoryStream.read64KiB", memoryStreamRead });
+        benchmarks.push_back({ "Core.MemoryStream.write64KiB", memoryStreamWrite });
+        benchmarks.push_back({ "Core.Prng.randNext", prngRandNext });
+        benchmarks.push_back({ "Core.Prng.randNextRange", prngRandNextRange });
+    }
+}
@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+#include <OpenLoco/Core/Prng.h>
+#include <OpenLoco/Gfx/DrawSpriteRow.hpp>
+#include <vector>
+
+namespace OpenLoco::Benchmarks
+{
+    // A screen full of 640 pixel wide rows, a quarter of the source pixels are transparent.
+    static constexpr size_t kRowWidth = 640;
+    static constexpr size_t kNumRows = 480;
+
+    static std::vector<uint8_t> makeSpriteData(uint32_t seed)
+    {
+        std::vector<uint8_t> data(kRowWidth * kNumRows);
+        Core::Prng prng{ seed, 0x9ABCDEF0 };
+        for (auto& pixel : data)
+        {
+            pixel = (prng.randNext() & 3) == 0 ? 0 : static_cast<uint8_t>(prng.randNext(1, 255));
+        }
+        return data;
+    }
+
+    static void drawSpriteRowCopyTransparent(uint64_t numIterations)
+    {
+        const auto src = makeSpriteData(0x12345678);
+        std::vector<uint8_t> dst(src.size());
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            for (size_t row = 0; row < kNumRows; row++)
+            {
+                Gfx::DrawSpriteRow::copyTransparent(src.data() + row * kRowWidth, dst.data() + row * kRowWidth, kRowWidth);
+            }
+            doNotOptimize(dst.data());
+        }
+    }
+
+    static void drawSpriteRowCopyTransparentMasked(uint64_t numIterations)
+    {
+        const auto src = makeSpriteData(0x12345678);
+        auto noiseMask = makeSpriteData(0x87654321);
+        for (auto& mask : noiseMask)
+        {
+            mask = mask != 0 ? 0xFF : 0;
+        }
+        std::vector<uint8_t> dst(src.size());
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            for (size_t row = 0; row < kNumRows; row++)
+            {
+                const auto offset = row * kRowWidth;
+                Gfx::DrawSpriteRow::copyTransparentMasked(src.data() + offset, noiseMask.data() + offset, dst.data() + offset, kRowWidth);
+            }
+            doNotOptimize(dst.data());
+        }
+    }
+
+    void addDrawSpriteBenchmarks(std::vector<Benchmark>& benchmarks)
+    {
+        benchmarks.push_back({ "Gfx.DrawSpriteRow.copyTransparent640x480", drawSpriteRowCopyTransparent });
+        benchmarks.push_back({ "Gfx.DrawSpriteRow.copyTransparentMasked640x480", drawSpriteRowCopyTransparentMasked });
+    }
+}
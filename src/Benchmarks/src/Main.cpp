@@ -0,0 +1,117 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <string_view>
+
+using namespace OpenLoco::Benchmarks;
+
+static void printUsage()
+{
+    std::fputs(
+        "usage: OpenLocoBench [--filter <text>] [--json <path>] [--min-time-ms <n>] [--repetitions <n>] [--list]\n"
+        "  --filter       only run the benchmarks whose name contains the text\n"
+        "  --json         write the results as JSON to the path, - for standard output\n"
+        "  --min-time-ms  minimum duration of each repetition, 50 by default\n"
+        "  --repetitions  number of timed repetitions, 5 by default\n"
+        "  --list         print the benchmark names and exit\n",
+        stderr);
+}
+
+static bool parseNumber(std::string_view text, uint32_t& value)
+{
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc() && ptr == text.data() + text.size();
+}
+
+int main(int argc, const char** argv)
+{
+    Options options;
+    bool listOnly = false;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--json" && hasValue)
+        {
+            options.jsonPath = argv[++i];
+        }
+        else if (arg == "--min-time-ms" && hasValue && parseNumber(argv[i + 1], options.minTimeMs))
+        {
+            i++;
+        }
+        else if (arg == "--repetitions" && hasValue && parseNumber(argv[i + 1], options.numRepetitions))
+        {
+            i++;
+        }
+        else if (arg == "--list")
+        {
+            listOnly = true;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::vector<Benchmark> benchmarks;
+    addCoreBenchmarks(benchmarks);
+    addMathBenchmarks(benchmarks);
+    addUtilityBenchmarks(benchmarks);
+    addSawyerBenchmarks(benchmarks);
+    addDrawSpriteBenchmarks(benchmarks);
+    std::sort(benchmarks.begin(), benchmarks.end(), [](const Benchmark& a, const Benchmark& b) { return a.name < b.name; });
+
+    // The table goes to stderr when the JSON is written to stdout
+    auto* table = options.jsonPath == "-" ? stderr : stdout;
+
+    if (!listOnly)
+    {
+        std::fprintf(table, "%-48s %17s %17s %17s\n", "Benchmark", "min", "median", "max");
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchmark : benchmarks)
+    {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+        if (listOnly)
+        {
+            std::fprintf(stdout, "%s\n", benchmark.name.c_str());
+            continue;
+        }
+
+        const auto& result = results.emplace_back(run(benchmark, options));
+        std::fprintf(table, "%-48s %14.3f ns %14.3f ns %14.3f ns\n", result.name.c_str(), result.minNs, result.medianNs, result.maxNs);
+        std::fflush(table);
+    }
+
+    if (listOnly || options.jsonPath.empty())
+    {
+        return 0;
+    }
+
+    const auto json = formatJson(results, options);
+    if (options.jsonPath == "-")
+    {
+        std::fputs(json.c_str(), stdout);
+        return 0;
+    }
+
+    std::ofstream file(options.jsonPath, std::ios::binary | std::ios::trunc);
+    file << json;
+    if (!file.good())
+    {
+        std::fprintf(stderr, "Unable to write %s\n", options.jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+#include <OpenLoco/Math/Trigonometry.hpp>
+#include <OpenLoco/Math/Vector.hpp>
+#include <vector>
+
+namespace OpenLoco::Benchmarks
+{
+    using namespace OpenLoco::Math;
+
+    using Point2D = Vector::TVector2<int32_t>;
+
+    static void trigonometryComputeXYVector(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            const auto pitch = static_cast<Pitch>(i % 13);
+            const auto yaw = static_cast<uint8_t>(i & 63);
+            doNotOptimize(Trigonometry::computeXYVector(static_cast<int32_t>(i & 0xFFF), pitch, yaw));
+        }
+    }
+
+    static void trigonometryIntegerSine(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Trigonometry::integerSinePrecisionHigh(static_cast<uint16_t>(i), 0x10000));
+        }
+    }
+
+    static void trigonometryIntegerCosine(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Trigonometry::integerCosinePrecisionHigh(static_cast<uint16_t>(i), 0x10000));
+        }
+    }
+
+    static void vectorRotate(uint64_t numIterations)
+    {
+        Point2D pos{ 1234, -567 };
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            pos = Vector::rotate(pos, static_cast<int32_t>(i));
+            doNotOptimize(pos);
+        }
+    }
+
+    // One iteration rotates 1024 positions with 16 bit components, like the world positions.
+    static void vectorRotateBatch(uint64_t numIterations)
+    {
+        std::vector<Vector::TVector2<int16_t>> positions(1024);
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            positions[i] = { static_cast<int16_t>(i * 32), static_cast<int16_t>(8192 - i * 32) };
+        }
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            Vector::rotate(std::span(positions), static_cast<int32_t>(i | 1));
+            doNotOptimize(positions.data());
+        }
+    }
+
+    static void trigonometryIntegerSineBatch(uint64_t numIterations)
+    {
+        std::vector<uint16_t> directions(1024);
+        std::vector<int32_t> magnitudes(1024);
+        std::vector<int32_t> out(1024);
+        for (size_t i = 0; i < directions.size(); i++)
+        {
+            directions[i] = static_cast<uint16_t>(i * 61);
+            magnitudes[i] = static_cast<int32_t>(i * 3);
+        }
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            Trigonometry::integerSinePrecisionHigh(directions, magnitudes, out);
+            doNotOptimize(out.data());
+        }
+    }
+
+    static void vectorDistance2D(uint64_t numIterations)
+    {
+        const Point2D origin{ 0, 0 };
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            const Point2D pos{ static_cast<int32_t>(i & 0x3FFF), static_cast<int32_t>((i >> 14) & 0x3FFF) };
+            doNotOptimize(Vector::distance2D(origin, pos));
+        }
+    }
+
+    void addMathBenchmarks(std::vector<Benchmark>& benchmarks)
+    {
+        benchmarks.push_back({ "Math.Trigonometry.computeXYVector", trigonometryComputeXYVector });
+        benchmarks.push_back({ "Math.Trigonometry.integerCosine", trigonometryIntegerCosine });
+        benchmarks.push_back({ "Math.Trigonometry.integerSine", trigonometryIntegerSine });
+        benchmarks.push_back({ "Math.Trigonometry.integerSineBatch1024", trigonometryIntegerSineBatch });
+        benchmarks.push_back({ "Math.Vector.distance2D", vectorDistance2D });
+        benchmarks.push_back({ "Math.Vector.rotate", vectorRotate });
+        benchmarks.push_back({ "Math.Vector.rotateBatch1024", vectorRotateBatch });
+    }
+}
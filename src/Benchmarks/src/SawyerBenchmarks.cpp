@@ -0,0 +1,75 @@
+#include "Benchmark.h"
+#include "S5/SawyerStream.h"
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Core/Prng.h>
+#include <vector>
+
+namespace OpenLoco::Benchmarks
+{
+    static constexpr size_t kChunkSize = 256 * 1024;
+
+    // Alternates runs of a repeated byte with stretches of noise, roughly how the game state compresses.
+    static std::vector<std::byte> makeChunkData()
+    {
+        std::vector<std::byte> data;
+        data.reserve(kChunkSize);
+        Core::Prng prng{ 0x12345678, 0x9ABCDEF0 };
+        while (data.size() < kChunkSize)
+        {
+            const auto length = static_cast<size_t>(prng.randNext(1, 64));
+            if (prng.randBool())
+            {
+                data.insert(data.end(), length, static_cast<std::byte>(prng.randNext(255)));
+            }
+            else
+            {
+                for (size_t i = 0; i < length; i++)
+                {
+                    data.push_back(static_cast<std::byte>(prng.randNext(255)));
+                }
+            }
+        }
+        data.resize(kChunkSize);
+        return data;
+    }
+
+    template<SawyerEncoding TEncoding>
+    static void sawyerEncode(uint64_t numIterations)
+    {
+        const auto data = makeChunkData();
+        MemoryStream stream;
+        SawyerStreamWriter writer(stream);
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            stream.setPosition(0);
+            writer.writeChunk(TEncoding, data.data(), data.size());
+            doNotOptimize(stream.data());
+        }
+    }
+
+    template<SawyerEncoding TEncoding>
+    static void sawyerDecode(uint64_t numIterations)
+    {
+        const auto data = makeChunkData();
+        MemoryStream stream;
+        SawyerStreamWriter writer(stream);
+        writer.writeChunk(TEncoding, data.data(), data.size());
+
+        SawyerStreamReader reader(stream);
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            stream.setPosition(0);
+            doNotOptimize(reader.readChunk().data());
+        }
+    }
+
+    void addSawyerBenchmarks(std::vector<Benchmark>& benchmarks)
+    {
+        benchmarks.push_back({ "Sawyer.decode.rotate256KiB", sawyerDecode<SawyerEncoding::rotate> });
+        benchmarks.push_back({ "Sawyer.decode.runLengthMulti256KiB", sawyerDecode<SawyerEncoding::runLengthMulti> });
+        benchmarks.push_back({ "Sawyer.decode.runLengthSingle256KiB", sawyerDecode<SawyerEncoding::runLengthSingle> });
+        benchmarks.push_back({ "Sawyer.encode.rotate256KiB", sawyerEncode<SawyerEncoding::rotate> });
+        benchmarks.push_back({ "Sawyer.encode.runLengthMulti256KiB", sawyerEncode<SawyerEncoding::runLengthMulti> });
+        benchmarks.push_back({ "Sawyer.encode.runLengthSingle256KiB", sawyerEncode<SawyerEncoding::runLengthSingle> });
+    }
+}
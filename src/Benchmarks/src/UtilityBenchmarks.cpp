@@ -0,0 +1,69 @@
+#include "Benchmark.h"
+#include <OpenLoco/Utility/String.hpp>
+#include <array>
+#include <string_view>
+
+namespace OpenLoco::Benchmarks
+{
+    static constexpr std::array<std::string_view, 8> kNames = {
+        "Train Station 2",
+        "train station 10",
+        "Bus Depot",
+        "Railway Terminus 1",
+        "Airport 12",
+        "airport 3",
+        "Harbour",
+        "Train Station 100",
+    };
+
+    static void stringStrlogicalcmp(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Utility::strlogicalcmp(kNames[i & 7], kNames[(i + 3) & 7]));
+        }
+    }
+
+    static void stringIequals(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Utility::iequals(kNames[i & 7], kNames[(i + 7) & 7]));
+        }
+    }
+
+    static void stringStartsWith(uint64_t numIterations)
+    {
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Utility::startsWith(kNames[i & 7], "train", true));
+        }
+    }
+
+    static void stringStrlcpy(uint64_t numIterations)
+    {
+        char buffer[16];
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Utility::strlcpy(buffer, kNames[i & 7].data(), sizeof(buffer)));
+        }
+    }
+
+    static void stringEscapeJson(uint64_t numIterations)
+    {
+        constexpr std::string_view kText = "C:\\Games\\Locomotion\\Scenarios\\\"Big Island\".SC5";
+        for (uint64_t i = 0; i < numIterations; i++)
+        {
+            doNotOptimize(Utility::escapeJson(kText));
+        }
+    }
+
+    void addUtilityBenchmarks(std::vector<Benchmark>& benchmarks)
+    {
+        benchmarks.push_back({ "Utility.String.escapeJson", stringEscapeJson });
+        benchmarks.push_back({ "Utility.String.iequals", stringIequals });
+        benchmarks.push_back({ "Utility.String.startsWith", stringStartsWith });
+        benchmarks.push_back({ "Utility.String.strlcpy", stringStrlcpy });
+        benchmarks.push_back({ "Utility.String.strlogicalcmp", stringStrlogicalcmp });
+    }
+}
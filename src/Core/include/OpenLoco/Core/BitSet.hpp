@@ -296,6 +296,64 @@ namespace OpenLoco
             return kCapacityBits;
         }
 
+        constexpr bool any() const noexcept
+        {
+            return std::any_of(_data.begin(), _data.end(), [](auto data) { return data != kBlockValueZero; });
+        }
+
+        constexpr bool none() const noexcept
+        {
+            return !any();
+        }
+
+        // Returns the index of the first set bit at or after index, or size() if there is none.
+        constexpr size_t findNext(size_t index) const noexcept
+        {
+            if (index >= TBitSize)
+            {
+                return TBitSize;
+            }
+
+            auto blockIndex = computeBlockIndex(index);
+            auto block = static_cast<StorageBlockType>(_data[blockIndex] & static_cast<StorageBlockType>(kBlockValueMask << computeBlockOffset(index)));
+            while (block == kBlockValueZero)
+            {
+                if (++blockIndex == kBlockCount)
+                {
+                    return TBitSize;
+                }
+                block = _data[blockIndex];
+            }
+            return std::min<size_t>(blockIndex * kBlockBitSize + std::countr_zero(block), TBitSize);
+        }
+
+        // Returns the index of the first set bit, or size() if there is none.
+        constexpr size_t findFirst() const noexcept
+        {
+            return findNext(0);
+        }
+
+        // Calls func with the index of each set bit in ascending order.
+        template<typename TFunc>
+        constexpr void forEachSet(TFunc&& func) const
+        {
+            for (size_t blockIndex = 0; blockIndex < kBlockCount; blockIndex++)
+            {
+                auto block = _data[blockIndex];
+                while (block != kBlockValueZero)
+                {
+                    const auto index = blockIndex * kBlockBitSize + std::countr_zero(block);
+                    if (index >= TBitSize)
+                    {
+                        return;
+                    }
+                    func(index);
+                    // Clears the lowest set bit
+                    block = static_cast<StorageBlockType>(block & (block - 1));
+                }
+            }
+        }
+
         constexpr Storage& data() noexcept
         {
             return _data;
@@ -408,7 +466,7 @@ namespace OpenLoco
 
         constexpr BitSet& operator^=(const BitSet& other) noexcept
         {
-            *this = *this ^ other;
+            applyOp<std::bit_xor<BlockType>>(*this, other, std::make_index_sequence<kBlockCount>{});
             return *this;
         }
 
@@ -421,7 +479,7 @@ namespace OpenLoco
 
         constexpr BitSet& operator|=(const BitSet& other) noexcept
         {
-            *this = *this | other;
+            applyOp<std::bit_or<BlockType>>(*this, other, std::make_index_sequence<kBlockCount>{});
             return *this;
         }
 
@@ -434,7 +492,14 @@ namespace OpenLoco
 
         constexpr BitSet& operator&=(const BitSet& other) noexcept
         {
-            *this = *this & other;
+            applyOp<std::bit_and<BlockType>>(*this, other, std::make_index_sequence<kBlockCount>{});
+            return *this;
+        }
+
+        // Clears the bits that are set in other.
+        constexpr BitSet& andNot(const BitSet& other) noexcept
+        {
+            applyOp<AndNot>(*this, other, std::make_index_sequence<kBlockCount>{});
             return *this;
         }
 
@@ -477,8 +542,16 @@ namespace OpenLoco
         }
 
     private:
+        struct AndNot
+        {
+            constexpr BlockType operator()(BlockType lhs, BlockType rhs) const noexcept
+            {
+                return static_cast<BlockType>(lhs & ~rhs);
+            }
+        };
+
         template<typename TOperator, size_t... TIndex>
-        void applyOp(BitSet& dst, const BitSet& src, std::index_sequence<TIndex...>) const
+        constexpr void applyOp(BitSet& dst, const BitSet& src, std::index_sequence<TIndex...>) const
         {
             TOperator op{};
             ((dst._data[TIndex] = op(dst._data[TIndex], src._data[TIndex])), ...);
@@ -9,18 +9,30 @@ namespace OpenLoco
 {
     class FileStream final : public Stream
     {
+    public:
+        static constexpr size_t kDefaultBufferSize = 1024 * 1024;
+
     private:
         FILE* _file{};
+        // Only set for StreamMode::readMapped
+        const std::byte* _mappedData{};
         StreamMode _mode{};
         size_t _length{};
         size_t _offset{};
 
+        bool openMapped(const std::filesystem::path& path);
+
     public:
         FileStream() = default;
-        FileStream(const std::filesystem::path& path, StreamMode mode);
+        // bufferSize is the size of the buffer used for reads and writes, 0 disables the buffering.
+        // It has no effect on mapped files.
+        FileStream(const std::filesystem::path& path, StreamMode mode, size_t bufferSize = kDefaultBufferSize);
         ~FileStream() override;
 
-        bool open(const std::filesystem::path& path, StreamMode mode);
+        FileStream(const FileStream&) = delete;
+        FileStream& operator=(const FileStream&) = delete;
+
+        bool open(const std::filesystem::path& path, StreamMode mode, size_t bufferSize = kDefaultBufferSize);
 
         bool isOpen() const noexcept;
 
@@ -37,5 +49,8 @@ namespace OpenLoco
         void read(void* buffer, size_t len) override;
 
         void write(const void* buffer, size_t len) override;
+
+        // Views stay valid until the file is closed.
+        std::span<const std::byte> readView(size_t len) override;
     };
 }
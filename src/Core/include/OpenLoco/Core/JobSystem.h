@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace OpenLoco::Core
+{
+    namespace Detail
+    {
+        struct Job;
+        struct JobQueue;
+    }
+
+    // Shared so that a finished job stays valid for anything still waiting on it.
+    using JobHandle = std::shared_ptr<Detail::Job>;
+
+    // Lets the diagnostics library trace the workers and jobs without Core depending on it.
+    struct JobTraceHooks
+    {
+        void (*workerStarted)(uint32_t workerIndex) = nullptr;
+        bool (*isCapturing)() = nullptr;
+        void (*jobFinished)(std::string_view name, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) = nullptr;
+    };
+
+    // A fixed pool of worker threads, each with a queue of its own. Workers take their newest job
+    // first and steal the oldest job of another queue when theirs is empty. Threads that wait on a
+    // job run queued jobs in the meantime, so jobs may schedule and wait on jobs of their own.
+    class JobSystem
+    {
+        std::vector<std::unique_ptr<Detail::JobQueue>> _queues; // One per worker, the last is for threads outside the pool
+        std::vector<std::thread> _workers;
+        JobTraceHooks _hooks;
+
+        std::mutex _sleepMutex;
+        std::condition_variable _wakeCondition;
+        std::atomic<size_t> _numQueued{};
+        bool _isStopping = false;
+
+        size_t getQueueIndex() const;
+        void push(JobHandle job);
+        JobHandle tryPop(size_t queueIndex);
+        void run(const JobHandle& job);
+        void workerLoop(uint32_t workerIndex);
+
+    public:
+        // The thread count includes the thread that waits on the jobs, 0 uses one per hardware thread.
+        explicit JobSystem(uint32_t numThreads = 0, JobTraceHooks hooks = {});
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        uint32_t getNumThreads() const
+        {
+            return static_cast<uint32_t>(_workers.size() + 1);
+        }
+
+        // Queues the function once all of its dependencies have finished, a dependency that threw
+        // does not stop its dependents. Names are not copied, string literals are the intended use.
+        JobHandle schedule(std::string_view name, std::function<void()> func, std::span<const JobHandle> dependencies = {});
+
+        // Runs queued jobs on the calling thread until the job has finished, then rethrows anything
+        // the job threw.
+        void wait(const JobHandle& job);
+
+        // Calls func(begin, end) for consecutive chunks of chunkSize indices below count. The chunks
+        // only depend on count and chunkSize and not on the number of threads, so results gathered
+        // per chunk come out the same on every machine. Rethrows the exception of the lowest chunk
+        // that threw once all of the chunks have run.
+        template<typename TFunc>
+        void parallelFor(std::string_view name, size_t count, size_t chunkSize, TFunc&& func)
+        {
+            chunkSize = std::max<size_t>(chunkSize, 1);
+            const auto numChunks = (count + chunkSize - 1) / chunkSize;
+
+            std::mutex errorMutex;
+            size_t errorChunk = numChunks;
+            std::exception_ptr error;
+
+            std::atomic<size_t> nextChunk = 0;
+            auto runChunks = [&]() {
+                for (auto chunk = nextChunk++; chunk < numChunks; chunk = nextChunk++)
+                {
+                    const auto begin = chunk * chunkSize;
+                    try
+                    {
+                        func(begin, std::min(begin + chunkSize, count));
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(errorMutex);
+                        if (chunk < errorChunk)
+                        {
+                            errorChunk = chunk;
+                            error = std::current_exception();
+                        }
+                    }
+                }
+            };
+
+            const auto numRunners = std::min<size_t>(numChunks, getNumThreads());
+            std::vector<JobHandle> runners;
+            runners.reserve(numRunners);
+            for (size_t i = 1; i < numRunners; i++)
+            {
+                runners.push_back(schedule(name, runChunks));
+            }
+            runChunks();
+            for (const auto& runner : runners)
+            {
+                wait(runner);
+            }
+
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // The engine wide pool, started with the default thread count on first use.
+        static JobSystem& get();
+
+        // Replaces the engine wide pool, no jobs may be running on the old one.
+        static void configure(uint32_t numThreads, JobTraceHooks hooks);
+    };
+}
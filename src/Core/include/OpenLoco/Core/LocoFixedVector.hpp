@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BitSet.hpp"
 #include <iterator>
 
 namespace OpenLoco
@@ -7,19 +8,34 @@ namespace OpenLoco
     template<typename ValueType, size_t Count>
     class FixedVector
     {
+    public:
+        using Occupancy = BitSet<Count>;
+
     private:
         ValueType* startAddress = nullptr;
+        // Optional set of the slots in use so iteration can skip the empty slots without reading them.
+        // It may have bits set for slots that have been emptied, but every slot in use must have its bit set.
+        const Occupancy* occupancy = nullptr;
 
         class Iter
         {
         private:
             ValueType* arr;
+            const Occupancy* occupancy;
             size_t i = 0;
 
             constexpr void findNonEmpty()
             {
                 for (; i < Count; ++i)
                 {
+                    if (occupancy != nullptr)
+                    {
+                        i = occupancy->findNext(i);
+                        if (i == Count)
+                        {
+                            break;
+                        }
+                    }
                     if (!arr[i].empty())
                     {
                         break;
@@ -28,8 +44,9 @@ namespace OpenLoco
             }
 
         public:
-            constexpr Iter(ValueType* _arr, size_t _index)
+            constexpr Iter(ValueType* _arr, const Occupancy* _occupancy, size_t _index)
                 : arr(_arr)
+                , occupancy(_occupancy)
                 , i(_index)
             {
                 // finds first valid entry
@@ -73,13 +90,19 @@ namespace OpenLoco
         {
         }
 
+        FixedVector(ValueType (&_arr)[Count], const Occupancy& _occupancy)
+            : startAddress(_arr)
+            , occupancy(&_occupancy)
+        {
+        }
+
         Iter begin() const
         {
-            return Iter(startAddress, 0);
+            return Iter(startAddress, occupancy, 0);
         }
         Iter end() const
         {
-            return Iter(startAddress, Count);
+            return Iter(startAddress, occupancy, Count);
         }
 
         [[nodiscard]] bool empty() const
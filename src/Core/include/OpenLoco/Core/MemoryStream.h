@@ -8,6 +8,8 @@
 
 namespace OpenLoco
 {
+    // Large buffers are handed to a small shared pool when a stream is destroyed and taken from it again
+    // when a stream grows, so streams that are repeatedly created for saves don't reallocate every time.
     class MemoryStream final : public Stream
     {
         std::byte* _data{};
@@ -15,9 +17,20 @@ namespace OpenLoco
         size_t _length{};
         size_t _capacity{};
 
+        void grow(size_t capacity);
+
     public:
+        MemoryStream() = default;
+        // Reserves capacityHint bytes up front.
+        explicit MemoryStream(size_t capacityHint);
         ~MemoryStream() override;
 
+        MemoryStream(const MemoryStream&) = delete;
+        MemoryStream& operator=(const MemoryStream&) = delete;
+
+        // Frees the buffers held by the pool.
+        static void releasePooledBuffers();
+
         void reserve(size_t len);
 
         void resize(size_t len);
@@ -41,5 +54,7 @@ namespace OpenLoco
         void read(void* buffer, size_t len) override;
 
         void write(const void* buffer, size_t len) override;
+
+        std::span<const std::byte> readView(size_t len) override;
     };
 }
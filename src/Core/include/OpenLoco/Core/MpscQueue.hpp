@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace OpenLoco::Core
+{
+    // A bounded lock free queue for any number of producer threads and exactly one consumer thread.
+    // Each slot has a sequence number that tells whether it is free for the producer that claimed its
+    // position or holds an item for the consumer, items are kept in their slot so reused slots keep
+    // any storage they own.
+    template<typename T, size_t Capacity>
+    class MpscQueue
+    {
+        static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        static constexpr size_t kCacheLineSize = 64;
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            T item;
+        };
+
+        std::unique_ptr<Slot[]> _slots = []() {
+            auto slots = std::make_unique<Slot[]>(Capacity);
+            for (size_t i = 0; i < Capacity; i++)
+            {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            return slots;
+        }();
+        // Claimed by the producers
+        alignas(kCacheLineSize) std::atomic<size_t> _tail{};
+        // Written by the consumer only
+        alignas(kCacheLineSize) std::atomic<size_t> _head{};
+
+    public:
+        // Calls fill with the item of a free slot, returns false without calling it if the queue is full.
+        template<typename TFunc>
+        bool tryEmplace(TFunc&& fill)
+        {
+            auto pos = _tail.load(std::memory_order_relaxed);
+            Slot* slot;
+            while (true)
+            {
+                slot = &_slots[pos & (Capacity - 1)];
+                const auto sequence = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+                if (diff == 0)
+                {
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // The consumer hasn't taken the item a lap ago yet
+                    return false;
+                }
+                else
+                {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+
+            fill(slot->item);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool tryPush(const T& item)
+        {
+            return tryEmplace([&item](T& slotItem) { slotItem = item; });
+        }
+
+        // Consumer only, calls read with the oldest item and returns false if the queue is empty.
+        template<typename TFunc>
+        bool tryConsume(TFunc&& read)
+        {
+            const auto head = _head.load(std::memory_order_relaxed);
+            auto& slot = _slots[head & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            {
+                return false;
+            }
+
+            read(slot.item);
+            slot.sequence.store(head + Capacity, std::memory_order_release);
+            _head.store(head + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Consumer only.
+        std::optional<T> tryPop()
+        {
+            std::optional<T> result;
+            tryConsume([&result](T& item) { result = std::move(item); });
+            return result;
+        }
+
+        // Consumer only, a producer may be about to finish writing an item when this returns true.
+        bool empty() const
+        {
+            const auto head = _head.load(std::memory_order_relaxed);
+            return _slots[head & (Capacity - 1)].sequence.load(std::memory_order_acquire) != head + 1;
+        }
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace OpenLoco::Core
+{
+    // A bounded lock free queue for exactly one producer thread and one consumer thread.
+    template<typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        static constexpr size_t kCacheLineSize = 64;
+
+        std::unique_ptr<T[]> _items = std::make_unique<T[]>(Capacity);
+        // Written by the consumer only
+        alignas(kCacheLineSize) std::atomic<size_t> _head{};
+        // Written by the producer only
+        alignas(kCacheLineSize) std::atomic<size_t> _tail{};
+
+    public:
+        // Producer only, returns false if the queue is full.
+        bool tryPush(const T& item)
+        {
+            const auto tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _head.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+            _items[tail & (Capacity - 1)] = item;
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Producer only, a push will succeed if this returns false.
+        bool full() const
+        {
+            return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire) == Capacity;
+        }
+
+        // Consumer only.
+        std::optional<T> tryPop()
+        {
+            const auto head = _head.load(std::memory_order_relaxed);
+            if (head == _tail.load(std::memory_order_acquire))
+            {
+                return std::nullopt;
+            }
+            std::optional<T> item = std::move(_items[head & (Capacity - 1)]);
+            _head.store(head + 1, std::memory_order_release);
+            return item;
+        }
+
+        // Consumer only.
+        bool empty() const
+        {
+            return _head.load(std::memory_order_relaxed) == _tail.load(std::memory_order_acquire);
+        }
+    };
+}
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <istream>
+#include <span>
 
 namespace OpenLoco
 {
@@ -37,6 +38,8 @@ namespace OpenLoco
         none = 0,
         read,
         write,
+        // Read only, the file is mapped into memory so reads can be served as views of it.
+        readMapped,
     };
 
     class Stream
@@ -50,6 +53,13 @@ namespace OpenLoco
         virtual void read(void*, size_t) = 0;
         virtual void write(const void*, size_t) = 0;
 
+        // Returns the next len bytes without copying and moves past them, for streams that hold their data
+        // in memory. Every other stream returns an empty span and leaves the position as it was.
+        virtual std::span<const std::byte> readView([[maybe_unused]] size_t len)
+        {
+            return {};
+        }
+
         template<typename T>
         T readValue()
         {
@@ -1,8 +1,24 @@
 #include "FileStream.h"
 #include "Exception.hpp"
 #include <algorithm>
+#include <cstring>
 #include <stdio.h>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace OpenLoco
 {
     static FILE* fileOpen(const std::filesystem::path& path, StreamMode mode)
@@ -74,9 +90,95 @@ namespace OpenLoco
         return length;
     }
 
-    FileStream::FileStream(const std::filesystem::path& path, StreamMode mode)
+    // Maps the whole file read only, the handles can be closed straight away as the view keeps the mapping alive.
+    static bool mapFile(const std::filesystem::path& path, const std::byte*& data, size_t& length)
+    {
+#ifdef _WIN32
+        auto file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        data = nullptr;
+        length = static_cast<size_t>(fileSize.QuadPart);
+        if (length == 0)
+        {
+            // Empty files can't be mapped
+            CloseHandle(file);
+            return true;
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(mapping);
+        return data != nullptr;
+#else
+        const auto fd = ::open(path.u8string().c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat
+        {
+        };
+        if (fstat(fd, &fileStat) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        data = nullptr;
+        length = static_cast<size_t>(fileStat.st_size);
+        if (length == 0)
+        {
+            // Empty files can't be mapped
+            ::close(fd);
+            return true;
+        }
+
+        auto* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(mapping);
+        return true;
+#endif
+    }
+
+    static void unmapFile(const std::byte* data, [[maybe_unused]] size_t length)
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<std::byte*>(data), length);
+#endif
+    }
+
+    FileStream::FileStream(const std::filesystem::path& path, StreamMode mode, size_t bufferSize)
     {
-        if (!open(path, mode))
+        if (!open(path, mode, bufferSize))
         {
             // TODO: Make this work like fstream which is not throwing for failing to open the file.
             throw Exception::RuntimeError("Failed to open '" + path.u8string() + "' for writing");
@@ -88,18 +190,43 @@ namespace OpenLoco
         close();
     }
 
-    bool FileStream::open(const std::filesystem::path& path, StreamMode mode)
+    bool FileStream::openMapped(const std::filesystem::path& path)
+    {
+        if (!mapFile(path, _mappedData, _length))
+        {
+            _mappedData = nullptr;
+            _length = 0;
+            return false;
+        }
+
+        _offset = 0;
+        _mode = StreamMode::readMapped;
+        return true;
+    }
+
+    bool FileStream::open(const std::filesystem::path& path, StreamMode mode, size_t bufferSize)
     {
         close();
 
+        if (mode == StreamMode::readMapped)
+        {
+            return openMapped(path);
+        }
+
         _file = fileOpen(path, mode);
         if (_file == nullptr)
         {
             return false;
         }
 
-        // Increase the buffer size to 1MiB.
-        std::setvbuf(_file, nullptr, _IOFBF, 1024 * 1024);
+        if (bufferSize == 0)
+        {
+            std::setvbuf(_file, nullptr, _IONBF, 0);
+        }
+        else
+        {
+            std::setvbuf(_file, nullptr, _IOFBF, bufferSize);
+        }
 
         // Get the length if we are reading an existing file.
         if (mode == StreamMode::read)
@@ -114,21 +241,30 @@ namespace OpenLoco
 
     bool FileStream::isOpen() const noexcept
     {
-        return _file != nullptr;
+        return _mode != StreamMode::none;
     }
 
     void FileStream::close()
     {
-        if (_file == nullptr)
+        if (_mode == StreamMode::none)
         {
             return;
         }
+
+        if (_mode == StreamMode::readMapped)
+        {
+            unmapFile(_mappedData, _length);
+            _mappedData = nullptr;
+        }
+        else
+        {
+            fileClose(_file);
+            _file = nullptr;
+        }
+
         _mode = StreamMode::none;
         _length = 0;
         _offset = 0;
-
-        fileClose(_file);
-        _file = nullptr;
     }
 
     StreamMode FileStream::getMode() const noexcept
@@ -153,12 +289,24 @@ namespace OpenLoco
             throw Exception::InvalidOperation("Invalid mode");
         }
         position = std::min(_length, static_cast<size_t>(position));
-        fileSeek(_file, position, SEEK_SET);
+        if (_mode != StreamMode::readMapped)
+        {
+            fileSeek(_file, position, SEEK_SET);
+        }
         _offset = position;
     }
 
     void FileStream::read(void* buffer, size_t len)
     {
+        if (_mode == StreamMode::readMapped)
+        {
+            const auto view = readView(len);
+            if (!view.empty())
+            {
+                std::memcpy(buffer, view.data(), view.size());
+            }
+            return;
+        }
         if (_mode != StreamMode::read)
         {
             throw Exception::InvalidOperation("Can not read");
@@ -193,4 +341,20 @@ namespace OpenLoco
         _offset += bytesWriten;
         _length = std::max(_length, _offset);
     }
+
+    std::span<const std::byte> FileStream::readView(size_t len)
+    {
+        if (_mode != StreamMode::readMapped)
+        {
+            return {};
+        }
+        if (len > _length - _offset)
+        {
+            throw Exception::RuntimeError("Failed to read data");
+        }
+
+        const auto view = std::span<const std::byte>(_mappedData + _offset, len);
+        _offset += len;
+        return view;
+    }
 }
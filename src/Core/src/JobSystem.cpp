@@ -0,0 +1,247 @@
+#include "JobSystem.h"
+#include <deque>
+
+namespace OpenLoco::Core
+{
+    namespace Detail
+    {
+        struct Job
+        {
+            std::function<void()> func;
+            std::string_view name;
+            // Starts at one so the job isn't queued before all of its dependencies are added
+            std::atomic<uint32_t> numPendingDependencies{ 1 };
+            std::atomic<bool> isFinished{};
+            std::exception_ptr error;
+
+            // Guards the dependents against the job finishing while they are added
+            std::mutex mutex;
+            bool hasFinished = false;
+            std::vector<JobHandle> dependents;
+        };
+
+        struct JobQueue
+        {
+            std::mutex mutex;
+            std::deque<JobHandle> jobs;
+        };
+    }
+
+    // Which pool the current thread works for and the index of its queue in that pool
+    static thread_local const JobSystem* _workerPool = nullptr;
+    static thread_local size_t _workerQueueIndex = 0;
+
+    static std::mutex _sharedMutex;
+    static std::unique_ptr<JobSystem> _shared;
+
+    JobSystem::JobSystem(uint32_t numThreads, JobTraceHooks hooks)
+        : _hooks(hooks)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        for (uint32_t i = 0; i < numThreads; i++)
+        {
+            _queues.push_back(std::make_unique<Detail::JobQueue>());
+        }
+        // The queues exist before any worker starts stealing from them
+        _workers.reserve(numThreads - 1);
+        for (uint32_t i = 0; i + 1 < numThreads; i++)
+        {
+            _workers.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(_sleepMutex);
+            _isStopping = true;
+        }
+        _wakeCondition.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t JobSystem::getQueueIndex() const
+    {
+        return _workerPool == this ? _workerQueueIndex : _queues.size() - 1;
+    }
+
+    void JobSystem::push(JobHandle job)
+    {
+        {
+            // Taking the lock keeps a worker from missing the job between its check and its sleep.
+            // Counting first means the count is never below the number of jobs in the queues.
+            std::lock_guard lock(_sleepMutex);
+            _numQueued++;
+        }
+        auto& queue = *_queues[getQueueIndex()];
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+        _wakeCondition.notify_one();
+    }
+
+    JobHandle JobSystem::tryPop(size_t queueIndex)
+    {
+        if (_numQueued.load(std::memory_order_relaxed) == 0)
+        {
+            return nullptr;
+        }
+
+        for (size_t i = 0; i < _queues.size(); i++)
+        {
+            auto& queue = *_queues[(queueIndex + i) % _queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (queue.jobs.empty())
+            {
+                continue;
+            }
+
+            JobHandle job;
+            if (i == 0)
+            {
+                job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+            }
+            else
+            {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+            }
+            _numQueued--;
+            return job;
+        }
+        return nullptr;
+    }
+
+    void JobSystem::run(const JobHandle& job)
+    {
+        const bool isTraced = _hooks.jobFinished != nullptr && _hooks.isCapturing != nullptr && _hooks.isCapturing();
+        const auto begin = isTraced ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+        try
+        {
+            job->func();
+        }
+        catch (...)
+        {
+            job->error = std::current_exception();
+        }
+        // Releases whatever the function captured
+        job->func = nullptr;
+        if (isTraced)
+        {
+            _hooks.jobFinished(job->name, begin, std::chrono::steady_clock::now());
+        }
+
+        std::vector<JobHandle> dependents;
+        {
+            std::lock_guard lock(job->mutex);
+            job->hasFinished = true;
+            dependents.swap(job->dependents);
+        }
+        job->isFinished.store(true, std::memory_order_release);
+
+        for (auto& dependent : dependents)
+        {
+            if (--dependent->numPendingDependencies == 0)
+            {
+                push(std::move(dependent));
+            }
+        }
+    }
+
+    void JobSystem::workerLoop(uint32_t workerIndex)
+    {
+        _workerPool = this;
+        _workerQueueIndex = workerIndex;
+        if (_hooks.workerStarted != nullptr)
+        {
+            _hooks.workerStarted(workerIndex);
+        }
+
+        while (true)
+        {
+            if (auto job = tryPop(workerIndex))
+            {
+                run(job);
+                continue;
+            }
+
+            std::unique_lock lock(_sleepMutex);
+            _wakeCondition.wait(lock, [this]() { return _isStopping || _numQueued > 0; });
+            if (_isStopping && _numQueued == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    JobHandle JobSystem::schedule(std::string_view name, std::function<void()> func, std::span<const JobHandle> dependencies)
+    {
+        auto job = std::make_shared<Detail::Job>();
+        job->func = std::move(func);
+        job->name = name;
+
+        for (const auto& dependency : dependencies)
+        {
+            std::lock_guard lock(dependency->mutex);
+            if (!dependency->hasFinished)
+            {
+                job->numPendingDependencies++;
+                dependency->dependents.push_back(job);
+            }
+        }
+
+        if (--job->numPendingDependencies == 0)
+        {
+            push(job);
+        }
+        return job;
+    }
+
+    void JobSystem::wait(const JobHandle& job)
+    {
+        const auto queueIndex = getQueueIndex();
+        while (!job->isFinished.load(std::memory_order_acquire))
+        {
+            if (auto next = tryPop(queueIndex))
+            {
+                run(next);
+            }
+            else
+            {
+                // The job is running on another thread
+                std::this_thread::yield();
+            }
+        }
+
+        if (job->error != nullptr)
+        {
+            std::rethrow_exception(job->error);
+        }
+    }
+
+    JobSystem& JobSystem::get()
+    {
+        std::lock_guard lock(_sharedMutex);
+        if (_shared == nullptr)
+        {
+            _shared = std::make_unique<JobSystem>();
+        }
+        return *_shared;
+    }
+
+    void JobSystem::configure(uint32_t numThreads, JobTraceHooks hooks)
+    {
+        std::lock_guard lock(_sharedMutex);
+        _shared.reset();
+        _shared = std::make_unique<JobSystem>(numThreads, hooks);
+    }
+}
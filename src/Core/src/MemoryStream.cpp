@@ -1,33 +1,128 @@
 #include "MemoryStream.h"
 #include "Exception.hpp"
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <optional>
 
 namespace OpenLoco
 {
+    // Smaller buffers are cheap to allocate and larger ones aren't kept around
+    static constexpr size_t kMinPooledCapacity = 64 * 1024;
+    static constexpr size_t kMaxPooledCapacity = 64 * 1024 * 1024;
+    static constexpr size_t kMaxPooledBuffers = 4;
+
+    struct PooledBuffer
+    {
+        std::byte* data;
+        size_t capacity;
+    };
+
+    // Streams are used from the save and load worker threads
+    static std::mutex _poolMutex;
+    static std::vector<PooledBuffer> _pool;
+
+    // Takes the smallest pooled buffer that holds at least minCapacity bytes.
+    static std::optional<PooledBuffer> takePooledBuffer(size_t minCapacity)
+    {
+        std::lock_guard lock(_poolMutex);
+        auto best = _pool.end();
+        for (auto it = _pool.begin(); it != _pool.end(); ++it)
+        {
+            if (it->capacity >= minCapacity && (best == _pool.end() || it->capacity < best->capacity))
+            {
+                best = it;
+            }
+        }
+        if (best == _pool.end())
+        {
+            return std::nullopt;
+        }
+
+        const auto buffer = *best;
+        _pool.erase(best);
+        return buffer;
+    }
+
+    // Frees the buffer if the pool doesn't take it, replacing the smallest pooled buffer if this one is larger.
+    static void releaseBuffer(std::byte* data, size_t capacity)
+    {
+        if (capacity >= kMinPooledCapacity && capacity <= kMaxPooledCapacity)
+        {
+            std::lock_guard lock(_poolMutex);
+            if (_pool.size() < kMaxPooledBuffers)
+            {
+                _pool.push_back({ data, capacity });
+                return;
+            }
+
+            auto smallest = std::ranges::min_element(_pool, {}, &PooledBuffer::capacity);
+            if (smallest->capacity < capacity)
+            {
+                std::swap(data, smallest->data);
+                std::swap(capacity, smallest->capacity);
+            }
+        }
+        std::free(data);
+    }
+
+    void MemoryStream::releasePooledBuffers()
+    {
+        std::lock_guard lock(_poolMutex);
+        for (auto& buffer : _pool)
+        {
+            std::free(buffer.data);
+        }
+        _pool.clear();
+    }
+
+    MemoryStream::MemoryStream(size_t capacityHint)
+    {
+        reserve(capacityHint);
+    }
+
     MemoryStream::~MemoryStream()
     {
         if (_data != nullptr)
         {
-            std::free(_data);
+            releaseBuffer(_data, _capacity);
         }
     }
 
-    void MemoryStream::reserve(size_t len)
+    void MemoryStream::grow(size_t capacity)
     {
-        if (len == 0 || len < _capacity)
+        // A pooled buffer avoids both the allocation and the copy realloc may do
+        if (auto pooled = takePooledBuffer(capacity))
         {
+            if (_data != nullptr)
+            {
+                std::memcpy(pooled->data, _data, _length);
+                releaseBuffer(_data, _capacity);
+            }
+            _data = pooled->data;
+            _capacity = pooled->capacity;
             return;
         }
 
-        auto* newData = static_cast<std::byte*>(std::realloc(_data, len));
+        auto* newData = static_cast<std::byte*>(std::realloc(_data, capacity));
         if (newData == nullptr)
         {
             throw Exception::BadAllocation();
         }
 
         _data = newData;
-        _capacity = len;
+        _capacity = capacity;
+    }
+
+    void MemoryStream::reserve(size_t len)
+    {
+        if (len == 0 || len <= _capacity)
+        {
+            return;
+        }
+
+        grow(len);
     }
 
     void MemoryStream::resize(size_t len)
@@ -101,6 +196,18 @@ namespace OpenLoco
         _offset += maxReadLength;
     }
 
+    std::span<const std::byte> MemoryStream::readView(size_t len)
+    {
+        if (len > _length - _offset)
+        {
+            throw Exception::RuntimeError("Failed to read data");
+        }
+
+        const auto view = std::span<const std::byte>(_data + _offset, len);
+        _offset += len;
+        return view;
+    }
+
     // TODO: Move this somewhere more sensible.
     template<typename T>
     static constexpr T alignTo(T val, T align) noexcept
@@ -125,14 +232,7 @@ namespace OpenLoco
             const auto newCapacity = _capacity + len;
             const auto finalCapacity = alignTo(static_cast<std::size_t>(newCapacity * kGrowthFactor), kPageSize);
 
-            auto* newData = static_cast<std::byte*>(std::realloc(_data, finalCapacity));
-            if (newData == nullptr)
-            {
-                throw Exception::BadAllocation();
-            }
-
-            _data = newData;
-            _capacity = finalCapacity;
+            grow(finalCapacity);
         }
 
         // Copy the data into the buffer.
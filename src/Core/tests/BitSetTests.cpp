@@ -0,0 +1,107 @@
+#include <OpenLoco/Core/BitSet.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+
+template<size_t TSize>
+static std::vector<size_t> findAll(const BitSet<TSize>& bits)
+{
+    std::vector<size_t> indices;
+    for (auto i = bits.findFirst(); i < bits.size(); i = bits.findNext(i + 1))
+    {
+        indices.push_back(i);
+    }
+    return indices;
+}
+
+template<size_t TSize>
+static std::vector<size_t> forEachAll(const BitSet<TSize>& bits)
+{
+    std::vector<size_t> indices;
+    bits.forEachSet([&indices](size_t i) { indices.push_back(i); });
+    return indices;
+}
+
+TEST(BitSetTest, FindOnEmpty)
+{
+    BitSet<224> bits;
+    EXPECT_TRUE(bits.none());
+    EXPECT_FALSE(bits.any());
+    EXPECT_EQ(bits.findFirst(), 224U);
+    EXPECT_EQ(bits.findNext(100), 224U);
+    EXPECT_EQ(bits.findNext(500), 224U);
+    EXPECT_TRUE(forEachAll(bits).empty());
+}
+
+TEST(BitSetTest, FindAcrossBlocks)
+{
+    const auto expected = std::vector<size_t>{ 0, 31, 32, 33, 95, 160, 223 };
+    BitSet<224> bits;
+    for (auto i : expected)
+    {
+        bits.set(i, true);
+    }
+
+    EXPECT_TRUE(bits.any());
+    EXPECT_EQ(bits.count(), expected.size());
+    EXPECT_EQ(findAll(bits), expected);
+    EXPECT_EQ(forEachAll(bits), expected);
+
+    EXPECT_EQ(bits.findNext(34), 95U);
+    EXPECT_EQ(bits.findNext(95), 95U);
+    EXPECT_EQ(bits.findNext(161), 223U);
+}
+
+TEST(BitSetTest, FindInSmallSet)
+{
+    BitSet<5> bits;
+    bits.set(3, true);
+    EXPECT_EQ(bits.findFirst(), 3U);
+    EXPECT_EQ(bits.findNext(4), 5U);
+
+    // Flipping must not leave bits set past the end
+    bits.flip();
+    EXPECT_EQ(forEachAll(bits), (std::vector<size_t>{ 0, 1, 2, 4 }));
+}
+
+TEST(BitSetTest, FindMatchesGet)
+{
+    BitSet<1000> bits;
+    for (size_t i = 0; i < bits.size(); i += 7)
+    {
+        bits.set(i, true);
+    }
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < bits.size(); i++)
+    {
+        if (bits.get(i))
+        {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(findAll(bits), expected);
+    EXPECT_EQ(forEachAll(bits), expected);
+}
+
+TEST(BitSetTest, BlockOperations)
+{
+    BitSet<100> a{ 1, 40, 70, 99 };
+    const BitSet<100> b{ 40, 41, 99 };
+
+    EXPECT_EQ(findAll(a & b), (std::vector<size_t>{ 40, 99 }));
+    EXPECT_EQ(findAll(a | b), (std::vector<size_t>{ 1, 40, 41, 70, 99 }));
+    EXPECT_EQ(findAll(a ^ b), (std::vector<size_t>{ 1, 41, 70 }));
+
+    auto c = a;
+    c.andNot(b);
+    EXPECT_EQ(findAll(c), (std::vector<size_t>{ 1, 70 }));
+
+    a &= b;
+    EXPECT_EQ(findAll(a), (std::vector<size_t>{ 40, 99 }));
+    a |= BitSet<100>{ 2 };
+    EXPECT_EQ(findAll(a), (std::vector<size_t>{ 2, 40, 99 }));
+    a ^= BitSet<100>{ 2, 3 };
+    EXPECT_EQ(findAll(a), (std::vector<size_t>{ 3, 40, 99 }));
+}
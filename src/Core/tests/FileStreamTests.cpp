@@ -204,3 +204,117 @@ TEST(FileStreamTest, testRead100MiB)
     streamIn.close();
     std::filesystem::remove(filePath);
 }
+
+TEST(FileStreamTest, testUnbufferedWriteRead)
+{
+    const auto testDataSize = 4;
+    const auto testData = generateData(testDataSize);
+    const auto filePath = getTempFilePath();
+
+    {
+        FileStream streamOut(filePath, StreamMode::write, 0);
+        streamOut.write(testData.data(), testData.size());
+    }
+
+    FileStream streamIn(filePath, StreamMode::read, 0);
+    ASSERT_EQ(streamIn.getLength(), testData.size());
+
+    auto readBuffer = DataBuffer(testDataSize);
+    streamIn.read(readBuffer.data(), readBuffer.size());
+
+    ASSERT_EQ(readBuffer, testData);
+
+    streamIn.close();
+    std::filesystem::remove(filePath);
+}
+
+TEST(FileStreamTest, testMappedRead)
+{
+    const auto testDataSize = 4096 + 3;
+    const auto testData = generateData(testDataSize);
+    const auto filePath = getTempFilePath();
+
+    generateFile(filePath, testData);
+
+    FileStream streamIn(filePath, StreamMode::readMapped);
+    ASSERT_TRUE(streamIn.isOpen());
+    ASSERT_EQ(streamIn.getMode(), StreamMode::readMapped);
+    ASSERT_EQ(streamIn.getLength(), testData.size());
+    ASSERT_EQ(streamIn.getPosition(), 0);
+
+    auto readBuffer = DataBuffer(testDataSize);
+    streamIn.read(readBuffer.data(), readBuffer.size());
+    ASSERT_EQ(readBuffer, testData);
+    ASSERT_EQ(streamIn.getPosition(), testData.size());
+
+    streamIn.setPosition(1);
+    std::array<uint8_t, 4> smallBuffer{};
+    streamIn.read(smallBuffer.data(), smallBuffer.size());
+    ASSERT_EQ(smallBuffer, (std::array<uint8_t, 4>{ 1, 2, 3, 4 }));
+
+    streamIn.close();
+    ASSERT_FALSE(streamIn.isOpen());
+    std::filesystem::remove(filePath);
+}
+
+TEST(FileStreamTest, testMappedReadView)
+{
+    const auto testDataSize = 16;
+    const auto testData = generateData(testDataSize);
+    const auto filePath = getTempFilePath();
+
+    generateFile(filePath, testData);
+
+    FileStream streamIn(filePath, StreamMode::readMapped);
+    streamIn.setPosition(4);
+
+    const auto view = streamIn.readView(8);
+    ASSERT_EQ(view.size(), 8);
+    ASSERT_EQ(streamIn.getPosition(), 12);
+    for (size_t i = 0; i < view.size(); i++)
+    {
+        ASSERT_EQ(static_cast<uint8_t>(view[i]), testData[4 + i]);
+    }
+
+    EXPECT_THROW(streamIn.readView(5), Exception::RuntimeError);
+    ASSERT_EQ(streamIn.getPosition(), 12);
+    EXPECT_THROW(streamIn.write(testData.data(), testData.size()), Exception::InvalidOperation);
+
+    streamIn.close();
+    std::filesystem::remove(filePath);
+}
+
+TEST(FileStreamTest, testMappedEmptyFile)
+{
+    const auto filePath = getTempFilePath();
+
+    generateFile(filePath, {});
+
+    FileStream streamIn(filePath, StreamMode::readMapped);
+    ASSERT_TRUE(streamIn.isOpen());
+    ASSERT_EQ(streamIn.getLength(), 0);
+    ASSERT_TRUE(streamIn.readView(0).empty());
+
+    std::array<uint8_t, 1> readBuffer{};
+    EXPECT_THROW(streamIn.read(readBuffer.data(), readBuffer.size()), Exception::RuntimeError);
+
+    streamIn.close();
+    std::filesystem::remove(filePath);
+}
+
+TEST(FileStreamTest, testReadViewUnmapped)
+{
+    const auto testDataSize = 4;
+    const auto testData = generateData(testDataSize);
+    const auto filePath = getTempFilePath();
+
+    generateFile(filePath, testData);
+
+    // Only mapped files can hand out views, the position must not move
+    FileStream streamIn(filePath, StreamMode::read);
+    ASSERT_TRUE(streamIn.readView(testDataSize).empty());
+    ASSERT_EQ(streamIn.getPosition(), 0);
+
+    streamIn.close();
+    std::filesystem::remove(filePath);
+}
@@ -0,0 +1,72 @@
+#include <OpenLoco/Core/LocoFixedVector.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+
+namespace
+{
+    struct Slot
+    {
+        int value = -1;
+
+        bool empty() const
+        {
+            return value == -1;
+        }
+    };
+}
+
+static std::vector<int> collect(const FixedVector<Slot, 100>& slots)
+{
+    std::vector<int> values;
+    for (auto& slot : slots)
+    {
+        values.push_back(slot.value);
+    }
+    return values;
+}
+
+TEST(FixedVectorTest, SkipsEmptySlots)
+{
+    Slot slots[100];
+    slots[0].value = 0;
+    slots[33].value = 33;
+    slots[99].value = 99;
+
+    auto view = FixedVector(slots);
+    EXPECT_EQ(collect(view), (std::vector<int>{ 0, 33, 99 }));
+    EXPECT_EQ(view.size(), 3U);
+}
+
+TEST(FixedVectorTest, OccupancyMatchesScan)
+{
+    Slot slots[100];
+    FixedVector<Slot, 100>::Occupancy occupancy;
+    for (int i : { 1, 31, 32, 64, 98, 99 })
+    {
+        slots[i].value = i;
+        occupancy.set(i, true);
+    }
+
+    EXPECT_EQ(collect(FixedVector(slots, occupancy)), collect(FixedVector(slots)));
+}
+
+TEST(FixedVectorTest, OccupancyWithEmptiedSlots)
+{
+    Slot slots[100];
+    FixedVector<Slot, 100>::Occupancy occupancy;
+    for (int i : { 5, 40, 70 })
+    {
+        slots[i].value = i;
+        occupancy.set(i, true);
+    }
+
+    // A slot that was emptied without clearing its bit is still skipped
+    slots[40].value = -1;
+    auto view = FixedVector(slots, occupancy);
+    EXPECT_EQ(collect(view), (std::vector<int>{ 5, 70 }));
+
+    occupancy.reset();
+    EXPECT_TRUE(view.empty());
+}
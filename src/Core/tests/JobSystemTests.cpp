@@ -0,0 +1,178 @@
+#include <OpenLoco/Core/JobSystem.h>
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace OpenLoco;
+
+TEST(JobSystemTest, ScheduleAndWait)
+{
+    Core::JobSystem jobs(4);
+    EXPECT_EQ(jobs.getNumThreads(), 4U);
+
+    std::atomic<int> numRun = 0;
+    std::vector<Core::JobHandle> handles;
+    for (int i = 0; i < 100; i++)
+    {
+        handles.push_back(jobs.schedule("test", [&numRun]() { numRun++; }));
+    }
+    for (const auto& handle : handles)
+    {
+        jobs.wait(handle);
+    }
+    EXPECT_EQ(numRun, 100);
+}
+
+TEST(JobSystemTest, SingleThreadRunsOnWait)
+{
+    Core::JobSystem jobs(1);
+    EXPECT_EQ(jobs.getNumThreads(), 1U);
+
+    bool hasRun = false;
+    auto handle = jobs.schedule("test", [&hasRun]() { hasRun = true; });
+    jobs.wait(handle);
+    EXPECT_TRUE(hasRun);
+}
+
+TEST(JobSystemTest, Dependencies)
+{
+    Core::JobSystem jobs(4);
+
+    std::vector<int> order;
+    std::mutex orderMutex;
+    auto record = [&](int value) {
+        std::lock_guard lock(orderMutex);
+        order.push_back(value);
+    };
+
+    auto first = jobs.schedule("first", [&]() { record(1); });
+    auto second = jobs.schedule("second", [&]() { record(2); });
+    const Core::JobHandle firstAndSecond[] = { first, second };
+    auto third = jobs.schedule("third", [&]() { record(3); }, firstAndSecond);
+    const Core::JobHandle thirdOnly[] = { third };
+    auto fourth = jobs.schedule("fourth", [&]() { record(4); }, thirdOnly);
+    jobs.wait(fourth);
+
+    ASSERT_EQ(order.size(), 4U);
+    EXPECT_EQ(order[2], 3);
+    EXPECT_EQ(order[3], 4);
+
+    // Depending on a job that has already finished queues the job straight away
+    auto fifth = jobs.schedule("fifth", [&]() { record(5); }, thirdOnly);
+    jobs.wait(fifth);
+    EXPECT_EQ(order.back(), 5);
+}
+
+TEST(JobSystemTest, WaitRethrows)
+{
+    Core::JobSystem jobs(2);
+    auto handle = jobs.schedule("throws", []() { throw std::runtime_error("job failed"); });
+    EXPECT_THROW(jobs.wait(handle), std::runtime_error);
+}
+
+TEST(JobSystemTest, NestedWait)
+{
+    Core::JobSystem jobs(2);
+
+    std::atomic<int> numRun = 0;
+    auto outer = jobs.schedule("outer", [&]() {
+        std::vector<Core::JobHandle> inner;
+        for (int i = 0; i < 10; i++)
+        {
+            inner.push_back(jobs.schedule("inner", [&numRun]() { numRun++; }));
+        }
+        for (const auto& handle : inner)
+        {
+            jobs.wait(handle);
+        }
+    });
+    jobs.wait(outer);
+    EXPECT_EQ(numRun, 10);
+}
+
+TEST(JobSystemTest, ParallelForCoversRange)
+{
+    Core::JobSystem jobs(4);
+
+    std::vector<int> visits(1000);
+    jobs.parallelFor("test", visits.size(), 7, [&visits](size_t begin, size_t end) {
+        for (auto i = begin; i < end; i++)
+        {
+            visits[i]++;
+        }
+    });
+    EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), 1000);
+
+    // Nothing to do
+    jobs.parallelFor("test", 0, 7, [](size_t, size_t) { FAIL(); });
+}
+
+TEST(JobSystemTest, ParallelForChunksIndependentOfThreads)
+{
+    auto getChunks = [](uint32_t numThreads) {
+        Core::JobSystem jobs(numThreads);
+        std::vector<std::pair<size_t, size_t>> chunks(10);
+        jobs.parallelFor("test", 95, 10, [&chunks](size_t begin, size_t end) {
+            chunks[begin / 10] = { begin, end };
+        });
+        return chunks;
+    };
+
+    const auto chunks = getChunks(1);
+    EXPECT_EQ(chunks, getChunks(3));
+    EXPECT_EQ(chunks, getChunks(8));
+    const std::pair<size_t, size_t> lastChunk{ 90, 95 };
+    EXPECT_EQ(chunks.back(), lastChunk);
+}
+
+TEST(JobSystemTest, ParallelForRethrowsLowestChunk)
+{
+    Core::JobSystem jobs(4);
+
+    std::atomic<int> numRun = 0;
+    try
+    {
+        jobs.parallelFor("test", 100, 1, [&numRun](size_t begin, size_t) {
+            numRun++;
+            if (begin == 30 || begin == 60)
+            {
+                throw std::runtime_error(std::to_string(begin));
+            }
+        });
+        FAIL();
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_STREQ(e.what(), "30");
+    }
+    // The other chunks still run
+    EXPECT_EQ(numRun, 100);
+}
+
+TEST(JobSystemTest, TraceHooks)
+{
+    static std::atomic<int> numWorkersStarted;
+    static std::atomic<int> numJobsTraced;
+    numWorkersStarted = 0;
+    numJobsTraced = 0;
+
+    Core::JobTraceHooks hooks;
+    hooks.workerStarted = [](uint32_t) { numWorkersStarted++; };
+    hooks.isCapturing = []() { return true; };
+    hooks.jobFinished = [](std::string_view name, std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point) {
+        EXPECT_EQ(name, "traced");
+        numJobsTraced++;
+    };
+
+    {
+        Core::JobSystem jobs(3, hooks);
+        jobs.wait(jobs.schedule("traced", []() {}));
+    }
+    EXPECT_EQ(numWorkersStarted, 2);
+    EXPECT_EQ(numJobsTraced, 1);
+}
@@ -119,3 +119,46 @@ TEST(MemoryStreamTest, testResize)
         data[i] = std::byte{ 0xCC };
     }
 }
+
+TEST(MemoryStreamTest, testReadView)
+{
+    MemoryStream ms;
+
+    const std::array<uint8_t, 4> writeBuffer{ 0x01, 0x02, 0x03, 0x04 };
+    ms.write(writeBuffer.data(), writeBuffer.size());
+    ms.setPosition(1);
+
+    const auto view = ms.readView(2);
+    ASSERT_EQ(view.size(), 2);
+    ASSERT_EQ(view.data(), ms.data() + 1);
+    ASSERT_EQ(ms.getPosition(), 3);
+
+    EXPECT_THROW(ms.readView(2), Exception::RuntimeError);
+    ASSERT_EQ(ms.getPosition(), 3);
+}
+
+TEST(MemoryStreamTest, testPooledBufferIsReused)
+{
+    MemoryStream::releasePooledBuffers();
+
+    const std::byte* firstData;
+    {
+        MemoryStream ms(256 * 1024);
+        firstData = ms.data();
+    }
+
+    // A stream growing past a small size takes the released buffer
+    MemoryStream ms;
+    const std::array<uint8_t, 4> writeBuffer{ 0x01, 0x02, 0x03, 0x04 };
+    ms.write(writeBuffer.data(), writeBuffer.size());
+    ms.reserve(128 * 1024);
+    ASSERT_EQ(ms.data(), firstData);
+
+    // The written data is kept when moving to the pooled buffer
+    ms.setPosition(0);
+    std::array<uint8_t, 4> readBuffer{};
+    ms.read(readBuffer.data(), readBuffer.size());
+    ASSERT_EQ(readBuffer, writeBuffer);
+
+    MemoryStream::releasePooledBuffers();
+}
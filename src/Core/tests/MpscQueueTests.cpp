@@ -0,0 +1,107 @@
+#include <OpenLoco/Core/MpscQueue.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco;
+
+TEST(MpscQueueTest, PushAndPop)
+{
+    Core::MpscQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.empty());
+
+    EXPECT_EQ(queue.tryPop(), 1);
+    EXPECT_EQ(queue.tryPop(), 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, Full)
+{
+    Core::MpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(4));
+
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_TRUE(queue.tryPush(4));
+
+    // Wraps around the end of the storage
+    for (int i = 1; i <= 4; i++)
+    {
+        EXPECT_EQ(queue.tryPop(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, EmplaceKeepsSlotStorage)
+{
+    Core::MpscQueue<std::string, 2> queue;
+    EXPECT_TRUE(queue.tryEmplace([](std::string& item) { item.assign(100, 'a'); }));
+
+    std::string consumed;
+    EXPECT_TRUE(queue.tryConsume([&consumed](std::string& item) { consumed = item; }));
+    EXPECT_EQ(consumed, std::string(100, 'a'));
+    EXPECT_FALSE(queue.tryConsume([](std::string&) {}));
+}
+
+TEST(MpscQueueTest, ProducerThreads)
+{
+    constexpr int kNumProducers = 4;
+    constexpr int kCountPerProducer = 2500;
+    Core::MpscQueue<int, 64> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kNumProducers; p++)
+    {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < kCountPerProducer;)
+            {
+                if (queue.tryPush(p * kCountPerProducer + i))
+                {
+                    i++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Items of each producer arrive in the order they were pushed
+    std::vector<int> lastReceived(kNumProducers, -1);
+    int numReceived = 0;
+    int numOutOfOrder = 0;
+    while (numReceived < kNumProducers * kCountPerProducer)
+    {
+        if (auto value = queue.tryPop())
+        {
+            const auto producer = *value / kCountPerProducer;
+            const auto index = *value % kCountPerProducer;
+            if (index <= lastReceived[producer])
+            {
+                numOutOfOrder++;
+            }
+            lastReceived[producer] = index;
+            numReceived++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(numOutOfOrder, 0);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,84 @@
+#include <OpenLoco/Core/SpscQueue.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace OpenLoco;
+
+TEST(SpscQueueTest, PushAndPop)
+{
+    Core::SpscQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.empty());
+
+    EXPECT_EQ(queue.tryPop(), 1);
+    EXPECT_EQ(queue.tryPop(), 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, Full)
+{
+    Core::SpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_FALSE(queue.full());
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_TRUE(queue.full());
+    EXPECT_FALSE(queue.tryPush(4));
+
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_FALSE(queue.full());
+    EXPECT_TRUE(queue.tryPush(4));
+
+    // Wraps around the end of the storage
+    for (int i = 1; i <= 4; i++)
+    {
+        EXPECT_EQ(queue.tryPop(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueueTest, ProducerAndConsumerThreads)
+{
+    constexpr int kCount = 10000;
+    Core::SpscQueue<int, 64> queue;
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < kCount;)
+        {
+            if (queue.tryPush(i))
+            {
+                i++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int numReceived = 0;
+    int numOutOfOrder = 0;
+    while (numReceived < kCount)
+    {
+        if (auto value = queue.tryPop())
+        {
+            if (*value != numReceived)
+            {
+                numOutOfOrder++;
+            }
+            numReceived++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_EQ(numOutOfOrder, 0);
+    EXPECT_TRUE(queue.empty());
+}
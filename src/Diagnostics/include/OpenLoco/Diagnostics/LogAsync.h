@@ -0,0 +1,61 @@
+#pragma once
+
+#include <OpenLoco/Core/MpscQueue.hpp>
+#include <OpenLoco/Diagnostics/LogSink.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // Hands the messages to a writer thread that prints them to the target sink in batches, so the
+    // threads logging only copy the message. Messages are dropped when the queue is full, the number
+    // dropped is reported with the next batch.
+    class LogAsync final : public LogSink
+    {
+        static constexpr size_t kQueueSize = 4096;
+
+        struct Entry
+        {
+            Level level{};
+            int intendSize{};
+            std::string message;
+        };
+
+        std::shared_ptr<LogSink> _target;
+        Core::MpscQueue<Entry, kQueueSize> _queue;
+        std::atomic<uint64_t> _numDropped{};
+        uint64_t _numDroppedReported{};
+
+        std::thread _writer;
+        std::atomic<bool> _stopRequested{};
+        std::mutex _wakeMutex;
+        std::condition_variable _wakeWriter;
+        std::condition_variable _batchWritten;
+        // Guarded by _wakeMutex
+        bool _wakeRequested{};
+        uint64_t _numBatchesStarted{};
+        uint64_t _numBatchesWritten{};
+
+        void write();
+        void writeBatch();
+        void wakeWriter();
+
+    public:
+        explicit LogAsync(std::shared_ptr<LogSink> target);
+        // Prints the messages still queued before returning.
+        ~LogAsync() override;
+
+        LogAsync(const LogAsync&) = delete;
+        LogAsync& operator=(const LogAsync&) = delete;
+
+        void print(Level level, std::string_view message) override;
+        // Waits for the queued messages to be printed, can be called from any thread.
+        void flush() override;
+
+        uint64_t getNumDropped() const noexcept;
+    };
+}
@@ -9,10 +9,16 @@ namespace OpenLoco::Diagnostics::Logging
     class LogFile final : public LogSink
     {
         std::fstream _file;
+        bool _flushEachMessage = true;
 
     public:
         LogFile(const fs::path& file);
 
         void print(Level level, std::string_view message) override;
+        void flush() override;
+
+        // Flushing after each message keeps the log complete on a crash, sinks that batch messages
+        // turn it off and flush once per batch.
+        void setFlushEachMessage(bool value);
     };
 }
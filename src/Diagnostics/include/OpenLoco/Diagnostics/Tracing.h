@@ -0,0 +1,65 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Core/JobSystem.h>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace OpenLoco::Diagnostics::Tracing
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Events are kept in a buffer per thread while capturing, names and categories are not copied
+    // so they have to outlive the capture, string literals are the intended use.
+    void start();
+    void stop();
+    bool isCapturing();
+
+    // Names the calling thread in the trace, worker threads show up by id otherwise.
+    void setThreadName(std::string_view name);
+
+    void recordEvent(std::string_view name, std::string_view category, Clock::time_point begin, Clock::time_point end);
+
+    // Names the job workers and records each job as an event while capturing.
+    Core::JobTraceHooks getJobTraceHooks();
+
+    // Number of events discarded because a thread buffer was full.
+    uint64_t getNumDropped();
+
+    // Writes the events captured so far in the Chrome trace event format, it can be opened in
+    // chrome://tracing or ui.perfetto.dev.
+    bool writeChromeTrace(const fs::path& path);
+
+    // Records the time between construction and destruction as a single event.
+    class ScopedEvent
+    {
+        std::string_view _name;
+        std::string_view _category;
+        Clock::time_point _begin;
+        bool _capturing;
+
+    public:
+        ScopedEvent(std::string_view name, std::string_view category)
+            : _name{ name }
+            , _category{ category }
+            , _capturing{ isCapturing() }
+        {
+            if (_capturing)
+            {
+                _begin = Clock::now();
+            }
+        }
+
+        ~ScopedEvent()
+        {
+            if (_capturing)
+            {
+                recordEvent(_name, _category, _begin, Clock::now());
+            }
+        }
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+    };
+}
@@ -0,0 +1,123 @@
+#include "OpenLoco/Diagnostics/LogAsync.h"
+#include <chrono>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // How long the writer waits for more messages before printing them, errors are printed right away
+    static constexpr auto kBatchInterval = std::chrono::milliseconds(20);
+
+    LogAsync::LogAsync(std::shared_ptr<LogSink> target)
+        : _target(std::move(target))
+    {
+        _writer = std::thread([this]() { write(); });
+    }
+
+    LogAsync::~LogAsync()
+    {
+        _stopRequested = true;
+        wakeWriter();
+        _writer.join();
+    }
+
+    void LogAsync::print(Level level, std::string_view message)
+    {
+        if (!passesLevelFilter(level))
+        {
+            return;
+        }
+
+        const auto intendSize = getIntendSize();
+        const auto pushed = _queue.tryEmplace([&](Entry& entry) {
+            entry.level = level;
+            entry.intendSize = intendSize;
+            // Reuses the storage the slot already has
+            entry.message.assign(message);
+        });
+        if (!pushed)
+        {
+            _numDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (level == Level::error)
+        {
+            wakeWriter();
+        }
+    }
+
+    void LogAsync::flush()
+    {
+        std::unique_lock lock(_wakeMutex);
+        // The next batch started takes everything queued so far
+        const auto batch = _numBatchesStarted + 1;
+        _wakeRequested = true;
+        _wakeWriter.notify_one();
+        _batchWritten.wait(lock, [this, batch]() { return _numBatchesWritten >= batch; });
+    }
+
+    uint64_t LogAsync::getNumDropped() const noexcept
+    {
+        return _numDropped.load(std::memory_order_relaxed);
+    }
+
+    void LogAsync::writeBatch()
+    {
+        bool hasPrinted = false;
+        while (_queue.tryConsume([this](Entry& entry) {
+            _target->setIntendSize(entry.intendSize);
+            _target->print(entry.level, entry.message);
+        }))
+        {
+            hasPrinted = true;
+        }
+
+        const auto numDropped = getNumDropped();
+        if (numDropped != _numDroppedReported)
+        {
+            _target->setIntendSize(0);
+            _target->print(Level::warning, fmt::format("{} log messages were dropped", numDropped - _numDroppedReported));
+            _numDroppedReported = numDropped;
+            hasPrinted = true;
+        }
+
+        if (hasPrinted)
+        {
+            _target->flush();
+        }
+    }
+
+    void LogAsync::wakeWriter()
+    {
+        {
+            // Taking the lock makes sure the writer is either waiting or yet to check the flag
+            std::lock_guard lock(_wakeMutex);
+            _wakeRequested = true;
+        }
+        _wakeWriter.notify_one();
+    }
+
+    // Runs on the writer thread, the only consumer of the queue.
+    void LogAsync::write()
+    {
+        bool stopping = false;
+        while (!stopping)
+        {
+            uint64_t batch;
+            {
+                std::unique_lock lock(_wakeMutex);
+                _wakeWriter.wait_for(lock, kBatchInterval, [this]() { return _wakeRequested; });
+                _wakeRequested = false;
+                stopping = _stopRequested;
+                batch = ++_numBatchesStarted;
+            }
+
+            writeBatch();
+
+            {
+                std::lock_guard lock(_wakeMutex);
+                _numBatchesWritten = batch;
+            }
+            _batchWritten.notify_all();
+        }
+    }
+}
@@ -41,6 +41,22 @@ namespace OpenLoco::Diagnostics::Logging
         fmt::print(_file, "{}{}{:<{}}\n", timestamp, getLevelPrefix(level), message, intendSize);
 
         // Ensure we are not loosing anything because of buffering in case of a crash.
-        _file.flush();
+        if (_flushEachMessage)
+        {
+            _file.flush();
+        }
+    }
+
+    void LogFile::flush()
+    {
+        if (_file.is_open())
+        {
+            _file.flush();
+        }
+    }
+
+    void LogFile::setFlushEachMessage(bool value)
+    {
+        _flushEachMessage = value;
     }
 }
@@ -0,0 +1,202 @@
+#include "OpenLoco/Diagnostics/Tracing.h"
+#include <atomic>
+#include <fmt/format.h>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OpenLoco::Diagnostics::Tracing
+{
+    // Bounds the memory a long capture can take, about 12 MiB per thread.
+    static constexpr size_t kMaxEventsPerThread = 1U << 18;
+
+    struct Event
+    {
+        std::string_view name;
+        std::string_view category;
+        Clock::time_point begin;
+        Clock::time_point end;
+    };
+
+    struct ThreadBuffer
+    {
+        // Only contended while a trace is written
+        std::mutex mutex;
+        std::vector<Event> events;
+        std::string name;
+        uint32_t id{};
+    };
+
+    static std::atomic<bool> _capturing{};
+    static std::atomic<uint64_t> _numDropped{};
+
+    static std::mutex _buffersMutex;
+    static std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+    static Clock::time_point _captureStart;
+
+    static ThreadBuffer& getThreadBuffer()
+    {
+        // The list keeps the buffer alive so the events of finished threads are still written out
+        static thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+            auto newBuffer = std::make_shared<ThreadBuffer>();
+            std::lock_guard lock(_buffersMutex);
+            newBuffer->id = static_cast<uint32_t>(_buffers.size() + 1);
+            _buffers.push_back(newBuffer);
+            return newBuffer;
+        }();
+        return *buffer;
+    }
+
+    void start()
+    {
+        std::lock_guard lock(_buffersMutex);
+        for (auto& buffer : _buffers)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            buffer->events.clear();
+        }
+        _numDropped = 0;
+        _captureStart = Clock::now();
+        _capturing = true;
+    }
+
+    void stop()
+    {
+        _capturing = false;
+    }
+
+    bool isCapturing()
+    {
+        return _capturing.load(std::memory_order_relaxed);
+    }
+
+    void setThreadName(std::string_view name)
+    {
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.mutex);
+        buffer.name = name;
+    }
+
+    void recordEvent(std::string_view name, std::string_view category, Clock::time_point begin, Clock::time_point end)
+    {
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.mutex);
+        if (buffer.events.size() >= kMaxEventsPerThread)
+        {
+            _numDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer.events.push_back(Event{ name, category, begin, end });
+    }
+
+    Core::JobTraceHooks getJobTraceHooks()
+    {
+        Core::JobTraceHooks hooks;
+        hooks.workerStarted = [](uint32_t workerIndex) {
+            setThreadName(fmt::format("Job worker {}", workerIndex + 1));
+        };
+        hooks.isCapturing = isCapturing;
+        hooks.jobFinished = [](std::string_view name, Clock::time_point begin, Clock::time_point end) {
+            recordEvent(name, "job", begin, end);
+        };
+        return hooks;
+    }
+
+    uint64_t getNumDropped()
+    {
+        return _numDropped.load(std::memory_order_relaxed);
+    }
+
+    static void appendEscaped(fmt::memory_buffer& out, std::string_view str)
+    {
+        for (const auto c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    out.append(std::string_view("\\\""));
+                    break;
+                case '\\':
+                    out.append(std::string_view("\\\\"));
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+                    }
+                    else
+                    {
+                        out.push_back(c);
+                    }
+                    break;
+            }
+        }
+    }
+
+    // Chrome trace timestamps are in microseconds.
+    static double toMicroseconds(Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    bool writeChromeTrace(const fs::path& path)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        fmt::memory_buffer out;
+        bool first = true;
+        const auto beginEvent = [&]() {
+            out.append(std::string_view(first ? "\n" : ",\n"));
+            first = false;
+        };
+        const auto flushToFile = [&]() {
+            file.write(out.data(), static_cast<std::streamsize>(out.size()));
+            out.clear();
+        };
+
+        out.append(std::string_view("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+
+        std::lock_guard lock(_buffersMutex);
+        for (auto& buffer : _buffers)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            if (!buffer->name.empty())
+            {
+                beginEvent();
+                fmt::format_to(std::back_inserter(out), "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"", buffer->id);
+                appendEscaped(out, buffer->name);
+                out.append(std::string_view("\"}}"));
+            }
+
+            for (const auto& event : buffer->events)
+            {
+                beginEvent();
+                out.append(std::string_view("{\"name\":\""));
+                appendEscaped(out, event.name);
+                out.append(std::string_view("\",\"cat\":\""));
+                appendEscaped(out, event.category);
+                fmt::format_to(
+                    std::back_inserter(out),
+                    "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                    buffer->id,
+                    toMicroseconds(event.begin - _captureStart),
+                    toMicroseconds(event.end - event.begin));
+
+                if (out.size() >= 1024 * 1024)
+                {
+                    flushToFile();
+                }
+            }
+        }
+
+        out.append(std::string_view("\n]}\n"));
+        flushToFile();
+        return file.good();
+    }
+}
@@ -1,3 +1,4 @@
+#include <OpenLoco/Diagnostics/LogAsync.h>
 #include <OpenLoco/Diagnostics/LogSink.h>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <gtest/gtest.h>
@@ -179,3 +180,23 @@ TEST(LoggingTests, LevelFilterTestVerbose)
 
     Logging::removeSink(testSink);
 }
+
+TEST(LoggingTests, AsyncSinkTest)
+{
+    auto testSink = std::make_shared<TestLogLevelSink>();
+    auto asyncSink = std::make_shared<Logging::LogAsync>(testSink);
+    Logging::installSink(asyncSink);
+
+    Logging::info("TestInfo");
+    asyncSink->flush();
+    ASSERT_EQ(testSink->getLastMessage(), "TestInfo");
+    ASSERT_EQ(testSink->getLastLevel(), Logging::Level::info);
+
+    Logging::error("TestError");
+    asyncSink->flush();
+    ASSERT_EQ(testSink->getLastMessage(), "TestError");
+    ASSERT_EQ(testSink->getLastLevel(), Logging::Level::error);
+    ASSERT_EQ(asyncSink->getNumDropped(), 0U);
+
+    Logging::removeSink(asyncSink);
+}
@@ -0,0 +1,55 @@
+#include <OpenLoco/Diagnostics/Tracing.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Diagnostics;
+
+static std::string readFile(const fs::path& path)
+{
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+TEST(TracingTests, NotCapturing)
+{
+    Tracing::stop();
+    {
+        Tracing::ScopedEvent event("NotCaptured", "test");
+    }
+
+    const auto path = fs::temp_directory_path() / "openloco_tracing_test.json";
+    ASSERT_TRUE(Tracing::writeChromeTrace(path));
+    EXPECT_EQ(readFile(path).find("NotCaptured"), std::string::npos);
+    fs::remove(path);
+}
+
+TEST(TracingTests, WriteChromeTrace)
+{
+    Tracing::start();
+    Tracing::setThreadName("Test \"Main\"");
+    {
+        Tracing::ScopedEvent event("Outer", "test");
+        Tracing::ScopedEvent inner("Inner", "test");
+    }
+    std::thread([]() {
+        Tracing::ScopedEvent event("Worker", "test");
+    }).join();
+    Tracing::stop();
+
+    const auto path = fs::temp_directory_path() / "openloco_tracing_test.json";
+    ASSERT_TRUE(Tracing::writeChromeTrace(path));
+    const auto json = readFile(path);
+    fs::remove(path);
+
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0U);
+    EXPECT_NE(json.find("\"name\":\"Outer\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Inner\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Worker\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"Test \\\"Main\\\"\"}"), std::string::npos);
+    EXPECT_EQ(Tracing::getNumDropped(), 0U);
+}
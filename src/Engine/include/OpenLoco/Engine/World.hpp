@@ -3,16 +3,28 @@
 #include "Types.hpp"
 #include <OpenLoco/Math/Vector.hpp>
 #include <algorithm>
+#include <bit>
+
+// The number of tiles along each side of the map, chosen with the OPENLOCO_MAP_SIZE build option.
+#ifndef OPENLOCO_MAP_SIZE
+#define OPENLOCO_MAP_SIZE 384
+#endif
 
 namespace OpenLoco::World
 {
     constexpr coord_t kTileSize = 32;
-    constexpr coord_t kMapRows = 384;
-    constexpr coord_t kMapColumns = 384;
-    constexpr coord_t kMapPitch = 512;
+    // The size of the maps of Locomotion, saves only carry their size when it is different.
+    constexpr coord_t kVanillaMapSize = 384;
+    constexpr coord_t kMapRows = OPENLOCO_MAP_SIZE;
+    constexpr coord_t kMapColumns = OPENLOCO_MAP_SIZE;
+    // Rows of the tile index are a power of two apart so that the index is a shift and an or.
+    constexpr coord_t kMapPitch = std::bit_ceil(static_cast<uint16_t>(kMapColumns));
+    constexpr int32_t kMapPitchShift = std::countr_zero(static_cast<uint16_t>(kMapPitch));
     constexpr coord_t kMapHeight = kMapRows * kTileSize;
     constexpr coord_t kMapWidth = kMapColumns * kTileSize;
     constexpr int32_t kMapSize = kMapColumns * kMapRows;
+    // The scenario previews sample the map in steps of whole tiles and world coordinates are 16 bit.
+    static_assert(kMapColumns % 128 == 0 && kMapColumns >= 128 && kMapColumns <= 896, "OPENLOCO_MAP_SIZE must be a multiple of 128 up to 896");
     constexpr int16_t kMicroZStep = 16;       // e.g. SurfaceElement::water is a microZ
     constexpr int16_t kMicroToSmallZStep = 4; // e.g. for comparisons between water and baseZ
     constexpr int16_t kSmallZStep = 4;        // e.g. TileElement::baseZ is a smallZ
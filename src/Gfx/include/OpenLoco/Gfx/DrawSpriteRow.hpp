@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENLOCO_DRAW_SPRITE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define OPENLOCO_DRAW_SPRITE_NEON
+#include <arm_neon.h>
+#endif
+
+// Row kernels for the unzoomed bitmap cases that do not go through the palette map, these
+// process 16 pixels at a time where the target guarantees SSE2 or NEON and otherwise fall
+// back to the same per pixel loop as blitPixel.
+namespace OpenLoco::Gfx::DrawSpriteRow
+{
+    inline void copyTransparent(const uint8_t* src, uint8_t* dst, size_t numPixels)
+    {
+        size_t i = 0;
+#if defined(OPENLOCO_DRAW_SPRITE_SSE2)
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= numPixels; i += 16)
+        {
+            const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const auto isTransparent = _mm_cmpeq_epi8(s, zero);
+            const auto result = _mm_or_si128(_mm_and_si128(isTransparent, d), s);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+        }
+#elif defined(OPENLOCO_DRAW_SPRITE_NEON)
+        for (; i + 16 <= numPixels; i += 16)
+        {
+            const auto s = vld1q_u8(src + i);
+            const auto d = vld1q_u8(dst + i);
+            const auto isTransparent = vceqq_u8(s, vdupq_n_u8(0));
+            vst1q_u8(dst + i, vbslq_u8(isTransparent, d, s));
+        }
+#endif
+        for (; i < numPixels; i++)
+        {
+            if (src[i] != 0)
+            {
+                dst[i] = src[i];
+            }
+        }
+    }
+
+    // The noise mask is either 0 or 0xFF per pixel, masked out pixels become transparent.
+    inline void copyTransparentMasked(const uint8_t* src, const uint8_t* noiseMask, uint8_t* dst, size_t numPixels)
+    {
+        size_t i = 0;
+#if defined(OPENLOCO_DRAW_SPRITE_SSE2)
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= numPixels; i += 16)
+        {
+            const auto s = _mm_and_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(noiseMask + i)));
+            const auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const auto isTransparent = _mm_cmpeq_epi8(s, zero);
+            const auto result = _mm_or_si128(_mm_and_si128(isTransparent, d), s);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+        }
+#elif defined(OPENLOCO_DRAW_SPRITE_NEON)
+        for (; i + 16 <= numPixels; i += 16)
+        {
+            const auto s = vandq_u8(vld1q_u8(src + i), vld1q_u8(noiseMask + i));
+            const auto d = vld1q_u8(dst + i);
+            const auto isTransparent = vceqq_u8(s, vdupq_n_u8(0));
+            vst1q_u8(dst + i, vbslq_u8(isTransparent, d, s));
+        }
+#endif
+        for (; i < numPixels; i++)
+        {
+            const auto pixel = static_cast<uint8_t>(src[i] & noiseMask[i]);
+            if (pixel != 0)
+            {
+                dst[i] = pixel;
+            }
+        }
+    }
+}
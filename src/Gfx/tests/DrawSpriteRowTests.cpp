@@ -0,0 +1,89 @@
+#include <OpenLoco/Gfx/DrawSpriteRow.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco::Gfx;
+
+// Covers rows shorter than one 16 pixel step, whole steps and steps with a scalar tail, at every
+// alignment of a step.
+static constexpr size_t kMaxRowWidth = 70;
+static constexpr size_t kMaxOffset = 16;
+
+static std::vector<uint8_t> makeRow(std::mt19937& rng, size_t size)
+{
+    // A quarter of the pixels are transparent
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> row(size);
+    for (auto& pixel : row)
+    {
+        const auto value = dist(rng);
+        pixel = value < 64 ? 0 : static_cast<uint8_t>(value);
+    }
+    return row;
+}
+
+static std::vector<uint8_t> makeNoiseMask(std::mt19937& rng, size_t size)
+{
+    std::bernoulli_distribution dist(0.5);
+    std::vector<uint8_t> mask(size);
+    for (auto& value : mask)
+    {
+        value = dist(rng) ? 0xFF : 0x00;
+    }
+    return mask;
+}
+
+TEST(DrawSpriteRowTest, CopyTransparentMatchesScalar)
+{
+    std::mt19937 rng(1234);
+    for (size_t offset = 0; offset < kMaxOffset; offset++)
+    {
+        for (size_t width = 0; width <= kMaxRowWidth; width++)
+        {
+            const auto src = makeRow(rng, offset + width);
+            const auto dst = makeRow(rng, offset + width);
+
+            auto expected = dst;
+            for (size_t i = offset; i < offset + width; i++)
+            {
+                if (src[i] != 0)
+                {
+                    expected[i] = src[i];
+                }
+            }
+
+            auto actual = dst;
+            DrawSpriteRow::copyTransparent(src.data() + offset, actual.data() + offset, width);
+            ASSERT_EQ(actual, expected) << "offset " << offset << " width " << width;
+        }
+    }
+}
+
+TEST(DrawSpriteRowTest, CopyTransparentMaskedMatchesScalar)
+{
+    std::mt19937 rng(5678);
+    for (size_t offset = 0; offset < kMaxOffset; offset++)
+    {
+        for (size_t width = 0; width <= kMaxRowWidth; width++)
+        {
+            const auto src = makeRow(rng, offset + width);
+            const auto noiseMask = makeNoiseMask(rng, offset + width);
+            const auto dst = makeRow(rng, offset + width);
+
+            auto expected = dst;
+            for (size_t i = offset; i < offset + width; i++)
+            {
+                const auto pixel = static_cast<uint8_t>(src[i] & noiseMask[i]);
+                if (pixel != 0)
+                {
+                    expected[i] = pixel;
+                }
+            }
+
+            auto actual = dst;
+            DrawSpriteRow::copyTransparentMasked(src.data() + offset, noiseMask.data() + offset, actual.data() + offset, width);
+            ASSERT_EQ(actual, expected) << "offset " << offset << " width " << width;
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector.hpp"
 #include <cstdint>
+#include <span>
 
 namespace OpenLoco
 {
@@ -117,4 +118,10 @@ namespace OpenLoco::Math::Trigonometry
     constexpr auto kDirectionPrecisionHigh = 0x4000;
     int32_t integerSinePrecisionHigh(uint16_t direction, int32_t magnitude);
     int32_t integerCosinePrecisionHigh(uint16_t direction, int32_t magnitude);
+
+    // Batch versions of the above for updating many entities at once, the loops are branch free so
+    // the compiler can vectorise them. The output is written for each element of the inputs.
+    void integerSinePrecisionHigh(std::span<const uint16_t> directions, std::span<const int32_t> magnitudes, std::span<int32_t> out);
+    void integerCosinePrecisionHigh(std::span<const uint16_t> directions, std::span<const int32_t> magnitudes, std::span<int32_t> out);
+    void computeXYVectors(std::span<const int32_t> magnitudes, std::span<const uint8_t> yaws, std::span<Vector::TVector2<int32_t>> out);
 }
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
+#include <span>
+#include <type_traits>
 
 namespace OpenLoco::Math::Vector
 {
@@ -196,6 +198,32 @@ namespace OpenLoco::Math::Vector
         return res;
     }
 
+    namespace Detail
+    {
+        // Each pair is an x and y component, count is the number of pairs.
+        void rotatePairs(int16_t* pairs, size_t count, int32_t direction) noexcept;
+        void rotatePairs(int32_t* pairs, size_t count, int32_t direction) noexcept;
+    }
+
+    // Rotates all the vectors in place by the same direction as rotate above, 16 and 32 bit
+    // components are processed several vectors at a time where SSE2 or NEON is available.
+    template<typename T, typename TTypeTag>
+    void rotate(std::span<TVector2<T, TTypeTag>> vecs, int32_t direction) noexcept
+    {
+        static_assert(sizeof(TVector2<T, TTypeTag>) == sizeof(T) * 2);
+        if constexpr (std::is_same_v<T, int16_t> || std::is_same_v<T, int32_t>)
+        {
+            Detail::rotatePairs(reinterpret_cast<T*>(vecs.data()), vecs.size(), direction);
+        }
+        else
+        {
+            for (auto& vec : vecs)
+            {
+                vec = rotate(vec, direction);
+            }
+        }
+    }
+
     // AKA taxicab distance
     template<typename T, typename TTypeTag>
     static constexpr auto manhattanDistance2D(const TVector2<T, TTypeTag>& lhs, const TVector2<T, TTypeTag>& rhs) noexcept
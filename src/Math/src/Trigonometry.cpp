@@ -1,5 +1,6 @@
 #include "Trigonometry.hpp"
 #include <array>
+#include <cassert>
 
 namespace OpenLoco::Math::Trigonometry
 {
@@ -234,4 +235,42 @@ namespace OpenLoco::Math::Trigonometry
         // Cosine is Sine plus pi/2
         return integerSinePrecisionHigh(direction + kDirectionPrecisionHigh / 4, magnitude);
     }
+
+    // Same as integerSinePrecisionHigh with the branches replaced by masks.
+    static int32_t integerSineBranchFree(uint16_t direction, int32_t magnitude)
+    {
+        const auto mirror = static_cast<uint16_t>(0 - ((direction >> 12) & 1));
+        const auto negate = static_cast<int16_t>(0 - ((direction >> 13) & 1));
+        const auto sineIndex = (direction ^ mirror) & 0xFFF;
+        const auto value = static_cast<int16_t>(Data::kQuarterSine[sineIndex] ^ negate);
+        return value * magnitude / 0x8000;
+    }
+
+    void integerSinePrecisionHigh(std::span<const uint16_t> directions, std::span<const int32_t> magnitudes, std::span<int32_t> out)
+    {
+        assert(directions.size() == magnitudes.size() && out.size() >= directions.size());
+        for (size_t i = 0; i < directions.size(); i++)
+        {
+            out[i] = integerSineBranchFree(directions[i], magnitudes[i]);
+        }
+    }
+
+    void integerCosinePrecisionHigh(std::span<const uint16_t> directions, std::span<const int32_t> magnitudes, std::span<int32_t> out)
+    {
+        assert(directions.size() == magnitudes.size() && out.size() >= directions.size());
+        for (size_t i = 0; i < directions.size(); i++)
+        {
+            out[i] = integerSineBranchFree(static_cast<uint16_t>(directions[i] + kDirectionPrecisionHigh / 4), magnitudes[i]);
+        }
+    }
+
+    void computeXYVectors(std::span<const int32_t> magnitudes, std::span<const uint8_t> yaws, std::span<Vector::TVector2<int32_t>> out)
+    {
+        assert(magnitudes.size() == yaws.size() && out.size() >= magnitudes.size());
+        for (size_t i = 0; i < magnitudes.size(); i++)
+        {
+            const auto& direction = kYawToDirectionVector[yaws[i] & 63];
+            out[i] = { direction.x * magnitudes[i] / 256, direction.y * magnitudes[i] / 256 };
+        }
+    }
 }
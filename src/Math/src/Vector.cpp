@@ -1,6 +1,14 @@
 #include "Vector.hpp"
 #include <array>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENLOCO_VECTOR_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define OPENLOCO_VECTOR_NEON
+#include <arm_neon.h>
+#endif
+
 namespace OpenLoco::Math::Vector
 {
     namespace Data
@@ -123,4 +131,106 @@ namespace OpenLoco::Math::Vector
 
         return Data::kFastSquareRootTable[(distance & 0xFFE) >> 1] >> i;
     }
+
+    namespace Detail
+    {
+        // Which components of each rotated pair are negated after the x and y are swapped,
+        // a rotation by 2 negates both without swapping.
+        static constexpr bool kSwapComponents[4] = { false, true, false, true };
+        static constexpr bool kNegateX[4] = { false, false, true, true };
+        static constexpr bool kNegateY[4] = { false, true, true, false };
+
+        template<typename T>
+        static void rotatePairsScalar(T* pairs, size_t count, int32_t direction) noexcept
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const auto vec = rotate(TVector2<T>{ pairs[i * 2], pairs[i * 2 + 1] }, direction);
+                pairs[i * 2] = vec.x;
+                pairs[i * 2 + 1] = vec.y;
+            }
+        }
+
+        void rotatePairs(int16_t* pairs, size_t count, int32_t direction) noexcept
+        {
+            direction &= 3;
+            if (direction == 0)
+            {
+                return;
+            }
+
+            size_t i = 0;
+#if defined(OPENLOCO_VECTOR_SSE2)
+            const auto negateX = static_cast<int16_t>(kNegateX[direction] ? -1 : 0);
+            const auto negateY = static_cast<int16_t>(kNegateY[direction] ? -1 : 0);
+            const auto mask = _mm_setr_epi16(negateX, negateY, negateX, negateY, negateX, negateY, negateX, negateY);
+            for (; i + 4 <= count; i += 4)
+            {
+                auto* ptr = reinterpret_cast<__m128i*>(pairs + i * 2);
+                auto v = _mm_loadu_si128(ptr);
+                if (kSwapComponents[direction])
+                {
+                    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+                }
+                _mm_storeu_si128(ptr, _mm_sub_epi16(_mm_xor_si128(v, mask), mask));
+            }
+#elif defined(OPENLOCO_VECTOR_NEON)
+            const int16_t negateX = kNegateX[direction] ? -1 : 0;
+            const int16_t negateY = kNegateY[direction] ? -1 : 0;
+            const int16_t maskValues[8] = { negateX, negateY, negateX, negateY, negateX, negateY, negateX, negateY };
+            const auto mask = vld1q_s16(maskValues);
+            for (; i + 4 <= count; i += 4)
+            {
+                auto v = vld1q_s16(pairs + i * 2);
+                if (kSwapComponents[direction])
+                {
+                    v = vrev32q_s16(v);
+                }
+                vst1q_s16(pairs + i * 2, vsubq_s16(veorq_s16(v, mask), mask));
+            }
+#endif
+            rotatePairsScalar(pairs + i * 2, count - i, direction);
+        }
+
+        void rotatePairs(int32_t* pairs, size_t count, int32_t direction) noexcept
+        {
+            direction &= 3;
+            if (direction == 0)
+            {
+                return;
+            }
+
+            size_t i = 0;
+#if defined(OPENLOCO_VECTOR_SSE2)
+            const auto negateX = kNegateX[direction] ? -1 : 0;
+            const auto negateY = kNegateY[direction] ? -1 : 0;
+            const auto mask = _mm_setr_epi32(negateX, negateY, negateX, negateY);
+            for (; i + 2 <= count; i += 2)
+            {
+                auto* ptr = reinterpret_cast<__m128i*>(pairs + i * 2);
+                auto v = _mm_loadu_si128(ptr);
+                if (kSwapComponents[direction])
+                {
+                    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+                }
+                _mm_storeu_si128(ptr, _mm_sub_epi32(_mm_xor_si128(v, mask), mask));
+            }
+#elif defined(OPENLOCO_VECTOR_NEON)
+            const int32_t negateX = kNegateX[direction] ? -1 : 0;
+            const int32_t negateY = kNegateY[direction] ? -1 : 0;
+            const int32_t maskValues[4] = { negateX, negateY, negateX, negateY };
+            const auto mask = vld1q_s32(maskValues);
+            for (; i + 2 <= count; i += 2)
+            {
+                auto v = vld1q_s32(pairs + i * 2);
+                if (kSwapComponents[direction])
+                {
+                    v = vrev64q_s32(v);
+                }
+                vst1q_s32(pairs + i * 2, vsubq_s32(veorq_s32(v, mask), mask));
+            }
+#endif
+            rotatePairsScalar(pairs + i * 2, count - i, direction);
+        }
+    }
 }
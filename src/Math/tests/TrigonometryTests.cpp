@@ -1,5 +1,6 @@
 #include <OpenLoco/Math/Trigonometry.hpp>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace OpenLoco::Math;
 
@@ -20,3 +21,42 @@ TEST(TrigonometryTest, integerCosinePrecisionHigh)
     ASSERT_EQ(Trigonometry::integerCosinePrecisionHigh(Trigonometry::kDirectionPrecisionHigh / 4 + Trigonometry::kDirectionPrecisionHigh / 2, 500), 0);
     ASSERT_EQ(Trigonometry::integerCosinePrecisionHigh(Trigonometry::kDirectionPrecisionHigh, 500), 499);
 }
+
+TEST(TrigonometryTest, batchIntegerSineCosine)
+{
+    std::vector<uint16_t> directions;
+    std::vector<int32_t> magnitudes;
+    for (uint32_t direction = 0; direction < 0x10000; direction += 7)
+    {
+        directions.push_back(static_cast<uint16_t>(direction));
+        magnitudes.push_back(static_cast<int32_t>(direction % 2000) - 1000);
+    }
+
+    std::vector<int32_t> sines(directions.size());
+    std::vector<int32_t> cosines(directions.size());
+    Trigonometry::integerSinePrecisionHigh(directions, magnitudes, sines);
+    Trigonometry::integerCosinePrecisionHigh(directions, magnitudes, cosines);
+    for (size_t i = 0; i < directions.size(); i++)
+    {
+        ASSERT_EQ(sines[i], Trigonometry::integerSinePrecisionHigh(directions[i], magnitudes[i]));
+        ASSERT_EQ(cosines[i], Trigonometry::integerCosinePrecisionHigh(directions[i], magnitudes[i]));
+    }
+}
+
+TEST(TrigonometryTest, batchComputeXYVectors)
+{
+    std::vector<int32_t> magnitudes;
+    std::vector<uint8_t> yaws;
+    for (auto i = 0; i < 64 * 5; i++)
+    {
+        magnitudes.push_back(i * 13 - 2000);
+        yaws.push_back(static_cast<uint8_t>(i % 64));
+    }
+
+    std::vector<Vector::TVector2<int32_t>> vectors(magnitudes.size());
+    Trigonometry::computeXYVectors(magnitudes, yaws, vectors);
+    for (size_t i = 0; i < magnitudes.size(); i++)
+    {
+        ASSERT_EQ(vectors[i], Trigonometry::computeXYVector(magnitudes[i], yaws[i]));
+    }
+}
@@ -1,5 +1,6 @@
 #include <OpenLoco/Math/Vector.hpp>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace OpenLoco::Math;
 
@@ -70,3 +71,33 @@ TEST(VectorTest, manhattenDistance)
     b = { 10, 10 };
     ASSERT_EQ(Vector::manhattanDistance2D(a, b), 0);
 }
+
+template<typename T>
+static void testBatchRotate()
+{
+    using Vec = Vector::TVector2<T>;
+
+    // Odd count so the scalar tail after the SIMD loop is covered as well
+    std::vector<Vec> vecs;
+    for (auto i = 0; i < 37; i++)
+    {
+        vecs.push_back(Vec{ static_cast<T>(i * 31 - 500), static_cast<T>(700 - i * 17) });
+    }
+
+    for (auto direction = -1; direction <= 4; direction++)
+    {
+        auto rotated = vecs;
+        Vector::rotate(std::span(rotated), direction);
+        for (size_t i = 0; i < vecs.size(); i++)
+        {
+            ASSERT_EQ(rotated[i], Vector::rotate(vecs[i], direction));
+        }
+    }
+}
+
+TEST(VectorTest, batchRotate)
+{
+    testBatchRotate<int16_t>();
+    testBatchRotate<int32_t>();
+    testBatchRotate<int8_t>();
+}
@@ -13,6 +13,7 @@
 #include "Map/TileLoop.hpp"
 #include "Map/TileManager.h"
 #include "Map/TreeElement.h"
+#include "MemoryAccounting.h"
 #include "Objects/ObjectManager.h"
 #include "Objects/SoundObject.h"
 #include "Objects/TreeObject.h"
@@ -21,12 +22,16 @@
 #include "VehicleChannel.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
-#include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/FileStream.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <atomic>
+#include <limits>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -66,9 +71,24 @@ namespace OpenLoco::Audio
     static std::vector<VehicleChannel> _vehicleChannels;
     static std::vector<Channel> _soundFX;
 
-    static std::vector<uint32_t> _samples;
+    // The sound effects of the CSS file are only read when they are first played
+    struct SoundEffectData
+    {
+        WAVEFORMATEX format;
+        std::vector<std::byte> pcm;
+    };
+
+    static fs::path _soundEffectsPath;
+    static std::vector<uint32_t> _soundEffectOffsets;
+    static std::vector<std::optional<uint32_t>> _samples;
+
+    // Sound effects read ahead by the prefetch thread, waiting to be uploaded on first play
+    static std::mutex _prefetchMutex;
+    static std::vector<std::optional<SoundEffectData>> _prefetchedSamples;
+    static std::thread _prefetchThread;
+    static std::atomic<bool> _stopPrefetch{};
+
     static std::unordered_map<uint16_t, uint32_t> _objectSamples;
-    static std::unordered_map<PathId, uint32_t> _musicSamples;
 
     static OpenAL::Device _device;
     static OpenAL::SourceManager _sourceManager;
@@ -87,56 +107,133 @@ namespace OpenLoco::Audio
         return nullptr;
     }
 
+    static size_t getMemoryUsage()
+    {
+        size_t usage = _bufferManager.getMemoryUsage();
+        std::lock_guard lock(_prefetchMutex);
+        for (const auto& sample : _prefetchedSamples)
+        {
+            if (sample.has_value())
+            {
+                usage += sample->pcm.capacity();
+            }
+        }
+        return usage;
+    }
+
     static uint32_t loadSoundFromWaveMemory(const WAVEFORMATEX& format, const void* pcm, size_t pcmLen)
     {
         const auto id = _bufferManager.allocate(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(pcm), pcmLen), format.nSamplesPerSec, format.nChannels == 2, format.wBitsPerSample);
         return id;
     }
 
-    static std::vector<uint32_t> loadSoundsFromCSS(const fs::path& path)
+    static SoundEffectData readSoundEffect(FileStream& fs, uint32_t offset)
     {
-        Logging::verbose("loadSoundsFromCSS({})", path.string());
+        // Navigate to beginning of wave data
+        fs.setPosition(offset);
+
+        // Read length of wave data and load it into the pcm buffer
+        SoundEffectData sound;
+        auto pcmLen = fs.readValue<uint32_t>();
+        sound.format = fs.readValue<WAVEFORMATEX>();
+        sound.pcm.resize(pcmLen);
+        fs.read(sound.pcm.data(), pcmLen);
+        return sound;
+    }
+
+    // Only reads the table of sound effects, the effects themselves are read on first play.
+    static void openSoundEffects(const fs::path& path)
+    {
+        Logging::verbose("openSoundEffects({})", path.string());
 
+        _soundEffectsPath = path;
+        _soundEffectOffsets.clear();
         try
         {
-            std::vector<uint32_t> results;
-
             FileStream fs(path, StreamMode::read);
             auto numSounds = fs.readValue<uint32_t>();
 
             std::vector<uint32_t> soundOffsets(numSounds, 0);
             fs.read(soundOffsets.data(), numSounds * sizeof(uint32_t));
+            _soundEffectOffsets = std::move(soundOffsets);
+        }
+        catch (const std::exception& ex)
+        {
+            Logging::error("openSoundEffects({}) failed: {}", path.string(), ex.what());
+        }
+        _samples.assign(_soundEffectOffsets.size(), std::nullopt);
+        _prefetchedSamples.assign(_soundEffectOffsets.size(), std::nullopt);
+    }
 
-            std::vector<std::byte> pcm;
-            for (uint32_t i = 0; i < numSounds; i++)
+    // Reads all sound effects ahead of them being played, runs on the prefetch thread.
+    static void prefetchSoundEffects(fs::path path, std::vector<uint32_t> offsets)
+    {
+        try
+        {
+            FileStream fs(path, StreamMode::read);
+            for (size_t i = 0; i < offsets.size() && !_stopPrefetch; i++)
             {
-                // Navigate to beginning of wave data
-                fs.setPosition(soundOffsets[i]);
+                auto sound = readSoundEffect(fs, offsets[i]);
 
-                // Read length of wave data and load it into the pcm buffer
-                auto pcmLen = fs.readValue<uint32_t>();
-                auto format = fs.readValue<WAVEFORMATEX>();
+                std::lock_guard lock(_prefetchMutex);
+                _prefetchedSamples[i] = std::move(sound);
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            Logging::error("prefetchSoundEffects({}) failed: {}", path.string(), ex.what());
+        }
+    }
 
-                pcm.resize(pcmLen);
-                fs.read(pcm.data(), pcmLen);
+    static void startPrefetchingSoundEffects()
+    {
+        _stopPrefetch = false;
+        _prefetchThread = std::thread(prefetchSoundEffects, _soundEffectsPath, _soundEffectOffsets);
+    }
 
-                results.push_back(loadSoundFromWaveMemory(format, pcm.data(), pcmLen));
-            }
+    static void stopPrefetchingSoundEffects()
+    {
+        if (_prefetchThread.joinable())
+        {
+            _stopPrefetch = true;
+            _prefetchThread.join();
+        }
+    }
 
-            return results;
+    static std::optional<uint32_t> loadSoundEffect(size_t index)
+    {
+        std::optional<SoundEffectData> sound;
+        {
+            std::lock_guard lock(_prefetchMutex);
+            sound = std::move(_prefetchedSamples[index]);
+            _prefetchedSamples[index].reset();
         }
-        catch (const std::exception& ex)
+
+        if (!sound)
         {
-            Logging::error("loadSoundsFromCSS({}) failed: {}", path.string(), ex.what());
-            return {};
+            try
+            {
+                FileStream fs(_soundEffectsPath, StreamMode::read);
+                sound = readSoundEffect(fs, _soundEffectOffsets[index]);
+            }
+            catch (const std::exception& ex)
+            {
+                Logging::error("loadSoundEffect({}) failed: {}", index, ex.what());
+                // Don't try reading it again every time it is played
+                _soundEffectOffsets[index] = 0;
+                return std::nullopt;
+            }
         }
+        return loadSoundFromWaveMemory(sound->format, sound->pcm.data(), sound->pcm.size());
     }
 
     static void disposeSamples()
     {
+        stopPrefetchingSoundEffects();
         _samples.clear();
+        _prefetchedSamples.clear();
+        _soundEffectOffsets.clear();
         _objectSamples.clear();
-        _musicSamples.clear();
     }
 
     static void disposeChannels()
@@ -214,6 +311,7 @@ namespace OpenLoco::Audio
         Logging::info("AUDIO INIT: Opening audio device: '{}'", deviceName.empty() ? "default" : deviceName);
         _device.open(deviceName);
         Logging::info("AUDIO INIT: Audio device opened successfully");
+        OpenAL::startCommandThread();
         Logging::info("AUDIO INIT: Setting up audio channels...");
         _channels.clear();
         for (auto i = 0; i < 4; ++i)
@@ -233,12 +331,17 @@ namespace OpenLoco::Audio
         }
         Logging::info("AUDIO INIT: Created {} vehicle channels", _vehicleChannels.size());
 
-        Logging::info("AUDIO INIT: Loading sound samples from CSS file...");
+        Logging::info("AUDIO INIT: Reading sound sample table from CSS file...");
         auto css1path = Environment::getPath(Environment::PathId::css1);
         Logging::info("AUDIO INIT: CSS1 path: '{}'", css1path);
-        _samples = loadSoundsFromCSS(css1path);
-        Logging::info("AUDIO INIT: Loaded {} sound samples", _samples.size());
-        
+        openSoundEffects(css1path);
+        Logging::info("AUDIO INIT: Found {} sound samples", _samples.size());
+        if (cfg.audio.prefetchSounds)
+        {
+            startPrefetchingSoundEffects();
+        }
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::audioSamples, getMemoryUsage);
+
         _audioInitialised = 1;
         Logging::info("AUDIO INIT: DirectSound initialization completed successfully!");
     }
@@ -246,6 +349,8 @@ namespace OpenLoco::Audio
     // 0x00404E58
     void disposeDSound()
     {
+        // The remaining calls are made right away once the thread has stopped
+        OpenAL::stopCommandThread();
         disposeChannels();
         disposeSamples();
         _sourceManager.dispose();
@@ -582,6 +687,12 @@ namespace OpenLoco::Audio
 
     std::optional<uint32_t> getSoundSample(SoundId id)
     {
+        // Nothing is loaded without a device, like when running headless
+        if (!_audioInitialised)
+        {
+            return std::nullopt;
+        }
+
         if (isObjectSoundId(id))
         {
             // TODO this is not getting deallocated when sound objects unloaded
@@ -606,7 +717,12 @@ namespace OpenLoco::Audio
         }
         else if (static_cast<size_t>(id) < _samples.size())
         {
-            return _samples[static_cast<size_t>(id)];
+            const auto index = static_cast<size_t>(id);
+            if (!_samples[index] && _soundEffectOffsets[index] != 0)
+            {
+                _samples[index] = loadSoundEffect(index);
+            }
+            return _samples[index];
         }
         return std::nullopt;
     }
@@ -639,6 +755,11 @@ namespace OpenLoco::Audio
     // 0x0048A18C
     void updateSounds()
     {
+        for (auto& channel : _channels)
+        {
+            channel.update();
+        }
+
         if (_soundFX.empty())
         {
             return;
@@ -652,79 +773,6 @@ namespace OpenLoco::Audio
         }
     }
 
-    static std::optional<uint32_t> loadMusicSample(PathId asset)
-    {
-        auto res = _musicSamples.find(asset);
-        if (res != std::end(_musicSamples))
-        {
-            return res->second;
-        }
-
-        const auto path = Environment::getPath(asset);
-        try
-        {
-            FileStream fs(path, StreamMode::read);
-
-            const auto sig = fs.readValue<uint32_t>();
-            if (sig != 0x46464952) // RIFF
-            {
-                throw Exception::RuntimeError("Invalid signature.");
-            }
-
-            fs.readValue<uint32_t>(); // size
-
-            const auto riffType = fs.readValue<uint32_t>();
-            if (riffType != 0x45564157) // WAVE
-            {
-                throw Exception::RuntimeError("Invalid format.");
-            }
-
-            const auto fmtMarker = fs.readValue<uint32_t>();
-            // This can be 'fmt\0' or 'fmt '
-            if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
-            {
-                throw Exception::RuntimeError("Invalid format marker.");
-            }
-
-            fs.readValue<uint32_t>(); // header size
-
-            const auto typeFormat = fs.readValue<uint16_t>();
-            if (typeFormat != 1)
-            {
-                throw Exception::RuntimeError("Invalid format type, expected PCM.");
-            }
-
-            const auto channels = fs.readValue<uint16_t>();
-            const auto sampleRate = fs.readValue<uint32_t>();
-
-            fs.readValue<uint32_t>();
-            fs.readValue<uint16_t>();
-
-            const auto bits = fs.readValue<uint16_t>();
-
-            const auto dataMarker = fs.readValue<uint32_t>();
-            if (dataMarker != 0x61746164) // data
-            {
-                throw Exception::RuntimeError("Invalid data marker.");
-            }
-
-            const auto pcmLen = fs.readValue<uint32_t>();
-
-            std::vector<std::uint8_t> pcm(pcmLen);
-            fs.read(pcm.data(), pcmLen);
-
-            const auto id = _bufferManager.allocate(std::span<const uint8_t>(pcm.data(), pcmLen), sampleRate, channels == 2, bits);
-            _musicSamples[asset] = id;
-
-            return id;
-        }
-        catch (const std::exception& ex)
-        {
-            Logging::error("Unable to load music sample '{}': {}", path, ex.what());
-            return std::nullopt;
-        }
-    }
-
     // 0x00401A05
     static void stopChannel(ChannelId id)
     {
@@ -737,30 +785,37 @@ namespace OpenLoco::Audio
         }
     }
 
-    static void sub_48A274(Vehicles::VehicleSoundPlayer* v)
+    // A viewport vehicles are heard from, the main viewport is extended so vehicles just off screen can be heard
+    struct VehicleSoundViewport
     {
-        if (v == nullptr)
-        {
-            return;
-        }
+        ViewportRect rect;
+        WindowType windowType;
+        WindowNumber_t windowNumber;
+    };
 
-        if (v->drivingSoundId == SoundObjectId::null)
-        {
-            return;
-        }
+    // A vehicle that can be heard this update and the viewport it is heard from
+    struct VehicleSoundCandidate
+    {
+        Vehicles::VehicleSoundPlayer* soundPlayer;
+        size_t viewportIndex;
+        // Squared distance of the sprite from the centre of the viewport
+        int32_t distance;
+    };
 
-        // TODO: left or top?
-        if (v->spriteLeft == Location::null)
-        {
-            return;
-        }
+    // Vehicle sprites are never higher than this above their position on screen
+    static constexpr int16_t kMaxVehicleSoundZ = std::numeric_limits<uint8_t>::max() * World::kSmallZStep;
+    // Sprites are tested by their top left corner which can be this far from the vehicle position
+    static constexpr int16_t kVehicleSpriteMargin = 128;
 
-        if (_numActiveVehicleSounds >= kMaxVehicleSounds)
-        {
-            return;
-        }
+    static std::vector<VehicleSoundViewport> _vehicleSoundViewports;
+    static std::vector<VehicleSoundCandidate> _vehicleSoundCandidates;
+    // The vehicles flag0 was set on by the last update
+    static std::vector<EntityId> _vehiclesWithSound;
 
-        auto spritePosition = viewport_pos(v->spriteLeft, v->spriteTop);
+    // The main viewport goes first and then the other viewports from the top most window
+    static void updateVehicleSoundViewports()
+    {
+        _vehicleSoundViewports.clear();
 
         auto main = WindowManager::getMainWindow();
         if (main != nullptr && main->viewports[0] != nullptr)
@@ -774,21 +829,7 @@ namespace OpenLoco::Audio
             extendedViewport.top = viewport->viewY - quarterHeight;
             extendedViewport.right = viewport->viewX + viewport->viewWidth + quarterWidth;
             extendedViewport.bottom = viewport->viewY + viewport->viewHeight + quarterHeight;
-
-            if (extendedViewport.contains(spritePosition))
-            {
-                // jump + return
-                _numActiveVehicleSounds += 1;
-                v->soundFlags |= Vehicles::SoundFlags::flag0;
-                v->soundWindowType = main->type;
-                v->soundWindowNumber = main->number;
-                return;
-            }
-        }
-
-        if (WindowManager::count() == 0)
-        {
-            return;
+            _vehicleSoundViewports.push_back({ extendedViewport, main->type, main->number });
         }
 
         for (auto i = (int32_t)WindowManager::count() - 1; i >= 0; i--)
@@ -811,55 +852,139 @@ namespace OpenLoco::Audio
                 continue;
             }
 
-            if (viewport->contains(spritePosition))
+            // Same bounds as Viewport::contains
+            ViewportRect rect = {};
+            rect.left = viewport->viewX - 1;
+            rect.top = viewport->viewY - 1;
+            rect.right = viewport->viewX + viewport->viewWidth - 1;
+            rect.bottom = viewport->viewY + viewport->viewHeight - 1;
+            _vehicleSoundViewports.push_back({ rect, w->type, w->number });
+        }
+    }
+
+    // The map area vehicles seen in the rect can be in, for any height they can be at
+    static std::pair<World::Pos2, World::Pos2> getVehicleSoundMapBounds(const ViewportRect& rect)
+    {
+        const auto rotation = WindowManager::getCurrentRotation();
+        const auto left = static_cast<int16_t>(rect.left - kVehicleSpriteMargin);
+        const auto top = static_cast<int16_t>(rect.top - kVehicleSpriteMargin);
+        const auto right = static_cast<int16_t>(rect.right + kVehicleSpriteMargin);
+        const auto bottom = static_cast<int16_t>(rect.bottom + kVehicleSpriteMargin);
+
+        World::Pos2 min{ std::numeric_limits<coord_t>::max(), std::numeric_limits<coord_t>::max() };
+        World::Pos2 max{ std::numeric_limits<coord_t>::min(), std::numeric_limits<coord_t>::min() };
+        for (const auto z : { int16_t(0), kMaxVehicleSoundZ })
+        {
+            for (const auto& corner : { viewport_pos(left, top), viewport_pos(right, top), viewport_pos(left, bottom), viewport_pos(right, bottom) })
             {
-                _numActiveVehicleSounds += 1;
-                v->soundFlags |= Vehicles::SoundFlags::flag0;
-                v->soundWindowType = w->type;
-                v->soundWindowNumber = w->number;
-                return;
+                const auto pos = viewportCoordToMapCoord(corner.x, corner.y, z, rotation);
+                min.x = std::min(min.x, pos.x);
+                min.y = std::min(min.y, pos.y);
+                max.x = std::max(max.x, pos.x);
+                max.y = std::max(max.y, pos.y);
             }
         }
+        return { min, max };
     }
 
-    static void off_4FEB58(Vehicles::VehicleSoundPlayer* v, int32_t x)
+    // Finds the vehicles that can be heard by querying the area of each viewport, rather than
+    // testing every vehicle against every viewport.
+    static void findVehicleSoundCandidates()
     {
-        switch (x)
-        {
-            case 0:
-                v->soundFlags &= ~Vehicles::SoundFlags::flag0;
-                break;
-            case 1:
-                if ((v->soundFlags & Vehicles::SoundFlags::flag1) == Vehicles::SoundFlags::none)
+        _vehicleSoundCandidates.clear();
+        for (size_t i = 0; i < _vehicleSoundViewports.size(); i++)
+        {
+            const auto& soundViewport = _vehicleSoundViewports[i];
+            const auto [min, max] = getVehicleSoundMapBounds(soundViewport.rect);
+            EntityManager::forEachEntityInRange(min, max, [i, &soundViewport](EntityBase& entity) {
+                auto* vehicle = entity.asBase<Vehicles::VehicleBase>();
+                if (vehicle == nullptr || !vehicle->hasSoundPlayer())
                 {
-                    sub_48A274(v);
+                    return;
                 }
-                break;
-            case 2:
-                if ((v->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none)
+
+                auto* v = vehicle->getSoundPlayer();
+                // TODO: left or top?
+                if (v->drivingSoundId == SoundObjectId::null || v->spriteLeft == Location::null)
                 {
-                    sub_48A274(v);
+                    return;
                 }
-                break;
-            case 3:
-                playSound(v);
-                break;
+
+                auto spritePosition = viewport_pos(v->spriteLeft, v->spriteTop);
+                auto rect = soundViewport.rect;
+                if (!rect.contains(spritePosition))
+                {
+                    return;
+                }
+
+                // A vehicle is heard from the first viewport it is in
+                for (size_t j = 0; j < i; j++)
+                {
+                    if (_vehicleSoundViewports[j].rect.contains(spritePosition))
+                    {
+                        return;
+                    }
+                }
+
+                const auto dx = spritePosition.x - (rect.left + rect.right) / 2;
+                const auto dy = spritePosition.y - (rect.top + rect.bottom) / 2;
+                _vehicleSoundCandidates.push_back({ v, i, dx * dx + dy * dy });
+            });
         }
     }
 
     // 0x0048A1FA
-    static void sub_48A1FA(int32_t x)
+    // Picks the vehicles that get to play a sound, vehicles without flag1 go first as they did
+    // in vanilla and then the ones closest to the centre of their viewport.
+    static void selectVehicleSounds()
     {
-        if (x == 0)
+        _numActiveVehicleSounds = 0;
+        for (const auto id : _vehiclesWithSound)
         {
-            _numActiveVehicleSounds = 0;
+            auto* vehicle = EntityManager::get<Vehicles::VehicleBase>(id);
+            if (vehicle != nullptr && vehicle->hasSoundPlayer())
+            {
+                vehicle->getSoundPlayer()->soundFlags &= ~Vehicles::SoundFlags::flag0;
+            }
         }
+        _vehiclesWithSound.clear();
+
+        if (WindowManager::count() == 0)
+        {
+            return;
+        }
+
+        updateVehicleSoundViewports();
+        findVehicleSoundCandidates();
 
-        for (auto* v : VehicleManager::VehicleList())
+        std::sort(std::begin(_vehicleSoundCandidates), std::end(_vehicleSoundCandidates), [](const VehicleSoundCandidate& a, const VehicleSoundCandidate& b) {
+            const auto aHasFlag1 = (a.soundPlayer->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none;
+            const auto bHasFlag1 = (b.soundPlayer->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none;
+            if (aHasFlag1 != bHasFlag1)
+            {
+                return bHasFlag1;
+            }
+            if (a.distance != b.distance)
+            {
+                return a.distance < b.distance;
+            }
+            return a.soundPlayer->id < b.soundPlayer->id;
+        });
+
+        for (const auto& candidate : _vehicleSoundCandidates)
         {
-            Vehicles::Vehicle train(*v);
-            off_4FEB58(reinterpret_cast<Vehicles::VehicleSoundPlayer*>(train.veh2), x);
-            off_4FEB58(reinterpret_cast<Vehicles::VehicleSoundPlayer*>(train.tail), x);
+            if (_numActiveVehicleSounds >= kMaxVehicleSounds)
+            {
+                break;
+            }
+
+            const auto& soundViewport = _vehicleSoundViewports[candidate.viewportIndex];
+            auto* v = candidate.soundPlayer;
+            _numActiveVehicleSounds += 1;
+            v->soundFlags |= Vehicles::SoundFlags::flag0;
+            v->soundWindowType = soundViewport.windowType;
+            v->soundWindowNumber = soundViewport.windowNumber;
+            _vehiclesWithSound.push_back(v->id);
         }
     }
 
@@ -870,14 +995,16 @@ namespace OpenLoco::Audio
         {
             if (!_audioIsPaused && _audioIsEnabled)
             {
-                sub_48A1FA(0);
-                sub_48A1FA(1);
-                sub_48A1FA(2);
+                selectVehicleSounds();
                 for (auto& vc : _vehicleChannels)
                 {
                     vc.update();
                 }
-                sub_48A1FA(3);
+                for (const auto id : _vehiclesWithSound)
+                {
+                    auto* vehicle = EntityManager::get<Vehicles::VehicleBase>(id);
+                    playSound(vehicle->getSoundPlayer());
+                }
             }
         }
     }
@@ -916,11 +1043,173 @@ namespace OpenLoco::Audio
         return _volumes[zoom];
     }
 
+    // What a tile adds to the counts the ambient sound is chosen from
+    struct AmbientTile
+    {
+        uint8_t water;
+        uint8_t wilderness;
+        uint8_t trees;
+    };
+
+    // The tiles around the main viewport centre that the ambient sound is chosen from. Moving the
+    // window only classifies the tiles that enter it and one row is classified again each tick to
+    // follow changes to the map. A window is at most kSize tiles wide so the tiles of the window
+    // can be stored by their position modulo kSize.
+    struct AmbientWindow
+    {
+        static constexpr int32_t kSize = 12;
+
+        bool isValid = false;
+        World::TilePos2 topLeft;
+        World::TilePos2 bottomRight;
+        std::array<AmbientTile, kSize * kSize> tiles{};
+        size_t waterCount = 0;
+        size_t wildernessCount = 0;
+        size_t treeCount = 0;
+        int32_t nextRefreshRow = 0;
+
+        AmbientTile& getTile(const World::TilePos2& pos)
+        {
+            return tiles[(pos.y % kSize) * kSize + (pos.x % kSize)];
+        }
+    };
+
+    static AmbientWindow _ambientWindow;
+
+    static AmbientTile classifyAmbientTile(const World::TilePos2& pos)
+    {
+        AmbientTile result{};
+        const auto tile = World::TileManager::get(pos);
+        bool passedSurface = false;
+        for (const auto& el : tile)
+        {
+            auto* elSurface = el.as<World::SurfaceElement>();
+            if (elSurface != nullptr)
+            {
+                passedSurface = true;
+                if (elSurface->water() != 0)
+                {
+                    result.water = 1;
+                    break;
+                }
+                else if (elSurface->snowCoverage() && elSurface->isLast())
+                {
+                    result.wilderness = 1;
+                    break;
+                }
+                else if (elSurface->baseZ() >= 64 && elSurface->isLast())
+                {
+                    result.wilderness = 1;
+                    break;
+                }
+                continue;
+            }
+            auto* elTree = el.as<World::TreeElement>();
+            if (passedSurface && elTree != nullptr)
+            {
+                const auto* treeObj = ObjectManager::get<TreeObject>(elTree->treeObjectId());
+                if (!treeObj->hasFlags(TreeObjectFlags::droughtResistant) && result.trees != std::numeric_limits<uint8_t>::max())
+                {
+                    result.trees++;
+                }
+            }
+        }
+        return result;
+    }
+
+    static void addAmbientTile(const World::TilePos2& pos)
+    {
+        auto& tile = _ambientWindow.getTile(pos);
+        tile = classifyAmbientTile(pos);
+        _ambientWindow.waterCount += tile.water;
+        _ambientWindow.wildernessCount += tile.wilderness;
+        _ambientWindow.treeCount += tile.trees;
+    }
+
+    static void removeAmbientTile(const World::TilePos2& pos)
+    {
+        const auto& tile = _ambientWindow.getTile(pos);
+        _ambientWindow.waterCount -= tile.water;
+        _ambientWindow.wildernessCount -= tile.wilderness;
+        _ambientWindow.treeCount -= tile.trees;
+    }
+
+    // Calls func for the tiles from topLeft to bottomRight inclusive that are outside of the other range
+    template<typename TFunc>
+    static void forEachTileOutside(const World::TilePos2& topLeft, const World::TilePos2& bottomRight, const World::TilePos2& otherTopLeft, const World::TilePos2& otherBottomRight, TFunc&& func)
+    {
+        for (auto y = topLeft.y; y <= bottomRight.y; y++)
+        {
+            if (y < otherTopLeft.y || y > otherBottomRight.y)
+            {
+                for (auto x = topLeft.x; x <= bottomRight.x; x++)
+                {
+                    func(World::TilePos2(x, y));
+                }
+                continue;
+            }
+            for (auto x = topLeft.x; x <= std::min<coord_t>(bottomRight.x, otherTopLeft.x - 1); x++)
+            {
+                func(World::TilePos2(x, y));
+            }
+            for (auto x = std::max<coord_t>(topLeft.x, otherBottomRight.x + 1); x <= bottomRight.x; x++)
+            {
+                func(World::TilePos2(x, y));
+            }
+        }
+    }
+
+    static void moveAmbientWindow(const World::TilePos2& topLeft, const World::TilePos2& bottomRight)
+    {
+        auto& window = _ambientWindow;
+        if (!window.isValid)
+        {
+            window = {};
+            for (const auto& pos : World::TilePosRangeView(topLeft, bottomRight))
+            {
+                addAmbientTile(pos);
+            }
+        }
+        else if (window.topLeft != topLeft || window.bottomRight != bottomRight)
+        {
+            // Remove the tiles leaving first as the ones entering can take their place in the window
+            forEachTileOutside(window.topLeft, window.bottomRight, topLeft, bottomRight, removeAmbientTile);
+            forEachTileOutside(topLeft, bottomRight, window.topLeft, window.bottomRight, addAmbientTile);
+        }
+        window.isValid = true;
+        window.topLeft = topLeft;
+        window.bottomRight = bottomRight;
+    }
+
+    static void refreshAmbientWindowRow()
+    {
+        auto& window = _ambientWindow;
+        const auto y = window.topLeft.y + window.nextRefreshRow;
+        window.nextRefreshRow = (window.nextRefreshRow + 1) % AmbientWindow::kSize;
+        if (y > window.bottomRight.y)
+        {
+            return;
+        }
+
+        for (auto x = window.topLeft.x; x <= window.bottomRight.x; x++)
+        {
+            const auto pos = World::TilePos2(x, y);
+            removeAmbientTile(pos);
+            addAmbientTile(pos);
+        }
+    }
+
+    void resetAmbientNoise()
+    {
+        _ambientWindow.isValid = false;
+    }
+
     // 0x0048ACFD
     void updateAmbientNoise()
     {
         if (!_audioInitialised || _audioIsPaused || !_audioIsEnabled)
         {
+            _ambientWindow.isValid = false;
             return;
         }
 
@@ -934,49 +1223,14 @@ namespace OpenLoco::Audio
             const auto centre = mainViewport->getCentreMapPosition();
             const auto topLeft = World::toTileSpace(centre) - World::TilePos2{ 5, 5 };
             const auto bottomRight = topLeft + World::TilePos2{ 11, 11 };
-            const auto searchRange = World::getClampedRange(topLeft, bottomRight);
+            const auto clampedTopLeft = World::TilePos2(World::clampTileCoord(topLeft.x), World::clampTileCoord(topLeft.y));
+            const auto clampedBottomRight = World::TilePos2(World::clampTileCoord(bottomRight.x), World::clampTileCoord(bottomRight.y));
+            moveAmbientWindow(clampedTopLeft, clampedBottomRight);
+            refreshAmbientWindowRow();
 
-            size_t waterCount = 0;      // bl
-            size_t wildernessCount = 0; // bh
-            size_t treeCount = 0;       // cx
-            for (auto& tilePos : searchRange)
-            {
-                const auto tile = World::TileManager::get(tilePos);
-                bool passedSurface = false;
-                for (const auto& el : tile)
-                {
-                    auto* elSurface = el.as<World::SurfaceElement>();
-                    if (elSurface != nullptr)
-                    {
-                        passedSurface = true;
-                        if (elSurface->water() != 0)
-                        {
-                            waterCount++;
-                            break;
-                        }
-                        else if (elSurface->snowCoverage() && elSurface->isLast())
-                        {
-                            wildernessCount++;
-                            break;
-                        }
-                        else if (elSurface->baseZ() >= 64 && elSurface->isLast())
-                        {
-                            wildernessCount++;
-                            break;
-                        }
-                        continue;
-                    }
-                    auto* elTree = el.as<World::TreeElement>();
-                    if (passedSurface && elTree != nullptr)
-                    {
-                        const auto* treeObj = ObjectManager::get<TreeObject>(elTree->treeObjectId());
-                        if (!treeObj->hasFlags(TreeObjectFlags::droughtResistant))
-                        {
-                            treeCount++;
-                        }
-                    }
-                }
-            }
+            const auto waterCount = _ambientWindow.waterCount;           // bl
+            const auto wildernessCount = _ambientWindow.wildernessCount; // bh
+            const auto treeCount = _ambientWindow.treeCount;             // cx
 
             if (waterCount > kAmbientNumWaterTilesForOcean)
             {
@@ -991,6 +1245,10 @@ namespace OpenLoco::Audio
                 newAmbientSound = PathId::css4;
             }
         }
+        else
+        {
+            _ambientWindow.isValid = false;
+        }
         auto* channel = getChannel(ChannelId::ambient);
         if (channel == nullptr)
         {
@@ -1019,10 +1277,8 @@ namespace OpenLoco::Audio
 
         if (_chosenAmbientNoisePathId != *newAmbientSound)
         {
-            auto musicBuffer = loadMusicSample(*newAmbientSound);
-            if (musicBuffer.has_value())
+            if (channel->loadStream(Environment::getPath(*newAmbientSound)))
             {
-                channel->load(*musicBuffer);
                 channel->setVolume(kAmbientMinVolume);
                 channel->play(true);
                 _chosenAmbientNoisePathId = *newAmbientSound;
@@ -1126,10 +1382,7 @@ namespace OpenLoco::Audio
             return;
         }
 
-        channel->stop();
-
-        auto musicSample = loadMusicSample(sample);
-        if (channel->load(*musicSample))
+        if (channel->loadStream(Environment::getPath(sample)))
         {
             channel->setVolume(volume);
             channel->play(loop);
@@ -114,6 +114,8 @@ namespace OpenLoco::Audio
     void stopVehicleNoise(EntityId head);
 
     void updateAmbientNoise();
+    // Samples the surroundings of the main viewport again, for when the map is replaced.
+    void resetAmbientNoise();
     void stopAmbientNoise();
 
     void revalidateCurrentTrack();
@@ -2,21 +2,45 @@
 #include "Logging.h"
 #include <utility>
 
+using namespace OpenLoco::Diagnostics;
+
 namespace OpenLoco::Audio
 {
     bool Channel::load(uint32_t buffer)
     {
+        _stream.reset();
         _source.setBuffer(buffer);
         _isLoaded = true;
         return true;
     }
 
+    bool Channel::loadStream(const fs::path& path)
+    {
+        stop();
+        try
+        {
+            _stream = std::make_unique<MusicStream>(_source, path);
+        }
+        catch (const std::exception& ex)
+        {
+            Logging::error("Unable to stream '{}': {}", path, ex.what());
+            return false;
+        }
+        _isLoaded = true;
+        return true;
+    }
+
     bool Channel::play(bool loop)
     {
         if (_isLoaded == false)
         {
             return false;
         }
+        if (_stream != nullptr)
+        {
+            _stream->play(loop);
+            return true;
+        }
         _source.setLooping(loop);
         _source.play();
         return true;
@@ -28,6 +52,11 @@ namespace OpenLoco::Audio
         {
             return false;
         }
+        if (_stream != nullptr)
+        {
+            _stream->pause();
+            return true;
+        }
         _source.pause();
         return true;
     }
@@ -38,12 +67,18 @@ namespace OpenLoco::Audio
         {
             return false;
         }
+        if (_stream != nullptr)
+        {
+            _stream->unpause();
+            return true;
+        }
         _source.play();
         return true;
     }
 
     void Channel::stop()
     {
+        _stream.reset();
         _source.stop();
         _source.setBuffer(0); // Unload buffer allowing destruct of buffers
         _isLoaded = false;
@@ -76,13 +111,30 @@ namespace OpenLoco::Audio
         }
     }
 
+    void Channel::update()
+    {
+        if (_stream != nullptr)
+        {
+            _stream->update();
+        }
+    }
+
     bool Channel::isPaused() const
     {
+        if (_stream != nullptr)
+        {
+            return _stream->isPaused();
+        }
         return _source.isPaused();
     }
 
     bool Channel::isPlaying() const
     {
+        // A stream still counts as playing while waiting on the decoder
+        if (_stream != nullptr)
+        {
+            return !_stream->isFinished() && !_stream->isPaused();
+        }
         return _source.isPlaying();
     }
 }
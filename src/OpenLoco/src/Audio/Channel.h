@@ -1,5 +1,8 @@
 #pragma once
+#include "MusicStream.h"
 #include "OpenAL.h"
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <memory>
 
 namespace OpenLoco::Audio
 {
@@ -19,6 +22,7 @@ namespace OpenLoco::Audio
         OpenAL::Source _source;
         bool _isLoaded = false;
         Attributes _attributes;
+        std::unique_ptr<MusicStream> _stream;
 
     public:
         Channel(OpenAL::Source source)
@@ -27,6 +31,8 @@ namespace OpenLoco::Audio
         {
         }
         bool load(uint32_t buffer);
+        // Streams the wave file rather than playing a loaded buffer, see MusicStream.
+        bool loadStream(const fs::path& path);
         bool play(bool loop);
         bool pause();
         bool unpause();
@@ -34,6 +40,8 @@ namespace OpenLoco::Audio
         void setVolume(int32_t volume);
         void setPan(int32_t pan);
         void setFrequency(int32_t freq);
+        // Keeps a stream fed, does nothing for a loaded buffer.
+        void update();
         bool isPaused() const;
         bool isPlaying() const;
         const OpenAL::Source& getSource() const { return _source; }
@@ -0,0 +1,244 @@
+#include "MusicStream.h"
+#include "Logging.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <algorithm>
+#include <chrono>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Audio
+{
+    // How long the decoder sleeps when all chunks are filled, the main thread wakes it sooner
+    static constexpr auto kDecoderIdleTime = std::chrono::milliseconds(50);
+
+    static MusicStream::Format readFormat(FileStream& fs)
+    {
+        const auto sig = fs.readValue<uint32_t>();
+        if (sig != 0x46464952) // RIFF
+        {
+            throw Exception::RuntimeError("Invalid signature.");
+        }
+
+        fs.readValue<uint32_t>(); // size
+
+        const auto riffType = fs.readValue<uint32_t>();
+        if (riffType != 0x45564157) // WAVE
+        {
+            throw Exception::RuntimeError("Invalid format.");
+        }
+
+        const auto fmtMarker = fs.readValue<uint32_t>();
+        // This can be 'fmt\0' or 'fmt '
+        if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
+        {
+            throw Exception::RuntimeError("Invalid format marker.");
+        }
+
+        fs.readValue<uint32_t>(); // header size
+
+        const auto typeFormat = fs.readValue<uint16_t>();
+        if (typeFormat != 1)
+        {
+            throw Exception::RuntimeError("Invalid format type, expected PCM.");
+        }
+
+        MusicStream::Format format;
+        format.channels = fs.readValue<uint16_t>();
+        format.sampleRate = fs.readValue<uint32_t>();
+
+        fs.readValue<uint32_t>();
+        fs.readValue<uint16_t>();
+
+        format.bits = fs.readValue<uint16_t>();
+
+        const auto dataMarker = fs.readValue<uint32_t>();
+        if (dataMarker != 0x61746164) // data
+        {
+            throw Exception::RuntimeError("Invalid data marker.");
+        }
+
+        format.dataLength = fs.readValue<uint32_t>();
+        format.dataOffset = fs.getPosition();
+        if (format.dataLength > fs.getLength() - format.dataOffset)
+        {
+            throw Exception::RuntimeError("Invalid data length.");
+        }
+        return format;
+    }
+
+    MusicStream::MusicStream(OpenAL::Source source, const fs::path& path)
+        : _source(source)
+        , _file(path, StreamMode::read)
+        , _format(readFormat(_file))
+    {
+        for (size_t i = 0; i < kNumChunks; i++)
+        {
+            _freeChunks.tryPush(static_cast<uint8_t>(i));
+        }
+        for (auto& buffer : _buffers)
+        {
+            buffer = OpenAL::generateBuffer();
+            _freeBuffers.push_back(buffer);
+        }
+    }
+
+    MusicStream::~MusicStream()
+    {
+        if (_decoder.joinable())
+        {
+            _stopRequested = true;
+            _wakeDecoder.notify_one();
+            _decoder.join();
+        }
+
+        // Stopping and clearing the buffer unqueues all buffers so they can be deleted
+        _source.stop();
+        _source.setBuffer(0);
+        for (auto buffer : _buffers)
+        {
+            OpenAL::deleteBuffer(buffer);
+        }
+    }
+
+    void MusicStream::play(bool loop)
+    {
+        if (_isStarted)
+        {
+            return;
+        }
+
+        // Looping is done by the decoder, a looping source would repeat its queued buffers instead
+        _source.setLooping(false);
+        _loop = loop;
+        _isStarted = true;
+        _decoder = std::thread([this]() { decode(); });
+    }
+
+    void MusicStream::pause()
+    {
+        _isPaused = true;
+        _source.pause();
+    }
+
+    void MusicStream::unpause()
+    {
+        _isPaused = false;
+        if (_source.getNumQueuedBuffers() != 0)
+        {
+            _source.play();
+        }
+    }
+
+    void MusicStream::readChunk(Chunk& chunk, size_t& remaining)
+    {
+        chunk.length = 0;
+        chunk.isLast = false;
+        while (chunk.length < kChunkSize)
+        {
+            if (remaining == 0)
+            {
+                if (!_loop || _format.dataLength == 0)
+                {
+                    chunk.isLast = true;
+                    return;
+                }
+                _file.setPosition(_format.dataOffset);
+                remaining = _format.dataLength;
+            }
+
+            const auto length = std::min(kChunkSize - chunk.length, remaining);
+            _file.read(chunk.data.data() + chunk.length, length);
+            chunk.length += length;
+            remaining -= length;
+        }
+        chunk.isLast = remaining == 0 && !_loop;
+    }
+
+    // Runs on the decoder thread, only reads the file and the chunks taken from the free queue.
+    void MusicStream::decode()
+    {
+        size_t remaining = _format.dataLength;
+        while (!_stopRequested)
+        {
+            auto index = _freeChunks.tryPop();
+            if (!index)
+            {
+                std::unique_lock lock(_wakeMutex);
+                _wakeDecoder.wait_for(lock, kDecoderIdleTime, [this]() { return _stopRequested || !_freeChunks.empty(); });
+                continue;
+            }
+
+            auto& chunk = _chunks[*index];
+            try
+            {
+                readChunk(chunk, remaining);
+            }
+            catch (const std::exception& e)
+            {
+                Logging::error("Unable to stream music: {}", e.what());
+                chunk.length = 0;
+                chunk.isLast = true;
+            }
+
+            // Can't fail as there are only as many chunks as the queue holds
+            _filledChunks.tryPush(*index);
+            if (chunk.isLast)
+            {
+                return;
+            }
+        }
+    }
+
+    void MusicStream::update()
+    {
+        if (!_isStarted)
+        {
+            return;
+        }
+
+        // Take back the buffers that have been played
+        for (auto numProcessed = _source.getNumProcessedBuffers(); numProcessed > 0; numProcessed--)
+        {
+            _freeBuffers.push_back(_source.unqueueBuffer());
+        }
+
+        bool hasReturnedChunks = false;
+        while (!_freeBuffers.empty() && !_hasQueuedLast)
+        {
+            const auto index = _filledChunks.tryPop();
+            if (!index)
+            {
+                break;
+            }
+
+            const auto& chunk = _chunks[*index];
+            if (chunk.length != 0)
+            {
+                const auto buffer = _freeBuffers.back();
+                _freeBuffers.pop_back();
+                OpenAL::setBufferData(buffer, std::span<const uint8_t>(chunk.data.data(), chunk.length), _format.sampleRate, _format.channels == 2, static_cast<uint8_t>(_format.bits));
+                _source.queueBuffer(buffer);
+            }
+            _hasQueuedLast = chunk.isLast;
+            _freeChunks.tryPush(*index);
+            hasReturnedChunks = true;
+        }
+
+        if (hasReturnedChunks)
+        {
+            _wakeDecoder.notify_one();
+        }
+
+        // The source stops when it runs out of queued buffers, which happens at the start and when
+        // the main thread stalls for longer than the queued buffers last
+        if (!_isPaused && !_source.isPlaying() && _source.getNumQueuedBuffers() != 0)
+        {
+            _source.play();
+        }
+    }
+
+    bool MusicStream::isFinished() const
+    {
+        return _hasQueuedLast && !_source.isPlaying() && !_source.isPaused() && _source.getNumQueuedBuffers() == _source.getNumProcessedBuffers();
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "OpenAL.h"
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Core/SpscQueue.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenLoco::Audio
+{
+    // Plays a wave file through a queue of small buffers that a decoder thread keeps filled,
+    // so only a fixed amount of the file is ever held in memory.
+    class MusicStream
+    {
+    public:
+        struct Format
+        {
+            uint32_t sampleRate{};
+            uint16_t channels{};
+            uint16_t bits{};
+            size_t dataOffset{};
+            size_t dataLength{};
+        };
+
+    private:
+        static constexpr size_t kChunkSize = 32 * 1024;
+        static constexpr size_t kNumBuffers = 4;
+        // Twice the buffers so the decoder can read ahead while all buffers are queued
+        static constexpr size_t kNumChunks = kNumBuffers * 2;
+
+        struct Chunk
+        {
+            std::array<uint8_t, kChunkSize> data;
+            size_t length;
+            bool isLast;
+        };
+
+        OpenAL::Source _source;
+        FileStream _file;
+        Format _format;
+        bool _loop = false;
+
+        std::unique_ptr<Chunk[]> _chunks = std::make_unique<Chunk[]>(kNumChunks);
+        // Chunks handed to the decoder to be filled and the filled chunks handed back
+        Core::SpscQueue<uint8_t, kNumChunks> _freeChunks;
+        Core::SpscQueue<uint8_t, kNumChunks> _filledChunks;
+
+        std::thread _decoder;
+        std::atomic<bool> _stopRequested{};
+        std::mutex _wakeMutex;
+        std::condition_variable _wakeDecoder;
+
+        std::array<uint32_t, kNumBuffers> _buffers{};
+        std::vector<uint32_t> _freeBuffers;
+        bool _isStarted = false;
+        bool _isPaused = false;
+        bool _hasQueuedLast = false;
+
+        void decode();
+        void readChunk(Chunk& chunk, size_t& remaining);
+
+    public:
+        // Throws if the file isn't a PCM wave file.
+        MusicStream(OpenAL::Source source, const fs::path& path);
+        ~MusicStream();
+
+        MusicStream(const MusicStream&) = delete;
+        MusicStream& operator=(const MusicStream&) = delete;
+
+        void play(bool loop);
+        void pause();
+        void unpause();
+        // Called every frame to queue the decoded chunks.
+        void update();
+        // Whether the whole file has been played, never the case when looping.
+        bool isFinished() const;
+        bool isPaused() const { return _isPaused; }
+        const Format& getFormat() const { return _format; }
+    };
+}
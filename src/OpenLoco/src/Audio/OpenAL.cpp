@@ -1,8 +1,14 @@
 #include "OpenAL.h"
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <OpenLoco/Core/SpscQueue.hpp>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace OpenAL
 {
@@ -84,55 +90,345 @@ namespace OpenAL
         // close();
     }
 
+    enum class PlayState : uint8_t
+    {
+        stopped,
+        playing,
+        paused,
+    };
+
+    // The play state as seen by the game thread, packed with a generation that the game thread
+    // bumps on every change so the command thread only writes a state when nothing is pending.
+    static constexpr uint32_t packPlayState(uint32_t generation, PlayState state)
+    {
+        return (generation << 8) | static_cast<uint32_t>(state);
+    }
+
+    static constexpr uint32_t getGeneration(uint32_t packed)
+    {
+        return packed >> 8;
+    }
+
+    static constexpr PlayState getPlayState(uint32_t packed)
+    {
+        return static_cast<PlayState>(packed & 0xFF);
+    }
+
+    struct SourceState
+    {
+        uint32_t id{};
+        std::atomic<uint32_t> playState{};
+
+        // Only used by the command thread
+        uint32_t executedGeneration{};
+        float gain = 1.0f;
+        float targetGain = 1.0f;
+    };
+
+    enum class CommandType : uint8_t
+    {
+        play,
+        pause,
+        stop,
+        setBuffer,
+        queueBuffer,
+        setPitch,
+        setGain,
+        setPan,
+        setLooping,
+    };
+
+    struct Command
+    {
+        CommandType type{};
+        SourceState* source{};
+        uint32_t generation{};
+        uint32_t buffer{};
+        float value{};
+    };
+
+    // Roughly how long a gain change takes, short enough to follow a moving vehicle
+    static constexpr auto kGainSmoothingTime = std::chrono::milliseconds(40);
+    static constexpr auto kCommandThreadPeriod = std::chrono::milliseconds(5);
+    static constexpr size_t kCommandQueueSize = 1024;
+
+    static OpenLoco::Core::SpscQueue<Command, kCommandQueueSize> _commands;
+    static std::thread _commandThread;
+    static std::atomic<bool> _isCommandThreadRunning{};
+    static std::mutex _wakeMutex;
+    static std::condition_variable _wakeCommandThread;
+    static std::atomic<uint64_t> _numCommandsPosted{};
+    static std::atomic<uint64_t> _numCommandsExecuted{};
+
+    // Sources whose play state the command thread keeps up to date
+    static std::mutex _sourcesMutex;
+    static std::vector<SourceState*> _polledSources;
+
+    static void applyPan(uint32_t id, float value)
+    {
+        alSourcef(id, AL_ROLLOFF_FACTOR, 0.0f);
+        alSourcei(id, AL_SOURCE_RELATIVE, AL_TRUE);
+        alSource3f(id, AL_POSITION, value, 0.0f, -std::sqrt(1.0f - value * value));
+    }
+
+    static void executeCommand(const Command& command)
+    {
+        auto& source = *command.source;
+        const auto id = source.id;
+        switch (command.type)
+        {
+            case CommandType::play:
+                alSourcePlay(id);
+                break;
+            case CommandType::pause:
+                alSourcePause(id);
+                break;
+            case CommandType::stop:
+                alSourceStop(id);
+                break;
+            case CommandType::setBuffer:
+                alSourcei(id, AL_BUFFER, command.buffer);
+                break;
+            case CommandType::queueBuffer:
+                alSourceQueueBuffers(id, 1, &command.buffer);
+                break;
+            case CommandType::setPitch:
+                alSourcef(id, AL_PITCH, command.value);
+                break;
+            case CommandType::setGain:
+            {
+                // Only smooth the gain of a source that is heard, otherwise it starts at the new gain
+                int32_t state = AL_STOPPED;
+                alGetSourcei(id, AL_SOURCE_STATE, &state);
+                source.targetGain = command.value;
+                if (state != AL_PLAYING)
+                {
+                    source.gain = command.value;
+                    alSourcef(id, AL_GAIN, command.value);
+                }
+                break;
+            }
+            case CommandType::setPan:
+                applyPan(id, command.value);
+                break;
+            case CommandType::setLooping:
+                alSourcei(id, AL_LOOPING, command.buffer != 0 ? AL_TRUE : AL_FALSE);
+                break;
+        }
+        source.executedGeneration = command.generation;
+    }
+
+    static void updateSources(float smoothing)
+    {
+        std::lock_guard lock(_sourcesMutex);
+        for (auto* source : _polledSources)
+        {
+            if (source->gain != source->targetGain)
+            {
+                source->gain += (source->targetGain - source->gain) * smoothing;
+                if (std::abs(source->targetGain - source->gain) < 0.001f)
+                {
+                    source->gain = source->targetGain;
+                }
+                alSourcef(source->id, AL_GAIN, source->gain);
+            }
+
+            // A source stops by itself at the end of its buffers
+            auto packed = source->playState.load(std::memory_order_acquire);
+            if (getPlayState(packed) != PlayState::playing || getGeneration(packed) != source->executedGeneration)
+            {
+                continue;
+            }
+            int32_t state = AL_PLAYING;
+            alGetSourcei(source->id, AL_SOURCE_STATE, &state);
+            if (state != AL_PLAYING && state != AL_PAUSED)
+            {
+                // Fails if the game thread changed the state meanwhile
+                source->playState.compare_exchange_strong(packed, packPlayState(getGeneration(packed), PlayState::stopped), std::memory_order_acq_rel);
+            }
+        }
+    }
+
+    static void runCommandThread()
+    {
+        auto lastUpdate = std::chrono::steady_clock::now();
+        while (true)
+        {
+            while (auto command = _commands.tryPop())
+            {
+                executeCommand(*command);
+                _numCommandsExecuted.fetch_add(1, std::memory_order_release);
+            }
+            if (!_isCommandThreadRunning)
+            {
+                break;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            const auto elapsed = std::chrono::duration<float>(now - lastUpdate) / kGainSmoothingTime;
+            lastUpdate = now;
+            updateSources(std::min(elapsed, 1.0f));
+
+            std::unique_lock lock(_wakeMutex);
+            _wakeCommandThread.wait_for(lock, kCommandThreadPeriod, []() { return !_commands.empty() || !_isCommandThreadRunning; });
+        }
+    }
+
+    void startCommandThread()
+    {
+        if (_isCommandThreadRunning)
+        {
+            return;
+        }
+        _isCommandThreadRunning = true;
+        _commandThread = std::thread(runCommandThread);
+    }
+
+    void stopCommandThread()
+    {
+        if (!_isCommandThreadRunning)
+        {
+            return;
+        }
+        {
+            std::lock_guard lock(_wakeMutex);
+            _isCommandThreadRunning = false;
+        }
+        _wakeCommandThread.notify_one();
+        _commandThread.join();
+    }
+
+    void flushCommands()
+    {
+        if (!_isCommandThreadRunning)
+        {
+            return;
+        }
+        const auto numPosted = _numCommandsPosted.load(std::memory_order_relaxed);
+        _wakeCommandThread.notify_one();
+        while (_numCommandsExecuted.load(std::memory_order_acquire) < numPosted)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Sets the play state the source will have once the command has run
+    static uint32_t setExpectedPlayState(SourceState& source, PlayState state)
+    {
+        const auto generation = getGeneration(source.playState.load(std::memory_order_relaxed)) + 1;
+        source.playState.store(packPlayState(generation, state), std::memory_order_release);
+        return generation;
+    }
+
+    static void postCommand(SourceState& source, Command command)
+    {
+        command.source = &source;
+        if (command.generation == 0)
+        {
+            command.generation = getGeneration(source.playState.load(std::memory_order_relaxed));
+        }
+
+        if (!_isCommandThreadRunning)
+        {
+            executeCommand(command);
+            return;
+        }
+
+        while (!_commands.tryPush(command))
+        {
+            // The command thread is behind, give it a chance to catch up
+            _wakeCommandThread.notify_one();
+            std::this_thread::yield();
+        }
+        _numCommandsPosted.fetch_add(1, std::memory_order_relaxed);
+        _wakeCommandThread.notify_one();
+    }
+
     void Source::pause()
     {
-        alSourcePause(_id);
+        const auto state = getPlayState(_state->playState.load(std::memory_order_relaxed));
+        // Pausing a source that isn't playing leaves it as it is
+        const auto generation = setExpectedPlayState(*_state, state == PlayState::playing ? PlayState::paused : state);
+        postCommand(*_state, { CommandType::pause, nullptr, generation });
     }
 
     void Source::play()
     {
-        alSourcePlay(_id);
+        const auto generation = setExpectedPlayState(*_state, PlayState::playing);
+        postCommand(*_state, { CommandType::play, nullptr, generation });
     }
 
     void Source::stop()
     {
-        alSourceStop(_id);
+        const auto generation = setExpectedPlayState(*_state, PlayState::stopped);
+        postCommand(*_state, { CommandType::stop, nullptr, generation });
     }
 
     void Source::setBuffer(uint32_t bufferId)
     {
-        alSourcei(_id, AL_BUFFER, bufferId);
+        // Setting the buffer stops the source
+        const auto generation = setExpectedPlayState(*_state, PlayState::stopped);
+        postCommand(*_state, { CommandType::setBuffer, nullptr, generation, bufferId });
     }
 
     void Source::setPitch(float value)
     {
-        alSourcef(_id, AL_PITCH, value);
+        postCommand(*_state, { CommandType::setPitch, nullptr, 0, 0, value });
     }
 
     void Source::setGain(float value)
     {
-        alSourcef(_id, AL_GAIN, value);
+        postCommand(*_state, { CommandType::setGain, nullptr, 0, 0, value });
     }
 
     void Source::setPosition(float x, float y, float z)
     {
+        flushCommands();
         alSource3f(_id, AL_POSITION, x, y, z);
     }
 
     void Source::setPan(float value)
     {
-        alSourcef(_id, AL_ROLLOFF_FACTOR, 0.0f);
-        alSourcei(_id, AL_SOURCE_RELATIVE, AL_TRUE);
-        alSource3f(_id, AL_POSITION, value, 0.0f, -std::sqrt(1.0f - value * value));
+        postCommand(*_state, { CommandType::setPan, nullptr, 0, 0, value });
     }
 
     void Source::setLooping(bool value)
     {
-        alSourcei(_id, AL_LOOPING, value ? AL_TRUE : AL_FALSE);
+        postCommand(*_state, { CommandType::setLooping, nullptr, 0, value ? 1U : 0U });
+    }
+
+    void Source::queueBuffer(uint32_t bufferId)
+    {
+        alSourceQueueBuffers(_id, 1, &bufferId);
+    }
+
+    uint32_t Source::unqueueBuffer()
+    {
+        uint32_t bufferId = 0;
+        alSourceUnqueueBuffers(_id, 1, &bufferId);
+        return bufferId;
+    }
+
+    int32_t Source::getNumQueuedBuffers() const
+    {
+        int32_t value = 0;
+        alGetSourcei(_id, AL_BUFFERS_QUEUED, &value);
+        return value;
+    }
+
+    int32_t Source::getNumProcessedBuffers() const
+    {
+        int32_t value = 0;
+        alGetSourcei(_id, AL_BUFFERS_PROCESSED, &value);
+        return value;
     }
 
     bool Source::isPaused() const
     {
+        if (_isCommandThreadRunning)
+        {
+            return getPlayState(_state->playState.load(std::memory_order_acquire)) == PlayState::paused;
+        }
         int32_t value = AL_PAUSED;
         alGetSourcei(_id, AL_SOURCE_STATE, &value);
         return value == AL_PAUSED;
@@ -140,6 +436,10 @@ namespace OpenAL
 
     bool Source::isPlaying() const
     {
+        if (_isCommandThreadRunning)
+        {
+            return getPlayState(_state->playState.load(std::memory_order_acquire)) == PlayState::playing;
+        }
         int32_t value = AL_PLAYING;
         alGetSourcei(_id, AL_SOURCE_STATE, &value);
         return value == AL_PLAYING;
@@ -164,16 +464,22 @@ namespace OpenAL
         return pan / kRange;
     }
 
-    BufferManager::~BufferManager()
+    uint32_t generateBuffer()
     {
-        dispose();
+        uint32_t id = 0;
+        alGenBuffers(1, &id);
+        return id;
     }
 
-    uint32_t BufferManager::allocate(std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits)
+    void deleteBuffer(uint32_t id)
+    {
+        // A posted command may still reference the buffer
+        flushCommands();
+        alDeleteBuffers(1, &id);
+    }
+
+    void setBufferData(uint32_t id, std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits)
     {
-        uint32_t id = 0;
-        alGenBuffers(1, &id);
-        _buffers.push_back(id);
         uint32_t format = 0;
         if (stereo)
         {
@@ -198,21 +504,48 @@ namespace OpenAL
             }
         }
         alBufferData(id, format, data.data(), data.size(), sampleRate);
+    }
+
+    BufferManager::~BufferManager()
+    {
+        dispose();
+    }
+
+    uint32_t BufferManager::allocate(std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits)
+    {
+        const auto id = generateBuffer();
+        _buffers.push_back(id);
+        _bufferSizes.push_back(data.size());
+        _memoryUsage += data.size();
+        setBufferData(id, data, sampleRate, stereo, bits);
         return id;
     }
 
     void BufferManager::deAllocate(uint32_t id)
     {
+        flushCommands();
         alDeleteBuffers(1, &id);
-        _buffers.erase(std::remove(std::begin(_buffers), std::end(_buffers), id));
+        auto it = std::find(std::begin(_buffers), std::end(_buffers), id);
+        if (it != std::end(_buffers))
+        {
+            const auto index = std::distance(std::begin(_buffers), it);
+            _memoryUsage -= _bufferSizes[index];
+            _bufferSizes.erase(std::begin(_bufferSizes) + index);
+            _buffers.erase(it);
+        }
     }
 
     void BufferManager::dispose()
     {
+        flushCommands();
         alDeleteBuffers(_buffers.size(), _buffers.data());
         _buffers.clear();
+        _bufferSizes.clear();
+        _memoryUsage = 0;
     }
 
+    SourceManager::SourceManager() = default;
+
     SourceManager::~SourceManager()
     {
         dispose();
@@ -220,22 +553,41 @@ namespace OpenAL
 
     Source SourceManager::allocate()
     {
-        uint32_t id = 0;
-        alGenSources(1, &id);
-        _sources.push_back(id);
-        return Source(id);
+        auto state = std::make_unique<SourceState>();
+        alGenSources(1, &state->id);
+
+        auto* statePtr = state.get();
+        _sources.push_back(std::move(state));
+        {
+            std::lock_guard lock(_sourcesMutex);
+            _polledSources.push_back(statePtr);
+        }
+        return Source(statePtr->id, statePtr);
     }
 
     void SourceManager::deAllocate(const Source& source)
     {
+        flushCommands();
+
         const auto id = source.getId();
+        {
+            std::lock_guard lock(_sourcesMutex);
+            _polledSources.erase(std::remove_if(std::begin(_polledSources), std::end(_polledSources), [id](const SourceState* state) { return state->id == id; }), std::end(_polledSources));
+        }
         alDeleteSources(1, &id);
-        _sources.erase(std::remove(std::begin(_sources), std::end(_sources), id));
+        _sources.erase(std::remove_if(std::begin(_sources), std::end(_sources), [id](const auto& state) { return state->id == id; }), std::end(_sources));
     }
 
     void SourceManager::dispose()
     {
-        alDeleteSources(_sources.size(), _sources.data());
+        flushCommands();
+
+        std::lock_guard lock(_sourcesMutex);
+        for (auto& state : _sources)
+        {
+            _polledSources.erase(std::remove(std::begin(_polledSources), std::end(_polledSources), state.get()), std::end(_polledSources));
+            alDeleteSources(1, &state->id);
+        }
         _sources.clear();
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <AL/alc.h>
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <vector>
@@ -9,14 +11,20 @@
 
 namespace OpenAL
 {
+    struct SourceState;
+
+    // Changes to a source are posted to the command thread once it is started, the state of the
+    // source is then read from a copy the command thread keeps up to date.
     class Source
     {
     private:
         uint32_t _id;
+        SourceState* _state;
 
     public:
-        Source(uint32_t id)
+        Source(uint32_t id, SourceState* state)
             : _id(id)
+            , _state(state)
         {
         }
 
@@ -32,6 +40,12 @@ namespace OpenAL
         // value to be of the range -0.5f -> 0.5f
         void setPan(float value);
         void setLooping(bool value);
+        // For streaming, the buffers are played one after the other. Unlike the other calls the
+        // queue is read and unqueued from right away.
+        void queueBuffer(uint32_t bufferId);
+        uint32_t unqueueBuffer();
+        int32_t getNumQueuedBuffers() const;
+        int32_t getNumProcessedBuffers() const;
         bool isPaused() const;
         bool isPlaying() const;
         uint32_t getId() const { return _id; }
@@ -68,25 +82,42 @@ namespace OpenAL
     class BufferManager
     {
         std::vector<uint32_t> _buffers;
+        std::vector<size_t> _bufferSizes;
+        std::atomic<size_t> _memoryUsage{};
 
     public:
         ~BufferManager();
         uint32_t allocate(std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits);
         void deAllocate(uint32_t id);
         void dispose();
+        // Bytes of sample data uploaded to the buffers, kept by the driver.
+        size_t getMemoryUsage() const { return _memoryUsage.load(std::memory_order_relaxed); }
     };
 
     class SourceManager
     {
-        std::vector<uint32_t> _sources;
+        std::vector<std::unique_ptr<SourceState>> _sources;
 
     public:
+        SourceManager();
         ~SourceManager();
         Source allocate();
         void deAllocate(const Source& source);
         void dispose();
     };
 
+    // Runs the calls that change sources on a thread of its own, which also smooths gain changes.
+    // This keeps the driver off the game thread, until it is started the calls are made right away.
+    void startCommandThread();
+    void stopCommandThread();
+    // Waits until the posted commands have been run, needed before deleting buffers or sources.
+    void flushCommands();
+
+    // Buffers whose data is replaced while streaming, these are not owned by the BufferManager.
+    uint32_t generateBuffer();
+    void deleteBuffer(uint32_t id);
+    void setBufferData(uint32_t id, std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits);
+
     float volumeFromLoco(int32_t volume);
     float freqFromLoco(int32_t freq);
     float panFromLoco(int32_t pan);
@@ -1,6 +1,7 @@
 #pragma once
 #include "Audio.h"
 #include "Channel.h"
+#include <utility>
 
 namespace OpenLoco::Audio
 {
@@ -12,8 +13,8 @@ namespace OpenLoco::Audio
         SoundId _soundId{};
 
     public:
-        VehicleChannel(const Channel& channel)
-            : _channel(channel)
+        VehicleChannel(Channel&& channel)
+            : _channel(std::move(channel))
         {
         }
 
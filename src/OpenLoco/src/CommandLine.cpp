@@ -1,13 +1,25 @@
 #include "CommandLine.h"
 #include "GameSaveCompare.h"
 #include "GameState.h"
+#include "MemoryAccounting.h"
 #include "OpenLoco.h"
+#include "Paint/PaintBenchmark.h"
+#include "S5/CompressedSave.h"
+#include "S5/DeltaSave.h"
 #include "S5/S5.h"
 #include "S5/SawyerStream.h"
+#include "StressWorld.h"
+#include "TickProfiler.h"
+#include "World/CompanyAi/CompanyAi.h"
 #include <OpenLoco/Core/MemoryStream.h>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Platform/Platform.h>
+#include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <fmt/chrono.h>
+#include <fmt/os.h>
 #include <iostream>
 #include <optional>
 #include <stdlib.h>
@@ -22,7 +34,12 @@ namespace OpenLoco
 
     static int uncompressFile(const CommandLineOptions& options);
     static int simulate(const CommandLineOptions& options);
+    static int replay(const CommandLineOptions& options);
+    static int paintBenchmark(const CommandLineOptions& options);
+    static int saveBenchmark(const CommandLineOptions& options);
     static int compare(const CommandLineOptions& options);
+    static int rebuild(const CommandLineOptions& options);
+    static int stressWorld(const CommandLineOptions& options);
 
     const CommandLineOptions& getCommandLineOptions()
     {
@@ -302,14 +319,29 @@ namespace OpenLoco
     {
         auto parser = CommandLineParser(argv)
                           .registerOption("--bind", 1)
+                          .registerOption("--headless")
+                          .registerOption("--spectate")
+                          .registerOption("--upstream_port", 1)
                           .registerOption("--port", "-p", 1)
+                          .registerOption("--state_hash", 1)
+                          .registerOption("--network_stats", 1)
+                          .registerOption("--record", 1)
+                          .registerOption("--record_input", 1)
+                          .registerOption("--play_input", 1)
+                          .registerOption("--trace", 1)
+                          .registerOption("--startup_profile")
+                          .registerOption("--telemetry", 1)
+                          .registerOption("--telemetry_days", 1)
                           .registerOption("-o", 1)
                           .registerOption("--help", "-h")
                           .registerOption("--version")
                           .registerOption("--intro")
                           .registerOption("--log_levels", 1)
                           .registerOption("--all", "-a")
-                          .registerOption("--locomotion_path", 1);
+                          .registerOption("--locomotion_path", 1)
+                          .registerOption("--benchmark", 1)
+                          .registerOption("--warmup", 1)
+                          .registerOption("--checkpoint", 1);
 
         if (!parser.parse())
         {
@@ -343,6 +375,11 @@ namespace OpenLoco
                 options.action = CommandLineAction::join;
                 options.address = parser.getArg(1);
             }
+            else if (firstArg == "relay")
+            {
+                options.action = CommandLineAction::relay;
+                options.address = parser.getArg(1);
+            }
             else if (firstArg == "uncompress")
             {
                 options.action = CommandLineAction::uncompress;
@@ -355,6 +392,42 @@ namespace OpenLoco
                 options.ticks = parser.getArg<int32_t>(2);
                 options.path2 = parser.getArg(3);
             }
+            else if (firstArg == "replay")
+            {
+                options.action = CommandLineAction::replay;
+                options.path = parser.getArg(1);
+                options.logPath = parser.getArg(2);
+                options.path2 = parser.getArg(3);
+            }
+            else if (firstArg == "paintbench")
+            {
+                options.action = CommandLineAction::paintBenchmark;
+                options.path = parser.getArg(1);
+                options.iterations = parser.getArg<int32_t>(2);
+            }
+            else if (firstArg == "savebench")
+            {
+                options.action = CommandLineAction::saveBenchmark;
+                options.path = parser.getArg(1);
+                options.iterations = parser.getArg<int32_t>(2);
+            }
+            else if (firstArg == "rebuild")
+            {
+                options.action = CommandLineAction::rebuild;
+                options.path = parser.getArg(1);
+                for (size_t i = 2; !parser.getArg(i).empty(); i++)
+                {
+                    options.deltaPaths.emplace_back(parser.getArg(i));
+                }
+            }
+            else if (firstArg == "stressgen")
+            {
+                options.action = CommandLineAction::stressWorld;
+                options.path = parser.getArg(1);
+                options.numLines = parser.getArg<int32_t>(2);
+                options.sectionsPerLine = parser.getArg<int32_t>(3);
+                options.sectionLength = parser.getArg<int32_t>(4);
+            }
             else if (firstArg == "compare")
             {
                 options.action = CommandLineAction::compare;
@@ -377,12 +450,24 @@ namespace OpenLoco
         }
 
         options.bind = parser.getArg("--bind");
+        options.headless = parser.hasOption("--headless");
+        options.spectate = parser.hasOption("--spectate");
         options.port = parser.getArg<int32_t>("--port");
         if (!options.port)
         {
             options.port = parser.getArg<int32_t>("-p");
         }
+        options.upstreamPort = parser.getArg<int32_t>("--upstream_port");
+        options.stateHashInterval = parser.getArg<int32_t>("--state_hash");
+        options.networkStatsInterval = parser.getArg<int32_t>("--network_stats");
         options.outputPath = parser.getArg("-o");
+        options.recordPath = parser.getArg("--record");
+        options.recordInputPath = parser.getArg("--record_input");
+        options.playInputPath = parser.getArg("--play_input");
+        options.tracePath = parser.getArg("--trace");
+        options.startupProfile = parser.hasOption("--startup_profile");
+        options.telemetryPath = parser.getArg("--telemetry");
+        options.telemetryInterval = parser.getArg<int32_t>("--telemetry_days");
 
         if (parser.hasOption("--log_levels"))
         {
@@ -398,6 +483,10 @@ namespace OpenLoco
             options.locomotionDataPath = parser.getArg("--locomotion_path");
         }
 
+        options.benchmarkPath = parser.getArg("--benchmark");
+        options.warmupTicks = parser.getArg<int32_t>("--warmup");
+        options.checkpointInterval = parser.getArg<int32_t>("--checkpoint");
+
         return options;
     }
 
@@ -412,13 +501,37 @@ namespace OpenLoco
         std::cout << "usage: openloco [options] [path]" << std::endl;
         std::cout << "                host [options] <path>" << std::endl;
         std::cout << "                join [options] <address>" << std::endl;
+        std::cout << "                relay [options] <address>" << std::endl;
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks> [path]" << std::endl;
+        std::cout << "                replay [options] <path> <log> [path]" << std::endl;
         std::cout << "                compare [options] <path1> <path2>" << std::endl;
+        std::cout << "                paintbench [options] <path> <iterations>" << std::endl;
+        std::cout << "                savebench [options] <path> <iterations>" << std::endl;
+        std::cout << "                rebuild [options] <base> <delta>..." << std::endl;
+        std::cout << "                stressgen [options] <scenario> <lines> <sections> <length>" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind                     Address to bind to when hosting a server" << std::endl;
-        std::cout << "--port               -p     Port number for the server" << std::endl;
+        std::cout << "--port               -p     Port number for the server, or that a relay listens on" << std::endl;
+        std::cout << "--upstream_port             For relay, port number of the server to relay" << std::endl;
+        std::cout << "--spectate                  When joining, watch the game without being able to play" << std::endl;
+        std::cout << "--headless                  When hosting or relaying, run a dedicated server without a window," << std::endl;
+        std::cout << "                            graphics or audio" << std::endl;
+        std::cout << "--state_hash                When hosting, hash the game state every n ticks so clients" << std::endl;
+        std::cout << "                            can detect a desync" << std::endl;
+        std::cout << "--network_stats             When hosting or joining, log the network stats every n seconds" << std::endl;
+        std::cout << "--record                    When loading a save, record the game commands to the given log" << std::endl;
+        std::cout << "                            which can be replayed against the save with replay" << std::endl;
+        std::cout << "--record_input              When loading a save, record the mouse and keyboard input to the given path" << std::endl;
+        std::cout << "--play_input                When loading a save, play back input recorded with --record_input as fast" << std::endl;
+        std::cout << "                            as possible, then report the frame times and exit" << std::endl;
+        std::cout << "--trace                     Capture a timeline of the run and write it as a Chrome trace to the" << std::endl;
+        std::cout << "                            given path on exit, it can be opened in ui.perfetto.dev" << std::endl;
+        std::cout << "--startup_profile           Log how long each phase of starting the game took" << std::endl;
+        std::cout << "--telemetry                 Append a JSON line with the performance of the game to the given path" << std::endl;
+        std::cout << "                            every 30 game days, or the amount given with --telemetry_days" << std::endl;
+        std::cout << "--telemetry_days            Game days between the records written with --telemetry" << std::endl;
         std::cout << "                     -o     Output path" << std::endl;
         std::cout << "--help               -h     Print help" << std::endl;
         std::cout << "--version                   Print version" << std::endl;
@@ -430,6 +543,10 @@ namespace OpenLoco
         std::cout << "                              Default: \"info, warning, error\"" << std::endl;
         std::cout << "--all                -a     For compare, print out all divergences" << std::endl;
         std::cout << "--locomotion_path           Overrides the path to Locomotion install." << std::endl;
+        std::cout << "--benchmark                 For simulate, paintbench, savebench and --play_input, write benchmark results" << std::endl;
+        std::cout << "                            as JSON to the given path, use '-' to write to stdout" << std::endl;
+        std::cout << "--warmup                    For simulate, number of ticks to run before measuring" << std::endl;
+        std::cout << "--checkpoint                For simulate, write a delta save every n ticks next to the output path" << std::endl;
     }
 
     std::optional<int> runCommandLineOnlyCommand(const CommandLineOptions& options)
@@ -446,8 +563,18 @@ namespace OpenLoco
                 return uncompressFile(options);
             case CommandLineAction::simulate:
                 return simulate(options);
+            case CommandLineAction::replay:
+                return replay(options);
             case CommandLineAction::compare:
                 return compare(options);
+            case CommandLineAction::paintBenchmark:
+                return paintBenchmark(options);
+            case CommandLineAction::saveBenchmark:
+                return saveBenchmark(options);
+            case CommandLineAction::rebuild:
+                return rebuild(options);
+            case CommandLineAction::stressWorld:
+                return stressWorld(options);
             default:
                 return std::nullopt;
         }
@@ -540,6 +667,337 @@ namespace OpenLoco
         }
     }
 
+    static std::string formatBenchmarkResults(const CommandLineOptions& options, float elapsedMs)
+    {
+        const auto ticks = *options.ticks;
+        const auto ticksPerSecond = elapsedMs > 0.0f ? (ticks * 1000.0 / elapsedMs) : 0.0;
+
+        std::string json = "{\n";
+        json += fmt::format("  \"version\": \"{}\",\n", getVersionInfo());
+        json += fmt::format("  \"path\": \"{}\",\n", Utility::escapeJson(options.path));
+        json += fmt::format("  \"warmupTicks\": {},\n", options.warmupTicks.value_or(0));
+        json += fmt::format("  \"ticks\": {},\n", ticks);
+        json += fmt::format("  \"wallTimeMs\": {:.3f},\n", elapsedMs);
+        json += fmt::format("  \"ticksPerSecond\": {:.3f},\n", ticksPerSecond);
+        json += fmt::format("  \"peakMemoryBytes\": {},\n", Platform::getPeakMemoryUsage());
+        json += "  \"subsystems\": {\n";
+        for (size_t i = 0; i < TickProfiler::kSubsystemCount; i++)
+        {
+            const auto subsystem = static_cast<TickProfiler::Subsystem>(i);
+            const auto totals = TickProfiler::getTotals(subsystem);
+            const auto avgMs = totals.numTicks > 0 ? totals.totalMs / totals.numTicks : 0.0;
+
+            json += fmt::format(
+                "    \"{}\": {{ \"totalMs\": {:.3f}, \"avgMs\": {:.4f}, \"maxMs\": {:.4f} }}{}\n",
+                TickProfiler::getName(subsystem),
+                totals.totalMs,
+                avgMs,
+                totals.maxMs,
+                i + 1 < TickProfiler::kSubsystemCount ? "," : "");
+        }
+        json += "  },\n";
+        json += "  \"memory\": {\n";
+        for (size_t i = 0; i < MemoryAccounting::kCategoryCount; i++)
+        {
+            const auto category = static_cast<MemoryAccounting::Category>(i);
+            const auto usage = MemoryAccounting::getUsage(category);
+            json += fmt::format(
+                "    \"{}\": {{ \"currentBytes\": {}, \"peakBytes\": {} }},\n",
+                MemoryAccounting::getName(category),
+                usage.current,
+                usage.peak);
+        }
+        const auto totalUsage = MemoryAccounting::getTotalUsage();
+        json += fmt::format("    \"Total\": {{ \"currentBytes\": {}, \"peakBytes\": {} }}\n", totalUsage.current, totalUsage.peak);
+        json += "  },\n";
+        json += "  \"aiThinkStates\": {\n";
+        for (size_t i = 0; i < kAiThinkStateCount; i++)
+        {
+            const auto stats = getAiThinkStateStats(static_cast<AiThinkState>(i));
+            const auto avgMs = stats.numCalls > 0 ? stats.totalMs / stats.numCalls : 0.0;
+
+            json += fmt::format(
+                "    \"{}\": {{ \"calls\": {}, \"commands\": {}, \"totalMs\": {:.3f}, \"avgMs\": {:.4f}, \"maxMs\": {:.4f} }}{}\n",
+                i,
+                stats.numCalls,
+                stats.numCommands,
+                stats.totalMs,
+                avgMs,
+                stats.maxMs,
+                i + 1 < kAiThinkStateCount ? "," : "");
+        }
+        json += "  }\n";
+        json += "}\n";
+        return json;
+    }
+
+    static bool writeBenchmarkJson(const CommandLineOptions& options, const std::string& json)
+    {
+        if (options.benchmarkPath == "-")
+        {
+            std::cout << json;
+            return true;
+        }
+
+        try
+        {
+            auto file = fmt::output_file(options.benchmarkPath);
+            file.print("{}", json);
+            Logging::info("Benchmark results written to {}", options.benchmarkPath);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to write benchmark results to {}: {}", options.benchmarkPath, e.what());
+            return false;
+        }
+    }
+
+    static bool writeBenchmarkResults(const CommandLineOptions& options, float elapsedMs)
+    {
+        return writeBenchmarkJson(options, formatBenchmarkResults(options, elapsedMs));
+    }
+
+    static std::string formatPaintBenchmarkResults(const CommandLineOptions& options, const std::vector<Paint::Benchmark::ViewResult>& results)
+    {
+        const auto iterations = *options.iterations;
+
+        std::string json = "{\n";
+        json += fmt::format("  \"version\": \"{}\",\n", getVersionInfo());
+        json += fmt::format("  \"path\": \"{}\",\n", Utility::escapeJson(options.path));
+        json += fmt::format("  \"iterations\": {},\n", iterations);
+        json += fmt::format("  \"viewWidth\": {},\n", Paint::Benchmark::kViewWidth);
+        json += fmt::format("  \"viewHeight\": {},\n", Paint::Benchmark::kViewHeight);
+        json += "  \"views\": [\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const auto& result = results[i];
+            json += fmt::format(
+                "    {{ \"x\": {}, \"y\": {}, \"z\": {}, \"rotation\": {}, \"zoom\": {}, \"columns\": {}, "
+                "\"generateMs\": {:.4f}, \"arrangeMs\": {:.4f}, \"drawMs\": {:.4f}, \"paintEntries\": {} }}{}\n",
+                result.view.centre.x,
+                result.view.centre.y,
+                result.view.centre.z,
+                result.view.rotation,
+                result.view.zoomLevel,
+                result.numColumns,
+                result.generateMs / iterations,
+                result.arrangeMs / iterations,
+                result.drawMs / iterations,
+                result.numPaintEntries / iterations,
+                i + 1 < results.size() ? "," : "");
+        }
+        json += "  ]\n";
+        json += "}\n";
+        return json;
+    }
+
+    static int paintBenchmark(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        if (!options.iterations || *options.iterations <= 0)
+        {
+            Logging::error("Number of iterations to paint not specified");
+            return EXIT_FAILURE;
+        }
+
+        const auto inPath = fs::u8path(options.path);
+
+        std::vector<Paint::Benchmark::ViewResult> results;
+        try
+        {
+            results = OpenLoco::benchmarkPaint(inPath, *options.iterations);
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load and paint {}", inPath.u8string());
+            return EXIT_FAILURE;
+        }
+
+        // Times are reported per iteration, summed over all views.
+        double generateMs = 0.0;
+        double arrangeMs = 0.0;
+        double drawMs = 0.0;
+        uint64_t numPaintEntries = 0;
+        for (const auto& result : results)
+        {
+            generateMs += result.generateMs / *options.iterations;
+            arrangeMs += result.arrangeMs / *options.iterations;
+            drawMs += result.drawMs / *options.iterations;
+            numPaintEntries += result.numPaintEntries / *options.iterations;
+        }
+
+        Logging::info("--------------------------------");
+        Logging::info("- Paint benchmark");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path:       {}", inPath.u8string());
+        Logging::info("  views:      {}", results.size());
+        Logging::info("  iterations: {}", *options.iterations);
+        Logging::info("Per iteration:");
+        Logging::info("  generate:      {:.3f} ms", generateMs);
+        Logging::info("  arrange:       {:.3f} ms", arrangeMs);
+        Logging::info("  draw:          {:.3f} ms", drawMs);
+        Logging::info("  paint entries: {}", numPaintEntries);
+
+        if (!options.benchmarkPath.empty() && !writeBenchmarkJson(options, formatPaintBenchmarkResults(options, results)))
+        {
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    struct SaveBenchmarkChunk
+    {
+        SawyerEncoding encoding;
+        std::span<const std::byte> encoded; // As stored in the file, including the chunk header
+        std::vector<std::byte> data;
+    };
+
+    // Splits an S5 file into its chunks, following the same layout as uncompressFile.
+    static std::vector<SaveBenchmarkChunk> readSaveChunks(MemoryStream& ms)
+    {
+        using namespace S5;
+
+        SawyerStreamReader reader(ms);
+        std::vector<SaveBenchmarkChunk> chunks;
+        const auto readChunk = [&]() -> const SaveBenchmarkChunk& {
+            const auto start = ms.getPosition();
+            const auto data = reader.readChunk();
+            const auto encoded = std::span<const std::byte>(ms.data() + start, ms.getPosition() - start);
+            chunks.push_back(SaveBenchmarkChunk{ static_cast<SawyerEncoding>(encoded[0]), encoded, std::vector<std::byte>(data.begin(), data.end()) });
+            return chunks.back();
+        };
+
+        Header header{};
+        const auto& headerChunk = readChunk();
+        std::memcpy(&header, headerChunk.data.data(), std::min(sizeof(header), headerChunk.data.size()));
+
+        if (header.hasFlags(HeaderFlags::hasSaveDetails))
+        {
+            readChunk();
+        }
+
+        for (auto i = 0; i < header.numPackedObjects; i++)
+        {
+            ObjectHeader object;
+            reader.read(&object, sizeof(ObjectHeader));
+            readChunk();
+        }
+
+        if (header.type != S5Type::objects)
+        {
+            // Required objects, game state and tile elements
+            readChunk();
+            readChunk();
+            readChunk();
+        }
+
+        return chunks;
+    }
+
+    static int saveBenchmark(const CommandLineOptions& options)
+    {
+        if (!options.iterations || *options.iterations <= 0)
+        {
+            Logging::error("Number of iterations to encode not specified");
+            return EXIT_FAILURE;
+        }
+
+        const auto inPath = fs::u8path(options.path);
+
+        MemoryStream ms;
+        std::vector<SaveBenchmarkChunk> chunks;
+        try
+        {
+            FileStream fsInput(inPath, StreamMode::read);
+            ms.resize(fsInput.getLength());
+            fsInput.read(ms.data(), fsInput.getLength());
+            chunks = readSaveChunks(ms);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to read S5 file {}: {}", inPath.u8string(), e.what());
+            return EXIT_FAILURE;
+        }
+
+        // Encode every chunk again, the first pass checks the output matches the bytes of the file.
+        size_t numMismatches = 0;
+        size_t dataSize = 0;
+        size_t encodedSize = 0;
+        MemoryStream output;
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+        for (int32_t iteration = 0; iteration < *options.iterations; iteration++)
+        {
+            for (const auto& chunk : chunks)
+            {
+                output.clear();
+                SawyerStreamWriter writer(output);
+                writer.writeChunk(chunk.encoding, chunk.data.data(), chunk.data.size());
+
+                if (iteration == 0)
+                {
+                    dataSize += chunk.data.size();
+                    encodedSize += chunk.encoded.size();
+                    const auto encoded = output.getSpan();
+                    if (!std::ranges::equal(encoded, chunk.encoded))
+                    {
+                        numMismatches++;
+                    }
+                }
+            }
+        }
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+        const auto elapsedMs = std::chrono::duration<double, std::milli>(timeElapsed).count() / *options.iterations;
+        const auto megabytesPerSecond = elapsedMs > 0.0 ? (dataSize / (1024.0 * 1024.0)) / (elapsedMs / 1000.0) : 0.0;
+
+        Logging::info("--------------------------------");
+        Logging::info("- Save benchmark");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path:       {}", inPath.u8string());
+        Logging::info("  chunks:     {}", chunks.size());
+        Logging::info("  data:       {} bytes", dataSize);
+        Logging::info("  encoded:    {} bytes", encodedSize);
+        Logging::info("  iterations: {}", *options.iterations);
+        Logging::info("Per iteration:");
+        Logging::info("  encode:     {:.3f} ms ({:.1f} MiB/s)", elapsedMs, megabytesPerSecond);
+        Logging::info("Chunks differing from the file: {}", numMismatches);
+
+        if (!options.benchmarkPath.empty())
+        {
+            std::string json = "{\n";
+            json += fmt::format("  \"version\": \"{}\",\n", getVersionInfo());
+            json += fmt::format("  \"path\": \"{}\",\n", Utility::escapeJson(options.path));
+            json += fmt::format("  \"iterations\": {},\n", *options.iterations);
+            json += fmt::format("  \"chunks\": {},\n", chunks.size());
+            json += fmt::format("  \"dataBytes\": {},\n", dataSize);
+            json += fmt::format("  \"encodedBytes\": {},\n", encodedSize);
+            json += fmt::format("  \"encodeMs\": {:.4f},\n", elapsedMs);
+            json += fmt::format("  \"mismatchedChunks\": {}\n", numMismatches);
+            json += "}\n";
+            if (!writeBenchmarkJson(options, json))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        return numMismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // For out.SV5 the base checkpoint is out.0.SV5 followed by the deltas out.1.SVD, out.2.SVD and so on.
+    static fs::path getCheckpointPath(const fs::path& outPath, int32_t index)
+    {
+        auto path = outPath;
+        if (index == 0)
+        {
+            return path.replace_extension(fmt::format(".0{}", outPath.extension().u8string()));
+        }
+        return path.replace_extension(fmt::format(".{}{}", index, S5::DeltaSave::extensionSVD));
+    }
+
     static int simulate(const CommandLineOptions& options)
     {
         setCommandLineOptions(options);
@@ -554,11 +1012,42 @@ namespace OpenLoco
         auto outPath = fs::u8path(options.outputPath);
         auto comparePath = fs::u8path(options.path2);
 
+        const auto checkpointInterval = options.checkpointInterval.value_or(0);
+        if (checkpointInterval > 0 && outPath.empty())
+        {
+            Logging::error("Checkpoints require an output path");
+            return EXIT_FAILURE;
+        }
+
+        // The first checkpoint is a full save, each one after is a delta against the one before it
+        int32_t numCheckpoints = 0;
+        S5::DeltaSave::Fingerprint lastCheckpoint;
+        auto writeCheckpoint = [&]() {
+            const auto path = getCheckpointPath(outPath, numCheckpoints);
+            auto snapshot = S5::takeGameStateSnapshot(S5::SaveFlags::none);
+            if (numCheckpoints == 0)
+            {
+                if (!S5::exportSnapshotToFile(path, *snapshot, S5::SaveFlags::none))
+                {
+                    throw Exception::RuntimeError("Unable to write checkpoint");
+                }
+                lastCheckpoint = S5::DeltaSave::getFingerprint(*snapshot);
+            }
+            else
+            {
+                FileStream fs(path, StreamMode::write);
+                lastCheckpoint = S5::DeltaSave::write(fs, *snapshot, lastCheckpoint);
+            }
+            Logging::verbose("Checkpoint written to {}", path.u8string());
+            numCheckpoints++;
+        };
+
         const auto timeStarted = std::chrono::high_resolution_clock::now();
 
+        float simulationMs = 0.0f;
         try
         {
-            OpenLoco::simulateGame(inPath, *options.ticks);
+            simulationMs = OpenLoco::simulateGame(inPath, *options.ticks, options.warmupTicks.value_or(0), checkpointInterval, writeCheckpoint);
         }
         catch (...)
         {
@@ -584,6 +1073,15 @@ namespace OpenLoco
         Logging::info("  scenario ticks: {}", gameState.scenarioTicks);
         Logging::info("  rng:            {{ {}, {} }}", gameState.rng.srand_0(), gameState.rng.srand_1());
         Logging::info("Duration: {:%S} sec", timeElapsed);
+        if (numCheckpoints != 0)
+        {
+            Logging::info("Checkpoints: {}", numCheckpoints);
+        }
+
+        if (!options.benchmarkPath.empty() && !writeBenchmarkResults(options, simulationMs))
+        {
+            return EXIT_FAILURE;
+        }
 
         if (!outPath.empty())
         {
@@ -602,6 +1100,59 @@ namespace OpenLoco
         return EXIT_SUCCESS;
     }
 
+    static int replay(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        if (options.path.empty() || options.logPath.empty())
+        {
+            Logging::error("Unable to replay game commands...");
+            Logging::error("    The save and game command log paths have not been specified.");
+            Logging::error("    replay [options] <path> <log> [path]");
+            return EXIT_FAILURE;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        auto logPath = fs::u8path(options.logPath);
+        auto outPath = fs::u8path(options.outputPath);
+        auto comparePath = fs::u8path(options.path2);
+
+        uint32_t numTicks = 0;
+        try
+        {
+            numTicks = OpenLoco::replayGame(inPath, logPath);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to replay {} on {}: {}", logPath.u8string(), inPath.u8string(), e.what());
+            return EXIT_FAILURE;
+        }
+        Logging::info("Replayed {} ticks", numTicks);
+
+        auto result = EXIT_SUCCESS;
+        if (!comparePath.empty() && !OpenLoco::GameSaveCompare::compareGameStates(comparePath))
+        {
+            Logging::error("Replayed game state differs from {}", comparePath.u8string());
+            result = EXIT_FAILURE;
+        }
+
+        if (!outPath.empty())
+        {
+            try
+            {
+                S5::exportGameStateToFile(outPath, S5::SaveFlags::none);
+                Logging::info("Replayed game saved to {}", outPath.u8string());
+            }
+            catch (...)
+            {
+                Logging::error("Unable to save game to {}", outPath.u8string());
+                return EXIT_FAILURE;
+            }
+        }
+
+        return result;
+    }
+
     static int compare(const CommandLineOptions& options)
     {
         auto file1 = fs::u8path(options.path);
@@ -638,4 +1189,81 @@ namespace OpenLoco
 
         return result;
     }
+
+    // Reconstructs the state of the last delta in the chain and writes it as a full save.
+    static int rebuild(const CommandLineOptions& options)
+    {
+        auto basePath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+        if (basePath.empty() || outPath.empty())
+        {
+            Logging::error("Unable to rebuild save...");
+            Logging::error("    rebuild [options] <base> <delta>... -o <path>");
+            return EXIT_FAILURE;
+        }
+
+        std::vector<fs::path> deltaPaths;
+        for (const auto& deltaPath : options.deltaPaths)
+        {
+            deltaPaths.push_back(fs::u8path(deltaPath));
+        }
+
+        try
+        {
+            auto file = S5::DeltaSave::importChain(basePath, deltaPaths);
+
+            // Keeps any packed objects of the base, which the S5 writer can only take from loaded objects
+            FileStream fs(outPath, StreamMode::write);
+            S5::CompressedSave::write(fs, *file);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to rebuild {}: {}", basePath.u8string(), e.what());
+            return EXIT_FAILURE;
+        }
+
+        Logging::info("Applied {} deltas to {}, written to {}", deltaPaths.size(), basePath.u8string(), outPath.u8string());
+        return EXIT_SUCCESS;
+    }
+
+    // Builds a network of the given size on a flat map generated for the scenario and saves it.
+    static int stressWorld(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        auto scenarioPath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+        if (scenarioPath.empty() || outPath.empty() || !options.numLines || !options.sectionsPerLine || !options.sectionLength)
+        {
+            Logging::error("Unable to generate stress world...");
+            Logging::error("    stressgen [options] <scenario> <lines> <sections> <length> -o <path>");
+            return EXIT_FAILURE;
+        }
+
+        StressWorld::Options stressOptions;
+        stressOptions.numLines = *options.numLines;
+        stressOptions.sectionsPerLine = *options.sectionsPerLine;
+        stressOptions.sectionLength = *options.sectionLength;
+
+        StressWorld::Result result;
+        try
+        {
+            result = OpenLoco::generateStressWorld(scenarioPath, stressOptions);
+            S5::exportGameStateToFile(outPath, S5::SaveFlags::none);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to generate stress world from {}: {}", scenarioPath.u8string(), e.what());
+            return EXIT_FAILURE;
+        }
+
+        Logging::info("Built {} sections with {} track pieces, {} signals, {} station pieces and {} vehicles",
+                      result.numSections,
+                      result.numTrackPieces,
+                      result.numSignals,
+                      result.numStationPieces,
+                      result.numVehicles);
+        Logging::info("Stress world saved to {}", outPath.u8string());
+        return result.numSections > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
 }
@@ -12,9 +12,15 @@ namespace OpenLoco
         none,
         host,
         join,
+        relay,
         uncompress,
         simulate,
+        replay,
+        paintBenchmark,
+        saveBenchmark,
         compare,
+        rebuild,
+        stressWorld,
         help,
         version,
         intro,
@@ -26,10 +32,31 @@ namespace OpenLoco
         std::string address;
         std::string path;
         std::string path2;
+        std::vector<std::string> deltaPaths;
         std::optional<int32_t> ticks;
+        std::optional<int32_t> warmupTicks;
+        std::optional<int32_t> checkpointInterval;
+        std::optional<int32_t> iterations;
+        std::optional<int32_t> numLines;
+        std::optional<int32_t> sectionsPerLine;
+        std::optional<int32_t> sectionLength;
+        std::string benchmarkPath;
         std::string outputPath;
+        std::string logPath;
+        std::string recordPath;
+        std::string recordInputPath;
+        std::string playInputPath;
+        std::string tracePath;
         std::string bind;
+        bool headless = false;
+        bool spectate = false;
+        bool startupProfile = false;
         std::optional<uint16_t> port{};
+        std::optional<uint16_t> upstreamPort{};
+        std::optional<int32_t> stateHashInterval;
+        std::optional<int32_t> networkStatsInterval;
+        std::string telemetryPath;
+        std::optional<int32_t> telemetryInterval;
         std::string logLevels;
         std::string all;
         std::optional<std::string> locomotionDataPath{};
@@ -69,6 +69,7 @@ namespace OpenLoco::Config
             displayConfig.index = displayNode["index"].as<int32_t>(0);
             displayConfig.windowResolution = displayNode["window_resolution"].as<Resolution>(Resolution{ 800, 600 });
             displayConfig.fullscreenResolution = displayNode["fullscreen_resolution"].as<Resolution>(Resolution{ 1920, 1080 });
+            displayConfig.renderDriver = displayNode["render_driver"].as<std::string>("");
         }
 
         // Audio settings
@@ -81,6 +82,7 @@ namespace OpenLoco::Config
             audioConfig.playJukeboxMusic = audioNode["playJukeboxMusic"].as<bool>(true);
             audioConfig.playTitleMusic = audioNode["play_title_music"].as<bool>(true);
             audioConfig.playNewsSounds = audioNode["play_news_sounds"].as<bool>(true);
+            audioConfig.prefetchSounds = audioNode["prefetch_sounds"].as<bool>(false);
             audioConfig.playlist = audioNode["playlist"].as<MusicPlaylistType>(MusicPlaylistType::currentEra);
 
             if (audioNode["customJukebox"])
@@ -116,7 +118,20 @@ namespace OpenLoco::Config
         // Display
         _config.scaleFactor = config["scale_factor"].as<float>(1.0f);
         _config.showFPS = config["showFPS"].as<bool>(false);
+        _config.showFrameTimes = config["showFrameTimes"].as<bool>(false);
+        _config.showNetworkStats = config["showNetworkStats"].as<bool>(false);
         _config.uncapFPS = config["uncapFPS"].as<bool>(false);
+        _config.highResolutionFramePacing = config["highResolutionFramePacing"].as<bool>(false);
+        _config.screenshotCompressionLevel = config["screenshotCompressionLevel"].as<int32_t>(1);
+        _config.viewportPaintThreads = config["viewportPaintThreads"].as<int32_t>(1);
+        _config.jobThreads = config["jobThreads"].as<int32_t>(0);
+        _config.maxPaintEntries = config["maxPaintEntries"].as<int32_t>(64000);
+        _config.flatPaintSorting = config["flatPaintSorting"].as<bool>(false);
+        _config.paintSortingConformanceCheck = config["paintSortingConformanceCheck"].as<bool>(false);
+        _config.cacheStaticTilePaint = config["cacheStaticTilePaint"].as<bool>(false);
+        _config.paintLevelOfDetail = config["paintLevelOfDetail"].as<bool>(false);
+        _config.presentDirtyRegionsOnly = config["presentDirtyRegionsOnly"].as<bool>(false);
+        _config.spriteCacheMemory = config["spriteCacheMemory"].as<int32_t>(0);
 
         // Rendering
         _config.constructionMarker = config["constructionMarker"].as<int32_t>(0);
@@ -160,6 +175,7 @@ namespace OpenLoco::Config
         _config.autosaveAmount = config["autosave_amount"].as<int32_t>(12);
         _config.autosaveFrequency = config["autosave_frequency"].as<int32_t>(1);
         _config.exportObjectsWithSaves = config["exportObjectsWithSaves"].as<bool>(true);
+        _config.compressSaves = config["compressSaves"].as<bool>(false);
 
         // Cheats
         _config.breakdownsDisabled = config["breakdowns_disabled"].as<bool>(false);
@@ -172,6 +188,9 @@ namespace OpenLoco::Config
         _config.townGrowthDisabled = config["townGrowthDisabled"].as<bool>(false);
         _config.trainsReverseAtSignals = config["trainsReverseAtSignals"].as<bool>(false);
         _config.disableStationSizeLimit = config["disableStationSizeLimit"].as<bool>(false);
+        _config.extendedMiscEntityLimit = config["extendedMiscEntityLimit"].as<bool>(false);
+        _config.boundedAiPathfinding = config["boundedAiPathfinding"].as<bool>(false);
+        _config.stationUpdatesPerTick = config["stationUpdatesPerTick"].as<int32_t>(0);
 
         // Preferred owner
         _config.preferredOwnerName = config["preferredOwnerName"].as<std::string>("");
@@ -213,6 +232,14 @@ namespace OpenLoco::Config
         }
         displayNode["window_resolution"] = displayConfig.windowResolution;
         displayNode["fullscreen_resolution"] = displayConfig.fullscreenResolution;
+        if (!displayConfig.renderDriver.empty())
+        {
+            displayNode["render_driver"] = displayConfig.renderDriver;
+        }
+        else
+        {
+            displayNode.remove("render_driver");
+        }
         node["display"] = displayNode;
 
         // Audio
@@ -227,6 +254,7 @@ namespace OpenLoco::Config
         audioNode["playJukeboxMusic"] = audioConfig.playJukeboxMusic;
         audioNode["play_title_music"] = audioConfig.playTitleMusic;
         audioNode["playNewsSounds"] = audioConfig.playNewsSounds;
+        audioNode["prefetch_sounds"] = audioConfig.prefetchSounds;
         audioNode["playlist"] = audioConfig.playlist;
         audioNode["customJukebox"] = audioConfig.customJukebox;
         node["audio"] = audioNode;
@@ -252,7 +280,20 @@ namespace OpenLoco::Config
         // Display
         node["scale_factor"] = _config.scaleFactor;
         node["showFPS"] = _config.showFPS;
+        node["showFrameTimes"] = _config.showFrameTimes;
+        node["showNetworkStats"] = _config.showNetworkStats;
         node["uncapFPS"] = _config.uncapFPS;
+        node["highResolutionFramePacing"] = _config.highResolutionFramePacing;
+        node["screenshotCompressionLevel"] = _config.screenshotCompressionLevel;
+        node["viewportPaintThreads"] = _config.viewportPaintThreads;
+        node["jobThreads"] = _config.jobThreads;
+        node["maxPaintEntries"] = _config.maxPaintEntries;
+        node["flatPaintSorting"] = _config.flatPaintSorting;
+        node["paintSortingConformanceCheck"] = _config.paintSortingConformanceCheck;
+        node["cacheStaticTilePaint"] = _config.cacheStaticTilePaint;
+        node["paintLevelOfDetail"] = _config.paintLevelOfDetail;
+        node["presentDirtyRegionsOnly"] = _config.presentDirtyRegionsOnly;
+        node["spriteCacheMemory"] = _config.spriteCacheMemory;
 
         // Rendering
 
@@ -286,6 +327,7 @@ namespace OpenLoco::Config
         node["autosave_amount"] = _config.autosaveAmount;
         node["autosave_frequency"] = _config.autosaveFrequency;
         node["exportObjectsWithSaves"] = _config.exportObjectsWithSaves;
+        node["compressSaves"] = _config.compressSaves;
 
         // Cheats
         node["breakdowns_disabled"] = _config.breakdownsDisabled;
@@ -298,6 +340,9 @@ namespace OpenLoco::Config
         node["townGrowthDisabled"] = _config.townGrowthDisabled;
         node["trainsReverseAtSignals"] = _config.trainsReverseAtSignals;
         node["disableStationSizeLimit"] = _config.disableStationSizeLimit;
+        node["extendedMiscEntityLimit"] = _config.extendedMiscEntityLimit;
+        node["boundedAiPathfinding"] = _config.boundedAiPathfinding;
+        node["stationUpdatesPerTick"] = _config.stationUpdatesPerTick;
 
         // Preferred owner
         node["preferredOwnerName"] = _config.preferredOwnerName;
@@ -73,6 +73,8 @@ namespace OpenLoco::Config
         int32_t index{};
         Resolution windowResolution = { 800, 600 };
         Resolution fullscreenResolution;
+        // SDL render driver used to present the screen, empty picks the default.
+        std::string renderDriver;
     };
 
     using Playlist = std::array<bool, 29>;
@@ -84,6 +86,8 @@ namespace OpenLoco::Config
         bool playJukeboxMusic = true;
         bool playTitleMusic = true;
         bool playNewsSounds = true;
+        // Reads all sound effects in the background instead of when they are first played.
+        bool prefetchSounds = false;
         MusicPlaylistType playlist;
         Playlist customJukebox;
     };
@@ -118,7 +122,34 @@ namespace OpenLoco::Config
 
         float scaleFactor = 1.0f;
         bool showFPS = false;
+        // Shows frame time percentiles, a breakdown per frame phase and a graph of recent frames below the FPS counter.
+        bool showFrameTimes = false;
+        // Shows packet counters, round trip times and the game command queue while networked.
+        bool showNetworkStats = false;
         bool uncapFPS = false;
+        // Paces capped frames and game ticks with a high resolution clock instead of millisecond polling.
+        bool highResolutionFramePacing = false;
+        // zlib level of screenshots from 0 to 9, the default of 1 encodes several times faster than 6.
+        int32_t screenshotCompressionLevel = 1;
+        // Threads used to paint a viewport in column strips, 0 uses one per hardware thread.
+        int32_t viewportPaintThreads = 1;
+        // Threads of the shared job pool used for loading, saving and map generation, including the
+        // thread that waits on the jobs. 0 uses one per hardware thread.
+        int32_t jobThreads = 0;
+        // Most paint entries a viewport column may use before sprites are dropped, vanilla allowed 4000.
+        int32_t maxPaintEntries = 64000;
+        // Sorts paint structs over flat arrays instead of following the linked paint structs.
+        bool flatPaintSorting = false;
+        // Runs both paint sorting engines and logs when their draw orders differ.
+        bool paintSortingConformanceCheck = false;
+        // Replays the paint calls of tiles with only surfaces and trees instead of working them out again.
+        bool cacheStaticTilePaint = false;
+        // Skips small details such as fences and signals at the zoom levels where they are barely a pixel.
+        bool paintLevelOfDetail = false;
+        // Only converts and uploads the parts of the screen that were rendered since the last frame.
+        bool presentDirtyRegionsOnly = false;
+        // Memory in MiB for keeping RLE images decoded as bitmaps, 0 disables the cache.
+        int32_t spriteCacheMemory = 0;
 
         uint8_t constructionMarker;
         bool gridlinesOnLandscape = false;
@@ -138,6 +169,8 @@ namespace OpenLoco::Config
         int32_t autosaveAmount = 12;
         int32_t autosaveFrequency = 1;
         bool exportObjectsWithSaves = true;
+        // Saved games use the compressed container, these can't be opened by vanilla Locomotion.
+        bool compressSaves = false;
 
         bool breakdownsDisabled = false;
         bool buildLockedVehicles = false;
@@ -149,6 +182,10 @@ namespace OpenLoco::Config
         bool townGrowthDisabled = false;
         bool trainsReverseAtSignals = true;
         bool disableStationSizeLimit = false;
+        bool extendedMiscEntityLimit = false;
+        bool boundedAiPathfinding = false;
+        // Amount of stations updated each tick in turn, 0 keeps the vanilla one slot per tick.
+        int32_t stationUpdatesPerTick = 0;
 
         bool usePreferredOwnerName = false;
         std::string preferredOwnerName;
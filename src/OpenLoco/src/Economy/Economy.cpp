@@ -6,6 +6,8 @@
 #include "Ui/WindowType.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
 
 using namespace OpenLoco::Interop;
 
@@ -48,6 +50,20 @@ namespace OpenLoco::Economy
 
     static currency32_t _deliveredCargoPayment[32][60]; // 0x009C68F8
 
+    // Penalty days are capped at 255 so the payment stops changing after this many days.
+    static constexpr size_t kMaxDistinctPaymentDays = 3 * 255 + 1;
+
+    // Payment per unit and distance for each number of days in transit. A row is rebuilt
+    // when the cargo object or the inflation factor it was computed with changes.
+    struct CargoUnitPayments
+    {
+        const CargoObject* cargoObj;
+        uint32_t currencyFactor;
+        uint16_t lastDistinctDay;
+        std::array<currency32_t, kMaxDistinctPaymentDays> payments;
+    };
+    static std::array<CargoUnitPayments, ObjectManager::getMaxObjects(ObjectType::cargo)> _cargoUnitPayments;
+
     static auto& currencyMultiplicationFactors()
     {
         return getGameState().currencyMultiplicationFactor;
@@ -60,6 +76,63 @@ namespace OpenLoco::Economy
         return getGameState().unusedCurrencyMultiplicationFactor;
     }
 
+    // Part of 0x0042F23C
+    static currency32_t calculateCargoUnitPayment(const CargoObject& cargoObj, uint16_t numDays)
+    {
+        // Shift payment factor by 16 for integer maths
+        auto paymentFactorPercent = cargoObj.paymentFactor << 16;
+
+        // Integer maths for updating payment factor percentage
+        // the percentage is 0 - 65535
+        // Ultimate identical to floating point paymentFactor * (1-(percentage/65535))
+        const auto updatePaymentFactorPercent = [&](int32_t percentage) {
+            paymentFactorPercent = std::max(0, paymentFactorPercent - cargoObj.paymentFactor * percentage);
+        };
+
+        // Payment is split into 3 categories
+        // Premium : Full Payment
+        // NonPremium : Reduced Payment rate based on num days passed premium
+        // Penalty : Further reduced payment rate based on num days passed max non premium (capped at 255)
+        auto nonPremiumDays = numDays - cargoObj.premiumDays;
+        if (nonPremiumDays > 0)
+        {
+            updatePaymentFactorPercent(cargoObj.nonPremiumRate * std::min<int32_t>(nonPremiumDays, cargoObj.maxNonPremiumDays));
+            auto penaltyDays = std::min(255, nonPremiumDays - cargoObj.maxNonPremiumDays);
+            if (penaltyDays > 0)
+            {
+                updatePaymentFactorPercent(cargoObj.penaltyRate * penaltyDays);
+            }
+        }
+        paymentFactorPercent >>= 16;
+        return getInflationAdjustedCost(paymentFactorPercent, cargoObj.paymentIndex, 8);
+    }
+
+    currency32_t getCargoUnitPayment(uint8_t cargoItem, uint16_t numDays)
+    {
+        const auto* cargoObj = ObjectManager::get<CargoObject>(cargoItem);
+        auto& row = _cargoUnitPayments[cargoItem];
+        const auto currencyFactor = getCurrencyMultiplicationFactor(cargoObj->paymentIndex);
+        if (row.cargoObj != cargoObj || row.currencyFactor != currencyFactor)
+        {
+            row.cargoObj = cargoObj;
+            row.currencyFactor = currencyFactor;
+            row.lastDistinctDay = cargoObj->premiumDays + cargoObj->maxNonPremiumDays + 255;
+            for (uint16_t day = 0; day <= row.lastDistinctDay; ++day)
+            {
+                row.payments[day] = calculateCargoUnitPayment(*cargoObj, day);
+            }
+        }
+        return row.payments[std::min(numDays, row.lastDistinctDay)];
+    }
+
+    void invalidateCargoUnitPayments()
+    {
+        for (auto& row : _cargoUnitPayments)
+        {
+            row.cargoObj = nullptr;
+        }
+    }
+
     // 0x004375F7
     void buildDeliveredCargoPaymentsTable()
     {
@@ -9,6 +9,10 @@ namespace OpenLoco::Economy
     void updateMonthly();
     void sub_46E2C0(uint16_t year);
     currency32_t getInflationAdjustedCost(int16_t costFactor, uint8_t costIndex, uint8_t divisor);
+    // Payment for one unit of cargo over one unit of distance, scaled by 4096, cached per cargo.
+    currency32_t getCargoUnitPayment(uint8_t cargoItem, uint16_t numDays);
+    // Must be called when cargo objects are reloaded in place.
+    void invalidateCargoUnitPayments();
     void buildDeliveredCargoPaymentsTable();
     std::span<currency32_t> getDeliveryCargoPaymentsTable(uint8_t cargoType);
     uint32_t getCurrencyMultiplicationFactor(uint8_t costIndex);
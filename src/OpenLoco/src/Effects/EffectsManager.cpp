@@ -1,16 +1,28 @@
 #include "EffectsManager.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
+#include <vector>
 
 namespace OpenLoco::EffectsManager
 {
+    // Kept between ticks so that gathering the effects does not allocate
+    static std::vector<EffectEntity*> _updateBatch;
 
     // 0x004402F4
     void update()
     {
         if ((getGameState().flags & GameStateFlags::tileManagerLoaded) != GameStateFlags::none)
         {
+            // Effects only ever free themselves and new entities are linked at the head of the
+            // list, so updating from a copy visits the same effects in the same order as walking
+            // the list while updating, without interleaving the list walk with the updates.
+            _updateBatch.clear();
             for (auto* misc : EffectsList())
+            {
+                _updateBatch.push_back(misc);
+            }
+
+            for (auto* misc : _updateBatch)
             {
                 misc->update();
             }
@@ -1,12 +1,17 @@
 #include "EntityManager.h"
+#include "Config.h"
 #include "EntityTweener.h"
 #include "GameCommands/GameCommands.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
 #include "Localisation/StringIds.h"
 #include "Logging.h"
+#include "MemoryAccounting.h"
 #include <OpenLoco/Core/LocoFixedVector.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -21,11 +26,17 @@ namespace OpenLoco::EntityManager
     std::array<EntityId, kSpatialEntityMapSize> _entitySpatialIndex = {}; // Was loco_global at 0x01025A8C
     uint32_t _entitySpatialCount = 0; // Was loco_global at 0x01025A88
 
+    constexpr size_t kSpatialGridNull = kSpatialGridSize * kSpatialGridSize;
+    static std::array<std::vector<EntityId>, kSpatialGridSize * kSpatialGridSize> _spatialGrid;
+
     static auto& rawEntities() { return getGameState().entities; }
     static auto entities() { return FixedVector(rawEntities()); }
     static auto& rawListHeads() { return getGameState().entityListHeads; }
     static auto& rawListCounts() { return getGameState().entityListCounts; }
 
+    static std::shared_ptr<const std::vector<EntityId>> _vehicleHeadIds;
+    static bool _areVehicleHeadIdsStale = true;
+
     constexpr uint8_t getLinkedListOffset(EntityListType list)
     {
         return enumValue(list) * sizeof(uint16_t);
@@ -36,9 +47,21 @@ namespace OpenLoco::EntityManager
         return offset / sizeof(uint16_t);
     }
 
+    static size_t getMemoryUsage()
+    {
+        size_t gridSize = sizeof(_spatialGrid);
+        for (const auto& cell : _spatialGrid)
+        {
+            gridSize += cell.capacity() * sizeof(EntityId);
+        }
+        return sizeof(rawEntities()) + sizeof(_entitySpatialIndex) + gridSize;
+    }
+
     // 0x0046FDFD
     void reset()
     {
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::entities, getMemoryUsage);
+
         // Reset all entities to 0
         std::fill(std::begin(rawEntities()), std::end(rawEntities()), Entity{});
         // Reset all entity lists
@@ -91,6 +114,7 @@ namespace OpenLoco::EntityManager
             previous = &ent;
         }
         rawListCounts()[enumValue(EntityListType::nullMoney)] = Limits::kMaxMoneyEntities;
+        invalidateVehicleHeadIds();
 
         resetSpatialIndex();
         EntityTweener::get().reset();
@@ -119,6 +143,27 @@ namespace OpenLoco::EntityManager
         return rawListCounts()[enumValue(list)];
     }
 
+    std::shared_ptr<const std::vector<EntityId>> getVehicleHeadIds()
+    {
+        if (_areVehicleHeadIdsStale || _vehicleHeadIds == nullptr)
+        {
+            auto ids = std::make_shared<std::vector<EntityId>>();
+            ids->reserve(getListCount(EntityListType::vehicleHead));
+            for (auto* head = get<EntityBase>(firstId(EntityListType::vehicleHead)); head != nullptr && ids->size() < Limits::kMaxEntities; head = get<EntityBase>(head->nextEntityId))
+            {
+                ids->push_back(head->id);
+            }
+            _vehicleHeadIds = std::move(ids);
+            _areVehicleHeadIdsStale = false;
+        }
+        return _vehicleHeadIds;
+    }
+
+    void invalidateVehicleHeadIds()
+    {
+        _areVehicleHeadIdsStale = true;
+    }
+
     template<>
     EntityBase* get(EntityId id)
     {
@@ -154,6 +199,53 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    static constexpr size_t getSpatialGridIndex(const World::Pos2& loc)
+    {
+        if (loc.x == Location::null || loc.x < 0 || loc.y < 0)
+        {
+            return kSpatialGridNull;
+        }
+
+        const auto cellX = loc.x / kSpatialGridCellSize;
+        const auto cellY = loc.y / kSpatialGridCellSize;
+        if (cellX >= kSpatialGridSize || cellY >= kSpatialGridSize)
+        {
+            return kSpatialGridNull;
+        }
+
+        return (cellY * kSpatialGridSize) + cellX;
+    }
+
+    std::span<const EntityId> getSpatialGridCell(int32_t cellX, int32_t cellY)
+    {
+        return _spatialGrid[(cellY * kSpatialGridSize) + cellX];
+    }
+
+    static void insertToSpatialGrid(const EntityId id, const size_t index)
+    {
+        if (index == kSpatialGridNull)
+        {
+            return;
+        }
+        // Kept sorted so that queries do not depend on the order entities moved in
+        auto& cell = _spatialGrid[index];
+        cell.insert(std::lower_bound(cell.begin(), cell.end(), id), id);
+    }
+
+    static void removeFromSpatialGrid(const EntityId id, const size_t index)
+    {
+        if (index == kSpatialGridNull)
+        {
+            return;
+        }
+        auto& cell = _spatialGrid[index];
+        auto it = std::lower_bound(cell.begin(), cell.end(), id);
+        if (it != cell.end() && *it == id)
+        {
+            cell.erase(it);
+        }
+    }
+
     static void insertToSpatialIndex(EntityBase& entity, const size_t newIndex)
     {
         entity.nextQuadrantId = _entitySpatialIndex[newIndex];
@@ -171,13 +263,22 @@ namespace OpenLoco::EntityManager
     {
         // Clear existing array
         std::fill(std::begin(_entitySpatialIndex), std::end(_entitySpatialIndex), EntityId::null);
+        for (auto& cell : _spatialGrid)
+        {
+            cell.clear();
+        }
 
         // Original filled an unreferenced array at 0x010A5A8E as well then overwrote part of it???
 
-        // Refill the index
+        // Refill the index, entities are visited in id order so the grid cells end up sorted
         for (auto& ent : entities())
         {
             insertToSpatialIndex(ent);
+            const auto gridIndex = getSpatialGridIndex(ent.position);
+            if (gridIndex != kSpatialGridNull)
+            {
+                _spatialGrid[gridIndex].push_back(ent.id);
+            }
         }
     }
 
@@ -233,6 +334,14 @@ namespace OpenLoco::EntityManager
             }
             insertToSpatialIndex(entity, newIndex);
         }
+
+        const auto newGridIndex = getSpatialGridIndex(loc);
+        const auto oldGridIndex = getSpatialGridIndex(entity.position);
+        if (newGridIndex != oldGridIndex)
+        {
+            removeFromSpatialGrid(entity.id, oldGridIndex);
+            insertToSpatialGrid(entity.id, newGridIndex);
+        }
         entity.position = loc;
     }
 
@@ -259,10 +368,15 @@ namespace OpenLoco::EntityManager
         return newEntity;
     }
 
+    size_t getMaxMiscEntities()
+    {
+        return Config::get().extendedMiscEntityLimit ? Limits::kMaxMiscEntitiesExtended : Limits::kMaxMiscEntities;
+    }
+
     // 0x004700A5
     EntityBase* createEntityMisc()
     {
-        if (getListCount(EntityListType::misc) >= Limits::kMaxMiscEntities)
+        if (getListCount(EntityListType::misc) >= getMaxMiscEntities())
         {
             return nullptr;
         }
@@ -304,11 +418,12 @@ namespace OpenLoco::EntityManager
     {
         EntityTweener::get().removeEntity(entity);
 
-        auto list = enumValue(entity->id) < 19800 ? EntityListType::null : EntityListType::nullMoney;
+        auto list = enumValue(entity->id) < Limits::maxNormalEntities ? EntityListType::null : EntityListType::nullMoney;
         moveEntityToList(entity, list);
         StringManager::emptyUserString(entity->name);
         entity->baseType = EntityBaseType::null;
 
+        removeFromSpatialGrid(entity->id, getSpatialGridIndex(entity->position));
         if (!removeFromSpatialIndex(*entity))
         {
             Logging::info("Invalid quadrant ids... Resetting spatial index.");
@@ -327,6 +442,10 @@ namespace OpenLoco::EntityManager
 
         const auto newListIndex = enumValue(list);
         const auto oldListIndex = getLinkedListIndex(entity->linkedListOffset);
+        if (list == EntityListType::vehicleHead || oldListIndex == enumValue(EntityListType::vehicleHead))
+        {
+            _areVehicleHeadIdsStale = true;
+        }
 
         const auto nextId = entity->nextEntityId;
         const auto previousId = entity->llPreviousId;
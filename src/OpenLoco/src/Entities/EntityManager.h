@@ -3,8 +3,12 @@
 #include "Entity.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
 #include <cstdio>
 #include <iterator>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -45,6 +49,58 @@ namespace OpenLoco::EntityManager
     void updateSpatialIndex();
     void moveSpatialEntry(EntityBase& entity, const World::Pos3& loc);
 
+    // Besides the per tile linked lists entities are also kept in a coarser grid of dense
+    // arrays (sorted by id) that range queries walk without chasing nextQuadrantId.
+    constexpr int32_t kSpatialGridCellTiles = 4;
+    constexpr int32_t kSpatialGridCellSize = kSpatialGridCellTiles * World::kTileSize;
+    constexpr int32_t kSpatialGridSize = World::kMapPitch / kSpatialGridCellTiles;
+
+    std::span<const EntityId> getSpatialGridCell(int32_t cellX, int32_t cellY);
+
+    // Calls func for each entity positioned within the inclusive rectangle [min, max].
+    // Entities are visited in the same order no matter how the grid was built, func must not move entities.
+    template<typename TFunc>
+    void forEachEntityInRange(const World::Pos2& min, const World::Pos2& max, TFunc&& func)
+    {
+        const auto cellMinX = std::clamp<int32_t>(min.x / kSpatialGridCellSize, 0, kSpatialGridSize - 1);
+        const auto cellMinY = std::clamp<int32_t>(min.y / kSpatialGridCellSize, 0, kSpatialGridSize - 1);
+        const auto cellMaxX = std::clamp<int32_t>(max.x / kSpatialGridCellSize, 0, kSpatialGridSize - 1);
+        const auto cellMaxY = std::clamp<int32_t>(max.y / kSpatialGridCellSize, 0, kSpatialGridSize - 1);
+        for (auto cellY = cellMinY; cellY <= cellMaxY; ++cellY)
+        {
+            for (auto cellX = cellMinX; cellX <= cellMaxX; ++cellX)
+            {
+                for (const auto id : getSpatialGridCell(cellX, cellY))
+                {
+                    auto* entity = get<EntityBase>(id);
+                    const auto& pos = entity->position;
+                    if (pos.x < min.x || pos.x > max.x || pos.y < min.y || pos.y > max.y)
+                    {
+                        continue;
+                    }
+                    func(*entity);
+                }
+            }
+        }
+    }
+
+    // Calls func for each entity positioned within radius of centre (2D distance).
+    template<typename TFunc>
+    void forEachEntityInRadius(const World::Pos2& centre, int32_t radius, TFunc&& func)
+    {
+        const auto radiusSquared = radius * radius;
+        forEachEntityInRange(centre - World::Pos2(radius, radius), centre + World::Pos2(radius, radius), [&](EntityBase& entity) {
+            const auto dx = entity.position.x - centre.x;
+            const auto dy = entity.position.y - centre.y;
+            if (dx * dx + dy * dy <= radiusSquared)
+            {
+                func(entity);
+            }
+        });
+    }
+
+    // Misc entities are capped below the size of the pool so that vehicles can always be allocated.
+    size_t getMaxMiscEntities();
     EntityBase* createEntityMisc();
     EntityBase* createEntityMoney();
     EntityBase* createEntityVehicle();
@@ -52,6 +108,12 @@ namespace OpenLoco::EntityManager
 
     uint16_t getListCount(const EntityListType list);
     void moveEntityToList(EntityBase* const entity, const EntityListType list);
+
+    // The vehicle head list as a dense array in list order, rebuilt once the list has changed. Shared
+    // so that an iteration keeps its array while heads are created or freed along the way.
+    std::shared_ptr<const std::vector<EntityId>> getVehicleHeadIds();
+    // For when the entities have been replaced wholesale by a load or a checkpoint restore.
+    void invalidateVehicleHeadIds();
     bool checkNumFreeEntities(const size_t numNewEntities);
     void zeroUnused();
 
@@ -109,6 +171,79 @@ namespace OpenLoco::EntityManager
     template<typename T>
     using EntityListIterator = ListIterator<T, &EntityBase::nextEntityId>;
 
+    // Walks a dense array of ids taken from a list. Like the linked list walk it stops at the first
+    // entity that has been freed since, and entities added to the list since are not visited.
+    template<typename TEntityType>
+    class IdArrayIterator
+    {
+    private:
+        TEntityType* entity = nullptr;
+        const EntityId* nextId = nullptr;
+        const EntityId* endId = nullptr;
+
+    public:
+        IdArrayIterator() = default;
+        IdArrayIterator(const EntityId* begin, const EntityId* end)
+            : nextId(begin)
+            , endId(end)
+        {
+            ++(*this);
+        }
+
+        IdArrayIterator& operator++()
+        {
+            entity = nextId != endId ? get<TEntityType>(*nextId++) : nullptr;
+            return *this;
+        }
+
+        IdArrayIterator operator++(int)
+        {
+            IdArrayIterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const IdArrayIterator& other) const
+        {
+            return entity == other.entity;
+        }
+        TEntityType* operator*()
+        {
+            if (entity == nullptr)
+            {
+                throw Exception::RuntimeError("Bad Entity List!");
+            }
+            return entity;
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = TEntityType;
+        using pointer = TEntityType*;
+        using reference = TEntityType&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    template<typename T>
+    class VehicleHeadList
+    {
+    private:
+        std::shared_ptr<const std::vector<EntityId>> ids;
+
+    public:
+        VehicleHeadList()
+            : ids(getVehicleHeadIds())
+        {
+        }
+
+        IdArrayIterator<T> begin()
+        {
+            return IdArrayIterator<T>(ids->data(), ids->data() + ids->size());
+        }
+        IdArrayIterator<T> end()
+        {
+            return IdArrayIterator<T>();
+        }
+    };
+
     template<typename T, EntityListType list>
     class EntityList
     {
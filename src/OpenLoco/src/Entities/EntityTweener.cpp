@@ -2,16 +2,22 @@
 #include "Entity.h"
 #include "OpenLoco.h"
 #include "Vehicles/Vehicle.h"
+#include "ViewportManager.h"
 #include <cmath>
 #include <iostream>
+#include <span>
 
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
     using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::nextEntityId>;
 
+    // Entities this far outside of a viewport are still tweened so that
+    // anything moving into view during the tick is already interpolated.
+    static constexpr int16_t kVisibilityMargin = 64;
+
     template<EntityListType id, typename Pred>
-    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<World::Pos3>& posList, const Pred& pred)
+    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<World::Pos3>& posList, std::span<uint16_t> indexById, const Pred& pred)
     {
         auto entsView = EntityManager::EntityList<EntityListIterator, id>();
         for (auto* ent : entsView)
@@ -21,6 +27,13 @@ namespace OpenLoco
                 continue;
             }
 
+            // Moving an entity nobody can see only costs time.
+            if (!Ui::ViewportManager::isVisible(ent, kVisibilityMargin))
+            {
+                continue;
+            }
+
+            indexById[enumValue(ent->id)] = static_cast<uint16_t>(list.size());
             list.push_back(ent);
             posList.emplace_back(ent->position);
         }
@@ -28,6 +41,16 @@ namespace OpenLoco
 
     static EntityTweener _tweener;
 
+    EntityTweener::EntityTweener()
+    {
+        _indexById.fill(kNoIndex);
+
+        // Reserve up front so populating each tick never has to reallocate.
+        _entities.reserve(Limits::kMaxEntities);
+        _prePos.reserve(Limits::kMaxEntities);
+        _postPos.reserve(Limits::kMaxEntities);
+    }
+
     EntityTweener& EntityTweener::get()
     {
         return _tweener;
@@ -37,8 +60,8 @@ namespace OpenLoco
     {
         restore();
         reset();
-        PopulateEntities<EntityListType::misc>(_entities, _prePos, [](auto*) { return true; });
-        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, [](auto* ent) {
+        PopulateEntities<EntityListType::misc>(_entities, _prePos, _indexById, [](auto*) { return true; });
+        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, _indexById, [](auto* ent) {
             const auto* vehicle = ent->template asBase<Vehicles::VehicleBase>();
             if (vehicle == nullptr)
             {
@@ -67,11 +90,13 @@ namespace OpenLoco
 
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        const auto id = enumValue(entity->id);
+        if (id >= _indexById.size() || _indexById[id] == kNoIndex)
         {
-            *it = nullptr;
+            return;
         }
+        _entities[_indexById[id]] = nullptr;
+        _indexById[id] = kNoIndex;
     }
 
     void EntityTweener::tween(float alpha)
@@ -132,6 +157,13 @@ namespace OpenLoco
 
     void EntityTweener::reset()
     {
+        for (const auto* ent : _entities)
+        {
+            if (ent != nullptr)
+            {
+                _indexById[enumValue(ent->id)] = kNoIndex;
+            }
+        }
         _entities.clear();
         _prePos.clear();
         _postPos.clear();
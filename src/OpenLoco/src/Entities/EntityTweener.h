@@ -1,7 +1,9 @@
 #pragma once
 
 #include "EntityManager.h"
+#include "Engine/Limits.h"
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
 #include <vector>
 
 namespace OpenLoco
@@ -12,7 +14,13 @@ namespace OpenLoco
         std::vector<World::Pos3> _prePos;
         std::vector<World::Pos3> _postPos;
 
+        // Index into _entities for each entity id so that removing an entity does not have to search
+        static constexpr uint16_t kNoIndex = 0xFFFFU;
+        std::array<uint16_t, Limits::kMaxEntities> _indexById;
+
     public:
+        EntityTweener();
+
         static EntityTweener& get();
 
         void preTick();
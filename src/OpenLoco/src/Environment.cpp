@@ -310,6 +310,7 @@ namespace OpenLoco::Environment
             case PathId::heightmap:
             case PathId::customObjects:
             case PathId::screenshots:
+            case PathId::languageCache:
                 return Platform::getUserDirectory();
             case PathId::languageFiles:
             case PathId::objects:
@@ -325,7 +326,7 @@ namespace OpenLoco::Environment
 
     static fs::path getSubPath(PathId id)
     {
-        static constexpr std::array<const char*, 60> kPaths = {
+        static constexpr std::array<const char*, 61> kPaths = {
             "Data/g1.DAT",
             "plugin.dat",
             "plugin2.dat",
@@ -386,6 +387,7 @@ namespace OpenLoco::Environment
             "objects",
             "objects",
             "screenshots",
+            "language",
         };
 
         size_t index = (size_t)id;
@@ -66,6 +66,7 @@ namespace OpenLoco::Environment
         customObjects,
         objects,
         screenshots,
+        languageCache,
     };
 
     void autoCreateDirectory(const fs::path& path);
@@ -285,6 +285,10 @@ namespace OpenLoco::Game
                 {
                     flags = S5::SaveFlags::packCustomObjects;
                 }
+                if (Config::get().compressSaves)
+                {
+                    flags |= S5::SaveFlags::compressed;
+                }
 
                 if (!S5::exportGameStateToFile(path, flags))
                 {
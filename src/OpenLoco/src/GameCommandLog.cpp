@@ -0,0 +1,239 @@
+#include "GameCommandLog.h"
+#include "GameCommands/GameCommands.h"
+#include "Logging.h"
+#include "Network/Packet.h"
+#include "ScenarioManager.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <optional>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::GameCommandLog
+{
+    static constexpr char kMagic[4] = { 'O', 'L', 'G', 'C' };
+    static constexpr uint16_t kVersion = 1;
+
+#pragma pack(push, 1)
+    struct LogHeader
+    {
+        char magic[4];
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t startTick;
+    };
+    static_assert(sizeof(LogHeader) == 12);
+#pragma pack(pop)
+
+    // The log is a header followed by the commands in the encoding of the network game command
+    // batches. A batch without any commands marks the end of the log and holds the last tick.
+    static constexpr size_t kBatchHeaderSize = offsetof(Network::GameCommandBatchPacket, data);
+
+    static std::unique_ptr<FileStream> _recordStream;
+    static Network::GameCommandBatchPacket _pendingBatch;
+    static uint32_t _numRecordedCommands = 0;
+    static uint32_t _tickScopeDepth = 0;
+
+    static std::deque<Network::GameCommand> _replayCommands;
+    static bool _isReplaying = false;
+    static uint32_t _replayStartTick = 0;
+    static uint32_t _replayEndTick = 0;
+
+    static void writeBatch(const Network::GameCommandBatchPacket& batch)
+    {
+        _recordStream->write(&batch, kBatchHeaderSize + batch.dataSize);
+    }
+
+    static void flushPendingBatch()
+    {
+        if (_pendingBatch.numCommands == 0)
+        {
+            return;
+        }
+
+        writeBatch(_pendingBatch);
+        _pendingBatch = {};
+        _pendingBatch.firstIndex = _numRecordedCommands;
+    }
+
+    void startRecording(const fs::path& path)
+    {
+        stopRecording();
+
+        _recordStream = std::make_unique<FileStream>(path, StreamMode::write);
+
+        LogHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.startTick = ScenarioManager::getScenarioTicks();
+        _recordStream->writeValue(header);
+
+        _pendingBatch = {};
+        _numRecordedCommands = 0;
+        Logging::info("Recording game commands to {}", path.u8string());
+    }
+
+    void stopRecording()
+    {
+        if (_recordStream == nullptr)
+        {
+            return;
+        }
+
+        try
+        {
+            flushPendingBatch();
+
+            Network::GameCommandBatchPacket endBatch{};
+            endBatch.tick = ScenarioManager::getScenarioTicks();
+            endBatch.firstIndex = _numRecordedCommands;
+            writeBatch(endBatch);
+            Logging::info("Recorded {} game commands up to tick {}", _numRecordedCommands, endBatch.tick);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to write game command log: {}", e.what());
+        }
+        _recordStream.reset();
+    }
+
+    bool isRecording()
+    {
+        return _recordStream != nullptr;
+    }
+
+    void recordCommand(CompanyId company, const Interop::registers& regs)
+    {
+        if (_recordStream == nullptr || _tickScopeDepth != 0)
+        {
+            return;
+        }
+
+        // The command is run before the next tick, which is where the replay runs it as well
+        Network::GameCommand command{};
+        command.index = _numRecordedCommands;
+        command.tick = ScenarioManager::getScenarioTicks() + 1;
+        command.company = company;
+        command.regs = regs;
+
+        try
+        {
+            if (_pendingBatch.numCommands != 0 && _pendingBatch.tick != command.tick)
+            {
+                flushPendingBatch();
+            }
+            if (!_pendingBatch.tryAppend(command))
+            {
+                flushPendingBatch();
+                _pendingBatch.tryAppend(command);
+            }
+            _pendingBatch.tick = command.tick;
+            _numRecordedCommands++;
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to write game command log: {}", e.what());
+            _recordStream.reset();
+        }
+    }
+
+    TickScope::TickScope()
+    {
+        _tickScopeDepth++;
+    }
+
+    TickScope::~TickScope()
+    {
+        _tickScopeDepth--;
+    }
+
+    void startReplay(const fs::path& path)
+    {
+        stopReplay();
+
+        FileStream stream(path, StreamMode::read);
+        const auto header = stream.readValue<LogHeader>();
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion)
+        {
+            throw Exception::RuntimeError("Not a game command log");
+        }
+
+        std::deque<Network::GameCommand> commands;
+        std::optional<uint32_t> endTick;
+        while (stream.getLength() - stream.getPosition() >= kBatchHeaderSize)
+        {
+            Network::GameCommandBatchPacket batch{};
+            stream.read(&batch, kBatchHeaderSize);
+            if (batch.dataSize > sizeof(batch.data) || batch.dataSize > stream.getLength() - stream.getPosition())
+            {
+                throw Exception::RuntimeError("Invalid game command batch");
+            }
+            stream.read(batch.data, batch.dataSize);
+
+            if (batch.firstIndex != commands.size() || (!commands.empty() && batch.tick < commands.back().tick))
+            {
+                throw Exception::RuntimeError("Game command batches are out of order");
+            }
+            if (batch.numCommands == 0)
+            {
+                endTick = batch.tick;
+                break;
+            }
+
+            auto batchCommands = batch.read();
+            if (!batchCommands)
+            {
+                throw Exception::RuntimeError("Invalid game command batch");
+            }
+            commands.insert(commands.end(), batchCommands->begin(), batchCommands->end());
+        }
+
+        if (!endTick)
+        {
+            // The recording didn't finish, stop at the last tick a command was issued for
+            endTick = commands.empty() ? header.startTick : std::max(header.startTick, commands.back().tick - 1);
+            Logging::warn("Game command log has no end, replaying up to tick {}", *endTick);
+        }
+
+        _replayCommands = std::move(commands);
+        _replayStartTick = header.startTick;
+        _replayEndTick = *endTick;
+        _isReplaying = true;
+    }
+
+    void stopReplay()
+    {
+        _replayCommands.clear();
+        _isReplaying = false;
+    }
+
+    bool isReplaying()
+    {
+        return _isReplaying;
+    }
+
+    uint32_t getReplayStartTick()
+    {
+        return _replayStartTick;
+    }
+
+    uint32_t getReplayEndTick()
+    {
+        return _replayEndTick;
+    }
+
+    void replayCommandsForTick(uint32_t tick)
+    {
+        while (!_replayCommands.empty() && _replayCommands.front().tick <= tick)
+        {
+            const auto& command = _replayCommands.front();
+            GameCommands::doCommandForReal(static_cast<GameCommands::GameCommand>(command.regs.esi), command.company, command.regs);
+            _replayCommands.pop_front();
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Types.hpp"
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Interop/Interop.hpp>
+#include <cstdint>
+
+namespace OpenLoco::GameCommandLog
+{
+    // Writes the game commands issued by the player to a log that can be replayed against the save
+    // the recording was started from. Commands issued while a tick runs (AI, network) are not
+    // recorded as the replayed ticks issue them again.
+    void startRecording(const fs::path& path);
+    void stopRecording();
+    bool isRecording();
+    void recordCommand(CompanyId company, const Interop::registers& regs);
+
+    // Marks the commands issued during its lifetime as part of the tick logic.
+    class TickScope
+    {
+    public:
+        TickScope();
+        ~TickScope();
+
+        TickScope(const TickScope&) = delete;
+        TickScope& operator=(const TickScope&) = delete;
+    };
+
+    // Loads a log for replaying, throws if the log can't be read.
+    void startReplay(const fs::path& path);
+    void stopReplay();
+    bool isReplaying();
+    uint32_t getReplayStartTick();
+    // The tick the recording was stopped at, the commands issued after it are run for the tick after.
+    uint32_t getReplayEndTick();
+
+    // Runs the replayed commands that were issued before the given tick.
+    void replayCommandsForTick(uint32_t tick);
+}
@@ -246,9 +246,7 @@ namespace OpenLoco::GameCommands
                     else
                     {
                         World::TileManager::mapInvalidateTileFull(World::toWorldSpace(tilePos));
-                        surface->setBaseZ(baseHeight / World::kSmallZStep);
-                        surface->setClearZ(baseHeight / World::kSmallZStep);
-                        surface->setSlope(0);
+                        World::TileManager::setSurfaceHeight(tilePos, *surface, baseHeight / World::kSmallZStep, baseHeight / World::kSmallZStep, 0);
                         surface->setSnowCoverage(0);
                         surface->setGrowthStage(0);
                     }
@@ -460,6 +458,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const AirportPlacementArgs& args, const uint8_t flags)
+    {
+        return createAirport(args, flags);
+    }
+
     void createAirport(registers& regs)
     {
         regs.ebx = createAirport(AirportPlacementArgs(regs), regs.bl);
@@ -33,4 +33,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createAirport(registers& regs);
+    uint32_t execute(const AirportPlacementArgs& args, uint8_t flags);
 }
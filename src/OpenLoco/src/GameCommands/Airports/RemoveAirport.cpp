@@ -275,6 +275,11 @@ namespace OpenLoco::GameCommands
         return loc_49372F(stationId, *foundStationEl, foundPos, flags);
     }
 
+    uint32_t execute(const AirportRemovalArgs& args, const uint8_t flags)
+    {
+        return removeAirport(args, flags);
+    }
+
     void removeAirport(registers& regs)
     {
         regs.ebx = removeAirport(AirportRemovalArgs(regs), regs.bl);
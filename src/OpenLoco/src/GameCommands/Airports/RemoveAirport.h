@@ -28,4 +28,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeAirport(registers& regs);
+    uint32_t execute(const AirportRemovalArgs& args, uint8_t flags);
 }
@@ -211,9 +211,7 @@ namespace OpenLoco::GameCommands
                     if (flags & Flags::apply)
                     {
                         World::TileManager::mapInvalidateTileFull(World::toWorldSpace(tilePos));
-                        surface->setBaseZ(args.pos.z / World::kSmallZStep);
-                        surface->setClearZ(args.pos.z / World::kSmallZStep);
-                        surface->setSlope(0);
+                        World::TileManager::setSurfaceHeight(tilePos, *surface, args.pos.z / World::kSmallZStep, args.pos.z / World::kSmallZStep, 0);
                         surface->setSnowCoverage(0);
                         surface->setGrowthStage(0);
                     }
@@ -273,6 +271,7 @@ namespace OpenLoco::GameCommands
             const auto populationCapacity = buildingObj->producedQuantity[0];
             const auto population = args.buildImmediately ? populationCapacity : 0;
 
+            TownManager::addBuildingToIndex(args.pos, args.pos.z / World::kSmallZStep);
             auto* town = TownManager::updateTownInfo(args.pos, population, populationCapacity, 0, 1);
             if (town != nullptr)
             {
@@ -285,6 +284,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const BuildingPlacementArgs& args, const uint8_t flags)
+    {
+        return createBuilding(args, flags);
+    }
+
     void createBuilding(registers& regs)
     {
         BuildingPlacementArgs args(regs);
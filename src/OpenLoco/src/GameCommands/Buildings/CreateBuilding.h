@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createBuilding(registers& regs);
+    uint32_t execute(const BuildingPlacementArgs& args, uint8_t flags);
 }
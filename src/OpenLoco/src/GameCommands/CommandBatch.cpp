@@ -0,0 +1,47 @@
+#include "CommandBatch.h"
+#include "World/CompanyManager.h"
+
+namespace OpenLoco::GameCommands
+{
+    uint32_t CommandBatch::execute(uint8_t flags) const
+    {
+        const uint8_t queryFlags = flags & ~Flags::apply;
+
+        int32_t totalCost = 0;
+        for (const auto& command : _commands)
+        {
+            const auto cost = command(queryFlags);
+            if (cost == FAILURE)
+            {
+                return FAILURE;
+            }
+            totalCost += static_cast<int32_t>(cost);
+        }
+
+        // Each query only checked its own cost
+        if ((flags & (Flags::allowNegativeCashFlow | Flags::ghost)) == 0
+            && !CompanyManager::ensureCompanyFunding(getUpdatingCompanyId(), totalCost))
+        {
+            return FAILURE;
+        }
+
+        if ((flags & Flags::apply) == 0)
+        {
+            return static_cast<uint32_t>(totalCost);
+        }
+
+        // The queries passed against the same map, so a failure here is unexpected and what was
+        // already applied is kept.
+        totalCost = 0;
+        for (const auto& command : _commands)
+        {
+            const auto cost = command(flags);
+            if (cost == FAILURE)
+            {
+                return FAILURE;
+            }
+            totalCost += static_cast<int32_t>(cost);
+        }
+        return static_cast<uint32_t>(totalCost);
+    }
+}
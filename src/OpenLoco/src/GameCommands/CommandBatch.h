@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GameCommands.h"
+#include <functional>
+#include <vector>
+
+namespace OpenLoco::GameCommands
+{
+    // A planned group of commands, such as the pieces of a stretch of track, that is placed as a
+    // whole or not at all. Every command is queried before any of them is applied and the cost of
+    // the group is checked against the company funds once. The queries all see the map as it was
+    // before the batch, so a command that relies on an earlier one of the same batch (a signal on
+    // a piece of track that is yet to be built) belongs in a later batch.
+    class CommandBatch
+    {
+    private:
+        std::vector<std::function<uint32_t(uint8_t)>> _commands;
+
+    public:
+        template<typename T>
+        void add(const T& args)
+        {
+            _commands.push_back([args](uint8_t flags) { return doCommand(args, flags); });
+        }
+
+        size_t size() const { return _commands.size(); }
+        bool empty() const { return _commands.empty(); }
+        void clear() { _commands.clear(); }
+
+        // Returns the total cost, or FAILURE when nothing was applied because one of the commands
+        // or the total cost was refused. The commands still go through doCommand one by one, so
+        // a networked game sends them as the consecutive commands of a single tick.
+        uint32_t execute(uint8_t flags) const;
+    };
+}
@@ -122,6 +122,11 @@ namespace OpenLoco::GameCommands
     }
 
     // 0x0047AF0B
+    uint32_t execute(const AiRoadAndStationPlacementArgs& args, const uint8_t flags)
+    {
+        return aiCreateRoadAndStationCost(args, flags);
+    }
+
     void aiCreateRoadAndStation(registers& regs)
     {
         regs.ebx = aiCreateRoadAndStationCost(AiRoadAndStationPlacementArgs(regs), regs.bl);
@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void aiCreateRoadAndStation(registers& regs);
+    uint32_t execute(const AiRoadAndStationPlacementArgs& args, uint8_t flags);
 }
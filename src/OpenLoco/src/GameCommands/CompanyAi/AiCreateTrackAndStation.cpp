@@ -170,6 +170,11 @@ namespace OpenLoco::GameCommands
     }
 
     // 0x004A6FDC
+    uint32_t execute(const AiTrackAndStationPlacementArgs& args, const uint8_t flags)
+    {
+        return aiCreateTrackAndStation(args, flags);
+    }
+
     void aiCreateTrackAndStation(registers& regs)
     {
         regs.ebx = aiCreateTrackAndStation(AiTrackAndStationPlacementArgs(regs), regs.bl);
@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void aiCreateTrackAndStation(registers& regs);
+    uint32_t execute(const AiTrackAndStationPlacementArgs& args, uint8_t flags);
 }
@@ -425,6 +425,11 @@ namespace OpenLoco::GameCommands
     }
 
     // 0x004A734F
+    uint32_t execute(const AiTrackReplacementArgs& args, const uint8_t flags)
+    {
+        return aiTrackReplacement(args, flags);
+    }
+
     void aiTrackReplacement(registers& regs)
     {
         regs.ebx = aiTrackReplacement(AiTrackReplacementArgs(regs), regs.bl);
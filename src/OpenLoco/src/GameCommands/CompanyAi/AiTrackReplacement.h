@@ -37,4 +37,5 @@ namespace OpenLoco::GameCommands
     };
 
     void aiTrackReplacement(registers& regs);
+    uint32_t execute(const AiTrackReplacementArgs& args, uint8_t flags);
 }
@@ -323,9 +323,7 @@ namespace OpenLoco::GameCommands
                         else
                         {
                             World::TileManager::mapInvalidateTileFull(World::toWorldSpace(tilePos));
-                            surface->setBaseZ(args.pos.z / World::kSmallZStep);
-                            surface->setClearZ(args.pos.z / World::kSmallZStep);
-                            surface->setSlope(0);
+                            World::TileManager::setSurfaceHeight(tilePos, *surface, args.pos.z / World::kSmallZStep, args.pos.z / World::kSmallZStep, 0);
                             surface->setSnowCoverage(0);
                             surface->setGrowthStage(0);
                         }
@@ -537,6 +535,11 @@ namespace OpenLoco::GameCommands
     }
 
     // 0x00493AA7
+    uint32_t execute(const PortPlacementArgs& args, const uint8_t flags)
+    {
+        return createPort(args, flags);
+    }
+
     void createPort(registers& regs)
     {
         regs.ebx = createPort(PortPlacementArgs(regs), regs.bl);
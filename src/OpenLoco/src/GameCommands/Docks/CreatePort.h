@@ -33,4 +33,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createPort(registers& regs);
+    uint32_t execute(const PortPlacementArgs& args, uint8_t flags);
 }
@@ -130,6 +130,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const PortRemovalArgs& args, const uint8_t flags)
+    {
+        return removePort(args, flags);
+    }
+
     void removePort(registers& regs)
     {
         regs.ebx = removePort(PortRemovalArgs(regs), regs.bl);
@@ -27,4 +27,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removePort(registers& regs);
+    uint32_t execute(const PortRemovalArgs& args, uint8_t flags);
 }
@@ -18,6 +18,7 @@
 #include "CompanyAi/AiTrackReplacement.h"
 #include "Docks/CreatePort.h"
 #include "Docks/RemovePort.h"
+#include "GameCommandLog.h"
 #include "General/LoadSaveQuit.h"
 #include "General/RenameStation.h"
 #include "General/SetGameSpeed.h"
@@ -103,6 +104,7 @@ using namespace OpenLoco::World;
 namespace OpenLoco::GameCommands
 {
     static CompanyId _updatingCompanyId = 0; // Was loco_global at 0x009C68EB
+    static uint32_t _numCommandsIssued = 0;
     static uint8_t _gameCommandNestLevel = 0; // Was loco_global at 0x00508F08
 
     static uint16_t _gameCommandFlags;
@@ -216,7 +218,8 @@ namespace OpenLoco::GameCommands
     // clang-format on
 
     static uint32_t loc_4314EA();
-    static uint32_t loc_4313C6(int esi, const registers& regs);
+    static uint32_t loc_4313C6(const CommandCall& call);
+    static uint32_t doCommandForReal(const CommandCall& call, CompanyId company);
 
     static bool commandRequiresUnpausingGame(GameCommand command, uint16_t flags)
     {
@@ -234,21 +237,96 @@ namespace OpenLoco::GameCommands
         return true;
     }
 
+    // Whether applying the command can change how track and road pieces connect to each other.
+    static bool commandMayModifyNetwork(GameCommand command)
+    {
+        switch (command)
+        {
+            case GameCommand::vehicleRearrange:
+            case GameCommand::vehiclePlace:
+            case GameCommand::vehiclePickup:
+            case GameCommand::vehicleReverse:
+            case GameCommand::vehiclePassSignal:
+            case GameCommand::vehicleCreate:
+            case GameCommand::vehicleSell:
+            case GameCommand::changeLoan:
+            case GameCommand::vehicleRename:
+            case GameCommand::changeStationName:
+            case GameCommand::vehicleChangeRunningMode:
+            case GameCommand::changeCompanyColourScheme:
+            case GameCommand::pauseGame:
+            case GameCommand::changeCompanyName:
+            case GameCommand::changeCompanyOwnerName:
+            case GameCommand::vehicleOrderInsert:
+            case GameCommand::vehicleOrderDelete:
+            case GameCommand::vehicleOrderSkip:
+            case GameCommand::renameTown:
+            case GameCommand::vehiclePlaceAir:
+            case GameCommand::vehiclePickupAir:
+            case GameCommand::vehiclePlaceWater:
+            case GameCommand::vehiclePickupWater:
+            case GameCommand::vehicleRefit:
+            case GameCommand::changeCompanyFace:
+            case GameCommand::sendChatMessage:
+            case GameCommand::vehicleSpeedControl:
+            case GameCommand::vehicleOrderUp:
+            case GameCommand::vehicleOrderDown:
+            case GameCommand::vehicleApplyShuntCheat:
+            case GameCommand::applyFreeCashCheat:
+            case GameCommand::renameIndustry:
+            case GameCommand::vehicleClone:
+            case GameCommand::setGameSpeed:
+            case GameCommand::vehicleOrderReverse:
+            case GameCommand::vehicleRepaint:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    static void callGameCommandFunction(uint32_t command, registers& regs);
+
+    static uint32_t executeWithRegisters(const CommandCall& call, uint8_t flags)
+    {
+        registers regs = *static_cast<const registers*>(call.args);
+        regs.bl = flags;
+        callGameCommandFunction(static_cast<uint32_t>(call.command), regs);
+        return regs.ebx;
+    }
+
+    static registers getRegisters(const CommandCall& call)
+    {
+        return *static_cast<const registers*>(call.args);
+    }
+
+    // The register form of a command, as used by the network and the original code
+    static CommandCall makeRegistersCall(GameCommand command, const registers& regs)
+    {
+        CommandCall call{};
+        call.command = command;
+        call.flags = regs.bx;
+        call.args = &regs;
+        call.execute = executeWithRegisters;
+        call.toRegisters = getRegisters;
+        return call;
+    }
+
     // 0x00431315
-    uint32_t doCommand(GameCommand command, const registers& regs)
+    uint32_t doCommand(const CommandCall& call)
     {
-        uint16_t flags = regs.bx;
-        uint32_t esi = static_cast<uint32_t>(command);
+        uint16_t flags = call.flags;
 
-        _gameCommandFlags = regs.bx;
+        _gameCommandFlags = call.flags;
         if (_gameCommandNestLevel != 0)
         {
-            return loc_4313C6(esi, regs);
+            return loc_4313C6(call);
         }
 
+        _numCommandsIssued++;
+
         if ((flags & Flags::apply) == 0)
         {
-            return loc_4313C6(esi, regs);
+            return loc_4313C6(call);
         }
 
         auto isGhost = (flags & Flags::ghost) != 0;
@@ -256,23 +334,41 @@ namespace OpenLoco::GameCommands
         {
             // For network games, we need to delay the command apply processing
             // Just return the result without applying for now
-            registers copyRegs = regs;
-            copyRegs.esi = static_cast<int32_t>(command);
+            registers copyRegs = call.toRegisters(call);
+            copyRegs.esi = static_cast<int32_t>(call.command);
             Network::queueGameCommand(_updatingCompanyId, copyRegs);
 
-            copyRegs.bx &= ~Flags::apply;
-            return loc_4313C6(esi, copyRegs);
+            CommandCall queryCall = call;
+            queryCall.flags &= ~Flags::apply;
+            return loc_4313C6(queryCall);
         }
 
-        return doCommandForReal(command, _updatingCompanyId, regs);
+        if (GameCommandLog::isRecording() && call.command != GameCommand::loadSaveQuitGame)
+        {
+            registers logRegs = call.toRegisters(call);
+            logRegs.esi = static_cast<int32_t>(call.command);
+            GameCommandLog::recordCommand(_updatingCompanyId, logRegs);
+        }
+
+        return doCommandForReal(call, _updatingCompanyId);
+    }
+
+    uint32_t doCommand(GameCommand command, const registers& regs)
+    {
+        return doCommand(makeRegistersCall(command, regs));
     }
 
     uint32_t doCommandForReal(GameCommand command, CompanyId company, const registers& regs)
+    {
+        return doCommandForReal(makeRegistersCall(command, regs), company);
+    }
+
+    static uint32_t doCommandForReal(const CommandCall& call, CompanyId company)
     {
         _updatingCompanyId = company;
 
-        uint16_t flags = regs.bx;
-        uint32_t esi = static_cast<uint32_t>(command);
+        const auto command = call.command;
+        uint16_t flags = call.flags;
 
         if (commandRequiresUnpausingGame(command, flags) && _updatingCompanyId == CompanyManager::getControllingId())
         {
@@ -304,7 +400,7 @@ namespace OpenLoco::GameCommands
             // call(0x0046E34A, fnRegs); // some network stuff. Untested
         }
 
-        return loc_4313C6(esi, regs);
+        return loc_4313C6(call);
     }
 
     static void callGameCommandFunction(uint32_t command, registers& regs)
@@ -321,17 +417,14 @@ namespace OpenLoco::GameCommands
         }
     }
 
-    static uint32_t loc_4313C6(int esi, const registers& regs)
+    static uint32_t loc_4313C6(const CommandCall& call)
     {
-        uint16_t flags = regs.bx;
+        uint16_t flags = call.flags;
         _gGameCommandErrorText = StringIds::null;
         _gameCommandNestLevel++;
 
         uint16_t flagsBackup = _gameCommandFlags;
-        registers fnRegs1 = regs;
-        fnRegs1.bl &= ~Flags::apply;
-        callGameCommandFunction(esi, fnRegs1);
-        int32_t ebx = fnRegs1.ebx;
+        int32_t ebx = call.execute(call, static_cast<uint8_t>(flags & ~Flags::apply));
         _gameCommandFlags = flagsBackup;
 
         if (ebx != static_cast<int32_t>(GameCommands::FAILURE))
@@ -375,9 +468,16 @@ namespace OpenLoco::GameCommands
         }
 
         uint16_t flagsBackup2 = _gameCommandFlags;
-        registers fnRegs2 = regs;
-        callGameCommandFunction(esi, fnRegs2);
-        int32_t ebx2 = fnRegs2.ebx;
+        const bool mayModifyNetwork = commandMayModifyNetwork(call.command);
+        if (mayModifyNetwork)
+        {
+            Vehicles::beginNetworkChange();
+        }
+        int32_t ebx2 = call.execute(call, static_cast<uint8_t>(flags));
+        if (mayModifyNetwork)
+        {
+            Vehicles::endNetworkChange();
+        }
         _gameCommandFlags = flagsBackup2;
 
         if (ebx2 == static_cast<int32_t>(GameCommands::FAILURE))
@@ -595,6 +695,11 @@ namespace OpenLoco::GameCommands
         _gameCommandNestLevel = 0;
     }
 
+    uint32_t getNumCommandsIssued()
+    {
+        return _numCommandsIssued;
+    }
+
     // TODO: Maybe move this somewhere else used by multiple game commands
     // 0x0048B013
     void playConstructionPlacementSound(World::Pos3 pos)
@@ -6,6 +6,7 @@
 #include "Objects/Object.h"
 #include "World/Company.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <concepts>
 
 using namespace OpenLoco::Interop;
 
@@ -126,16 +127,57 @@ namespace OpenLoco::GameCommands
 
     constexpr uint32_t FAILURE = 0x80000000;
 
+    // A command as seen by the dispatcher, args points at either the registers or the typed args of the command.
+    struct CommandCall
+    {
+        GameCommand command;
+        uint16_t flags;
+        const void* args;
+        // Runs the implementation once with the given flags and returns the cost
+        uint32_t (*execute)(const CommandCall& call, uint8_t flags);
+        // Only used when the command has to be sent over the network
+        registers (*toRegisters)(const CommandCall& call);
+    };
+
+    uint32_t doCommand(const CommandCall& call);
     uint32_t doCommand(GameCommand command, const registers& registers);
     uint32_t doCommandForReal(GameCommand command, CompanyId company, const registers& registers);
     bool sub_431E6A(const CompanyId company, const World::TileElement* const tile = nullptr);
 
+    // Commands declare `uint32_t execute(const TArgs& args, uint8_t flags)` next to their args to be called
+    // without going through the registers.
+    template<typename T>
+    concept HasTypedImplementation = requires(const T& args, uint8_t flags) {
+        { execute(args, flags) } -> std::same_as<uint32_t>;
+    };
+
+    template<typename T>
+    registers toRegisters(const CommandCall& call)
+    {
+        registers regs = registers(*static_cast<const T*>(call.args));
+        regs.bl = static_cast<uint8_t>(call.flags);
+        return regs;
+    }
+
     template<typename T>
     uint32_t doCommand(const T& args, uint8_t flags)
     {
-        registers regs = registers(args);
-        regs.bl = flags;
-        return doCommand(T::command, regs);
+        if constexpr (HasTypedImplementation<T>)
+        {
+            CommandCall call{};
+            call.command = T::command;
+            call.flags = flags;
+            call.args = &args;
+            call.execute = [](const CommandCall& typedCall, uint8_t callFlags) { return execute(*static_cast<const T*>(typedCall.args), callFlags); };
+            call.toRegisters = toRegisters<T>;
+            return doCommand(call);
+        }
+        else
+        {
+            registers regs = registers(args);
+            regs.bl = flags;
+            return doCommand(T::command, regs);
+        }
     }
 
     // Load multiplayer map
@@ -195,6 +237,8 @@ namespace OpenLoco::GameCommands
     void setUpdatingCompanyId(CompanyId companyId);
     uint8_t getCommandNestLevel();
     void resetCommandNestLevel();
+    // Total amount of commands issued through doCommand, nested commands are not counted.
+    uint32_t getNumCommandsIssued();
 
     void playConstructionPlacementSound(World::Pos3 pos);
 }
@@ -314,9 +314,7 @@ namespace OpenLoco::GameCommands
                     if (flags & Flags::apply)
                     {
                         World::TileManager::mapInvalidateTileFull(World::toWorldSpace(tilePos));
-                        surface->setBaseZ(highestBaseZ);
-                        surface->setClearZ(highestBaseZ);
-                        surface->setSlope(0);
+                        World::TileManager::setSurfaceHeight(tilePos, *surface, highestBaseZ, highestBaseZ, 0);
                         surface->setSnowCoverage(0);
                         surface->setGrowthStage(0);
                     }
@@ -706,6 +704,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const IndustryPlacementArgs& args, const uint8_t flags)
+    {
+        return createIndustry(args, flags);
+    }
+
     void createIndustry(registers& regs)
     {
         IndustryPlacementArgs args(regs);
@@ -38,4 +38,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createIndustry(registers& regs);
+    uint32_t execute(const IndustryPlacementArgs& args, uint8_t flags);
 }
@@ -24,6 +24,8 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <optional>
+#include <sfl/static_vector.hpp>
 
 namespace OpenLoco::GameCommands
 {
@@ -610,6 +612,78 @@ namespace OpenLoco::GameCommands
         return RoadClearFunctionResult(World::TileClearance::ClearFuncResult::collision);
     }
 
+    namespace
+    {
+        struct PieceHeight
+        {
+            World::SmallZ baseZ;
+            World::SmallZ clearZ;
+            bool hasBridge;
+        };
+    }
+
+    // The height and bridge checks of a piece, these only read the surface element.
+    static std::optional<PieceHeight> getPieceHeight(const RoadPlacementArgs& args, const World::TrackData::PreviewTrack& piece, const World::Pos3& roadLoc)
+    {
+        const auto unk = Numerics::rotl4bit(enumValue(piece.flags) & 0xF, args.rotation);
+
+        if (roadLoc.z < 16)
+        {
+            setErrorText(StringIds::error_too_low);
+            return std::nullopt;
+        }
+
+        const auto baseZ = roadLoc.z / World::kSmallZStep;
+        auto clearZ = baseZ + (piece.clearZ + 32) / World::kSmallZStep;
+        bool hasBridge = false;
+
+        // Why aren't we just failing invalid???
+        if (World::validCoords(roadLoc))
+        {
+            const auto tile = World::TileManager::get(roadLoc);
+            auto* elSurface = tile.surface();
+            if (elSurface->water())
+            {
+                _byte_1136073 = _byte_1136073 | (1U << 7);
+            }
+
+            const bool requiresBridge = isBridgeRequired(baseZ, *elSurface, piece, unk);
+            if (requiresBridge)
+            {
+                // 0x004762CD
+                _byte_1136073 = _byte_1136073 | (1U << 0);
+                hasBridge = true;
+                World::MicroZ heightDiff = (baseZ - elSurface->baseZ()) / World::kMicroToSmallZStep;
+                if (args.bridge == 0xFFU)
+                {
+                    setErrorText(StringIds::bridge_needed);
+                    return std::nullopt;
+                }
+                auto* bridgeObj = ObjectManager::get<BridgeObject>(args.bridge);
+                if (heightDiff > bridgeObj->maxHeight)
+                {
+                    setErrorText(StringIds::too_far_above_ground_for_bridge_type);
+                    return std::nullopt;
+                }
+                _byte_1136074 = std::max(heightDiff, _byte_1136074);
+                if ((bridgeObj->disabledTrackCfg & World::TrackData::getRoadMiscData(args.roadId).flags) != CommonTraitFlags::none)
+                {
+                    setErrorText(StringIds::bridge_type_unsuitable_for_this_configuration);
+                    return std::nullopt;
+                }
+                clearZ += bridgeObj->clearHeight / World::kSmallZStep;
+            }
+        }
+
+        // 0x0047632B
+        if (clearZ > 236)
+        {
+            setErrorText(StringIds::error_too_high);
+            return std::nullopt;
+        }
+        return PieceHeight{ static_cast<World::SmallZ>(baseZ), static_cast<World::SmallZ>(clearZ), hasBridge };
+    }
+
     // 0x00475FBC
     static uint32_t createRoad(const RoadPlacementArgs& args, uint8_t flags)
     {
@@ -682,65 +756,28 @@ namespace OpenLoco::GameCommands
         std::array<uint8_t, 16> roadIdUnk = {};
         roadIdUnk[args.roadId] |= 1U << args.rotation;
 
+        // Every piece is height checked before any is cleared. A placement that can never fit, such as
+        // the AI trying without a bridge first, then fails without walking the tile elements or
+        // querying building removals.
+        sfl::static_vector<PieceHeight, World::TrackData::kMaxPreviewTrackTiles> pieceHeights;
         for (auto& piece : roadPieces)
         {
             const auto roadLoc = args.pos + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, args.rotation), piece.z };
-            const auto quarterTile = piece.subTileClearance.rotate(args.rotation);
-            const auto unk = Numerics::rotl4bit(enumValue(piece.flags) & 0xF, args.rotation);
-
-            if (roadLoc.z < 16)
+            const auto height = getPieceHeight(args, piece, roadLoc);
+            if (!height.has_value())
             {
-                setErrorText(StringIds::error_too_low);
                 return FAILURE;
             }
+            pieceHeights.push_back(*height);
+        }
 
-            const auto baseZ = roadLoc.z / World::kSmallZStep;
-            auto clearZ = baseZ + (piece.clearZ + 32) / World::kSmallZStep;
-            _byte_1136073 = _byte_1136073 & ~(1U << 1);
-
-            // Why aren't we just failing invalid???
-            if (World::validCoords(roadLoc))
-            {
-                const auto tile = World::TileManager::get(roadLoc);
-                auto* elSurface = tile.surface();
-                if (elSurface->water())
-                {
-                    _byte_1136073 = _byte_1136073 | (1U << 7);
-                }
-
-                const bool requiresBridge = isBridgeRequired(baseZ, *elSurface, piece, unk);
-                if (requiresBridge)
-                {
-                    // 0x004762CD
-                    _byte_1136073 = _byte_1136073 | (1U << 1) | (1U << 0);
-                    World::MicroZ heightDiff = (baseZ - elSurface->baseZ()) / World::kMicroToSmallZStep;
-                    if (args.bridge == 0xFFU)
-                    {
-                        setErrorText(StringIds::bridge_needed);
-                        return FAILURE;
-                    }
-                    auto* bridgeObj = ObjectManager::get<BridgeObject>(args.bridge);
-                    if (heightDiff > bridgeObj->maxHeight)
-                    {
-                        setErrorText(StringIds::too_far_above_ground_for_bridge_type);
-                        return FAILURE;
-                    }
-                    _byte_1136074 = std::max(heightDiff, _byte_1136074);
-                    if ((bridgeObj->disabledTrackCfg & World::TrackData::getRoadMiscData(args.roadId).flags) != CommonTraitFlags::none)
-                    {
-                        setErrorText(StringIds::bridge_type_unsuitable_for_this_configuration);
-                        return FAILURE;
-                    }
-                    clearZ += bridgeObj->clearHeight / World::kSmallZStep;
-                }
-            }
-
-            // 0x0047632B
-            if (clearZ > 236)
-            {
-                setErrorText(StringIds::error_too_high);
-                return FAILURE;
-            }
+        for (auto pieceIndex = 0U; pieceIndex < roadPieces.size(); ++pieceIndex)
+        {
+            const auto& piece = roadPieces[pieceIndex];
+            const auto roadLoc = args.pos + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, args.rotation), piece.z };
+            const auto quarterTile = piece.subTileClearance.rotate(args.rotation);
+            const auto [baseZ, clearZ, hasBridge] = pieceHeights[pieceIndex];
+            _byte_1136073 = hasBridge ? (_byte_1136073 | (1U << 1)) : (_byte_1136073 & ~(1U << 1));
 
             // 0x0113C2E2
             bool hasLevelCrossing = false;
@@ -1121,6 +1158,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const RoadPlacementArgs& args, const uint8_t flags)
+    {
+        return createRoad(args, flags);
+    }
+
     void createRoad(registers& regs)
     {
         regs.ebx = createRoad(RoadPlacementArgs(regs), regs.bl);
@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createRoad(registers& regs);
+    uint32_t execute(const RoadPlacementArgs& args, uint8_t flags);
 }
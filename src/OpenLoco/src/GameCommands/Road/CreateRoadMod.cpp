@@ -76,6 +76,11 @@ namespace OpenLoco::GameCommands
         return result.cost;
     }
 
+    uint32_t execute(const RoadModsPlacementArgs& args, const uint8_t flags)
+    {
+        return createRoadMod(args, flags);
+    }
+
     void createRoadMod(registers& regs)
     {
         regs.ebx = createRoadMod(RoadModsPlacementArgs(regs), regs.bl);
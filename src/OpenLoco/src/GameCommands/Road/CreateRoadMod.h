@@ -44,4 +44,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createRoadMod(registers& regs);
+    uint32_t execute(const RoadModsPlacementArgs& args, uint8_t flags);
 }
@@ -681,6 +681,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const RoadStationPlacementArgs& args, const uint8_t flags)
+    {
+        return createRoadStation(args, flags);
+    }
+
     void createRoadStation(registers& regs)
     {
         regs.ebx = createRoadStation(RoadStationPlacementArgs(regs), regs.bl);
@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createRoadStation(registers& regs);
+    uint32_t execute(const RoadStationPlacementArgs& args, uint8_t flags);
 }
@@ -314,6 +314,11 @@ namespace OpenLoco::GameCommands
         return totalRemovalCost;
     }
 
+    uint32_t execute(const RoadRemovalArgs& args, const uint8_t flags)
+    {
+        return removeRoad(args, flags);
+    }
+
     void removeRoad(registers& regs)
     {
         regs.ebx = removeRoad(RoadRemovalArgs(regs), regs.bl);
@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeRoad(registers& regs);
+    uint32_t execute(const RoadRemovalArgs& args, uint8_t flags);
 }
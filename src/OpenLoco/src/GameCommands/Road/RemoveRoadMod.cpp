@@ -80,6 +80,11 @@ namespace OpenLoco::GameCommands
         return cost;
     }
 
+    uint32_t execute(const RoadModsRemovalArgs& args, const uint8_t flags)
+    {
+        return removeRoadMod(args, flags);
+    }
+
     void removeRoadMod(registers& regs)
     {
         regs.ebx = removeRoadMod(RoadModsRemovalArgs(regs), regs.bl);
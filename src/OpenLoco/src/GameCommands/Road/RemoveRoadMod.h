@@ -44,4 +44,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeRoadMod(registers& regs);
+    uint32_t execute(const RoadModsRemovalArgs& args, uint8_t flags);
 }
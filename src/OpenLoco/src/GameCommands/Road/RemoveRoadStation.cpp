@@ -193,6 +193,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const RoadStationRemovalArgs& args, const uint8_t flags)
+    {
+        return removeRoadStation(args, flags);
+    }
+
     void removeRoadStation(registers& regs)
     {
         regs.ebx = removeRoadStation(RoadStationRemovalArgs(regs), regs.bl);
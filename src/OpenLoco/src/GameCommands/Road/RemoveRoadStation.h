@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeRoadStation(registers& regs);
+    uint32_t execute(const RoadStationRemovalArgs& args, uint8_t flags);
 }
@@ -93,6 +93,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const ClearLandArgs& args, const uint8_t flags)
+    {
+        return clearLand(args, flags);
+    }
+
     void clearLand(registers& regs)
     {
         const ClearLandArgs args(regs);
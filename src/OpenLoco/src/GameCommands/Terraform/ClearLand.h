@@ -31,4 +31,5 @@ namespace OpenLoco::GameCommands
     };
 
     void clearLand(registers& regs);
+    uint32_t execute(const ClearLandArgs& args, uint8_t flags);
 }
@@ -136,6 +136,11 @@ namespace OpenLoco::GameCommands
         return Economy::getInflationAdjustedCost(treeObj->buildCostFactor, treeObj->costIndex, 12);
     }
 
+    uint32_t execute(const TreePlacementArgs& args, const uint8_t flags)
+    {
+        return createTree(args, flags);
+    }
+
     void createTree(registers& regs)
     {
         TreePlacementArgs args(regs);
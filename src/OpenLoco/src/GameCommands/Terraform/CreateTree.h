@@ -42,4 +42,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createTree(registers& regs);
+    uint32_t execute(const TreePlacementArgs& args, uint8_t flags);
 }
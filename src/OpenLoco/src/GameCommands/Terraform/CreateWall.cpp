@@ -285,6 +285,11 @@ namespace OpenLoco::GameCommands
         return 0;
     }
 
+    uint32_t execute(const WallPlacementArgs& args, const uint8_t flags)
+    {
+        return createWall(args, flags);
+    }
+
     void createWall(registers& regs)
     {
         WallPlacementArgs args(regs);
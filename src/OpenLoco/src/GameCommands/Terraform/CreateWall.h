@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createWall(registers& regs);
+    uint32_t execute(const WallPlacementArgs& args, uint8_t flags);
 }
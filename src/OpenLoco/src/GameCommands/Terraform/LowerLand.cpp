@@ -13,6 +13,7 @@
 #include "Objects/LandObject.h"
 #include "Objects/ObjectManager.h"
 #include "ScenarioOptions.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -48,7 +49,7 @@ namespace OpenLoco::GameCommands
         }
 
         // Now modify only the elements matching this highest baseZ
-        auto totalCost = 0;
+        std::vector<TileManager::SurfaceHeightAdjustment> adjustments;
         for (const auto& tilePos : tileLoop)
         {
             auto tile = TileManager::get(tilePos);
@@ -68,15 +69,13 @@ namespace OpenLoco::GameCommands
                 slopeFlags &= ~SurfaceSlope::requiresHeightAdjustment;
             }
 
-            auto cost = TileManager::adjustSurfaceHeight(toWorldSpace(tilePos), targetBaseZ, slopeFlags, removedBuildings, flags);
-            if (cost == FAILURE)
-            {
-                return FAILURE;
-            }
-            else
-            {
-                totalCost += cost;
-            }
+            adjustments.push_back({ tilePos, static_cast<SmallZ>(targetBaseZ), slopeFlags });
+        }
+
+        const auto totalCost = TileManager::adjustSurfaceHeights(adjustments, removedBuildings, flags);
+        if (totalCost == FAILURE)
+        {
+            return FAILURE;
         }
 
         GameCommands::setExpenditureType(ExpenditureType::Construction);
@@ -393,6 +393,11 @@ namespace OpenLoco::GameCommands
         return _mtnToolCost;
     }
 
+    uint32_t execute(const LowerRaiseLandMountainArgs& args, const uint8_t flags)
+    {
+        return lowerRaiseLandMountain(args, flags);
+    }
+
     void lowerRaiseLandMountain(registers& regs)
     {
         const LowerRaiseLandMountainArgs args(regs);
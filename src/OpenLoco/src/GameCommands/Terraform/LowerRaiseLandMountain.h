@@ -36,4 +36,5 @@ namespace OpenLoco::GameCommands
     };
 
     void lowerRaiseLandMountain(registers& regs);
+    uint32_t execute(const LowerRaiseLandMountainArgs& args, uint8_t flags);
 }
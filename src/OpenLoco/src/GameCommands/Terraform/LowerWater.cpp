@@ -8,6 +8,7 @@
 #include "Map/TileManager.h"
 #include "Objects/ObjectManager.h"
 #include "ScenarioOptions.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -21,7 +22,7 @@ namespace OpenLoco::GameCommands
         // this prevents accidentally double counting their removal
         // cost if they span across multiple tiles.
         World::TileClearance::RemovedBuildings removedBuildings{};
-        auto totalCost = 0;
+        uint32_t totalCost = 0;
 
         if (flags & Flags::apply)
         {
@@ -46,6 +47,7 @@ namespace OpenLoco::GameCommands
         if (highestWaterHeight > 0)
         {
             // Now modify only the elements matching this highest water height
+            std::vector<TileManager::WaterHeightAdjustment> adjustments;
             for (const auto& tilePos : tileLoop)
             {
                 auto tile = World::TileManager::get(tilePos);
@@ -57,15 +59,13 @@ namespace OpenLoco::GameCommands
                 }
 
                 waterHeight -= kSmallZStep;
-                auto cost = TileManager::adjustWaterHeight(toWorldSpace(tilePos), waterHeight, removedBuildings, flags);
-                if (cost == FAILURE)
-                {
-                    return FAILURE;
-                }
-                else
-                {
-                    totalCost += cost;
-                }
+                adjustments.push_back({ tilePos, static_cast<SmallZ>(waterHeight) });
+            }
+
+            totalCost = TileManager::adjustWaterHeights(adjustments, removedBuildings, flags);
+            if (totalCost == FAILURE)
+            {
+                return FAILURE;
             }
         }
 
@@ -80,6 +80,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const LowerWaterArgs& args, const uint8_t flags)
+    {
+        return lowerWater(args, flags);
+    }
+
     void lowerWater(registers& regs)
     {
         const LowerWaterArgs args(regs);
@@ -29,4 +29,5 @@ namespace OpenLoco::GameCommands
     };
 
     void lowerWater(registers& regs);
+    uint32_t execute(const LowerWaterArgs& args, uint8_t flags);
 }
@@ -13,6 +13,7 @@
 #include "Objects/LandObject.h"
 #include "Objects/ObjectManager.h"
 #include "ScenarioOptions.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -46,7 +47,7 @@ namespace OpenLoco::GameCommands
         }
 
         // Now modify only the elements matching this lowest baseZ
-        auto totalCost = 0;
+        std::vector<TileManager::SurfaceHeightAdjustment> adjustments;
         for (const auto& tilePos : tileLoop)
         {
             auto tile = World::TileManager::get(tilePos);
@@ -64,15 +65,13 @@ namespace OpenLoco::GameCommands
                 slopeFlags &= ~SurfaceSlope::requiresHeightAdjustment;
             }
 
-            auto cost = TileManager::adjustSurfaceHeight(toWorldSpace(tilePos), targetBaseZ, slopeFlags, removedBuildings, flags);
-            if (cost == FAILURE)
-            {
-                return FAILURE;
-            }
-            else
-            {
-                totalCost += cost;
-            }
+            adjustments.push_back({ tilePos, static_cast<SmallZ>(targetBaseZ), slopeFlags });
+        }
+
+        const auto totalCost = TileManager::adjustSurfaceHeights(adjustments, removedBuildings, flags);
+        if (totalCost == FAILURE)
+        {
+            return FAILURE;
         }
 
         GameCommands::setExpenditureType(ExpenditureType::Construction);
@@ -9,6 +9,7 @@
 #include "Map/TileManager.h"
 #include "Objects/ObjectManager.h"
 #include "ScenarioOptions.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -22,7 +23,6 @@ namespace OpenLoco::GameCommands
         // this prevents accidentally double counting their removal
         // cost if they span across multiple tiles.
         World::TileClearance::RemovedBuildings removedBuildings{};
-        auto totalCost = 0;
 
         if (flags & Flags::apply)
         {
@@ -48,6 +48,7 @@ namespace OpenLoco::GameCommands
         }
 
         // Now modify only the elements matching this lowest baseZ
+        std::vector<TileManager::WaterHeightAdjustment> adjustments;
         for (const auto& tilePos : tileLoop)
         {
             auto tile = World::TileManager::get(tilePos);
@@ -74,15 +75,13 @@ namespace OpenLoco::GameCommands
                 }
             }
 
-            auto cost = TileManager::adjustWaterHeight(toWorldSpace(tilePos), waterHeight, removedBuildings, flags);
-            if (cost == FAILURE)
-            {
-                return FAILURE;
-            }
-            else
-            {
-                totalCost += cost;
-            }
+            adjustments.push_back({ tilePos, static_cast<SmallZ>(waterHeight) });
+        }
+
+        const auto totalCost = TileManager::adjustWaterHeights(adjustments, removedBuildings, flags);
+        if (totalCost == FAILURE)
+        {
+            return FAILURE;
         }
 
         if ((flags & Flags::apply) && totalCost > 0)
@@ -95,6 +94,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const RaiseWaterArgs& args, const uint8_t flags)
+    {
+        return raiseWater(args, flags);
+    }
+
     void raiseWater(registers& regs)
     {
         const RaiseWaterArgs args(regs);
@@ -29,4 +29,5 @@ namespace OpenLoco::GameCommands
     };
 
     void raiseWater(registers& regs);
+    uint32_t execute(const RaiseWaterArgs& args, uint8_t flags);
 }
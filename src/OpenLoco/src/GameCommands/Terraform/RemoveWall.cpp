@@ -73,6 +73,11 @@ namespace OpenLoco::GameCommands
         return 0;
     }
 
+    uint32_t execute(const WallRemovalArgs& args, const uint8_t flags)
+    {
+        return removeWall(args, flags);
+    }
+
     void removeWall(registers& regs)
     {
         const WallRemovalArgs args(regs);
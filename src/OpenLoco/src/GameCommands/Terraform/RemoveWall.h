@@ -30,4 +30,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeWall(registers& regs);
+    uint32_t execute(const WallRemovalArgs& args, uint8_t flags);
 }
@@ -75,7 +75,9 @@ namespace OpenLoco::GameCommands
                 auto tilePos = TilePos2(((rand >> 16) * kMapColumns) >> 16, ((rand & 0xFFFF) * kMapRows) >> 16);
                 Pos2 attemptPos = toWorldSpace(tilePos);
 
-                if (attemptPos.x < 384 || attemptPos.y < 384 || attemptPos.x > 11904 || attemptPos.y > 11904)
+                // Keep 12 tiles away from the edges of the map
+                constexpr auto kEdgeDistance = 12 * kTileSize;
+                if (attemptPos.x < kEdgeDistance || attemptPos.y < kEdgeDistance || attemptPos.x > kMapWidth - kEdgeDistance || attemptPos.y > kMapHeight - kEdgeDistance)
                 {
                     continue;
                 }
@@ -148,6 +150,7 @@ namespace OpenLoco::GameCommands
         {
             StringManager::emptyUserString(newTown->name);
             newTown->name = StringIds::null;
+            TownManager::removeTownFromClosestTownMap(newTown->id());
             return 0;
         }
 
@@ -182,6 +185,11 @@ namespace OpenLoco::GameCommands
         return 0;
     }
 
+    uint32_t execute(const TownPlacementArgs& args, const uint8_t flags)
+    {
+        return createTown(args, flags);
+    }
+
     void createTown(registers& regs)
     {
         TownPlacementArgs args(regs);
@@ -29,4 +29,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createTown(registers& regs);
+    uint32_t execute(const TownPlacementArgs& args, uint8_t flags);
 }
@@ -140,6 +140,7 @@ namespace OpenLoco::GameCommands
 
         StringManager::emptyUserString(town->name);
         town->name = StringIds::null;
+        TownManager::removeTownFromClosestTownMap(args.townId);
 
         Ui::Windows::TownList::removeTown(args.townId);
 
@@ -166,6 +167,11 @@ namespace OpenLoco::GameCommands
         return 0;
     }
 
+    uint32_t execute(const TownRemovalArgs& args, const uint8_t flags)
+    {
+        return removeTown(args, flags);
+    }
+
     void removeTown(registers& regs)
     {
         TownRemovalArgs args(regs);
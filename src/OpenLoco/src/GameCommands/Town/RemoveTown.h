@@ -25,4 +25,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeTown(registers& regs);
+    uint32_t execute(const TownRemovalArgs& args, uint8_t flags);
 }
@@ -321,6 +321,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const SignalPlacementArgs& args, const uint8_t flags)
+    {
+        return createSignal(args, flags);
+    }
+
     void createSignal(registers& regs)
     {
         regs.ebx = createSignal(SignalPlacementArgs(regs), regs.bl);
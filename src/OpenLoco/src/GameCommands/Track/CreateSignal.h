@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createSignal(registers& regs);
+    uint32_t execute(const SignalPlacementArgs& args, uint8_t flags);
 }
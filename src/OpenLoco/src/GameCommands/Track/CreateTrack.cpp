@@ -22,6 +22,8 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <optional>
+#include <sfl/static_vector.hpp>
 
 namespace OpenLoco::GameCommands
 {
@@ -337,6 +339,77 @@ namespace OpenLoco::GameCommands
         return World::TileClearance::ClearFuncResult::collision;
     }
 
+    namespace
+    {
+        struct PieceHeight
+        {
+            World::SmallZ baseZ;
+            World::SmallZ clearZ;
+            bool hasBridge;
+        };
+    }
+
+    // The height and bridge checks of a piece, these only read the surface element.
+    static std::optional<PieceHeight> getPieceHeight(const TrackPlacementArgs& args, const World::TrackData::PreviewTrack& piece, const World::Pos3& trackLoc)
+    {
+        const auto unk = Numerics::rotl4bit(enumValue(piece.flags) & 0xF, args.rotation);
+
+        if (trackLoc.z < 16)
+        {
+            setErrorText(StringIds::error_too_low);
+            return std::nullopt;
+        }
+
+        const auto baseZ = trackLoc.z / World::kSmallZStep;
+        auto clearZ = baseZ + (piece.clearZ + 32) / World::kSmallZStep;
+        bool hasBridge = false;
+
+        // Why aren't we just failing invalid???
+        if (World::validCoords(trackLoc))
+        {
+            const auto tile = World::TileManager::get(trackLoc);
+            auto* elSurface = tile.surface();
+            if (elSurface->water())
+            {
+                _byte_1136073 = _byte_1136073 | (1U << 7);
+            }
+
+            const bool requiresBridge = isBridgeRequired(baseZ, *elSurface, piece, unk);
+            if (requiresBridge)
+            {
+                // 0x0049BF1E
+                _byte_1136073 = _byte_1136073 | (1U << 0);
+                hasBridge = true;
+                World::MicroZ heightDiff = (baseZ - elSurface->baseZ()) / World::kMicroToSmallZStep;
+                if (args.bridge == 0xFFU)
+                {
+                    setErrorText(StringIds::bridge_needed);
+                    return std::nullopt;
+                }
+                auto* bridgeObj = ObjectManager::get<BridgeObject>(args.bridge);
+                if (heightDiff > bridgeObj->maxHeight)
+                {
+                    setErrorText(StringIds::too_far_above_ground_for_bridge_type);
+                    return std::nullopt;
+                }
+                _byte_1136074 = std::max(heightDiff, _byte_1136074);
+                if ((bridgeObj->disabledTrackCfg & World::TrackData::getTrackMiscData(args.trackId).flags) != CommonTraitFlags::none)
+                {
+                    setErrorText(StringIds::bridge_type_unsuitable_for_this_configuration);
+                    return std::nullopt;
+                }
+                clearZ += bridgeObj->clearHeight / World::kSmallZStep;
+            }
+        }
+        // 0x0049BF7C
+        if (clearZ > 236)
+        {
+            setErrorText(StringIds::error_too_high);
+            return std::nullopt;
+        }
+        return PieceHeight{ static_cast<World::SmallZ>(baseZ), static_cast<World::SmallZ>(clearZ), hasBridge };
+    }
+
     // 0x0049BB98
     static uint32_t createTrack(const TrackPlacementArgs& args, uint8_t flags)
     {
@@ -411,64 +484,28 @@ namespace OpenLoco::GameCommands
         auto& trackPieces = World::TrackData::getTrackPiece(args.trackId);
         World::TileClearance::RemovedBuildings removedBuildings;
 
+        // Every piece is height checked before any is cleared. A placement that can never fit, such as
+        // the AI trying without a bridge first, then fails without walking the tile elements or
+        // querying building removals.
+        sfl::static_vector<PieceHeight, World::TrackData::kMaxPreviewTrackTiles> pieceHeights;
         for (auto& piece : trackPieces)
         {
             const auto trackLoc = args.pos + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, args.rotation), piece.z };
-            const auto quarterTile = piece.subTileClearance.rotate(args.rotation);
-            const auto unk = Numerics::rotl4bit(enumValue(piece.flags) & 0xF, args.rotation);
-
-            if (trackLoc.z < 16)
+            const auto height = getPieceHeight(args, piece, trackLoc);
+            if (!height.has_value())
             {
-                setErrorText(StringIds::error_too_low);
                 return FAILURE;
             }
+            pieceHeights.push_back(*height);
+        }
 
-            const auto baseZ = trackLoc.z / World::kSmallZStep;
-            auto clearZ = baseZ + (piece.clearZ + 32) / World::kSmallZStep;
-            _byte_1136073 = _byte_1136073 & ~(1U << 1);
-
-            // Why aren't we just failing invalid???
-            if (World::validCoords(trackLoc))
-            {
-                const auto tile = World::TileManager::get(trackLoc);
-                auto* elSurface = tile.surface();
-                if (elSurface->water())
-                {
-                    _byte_1136073 = _byte_1136073 | (1U << 7);
-                }
-
-                const bool requiresBridge = isBridgeRequired(baseZ, *elSurface, piece, unk);
-                if (requiresBridge)
-                {
-                    // 0x0049BF1E
-                    _byte_1136073 = _byte_1136073 | (1U << 1) | (1U << 0);
-                    World::MicroZ heightDiff = (baseZ - elSurface->baseZ()) / World::kMicroToSmallZStep;
-                    if (args.bridge == 0xFFU)
-                    {
-                        setErrorText(StringIds::bridge_needed);
-                        return FAILURE;
-                    }
-                    auto* bridgeObj = ObjectManager::get<BridgeObject>(args.bridge);
-                    if (heightDiff > bridgeObj->maxHeight)
-                    {
-                        setErrorText(StringIds::too_far_above_ground_for_bridge_type);
-                        return FAILURE;
-                    }
-                    _byte_1136074 = std::max(heightDiff, _byte_1136074);
-                    if ((bridgeObj->disabledTrackCfg & World::TrackData::getTrackMiscData(args.trackId).flags) != CommonTraitFlags::none)
-                    {
-                        setErrorText(StringIds::bridge_type_unsuitable_for_this_configuration);
-                        return FAILURE;
-                    }
-                    clearZ += bridgeObj->clearHeight / World::kSmallZStep;
-                }
-            }
-            // 0x0049BF7C
-            if (clearZ > 236)
-            {
-                setErrorText(StringIds::error_too_high);
-                return FAILURE;
-            }
+        for (auto pieceIndex = 0U; pieceIndex < trackPieces.size(); ++pieceIndex)
+        {
+            const auto& piece = trackPieces[pieceIndex];
+            const auto trackLoc = args.pos + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, args.rotation), piece.z };
+            const auto quarterTile = piece.subTileClearance.rotate(args.rotation);
+            const auto [baseZ, clearZ, hasBridge] = pieceHeights[pieceIndex];
+            _byte_1136073 = hasBridge ? (_byte_1136073 | (1U << 1)) : (_byte_1136073 & ~(1U << 1));
 
             // 0x0113607C
             bool hasLevelCrossing = false;
@@ -600,6 +637,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const TrackPlacementArgs& args, const uint8_t flags)
+    {
+        return createTrack(args, flags);
+    }
+
     void createTrack(registers& regs)
     {
         regs.ebx = createTrack(TrackPlacementArgs(regs), regs.bl);
@@ -43,4 +43,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createTrack(registers& regs);
+    uint32_t execute(const TrackPlacementArgs& args, uint8_t flags);
 }
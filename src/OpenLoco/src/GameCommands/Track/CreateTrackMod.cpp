@@ -89,6 +89,11 @@ namespace OpenLoco::GameCommands
         return result.cost;
     }
 
+    uint32_t execute(const TrackModsPlacementArgs& args, const uint8_t flags)
+    {
+        return createTrackMod(args, flags);
+    }
+
     void createTrackMod(registers& regs)
     {
         regs.ebx = createTrackMod(TrackModsPlacementArgs(regs), regs.bl);
@@ -44,4 +44,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createTrackMod(registers& regs);
+    uint32_t execute(const TrackModsPlacementArgs& args, uint8_t flags);
 }
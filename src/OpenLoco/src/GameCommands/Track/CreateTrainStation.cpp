@@ -537,6 +537,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const TrainStationPlacementArgs& args, const uint8_t flags)
+    {
+        return createTrainStation(args, flags);
+    }
+
     void createTrainStation(registers& regs)
     {
         regs.ebx = createTrainStation(TrainStationPlacementArgs(regs), regs.bl);
@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void createTrainStation(registers& regs);
+    uint32_t execute(const TrainStationPlacementArgs& args, uint8_t flags);
 }
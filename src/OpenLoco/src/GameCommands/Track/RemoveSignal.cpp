@@ -180,6 +180,11 @@ namespace OpenLoco::GameCommands
         return cost;
     }
 
+    uint32_t execute(const SignalRemovalArgs& args, const uint8_t flags)
+    {
+        return removeSignal(args, flags);
+    }
+
     void removeSignal(registers& regs)
     {
         regs.ebx = removeSignal(SignalRemovalArgs(regs), regs.bl);
@@ -41,4 +41,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeSignal(registers& regs);
+    uint32_t execute(const SignalRemovalArgs& args, uint8_t flags);
 }
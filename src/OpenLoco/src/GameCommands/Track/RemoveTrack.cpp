@@ -244,6 +244,11 @@ namespace OpenLoco::GameCommands
         return totalRemovalCost;
     }
 
+    uint32_t execute(const TrackRemovalArgs& args, const uint8_t flags)
+    {
+        return removeTrack(args, flags);
+    }
+
     void removeTrack(registers& regs)
     {
         regs.ebx = removeTrack(TrackRemovalArgs(regs), regs.bl);
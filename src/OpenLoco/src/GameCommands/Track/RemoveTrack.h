@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeTrack(registers& regs);
+    uint32_t execute(const TrackRemovalArgs& args, uint8_t flags);
 }
@@ -80,6 +80,11 @@ namespace OpenLoco::GameCommands
         return cost;
     }
 
+    uint32_t execute(const TrackModsRemovalArgs& args, const uint8_t flags)
+    {
+        return removeTrackMod(args, flags);
+    }
+
     void removeTrackMod(registers& regs)
     {
         regs.ebx = removeTrackMod(TrackModsRemovalArgs(regs), regs.bl);
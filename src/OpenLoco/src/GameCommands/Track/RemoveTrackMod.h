@@ -42,4 +42,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeTrackMod(registers& regs);
+    uint32_t execute(const TrackModsRemovalArgs& args, uint8_t flags);
 }
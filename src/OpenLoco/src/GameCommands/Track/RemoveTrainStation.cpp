@@ -131,6 +131,11 @@ namespace OpenLoco::GameCommands
         return totalCost;
     }
 
+    uint32_t execute(const TrainStationRemovalArgs& args, const uint8_t flags)
+    {
+        return removeTrainStation(args, flags);
+    }
+
     void removeTrainStation(registers& regs)
     {
         regs.ebx = removeTrainStation(TrainStationRemovalArgs(regs), regs.bl);
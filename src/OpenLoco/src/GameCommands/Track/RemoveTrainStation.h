@@ -39,4 +39,5 @@ namespace OpenLoco::GameCommands
     };
 
     void removeTrainStation(registers& regs);
+    uint32_t execute(const TrainStationRemovalArgs& args, uint8_t flags);
 }
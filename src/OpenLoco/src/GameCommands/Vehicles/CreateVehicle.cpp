@@ -762,4 +762,9 @@ namespace OpenLoco::GameCommands
     {
         regs.ebx = createVehicle(regs.bl, regs.dx, EntityId(regs.di));
     }
+
+    EntityId getLastCreatedVehicleId()
+    {
+        return _113642A;
+    }
 }
@@ -28,4 +28,7 @@ namespace OpenLoco::GameCommands
     };
 
     void createVehicle(registers& regs);
+
+    // Head of the vehicle made by the last vehicleCreate that did not attach to an existing vehicle.
+    EntityId getLastCreatedVehicleId();
 }
@@ -10,6 +10,12 @@
 #include "S5/S5.h"
 #include "Vehicles/Vehicle.h"
 #include <OpenLoco/Core/FileStream.h>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Diagnostics;
 
@@ -30,6 +36,52 @@ namespace OpenLoco::GameSaveCompare
         return std::span<const std::byte>{ reinterpret_cast<const std::byte*>(std::addressof(item)), sizeof(T) };
     }
 
+    // Size of the blocks compared by the first pass, only a difference sends the comparison down the detailed path.
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    // Compares both ranges block by block spread over the available threads, returns the number of differing blocks.
+    static size_t countDivergentBlocks(std::span<const std::byte> lhs, std::span<const std::byte> rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return std::max(lhs.size(), rhs.size()) / kBlockSize + 1;
+        }
+
+        const auto numBlocks = (lhs.size() + kBlockSize - 1) / kBlockSize;
+        if (numBlocks == 0)
+        {
+            return 0;
+        }
+        const auto numThreads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, numBlocks);
+        const auto blocksPerThread = (numBlocks + numThreads - 1) / numThreads;
+
+        std::vector<size_t> numDivergent(numThreads);
+        const auto compareBlocks = [&](size_t threadIndex) {
+            const auto begin = threadIndex * blocksPerThread * kBlockSize;
+            const auto end = std::min(begin + blocksPerThread * kBlockSize, lhs.size());
+            for (auto offset = begin; offset < end; offset += kBlockSize)
+            {
+                const auto length = std::min(kBlockSize, end - offset);
+                if (std::memcmp(lhs.data() + offset, rhs.data() + offset, length) != 0)
+                {
+                    numDivergent[threadIndex]++;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < numThreads; i++)
+        {
+            threads.emplace_back(compareBlocks, i);
+        }
+        compareBlocks(0);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return std::accumulate(numDivergent.begin(), numDivergent.end(), size_t{ 0 });
+    }
+
     template<typename T>
     auto bitWiseEqual(const T& lhs, const T& rhs)
     {
@@ -85,6 +137,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (unsigned int offset = 0; offset < sizeof(lhs); offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 1)
@@ -100,6 +156,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (int offset = 0; offset < arraySize; offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 0)
@@ -115,6 +175,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (int offset = 0; offset < arraySize; offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 1)
@@ -392,6 +456,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (int offset = 0; offset < arraySize; offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = logDivergentEntityOffset(lhs[offset], rhs[offset], offset, displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 1)
@@ -408,6 +476,13 @@ namespace OpenLoco::GameSaveCompare
             Logging::info("display all divergences!");
         }
 
+        const auto numDivergentBlocks = countDivergentBlocks(getBytesSpan(gameState1), getBytesSpan(gameState2));
+        if (numDivergentBlocks == 0)
+        {
+            return true;
+        }
+        Logging::verbose("{} of the game state blocks diverge", numDivergentBlocks);
+
         bool foundDivergence = false;
 
         foundDivergence |= isLoggedDivergence("rng", gameState1.rng, gameState2.rng, 2, displayAllDivergences);
@@ -577,15 +652,12 @@ namespace OpenLoco::GameSaveCompare
 
     bool compareElements(const std::vector<S5::TileElement>& tileElements1, const std::vector<S5::TileElement>& tileElements2, bool displayAllDivergences)
     {
-        long divergentBytesTotal = 0;
-        std::vector<S5::TileElement> smaller = tileElements1;
-        std::vector<S5::TileElement> larger = tileElements2;
-        if (tileElements1.size() > tileElements2.size())
+        if (countDivergentBlocks(std::as_bytes(std::span(tileElements1)), std::as_bytes(std::span(tileElements2))) == 0)
         {
-            smaller = tileElements2;
-            larger = tileElements1;
+            return true;
         }
 
+        long divergentBytesTotal = 0;
         if (tileElements1.size() != tileElements2.size())
         {
             Logging::info("The TileElements sizes are different.");
@@ -596,17 +668,16 @@ namespace OpenLoco::GameSaveCompare
         int elementCount = 0;
         auto iterator1 = tileElements1.begin();
         auto iterator2 = tileElements2.begin();
-        for (auto y = 0; y < 384; ++y)
+        for (auto y = 0; y < World::kMapRows; ++y)
         {
-            for (auto x = 0; x < 384; ++x)
+            for (auto x = 0; x < World::kMapColumns; ++x)
             {
                 auto allElementsOnTile = [](auto& iter) {
-                    std::vector<S5::TileElement> ts;
-                    do
+                    const auto* first = &*iter;
+                    while (!iter++->isLast())
                     {
-                        ts.push_back(*iter);
-                    } while (!iter++->isLast());
-                    return ts;
+                    }
+                    return std::span<const S5::TileElement>(first, &*(iter - 1) + 1);
                 };
                 const auto t1s = allElementsOnTile(iterator1);
                 const auto t2s = allElementsOnTile(iterator2);
@@ -4,6 +4,8 @@
 #include "DrawSpriteHelper.hpp"
 #include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
+#include <OpenLoco/Gfx/DrawSpriteRow.hpp>
+#include <algorithm>
 
 namespace OpenLoco::Gfx
 {
@@ -22,7 +24,40 @@ namespace OpenLoco::Gfx
         dst += dstLineWidth * args.dstPos.y + args.dstPos.x;
 
         constexpr auto zoom = 1 << TZoomLevel;
-        if constexpr ((TBlendOp & DrawBlendOp::noiseMask) != DrawBlendOp::none)
+        constexpr bool isPlainCopy = (TBlendOp & (DrawBlendOp::src | DrawBlendOp::dst)) == DrawBlendOp::none && TZoomLevel == 0;
+        if constexpr (isPlainCopy && (TBlendOp & DrawBlendOp::transparent) != DrawBlendOp::none)
+        {
+            // Every pixel is sampled and none go through the palette map so whole rows can be done at once
+            [[maybe_unused]] const uint8_t* noiseMask = nullptr;
+            if constexpr ((TBlendOp & DrawBlendOp::noiseMask) != DrawBlendOp::none)
+            {
+                noiseMask = args.noiseImage->offset + ((static_cast<size_t>(g1.width) * args.srcPos.y) + args.srcPos.x);
+            }
+            for (; height > 0; height--)
+            {
+                if constexpr ((TBlendOp & DrawBlendOp::noiseMask) != DrawBlendOp::none)
+                {
+                    DrawSpriteRow::copyTransparentMasked(src, noiseMask, dst, width);
+                    noiseMask += srcLineWidth;
+                }
+                else
+                {
+                    DrawSpriteRow::copyTransparent(src, dst, width);
+                }
+                src += srcLineWidth;
+                dst += dstLineWidth;
+            }
+        }
+        else if constexpr (isPlainCopy && (TBlendOp & DrawBlendOp::noiseMask) == DrawBlendOp::none)
+        {
+            for (; height > 0; height--)
+            {
+                std::copy_n(src, width, dst);
+                src += srcLineWidth;
+                dst += dstLineWidth;
+            }
+        }
+        else if constexpr ((TBlendOp & DrawBlendOp::noiseMask) != DrawBlendOp::none)
         {
             const auto* noiseMask = args.noiseImage->offset + ((static_cast<size_t>(g1.width) * args.srcPos.y) + args.srcPos.x);
             for (; height > 0; height -= zoom)
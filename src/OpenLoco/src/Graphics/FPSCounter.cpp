@@ -1,11 +1,15 @@
 #include "FPSCounter.h"
+#include "Config.h"
 #include "Graphics/Colour.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/SoftwareDrawingEngine.h"
 #include "Graphics/TextRenderer.h"
 #include "Localisation/Formatting.h"
 #include "Ui.h"
+#include "Ui/WindowManager.h"
+#include "ViewportManager.h"
 
+#include <algorithm>
 #include <chrono>
 #include <stdio.h>
 
@@ -18,6 +22,25 @@ namespace OpenLoco::Gfx
     static uint32_t _currentFrameCount;
     static float _currentFPS;
 
+    // Amount of frames the frame time statistics and graph cover.
+    static constexpr size_t kFrameWindow = 128;
+
+    struct FrameSample
+    {
+        float total;
+        std::array<float, kFramePhaseCount> phases;
+    };
+
+    static std::array<FrameSample, kFrameWindow> _frameSamples{};
+    static std::array<float, kFramePhaseCount> _currentPhases{};
+    static size_t _frameWriteIndex = 0;
+    static size_t _numFrameSamples = 0;
+    static TimePoint_t _lastFrameEnd;
+
+    static constexpr int32_t kGraphHeight = 50;
+    // Frame times above this are clipped in the graph, twice the time of a frame at 40 FPS.
+    static constexpr float kGraphMaxMs = 50.0f;
+
     static float measureFPS()
     {
         _currentFrameCount++;
@@ -35,6 +58,155 @@ namespace OpenLoco::Gfx
         return _currentFPS;
     }
 
+    void recordFramePhase(FramePhase phase, float elapsedMs)
+    {
+        _currentPhases[static_cast<size_t>(phase)] += elapsedMs;
+    }
+
+    void endFrame()
+    {
+        const auto now = Clock_t::now();
+        const auto isFirstFrame = _lastFrameEnd == TimePoint_t{};
+        const auto total = std::chrono::duration<float, std::milli>(now - _lastFrameEnd).count();
+        _lastFrameEnd = now;
+
+        // Viewports are painted as part of drawing, only keep the remainder in draw.
+        auto& draw = _currentPhases[static_cast<size_t>(FramePhase::draw)];
+        draw = std::max(0.0f, draw - _currentPhases[static_cast<size_t>(FramePhase::paint)]);
+
+        if (!isFirstFrame)
+        {
+            _frameSamples[_frameWriteIndex] = FrameSample{ total, _currentPhases };
+            _frameWriteIndex = (_frameWriteIndex + 1) % kFrameWindow;
+            _numFrameSamples = std::min(_numFrameSamples + 1, kFrameWindow);
+        }
+        _currentPhases.fill(0.0f);
+    }
+
+    FrameStats getFrameStats()
+    {
+        FrameStats stats{};
+        if (_numFrameSamples == 0)
+        {
+            return stats;
+        }
+
+        std::array<float, kFrameWindow> sorted{};
+        for (size_t i = 0; i < _numFrameSamples; i++)
+        {
+            const auto& sample = _frameSamples[i];
+            sorted[i] = sample.total;
+            for (size_t j = 0; j < kFramePhaseCount; j++)
+            {
+                stats.phaseAvg[j] += sample.phases[j];
+            }
+        }
+        for (auto& avg : stats.phaseAvg)
+        {
+            avg /= _numFrameSamples;
+        }
+
+        const auto getPercentile = [&](size_t percentile) {
+            const auto index = std::min(_numFrameSamples - 1, (_numFrameSamples * percentile) / 100);
+            std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + _numFrameSamples);
+            return sorted[index];
+        };
+        stats.p50 = getPercentile(50);
+        stats.p95 = getPercentile(95);
+        stats.p99 = getPercentile(99);
+        stats.numSamples = static_cast<uint32_t>(_numFrameSamples);
+        return stats;
+    }
+
+    static PaletteIndex_t getFrameTimeColour(float ms)
+    {
+        if (ms <= 1000.0f / 40.0f)
+        {
+            return PaletteIndex::green9;
+        }
+        if (ms <= 1000.0f / 20.0f)
+        {
+            return PaletteIndex::yellow9;
+        }
+        return PaletteIndex::mutedDarkRed9;
+    }
+
+    // Draws the frame time statistics below the FPS counter, returns the area covered.
+    static Ui::Rect drawFrameTimes(DrawingContext& drawingCtx, int16_t top)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+        const auto stats = getFrameStats();
+
+        const auto graphWidth = static_cast<int16_t>(kFrameWindow * 2);
+        const auto left = static_cast<int16_t>(Ui::width() / 2 - graphWidth / 2);
+
+        char buffer[160];
+        buffer[0] = ControlCodes::Font::small;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = ControlCodes::Colour::white;
+        snprintf(&buffer[3], std::size(buffer) - 3, "p50 %.1f  p95 %.1f  p99 %.1f ms", stats.p50, stats.p95, stats.p99);
+        tr.drawString(Ui::Point(left, top), Colour::black, buffer);
+        auto right = std::max<int32_t>(left + graphWidth, left + tr.getStringWidth(buffer));
+
+        snprintf(
+            &buffer[3],
+            std::size(buffer) - 3,
+            "tick %.1f  paint %.1f  draw %.1f  present %.1f ms",
+            stats.phaseAvg[static_cast<size_t>(FramePhase::tick)],
+            stats.phaseAvg[static_cast<size_t>(FramePhase::paint)],
+            stats.phaseAvg[static_cast<size_t>(FramePhase::draw)],
+            stats.phaseAvg[static_cast<size_t>(FramePhase::present)]);
+        tr.drawString(Ui::Point(left, top + 8), Colour::black, buffer);
+        right = std::max<int32_t>(right, left + tr.getStringWidth(buffer));
+
+        // Window invalidations of the previous frame, the busiest window type hints at the subsystem spamming them.
+        const auto invalidations = Ui::WindowManager::getInvalidationStats();
+        const auto entityInvalidations = Ui::ViewportManager::getEntityInvalidationStats();
+        snprintf(
+            &buffer[3],
+            std::size(buffer) - 3,
+            "invalidations %u  applied %u  busiest window type %u (%u)  entity rects %u  merged %u",
+            invalidations.numRequested,
+            invalidations.numApplied,
+            static_cast<uint32_t>(invalidations.busiestType),
+            invalidations.busiestTypeRequests,
+            entityInvalidations.numRequested,
+            entityInvalidations.numApplied);
+        tr.drawString(Ui::Point(left, top + 16), Colour::black, buffer);
+        right = std::max<int32_t>(right, left + tr.getStringWidth(buffer));
+
+        // Paint time of each viewport, the slowest of the other viewports after the main one.
+        const auto paintStats = Ui::ViewportManager::getPaintStats();
+        auto length = snprintf(&buffer[3], std::size(buffer) - 3, "viewports main %.1f", paintStats.mainMs);
+        for (uint32_t i = 0; i < paintStats.numListed; i++)
+        {
+            length += snprintf(&buffer[3 + length], std::size(buffer) - 3 - length, "  %.1f", paintStats.secondaryMs[i]);
+        }
+        snprintf(
+            &buffer[3 + length],
+            std::size(buffer) - 3 - length,
+            " ms%s%s",
+            paintStats.numSecondary > paintStats.numListed ? "  ..." : "",
+            paintStats.isReducedRefresh ? "  reduced refresh" : "");
+        tr.drawString(Ui::Point(left, top + 24), Colour::black, buffer);
+        right = std::max<int32_t>(right, left + tr.getStringWidth(buffer));
+
+        // Oldest frame on the left, two pixels per frame.
+        const auto graphTop = static_cast<int16_t>(top + 34);
+        const auto graphBottom = static_cast<int16_t>(graphTop + kGraphHeight - 1);
+        drawingCtx.fillRect(left, graphTop, left + graphWidth - 1, graphBottom, PaletteIndex::black0, RectFlags::none);
+        for (size_t i = 0; i < _numFrameSamples; i++)
+        {
+            const auto index = (_frameWriteIndex + kFrameWindow - _numFrameSamples + i) % kFrameWindow;
+            const auto ms = _frameSamples[index].total;
+            const auto barHeight = static_cast<int16_t>(std::clamp(ms / kGraphMaxMs, 0.0f, 1.0f) * (kGraphHeight - 1)) + 1;
+            const auto x = static_cast<int16_t>(left + (kFrameWindow - _numFrameSamples + i) * 2);
+            drawingCtx.fillRect(x, graphBottom - barHeight + 1, x + 1, graphBottom, getFrameTimeColour(ms), RectFlags::none);
+        }
+
+        return Ui::Rect::fromLTRB(left, top, static_cast<int16_t>(right), graphBottom + 1);
+    }
+
     void drawFPS(DrawingContext& drawingCtx)
     {
         auto tr = Gfx::TextRenderer(drawingCtx);
@@ -58,5 +230,11 @@ namespace OpenLoco::Gfx
 
         // Make area dirty so the text doesn't get drawn over the last
         invalidateRegion(point.x, point.y, point.x + stringWidth, point.y + 16);
+
+        if (Config::get().showFrameTimes)
+        {
+            const auto area = drawFrameTimes(drawingCtx, point.y + 14);
+            invalidateRegion(area.left(), area.top(), area.right(), area.bottom());
+        }
     }
 }
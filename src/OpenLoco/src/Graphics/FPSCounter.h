@@ -1,8 +1,63 @@
 #pragma once
 
+#include <OpenLoco/Core/Timer.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace OpenLoco::Gfx
 {
     class DrawingContext;
 
+    // Parts of a frame that are timed individually.
+    enum class FramePhase : uint8_t
+    {
+        tick,
+        paint, // Painting of viewports.
+        draw,  // Rendering of everything else, the paint time is excluded.
+        present,
+        count,
+    };
+
+    static constexpr auto kFramePhaseCount = static_cast<size_t>(FramePhase::count);
+
+    struct FrameStats
+    {
+        float p50{};
+        float p95{};
+        float p99{};
+        std::array<float, kFramePhaseCount> phaseAvg{};
+        uint32_t numSamples{};
+    };
+
+    // Accumulates time spent in a phase of the current frame, phases may be entered more than once per frame.
+    void recordFramePhase(FramePhase phase, float elapsedMs);
+
+    // Measures the time between construction and destruction and records it against the frame phase.
+    class FramePhaseTimer
+    {
+        Core::Timer _timer;
+        FramePhase _phase;
+
+    public:
+        explicit FramePhaseTimer(FramePhase phase)
+            : _phase{ phase }
+        {
+        }
+
+        ~FramePhaseTimer()
+        {
+            recordFramePhase(_phase, _timer.elapsed());
+        }
+
+        FramePhaseTimer(const FramePhaseTimer&) = delete;
+        FramePhaseTimer& operator=(const FramePhaseTimer&) = delete;
+    };
+
+    // Called once a frame has been presented, the frame time is the time since the previous call.
+    void endFrame();
+
+    FrameStats getFrameStats();
+
     void drawFPS(DrawingContext& drawingCtx);
 }
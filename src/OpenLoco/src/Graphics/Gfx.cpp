@@ -6,21 +6,27 @@
 #include "Graphics/DrawSprite.h"
 #include "Graphics/RenderTarget.h"
 #include "Graphics/SoftwareDrawingEngine.h"
+#include "Graphics/SpriteCache.h"
+#include "Graphics/TextRenderer.h"
 #include "ImageIds.h"
 #include "Input.h"
 #include "Localisation/Formatting.h"
 #include "Localisation/LanguageFiles.h"
 #include "Localisation/StringManager.h"
 #include "Logging.h"
+#include "MemoryAccounting.h"
 #include "Objects/CurrencyObject.h"
+#include "Objects/ObjectImageTable.h"
 #include "Objects/ObjectManager.h"
 #include "PaletteMap.h"
 #include "SceneManager.h"
 #include "Ui.h"
+#include "Ui/Chart.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/Stream.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Platform/Platform.h>
 #include <algorithm>
 #include <cassert>
 #include <fstream>
@@ -36,15 +42,21 @@ using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::Gfx
 {
-    constexpr uint32_t kG1CountTemporary = 0x1000;
+    constexpr uint32_t kG1CountTemporary = G1ExpectedCount::kTemporary;
 
     // 0x009E2424
     static std::array<G1Element, G1ExpectedCount::kDisc + kG1CountTemporary + G1ExpectedCount::kObjects> _g1Elements;
 
     static std::unique_ptr<std::byte[]> _g1Buffer;
+    static size_t _g1BufferSize = 0;
+    // When available the element data is used straight from the mapped file instead of _g1Buffer,
+    // so only the pages of sprites that are actually drawn get read from disk.
+    static Platform::FileMapping _g1Mapping;
 
     // 0x0112C884
     static std::array<std::array<uint8_t, 224>, 4> _characterWidths;
+    static uint32_t _characterWidthsVersion = 0;
+    static uint32_t _invalidationGeneration = 0;
 
     // 0x0113ED20
     static std::array<PaletteEntry, 256> _rgbaPalette;
@@ -110,13 +122,38 @@ namespace OpenLoco::Gfx
         }
         auto elements = convertElements(elements32);
 
-        // Read element data
-        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
-        if (!readData(stream, elementData.get(), header.totalSize))
+        // Map or read element data
+        const auto dataOffset = static_cast<size_t>(stream.tellg());
+        stream.close();
+
+        Platform::unmapFile(_g1Mapping);
+        _g1Buffer.reset();
+        _g1BufferSize = 0;
+
+        const std::byte* elementData = nullptr;
+        auto mapping = Platform::mapFile(g1Path);
+        if (mapping.data != nullptr && mapping.size >= dataOffset + header.totalSize)
         {
-            throw Exception::RuntimeError("Reading g1 elements failed.");
+            _g1Mapping = mapping;
+            elementData = mapping.data + dataOffset;
+        }
+        else
+        {
+            Platform::unmapFile(mapping);
+            Logging::verbose("Unable to map g1 file, reading element data into memory.");
+
+            stream.open(g1Path, std::ios::in | std::ios::binary);
+            stream.seekg(dataOffset);
+            auto buffer = std::make_unique<std::byte[]>(header.totalSize);
+            if (!stream || !readData(stream, buffer.get(), header.totalSize))
+            {
+                throw Exception::RuntimeError("Reading g1 elements failed.");
+            }
+            stream.close();
+            elementData = buffer.get();
+            _g1Buffer = std::move(buffer);
+            _g1BufferSize = header.totalSize;
         }
-        stream.close();
 
         // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant
         // This code copies the closest variants into their place, and moves other elements accordingly
@@ -154,11 +191,17 @@ namespace OpenLoco::Gfx
         // Adjust memory offsets
         for (auto& element : elements)
         {
-            element.offset += (uintptr_t)elementData.get();
+            element.offset += (uintptr_t)elementData;
         }
 
-        _g1Buffer = std::move(elementData);
         std::copy(elements.begin(), elements.end(), _g1Elements.begin());
+
+        PaletteMap::buildSecondaryMaps();
+
+        // Mapped element data only takes up memory for the pages that have been read, it is counted in full
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::g1Data, []() -> size_t {
+            return sizeof(_g1Elements) + _g1BufferSize + _g1Mapping.size;
+        });
     }
 
     static int32_t getFontBaseIndex(Font font)
@@ -209,11 +252,16 @@ namespace OpenLoco::Gfx
                 _characterWidths[enumValue(font.offset) / 224][i] = width;
             }
         }
+        _characterWidthsVersion++;
         // Vanilla setup scrolling text related globals here (unused)
     }
 
     void initialise()
     {
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::caches, []() -> size_t {
+            return SpriteCache::getStats().memoryUsed + TextRenderer::getCacheMemoryUsage();
+        });
+
         initialiseCharacterWidths();
 
         loadDefaultPalette();
@@ -226,6 +274,8 @@ namespace OpenLoco::Gfx
     // 0x004CD406
     void invalidateScreen()
     {
+        // Full screen invalidations follow language, currency and other global changes
+        Ui::invalidateGraphImages();
         invalidateRegion(0, 0, Ui::width(), Ui::height());
     }
 
@@ -250,9 +300,15 @@ namespace OpenLoco::Gfx
      */
     void invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
     {
+        _invalidationGeneration++;
         getDrawingEngine().invalidateRegion(left, top, right, bottom);
     }
 
+    uint32_t getInvalidationGeneration()
+    {
+        return _invalidationGeneration;
+    }
+
     // 0x004C5CFA
     void render()
     {
@@ -314,6 +370,7 @@ namespace OpenLoco::Gfx
         const auto id = getImageIndex(imageId);
         if (id < _g1Elements.size())
         {
+            ObjectManager::ensureImageLoaded(id);
             return &_g1Elements[id];
         }
         return nullptr;
@@ -501,6 +558,12 @@ namespace OpenLoco::Gfx
     void setCharacterWidth(Font font, char32_t character, int16_t width)
     {
         _characterWidths[getFontBaseIndex(font) / 224][character - 32] = width;
+        _characterWidthsVersion++;
+    }
+
+    uint32_t getCharacterWidthsVersion()
+    {
+        return _characterWidthsVersion;
     }
 
     ImageId getImageForCharacter(Font font, char32_t character)
@@ -31,6 +31,7 @@ namespace OpenLoco::Gfx
         constexpr uint32_t kDisc = 0x101A; // And GOG
         constexpr uint32_t kSteam = 0x0F38;
         constexpr uint32_t kObjects = 0x40000;
+        constexpr uint32_t kTemporary = 0x1000;
     }
 #pragma pack(push, 1)
 
@@ -158,6 +159,10 @@ namespace OpenLoco::Gfx
     // Invalidate a region of the screen.
     void invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
 
+    // Changes whenever any region of the screen is invalidated, allowing results derived from the
+    // visible scene to be cached until it changes.
+    uint32_t getInvalidationGeneration();
+
     // Renders all invalidated regions the next frame.
     void render();
 
@@ -184,5 +189,7 @@ namespace OpenLoco::Gfx
 
     int16_t getCharacterWidth(Font font, char32_t character);
     void setCharacterWidth(Font font, char32_t character, int16_t width);
+    // Changes whenever a character width is set, allowing measured string widths to be cached.
+    uint32_t getCharacterWidthsVersion();
     ImageId getImageForCharacter(Font font, char32_t character);
 }
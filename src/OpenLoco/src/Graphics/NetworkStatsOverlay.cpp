@@ -0,0 +1,102 @@
+#include "NetworkStatsOverlay.h"
+#include "Graphics/Colour.h"
+#include "Graphics/Gfx.h"
+#include "Graphics/SoftwareDrawingEngine.h"
+#include "Graphics/TextRenderer.h"
+#include "Localisation/Formatting.h"
+#include "Network/Network.h"
+#include "Network/NetworkStats.h"
+#include "Ui.h"
+
+#include <algorithm>
+#include <stdio.h>
+
+namespace OpenLoco::Gfx
+{
+    // Below the top toolbar
+    static constexpr int16_t kLeft = 4;
+    static constexpr int16_t kTop = 32;
+    static constexpr int16_t kLineHeight = 8;
+
+    void drawNetworkStats(DrawingContext& drawingCtx)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+        const auto stats = Network::getStats();
+
+        char buffer[160];
+        buffer[0] = ControlCodes::Font::small;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = ControlCodes::Colour::white;
+
+        auto top = kTop;
+        int32_t right = kLeft;
+        const auto drawLine = [&]() {
+            tr.drawString(Ui::Point(kLeft, top), Colour::black, buffer);
+            right = std::max<int32_t>(right, kLeft + tr.getStringWidth(buffer));
+            top += kLineHeight;
+        };
+
+        Network::PacketCounters totalSent;
+        Network::PacketCounters totalReceived;
+        for (size_t i = 0; i < Network::kPacketKindCount; i++)
+        {
+            totalSent.numPackets += stats.sent[i].numPackets;
+            totalSent.numBytes += stats.sent[i].numBytes;
+            totalReceived.numPackets += stats.received[i].numPackets;
+            totalReceived.numBytes += stats.received[i].numBytes;
+        }
+
+        snprintf(
+            &buffer[3],
+            std::size(buffer) - 3,
+            "sent %llu (%llu KiB)  received %llu (%llu KiB)  resends %llu",
+            static_cast<unsigned long long>(totalSent.numPackets),
+            static_cast<unsigned long long>(totalSent.numBytes / 1024),
+            static_cast<unsigned long long>(totalReceived.numPackets),
+            static_cast<unsigned long long>(totalReceived.numBytes / 1024),
+            static_cast<unsigned long long>(stats.numResends));
+        drawLine();
+
+        snprintf(&buffer[3], std::size(buffer) - 3, "ticks behind server %lld  command queue %zu", static_cast<long long>(stats.ticksBehindServer), stats.commandQueueDepth);
+        drawLine();
+
+        for (const auto& peer : stats.peers)
+        {
+            const auto& connection = peer.connection;
+            snprintf(
+                &buffer[3],
+                std::size(buffer) - 3,
+                "%s  rtt %u ms (var %u)  rto %u ms  in flight %zu  resends %u",
+                peer.name.c_str(),
+                connection.roundTripTime,
+                connection.roundTripTimeVariance,
+                connection.retransmitTimeout,
+                connection.numPacketsInFlight,
+                connection.numResends);
+            drawLine();
+        }
+
+        for (size_t i = 0; i < Network::kPacketKindCount; i++)
+        {
+            const auto& sent = stats.sent[i];
+            const auto& received = stats.received[i];
+            if (sent.numPackets == 0 && received.numPackets == 0)
+            {
+                continue;
+            }
+            snprintf(
+                &buffer[3],
+                std::size(buffer) - 3,
+                "%s  sent %llu (%llu B)  received %llu (%llu B)",
+                Network::getPacketKindName(static_cast<Network::PacketKind>(i)),
+                static_cast<unsigned long long>(sent.numPackets),
+                static_cast<unsigned long long>(sent.numBytes),
+                static_cast<unsigned long long>(received.numPackets),
+                static_cast<unsigned long long>(received.numBytes));
+            drawLine();
+        }
+
+        // Make area dirty so the text doesn't get drawn over the last
+        invalidateRegion(kLeft, kTop, right, top);
+    }
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace OpenLoco::Gfx
+{
+    class DrawingContext;
+
+    // Draws the packet counters, connection round trip times and game command queue in the top left.
+    void drawNetworkStats(DrawingContext& drawingCtx);
+}
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cstring>
 #include <numeric>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -171,9 +172,12 @@ namespace OpenLoco::Gfx::PaletteMap
         return data;
     }();
 
-    // This buffer is used when sprites are drawn with a secondary palette.
-    // TODO: Make this thread safe via thread_local if multi-threading is implemented.
-    static auto _secondaryPaletteMapBuffer = _defaultPaletteMapBuffer;
+    static constexpr size_t kNumColours = enumValue(Colour::max);
+
+    // Palette maps used when sprites are drawn with a secondary colour, indexed by primary * kNumColours + secondary.
+    // These are built once up front rather than combined on every draw, which also makes them safe to use from
+    // multiple paint threads.
+    static std::vector<Buffer<kDefaultSize>> _secondaryPaletteMaps;
 
     View getDefault()
     {
@@ -226,22 +230,11 @@ namespace OpenLoco::Gfx::PaletteMap
 
         if (image.hasSecondary())
         {
-            // Combines portions of two different palettes into the global palette map.
-            auto& paletteMap = _secondaryPaletteMapBuffer;
-            const auto primaryMap = getForColour(Colours::toExt(image.getPrimary()));
-            const auto secondaryMap = getForColour(Colours::toExt(image.getSecondary()));
-            if (!primaryMap || !secondaryMap)
-            {
-                assert(false);
-            }
-
-            // Remap sections are split into two bits for primary
-            copyPaletteMapData(paletteMap, PaletteIndex::primaryRemap0, *primaryMap, PaletteIndex::primaryRemap0, (PaletteIndex::primaryRemap2 - PaletteIndex::primaryRemap0 + 1));
-            copyPaletteMapData(paletteMap, PaletteIndex::primaryRemap3, *primaryMap, PaletteIndex::primaryRemap3, (PaletteIndex::primaryRemapB - PaletteIndex::primaryRemap3 + 1));
-            copyPaletteMapData(paletteMap, PaletteIndex::secondaryRemap0, *secondaryMap, PaletteIndex::primaryRemap0, (PaletteIndex::primaryRemap2 - PaletteIndex::primaryRemap0 + 1));
-            copyPaletteMapData(paletteMap, PaletteIndex::secondaryRemap3, *secondaryMap, PaletteIndex::primaryRemap3, (PaletteIndex::primaryRemapB - PaletteIndex::primaryRemap3 + 1));
-
-            return paletteMap;
+            const auto primary = enumValue(image.getPrimary());
+            const auto secondary = enumValue(image.getSecondary());
+            const auto index = static_cast<size_t>(primary) * kNumColours + secondary;
+            assert(index < _secondaryPaletteMaps.size());
+            return _secondaryPaletteMaps[index];
         }
         else
         {
@@ -264,4 +257,30 @@ namespace OpenLoco::Gfx::PaletteMap
         _paletteToG1Offset[enumValue(paletteId)] = imageId;
     }
 
+    void buildSecondaryMaps()
+    {
+        _secondaryPaletteMaps.assign(kNumColours * kNumColours, _defaultPaletteMapBuffer);
+
+        for (size_t primary = 0; primary < kNumColours; primary++)
+        {
+            const auto primaryMap = getForColour(Colours::toExt(static_cast<Colour>(primary)));
+            for (size_t secondary = 0; secondary < kNumColours; secondary++)
+            {
+                const auto secondaryMap = getForColour(Colours::toExt(static_cast<Colour>(secondary)));
+                if (!primaryMap || !secondaryMap)
+                {
+                    assert(false);
+                    continue;
+                }
+
+                // Combines portions of two different palettes, remap sections are split into two bits for primary
+                auto& paletteMap = _secondaryPaletteMaps[primary * kNumColours + secondary];
+                copyPaletteMapData(paletteMap, PaletteIndex::primaryRemap0, *primaryMap, PaletteIndex::primaryRemap0, (PaletteIndex::primaryRemap2 - PaletteIndex::primaryRemap0 + 1));
+                copyPaletteMapData(paletteMap, PaletteIndex::primaryRemap3, *primaryMap, PaletteIndex::primaryRemap3, (PaletteIndex::primaryRemapB - PaletteIndex::primaryRemap3 + 1));
+                copyPaletteMapData(paletteMap, PaletteIndex::secondaryRemap0, *secondaryMap, PaletteIndex::primaryRemap0, (PaletteIndex::primaryRemap2 - PaletteIndex::primaryRemap0 + 1));
+                copyPaletteMapData(paletteMap, PaletteIndex::secondaryRemap3, *secondaryMap, PaletteIndex::primaryRemap3, (PaletteIndex::primaryRemapB - PaletteIndex::primaryRemap3 + 1));
+            }
+        }
+    }
+
 }
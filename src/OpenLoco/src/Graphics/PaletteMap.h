@@ -28,4 +28,7 @@ namespace OpenLoco::Gfx::PaletteMap
     std::optional<View> getForImage(const ImageId image);
 
     void setEntryImage(ExtColour paletteId, uint32_t imageId);
+
+    // Combines the palette maps of every primary and secondary colour pair, has to be called after the G1 has been loaded.
+    void buildSecondaryMaps();
 }
@@ -5,6 +5,7 @@
 #include "Graphics/ImageIds.h"
 #include "Localisation/Formatting.h"
 #include "RenderTarget.h"
+#include "SpriteCache.h"
 #include "TextRenderer.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
@@ -219,6 +220,24 @@ namespace OpenLoco::Gfx
         template<uint8_t TZoomLevel, bool TIsRLE>
         static void drawImagePaletteSet(const RenderTarget& rt, const Ui::Point& pos, const ImageId& image, const G1Element& element, const PaletteMap::View palette, const G1Element* noiseImage)
         {
+            // Every pixel is sampled at zoom level 0 so drawing the decoded bitmap gives identical results.
+            if constexpr (TZoomLevel == 0 && TIsRLE)
+            {
+                if (const auto decoded = SpriteCache::get(element))
+                {
+                    auto args = getDrawImagePosArgs<TZoomLevel, false>(rt, pos, decoded->element);
+                    if (args.has_value())
+                    {
+                        // The blend op is taken from the RLE image as vanilla never applied noise masks to those.
+                        const DrawSpriteArgs rleArgs{ palette, element, args->srcPos, args->dstPos, args->size, noiseImage };
+                        const auto op = getDrawBlendOp(image, rleArgs) | DrawBlendOp::transparent;
+                        const DrawSpriteArgs fullArgs{ palette, decoded->element, args->srcPos, args->dstPos, args->size, nullptr };
+                        drawSpriteToBuffer<TZoomLevel, false>(rt, fullArgs, op);
+                    }
+                    return;
+                }
+            }
+
             auto args = getDrawImagePosArgs<TZoomLevel, TIsRLE>(rt, pos, element);
             if (args.has_value())
             {
@@ -1,10 +1,14 @@
 #include "SoftwareDrawingEngine.h"
 #include "Config.h"
 #include "Graphics/FPSCounter.h"
+#include "Graphics/NetworkStatsOverlay.h"
+#include "Intro.h"
 #include "Logging.h"
 #include "RenderTarget.h"
+#include "SceneManager.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
+#include "ViewportManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <SDL2/SDL.h>
 #include <algorithm>
@@ -58,18 +62,32 @@ namespace OpenLoco::Gfx
     void SoftwareDrawingEngine::initialize(SDL_Window* window)
     {
         Logging::info("DRAWING ENGINE: Starting initialization...");
-        
-        Logging::info("DRAWING ENGINE: Setting SDL render driver hint to opengl...");
-        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
+
+        Logging::info("DRAWING ENGINE: Setting window reference...");
+        _window = window;
+
+        createRenderer();
+
+        Logging::info("DRAWING ENGINE: Creating palette (CRITICAL - potential 64-bit crash point)...");
+        createPalette();
+        Logging::info("DRAWING ENGINE: Palette created successfully - initialization complete!");
+    }
+
+    void SoftwareDrawingEngine::createRenderer()
+    {
+        const auto& renderDriver = Config::get().display.renderDriver;
+        const auto* driverHint = renderDriver.empty() ? "opengl" : renderDriver.c_str();
+        Logging::info("DRAWING ENGINE: Setting SDL render driver hint to {}...", driverHint);
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, driverHint);
 
         Logging::info("DRAWING ENGINE: Creating hardware accelerated renderer...");
-        _renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+        _renderer = SDL_CreateRenderer(_window, -1, SDL_RENDERER_ACCELERATED);
         if (_renderer == nullptr)
         {
             // Try to fallback to software renderer.
             Logging::warn("DRAWING ENGINE: Hardware acceleration not available, falling back to software renderer.");
             Logging::warn("DRAWING ENGINE: SDL Error: {}", SDL_GetError());
-            _renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+            _renderer = SDL_CreateRenderer(_window, -1, SDL_RENDERER_SOFTWARE);
             if (_renderer == nullptr)
             {
                 Logging::error("DRAWING ENGINE: Unable to create hardware or software renderer: {}", SDL_GetError());
@@ -81,36 +99,54 @@ namespace OpenLoco::Gfx
         {
             Logging::info("DRAWING ENGINE: Hardware accelerated renderer created successfully");
         }
-        
-        Logging::info("DRAWING ENGINE: Setting window reference...");
-        _window = window;
-        
-        Logging::info("DRAWING ENGINE: Creating palette (CRITICAL - potential 64-bit crash point)...");
-        createPalette();
-        Logging::info("DRAWING ENGINE: Palette created successfully - initialization complete!");
     }
 
-    void SoftwareDrawingEngine::resize(const int32_t width, const int32_t height)
+    std::vector<std::string> SoftwareDrawingEngine::getRenderDrivers()
     {
-        Logging::info("DRAWING ENGINE: Starting resize to {}x{}", width, height);
-        
-        // Scale the width and height by configured scale factor
-        Logging::info("DRAWING ENGINE: Getting scale factor from config...");
-        const auto scaleFactor = Config::get().scaleFactor;
-        const auto scaledWidth = (int32_t)(width / scaleFactor);
-        const auto scaledHeight = (int32_t)(height / scaleFactor);
-        Logging::info("DRAWING ENGINE: Scale factor: {}, scaled size: {}x{}", scaleFactor, scaledWidth, scaledHeight);
+        std::vector<std::string> drivers;
+        const auto numDrivers = SDL_GetNumRenderDrivers();
+        for (auto i = 0; i < numDrivers; i++)
+        {
+            SDL_RendererInfo info{};
+            if (SDL_GetRenderDriverInfo(i, &info) == 0)
+            {
+                drivers.emplace_back(info.name);
+            }
+        }
+        return drivers;
+    }
 
-        // Release old resources.
-        if (_screenSurface != nullptr)
+    std::string SoftwareDrawingEngine::getRenderDriverName() const
+    {
+        SDL_RendererInfo info{};
+        if (_renderer == nullptr || SDL_GetRendererInfo(_renderer, &info) != 0)
         {
-            SDL_FreeSurface(_screenSurface);
+            return {};
         }
-        if (_screenRGBASurface != nullptr)
+        return info.name;
+    }
+
+    void SoftwareDrawingEngine::setRenderDriver(const std::string& name)
+    {
+        auto& displayConfig = Config::get().display;
+        if (displayConfig.renderDriver == name)
         {
-            SDL_FreeSurface(_screenRGBASurface);
+            return;
         }
+        displayConfig.renderDriver = name;
+        Config::write();
 
+        // Textures belong to the renderer they were created with.
+        releaseTextures();
+        SDL_DestroyRenderer(_renderer);
+        _renderer = nullptr;
+
+        createRenderer();
+        resize(_width, _height);
+    }
+
+    void SoftwareDrawingEngine::releaseTextures()
+    {
         if (_screenTexture != nullptr)
         {
             SDL_DestroyTexture(_screenTexture);
@@ -128,6 +164,32 @@ namespace OpenLoco::Gfx
             SDL_FreeFormat(_screenTextureFormat);
             _screenTextureFormat = nullptr;
         }
+    }
+
+    void SoftwareDrawingEngine::resize(const int32_t width, const int32_t height)
+    {
+        Logging::info("DRAWING ENGINE: Starting resize to {}x{}", width, height);
+        _width = width;
+        _height = height;
+        
+        // Scale the width and height by configured scale factor
+        Logging::info("DRAWING ENGINE: Getting scale factor from config...");
+        const auto scaleFactor = Config::get().scaleFactor;
+        const auto scaledWidth = (int32_t)(width / scaleFactor);
+        const auto scaledHeight = (int32_t)(height / scaleFactor);
+        Logging::info("DRAWING ENGINE: Scale factor: {}, scaled size: {}x{}", scaleFactor, scaledWidth, scaledHeight);
+
+        // Release old resources.
+        if (_screenSurface != nullptr)
+        {
+            SDL_FreeSurface(_screenSurface);
+        }
+        if (_screenRGBASurface != nullptr)
+        {
+            SDL_FreeSurface(_screenRGBASurface);
+        }
+
+        releaseTextures();
 
         // Surfaces.
         _screenSurface = SDL_CreateRGBSurface(0, scaledWidth, scaledHeight, 8, 0, 0, 0, 0);
@@ -191,6 +253,11 @@ namespace OpenLoco::Gfx
         SDL_QueryTexture(_screenTexture, &format, nullptr, nullptr, nullptr);
         _screenTextureFormat = SDL_AllocFormat(format);
 
+        _screenPixels.resize(static_cast<size_t>(scaledWidth) * scaledHeight);
+        _presentRegions.clear();
+        _presentAll = true;
+        updatePaletteLut();
+
         int32_t pitch = _screenSurface->pitch;
 
         RenderTarget& rt = _screenRT;
@@ -268,11 +335,33 @@ namespace OpenLoco::Gfx
             basePtr->a = 0;
         }
         SDL_SetPaletteColors(_palette, &base[index], index, count);
+
+        std::copy_n(&entries[index], count, &_paletteEntries[index]);
+        updatePaletteLut();
+        _presentAll = true;
+    }
+
+    void SoftwareDrawingEngine::updatePaletteLut()
+    {
+        if (_screenTextureFormat == nullptr)
+        {
+            return;
+        }
+        for (size_t i = 0; i < _paletteLut.size(); i++)
+        {
+            const auto& entry = _paletteEntries[i];
+            _paletteLut[i] = SDL_MapRGB(_screenTextureFormat, entry.r, entry.g, entry.b);
+        }
     }
 
     // 0x004C5CFA
     void SoftwareDrawingEngine::render()
     {
+        // Window and entity invalidations requested during the tick are deferred until now.
+        WindowManager::flushInvalidations();
+        ViewportManager::updateRenderBudget();
+        ViewportManager::flushEntityInvalidations();
+
         // Need to first render the current dirty regions before updating the viewports.
         // This is needed to ensure it will copy the correct pixels when the viewport will be moved.
         renderDirtyRegions();
@@ -288,15 +377,65 @@ namespace OpenLoco::Gfx
         {
             Gfx::drawFPS(_ctx);
         }
+
+        if (Config::get().showNetworkStats && SceneManager::isNetworked())
+        {
+            Gfx::drawNetworkStats(_ctx);
+        }
     }
 
     void SoftwareDrawingEngine::renderDirtyRegions()
     {
         _invalidationGrid.traverseDirtyCells([this](int32_t left, int32_t top, int32_t right, int32_t bottom) {
-            this->render(Rect::fromLTRB(left, top, right, bottom));
+            const auto rect = Rect::fromLTRB(left, top, right, bottom);
+            if (_showDirtyRegions)
+            {
+                _renderedRegions.push_back(rect);
+            }
+            this->render(rect);
         });
     }
 
+    void SoftwareDrawingEngine::setShowDirtyRegions(bool enabled)
+    {
+        _showDirtyRegions = enabled;
+        _renderedRegions.clear();
+        Gfx::invalidateScreen();
+    }
+
+    // Draws onto the copy of the screen that is about to be presented so the outlines never end up
+    // in the screen buffer, which would otherwise require rendering the regions again to remove them.
+    void SoftwareDrawingEngine::drawDirtyRegionOutlines()
+    {
+        auto* pixels = static_cast<uint8_t*>(_screenSurface->pixels);
+        const auto pitch = _screenSurface->pitch;
+        const auto max = Rect(0, 0, _screenSurface->w, _screenSurface->h);
+
+        for (const auto& region : _renderedRegions)
+        {
+            if (!region.intersects(max))
+            {
+                continue;
+            }
+
+            const auto rect = region.intersection(max);
+
+            const auto right = rect.right() - 1;
+            const auto bottom = rect.bottom() - 1;
+            for (auto x = rect.left(); x <= right; x++)
+            {
+                pixels[rect.top() * pitch + x] = PaletteIndex::yellow9;
+                pixels[bottom * pitch + x] = PaletteIndex::yellow9;
+            }
+            for (auto y = rect.top(); y <= bottom; y++)
+            {
+                pixels[y * pitch + rect.left()] = PaletteIndex::yellow9;
+                pixels[y * pitch + right] = PaletteIndex::yellow9;
+            }
+        }
+        _renderedRegions.clear();
+    }
+
     void SoftwareDrawingEngine::render(const Rect& _rect)
     {
         auto max = Rect(0, 0, Ui::width(), Ui::height());
@@ -311,6 +450,8 @@ namespace OpenLoco::Gfx
         rt.pitch = _screenRT.width + _screenRT.pitch - rect.width();
         rt.zoomLevel = 0;
 
+        _presentRegions.push_back(rect);
+
         // Set the render target to the screen rt.
         _ctx.pushRenderTarget(rt);
 
@@ -323,8 +464,70 @@ namespace OpenLoco::Gfx
         _ctx.popRenderTarget();
     }
 
+    // The outlines are drawn onto the 8-bit surface, which the region path skips.
+    bool SoftwareDrawingEngine::canPresentRegions() const
+    {
+        return Config::get().presentDirtyRegionsOnly
+            && !_showDirtyRegions
+            && _screenTextureFormat != nullptr
+            && _screenTextureFormat->BytesPerPixel == sizeof(uint32_t);
+    }
+
+    // Converts the changed regions straight from the 8-bit screen into the texture format and uploads
+    // just those, rather than copying, blitting and uploading the whole screen every frame.
+    void SoftwareDrawingEngine::presentRegions()
+    {
+        const auto& rt = getScreenRT();
+        const int32_t screenWidth = rt.width;
+        const int32_t screenHeight = rt.height;
+        const int32_t stride = rt.width + rt.pitch;
+
+        // The intro and unloaded scenes draw to the screen without rendering any regions.
+        if (_presentAll || Intro::isActive() || !SceneManager::isSceneInitialised())
+        {
+            _presentRegions.clear();
+            _presentRegions.push_back(Rect(0, 0, screenWidth, screenHeight));
+            _presentAll = false;
+        }
+
+        const auto max = Rect(0, 0, screenWidth, screenHeight);
+        for (const auto& region : _presentRegions)
+        {
+            if (!region.intersects(max))
+            {
+                continue;
+            }
+            const auto rect = region.intersection(max);
+
+            for (auto y = rect.top(); y < rect.bottom(); y++)
+            {
+                const auto* src = rt.bits + (y * stride) + rect.left();
+                auto* dst = _screenPixels.data() + (y * screenWidth) + rect.left();
+                for (auto x = 0; x < rect.width(); x++)
+                {
+                    dst[x] = _paletteLut[src[x]];
+                }
+            }
+
+            SDL_Rect textureRect{ rect.left(), rect.top(), rect.width(), rect.height() };
+            const auto* pixels = _screenPixels.data() + (rect.top() * screenWidth) + rect.left();
+            SDL_UpdateTexture(_screenTexture, &textureRect, pixels, screenWidth * sizeof(uint32_t));
+        }
+        _presentRegions.clear();
+
+        presentTexture();
+    }
+
     void SoftwareDrawingEngine::present()
     {
+        if (canPresentRegions())
+        {
+            presentRegions();
+            return;
+        }
+        _presentRegions.clear();
+        _presentAll = true;
+
         // Lock the surface before setting its pixels
         if (SDL_MUSTLOCK(_screenSurface))
         {
@@ -341,6 +544,11 @@ namespace OpenLoco::Gfx
             std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
         }
 
+        if (_showDirtyRegions)
+        {
+            drawDirtyRegionOutlines();
+        }
+
         // Unlock the surface
         if (SDL_MUSTLOCK(_screenSurface))
         {
@@ -357,6 +565,11 @@ namespace OpenLoco::Gfx
         // Copy the RGBA pixels into screen texture.
         SDL_UpdateTexture(_screenTexture, nullptr, _screenRGBASurface->pixels, _screenRGBASurface->pitch);
 
+        presentTexture();
+    }
+
+    void SoftwareDrawingEngine::presentTexture()
+    {
         const auto scaleFactor = Config::get().scaleFactor;
         if (scaleFactor > 1.0f)
         {
@@ -427,6 +640,11 @@ namespace OpenLoco::Gfx
             stride = -stride;
         }
 
+        if (rt.bits == _screenRT.bits)
+        {
+            _presentRegions.push_back(Rect(dstX, dstY, width, height));
+        }
+
         // Move bytes
         for (int32_t i = 0; i < height; i++)
         {
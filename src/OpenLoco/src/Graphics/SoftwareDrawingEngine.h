@@ -5,8 +5,11 @@
 #include "SoftwareDrawingContext.h"
 #include <OpenLoco/Engine/Ui/Rect.hpp>
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
 
 struct SDL_Palette;
 struct SDL_Surface;
@@ -34,6 +37,12 @@ namespace OpenLoco::Gfx
 
         void resize(int32_t width, int32_t height);
 
+        // The SDL render drivers available to present the screen with.
+        static std::vector<std::string> getRenderDrivers();
+        std::string getRenderDriverName() const;
+        // Recreates the renderer on the given driver, an empty name picks the default.
+        void setRenderDriver(const std::string& name);
+
         // Renders all invalidated regions.
         void render();
 
@@ -66,8 +75,19 @@ namespace OpenLoco::Gfx
 
         const Ui::ScreenInfo& getScreenInfo() const;
 
+        // Outlines the regions rendered each frame on the presented image, for tuning the invalidation blocks.
+        bool isShowingDirtyRegions() const { return _showDirtyRegions; }
+        void setShowDirtyRegions(bool enabled);
+
     private:
+        void createRenderer();
+        void releaseTextures();
         void renderDirtyRegions();
+        void drawDirtyRegionOutlines();
+        bool canPresentRegions() const;
+        void updatePaletteLut();
+        void presentRegions();
+        void presentTexture();
 
     private:
         SDL_Renderer* _renderer{};
@@ -82,7 +102,22 @@ namespace OpenLoco::Gfx
 
         SDL_Texture* _screenRGBATexture{};
 
+        // Window size of the last resize, needed to recreate the textures with a new renderer.
+        int32_t _width{};
+        int32_t _height{};
+
         SoftwareDrawingContext _ctx;
         InvalidationGrid _invalidationGrid;
+
+        bool _showDirtyRegions{};
+        std::vector<Ui::Rect> _renderedRegions;
+
+        // Screen pixels converted to the texture format, only the regions changed since the last
+        // present are converted and uploaded again, see Config::presentDirtyRegionsOnly.
+        std::vector<uint32_t> _screenPixels;
+        std::vector<Ui::Rect> _presentRegions;
+        bool _presentAll = true;
+        std::array<PaletteEntry, 256> _paletteEntries{};
+        std::array<uint32_t, 256> _paletteLut{};
     };
 }
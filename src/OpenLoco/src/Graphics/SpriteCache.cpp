@@ -0,0 +1,148 @@
+#include "SpriteCache.h"
+#include "Config.h"
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace OpenLoco::Gfx::SpriteCache
+{
+    struct Entry
+    {
+        const uint8_t* key;
+        std::shared_ptr<const std::vector<uint8_t>> pixels;
+        size_t size;
+    };
+
+    static std::list<Entry> _entries;
+    static std::unordered_map<const uint8_t*, std::list<Entry>::iterator> _lookup;
+    static size_t _memoryUsed = 0;
+    static uint64_t _hits = 0;
+    static uint64_t _misses = 0;
+    static std::mutex _mutex;
+
+    // Images that are a large portion of the cache would only evict everything else.
+    static constexpr size_t kMaxSpriteShare = 16;
+
+    static size_t getCapacity()
+    {
+        return static_cast<size_t>(std::max(Config::get().spriteCacheMemory, 0)) * 1024 * 1024;
+    }
+
+    // Expands the runs of the RLE image into a bitmap. Fails if a run contains a pixel of 0 as the bitmap
+    // drawing code would treat it as transparent whereas the RLE drawing code does not.
+    static bool decode(const G1Element& element, std::vector<uint8_t>& pixels)
+    {
+        const auto width = static_cast<size_t>(element.width);
+        const auto* src0 = element.offset;
+        for (size_t y = 0; y < static_cast<size_t>(element.height); y++)
+        {
+            const uint16_t lineOffset = src0[y * 2] | (src0[y * 2 + 1] << 8);
+            const auto* src = src0 + lineOffset;
+            auto* dstLine = pixels.data() + y * width;
+
+            auto isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                auto dataSize = *src++;
+                const auto firstPixelX = *src++;
+                isEndOfLine = (dataSize & 0x80) != 0;
+                dataSize &= 0x7F;
+
+                if (firstPixelX + dataSize > width || std::find(src, src + dataSize, 0) != src + dataSize)
+                {
+                    return false;
+                }
+                std::copy_n(src, dataSize, dstLine + firstPixelX);
+                src += dataSize;
+            }
+        }
+        return true;
+    }
+
+    // Images flagged as duplicates share their data but not their offsets, so only the pixels are shared.
+    static std::optional<DecodedSprite> makeSprite(const G1Element& element, const std::shared_ptr<const std::vector<uint8_t>>& pixels)
+    {
+        if (pixels == nullptr || pixels->size() != static_cast<size_t>(element.width) * element.height)
+        {
+            return std::nullopt;
+        }
+
+        DecodedSprite sprite{ element, pixels };
+        sprite.element.offset = const_cast<uint8_t*>(pixels->data());
+        sprite.element.flags = (element.flags & ~G1ElementFlags::isRLECompressed) | G1ElementFlags::hasTransparency;
+        return sprite;
+    }
+
+    static void evict(size_t capacity)
+    {
+        while (!_entries.empty() && _memoryUsed > capacity)
+        {
+            auto& entry = _entries.back();
+            _memoryUsed -= entry.size;
+            _lookup.erase(entry.key);
+            _entries.pop_back();
+        }
+    }
+
+    std::optional<DecodedSprite> get(const G1Element& element)
+    {
+        const auto capacity = getCapacity();
+        if (capacity == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::lock_guard lock(_mutex);
+
+        if (auto it = _lookup.find(element.offset); it != _lookup.end())
+        {
+            _hits++;
+            _entries.splice(_entries.begin(), _entries, it->second);
+            return makeSprite(element, it->second->pixels);
+        }
+
+        _misses++;
+
+        std::shared_ptr<std::vector<uint8_t>> pixels;
+        const auto numPixels = static_cast<size_t>(element.width) * element.height;
+        if (numPixels != 0 && numPixels <= capacity / kMaxSpriteShare)
+        {
+            pixels = std::make_shared<std::vector<uint8_t>>(numPixels, 0);
+            if (!decode(element, *pixels))
+            {
+                pixels = nullptr;
+            }
+        }
+
+        // Images that can't be decoded are remembered as well so they are not attempted every frame.
+        const auto size = sizeof(Entry) + (pixels != nullptr ? numPixels : 0);
+        _entries.push_front(Entry{ element.offset, pixels, size });
+        _lookup[element.offset] = _entries.begin();
+        _memoryUsed += size;
+        evict(capacity);
+
+        return makeSprite(element, pixels);
+    }
+
+    void clear()
+    {
+        std::lock_guard lock(_mutex);
+        _entries.clear();
+        _lookup.clear();
+        _memoryUsed = 0;
+    }
+
+    Stats getStats()
+    {
+        std::lock_guard lock(_mutex);
+        return Stats{ _hits, _misses, static_cast<uint32_t>(_entries.size()), _memoryUsed, getCapacity() };
+    }
+
+    void resetStats()
+    {
+        std::lock_guard lock(_mutex);
+        _hits = 0;
+        _misses = 0;
+    }
+}
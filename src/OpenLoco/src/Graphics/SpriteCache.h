@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Graphics/Gfx.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace OpenLoco::Gfx::SpriteCache
+{
+    // RLE image expanded into a bitmap where 0 is transparent.
+    struct DecodedSprite
+    {
+        G1Element element;
+        std::shared_ptr<const std::vector<uint8_t>> pixels;
+    };
+
+    struct Stats
+    {
+        uint64_t hits{};
+        uint64_t misses{};
+        uint32_t numSprites{};
+        size_t memoryUsed{};
+        size_t capacity{};
+    };
+
+    // Returns the decoded bitmap of an RLE image, decoding it on first use. Returns nothing when the cache
+    // is disabled or the image can not be drawn as a bitmap with identical results.
+    std::optional<DecodedSprite> get(const G1Element& element);
+
+    // Has to be called whenever image data may have been freed or replaced, e.g. when objects are loaded.
+    void clear();
+
+    Stats getStats();
+    void resetStats();
+}
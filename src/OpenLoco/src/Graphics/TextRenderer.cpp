@@ -5,6 +5,11 @@
 #include "Localisation/Formatting.h"
 #include "RenderTarget.h"
 #include "Ui/WindowManager.h"
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 namespace OpenLoco::Gfx
 {
@@ -22,6 +27,8 @@ namespace OpenLoco::Gfx
         static std::pair<uint16_t, uint16_t> wrapString(Font font, char* buffer, uint16_t stringWidth);
         static uint16_t wrapStringTicker(Font font, char* buffer, uint16_t stringWidth, uint16_t numCharacters);
         static int16_t clipString(Font font, int16_t width, char* string);
+        static uint16_t getMaxStringWidth(Font font, const char* str);
+        static uint16_t computeStringWidth(Font font, const char* str);
 
         static uint16_t getLineHeight(Font font)
         {
@@ -1289,7 +1296,7 @@ namespace OpenLoco::Gfx
         // 0x00495301
         // Note: Returned break count is -1. TODO: Refactor out this -1.
         // @return maxWidth @<cx> (numLinesToDisplayAllChars-1) @<di>
-        static std::pair<uint16_t, uint16_t> wrapString(Font font, char* buffer, uint16_t stringWidth)
+        static std::pair<uint16_t, uint16_t> computeWrapString(Font font, char* buffer, uint16_t stringWidth)
         {
             // std::vector<const char*> wrap; TODO: refactor to return pointers to line starts
             uint16_t wrapCount = 0;
@@ -1539,7 +1546,7 @@ namespace OpenLoco::Gfx
         }
 
         // 0x004957C4
-        static int16_t clipString(Font font, int16_t width, char* string)
+        static int16_t computeClipString(Font font, int16_t width, char* string)
         {
             if (width < 6)
             {
@@ -1548,7 +1555,7 @@ namespace OpenLoco::Gfx
             }
 
             // If width of the full string is less than allowed width then we don't need to clip
-            auto clippedWidth = getStringWidth(font, string);
+            auto clippedWidth = computeStringWidth(font, string);
             if (clippedWidth <= width)
             {
                 return clippedWidth;
@@ -1618,7 +1625,7 @@ namespace OpenLoco::Gfx
                 auto ellipseString = curString;
                 ellipseString.append("...");
 
-                auto ellipsedWidth = getStringWidth(font, ellipseString.c_str());
+                auto ellipsedWidth = computeStringWidth(font, ellipseString.c_str());
                 if (ellipsedWidth < width)
                 {
                     // Keep best string with ellipse
@@ -1627,10 +1634,10 @@ namespace OpenLoco::Gfx
                 else
                 {
                     StringManager::locoStrcpy(string, bestString.c_str());
-                    return getStringWidth(font, string);
+                    return computeStringWidth(font, string);
                 }
             }
-            return getStringWidth(font, string);
+            return computeStringWidth(font, string);
         }
 
         /**
@@ -1639,7 +1646,7 @@ namespace OpenLoco::Gfx
          * @param buffer @<esi>
          * @return width @<cx>
          */
-        static uint16_t getStringWidth(Font font, const char* str)
+        static uint16_t computeStringWidth(Font font, const char* str)
         {
             uint16_t width = 0;
             while (*str != '\0')
@@ -1815,7 +1822,7 @@ namespace OpenLoco::Gfx
          * @param buffer @<esi>
          * @return width @<cx>
          */
-        static uint16_t getMaxStringWidth(Font font, const char* str)
+        static uint16_t computeMaxStringWidth(Font font, const char* str)
         {
             uint16_t width = 0;
             uint16_t maxWidth = 0;
@@ -1904,6 +1911,257 @@ namespace OpenLoco::Gfx
             return maxWidth;
         }
 
+        // Bounded least recently used cache of text measurements. List windows with hundreds of rows
+        // measure, clip and wrap the same strings every frame, these only need to be walked once.
+        template<typename TValue>
+        class TextMeasureCache
+        {
+            static constexpr size_t kCapacity = 512;
+
+            struct Entry
+            {
+                uint64_t key;
+                Font font;
+                int32_t param;
+                std::string text;
+                TValue value;
+            };
+
+            std::list<Entry> _entries;
+            std::unordered_map<uint64_t, typename std::list<Entry>::iterator> _lookup;
+            size_t _textSize{};
+            uint32_t _characterWidthsVersion{};
+            std::mutex _mutex;
+
+            void validate()
+            {
+                // Character widths change when the language or font is changed.
+                const auto version = getCharacterWidthsVersion();
+                if (version != _characterWidthsVersion)
+                {
+                    _entries.clear();
+                    _lookup.clear();
+                    _textSize = 0;
+                    _characterWidthsVersion = version;
+                }
+            }
+
+            void erase(typename std::list<Entry>::iterator it)
+            {
+                _textSize -= it->text.size();
+                _lookup.erase(it->key);
+                _entries.erase(it);
+            }
+
+        public:
+            std::optional<TValue> find(uint64_t key, Font font, int32_t param, std::string_view text)
+            {
+                std::lock_guard lock(_mutex);
+                validate();
+
+                auto it = _lookup.find(key);
+                if (it == _lookup.end())
+                {
+                    return std::nullopt;
+                }
+                const auto& entry = *it->second;
+                if (entry.font != font || entry.param != param || entry.text != text)
+                {
+                    return std::nullopt;
+                }
+                _entries.splice(_entries.begin(), _entries, it->second);
+                return it->second->value;
+            }
+
+            void insert(uint64_t key, Font font, int32_t param, std::string_view text, TValue value)
+            {
+                std::lock_guard lock(_mutex);
+                validate();
+
+                auto it = _lookup.find(key);
+                if (it != _lookup.end())
+                {
+                    // Either raced with another thread or a hash collision, keep the latest.
+                    erase(it->second);
+                }
+                else if (_entries.size() >= kCapacity)
+                {
+                    erase(std::prev(_entries.end()));
+                }
+                _entries.push_front(Entry{ key, font, param, std::string(text), std::move(value) });
+                _lookup[key] = _entries.begin();
+                _textSize += text.size();
+            }
+
+            // Approximate, the list and map nodes are counted as an entry and two pointers each.
+            size_t getMemoryUsage()
+            {
+                std::lock_guard lock(_mutex);
+                constexpr auto kNodeSize = sizeof(Entry) + (2 * sizeof(void*)) + sizeof(std::pair<const uint64_t, void*>) + sizeof(void*);
+                return (_entries.size() * kNodeSize) + _textSize;
+            }
+        };
+
+        // Longer strings are rare and mostly one off (e.g. news or tooltips), not worth keeping around.
+        static constexpr size_t kMaxCachedTextLength = 256;
+
+        // Returns the length of the string in bytes if its measurement can be cached. Strings with inline
+        // sprites are not cached as the width of those may change when objects are reloaded.
+        static std::optional<size_t> getCacheableLength(const char* str)
+        {
+            const auto* ptr = str;
+            while (*ptr != '\0')
+            {
+                const auto chr = static_cast<uint8_t>(*ptr++);
+                if (chr == ControlCodes::inlineSpriteStr)
+                {
+                    return std::nullopt;
+                }
+                if (chr >= ControlCodes::oneArgBegin && chr < ControlCodes::oneArgEnd)
+                {
+                    ptr += 1;
+                }
+                else if (chr >= ControlCodes::twoArgBegin && chr < ControlCodes::twoArgEnd)
+                {
+                    ptr += 2;
+                }
+                else if (chr >= ControlCodes::fourArgBegin && chr < ControlCodes::fourArgEnd)
+                {
+                    ptr += 4;
+                }
+                if (static_cast<size_t>(ptr - str) > kMaxCachedTextLength)
+                {
+                    return std::nullopt;
+                }
+            }
+            return static_cast<size_t>(ptr - str);
+        }
+
+        // 64-bit FNV-1a over the text, seeded with the parameters of the measurement.
+        static uint64_t getTextKey(std::string_view text, Font font, int32_t param)
+        {
+            uint64_t hash = 0xCBF29CE484222325ULL;
+            const auto mix = [&hash](uint8_t value) {
+                hash ^= value;
+                hash *= 0x100000001B3ULL;
+            };
+            mix(static_cast<uint8_t>(font));
+            mix(static_cast<uint8_t>(param));
+            mix(static_cast<uint8_t>(param >> 8));
+            for (const auto chr : text)
+            {
+                mix(static_cast<uint8_t>(chr));
+            }
+            return hash;
+        }
+
+        struct TransformedText
+        {
+            std::string output;
+            std::pair<uint16_t, uint16_t> result;
+        };
+
+        static TextMeasureCache<uint16_t> _stringWidthCache;
+        static TextMeasureCache<uint16_t> _maxStringWidthCache;
+        static TextMeasureCache<TransformedText> _wrapStringCache;
+        static TextMeasureCache<TransformedText> _clipStringCache;
+
+        static size_t getCacheMemoryUsage()
+        {
+            return _stringWidthCache.getMemoryUsage() + _maxStringWidthCache.getMemoryUsage() + _wrapStringCache.getMemoryUsage() + _clipStringCache.getMemoryUsage();
+        }
+
+        static uint16_t getStringWidth(Font font, const char* str)
+        {
+            const auto length = getCacheableLength(str);
+            if (!length)
+            {
+                return computeStringWidth(font, str);
+            }
+
+            const auto text = std::string_view(str, *length);
+            const auto key = getTextKey(text, font, 0);
+            if (auto width = _stringWidthCache.find(key, font, 0, text))
+            {
+                return *width;
+            }
+
+            const auto width = computeStringWidth(font, str);
+            _stringWidthCache.insert(key, font, 0, text, width);
+            return width;
+        }
+
+        static uint16_t getMaxStringWidth(Font font, const char* str)
+        {
+            const auto length = getCacheableLength(str);
+            if (!length)
+            {
+                return computeMaxStringWidth(font, str);
+            }
+
+            const auto text = std::string_view(str, *length);
+            const auto key = getTextKey(text, font, 0);
+            if (auto width = _maxStringWidthCache.find(key, font, 0, text))
+            {
+                return *width;
+            }
+
+            const auto width = computeMaxStringWidth(font, str);
+            _maxStringWidthCache.insert(key, font, 0, text, width);
+            return width;
+        }
+
+        static std::pair<uint16_t, uint16_t> wrapString(Font font, char* buffer, uint16_t stringWidth)
+        {
+            const auto length = getCacheableLength(buffer);
+            if (!length)
+            {
+                return computeWrapString(font, buffer, stringWidth);
+            }
+
+            // The text is copied as wrapping modifies the buffer in place.
+            const auto text = std::string(buffer, *length);
+            const auto key = getTextKey(text, font, stringWidth);
+            if (auto wrapped = _wrapStringCache.find(key, font, stringWidth, text))
+            {
+                std::copy(wrapped->output.begin(), wrapped->output.end(), buffer);
+                return wrapped->result;
+            }
+
+            const auto result = computeWrapString(font, buffer, stringWidth);
+
+            // The wrapped output is one null terminated string per line.
+            const char* ptr = buffer;
+            for (auto i = 0; i <= result.second; i++)
+            {
+                ptr += StringManager::locoStrlen(ptr) + 1;
+            }
+            _wrapStringCache.insert(key, font, stringWidth, text, TransformedText{ std::string(buffer, static_cast<size_t>(ptr - buffer)), result });
+            return result;
+        }
+
+        static int16_t clipString(Font font, int16_t width, char* string)
+        {
+            const auto length = getCacheableLength(string);
+            if (!length)
+            {
+                return computeClipString(font, width, string);
+            }
+
+            const auto text = std::string(string, *length);
+            const auto key = getTextKey(text, font, width);
+            if (auto clipped = _clipStringCache.find(key, font, width, text))
+            {
+                std::copy(clipped->output.begin(), clipped->output.end(), string);
+                return clipped->result.first;
+            }
+
+            const auto clippedWidth = computeClipString(font, width, string);
+            const auto clippedLength = StringManager::locoStrlen(string) + 1;
+            _clipStringCache.insert(key, font, width, text, TransformedText{ std::string(string, clippedLength), { static_cast<uint16_t>(clippedWidth), 0 } });
+            return clippedWidth;
+        }
+
     } // namespace Impl
 
     TextRenderer::TextRenderer(DrawingContext& ctx)
@@ -1911,6 +2169,11 @@ namespace OpenLoco::Gfx
     {
     }
 
+    size_t TextRenderer::getCacheMemoryUsage()
+    {
+        return Impl::getCacheMemoryUsage();
+    }
+
     Font TextRenderer::getCurrentFont() const
     {
         return _currentFontSpriteBase;
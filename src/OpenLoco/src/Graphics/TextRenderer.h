@@ -6,7 +6,9 @@
 #include "Graphics/PaletteMap.h"
 #include "Types.hpp"
 #include <OpenLoco/Engine/Ui/Rect.hpp>
+#include <array>
 #include <cstdint>
+#include <string>
 
 namespace OpenLoco::Gfx
 {
@@ -125,5 +127,38 @@ namespace OpenLoco::Gfx
 
         void drawStringYOffsets(Ui::Point loc, AdvancedColour colour, const char* str, const int8_t* yOffsets);
         void drawStringTicker(Ui::Point origin, StringId stringId, Colour colour, uint8_t numLinesToDisplay, uint16_t numCharactersToDisplay, uint16_t width);
+
+        // Memory used by the caches of measured, clipped and wrapped strings.
+        static size_t getCacheMemoryUsage();
+    };
+
+    // Remembers the widths of a string in a set of fonts so that it is only measured again
+    // once either the string or the character widths have changed.
+    template<size_t TNumFonts>
+    class StringWidthCache
+    {
+        std::string _text;
+        uint32_t _characterWidthsVersion{};
+        std::array<uint16_t, TNumFonts> _widths{};
+        bool _valid = false;
+
+    public:
+        const std::array<uint16_t, TNumFonts>& getWidths(const std::array<Font, TNumFonts>& fonts, const char* text)
+        {
+            const auto version = getCharacterWidthsVersion();
+            if (_valid && _characterWidthsVersion == version && _text == text)
+            {
+                return _widths;
+            }
+
+            for (size_t i = 0; i < TNumFonts; i++)
+            {
+                _widths[i] = TextRenderer::getStringWidth(fonts[i], text);
+            }
+            _text = text;
+            _characterWidthsVersion = version;
+            _valid = true;
+            return _widths;
+        }
     };
 }
@@ -39,7 +39,7 @@ namespace OpenLoco::Gui
             Windows::PlayerInfoPanel::open();
             Windows::TimePanel::open();
 
-            if (OpenLoco::Tutorial::state() != Tutorial::State::none)
+            if (OpenLoco::Tutorial::state() != Tutorial::State::none && !OpenLoco::Tutorial::hasExtendedInput())
             {
                 Windows::Tutorial::open();
             }
@@ -151,8 +151,7 @@ namespace OpenLoco::Input
             case Tutorial::State::recording:
             {
                 // Vanilla had tutorial recording here at 0x004BF005
-                // as tutorials are fixed mouse position there isn't much
-                // point implementing this code as per vanilla.
+                Tutorial::record(enumValue(_keyModifier & ~KeyModifier::unknown));
                 break;
             }
         }
@@ -231,7 +230,7 @@ namespace OpenLoco::Input
     }
 
     // 0x00407028
-    static std::optional<Key> getNextKey()
+    static std::optional<Key> dequeueKey()
     {
         uint32_t readIndex = _keyQueueReadIndex;
         if (readIndex == _keyQueueWriteIndex)
@@ -249,6 +248,46 @@ namespace OpenLoco::Input
         return nextKey;
     }
 
+    // Input recordings hold the keys as a flag word followed by the key code and character
+    static std::optional<Key> getNextKey()
+    {
+        auto key = dequeueKey();
+        if (!Tutorial::hasExtendedInput())
+        {
+            return key;
+        }
+
+        if (Tutorial::state() == Tutorial::State::playing)
+        {
+            if (key.has_value())
+            {
+                // Any key interrupts the playback
+                Tutorial::stop();
+                return key;
+            }
+            if (Tutorial::nextInput() == 0)
+            {
+                return std::nullopt;
+            }
+            Key recorded{};
+            recorded.keyCode = Tutorial::nextInput();
+            recorded.keyCode |= Tutorial::nextInput() << 16;
+            recorded.charCode = Tutorial::nextInput();
+            return recorded;
+        }
+
+        if (!key.has_value())
+        {
+            Tutorial::record(0);
+            return key;
+        }
+        Tutorial::record(1);
+        Tutorial::record(static_cast<uint16_t>(key->keyCode));
+        Tutorial::record(static_cast<uint16_t>(key->keyCode >> 16));
+        Tutorial::record(static_cast<uint16_t>(key->charCode));
+        return key;
+    }
+
     static bool tryShortcut(Shortcut sc, uint32_t keyCode, KeyModifier modifiers)
     {
         auto cfg = OpenLoco::Config::get();
@@ -355,7 +394,7 @@ namespace OpenLoco::Input
                 continue;
             }
 
-            if (Tutorial::state() == Tutorial::State::playing)
+            if (Tutorial::state() == Tutorial::State::playing && !Tutorial::hasExtendedInput())
             {
                 Tutorial::stop();
                 continue;
@@ -366,6 +405,11 @@ namespace OpenLoco::Input
                 continue;
             }
 
+            if (tryShortcut(Shortcut::toggleTraceCapture, nextKey->keyCode, _keyModifier))
+            {
+                continue;
+            }
+
             if (!SceneManager::isTitleMode())
             {
                 for (const auto& shortcut : ShortcutManager::getList())
@@ -312,8 +312,9 @@ namespace OpenLoco::Input
             case Tutorial::State::recording:
             {
                 // Vanilla had tutorial recording here at 0x004C6EC3
-                // as tutorials are fixed mouse position there isn't much
-                // point implementing this code as per vanilla.
+                _cursor2 = _cursor;
+                Tutorial::record(_cursor2.x);
+                Tutorial::record(_cursor2.y);
                 break;
             }
         }
@@ -585,7 +586,8 @@ namespace OpenLoco::Input
                 }
 
                 Ui::Point dragOffset = { x, y };
-                if (Tutorial::state() != Tutorial::State::playing)
+                // Recordings keep the offsets they play back
+                if (Tutorial::state() == Tutorial::State::none)
                 {
                     // Fix #151: use relative drag from one frame to the next rather than
                     //           using the relative position from the message loop
@@ -1755,7 +1757,7 @@ namespace OpenLoco::Input
     }
 
     // 0x004C6EE6
-    MouseButton nextMouseInput(uint32_t& x, int16_t& y)
+    static MouseButton nextLiveOrPlayedMouseInput(uint32_t& x, int16_t& y)
     {
         if (!hasFlag(Flags::rightMousePressed))
         {
@@ -1858,6 +1860,36 @@ namespace OpenLoco::Input
         }
     }
 
+    // Records the same words in the same order as nextLiveOrPlayedMouseInput reads them back
+    MouseButton nextMouseInput(uint32_t& x, int16_t& y)
+    {
+        const bool wasRightPressed = hasFlag(Flags::rightMousePressed);
+        const auto button = nextLiveOrPlayedMouseInput(x, y);
+        if (Tutorial::state() != Tutorial::State::recording)
+        {
+            return button;
+        }
+
+        if (wasRightPressed)
+        {
+            Tutorial::record(button == MouseButton::rightReleased ? 0 : 0x80);
+            Tutorial::record(static_cast<uint16_t>(x));
+            Tutorial::record(static_cast<uint16_t>(y));
+        }
+        else if (button == MouseButton::released)
+        {
+            Tutorial::record(enumValue(MouseButton::released));
+        }
+        else
+        {
+            Tutorial::record(enumValue(button));
+            Tutorial::record(enumValue(button));
+            Tutorial::record(static_cast<uint16_t>(x));
+            Tutorial::record(static_cast<uint16_t>(y));
+        }
+        return button;
+    }
+
     // 0x004C6202
     void processMouseWheel()
     {
@@ -1873,7 +1905,18 @@ namespace OpenLoco::Input
             wheel += 17;
         }
 
-        if (Tutorial::state() != Tutorial::State::none)
+        if (Tutorial::hasExtendedInput())
+        {
+            if (Tutorial::state() == Tutorial::State::recording)
+            {
+                Tutorial::record(static_cast<uint16_t>(wheel));
+            }
+            else
+            {
+                wheel = static_cast<int16_t>(Tutorial::nextInput());
+            }
+        }
+        else if (Tutorial::state() != Tutorial::State::none)
         {
             return;
         }
@@ -15,13 +15,19 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Engine/Input/ShortcutManager.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Platform/Platform.h>
 #include <array>
+#include <ctime>
+#include <fmt/chrono.h>
 #include <unordered_map>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::Input::Shortcuts
 {
@@ -674,11 +680,41 @@ namespace OpenLoco::Input::Shortcuts
         GameCommands::doCommand(GameCommands::SetGameSpeedArgs{ GameSpeed::ExtraFastForward }, GameCommands::Flags::apply);
     }
 
+    static void gameSpeedTurbo()
+    {
+        GameCommands::doCommand(GameCommands::SetGameSpeedArgs{ GameSpeed::Turbo }, GameCommands::Flags::apply);
+    }
+
     static void openDebugWindow()
     {
         Windows::Debug::open();
     }
 
+    // Starts capturing a trace, pressed again it writes the trace to the traces folder.
+    static void toggleTraceCapture()
+    {
+        if (!Tracing::isCapturing())
+        {
+            Tracing::start();
+            Logging::info("Started capturing a trace");
+            return;
+        }
+
+        Tracing::stop();
+        std::time_t t = std::time(nullptr);
+        const auto path = Platform::getUserDirectory() / "traces" / fmt::format("openloco_{:%Y-%m-%d_%H_%M_%S}.json", *std::localtime(&t));
+        std::error_code ec;
+        fs::create_directories(path.parent_path(), ec);
+        if (Tracing::writeChromeTrace(path))
+        {
+            Logging::info("Wrote trace to {}", path);
+        }
+        else
+        {
+            Logging::error("Unable to write trace to {}", path);
+        }
+    }
+
     void initialize()
     {
         // clang-format off
@@ -735,6 +771,8 @@ namespace OpenLoco::Input::Shortcuts
         ShortcutManager::add(Shortcut::gameSpeedFastForward,            StringIds::shortcut_game_speed_fast_forward,            gameSpeedFastForward,           "gameSpeedFastForward",             "");
         ShortcutManager::add(Shortcut::gameSpeedExtraFastForward,       StringIds::shortcut_game_speed_extra_fast_forward,      gameSpeedExtraFastForward,      "gameSpeedExtraFastForward",        "");
         ShortcutManager::add(Shortcut::openDebugWindow,                 StringIds::empty,                                       openDebugWindow,                "openDebugWindow",                  "F10");
+        ShortcutManager::add(Shortcut::gameSpeedTurbo,                  StringIds::shortcut_game_speed_turbo,                   gameSpeedTurbo,                 "gameSpeedTurbo",                   "");
+        ShortcutManager::add(Shortcut::toggleTraceCapture,              StringIds::empty,                                       toggleTraceCapture,             "toggleTraceCapture",               "Left Ctrl+F10");
         // clang-format on
     }
 }
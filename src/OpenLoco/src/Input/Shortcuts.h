@@ -59,6 +59,8 @@ namespace OpenLoco::Input
         gameSpeedFastForward,
         gameSpeedExtraFastForward,
         openDebugWindow,
+        gameSpeedTurbo,
+        toggleTraceCapture,
     };
 
     namespace Shortcuts
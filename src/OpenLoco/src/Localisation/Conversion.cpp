@@ -2,7 +2,10 @@
 #include "Unicode.h"
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <string>
 
 namespace OpenLoco::Localisation
@@ -52,17 +55,24 @@ namespace OpenLoco::Localisation
     // Ensure that the table is sorted by Unicode point.
     // static_assert(std::ranges::is_sorted(kUnicodeToLocoTable, {}, &EncodingConvertEntry::unicode)); // COMMENTED FOR 64-BIT DEBUG
 
-    utf32_t convertLocoToUnicode(uint8_t locoCode)
-    {
-        // We can't do a binary search here, as the table is sorted by Unicode point, not Loco's internal encoding.
-        for (const auto& entry : kUnicodeToLocoTable)
+    // The reverse of the table above indexed by Loco's internal encoding
+    static constexpr auto kLocoToUnicodeTable = []() {
+        std::array<utf32_t, 256> table{};
+        for (size_t i = 0; i < table.size(); i++)
         {
-            if (entry.locoCode == locoCode)
-            {
-                return entry.unicode;
-            }
+            table[i] = static_cast<utf32_t>(i);
         }
-        return locoCode;
+        // Reversed so the first entry wins for any code used twice, as the linear search did
+        for (auto it = kUnicodeToLocoTable.rbegin(); it != kUnicodeToLocoTable.rend(); ++it)
+        {
+            table[it->locoCode] = it->unicode;
+        }
+        return table;
+    }();
+
+    utf32_t convertLocoToUnicode(uint8_t locoCode)
+    {
+        return kLocoToUnicodeTable[locoCode];
     }
 
     uint8_t convertUnicodeToLoco(utf32_t unicode)
@@ -86,15 +96,74 @@ namespace OpenLoco::Localisation
         return '?';
     }
 
+    // Length of the run of ASCII characters at the start of the string, tested eight bytes at a time
+    // while they remain before the end. Stops at the terminator as the conversion does.
+    static size_t getAsciiPrefixLength(const uint8_t* input, const uint8_t* end)
+    {
+        constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+        constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+        const auto* start = input;
+        while (end - input >= static_cast<std::ptrdiff_t>(sizeof(uint64_t)))
+        {
+            uint64_t word;
+            std::memcpy(&word, input, sizeof(word));
+            // A byte with its high bit set, or a zero byte, ends the run
+            if (((word & kHighBits) | ((word - kLowBits) & ~word & kHighBits)) != 0)
+            {
+                break;
+            }
+            input += sizeof(word);
+        }
+        while (*input != 0 && *input < 0x80)
+        {
+            input++;
+        }
+        return static_cast<size_t>(input - start);
+    }
+
     std::string convertUnicodeToLoco(const std::string& unicodeString)
     {
         std::string out;
-        const uint8_t* input = (uint8_t*)unicodeString.c_str();
-        while (utf32_t unicodePoint = readCodePoint(&input))
+        out.reserve(unicodeString.size());
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(unicodeString.c_str());
+        const uint8_t* const end = input + unicodeString.size();
+        while (true)
         {
+            // ASCII maps to itself, so runs of it are copied whole
+            const auto asciiLength = getAsciiPrefixLength(input, end);
+            out.append(reinterpret_cast<const char*>(input), asciiLength);
+            input += asciiLength;
+
+            utf32_t unicodePoint = readCodePoint(&input);
+            if (unicodePoint == 0)
+            {
+                break;
+            }
             out += convertUnicodeToLoco(unicodePoint);
         }
 
         return out;
     }
+
+    const std::string& convertUnicodeToLocoCached(const std::string& unicodeString)
+    {
+        struct CacheEntry
+        {
+            std::string unicode;
+            std::string loco;
+            bool isValid = false;
+        };
+        static thread_local std::array<CacheEntry, 64> _cache;
+
+        auto& entry = _cache[std::hash<std::string>{}(unicodeString) % _cache.size()];
+        if (!entry.isValid || entry.unicode != unicodeString)
+        {
+            entry.unicode = unicodeString;
+            entry.loco = convertUnicodeToLoco(unicodeString);
+            entry.isValid = true;
+        }
+        return entry.loco;
+    }
 }
@@ -9,6 +9,9 @@ namespace OpenLoco::Localisation
     utf32_t convertLocoToUnicode(uint8_t loco_char);
     uint8_t convertUnicodeToLoco(utf32_t unicode);
     std::string convertUnicodeToLoco(const std::string& unicode_string);
+    // Keeps the last few conversions, for strings such as file names that are converted every frame.
+    // The result is valid until the next call on the same thread.
+    const std::string& convertUnicodeToLocoCached(const std::string& unicode_string);
 
     namespace LocoChar
     {
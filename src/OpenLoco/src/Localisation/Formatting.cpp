@@ -19,6 +19,7 @@
 #include <fmt/core.h>
 #include <map>
 #include <stdexcept>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -303,279 +304,435 @@ namespace OpenLoco::StringManager
         return dest;
     }
 
-    static void formatStringPart(StringBuffer& buffer, const char* sourceStr, FormatArgumentsView& args)
+    // Number of bytes taken by a code that is copied to the output as is, 0 for the codes that take their value from the arguments
+    static size_t getLiteralCodeLength(uint8_t ch)
     {
-        while (true)
+        if (ch < ControlCodes::oneArgEnd)
         {
-            uint8_t ch = *sourceStr;
+            return 2;
+        }
+        else if (ch < ControlCodes::noArgEnd)
+        {
+            return 1;
+        }
+        else if (ch < ControlCodes::twoArgEnd)
+        {
+            return 3;
+        }
+        else if (ch < ControlCodes::fourArgEnd)
+        {
+            return 5;
+        }
+        else if (ch < ControlCodes::int32_grouped || ch >= ControlCodes::Colour::black)
+        {
+            return 1;
+        }
+        return 0;
+    }
 
-            if (ch == 0)
+    // Copies a character or a code with its operand to the output, returns the number of bytes taken
+    static size_t appendLiteralCode(StringBuffer& buffer, const char* sourceStr)
+    {
+        const uint8_t ch = *sourceStr;
+        const auto length = getLiteralCodeLength(ch);
+        if (length == 1 && ch >= ControlCodes::noArgEnd)
+        {
+            buffer.append(ch);
+        }
+        else
+        {
+            buffer.appendData(sourceStr, length);
+        }
+        return length;
+    }
+
+    // Reads the operand that follows an argument code in the string and returns the number of bytes it takes
+    static size_t readArgumentOperand(uint8_t code, const char* operandStr, uint16_t& operand)
+    {
+        switch (code)
+        {
+            case ControlCodes::stringidStr:
+                std::memcpy(&operand, operandStr, sizeof(StringId));
+                return sizeof(StringId);
+
+            case ControlCodes::date:
+                operand = static_cast<uint8_t>(*operandStr);
+                return 1;
+
+            default:
+                operand = 0;
+                return 0;
+        }
+    }
+
+    static void formatArgument(StringBuffer& buffer, uint8_t code, uint16_t operand, FormatArgumentsView& args)
+    {
+        switch (code)
+        {
+            case ControlCodes::int32_grouped:
             {
-                return;
+                int32_t value = args.pop<int32_t>();
+                formatInt32Grouped(value, buffer);
+                break;
             }
-            else if (ch <= 4)
+
+            case ControlCodes::int32_ungrouped:
             {
-                buffer.appendData(sourceStr, 2);
-                sourceStr += 2;
+                int32_t value = args.pop<int32_t>();
+                formatInt32Ungrouped(value, buffer);
+                break;
             }
-            else if (ch <= 16)
+
+            case ControlCodes::int16_decimals:
             {
-                buffer.appendData(sourceStr, 1);
-                sourceStr += 1;
+                int16_t value = args.pop<int16_t>();
+                formatShortWithOneDecimal(value, buffer);
+                break;
             }
-            else if (ch <= 22)
+
+            case ControlCodes::int32_decimals:
             {
-                buffer.appendData(sourceStr, 3);
-                sourceStr += 3;
+                int32_t value = args.pop<int32_t>();
+                formatIntWithTwoDecimals(value, buffer);
+                break;
             }
-            else if (ch <= 0x1F)
+
+            case ControlCodes::int16_grouped:
             {
-                buffer.appendData(sourceStr, 5);
-                sourceStr += 5;
+                int16_t value = args.pop<int16_t>();
+                formatInt32Grouped(value, buffer);
+                break;
             }
-            else if (ch < 0x7B || ch >= 0x90)
+
+            case ControlCodes::uint16_ungrouped:
             {
-                buffer.append(ch);
-                sourceStr += 1;
+                int32_t value = args.pop<uint16_t>();
+                formatInt32Ungrouped(value, buffer);
+                break;
             }
-            else
+
+            case ControlCodes::currency32:
             {
-                sourceStr++;
+                int32_t value = args.pop<uint32_t>();
+                formatCurrency(value, buffer);
+                break;
+            }
+
+            case ControlCodes::currency48:
+            {
+                uint32_t valueLow = args.pop<uint32_t>();
+                int32_t valueHigh = args.pop<int16_t>();
+                int64_t value = (valueHigh * (1ULL << 32)) | valueLow;
+                formatCurrency(value, buffer);
+                break;
+            }
+
+            case ControlCodes::stringidArgs:
+            {
+                StringId id = args.pop<StringId>();
+                formatStringImpl(buffer, id, args);
+                break;
+            }
+
+            case ControlCodes::stringidStr:
+            {
+                formatStringImpl(buffer, StringId(operand), args);
+                break;
+            }
 
-                switch (ch)
+            case ControlCodes::string_ptr:
+            {
+                const char* str = args.pop<const char*>();
+                buffer.append(str);
+                break;
+            }
+
+            case ControlCodes::date:
+            {
+                uint8_t modifier = static_cast<uint8_t>(operand);
+                uint32_t totalDays = args.pop<uint32_t>();
+
+                switch (modifier)
                 {
-                    case ControlCodes::int32_grouped:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        formatInt32Grouped(value, buffer);
+                    case DateModifier::dmy_full:
+                        formatDateDMYFull(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::int32_ungrouped:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        formatInt32Ungrouped(value, buffer);
+                    case DateModifier::my_full:
+                        formatDateMYFull(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::int16_decimals:
-                    {
-                        int16_t value = args.pop<int16_t>();
-                        formatShortWithOneDecimal(value, buffer);
+                    case DateModifier::my_abbr:
+                        formatDateMYAbbrev(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::int32_decimals:
-                    {
-                        int32_t value = args.pop<int32_t>();
-                        formatIntWithTwoDecimals(value, buffer);
+                    case DateModifier::raw_my_abbr:
+                        formatRawDateMYAbbrev(totalDays, buffer);
                         break;
-                    }
 
-                    case ControlCodes::int16_grouped:
-                    {
-                        int16_t value = args.pop<int16_t>();
-                        formatInt32Grouped(value, buffer);
-                        break;
-                    }
+                    default:
+                        throw Exception::OutOfRange("formatString: unexpected modifier: " + std::to_string(modifier));
+                }
 
-                    case ControlCodes::uint16_ungrouped:
-                    {
-                        int32_t value = args.pop<uint16_t>();
-                        formatInt32Ungrouped(value, buffer);
-                        break;
-                    }
+                break;
+            }
 
-                    case ControlCodes::currency32:
-                    {
-                        int32_t value = args.pop<uint32_t>();
-                        formatCurrency(value, buffer);
-                        break;
-                    }
+            case ControlCodes::velocity:
+            {
+                auto measurementFormat = Config::get().measurementFormat;
 
-                    case ControlCodes::currency48:
-                    {
-                        uint32_t valueLow = args.pop<uint32_t>();
-                        int32_t valueHigh = args.pop<int16_t>();
-                        int64_t value = (valueHigh * (1ULL << 32)) | valueLow;
-                        formatCurrency(value, buffer);
-                        break;
-                    }
+                int32_t value = args.pop<int16_t>();
 
-                    case ControlCodes::stringidArgs:
-                    {
-                        StringId id = args.pop<StringId>();
-                        formatStringImpl(buffer, id, args);
-                        break;
-                    }
+                const char* unit;
+                if (measurementFormat == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_mph);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_kmh);
+                    value = std::round(value * 1.609375);
+                }
 
-                    case ControlCodes::stringidStr:
-                    {
-                        StringId id = *(StringId*)sourceStr;
-                        sourceStr += 2;
-                        formatStringImpl(buffer, id, args);
-                        break;
-                    }
+                formatInt32Grouped(value, buffer);
+                buffer.append(unit);
 
-                    case ControlCodes::string_ptr:
-                    {
-                        const char* str = args.pop<const char*>();
-                        buffer.append(str);
-                        break;
-                    }
+                break;
+            }
 
-                    case ControlCodes::date:
-                    {
-                        char modifier = *sourceStr;
-                        uint32_t totalDays = args.pop<uint32_t>();
-                        sourceStr++;
+            case ControlCodes::pop16:
+                args.skip<uint16_t>();
+                break;
 
-                        switch (modifier)
-                        {
-                            case DateModifier::dmy_full:
-                                formatDateDMYFull(totalDays, buffer);
-                                break;
+            case ControlCodes::push16:
+                args.push<uint16_t>();
+                break;
 
-                            case DateModifier::my_full:
-                                formatDateMYFull(totalDays, buffer);
-                                break;
+            case ControlCodes::timeMS:
+                throw Exception::RuntimeError("Unimplemented format string: 15");
 
-                            case DateModifier::my_abbr:
-                                formatDateMYAbbrev(totalDays, buffer);
-                                break;
+            case ControlCodes::timeHM:
+                throw Exception::RuntimeError("Unimplemented format string: 16");
 
-                            case DateModifier::raw_my_abbr:
-                                formatRawDateMYAbbrev(totalDays, buffer);
-                                break;
+            case ControlCodes::distance:
+            {
+                uint32_t value = args.pop<uint16_t>();
+                auto measurementFormat = Config::get().measurementFormat;
 
-                            default:
-                                throw Exception::OutOfRange("formatString: unexpected modifier: " + std::to_string((uint8_t)modifier));
-                        }
+                const char* unit;
+                if (measurementFormat == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_ft);
+                    value = std::round(value * 3.28125);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_m);
+                }
 
-                        break;
-                    }
+                formatInt32Grouped(value, buffer);
+                buffer.append(unit);
 
-                    case ControlCodes::velocity:
-                    {
-                        auto measurementFormat = Config::get().measurementFormat;
+                break;
+            }
 
-                        int32_t value = args.pop<int16_t>();
+            case ControlCodes::height:
+            {
+                int32_t value = args.pop<int16_t>();
 
-                        const char* unit;
-                        if (measurementFormat == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_mph);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_kmh);
-                            value = std::round(value * 1.609375);
-                        }
+                bool showHeightAsUnits = (Config::get().showHeightAsUnits);
+                auto measurementFormat = Config::get().measurementFormat;
+                const char* unit;
 
-                        formatInt32Grouped(value, buffer);
-                        buffer.append(unit);
+                if (showHeightAsUnits)
+                {
+                    unit = getString(StringIds::unit_units);
+                }
+                else if (measurementFormat == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_ft);
+                    value *= 16;
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_m);
+                    value *= 5;
+                }
 
-                        break;
-                    }
+                formatInt32Grouped(value, buffer);
+                buffer.append(unit);
 
-                    case ControlCodes::pop16:
-                        args.skip<uint16_t>();
-                        break;
+                break;
+            }
 
-                    case ControlCodes::push16:
-                        args.push<uint16_t>();
-                        break;
+            case ControlCodes::power:
+            {
+                uint32_t value = args.pop<uint16_t>();
+                auto measurementFormat = Config::get().measurementFormat;
 
-                    case ControlCodes::timeMS:
-                        throw Exception::RuntimeError("Unimplemented format string: 15");
+                const char* unit;
+                if (measurementFormat == Config::MeasurementFormat::imperial)
+                {
+                    unit = getString(StringIds::unit_hp);
+                }
+                else
+                {
+                    unit = getString(StringIds::unit_kW);
+                    value = hpTokW(value);
+                }
 
-                    case ControlCodes::timeHM:
-                        throw Exception::RuntimeError("Unimplemented format string: 16");
+                formatInt32Grouped(value, buffer);
+                buffer.append(unit);
 
-                    case ControlCodes::distance:
-                    {
-                        uint32_t value = args.pop<uint16_t>();
-                        auto measurementFormat = Config::get().measurementFormat;
-
-                        const char* unit;
-                        if (measurementFormat == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_ft);
-                            value = std::round(value * 3.28125);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_m);
-                        }
-
-                        formatInt32Grouped(value, buffer);
-                        buffer.append(unit);
+                break;
+            }
 
-                        break;
-                    }
+            case ControlCodes::inlineSpriteArgs:
+            {
+                uint32_t value = args.pop<uint32_t>();
 
-                    case ControlCodes::height:
-                    {
-                        int32_t value = args.pop<int16_t>();
-
-                        bool showHeightAsUnits = (Config::get().showHeightAsUnits);
-                        auto measurementFormat = Config::get().measurementFormat;
-                        const char* unit;
-
-                        if (showHeightAsUnits)
-                        {
-                            unit = getString(StringIds::unit_units);
-                        }
-                        else if (measurementFormat == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_ft);
-                            value *= 16;
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_m);
-                            value *= 5;
-                        }
-
-                        formatInt32Grouped(value, buffer);
-                        buffer.append(unit);
+                buffer.append(static_cast<char>(ControlCodes::inlineSpriteStr));
+                buffer.appendData(&value, sizeof(value));
 
-                        break;
-                    }
+                break;
+            }
+        }
+    }
 
-                    case ControlCodes::power:
-                    {
-                        uint32_t value = args.pop<uint16_t>();
-                        auto measurementFormat = Config::get().measurementFormat;
-
-                        const char* unit;
-                        if (measurementFormat == Config::MeasurementFormat::imperial)
-                        {
-                            unit = getString(StringIds::unit_hp);
-                        }
-                        else
-                        {
-                            unit = getString(StringIds::unit_kW);
-                            value = hpTokW(value);
-                        }
-
-                        formatInt32Grouped(value, buffer);
-                        buffer.append(unit);
+    static void formatStringPart(StringBuffer& buffer, const char* sourceStr, FormatArgumentsView& args)
+    {
+        while (true)
+        {
+            uint8_t ch = *sourceStr;
+            if (ch == 0)
+            {
+                return;
+            }
 
-                        break;
-                    }
+            if (getLiteralCodeLength(ch) != 0)
+            {
+                sourceStr += appendLiteralCode(buffer, sourceStr);
+            }
+            else
+            {
+                sourceStr++;
 
-                    case ControlCodes::inlineSpriteArgs:
-                    {
-                        uint32_t value = args.pop<uint32_t>();
+                uint16_t operand;
+                sourceStr += readArgumentOperand(ch, sourceStr, operand);
+                formatArgument(buffer, ch, operand, args);
+            }
+        }
+    }
 
-                        buffer.append(static_cast<char>(ControlCodes::inlineSpriteStr));
-                        buffer.appendData(&value, sizeof(value));
+    // A language string is split into runs of bytes that are copied as is and the argument codes
+    // between them when it is loaded, so formatting it doesn't have to scan it again.
+    struct CompiledOp
+    {
+        uint8_t code; // kLiteralRun or an argument control code
+        uint16_t operand;
+        uint32_t offset; // Start of the literal run in the source string
+        uint32_t length;
+    };
 
-                        break;
+    struct CompiledString
+    {
+        const char* source;
+        uint32_t firstOp;
+        uint32_t numOps;
+    };
+
+    static constexpr uint8_t kLiteralRun = 0;
+
+    static std::vector<CompiledOp> _compiledOps;
+    static std::vector<CompiledString> _compiledStrings;
+
+    void compileString(StringId id, const char* str)
+    {
+        if (id >= _compiledStrings.size())
+        {
+            _compiledStrings.resize(id + 1);
+        }
+
+        auto& compiled = _compiledStrings[id];
+        compiled.source = str;
+        compiled.firstOp = static_cast<uint32_t>(_compiledOps.size());
+
+        const char* ptr = str;
+        const char* runStart = str;
+        auto endRun = [&]() {
+            if (ptr != runStart)
+            {
+                _compiledOps.push_back({ kLiteralRun, 0, static_cast<uint32_t>(runStart - str), static_cast<uint32_t>(ptr - runStart) });
+            }
+        };
+
+        while (*ptr != '\0')
+        {
+            const uint8_t ch = *ptr;
+            const auto literalLength = getLiteralCodeLength(ch);
+            if (literalLength != 0)
+            {
+                ptr += literalLength;
+                continue;
+            }
+
+            endRun();
+            CompiledOp op{ ch, 0, 0, 0 };
+            ptr++;
+            ptr += readArgumentOperand(ch, ptr, op.operand);
+            _compiledOps.push_back(op);
+            runStart = ptr;
+        }
+        endRun();
+
+        compiled.numOps = static_cast<uint32_t>(_compiledOps.size()) - compiled.firstOp;
+    }
+
+    void clearCompiledStrings()
+    {
+        _compiledOps.clear();
+        _compiledStrings.clear();
+    }
+
+    // The compiled form is only used while the string id still points to the string it was compiled
+    // from, object strings and the buffer strings are formatted from the source.
+    static const CompiledString* findCompiledString(StringId id, const char* sourceStr)
+    {
+        if (id >= _compiledStrings.size() || _compiledStrings[id].source != sourceStr)
+        {
+            return nullptr;
+        }
+        return &_compiledStrings[id];
+    }
+
+    static void formatCompiledString(StringBuffer& buffer, const CompiledString& compiled, FormatArgumentsView& args)
+    {
+        const auto* op = _compiledOps.data() + compiled.firstOp;
+        const auto* opEnd = op + compiled.numOps;
+        for (; op != opEnd; op++)
+        {
+            if (op->code == kLiteralRun)
+            {
+                // Copying the run in one go needs room for the terminator, near the end of the buffer
+                // it is copied by code so the output is cut off the same way as the uncompiled string.
+                if (buffer.offset + op->length < buffer.maxLen)
+                {
+                    buffer.appendData(compiled.source + op->offset, op->length);
+                }
+                else
+                {
+                    const char* ptr = compiled.source + op->offset;
+                    const char* runEnd = ptr + op->length;
+                    while (ptr != runEnd)
+                    {
+                        ptr += appendLiteralCode(buffer, ptr);
                     }
                 }
             }
+            else
+            {
+                formatArgument(buffer, op->code, op->operand, args);
+            }
         }
     }
 
@@ -598,6 +755,12 @@ namespace OpenLoco::StringManager
                 return;
             }
 
+            if (const auto* compiled = findCompiledString(id, sourceStr); compiled != nullptr)
+            {
+                formatCompiledString(buffer, *compiled, args);
+                return;
+            }
+
             formatStringPart(buffer, sourceStr, args);
         }
         else if (id < kUserStringsEnd)
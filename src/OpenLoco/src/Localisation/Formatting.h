@@ -134,6 +134,11 @@ namespace OpenLoco::StringManager
 
     std::pair<StringId, StringId> monthToString(MonthId month);
 
+    // Prepares a language string so it can be formatted without scanning it, the string must not change
+    // until the compiled strings are cleared.
+    void compileString(StringId id, const char* str);
+    void clearCompiledStrings();
+
     int32_t internalLengthToComma1DP(const int32_t length);
     size_t locoStrlen(const char* buffer);
     size_t locoStrlenS(const char* buffer, std::size_t size);
@@ -9,10 +9,15 @@
 #include "Ui.h"
 #include "Unicode.h"
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Platform.h>
 #include <cassert>
+#include <cstring>
 #include <iostream>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <yaml-cpp/yaml.h>
 
@@ -22,6 +27,8 @@ using namespace OpenLoco::Diagnostics;
 namespace OpenLoco::Localisation
 {
     static std::vector<std::unique_ptr<char[]>> _stringsOwner;
+    // Mapped string caches, the strings of a cache point into its mapping
+    static std::vector<std::unique_ptr<FileStream>> _mappedCaches;
 
     static const std::map<std::string, uint8_t, std::less<>> kBasicCommands = {
         { "INT16_1DP", ControlCodes::int16_decimals },
@@ -248,13 +255,190 @@ namespace OpenLoco::Localisation
         }
     }
 
+    // The processed strings of a language file are cached so the YAML doesn't have to be parsed again.
+    // The cache holds a table of string ids with offsets into a pool of the null terminated strings, and
+    // is used in place from its mapping as long as the language file has the same size, time and hash.
+    static constexpr char kCacheMagic[4] = { 'O', 'L', 'L', 'C' };
+    static constexpr uint32_t kCacheVersion = 1;
+
+#pragma pack(push, 1)
+    struct CacheHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceLastWrite;
+        uint64_t sourceHash;
+        uint32_t numStrings;
+        uint32_t stringPoolSize;
+    };
+    static_assert(sizeof(CacheHeader) == 40);
+
+    struct CacheStringRecord
+    {
+        uint16_t id;
+        uint32_t offset;
+    };
+    static_assert(sizeof(CacheStringRecord) == 6);
+#pragma pack(pop)
+
+    struct SourceState
+    {
+        uint64_t size;
+        int64_t lastWrite;
+        uint64_t hash;
+    };
+
+    static fs::path getCachePath(const fs::path& languageFile)
+    {
+        return Environment::getPathNoWarning(Environment::PathId::languageCache) / languageFile.filename().replace_extension(".dat");
+    }
+
+    // FNV-1a
+    static uint64_t hashData(std::span<const std::byte> data)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        for (auto b : data)
+        {
+            hash ^= static_cast<uint8_t>(b);
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    static SourceState getSourceState(const fs::path& languageFile)
+    {
+        SourceState state{};
+        state.size = fs::file_size(languageFile);
+        state.lastWrite = fs::last_write_time(languageFile).time_since_epoch().count();
+
+        FileStream stream(languageFile, StreamMode::readMapped);
+        state.hash = hashData(stream.readView(stream.getLength()));
+        return state;
+    }
+
+    static void setLanguageString(StringId id, char* str)
+    {
+        StringManager::swapString(id, str);
+        StringManager::compileString(id, str);
+    }
+
+    static bool tryLoadCache(const fs::path& cachePath, const SourceState& source)
+    {
+        if (!fs::exists(cachePath))
+        {
+            return false;
+        }
+
+        auto stream = std::make_unique<FileStream>();
+        stream->open(cachePath, StreamMode::readMapped);
+        if (!stream->isOpen() || stream->getLength() < sizeof(CacheHeader))
+        {
+            return false;
+        }
+
+        const auto header = stream->readValue<CacheHeader>();
+        if (std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 || header.version != kCacheVersion
+            || header.sourceSize != source.size || header.sourceLastWrite != source.lastWrite || header.sourceHash != source.hash)
+        {
+            return false;
+        }
+
+        const auto recordsSize = static_cast<size_t>(header.numStrings) * sizeof(CacheStringRecord);
+        if (stream->getLength() - stream->getPosition() != recordsSize + header.stringPoolSize || header.stringPoolSize == 0)
+        {
+            return false;
+        }
+        const auto recordData = stream->readView(recordsSize);
+        const auto poolData = stream->readView(header.stringPoolSize);
+        if (recordData.size() != recordsSize || poolData.size() != header.stringPoolSize || poolData.back() != std::byte{ 0 })
+        {
+            return false;
+        }
+
+        const auto records = std::span(reinterpret_cast<const CacheStringRecord*>(recordData.data()), header.numStrings);
+        auto* pool = reinterpret_cast<const char*>(poolData.data());
+        for (const auto& record : records)
+        {
+            if (record.offset >= header.stringPoolSize)
+            {
+                return false;
+            }
+        }
+
+        // Nothing writes to language strings, they are only swapped out
+        for (const auto& record : records)
+        {
+            setLanguageString(record.id, const_cast<char*>(pool + record.offset));
+        }
+        _mappedCaches.push_back(std::move(stream));
+        return true;
+    }
+
+    static void saveCache(const fs::path& cachePath, const SourceState& source, std::span<const std::pair<StringId, const char*>> strings)
+    {
+        std::vector<CacheStringRecord> records;
+        std::string stringPool;
+        records.reserve(strings.size());
+        for (const auto& [id, str] : strings)
+        {
+            records.push_back({ id, static_cast<uint32_t>(stringPool.size()) });
+            // Inline sprites can have zero bytes in their id, so the length has to skip over control codes
+            stringPool.append(str, StringManager::locoStrlen(str) + 1);
+        }
+
+        CacheHeader header{};
+        std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+        header.version = kCacheVersion;
+        header.sourceSize = source.size;
+        header.sourceLastWrite = source.lastWrite;
+        header.sourceHash = source.hash;
+        header.numStrings = static_cast<uint32_t>(records.size());
+        header.stringPoolSize = static_cast<uint32_t>(stringPool.size());
+
+        std::error_code ec;
+        fs::create_directories(cachePath.parent_path(), ec);
+
+        FileStream stream;
+        stream.open(cachePath, StreamMode::write);
+        if (!stream.isOpen())
+        {
+            Logging::warn("Unable to save language cache {}", cachePath.u8string());
+            return;
+        }
+        stream.writeValue(header);
+        stream.write(records.data(), records.size() * sizeof(CacheStringRecord));
+        stream.write(stringPool.data(), stringPool.size());
+    }
+
     static bool loadLanguageStringTable(fs::path languageFile)
     {
         try
         {
+            Core::Timer loadTimer;
+
+            std::optional<SourceState> source;
+            fs::path cachePath;
+            try
+            {
+                source = getSourceState(languageFile);
+                cachePath = getCachePath(languageFile);
+                if (tryLoadCache(cachePath, *source))
+                {
+                    Logging::verbose("Loaded {} from the language cache in {} milliseconds.", languageFile.filename().u8string(), loadTimer.elapsed());
+                    return true;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                // A broken cache is replaced from the language file
+                Logging::warn("Unable to use the language cache: {}", e.what());
+            }
+
             YAML::Node node = YAML::LoadFile(languageFile.string());
             node = node["strings"];
 
+            std::vector<std::pair<StringId, const char*>> loadedStrings;
             for (YAML::const_iterator it = node.begin(); it != node.end(); ++it)
             {
                 int id = it->first.as<int>();
@@ -269,7 +453,21 @@ namespace OpenLoco::Localisation
 
                 if (processedString != nullptr)
                 {
-                    StringManager::swapString(id, processedString);
+                    setLanguageString(id, processedString);
+                    loadedStrings.emplace_back(static_cast<StringId>(id), processedString);
+                }
+            }
+            Logging::verbose("Loaded {} in {} milliseconds.", languageFile.filename().u8string(), loadTimer.elapsed());
+
+            if (source.has_value())
+            {
+                try
+                {
+                    saveCache(cachePath, *source, loadedStrings);
+                }
+                catch (const std::exception& e)
+                {
+                    Logging::warn("Unable to save the language cache: {}", e.what());
                 }
             }
 
@@ -285,6 +483,8 @@ namespace OpenLoco::Localisation
 
     void loadLanguageFile()
     {
+        StringManager::clearCompiledStrings();
+
         // First, load en-GB for fallback strings.
         fs::path languageDir = Environment::getPath(Environment::PathId::languageFiles);
         fs::path languageFile = languageDir / "en-GB.yml";
@@ -310,6 +510,8 @@ namespace OpenLoco::Localisation
 
     void unloadLanguageFile()
     {
+        StringManager::clearCompiledStrings();
         _stringsOwner.clear();
+        _mappedCaches.clear();
     }
 }
@@ -2032,6 +2032,14 @@ namespace OpenLoco::StringIds
     constexpr StringId confirm_vehicle_component_refit_cargo_warning_title = 2366;
     constexpr StringId confirm_vehicle_component_refit_cargo_warning_message = 2367;
     constexpr StringId confirm_vehicle_component_refit_cargo_warning_confirm = 2368;
+    constexpr StringId debug_tick_profiler_log_csv = 2369;
+    constexpr StringId debug_tick_profiler_log_csv_tooltip = 2370;
+    constexpr StringId shortcut_game_speed_turbo = 2371;
+    constexpr StringId display_render_driver = 2372;
+    constexpr StringId display_render_driver_automatic = 2373;
+    constexpr StringId debug_show_dirty_regions = 2374;
+    constexpr StringId debug_show_dirty_regions_tooltip = 2375;
+    constexpr StringId error_autosave_failed = 2376;
 
     constexpr StringId temporary_object_load_str_0 = 8192;
     constexpr StringId temporary_object_load_str_1 = 8193;
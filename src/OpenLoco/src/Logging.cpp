@@ -1,5 +1,6 @@
 #include "Logging.h"
 
+#include <OpenLoco/Diagnostics/LogAsync.h>
 #include <OpenLoco/Diagnostics/LogFile.h>
 #include <OpenLoco/Diagnostics/LogTerminal.h>
 #include <OpenLoco/Diagnostics/Logging.h>
@@ -10,7 +11,7 @@
 namespace OpenLoco::Diagnostics::Logging
 {
     static std::shared_ptr<LogTerminal> _terminalLogSink{};
-    static std::shared_ptr<LogFile> _fileLogSink{};
+    static std::shared_ptr<LogAsync> _fileLogSink{};
 
     // The maximum amount of log files to keep in the folder, will delete the oldest
     // logs if the amount of file exceeds this number.
@@ -107,10 +108,12 @@ namespace OpenLoco::Diagnostics::Logging
         _terminalLogSink->setLevelMask(logLevelMask);
         Logging::installSink(_terminalLogSink);
 
-        // Setup log file sink.
+        // Setup log file sink, written from a background thread so verbose logging stays cheap.
         const auto logFile = logsFolder / getLogFileName();
-        _fileLogSink = std::make_shared<LogFile>(logFile);
-        _fileLogSink->setWriteTimestamps(true);
+        auto fileSink = std::make_shared<LogFile>(logFile);
+        fileSink->setWriteTimestamps(true);
+        fileSink->setFlushEachMessage(false);
+        _fileLogSink = std::make_shared<LogAsync>(fileSink);
         _fileLogSink->setLevelMask(logLevelMask);
         Logging::installSink(_fileLogSink);
     }
@@ -119,5 +122,8 @@ namespace OpenLoco::Diagnostics::Logging
     {
         Logging::removeSink(_fileLogSink);
         Logging::removeSink(_terminalLogSink);
+
+        // Stops the writer thread once the remaining messages are written.
+        _fileLogSink.reset();
     }
 }
@@ -6,15 +6,38 @@
 #include "GameStateFlags.h"
 #include "IndustryElement.h"
 #include "RoadElement.h"
+#include "ScenarioManager.h"
 #include "SignalElement.h"
 #include "StationElement.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
 #include <array>
+#include <functional>
+#include <numeric>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
 namespace OpenLoco::World::AnimationManager
 {
+    // Animations that only redraw are grouped by how often they are due. An animation in bucket n
+    // is due on the ticks whose low n bits are zero, so bucket 0 is updated every tick and all of
+    // the buckets are due on tick 0. Animations that change the map always stay in bucket 0.
+    static constexpr uint8_t kMaxTickShift = 16;
+    static constexpr uint8_t kIdleBucket = kMaxTickShift + 1;
+    static constexpr size_t kNumBuckets = kIdleBucket + 1;
+
+    // Runtime only, the game state keeps the animations themselves.
+    static std::array<std::vector<uint16_t>, kNumBuckets> _buckets;
+    static std::array<uint8_t, Limits::kMaxAnimations> _bucketOf;
+    static std::array<uint16_t, Limits::kMaxAnimations> _bucketPos;
+    // Creation order, swap removal reorders the animations so this restores the vanilla layout
+    static std::array<uint32_t, Limits::kMaxAnimations> _sequence;
+    static uint32_t _nextSequence;
+
+    static std::vector<uint16_t> _dueScratch;
+    static std::vector<uint16_t> _removeScratch;
+
     static auto& rawAnimations()
     {
         return getGameState().animations;
@@ -25,6 +48,34 @@ namespace OpenLoco::World::AnimationManager
         return getGameState().numMapAnimations;
     }
 
+    static void addToBucket(uint16_t index, uint8_t bucket)
+    {
+        _bucketOf[index] = bucket;
+        _bucketPos[index] = static_cast<uint16_t>(_buckets[bucket].size());
+        _buckets[bucket].push_back(index);
+    }
+
+    static void removeFromBucket(uint16_t index)
+    {
+        auto& bucket = _buckets[_bucketOf[index]];
+        const auto pos = _bucketPos[index];
+        bucket[pos] = bucket.back();
+        _bucketPos[bucket[pos]] = pos;
+        bucket.pop_back();
+    }
+
+    // A mask wider than kMaxTickShift bits is still due on a subset of the capped bucket's ticks,
+    // the update function does the exact check.
+    static uint8_t getBucketForTickMask(uint32_t tickMask)
+    {
+        uint8_t shift = 0;
+        while (shift < kMaxTickShift && (tickMask & (1U << shift)))
+        {
+            shift++;
+        }
+        return shift;
+    }
+
     // 0x004612A6
     void createAnimation(uint8_t type, const Pos2& pos, tile_coord_t baseZ)
     {
@@ -42,19 +93,68 @@ namespace OpenLoco::World::AnimationManager
             }
         }
 
-        auto& newAnimation = rawAnimations()[numAnimations()++];
+        const auto index = numAnimations()++;
+        auto& newAnimation = rawAnimations()[index];
         newAnimation.baseZ = baseZ;
         newAnimation.type = type;
         newAnimation.pos = pos;
+
+        // New animations are updated on the next tick, which tells how often they are due
+        _sequence[index] = _nextSequence++;
+        addToBucket(index, type == 2 ? kIdleBucket : 0);
     }
 
     // 0x00461166
     void reset()
     {
         numAnimations() = 0;
+        rebuildSchedule();
+    }
+
+    void rebuildSchedule()
+    {
+        for (auto& bucket : _buckets)
+        {
+            bucket.clear();
+        }
+        for (uint16_t i = 0; i < numAnimations(); ++i)
+        {
+            _sequence[i] = i;
+            addToBucket(i, rawAnimations()[i].type == 2 ? kIdleBucket : 0);
+        }
+        _nextSequence = numAnimations();
     }
 
-    static bool callUpdateFunction(Animation& anim)
+    void toVanillaLayout()
+    {
+        const auto count = numAnimations();
+        std::vector<uint16_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [](uint16_t a, uint16_t b) { return _sequence[a] < _sequence[b]; });
+
+        std::vector<Animation> animations(count);
+        std::vector<uint8_t> bucketOf(count);
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            animations[i] = rawAnimations()[order[i]];
+            bucketOf[i] = _bucketOf[order[i]];
+        }
+
+        for (auto& bucket : _buckets)
+        {
+            bucket.clear();
+        }
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            rawAnimations()[i] = animations[i];
+            _sequence[i] = i;
+            addToBucket(i, bucketOf[i]);
+        }
+        _nextSequence = count;
+    }
+
+    // Sets tickMask to the ticks the animation can skip, which stays zero when it changes the map.
+    static bool callUpdateFunction(Animation& anim, uint32_t& tickMask)
     {
         switch (anim.type)
         {
@@ -65,55 +165,82 @@ namespace OpenLoco::World::AnimationManager
             case 2:
                 return false;
             case 3:
-                return updateIndustryAnimation1(anim);
+                return updateIndustryAnimation1(anim, tickMask);
             case 4:
                 return updateIndustryAnimation2(anim);
             case 5:
-                return updateBuildingAnimation1(anim);
+                return updateBuildingAnimation1(anim, tickMask);
             case 6:
-                return updateBuildingAnimation2(anim);
+                return updateBuildingAnimation2(anim, tickMask);
             case 7:
-                return updateAirportStationAnimation(anim);
+                return updateAirportStationAnimation(anim, tickMask);
             case 8:
-                return updateDockStationAnimation(anim);
+                return updateDockStationAnimation(anim, tickMask);
         }
         assert(false);
         return false;
     }
 
+    // Swaps the last animation into the removed slot
+    static void removeAnimation(uint16_t index)
+    {
+        removeFromBucket(index);
+
+        const uint16_t last = numAnimations() - 1;
+        if (index != last)
+        {
+            const auto bucket = _bucketOf[last];
+            removeFromBucket(last);
+            rawAnimations()[index] = rawAnimations()[last];
+            _sequence[index] = _sequence[last];
+            addToBucket(index, bucket);
+        }
+        numAnimations() = last;
+    }
+
     // 0x004612EC
     void update()
     {
-        if (Game::hasFlags(GameStateFlags::tileManagerLoaded))
+        if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
+        {
+            return;
+        }
+
+        // Collect the due animations first as updating them moves them between buckets
+        const auto ticks = ScenarioManager::getScenarioTicks();
+        _dueScratch.clear();
+        for (uint8_t bucket = 0; bucket <= kMaxTickShift; ++bucket)
         {
-            std::array<bool, Limits::kMaxAnimations> animsToRemove{};
-            for (uint16_t i = 0; i < numAnimations(); ++i)
+            if (bucket != 0 && (ticks & (1U << (bucket - 1))))
             {
-                auto& animation = rawAnimations()[i];
-                animsToRemove[i] = callUpdateFunction(animation);
+                break;
             }
+            _dueScratch.insert(_dueScratch.end(), _buckets[bucket].begin(), _buckets[bucket].end());
+        }
 
-            // Remove animations that are no longer required
-            uint16_t last = 0;
-            for (uint16_t i = 0; i < numAnimations(); ++i, ++last)
+        _removeScratch.clear();
+        for (const auto index : _dueScratch)
+        {
+            uint32_t tickMask = 0;
+            if (callUpdateFunction(rawAnimations()[index], tickMask))
             {
-                while (animsToRemove[i] && i < numAnimations())
-                {
-                    ++i;
-                }
-                if (i >= numAnimations())
-                {
-                    break;
-                }
-                rawAnimations()[last] = rawAnimations()[i];
+                _removeScratch.push_back(index);
+                continue;
             }
 
-            // For vanilla binary compatibility copy the old last entry across all garbage entries
-            auto repCount = numAnimations() - last;
-            std::fill_n(std::next(std::begin(rawAnimations()), last), repCount, rawAnimations()[numAnimations() - 1]);
-            // Above to be deleted when confirmed matching
+            const auto bucket = getBucketForTickMask(tickMask);
+            if (bucket != _bucketOf[index])
+            {
+                removeFromBucket(index);
+                addToBucket(index, bucket);
+            }
+        }
 
-            numAnimations() = last;
+        // Remove the highest slots first so the slot swapped in is never one pending removal
+        std::sort(_removeScratch.begin(), _removeScratch.end(), std::greater<>());
+        for (const auto index : _removeScratch)
+        {
+            removeAnimation(index);
         }
     }
 }
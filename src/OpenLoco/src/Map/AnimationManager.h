@@ -6,4 +6,10 @@ namespace OpenLoco::World::AnimationManager
     void createAnimation(uint8_t type, const Pos2& pos, tile_coord_t baseZ);
     void reset();
     void update();
+
+    // Rebuilds the update schedule from the animations in the game state, call after loading.
+    void rebuildSchedule();
+
+    // Restores the creation order of the animations that vanilla keeps, call before saving.
+    void toVanillaLayout();
 }
@@ -192,7 +192,7 @@ namespace OpenLoco::World
     }
 
     // 0x0042E4D4
-    bool updateBuildingAnimation1(const Animation& anim)
+    bool updateBuildingAnimation1(const Animation& anim, uint32_t& tickMask)
     {
         auto tile = TileManager::get(anim.pos);
         BuildingElement* elBuilding = nullptr;
@@ -226,7 +226,8 @@ namespace OpenLoco::World
             return true;
         }
 
-        if (ScenarioManager::getScenarioTicks() & 0b1)
+        tickMask = 0b1;
+        if (ScenarioManager::getScenarioTicks() & tickMask)
         {
             return false;
         }
@@ -240,7 +241,7 @@ namespace OpenLoco::World
     }
 
     // 0x0042E646
-    bool updateBuildingAnimation2(const Animation& anim)
+    bool updateBuildingAnimation2(const Animation& anim, uint32_t& tickMask)
     {
         auto tile = TileManager::get(anim.pos);
         BuildingElement* elBuilding = nullptr;
@@ -288,6 +289,7 @@ namespace OpenLoco::World
             return true;
         }
         const auto speedMask = ((1 << slowestSpeed) - 1);
+        tickMask = speedMask;
         if (!(ScenarioManager::getScenarioTicks() & speedMask))
         {
             Ui::ViewportManager::invalidate(anim.pos, elBuilding->baseHeight(), elBuilding->clearHeight(), ZoomLevel::quarter);
@@ -74,6 +74,6 @@ namespace OpenLoco::World
     // static_assert(sizeof(BuildingElement) == kTileElementSize); // COMMENTED FOR 64-BIT DEBUG
 
     struct Animation;
-    bool updateBuildingAnimation1(const Animation& anim);
-    bool updateBuildingAnimation2(const Animation& anim);
+    bool updateBuildingAnimation1(const Animation& anim, uint32_t& tickMask);
+    bool updateBuildingAnimation2(const Animation& anim, uint32_t& tickMask);
 }
@@ -222,6 +222,11 @@ namespace OpenLoco::World
             const auto tileStart = toTileSpace(loc);
             for (auto& tilePos : getClampedRange(tileStart - TilePos2{ kLowerRange, kLowerRange }, tileStart + TilePos2{ upperRange, upperRange }))
             {
+                if (!TileManager::hasElementType(tilePos, ElementType::station))
+                {
+                    continue;
+                }
+
                 auto tile = TileManager::get(tilePos);
                 for (auto& el : tile)
                 {
@@ -243,7 +248,7 @@ namespace OpenLoco::World
     }
 
     // 0x00456E32
-    bool updateIndustryAnimation1(const Animation& anim)
+    bool updateIndustryAnimation1(const Animation& anim, uint32_t& tickMask)
     {
         auto tile = TileManager::get(anim.pos);
         for (auto& el : tile)
@@ -278,6 +283,7 @@ namespace OpenLoco::World
                 return true;
             }
             const auto speedMask = ((1 << animSpeed) - 1);
+            tickMask = speedMask;
             if (!(ScenarioManager::getScenarioTicks() & speedMask))
             {
                 Ui::ViewportManager::invalidate(anim.pos, el.baseHeight(), el.clearHeight(), ZoomLevel::quarter);
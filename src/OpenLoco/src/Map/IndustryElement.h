@@ -69,6 +69,6 @@ namespace OpenLoco::World
     // static_assert(sizeof(IndustryElement) == kTileElementSize); // COMMENTED FOR 64-BIT DEBUG
 
     struct Animation;
-    bool updateIndustryAnimation1(const Animation& anim);
+    bool updateIndustryAnimation1(const Animation& anim, uint32_t& tickMask);
     bool updateIndustryAnimation2(const Animation& anim);
 }
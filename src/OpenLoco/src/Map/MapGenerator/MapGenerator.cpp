@@ -25,9 +25,13 @@
 #include "SimplexTerrainGenerator.h"
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
+#include "Vehicles/Vehicle.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Core/JobSystem.h>
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -162,7 +166,7 @@ namespace OpenLoco::World::MapGenerator
             }
 
             const MicroZ baseHeight = std::min({ q00, q01, q10, q11 });
-            surfaceElement->setBaseZ(baseHeight * kMicroToSmallZStep);
+            const SmallZ baseZ = baseHeight * kMicroToSmallZStep;
 
             uint8_t currentSlope = SurfaceSlope::flat;
 
@@ -195,18 +199,16 @@ namespace OpenLoco::World::MapGenerator
             }
             // clang-format on
 
-            surfaceElement->setSlope(currentSlope);
-
-            auto clearZ = surfaceElement->baseZ();
-            if (surfaceElement->slopeCorners())
+            auto clearZ = baseZ;
+            if ((currentSlope & 0x0F) != 0)
             {
                 clearZ += kSmallZStep;
             }
-            if (surfaceElement->isSlopeDoubleHeight())
+            if ((currentSlope & SurfaceSlope::doubleHeight) != 0)
             {
                 clearZ += kSmallZStep;
             }
-            surfaceElement->setClearZ(clearZ);
+            TileManager::setSurfaceHeight(pos, *surfaceElement, baseZ, clearZ, currentSlope);
         }
     }
 
@@ -222,7 +224,7 @@ namespace OpenLoco::World::MapGenerator
 
             if (surface != nullptr && surface->baseZ() < (seaLevel << 2))
             {
-                surface->setWater(seaLevel);
+                TileManager::setSurfaceWater(pos, *surface, seaLevel);
             }
         }
     }
@@ -280,6 +282,87 @@ namespace OpenLoco::World::MapGenerator
         return ((randVal & 0xFF) * landObj->numVariations) >> 8;
     }
 
+    // Marks every tile within the radius of a source tile in the range, the same as marking the clamped
+    // square around each source tile but without visiting each square.
+    template<typename Func>
+    static void markTilesAround(HeightMap& heightMap, TilePos2 min, TilePos2 max, int32_t radius, Func&& isSource)
+    {
+        const int32_t width = heightMap.width;
+        const int32_t height = heightMap.height;
+        constexpr int32_t kFar = std::numeric_limits<int16_t>::max();
+
+        // Whether a source tile is within the radius along the row
+        std::vector<uint8_t> nearRow(width * height);
+        for (int32_t y = min.y; y <= max.y; y++)
+        {
+            auto* row = &nearRow[y * width];
+            int32_t lastSource = -kFar;
+            for (int32_t x = 0; x < width; x++)
+            {
+                if (x >= min.x && x <= max.x && isSource(TilePos2(x, y)))
+                {
+                    lastSource = x;
+                }
+                row[x] = x - lastSource <= radius;
+            }
+            int32_t nextSource = kFar;
+            for (int32_t x = width - 1; x >= 0; x--)
+            {
+                if (x >= min.x && x <= max.x && isSource(TilePos2(x, y)))
+                {
+                    nextSource = x;
+                }
+                row[x] |= nextSource - x <= radius;
+            }
+        }
+
+        // Then the same along the columns for the tiles near a source in their row
+        for (int32_t x = 0; x < width; x++)
+        {
+            int32_t lastNear = -kFar;
+            for (int32_t y = 0; y < height; y++)
+            {
+                if (nearRow[y * width + x])
+                {
+                    lastNear = y;
+                }
+                if (y - lastNear <= radius)
+                {
+                    heightMap.setMarker({ x, y });
+                }
+            }
+            int32_t nextNear = kFar;
+            for (int32_t y = height - 1; y >= 0; y--)
+            {
+                if (nearRow[y * width + x])
+                {
+                    nextNear = y;
+                }
+                if (nextNear - y <= radius)
+                {
+                    heightMap.setMarker({ x, y });
+                }
+            }
+        }
+    }
+
+    // Runs the function for bands of rows of tiles on several threads. Only for passes that don't use
+    // the random number generators and only change the tile they are given.
+    template<typename Func>
+    static void parallelForEachTile(TilePos2 min, TilePos2 max, Func&& func)
+    {
+        const auto numRows = std::max<int32_t>(max.y - min.y + 1, 0);
+        Core::JobSystem::get().parallelFor("Map generation", numRows, 16, [&](size_t beginRow, size_t endRow) {
+            for (auto y = min.y + static_cast<int32_t>(beginRow); y < min.y + static_cast<int32_t>(endRow); y++)
+            {
+                for (int32_t x = min.x; x <= max.x; x++)
+                {
+                    func(TilePos2(x, y));
+                }
+            }
+        });
+    }
+
     static void applySurfaceStyleToMarkedTiles(HeightMap& heightMap, uint8_t surfaceStyle, bool requireMark)
     {
         for (auto& pos : World::getDrawableTileRange())
@@ -313,19 +396,9 @@ namespace OpenLoco::World::MapGenerator
 
         // Mark tiles near water
         auto seaLevel = getGameState().seaLevel;
-        for (auto pos : getWorldRange())
-        {
-            auto height = heightMap.getHeight({ pos.x, pos.y });
-            if (height > seaLevel)
-            {
-                continue;
-            }
-
-            for (auto lookaheadPos : getClampedRange(pos - TilePos2(25, 25), pos + TilePos2(25, 25)))
-            {
-                heightMap.setMarker({ lookaheadPos.x, lookaheadPos.y });
-            }
-        }
+        markTilesAround(heightMap, { 0, 0 }, { kMapColumns - 1, kMapRows - 1 }, 25, [&](const TilePos2& pos) {
+            return heightMap.getHeight(pos) <= seaLevel;
+        });
 
         // Apply surface style to tiles that have *not* been marked
         applySurfaceStyleToMarkedTiles(heightMap, surfaceStyle, false);
@@ -338,19 +411,9 @@ namespace OpenLoco::World::MapGenerator
 
         // Mark tiles near water
         auto seaLevel = getGameState().seaLevel;
-        for (auto pos : getWorldRange())
-        {
-            auto height = heightMap.getHeight({ pos.x, pos.y });
-            if (height < seaLevel)
-            {
-                continue;
-            }
-
-            for (auto lookaheadPos : getClampedRange(pos - TilePos2(25, 25), pos + TilePos2(25, 25)))
-            {
-                heightMap.setMarker({ lookaheadPos.x, lookaheadPos.y });
-            }
-        }
+        markTilesAround(heightMap, { 0, 0 }, { kMapColumns - 1, kMapRows - 1 }, 25, [&](const TilePos2& pos) {
+            return heightMap.getHeight(pos) >= seaLevel;
+        });
 
         // Apply surface style to tiles that have been marked
         applySurfaceStyleToMarkedTiles(heightMap, surfaceStyle, true);
@@ -362,20 +425,10 @@ namespace OpenLoco::World::MapGenerator
         heightMap.resetMarkerFlags();
 
         // Mark tiles above mountain level
-        for (auto pos : getWorldRange())
-        {
+        markTilesAround(heightMap, { 0, 0 }, { kMapColumns - 1, kMapRows - 1 }, 12, [&](const TilePos2& pos) {
             // NB: this is an inclusive check to match vanilla
-            auto height = heightMap.getHeight({ pos.x, pos.y });
-            if (height <= kMountainTerrainHeight)
-            {
-                continue;
-            }
-
-            for (auto lookaheadPos : getClampedRange(pos - TilePos2(12, 12), pos + TilePos2(12, 12)))
-            {
-                heightMap.setMarker({ lookaheadPos.x, lookaheadPos.y });
-            }
-        }
+            return heightMap.getHeight(pos) > kMountainTerrainHeight;
+        });
 
         // Apply surface style to tiles that have been marked
         applySurfaceStyleToMarkedTiles(heightMap, surfaceStyle, true);
@@ -387,20 +440,10 @@ namespace OpenLoco::World::MapGenerator
         heightMap.resetMarkerFlags();
 
         // Mark tiles above mountain level
-        for (auto pos : getWorldRange())
-        {
+        markTilesAround(heightMap, { 0, 0 }, { kMapColumns - 1, kMapRows - 1 }, 25, [&](const TilePos2& pos) {
             // NB: this is an exclusive check to match vanilla
-            auto height = heightMap.getHeight({ pos.x, pos.y });
-            if (height < kMountainTerrainHeight)
-            {
-                continue;
-            }
-
-            for (auto lookaheadPos : getClampedRange(pos - TilePos2(25, 25), pos + TilePos2(25, 25)))
-            {
-                heightMap.setMarker({ lookaheadPos.x, lookaheadPos.y });
-            }
-        }
+            return heightMap.getHeight(pos) >= kMountainTerrainHeight;
+        });
 
         // Apply surface style to tiles that have *not* been marked
         applySurfaceStyleToMarkedTiles(heightMap, surfaceStyle, false);
@@ -465,8 +508,7 @@ namespace OpenLoco::World::MapGenerator
         heightMap.resetMarkerFlags();
 
         // Mark tiles with sudden height changes in the next row
-        for (auto pos : getDrawableTileRange())
-        {
+        markTilesAround(heightMap, { 1, 1 }, { kMapColumns - 2, kMapRows - 2 }, 6, [&](const TilePos2& pos) {
             auto heightA = heightMap.getHeight({ pos + TilePos2{ 0, 1 } });
             auto heightB = heightMap.getHeight({ pos + TilePos2{ 0, 1 } });
 
@@ -479,16 +521,13 @@ namespace OpenLoco::World::MapGenerator
                 // Find no cliff between C and D?
                 if (std::abs(heightD - heightC) < kCliffTerrainHeightDiff)
                 {
-                    continue;
+                    return false;
                 }
             }
 
             // Found a cliff around this point, so mark the points around it
-            for (auto lookaheadPos : getClampedRange(pos - TilePos2(6, 6), pos + TilePos2(6, 6)))
-            {
-                heightMap.setMarker({ lookaheadPos.x, lookaheadPos.y });
-            }
-        }
+            return true;
+        });
 
         // Apply surface style to tiles that have been marked
         applySurfaceStyleToMarkedTiles(heightMap, surfaceStyle, true);
@@ -573,14 +612,16 @@ namespace OpenLoco::World::MapGenerator
     // 0x004611DF
     static void generateSurfaceVariation()
     {
-        for (auto& pos : World::getDrawableTileRange())
-        {
+        const auto snowLine = Scenario::getCurrentSnowLine() / kMicroToSmallZStep;
+
+        // Each tile only changes its own surface
+        parallelForEachTile({ 1, 1 }, { kMapColumns - 2, kMapRows - 2 }, [snowLine](const TilePos2& pos) {
             auto tile = TileManager::get(pos);
             auto* surface = tile.surface();
 
             if (surface == nullptr)
             {
-                continue;
+                return;
             }
 
             if (!surface->isIndustrial())
@@ -614,11 +655,10 @@ namespace OpenLoco::World::MapGenerator
                 }
             }
 
-            auto snowLine = Scenario::getCurrentSnowLine() / kMicroToSmallZStep;
             MicroZ baseMicroZ = (surface->baseZ() / kMicroToSmallZStep) + 1;
             auto unk = std::clamp(baseMicroZ - snowLine, 0, 5);
             surface->setSnowCoverage(unk);
-        }
+        });
     }
 
     // 0x004BE0C7
@@ -626,8 +666,11 @@ namespace OpenLoco::World::MapGenerator
     {
         auto currentSeason = getGameState().currentSeason;
 
-        for (auto& pos : World::getDrawableTileRange())
-        {
+        parallelForEachTile({ 1, 1 }, { kMapColumns - 2, kMapRows - 2 }, [currentSeason](const TilePos2& pos) {
+            if (!TileManager::hasElementType(pos, ElementType::tree))
+            {
+                return;
+            }
             auto tile = TileManager::get(pos);
             for (auto& el : tile)
             {
@@ -644,7 +687,7 @@ namespace OpenLoco::World::MapGenerator
                 }
                 break;
             }
-        }
+        });
     }
 
     // 0x004BDA49
@@ -1090,6 +1133,7 @@ namespace OpenLoco::World::MapGenerator
         Scenario::initialiseDate(options.scenarioStartYear);
         Scenario::initialiseSnowLine();
         TileManager::initialise();
+        Vehicles::invalidateNetworkConnections();
         updateProgress(10);
 
         {
@@ -173,18 +173,24 @@ namespace OpenLoco::World::MapGenerator
     // 0x00462556
     void OriginalTerrainGenerator::copyHeightMapFromG1(Gfx::G1Element* g1Element, HeightMap& heightMap)
     {
+        // The images are laid out for the original map size, other sizes take what overlaps
+        constexpr auto kImageSize = kVanillaMapSize;
+        constexpr auto kImagePitch = 512;
         auto* src = g1Element->offset;
 
-        for (auto y = heightMap.height - 1; y > 0; y--)
+        for (auto y = kImageSize - 1; y > 0; y--)
         {
-            for (auto x = heightMap.width - 1; x > 0; x--)
+            for (auto x = kImageSize - 1; x > 0; x--)
             {
-                auto height = std::max<uint8_t>(*src, heightMap[TilePos2(x, y)]);
-                heightMap[TilePos2(x, y)] = height;
+                if (x < heightMap.width && y < heightMap.height)
+                {
+                    auto height = std::max<uint8_t>(*src, heightMap[TilePos2(x, y)]);
+                    heightMap[TilePos2(x, y)] = height;
+                }
                 src++;
             }
 
-            src += kMapPitch;
+            src += kImagePitch;
         }
     }
 
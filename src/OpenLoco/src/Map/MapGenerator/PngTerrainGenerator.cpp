@@ -2,16 +2,140 @@
 #include "Logging.h"
 #include "MapGenerator.h"
 #include "ScenarioOptions.h"
+#include <OpenLoco/Core/JobSystem.h>
 #include <OpenLoco/Engine/World.hpp>
-#include <OpenLoco/Gfx/PngImage.h>
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <memory>
 #include <png.h>
+#include <vector>
+
+#pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
 using namespace OpenLoco::World;
 using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::World::MapGenerator
 {
+    // Tile rows averaged per batch of decoded source rows, which bounds the memory used for any image size.
+    static constexpr int32_t kTileRowsPerBatch = 16;
+
+    // Reads a PNG one row at a time as 8 or 16 bit grey or RGB samples in native byte order.
+    class PngRowReader
+    {
+    private:
+        std::FILE* _file = nullptr;
+        png_structp _pngPtr = nullptr;
+        png_infop _infoPtr = nullptr;
+
+    public:
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t channels = 0;
+        uint32_t bitDepth = 0;
+        bool isInterlaced = false;
+
+        ~PngRowReader()
+        {
+            if (_pngPtr != nullptr)
+            {
+                png_destroy_read_struct(&_pngPtr, _infoPtr != nullptr ? &_infoPtr : nullptr, nullptr);
+            }
+            if (_file != nullptr)
+            {
+                std::fclose(_file);
+            }
+        }
+
+        bool open(const fs::path& path)
+        {
+#ifdef _WIN32
+            _file = _wfopen(path.c_str(), L"rb");
+#else
+            _file = std::fopen(path.c_str(), "rb");
+#endif
+            if (_file == nullptr)
+            {
+                return false;
+            }
+
+            _pngPtr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+            if (_pngPtr == nullptr)
+            {
+                return false;
+            }
+            _infoPtr = png_create_info_struct(_pngPtr);
+            if (_infoPtr == nullptr)
+            {
+                return false;
+            }
+
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                return false;
+            }
+
+            png_init_io(_pngPtr, _file);
+            png_read_info(_pngPtr, _infoPtr);
+
+            // Heights only need the colour channels, low bit depths are widened to bytes and
+            // palettes are looked up, 16 bit samples are kept.
+            const auto colourType = png_get_color_type(_pngPtr, _infoPtr);
+            if (colourType == PNG_COLOR_TYPE_PALETTE)
+            {
+                png_set_palette_to_rgb(_pngPtr);
+            }
+            if (colourType == PNG_COLOR_TYPE_GRAY && png_get_bit_depth(_pngPtr, _infoPtr) < 8)
+            {
+                png_set_expand_gray_1_2_4_to_8(_pngPtr);
+            }
+            if ((colourType & PNG_COLOR_MASK_ALPHA) != 0)
+            {
+                png_set_strip_alpha(_pngPtr);
+            }
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                png_set_swap(_pngPtr);
+            }
+            png_read_update_info(_pngPtr, _infoPtr);
+
+            width = png_get_image_width(_pngPtr, _infoPtr);
+            height = png_get_image_height(_pngPtr, _infoPtr);
+            channels = png_get_channels(_pngPtr, _infoPtr);
+            bitDepth = png_get_bit_depth(_pngPtr, _infoPtr);
+            isInterlaced = png_get_interlace_type(_pngPtr, _infoPtr) != PNG_INTERLACE_NONE;
+            return true;
+        }
+
+        size_t getRowBytes() const
+        {
+            return static_cast<size_t>(width) * channels * (bitDepth / 8);
+        }
+
+        // Reads the next rows into rows, each getRowBytes long.
+        bool readRows(uint8_t* rows, uint32_t numRows)
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < numRows; i++)
+            {
+                png_read_row(_pngPtr, rows + i * getRowBytes(), nullptr);
+            }
+            return true;
+        }
+    };
+
+    template<typename TSample>
+    static uint32_t getPixelLevel(const uint8_t* row, uint32_t x, uint32_t channels)
+    {
+        const auto* samples = reinterpret_cast<const TSample*>(row) + x * channels;
+        return *std::max_element(samples, samples + channels);
+    }
+
     void PngTerrainGenerator::generate(const Scenario::Options& options, const fs::path& path, HeightMap& heightMap)
     {
         if (!fs::is_regular_file(path))
@@ -20,30 +144,76 @@ namespace OpenLoco::World::MapGenerator
             return;
         }
 
-        auto pngImage = Gfx::PngImage::loadFromFile(path);
-        if (pngImage == nullptr)
+        PngRowReader reader;
+        if (!reader.open(path) || reader.width == 0 || reader.height == 0)
         {
             Logging::error("Can't load heightmap file ({})", path);
             return;
         }
+        if (reader.isInterlaced)
+        {
+            // Interlaced passes can't be streamed, the rows would all have to be kept
+            Logging::error("Interlaced heightmap files are not supported ({})", path);
+            return;
+        }
 
         const int maxHeightmapLevels = 40 - options.minLandHeight;
         const float scalingFactor = maxHeightmapLevels / 255.f;
+        const float maxSample = reader.bitDepth == 16 ? 65535.f : 255.f;
 
         std::fill_n(heightMap.data(), heightMap.size(), options.minLandHeight);
 
-        auto width = std::min<int>(World::kMapColumns, pngImage->width);
-        auto height = std::min<int>(World::kMapRows, pngImage->height);
+        // Images larger than the map are shrunk by a whole factor, each tile taking the average of
+        // a square of pixels. Smaller images cover the top left of the map one pixel per tile.
+        const auto scale = std::max<uint32_t>({ 1,
+                                                (reader.width + World::kMapColumns - 1) / World::kMapColumns,
+                                                (reader.height + World::kMapRows - 1) / World::kMapRows });
+        const auto width = std::min<int32_t>(World::kMapColumns, (reader.width + scale - 1) / scale);
+        const auto height = std::min<int32_t>(World::kMapRows, (reader.height + scale - 1) / scale);
 
-        for (int32_t y = 0; y < height; y++)
+        const auto rowBytes = reader.getRowBytes();
+        std::vector<uint8_t> rows(rowBytes * scale * kTileRowsPerBatch);
+
+        for (int32_t batchY = 0; batchY < height; batchY += kTileRowsPerBatch)
         {
-            for (int32_t x = 0; x < width; x++)
+            const auto batchTileRows = std::min(kTileRowsPerBatch, height - batchY);
+            const auto firstSourceRow = static_cast<uint32_t>(batchY) * scale;
+            const auto numSourceRows = std::min(reader.height - firstSourceRow, batchTileRows * scale);
+            if (!reader.readRows(rows.data(), numSourceRows))
             {
-                const auto pixelColour = pngImage->getPixel(x, y);
-
-                auto imgHeight = std::max({ pixelColour.r, pixelColour.g, pixelColour.b });
-                heightMap[{ TilePos2(y, x) }] += imgHeight * scalingFactor; // this must be { y, x } otherwise the heightmap is mirrored
+                Logging::error("Can't read heightmap file ({})", path);
+                return;
             }
+
+            // The rows are decoded in order, the averaging of each tile row is independent.
+            Core::JobSystem::get().parallelFor("Heightmap rows", batchTileRows, 1, [&](size_t begin, size_t end) {
+                for (auto tileRow = static_cast<int32_t>(begin); tileRow < static_cast<int32_t>(end); tileRow++)
+                {
+                    const auto rowBegin = static_cast<uint32_t>(tileRow) * scale;
+                    const auto rowEnd = std::min(rowBegin + scale, numSourceRows);
+                    for (int32_t x = 0; x < width; x++)
+                    {
+                        const auto columnBegin = static_cast<uint32_t>(x) * scale;
+                        const auto columnEnd = std::min(columnBegin + scale, reader.width);
+
+                        uint64_t total = 0;
+                        for (auto sourceY = rowBegin; sourceY < rowEnd; sourceY++)
+                        {
+                            const auto* row = rows.data() + sourceY * rowBytes;
+                            for (auto sourceX = columnBegin; sourceX < columnEnd; sourceX++)
+                            {
+                                total += reader.bitDepth == 16 ? getPixelLevel<uint16_t>(row, sourceX, reader.channels)
+                                                               : getPixelLevel<uint8_t>(row, sourceX, reader.channels);
+                            }
+                        }
+                        const auto numPixels = (rowEnd - rowBegin) * (columnEnd - columnBegin);
+
+                        // On the 0 to 255 scale of 8 bit images, exact for those at one pixel per tile
+                        const auto imgHeight = static_cast<float>(total) / numPixels * (255.f / maxSample);
+                        heightMap[{ TilePos2(batchY + tileRow, x) }] += imgHeight * scalingFactor; // this must be { y, x } otherwise the heightmap is mirrored
+                    }
+                }
+            });
         }
     }
 }
@@ -1,7 +1,9 @@
 #include "SimplexTerrainGenerator.h"
 #include "ScenarioOptions.h"
 #include "Ui/ProgressBar.h"
+#include <OpenLoco/Core/JobSystem.h>
 #include <algorithm>
+#include <vector>
 
 namespace OpenLoco::World::MapGenerator
 {
@@ -69,16 +71,24 @@ namespace OpenLoco::World::MapGenerator
         auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
         uint8_t perm[512];
         noise(perm, std::size(perm));
-        for (int32_t y = 0; y < heightMap.height; y++)
-        {
-            for (int32_t x = 0; x < heightMap.width; x++)
+
+        // Every tile only depends on the permutation table, so bands of rows are generated in parallel.
+        const auto generateRows = [&](int32_t minY, int32_t maxY) {
+            for (int32_t y = minY; y < maxY; y++)
             {
-                auto noiseValue = std::clamp(noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
-                auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
-                auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
-                heightMap[TilePos2(x, y)] = height;
+                for (int32_t x = 0; x < heightMap.width; x++)
+                {
+                    auto noiseValue = std::clamp(noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+                    auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+                    auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
+                    heightMap[TilePos2(x, y)] = height;
+                }
             }
-        }
+        };
+
+        Core::JobSystem::get().parallelFor("Simplex terrain", std::max(heightMap.height, 0), 16, [&](size_t minY, size_t maxY) {
+            generateRows(static_cast<int32_t>(minY), static_cast<int32_t>(maxY));
+        });
     }
 
     void SimplexTerrainGenerator::smooth(int32_t iterations, HeightMapRange heightMap)
@@ -91,21 +101,24 @@ namespace OpenLoco::World::MapGenerator
         const auto progressSteps = (25 - 15) / iterations;
         auto currentProgress = 15;
 
+        // The filter runs in place, so each tile sees the smoothed tiles of the row above and the
+        // smoothed tile to its left. The column totals of three rows are summed first and then
+        // corrected for the tile to the left, which gives the same result as the 3x3 box.
+        std::vector<int32_t> columnTotals(std::max(heightMap.height, 0));
         for (int32_t i = 0; i < iterations; i++)
         {
-            auto copyHeight = heightMap;
             for (int32_t y = 1; y < heightMap.width - 1; y++)
             {
+                for (int32_t x = 0; x < heightMap.height; x++)
+                {
+                    columnTotals[x] = heightMap[TilePos2(x, y - 1)] + heightMap[TilePos2(x, y)] + heightMap[TilePos2(x, y + 1)];
+                }
+
+                int32_t leftHeight = heightMap[TilePos2(0, y)];
                 for (int32_t x = 1; x < heightMap.height - 1; x++)
                 {
-                    int32_t total = 0;
-                    for (int32_t yy = -1; yy <= 1; yy++)
-                    {
-                        for (int32_t xx = -1; xx <= 1; xx++)
-                        {
-                            total += copyHeight[TilePos2(x + xx, y + yy)];
-                        }
-                    }
+                    const int32_t total = columnTotals[x - 1] + columnTotals[x] + columnTotals[x + 1] - leftHeight + heightMap[TilePos2(x - 1, y)];
+                    leftHeight = heightMap[TilePos2(x, y)];
                     heightMap[TilePos2(x, y)] = total / 9;
                 }
             }
@@ -115,7 +128,7 @@ namespace OpenLoco::World::MapGenerator
         }
     }
 
-    float SimplexTerrainGenerator::noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
+    float SimplexTerrainGenerator::noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
     {
         float total = 0.0f;
         float amplitude = persistence;
@@ -128,7 +141,7 @@ namespace OpenLoco::World::MapGenerator
         return total;
     }
 
-    float SimplexTerrainGenerator::generateNoise(uint8_t* perm, float x, float y)
+    float SimplexTerrainGenerator::generateNoise(const uint8_t* perm, float x, float y)
     {
         const float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
         const float G2 = 0.211324865f; // G2 = (3.0-sqrt(3.0))/6.0
@@ -36,9 +36,9 @@ namespace OpenLoco::World::MapGenerator
 
         static void smooth(int32_t iterations, HeightMapRange heightMap);
 
-        static float noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
+        static float noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
 
-        static float generateNoise(uint8_t* perm, float x, float y);
+        static float generateNoise(const uint8_t* perm, float x, float y);
 
         void noise(uint8_t* perm, size_t len);
 
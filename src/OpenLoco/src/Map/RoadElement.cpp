@@ -129,7 +129,6 @@ namespace OpenLoco::World
     bool updateLevelCrossingAnimation(const Animation& anim)
     {
         auto tile = TileManager::get(anim.pos);
-        bool shouldInvalidate = false;
         bool hasAnimation = false;
 
         // It's possible to have multiple level crossing elements on the same tile/baseZ
@@ -158,7 +157,6 @@ namespace OpenLoco::World
             }
             else
             {
-                shouldInvalidate = true;
                 auto newFrame = elRoad->unk6l();
                 if (elRoad->hasUnk7_10())
                 {
@@ -185,13 +183,14 @@ namespace OpenLoco::World
                     }
                     // Doesn't set hasAnimation = true on else branch!
                 }
+                // The closed frame flashes so is drawn differently even when it stays
+                if (newFrame != elRoad->unk6l() || newFrame == 15)
+                {
+                    Ui::ViewportManager::invalidateLevelCrossing(anim.pos, *elRoad, newFrame);
+                }
                 elRoad->setUnk6l(newFrame);
             }
         }
-        if (shouldInvalidate)
-        {
-            Ui::ViewportManager::invalidate(anim.pos, anim.baseZ * kSmallZStep, anim.baseZ * kSmallZStep + 32, ZoomLevel::half);
-        }
 
         return !hasAnimation;
     }
@@ -8,52 +8,54 @@
 
 namespace OpenLoco::World
 {
-    struct AnimResult
+    // Returns whether the side is still animating
+    static bool updateSignalAnimationSide(const Pos2& pos, SignalElement& elSignal, const bool isRight)
     {
-        bool hasAnimation = false;
-        bool shouldInvalidate = false;
+        auto& side = isRight ? elSignal.getRight() : elSignal.getLeft();
+        if (!side.hasSignal())
+        {
+            return false;
+        }
 
-        constexpr AnimResult& operator|=(const AnimResult& rhs)
+        const auto* signalObj = ObjectManager::get<TrainSignalObject>(side.signalObjectId());
+        const auto targetFrame = std::min(side.getUnk4() * 3, signalObj->numFrames - 1);
+        if (side.frame() == targetFrame)
         {
-            hasAnimation |= rhs.hasAnimation;
-            shouldInvalidate |= rhs.shouldInvalidate;
-            return *this;
+            return false;
         }
-    };
 
-    static AnimResult updateSignalAnimationSide(SignalElement::Side& side)
-    {
-        AnimResult res{};
-        if (side.hasSignal())
+        if (!(ScenarioManager::getScenarioTicks() & signalObj->animationSpeed))
         {
-            const auto* signalObj = ObjectManager::get<TrainSignalObject>(side.signalObjectId());
-            const auto targetFrame = std::min(side.getUnk4() * 3, signalObj->numFrames - 1);
-            if (side.frame() != targetFrame)
+            uint8_t newFrame = side.frame() + 1;
+            if (side.frame() >= targetFrame)
             {
-                res.hasAnimation = true;
-                if (!(ScenarioManager::getScenarioTicks() & signalObj->animationSpeed))
+                newFrame = side.frame() - 1;
+                if (signalObj->hasFlags(TrainSignalObjectFlags::unk2))
                 {
-                    uint8_t newFrame = side.frame() + 1;
-                    if (side.frame() >= targetFrame)
-                    {
-                        newFrame = side.frame() - 1;
-                        if (signalObj->hasFlags(TrainSignalObjectFlags::unk2))
-                        {
-                            newFrame = std::min<uint8_t>(newFrame, 1U);
-                        }
-                    }
-                    side.setFrame(newFrame);
-                    res.shouldInvalidate = true;
+                    newFrame = std::min<uint8_t>(newFrame, 1U);
                 }
             }
+            if (newFrame != side.frame())
+            {
+                // Both the old and the new frame
+                Ui::ViewportManager::invalidateSignal(pos, elSignal, isRight);
+                side.setFrame(newFrame);
+                Ui::ViewportManager::invalidateSignal(pos, elSignal, isRight);
+            }
         }
-        return res;
+        return true;
     }
 
     // 0x0048950F
     bool updateSignalAnimation(const Animation& anim)
     {
-        AnimResult result{};
+        bool hasAnimation = false;
+        if (!TileManager::hasElementType(toTileSpace(anim.pos), ElementType::signal))
+        {
+            // Signal has been removed, the animation is no longer needed
+            return true;
+        }
+
         auto tile = TileManager::get(anim.pos);
         // It's possible to have multiple signal elements on the same tile/baseZ ???
         // Unsure why
@@ -68,15 +70,10 @@ namespace OpenLoco::World
             {
                 continue;
             }
-            result |= updateSignalAnimationSide(elSignal->getLeft());
-            result |= updateSignalAnimationSide(elSignal->getRight());
-        }
-
-        if (result.shouldInvalidate)
-        {
-            Ui::ViewportManager::invalidate(anim.pos, anim.baseZ * kSmallZStep, anim.baseZ * kSmallZStep + 32, ZoomLevel::half);
+            hasAnimation |= updateSignalAnimationSide(anim.pos, *elSignal, false);
+            hasAnimation |= updateSignalAnimationSide(anim.pos, *elSignal, true);
         }
 
-        return !result.hasAnimation;
+        return !hasAnimation;
     }
 }
@@ -11,7 +11,7 @@
 namespace OpenLoco::World
 {
     template<typename Object>
-    bool updateStationAnimation(const Animation& anim, StationType stationType)
+    bool updateStationAnimation(const Animation& anim, StationType stationType, uint32_t& tickMask)
     {
         auto tile = TileManager::get(anim.pos);
         for (auto& el : tile)
@@ -49,6 +49,7 @@ namespace OpenLoco::World
                 return true;
             }
             const auto speedMask = ((1 << animSpeed) - 1);
+            tickMask = speedMask;
             if (!(ScenarioManager::getScenarioTicks() & speedMask))
             {
                 Ui::ViewportManager::invalidate(anim.pos, el.baseHeight(), el.clearHeight(), ZoomLevel::quarter);
@@ -59,14 +60,14 @@ namespace OpenLoco::World
     }
 
     // 0x004944B6
-    bool updateDockStationAnimation(const Animation& anim)
+    bool updateDockStationAnimation(const Animation& anim, uint32_t& tickMask)
     {
-        return updateStationAnimation<DockObject>(anim, StationType::docks);
+        return updateStationAnimation<DockObject>(anim, StationType::docks, tickMask);
     }
 
     // 0x004939ED
-    bool updateAirportStationAnimation(const Animation& anim)
+    bool updateAirportStationAnimation(const Animation& anim, uint32_t& tickMask)
     {
-        return updateStationAnimation<AirportObject>(anim, StationType::airport);
+        return updateStationAnimation<AirportObject>(anim, StationType::airport, tickMask);
     }
 }
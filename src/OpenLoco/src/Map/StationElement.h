@@ -73,6 +73,6 @@ namespace OpenLoco::World
 #pragma pack(pop)
     // static_assert(sizeof(StationElement) == kTileElementSize); // COMMENTED FOR 64-BIT DEBUG
 
-    bool updateDockStationAnimation(const Animation& anim);
-    bool updateAirportStationAnimation(const Animation& anim);
+    bool updateDockStationAnimation(const Animation& anim, uint32_t& tickMask);
+    bool updateAirportStationAnimation(const Animation& anim, uint32_t& tickMask);
 }
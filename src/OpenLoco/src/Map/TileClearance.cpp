@@ -210,7 +210,7 @@ namespace OpenLoco::World::TileClearance
     }
 
     // 0x00462B4F
-    static ClearFuncResult callClearFunction(TileElement& el, const std::function<ClearFuncResult(TileElement& el)>& clearFunc)
+    static ClearFuncResult callClearFunction(TileElement& el, const ClearFunctionRef clearFunc)
     {
         if (!clearFunc)
         {
@@ -227,7 +227,7 @@ namespace OpenLoco::World::TileClearance
     };
 
     // 0x0046297D
-    static ClearFuncResult canConstructAtCheckSurfaceElement(uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, const std::function<ClearFuncResult(TileElement& el)>& clearFunc, TileElement& el, const SurfaceElement& elSurface)
+    static ClearFuncResult canConstructAtCheckSurfaceElement(uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, const ClearFunctionRef clearFunc, TileElement& el, const SurfaceElement& elSurface)
     {
         if (elSurface.isAiAllocated())
         {
@@ -335,7 +335,7 @@ namespace OpenLoco::World::TileClearance
     }
 
     // 0x00462AA4
-    static ClearFuncResult canConstructAtCheckNonSurfaceElement(const uint8_t baseZ, const uint8_t clearZ, const QuarterTile& qt, const BuildingCollisionType flags, const std::function<ClearFuncResult(TileElement& el)>& clearFunc, TileElement& el)
+    static ClearFuncResult canConstructAtCheckNonSurfaceElement(const uint8_t baseZ, const uint8_t clearZ, const QuarterTile& qt, const BuildingCollisionType flags, const ClearFunctionRef clearFunc, TileElement& el)
     {
         if (flags == BuildingCollisionType::anyHeight)
         {
@@ -385,7 +385,7 @@ namespace OpenLoco::World::TileClearance
     }
 
     // 0x00462937
-    static bool canConstructAtWithClear(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, BuildingCollisionType flags, std::function<ClearFuncResult(TileElement& el)> clearFunc)
+    static bool canConstructAtWithClear(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, BuildingCollisionType flags, const ClearFunctionRef clearFunc)
     {
         _constructAtElementPositionFlags = ElementPositionFlags::aboveGround;
         if (!drawableCoords(pos))
@@ -429,13 +429,13 @@ namespace OpenLoco::World::TileClearance
     }
 
     // 0x00462908
-    bool applyClearAtAllHeights(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, std::function<ClearFuncResult(TileElement& el)> clearFunc)
+    bool applyClearAtAllHeights(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, const ClearFunctionRef clearFunc)
     {
         return canConstructAtWithClear(pos, baseZ, clearZ, qt, BuildingCollisionType::anyHeight, clearFunc);
     }
 
     // 0x00462917
-    bool applyClearAtStandardHeight(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, std::function<ClearFuncResult(TileElement& el)> clearFunc)
+    bool applyClearAtStandardHeight(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, const ClearFunctionRef clearFunc)
     {
         return canConstructAtWithClear(pos, baseZ, clearZ, qt, BuildingCollisionType::standard, clearFunc);
     }
@@ -3,8 +3,9 @@
 #include "Economy/Currency.h"
 #include "QuarterTile.h"
 #include "Tile.h"
-#include <functional>
+#include <memory>
 #include <sfl/small_set.hpp>
+#include <type_traits>
 
 namespace OpenLoco::World
 {
@@ -30,8 +31,55 @@ namespace OpenLoco::World::TileClearance
 
     void setCollisionErrorMessage(const World::TileElement& el);
 
-    bool applyClearAtAllHeights(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, std::function<ClearFuncResult(TileElement& el)> clearFunc);
-    bool applyClearAtStandardHeight(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, std::function<ClearFuncResult(TileElement& el)> clearFunc);
+    // Non-owning reference to the function called for each colliding element. Unlike std::function
+    // it never allocates or copies the capturing lambdas the commands pass, which only need to
+    // live for the duration of the call.
+    class ClearFunctionRef
+    {
+    public:
+        using Function = ClearFuncResult (*)(TileElement&);
+
+        ClearFunctionRef() = default;
+
+        ClearFunctionRef(Function func)
+            : _function(func)
+            , _call(func == nullptr ? nullptr : &callFunction)
+        {
+        }
+
+        template<typename TFunc>
+        requires(!std::is_same_v<std::remove_cvref_t<TFunc>, ClearFunctionRef> && !std::is_function_v<std::remove_pointer_t<std::decay_t<TFunc>>>)
+        ClearFunctionRef(TFunc&& func)
+            : _object(const_cast<void*>(static_cast<const void*>(std::addressof(func))))
+            , _call([](const ClearFunctionRef& self, TileElement& el) -> ClearFuncResult {
+                return (*static_cast<std::remove_reference_t<TFunc>*>(self._object))(el);
+            })
+        {
+        }
+
+        explicit operator bool() const { return _call != nullptr; }
+
+        ClearFuncResult operator()(TileElement& el) const
+        {
+            return _call(*this, el);
+        }
+
+    private:
+        static ClearFuncResult callFunction(const ClearFunctionRef& self, TileElement& el)
+        {
+            return self._function(el);
+        }
+
+        union
+        {
+            void* _object = nullptr;
+            Function _function;
+        };
+        ClearFuncResult (*_call)(const ClearFunctionRef&, TileElement&) = nullptr;
+    };
+
+    bool applyClearAtAllHeights(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, ClearFunctionRef clearFunc);
+    bool applyClearAtStandardHeight(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt, ClearFunctionRef clearFunc);
     bool canConstructAt(const World::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt);
 
     using RemovedBuildings = sfl::small_set<World::Pos3, 128, LessThanPos3>;
@@ -12,6 +12,7 @@
 #include "Input.h"
 #include "Localisation/FormatArguments.hpp"
 #include "Localisation/StringIds.h"
+#include "MemoryAccounting.h"
 #include "Objects/BridgeObject.h"
 #include "Objects/BuildingObject.h"
 #include "Objects/LandObject.h"
@@ -36,11 +37,15 @@
 #include "WallElement.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
+#include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <optional>
 #include <set>
+#include <utility>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -49,12 +54,45 @@ namespace OpenLoco::World::TileManager
 {
     constexpr auto kNumTiles = kMapPitch * kMapColumns;
     static TileElement* _elements = nullptr; // Was loco_global at 0x005230C8
+    static size_t _elementsCapacity = 0;
     static std::array<TileElement*, kNumTiles> _tiles = {}; // Was loco_global at 0x00E40134
     static TileElement* _elementsEnd = nullptr; // Was loco_global at 0x00F00134
     static const TileElement* _F00158 = nullptr; // Was loco_global at 0x00F00158
     static uint32_t _periodicDefragStartTile = 0; // Was loco_global at 0x00F00168
     static bool _disablePeriodicDefrag = false; // Was loco_global at 0x0050BF6C
 
+    // Below this many free elements the periodic defrag compacts several tiles per tick
+    constexpr uint32_t kDefragLowFreeElements = 64 * kMaxElementsOnOneTile;
+    constexpr uint32_t kDefragElementBudget = 2048;
+    constexpr uint32_t kDefragMaxTilesPerTick = 256;
+
+    // Mirror of each tile's surface height, slope and water level so height queries do not
+    // have to walk the tile's element list. Kept in sync through setSurfaceHeight and setSurfaceWater.
+    struct Heightmap
+    {
+        static constexpr SmallZ kNoSurface = 0xFFU;
+
+        std::array<SmallZ, kMapSize> baseZ{};
+        std::array<uint8_t, kMapSize> slope{};
+        std::array<MicroZ, kMapSize> water{};
+    };
+    static Heightmap _heightmap;
+
+    // Bitmask of the element types present on each tile. Bits are set on insert but only
+    // cleared when the tile is next fully scanned, so a set bit means the type *may* be present.
+    static std::array<uint16_t, kNumTiles> _tileElementTypes = {};
+
+    static constexpr uint16_t getElementTypeBit(ElementType type)
+    {
+        return 1U << enumValue(type);
+    }
+
+    // Element types that TileManager::update has to visit besides the surface
+    static constexpr uint16_t kUpdatableElementTypes = getElementTypeBit(ElementType::building)
+        | getElementTypeBit(ElementType::tree)
+        | getElementTypeBit(ElementType::road)
+        | getElementTypeBit(ElementType::industry);
+
     void disablePeriodicDefrag()
     {
         _disablePeriodicDefrag = true;
@@ -103,6 +141,55 @@ namespace OpenLoco::World::TileManager
         }
 
         _elements = elements;
+        _elementsCapacity = kMaxElements;
+
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::tileElements, []() -> size_t {
+            return (_elementsCapacity * sizeof(TileElement)) + sizeof(_tiles) + sizeof(_heightmap) + sizeof(_tileElementTypes);
+        });
+    }
+
+    // Grows the element store to hold at least minCapacity elements.
+    // Note: Any TileElement pointers invalid after this call
+    static bool growElements(size_t minCapacity)
+    {
+        if (minCapacity <= _elementsCapacity)
+        {
+            return true;
+        }
+        if (minCapacity > kMaxElementsCapacity)
+        {
+            return false;
+        }
+
+        const auto newCapacity = std::min(std::max(minCapacity, _elementsCapacity * 2), kMaxElementsCapacity);
+        auto* newElements = reinterpret_cast<TileElement*>(realloc(_elements, newCapacity * sizeof(TileElement)));
+        if (newElements == nullptr)
+        {
+            return false;
+        }
+        std::memset(newElements + _elementsCapacity, 0, (newCapacity - _elementsCapacity) * sizeof(TileElement));
+
+        // Rebase everything pointing into the old store
+        auto rebase = [oldElements = _elements, newElements](const TileElement* ptr) {
+            return newElements + (ptr - oldElements);
+        };
+        for (auto& tile : _tiles)
+        {
+            if (tile != kInvalidTile)
+            {
+                tile = rebase(tile);
+            }
+        }
+        _elementsEnd = rebase(_elementsEnd);
+        if (_F00158 != nullptr && _F00158 != kInvalidTile)
+        {
+            _F00158 = rebase(_F00158);
+        }
+
+        Logging::verbose("Grew tile element store from {} to {} elements", _elementsCapacity, newCapacity);
+        _elements = newElements;
+        _elementsCapacity = newCapacity;
+        return true;
     }
 
     // 0x00461179
@@ -138,14 +225,30 @@ namespace OpenLoco::World::TileManager
 
     uint32_t numFreeElements()
     {
-        return kMaxElements - (_elementsEnd - _elements);
+        return static_cast<uint32_t>(_elementsCapacity - (_elementsEnd - _elements));
+    }
+
+    uint32_t numUsedElements()
+    {
+        return static_cast<uint32_t>(_elementsEnd - _elements);
+    }
+
+    uint32_t getElementsCapacity()
+    {
+        return static_cast<uint32_t>(_elementsCapacity);
     }
 
-    void setElements(std::span<TileElement> elements)
+    void setElements(std::span<const TileElement> elements)
     {
+        if (!growElements(elements.size() + kMaxElementsOnOneTile))
+        {
+            exitWithError(StringIds::game_init_failure, StringIds::unable_to_allocate_enough_memory);
+            return;
+        }
+
         TileElement* dst = _elements;
-        std::memset(dst, 0, kMaxElements * sizeof(TileElement));
         std::memcpy(dst, elements.data(), elements.size_bytes());
+        std::memset(dst + elements.size(), 0, (_elementsCapacity - elements.size()) * sizeof(TileElement));
         TileManager::updateTilePointers();
     }
 
@@ -209,7 +312,7 @@ namespace OpenLoco::World::TileManager
     static constexpr size_t getTileIndex(const TilePos2& pos)
     {
         // This is the same as (y * kMapPitch) + x
-        return (pos.y << 9) | pos.x;
+        return (pos.y << kMapPitchShift) | pos.x;
     }
 
     Tile get(TilePos2 pos)
@@ -245,7 +348,57 @@ namespace OpenLoco::World::TileManager
         _tiles[index] = elements;
     }
 
-    static std::pair<TileElement*, TileElement*> insertElementPrepareDest(const TilePos2 pos)
+    bool hasElementType(const TilePos2& pos, ElementType type)
+    {
+        const auto index = getTileIndex(pos);
+        if (index >= _tileElementTypes.size())
+        {
+            return false;
+        }
+        return (_tileElementTypes[index] & getElementTypeBit(type)) != 0;
+    }
+
+    static constexpr size_t getHeightmapIndex(const TilePos2& pos)
+    {
+        return (pos.y * kMapColumns) + pos.x;
+    }
+
+    static void setHeightmap(const TilePos2& pos, const SurfaceElement* surface)
+    {
+        const auto index = getHeightmapIndex(pos);
+        if (surface == nullptr)
+        {
+            _heightmap.baseZ[index] = Heightmap::kNoSurface;
+            _heightmap.slope[index] = 0;
+            _heightmap.water[index] = 0;
+            return;
+        }
+        _heightmap.baseZ[index] = surface->baseZ();
+        _heightmap.slope[index] = surface->slope();
+        _heightmap.water[index] = surface->water();
+    }
+
+    void setSurfaceHeight(const TilePos2& pos, SurfaceElement& surface, SmallZ baseZ, SmallZ clearZ, uint8_t slope)
+    {
+        surface.setBaseZ(baseZ);
+        surface.setClearZ(clearZ);
+        surface.setSlope(slope);
+        if (validCoords(pos))
+        {
+            setHeightmap(pos, &surface);
+        }
+    }
+
+    void setSurfaceWater(const TilePos2& pos, SurfaceElement& surface, MicroZ level)
+    {
+        surface.setWater(level);
+        if (validCoords(pos))
+        {
+            setHeightmap(pos, &surface);
+        }
+    }
+
+    static std::pair<TileElement*, TileElement*> insertElementPrepareDest(const TilePos2 pos, ElementType type)
     {
         const auto index = getTileIndex(pos);
         if (index >= _tiles.size())
@@ -254,6 +407,8 @@ namespace OpenLoco::World::TileManager
             return std::make_pair(nullptr, nullptr);
         }
 
+        _tileElementTypes[index] |= getElementTypeBit(type);
+
         auto* source = _tiles[index];
         // _elementsEnd points to the free space at the end of the
         // tile elements. You must always check there is space (checkFreeElementsAndReorganise)
@@ -298,11 +453,12 @@ namespace OpenLoco::World::TileManager
     {
         checkFreeElementsAndReorganise();
 
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos), type);
         if (source == nullptr)
         {
             return nullptr;
         }
+        markTileChanged(pos);
 
         bool lastFound = false;
         // Copy all of the elements that are underneath the new tile (or till end)
@@ -331,7 +487,7 @@ namespace OpenLoco::World::TileManager
     {
         checkFreeElementsAndReorganise();
 
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos), ElementType::road);
         if (source == nullptr)
         {
             return nullptr;
@@ -375,11 +531,12 @@ namespace OpenLoco::World::TileManager
     // 0x00461578
     TileElement* insertElementAfterNoReorg(TileElement* after, ElementType type, const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads)
     {
-        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos));
+        auto [source, dest] = insertElementPrepareDest(toTileSpace(pos), type);
         if (source == nullptr)
         {
             return nullptr;
         }
+        markTileChanged(pos);
 
         bool lastFound = false;
         // Copy all of the elements that are underneath the new tile (or till end)
@@ -532,19 +689,19 @@ namespace OpenLoco::World::TileManager
             return height;
         }
 
-        auto tile = TileManager::get(pos);
-        // Get the surface element for the tile
-        auto surfaceEl = tile.surface();
-
-        if (surfaceEl == nullptr)
+        // Read the surface from the heightmap rather than searching the tile for it
+        const auto index = getHeightmapIndex(toTileSpace(pos));
+        const auto baseZ = _heightmap.baseZ[index];
+        if (baseZ == Heightmap::kNoSurface)
         {
             return height;
         }
 
-        height.waterHeight = surfaceEl->waterHeight();
-        height.landHeight = surfaceEl->baseHeight();
+        height.waterHeight = _heightmap.water[index] * kMicroZStep;
+        height.landHeight = baseZ * kSmallZStep;
 
-        const auto slope = surfaceEl->slopeCorners();
+        const uint8_t slope = _heightmap.slope[index] & 0x0F;
+        const bool isSlopeDoubleHeight = _heightmap.slope[index] & SurfaceSlope::doubleHeight;
 
         // Sub-tile coords
         const auto xl = pos.x & 0x1f;
@@ -581,7 +738,7 @@ namespace OpenLoco::World::TileManager
             case SurfaceSlope::CornerDown::east:
             case SurfaceSlope::CornerDown::south:
             case SurfaceSlope::CornerDown::west:
-                height.landHeight += getOneCornerDownLandHeight(xl, yl, slope, surfaceEl->isSlopeDoubleHeight());
+                height.landHeight += getOneCornerDownLandHeight(xl, yl, slope, isSlopeDoubleHeight);
                 break;
 
             case SurfaceSlope::Valley::northsouth:
@@ -645,6 +802,7 @@ namespace OpenLoco::World::TileManager
     static void clearTilePointers()
     {
         std::fill(_tiles.begin(), _tiles.end(), const_cast<TileElement*>(kInvalidTile));
+        _tileElementTypes.fill(0);
     }
 
     // 0x00461348
@@ -660,10 +818,19 @@ namespace OpenLoco::World::TileManager
                 set(TilePos2(x, y), el);
 
                 // Skip remaining elements on this tile
+                uint16_t elementTypes = 0;
+                const SurfaceElement* surface = nullptr;
                 do
                 {
+                    elementTypes |= getElementTypeBit(el->type());
+                    if (surface == nullptr)
+                    {
+                        surface = el->as<SurfaceElement>();
+                    }
                     el++;
                 } while (!(el - 1)->isLast());
+                _tileElementTypes[getTileIndex(TilePos2(x, y))] = elementTypes;
+                setHeightmap(TilePos2(x, y), surface);
             }
         }
 
@@ -680,7 +847,7 @@ namespace OpenLoco::World::TileManager
         {
             // Allocate a temporary buffer and tightly pack all the tile elements in the map
             std::vector<TileElement> tempBuffer;
-            tempBuffer.resize(kMaxElements);
+            tempBuffer.resize(_elementsCapacity);
 
             size_t numElements = 0;
             for (tile_coord_t y = 0; y < kMapRows; y++)
@@ -700,7 +867,7 @@ namespace OpenLoco::World::TileManager
             std::memcpy(_elements, tempBuffer.data(), numElements * sizeof(TileElement));
 
             // Zero all unused elements
-            auto remainingElements = kMaxElements - numElements;
+            auto remainingElements = _elementsCapacity - numElements;
             std::memset(_elements + numElements, 0, remainingElements * sizeof(TileElement));
 
             updateTilePointers();
@@ -714,20 +881,10 @@ namespace OpenLoco::World::TileManager
         Ui::setCursor(curCursor);
     }
 
-    // 0x004613F0
-    void defragmentTilePeriodic()
+    // Moves the next tile down into any free elements directly before it.
+    // Returns the number of elements that were moved.
+    static uint32_t defragmentNextTile()
     {
-        if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
-        {
-            return;
-        }
-        if (_disablePeriodicDefrag)
-        {
-            _disablePeriodicDefrag = false;
-            return;
-        }
-        _disablePeriodicDefrag = false;
-
         const uint32_t searchStart = _periodicDefragStartTile + 1;
         for (auto i = 0U; i < kNumTiles; ++i)
         {
@@ -748,9 +905,10 @@ namespace OpenLoco::World::TileManager
         emptyTile++;
         if (emptyTile == firstTile)
         {
-            return;
+            return 0;
         }
 
+        uint32_t numMoved = 0;
         _tiles[_periodicDefragStartTile] = emptyTile;
         {
             auto* dest = emptyTile;
@@ -760,6 +918,7 @@ namespace OpenLoco::World::TileManager
                 *dest = *source;
                 source->setBaseZ(0xFFU);
                 source++;
+                numMoved++;
             } while (!dest++->isLast());
         }
 
@@ -771,6 +930,39 @@ namespace OpenLoco::World::TileManager
             newEnd--;
         }
         _elementsEnd = newEnd + 1;
+
+        return numMoved;
+    }
+
+    // 0x004613F0
+    void defragmentTilePeriodic()
+    {
+        if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
+        {
+            return;
+        }
+        if (_disablePeriodicDefrag)
+        {
+            _disablePeriodicDefrag = false;
+            return;
+        }
+        _disablePeriodicDefrag = false;
+
+        if (numFreeElements() >= kDefragLowFreeElements)
+        {
+            defragmentNextTile();
+            return;
+        }
+
+        // Running low on free elements, compact more tiles per tick so that a burst of construction
+        // does not run out and force a full reorganise. The budget is counted in elements rather
+        // than time so that every client ends up with the same element layout.
+        uint32_t budget = kDefragElementBudget;
+        for (auto i = 0U; i < kDefragMaxTilesPerTick && budget > 0; ++i)
+        {
+            // Visiting a tile costs one even if nothing could be moved
+            budget -= std::min(budget, defragmentNextTile() + 1);
+        }
     }
 
     // 0x00461393
@@ -783,7 +975,7 @@ namespace OpenLoco::World::TileManager
         // First try a basic defrag multiple times
         for (auto i = 0U; i < 1000; ++i)
         {
-            defragmentTilePeriodic();
+            defragmentNextTile();
         }
         if (numFreeElements() > kMaxElementsOnOneTile)
         {
@@ -795,6 +987,11 @@ namespace OpenLoco::World::TileManager
         {
             return true;
         }
+        // Finally make the store larger
+        if (growElements(_elementsCapacity + 1))
+        {
+            return true;
+        }
         GameCommands::setErrorText(StringIds::landscape_data_area_full);
         return false;
     }
@@ -857,6 +1054,38 @@ namespace OpenLoco::World::TileManager
         Ui::ViewportManager::invalidate(pos, 0, 1120, ZoomLevel::eighth);
     }
 
+    static ChangedTiles _changedTiles;
+    static uint32_t _tileChangeCount = 0;
+
+    void markTileChanged(const World::Pos2& pos)
+    {
+        const auto tilePos = toTileSpace(pos);
+        if (!validCoords(tilePos))
+        {
+            return;
+        }
+        _changedTiles.columns.set(tilePos.x);
+        _changedTiles.rows.set(tilePos.y);
+        _tileChangeCount++;
+    }
+
+    void markAllTilesChanged()
+    {
+        _changedTiles.columns.set();
+        _changedTiles.rows.set();
+        _tileChangeCount++;
+    }
+
+    uint32_t getTileChangeCount()
+    {
+        return _tileChangeCount;
+    }
+
+    ChangedTiles takeChangedTiles()
+    {
+        return std::exchange(_changedTiles, ChangedTiles{});
+    }
+
     // 0x0046A747
     void resetSurfaceClearance()
     {
@@ -965,6 +1194,12 @@ namespace OpenLoco::World::TileManager
         uint16_t surroundingTrees = 0;
         for (const auto& tilePos : getClampedRange(initialTilePos, initialTilePos + TilePos2{ 10, 10 }))
         {
+            if (!hasElementType(tilePos, ElementType::tree))
+            {
+                continue;
+            }
+
+            bool hasTree = false;
             auto tile = get(tilePos);
             for (auto& element : tile)
             {
@@ -976,6 +1211,7 @@ namespace OpenLoco::World::TileManager
                     continue;
                 }
 
+                hasTree = true;
                 if (tree->isGhost())
                 {
                     continue;
@@ -983,6 +1219,12 @@ namespace OpenLoco::World::TileManager
 
                 surroundingTrees++;
             }
+
+            if (!hasTree)
+            {
+                // All trees have since been removed from this tile
+                _tileElementTypes[getTileIndex(tilePos)] &= ~getElementTypeBit(ElementType::tree);
+            }
         }
 
         return surroundingTrees;
@@ -1004,9 +1246,8 @@ namespace OpenLoco::World::TileManager
                 continue;
             }
 
-            auto tile = get(tilePos);
-            auto* surface = tile.surface();
-            if (surface != nullptr && surface->water() > 0)
+            // The heightmap mirrors the surface water, so the tile's elements need not be walked
+            if (_heightmap.water[getHeightmapIndex(tilePos)] > 0)
             {
                 nearbyWaterTiles++;
             }
@@ -1061,14 +1302,34 @@ namespace OpenLoco::World::TileManager
         }
 
         GameCommands::setUpdatingCompanyId(CompanyId::neutral);
+
+        // Buildings only read the ratings of the stations they deliver to, which deliveries leave
+        // alone, so the passengers and mail are added to each station once the pass is done.
+        StationManager::beginCargoDeliveryBatch();
         auto pos = getGameState().tileUpdateStartLocation;
         for (; pos.y < World::kMapHeight; pos.y += 16 * World::kTileSize)
         {
             for (; pos.x < World::kMapWidth; pos.x += 16 * World::kTileSize)
             {
-                auto tile = TileManager::get(pos);
+                const auto tilePos = World::toTileSpace(pos);
+                const auto index = getTileIndex(tilePos);
+                auto tile = TileManager::get(tilePos);
+                if ((_tileElementTypes[index] & kUpdatableElementTypes) == 0)
+                {
+                    // Nothing but the surface on this tile does anything when updated
+                    auto* surface = tile.surface();
+                    if (surface != nullptr && !surface->isGhost())
+                    {
+                        updateSurface(*surface, pos);
+                    }
+                    continue;
+                }
+
+                uint16_t elementTypes = 0;
+                bool scannedAll = true;
                 for (auto& el : tile)
                 {
+                    elementTypes |= getElementTypeBit(el.type());
                     if (el.isGhost())
                     {
                         continue;
@@ -1077,13 +1338,21 @@ namespace OpenLoco::World::TileManager
                     // If update removed/added tiles we must stop loop as pointer is invalid
                     if (!update(el, pos))
                     {
+                        scannedAll = false;
                         break;
                     }
                 }
+
+                // Drop any types that have been removed since the tile was last scanned
+                if (scannedAll)
+                {
+                    _tileElementTypes[index] = elementTypes;
+                }
             }
             pos.x -= World::kMapWidth;
         }
         pos.y -= World::kMapHeight;
+        StationManager::applyCargoDeliveryBatch();
 
         const auto tilePos = World::toTileSpace(pos);
         const uint8_t shift = (tilePos.y << 4) + tilePos.x + 9;
@@ -1164,6 +1433,7 @@ namespace OpenLoco::World::TileManager
                             removedPopulation = 0;
                         }
                         auto ratingReduction = buildingObj->demolishRatingReduction;
+                        TownManager::removeBuildingFromIndex(pos, elBuilding.baseZ());
                         auto* town = TownManager::updateTownInfo(pos, removedPopulation, buildingCapacity, ratingReduction, -1);
                         if (town != nullptr)
                         {
@@ -1342,7 +1612,7 @@ namespace OpenLoco::World::TileManager
     }
 
     // 0x00468651
-    uint32_t adjustSurfaceHeight(World::Pos2 pos, SmallZ targetBaseZ, uint8_t slopeFlags, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    static uint32_t adjustSurfaceHeightWithoutInvalidate(World::Pos2 pos, SmallZ targetBaseZ, uint8_t slopeFlags, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
     {
         if (!validCoords(pos))
         {
@@ -1499,9 +1769,7 @@ namespace OpenLoco::World::TileManager
             surface->setGrowthStage(0);
         }
 
-        surface->setBaseZ(targetBaseZ);
-        surface->setClearZ(targetBaseZ);
-        surface->setSlope(slopeFlags);
+        setSurfaceHeight(toTileSpace(pos), *surface, targetBaseZ, targetBaseZ, slopeFlags);
 
         landObj = ObjectManager::get<LandObject>(surface->terrain());
         if (landObj->hasFlags(LandObjectFlags::hasReplacementLandHeader) && !SceneManager::isEditorMode())
@@ -1511,15 +1779,68 @@ namespace OpenLoco::World::TileManager
 
         if (surface->water() * kMicroToSmallZStep <= targetBaseZ)
         {
-            surface->setWater(0);
+            setSurfaceWater(toTileSpace(pos), *surface, 0);
         }
 
-        mapInvalidateTileFull(pos);
         return totalCost;
     }
 
+    uint32_t adjustSurfaceHeight(World::Pos2 pos, SmallZ targetBaseZ, uint8_t slopeFlags, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    {
+        const auto cost = adjustSurfaceHeightWithoutInvalidate(pos, targetBaseZ, slopeFlags, removedBuildings, flags);
+        if (cost != GameCommands::FAILURE && (flags & GameCommands::Flags::apply))
+        {
+            mapInvalidateTileFull(pos);
+        }
+        return cost;
+    }
+
+    // Runs the adjustment for each tile and sums up the costs, the tiles that were changed are invalidated
+    // together at the end. Stops at the first tile that fails, like the single tile adjustments do.
+    template<typename T, typename Func>
+    static uint32_t adjustTiles(std::span<const T> adjustments, uint8_t flags, Func&& adjustTile)
+    {
+        currency32_t totalCost = 0;
+        auto result = totalCost;
+        std::optional<std::pair<TilePos2, TilePos2>> changedRange;
+        for (const auto& adjustment : adjustments)
+        {
+            const auto cost = adjustTile(adjustment);
+            if (cost == GameCommands::FAILURE)
+            {
+                result = GameCommands::FAILURE;
+                break;
+            }
+            totalCost += cost;
+            result = totalCost;
+
+            if (flags & GameCommands::Flags::apply)
+            {
+                if (!changedRange)
+                {
+                    changedRange = std::make_pair(adjustment.pos, adjustment.pos);
+                }
+                changedRange->first = TilePos2(std::min(changedRange->first.x, adjustment.pos.x), std::min(changedRange->first.y, adjustment.pos.y));
+                changedRange->second = TilePos2(std::max(changedRange->second.x, adjustment.pos.x), std::max(changedRange->second.y, adjustment.pos.y));
+            }
+        }
+
+        if (changedRange)
+        {
+            Ui::ViewportManager::invalidate(toWorldSpace(changedRange->first), toWorldSpace(changedRange->second), 0, 1120, ZoomLevel::eighth);
+        }
+        return result;
+    }
+
+    uint32_t adjustSurfaceHeights(std::span<const SurfaceHeightAdjustment> adjustments, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    {
+        return adjustTiles(adjustments, flags, [&removedBuildings, flags](const SurfaceHeightAdjustment& adjustment) {
+            return adjustSurfaceHeightWithoutInvalidate(toWorldSpace(adjustment.pos), adjustment.targetBaseZ, adjustment.slopeFlags, removedBuildings, flags);
+        });
+    }
+
     // 0x004C4C28
-    uint32_t adjustWaterHeight(World::Pos2 pos, SmallZ targetHeight, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    static uint32_t adjustWaterHeightWithoutInvalidate(World::Pos2 pos, SmallZ targetHeight, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
     {
         GameCommands::setExpenditureType(ExpenditureType::Construction);
         GameCommands::setPosition(World::Pos3(pos.x + World::kTileSize / 2, pos.y + World::kTileSize / 2, targetHeight * kMicroToSmallZStep));
@@ -1588,18 +1909,33 @@ namespace OpenLoco::World::TileManager
         {
             if (targetHeight <= surface->baseZ())
             {
-                surface->setWater(0);
+                setSurfaceWater(toTileSpace(pos), *surface, 0);
             }
             else
             {
-                surface->setWater(targetHeight / kMicroToSmallZStep);
+                setSurfaceWater(toTileSpace(pos), *surface, targetHeight / kMicroToSmallZStep);
             }
             surface->setType6Flag(false);
             surface->setVariation(0);
+        }
+        return totalCost;
+    }
 
+    uint32_t adjustWaterHeight(World::Pos2 pos, SmallZ targetHeight, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    {
+        const auto cost = adjustWaterHeightWithoutInvalidate(pos, targetHeight, removedBuildings, flags);
+        if (cost != GameCommands::FAILURE && (flags & GameCommands::Flags::apply))
+        {
             mapInvalidateTileFull(pos);
         }
-        return totalCost;
+        return cost;
+    }
+
+    uint32_t adjustWaterHeights(std::span<const WaterHeightAdjustment> adjustments, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags)
+    {
+        return adjustTiles(adjustments, flags, [&removedBuildings, flags](const WaterHeightAdjustment& adjustment) {
+            return adjustWaterHeightWithoutInvalidate(toWorldSpace(adjustment.pos), adjustment.targetHeight, removedBuildings, flags);
+        });
     }
 
     // 0x0047AB9B
@@ -1608,6 +1944,11 @@ namespace OpenLoco::World::TileManager
         const auto isObjectNotTram = getGameState().roadObjectIdIsNotTram;
         for (const auto& tilePos : getWorldRange())
         {
+            // Most of the map has no roads at all
+            if (!hasElementType(tilePos, ElementType::road))
+            {
+                continue;
+            }
             auto tile = get(tilePos);
             for (auto& el : tile)
             {
@@ -3,6 +3,7 @@
 #include "Tile.h"
 #include "TileClearance.h"
 #include <OpenLoco/Core/EnumFlags.hpp>
+#include <bitset>
 #include <cstdint>
 #include <set>
 #include <span>
@@ -19,7 +20,10 @@ namespace OpenLoco::World
 
 namespace OpenLoco::World::TileManager
 {
+    // Capacity of the original fixed element store, the store grows beyond this when it fills up
+    // but saves with more elements than this can not be loaded by Locomotion.
     constexpr size_t kMaxElements = 3 * kMapColumns * kMapRows;
+    constexpr size_t kMaxElementsCapacity = 8 * kMaxElements;
     constexpr size_t kMaxElementsOnOneTile = 1024; // If you exceed this then the game may buffer overflow in certain situations
     constexpr size_t kMaxUsableElements = kMaxElements - kMaxElementsOnOneTile;
     const TileElement* const kInvalidTile = reinterpret_cast<const TileElement*>(static_cast<intptr_t>(-1));
@@ -41,11 +45,18 @@ namespace OpenLoco::World::TileManager
     std::span<TileElement> getElements();
     TileElement* getElementsEnd();
     uint32_t numFreeElements();
+    // Elements up to the end of the store, including removed ones that are yet to be defragmented.
+    uint32_t numUsedElements();
+    // Current size of the element store, it grows past kMaxElements as needed.
+    uint32_t getElementsCapacity();
     TileElement** getElementIndex();
     Tile get(TilePos2 pos);
     Tile get(Pos2 pos);
     Tile get(coord_t x, coord_t y);
-    void setElements(std::span<TileElement> elements);
+    // May return true for a type that has since been removed, but a false result guarantees
+    // there is no element of the type on the tile.
+    bool hasElementType(const TilePos2& pos, ElementType type);
+    void setElements(std::span<const TileElement> elements);
     void removeElement(TileElement& element);
     // This is used with wasRemoveOnLastElement to indicate that pointer passed to removeElement is now bad
     void setRemoveElementPointerChecker(TileElement& element);
@@ -74,6 +85,10 @@ namespace OpenLoco::World::TileManager
     World::RoadElement* insertElementRoad(const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads);
 
     TileHeight getHeight(const Pos2& pos);
+    // The height, slope and water level of a surface are mirrored by the heightmap that getHeight
+    // reads, so they are only changed through these.
+    void setSurfaceHeight(const TilePos2& pos, SurfaceElement& surface, SmallZ baseZ, SmallZ clearZ, uint8_t slope);
+    void setSurfaceWater(const TilePos2& pos, SurfaceElement& surface, MicroZ level);
     SmallZ getSurfaceCornerHeight(const SurfaceElement& surface);
     SmallZ getSurfaceCornerDownHeight(const SurfaceElement& surface, const uint8_t cornerMask);
     void updateTilePointers();
@@ -86,6 +101,19 @@ namespace OpenLoco::World::TileManager
     bool checkFreeElementsAndReorganise();
     CompanyId getTileOwner(const World::TileElement& el);
     void mapInvalidateTileFull(World::Pos2 pos);
+
+    // Columns and rows of tiles whose contents changed since they were last taken, so that
+    // observers such as the map window only have to refresh what is stale.
+    struct ChangedTiles
+    {
+        std::bitset<kMapColumns> columns;
+        std::bitset<kMapRows> rows;
+    };
+    void markTileChanged(const World::Pos2& pos);
+    void markAllTilesChanged();
+    ChangedTiles takeChangedTiles();
+    // Increases with every change marked, for caching results that depend on the map.
+    uint32_t getTileChangeCount();
     void resetSurfaceClearance();
     int16_t mountainHeight(const World::Pos2& loc);
     uint16_t countSurroundingWaterTiles(const Pos2& pos);
@@ -106,4 +134,22 @@ namespace OpenLoco::World::TileManager
     void setTerrainStyleAsClearedAtHeight(const Pos3& pos);
     uint32_t adjustSurfaceHeight(World::Pos2 pos, SmallZ targetBaseZ, uint8_t slopeFlags, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags);
     uint32_t adjustWaterHeight(World::Pos2 pos, SmallZ targetHeight, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags);
+
+    struct SurfaceHeightAdjustment
+    {
+        World::TilePos2 pos;
+        SmallZ targetBaseZ;
+        uint8_t slopeFlags;
+    };
+
+    struct WaterHeightAdjustment
+    {
+        World::TilePos2 pos;
+        SmallZ targetHeight;
+    };
+
+    // Adjusts a whole area in one go, the changed tiles are redrawn with a single invalidation.
+    // Returns the total cost or FAILURE at the first tile that fails.
+    uint32_t adjustSurfaceHeights(std::span<const SurfaceHeightAdjustment> adjustments, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags);
+    uint32_t adjustWaterHeights(std::span<const WaterHeightAdjustment> adjustments, World::TileClearance::RemovedBuildings& removedBuildings, uint8_t flags);
 }
@@ -20,206 +20,206 @@ namespace OpenLoco::World::TrackData
         };
     }
 
-    const std::array<PreviewTrack, 1> trackPiece0 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece0 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 4> trackPiece1 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece1 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x07) },
         PreviewTrack{ 1, 0, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x08) },
         PreviewTrack{ 3, -32, 32, 0, 0, QuarterTile{ 0b0110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x70) },
     };
-    const std::array<PreviewTrack, 1> trackPiece2 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece2 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 1> trackPiece3 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece3 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 4> trackPiece4 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece4 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, 0, 0, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> trackPiece5 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece5 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 5> trackPiece6 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece6 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
         PreviewTrack{ 2, -32, -32, 0, 0, QuarterTile{ 0b1101, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x8F) },
         PreviewTrack{ 3, -64, -32, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
         PreviewTrack{ 4, -64, -64, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 5> trackPiece7 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece7 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 2, -32, 32, 0, 0, QuarterTile{ 0b1110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xE3) },
         PreviewTrack{ 3, -64, 32, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 4, -64, 64, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 5> trackPiece8 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece8 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
         PreviewTrack{ 2, -32, -32, 0, 0, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x02) },
         PreviewTrack{ 3, -64, 0, 0, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x20) },
         PreviewTrack{ 4, -64, -32, 0, 0, QuarterTile{ 0b0011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x1C) },
     };
-    const std::array<PreviewTrack, 5> trackPiece9 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece9 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 2, -32, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x80) },
         PreviewTrack{ 3, -64, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x08) },
         PreviewTrack{ 4, -64, 32, 0, 0, QuarterTile{ 0b0110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x70) },
     };
-    const std::array<PreviewTrack, 5> trackPiece10 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece10 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x07) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x08) },
         PreviewTrack{ 2, 0, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x80) },
         PreviewTrack{ 3, -32, 32, 0, 0, QuarterTile{ 0b1110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xE3) },
         PreviewTrack{ 4, -64, 32, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 5> trackPiece11 = {
+    constexpr std::array<PreviewTrack, 5> trackPiece11 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x07) },
         PreviewTrack{ 1, 0, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x08) },
         PreviewTrack{ 3, -32, 32, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 4, -32, 64, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 4> trackPiece12 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece12 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF9) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b0110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x60) },
         PreviewTrack{ 2, -32, -32, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x06) },
         PreviewTrack{ 3, -64, -32, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x9F) },
     };
-    const std::array<PreviewTrack, 4> trackPiece13 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece13 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3F) },
         PreviewTrack{ 1, -32, 0, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x0C) },
         PreviewTrack{ 2, -32, 32, 0, 0, QuarterTile{ 0b0110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xC0) },
         PreviewTrack{ 3, -64, 32, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF3) },
     };
-    const std::array<PreviewTrack, 2> trackPiece14 = {
+    constexpr std::array<PreviewTrack, 2> trackPiece14 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 16, QuarterTile{ 0b1111, 0b1100 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 2> trackPiece15 = {
+    constexpr std::array<PreviewTrack, 2> trackPiece15 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1111, 0b0011 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, -16, 16, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> trackPiece16 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece16 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1111, 0b1100 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> trackPiece17 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece17 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1111, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 4> trackPiece18 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece18 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, 0, 16, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, 0, 16, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, 0, 16, QuarterTile{ 0b0111, 0b0110 }, PreviewTrackFlags::unk4, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> trackPiece19 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece19 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, 0, 16, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 0, 16, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, 0, 16, QuarterTile{ 0b1011, 0b1001 }, PreviewTrackFlags::unk4, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 4> trackPiece20 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece20 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b0111, 0b0011 }, PreviewTrackFlags::unk4, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, -16, 16, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, -16, 16, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, -16, 16, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> trackPiece21 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece21 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1011, 0b0011 }, PreviewTrackFlags::unk4, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, -16, 16, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, -16, 16, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, -16, 16, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 4> trackPiece22 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece22 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b0111, 0b0100 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, 16, 0, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, 16, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, 16, 16, QuarterTile{ 0b0111, 0b0110 }, PreviewTrackFlags::unk2 | PreviewTrackFlags::unk1, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> trackPiece23 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece23 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1011, 0b1000 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, 16, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 16, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, 16, 16, QuarterTile{ 0b1011, 0b1001 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk0, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 4> trackPiece24 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece24 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b0111, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, -16, 0, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, -16, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, -32, 16, QuarterTile{ 0b0111, 0b0001 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk0, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> trackPiece25 = {
+    constexpr std::array<PreviewTrack, 4> trackPiece25 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1011, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, -16, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal | PreviewTrackFlags::unk4, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, -16, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, -32, 16, QuarterTile{ 0b1011, 0b0010 }, PreviewTrackFlags::unk2 | PreviewTrackFlags::unk1, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 1> trackPiece26 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece26 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0110, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xE0) },
     };
-    const std::array<PreviewTrack, 1> trackPiece27 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece27 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x0E) },
     };
-    const std::array<PreviewTrack, 1> trackPiece28 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece28 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x20) },
     };
-    const std::array<PreviewTrack, 1> trackPiece29 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece29 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x8D) },
     };
-    const std::array<PreviewTrack, 1> trackPiece30 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece30 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x63) },
     };
-    const std::array<PreviewTrack, 1> trackPiece31 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece31 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x08) },
     };
-    const std::array<PreviewTrack, 1> trackPiece32 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece32 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x77) },
     };
-    const std::array<PreviewTrack, 1> trackPiece33 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece33 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xDD) },
     };
-    const std::array<PreviewTrack, 1> trackPiece34 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece34 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b0110, 0b1100 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0xE0) },
     };
-    const std::array<PreviewTrack, 1> trackPiece35 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece35 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1001, 0b1100 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0x0E) },
     };
-    const std::array<PreviewTrack, 1> trackPiece36 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece36 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b0110, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0xE0) },
     };
-    const std::array<PreviewTrack, 1> trackPiece37 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece37 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1001, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0x0E) },
     };
-    const std::array<PreviewTrack, 1> trackPiece38 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece38 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFD) },
     };
-    const std::array<PreviewTrack, 1> trackPiece39 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece39 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x7F) },
     };
-    const std::array<PreviewTrack, 1> trackPiece40 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece40 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF7) },
     };
-    const std::array<PreviewTrack, 1> trackPiece41 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece41 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xDF) },
     };
-    const std::array<PreviewTrack, 1> trackPiece42 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece42 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x38) },
     };
-    const std::array<PreviewTrack, 1> trackPiece43 = {
+    constexpr std::array<PreviewTrack, 1> trackPiece43 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x38) },
     };
 
     // 0x004F73D8, 0x004F78F8
-    const std::array<std::span<const PreviewTrack>, 44> trackPieces = { {
+    constexpr std::array<std::span<const PreviewTrack>, 44> trackPieces = { {
         trackPiece0,
         trackPiece1,
         trackPiece2,
@@ -266,47 +266,47 @@ namespace OpenLoco::World::TrackData
         trackPiece43,
     } };
 
-    const std::array<PreviewTrack, 1> roadPiece0 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece0 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> roadPiece1 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece1 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 1> roadPiece2 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece2 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 4> roadPiece3 = {
+    constexpr std::array<PreviewTrack, 4> roadPiece3 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
         PreviewTrack{ 1, 0, -32, 0, 0, QuarterTile{ 0b1000, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x02) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0010, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x70) },
         PreviewTrack{ 3, -32, -32, 0, 0, QuarterTile{ 0b0111, 0b0000 }, PreviewTrackFlags::none, generateConnections(0xF8) },
     };
-    const std::array<PreviewTrack, 4> roadPiece4 = {
+    constexpr std::array<PreviewTrack, 4> roadPiece4 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
         PreviewTrack{ 1, 0, 32, 0, 0, QuarterTile{ 0b0100, 0b0000 }, PreviewTrackFlags::diagonal, generateConnections(0x80) },
         PreviewTrack{ 2, -32, 0, 0, 0, QuarterTile{ 0b0001, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x1C) },
         PreviewTrack{ 3, -32, 32, 0, 0, QuarterTile{ 0b1011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x3E) },
     };
-    const std::array<PreviewTrack, 2> roadPiece5 = {
+    constexpr std::array<PreviewTrack, 2> roadPiece5 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, 0, 16, QuarterTile{ 0b1111, 0b1100 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 2> roadPiece6 = {
+    constexpr std::array<PreviewTrack, 2> roadPiece6 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1111, 0b0011 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
         PreviewTrack{ 1, -32, 0, -16, 16, QuarterTile{ 0b1111, 0b0000 }, PreviewTrackFlags::unk4, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> roadPiece7 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece7 = {
         PreviewTrack{ 0, 0, 0, 0, 16, QuarterTile{ 0b1111, 0b1100 }, PreviewTrackFlags::unk3 | PreviewTrackFlags::unk2, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> roadPiece8 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece8 = {
         PreviewTrack{ 0, 0, 0, -16, 16, QuarterTile{ 0b1111, 0b0011 }, PreviewTrackFlags::unk1 | PreviewTrackFlags::unk0, generateConnections(0xFF) },
     };
-    const std::array<PreviewTrack, 1> roadPiece9 = {
+    constexpr std::array<PreviewTrack, 1> roadPiece9 = {
         PreviewTrack{ 0, 0, 0, 0, 0, QuarterTile{ 0b0011, 0b0000 }, PreviewTrackFlags::none, generateConnections(0x38) },
     };
 
     // 0x004F6D1C, 0x004F6F1C
-    const std::array<std::span<const PreviewTrack>, 10> roadPieces = { {
+    constexpr std::array<std::span<const PreviewTrack>, 10> roadPieces = { {
         roadPiece0,
         roadPiece1,
         roadPiece2,
@@ -319,6 +319,63 @@ namespace OpenLoco::World::TrackData
         roadPiece9,
     } };
 
+    // All tiles of every piece for each of the four rotations, flattened so that the
+    // rotated offsets of a piece are read rather than recomputed in the routing loops.
+    template<size_t TNumPieces, size_t TNumTiles>
+    struct RotatedPieceOffsets
+    {
+        // Index of the first tile of each piece, the last entry is the total
+        std::array<uint16_t, TNumPieces + 1> begin{};
+        // [begin * 4 + rotation * numTiles + index] for each piece
+        std::array<World::Pos3, TNumTiles * 4> offsets{};
+
+        constexpr std::span<const World::Pos3> get(size_t pieceId, uint8_t rotation) const
+        {
+            const auto numTiles = static_cast<size_t>(begin[pieceId + 1] - begin[pieceId]);
+            return std::span<const World::Pos3>(offsets).subspan(begin[pieceId] * 4 + (rotation & 3) * numTiles, numTiles);
+        }
+    };
+
+    template<size_t TNumPieces>
+    static constexpr size_t countTiles(const std::array<std::span<const PreviewTrack>, TNumPieces>& pieces)
+    {
+        size_t numTiles = 0;
+        for (const auto& piece : pieces)
+        {
+            numTiles += piece.size();
+        }
+        return numTiles;
+    }
+
+    template<size_t TNumTiles, size_t TNumPieces>
+    static constexpr auto generateRotatedOffsets(const std::array<std::span<const PreviewTrack>, TNumPieces>& pieces)
+    {
+        RotatedPieceOffsets<TNumPieces, TNumTiles> res{};
+        size_t tileIndex = 0;
+        for (size_t pieceId = 0; pieceId < TNumPieces; ++pieceId)
+        {
+            const auto& piece = pieces[pieceId];
+            res.begin[pieceId] = static_cast<uint16_t>(tileIndex);
+            for (uint8_t rotation = 0; rotation < 4; ++rotation)
+            {
+                for (size_t i = 0; i < piece.size(); ++i)
+                {
+                    const auto rotated = Math::Vector::rotate(World::Pos2{ piece[i].x, piece[i].y }, rotation);
+                    res.offsets[tileIndex * 4 + rotation * piece.size() + i] = World::Pos3{ rotated, piece[i].z };
+                }
+            }
+            tileIndex += piece.size();
+        }
+        res.begin[TNumPieces] = static_cast<uint16_t>(tileIndex);
+        return res;
+    }
+
+    static constexpr auto kTrackPieceOffsets = generateRotatedOffsets<countTiles(trackPieces)>(trackPieces);
+    static constexpr auto kRoadPieceOffsets = generateRotatedOffsets<countTiles(roadPieces)>(roadPieces);
+
+    static_assert(kTrackPieceOffsets.get(1, 1)[3] == World::Pos3{ 32, 32, 0 });
+    static_assert(kRoadPieceOffsets.get(5, 2)[1] == World::Pos3{ 32, 0, 0 });
+
     const std::span<const PreviewTrack> getTrackPiece(size_t trackId)
     {
         assert(trackId < trackPieces.size());
@@ -331,6 +388,18 @@ namespace OpenLoco::World::TrackData
         return roadPieces[trackId];
     }
 
+    std::span<const World::Pos3> getTrackPieceOffsets(size_t trackId, uint8_t rotation)
+    {
+        assert(trackId < trackPieces.size());
+        return kTrackPieceOffsets.get(trackId, rotation);
+    }
+
+    std::span<const World::Pos3> getRoadPieceOffsets(size_t roadId, uint8_t rotation)
+    {
+        assert(roadId < roadPieces.size());
+        return kRoadPieceOffsets.get(roadId, rotation);
+    }
+
     static std::array<TrackCoordinates, 80> _4F6F8C = {}; // Was loco_global at 0x004F6F8C
     static std::array<TrackCoordinates, 352> _4F7B5C = {}; // Was loco_global at 0x004F7B5C
 
@@ -61,8 +61,15 @@ namespace OpenLoco::World::TrackData
     // static_assert(sizeof(TrackCoordinates) == 0x8); // COMMENTED FOR 64-BIT DEBUG
 #pragma pack(pop)
 
+    // Upper bound on the number of tiles a single track or road piece covers, the largest covers 5.
+    constexpr size_t kMaxPreviewTrackTiles = 8;
+
     const std::span<const PreviewTrack> getTrackPiece(size_t trackId);
     const std::span<const PreviewTrack> getRoadPiece(size_t trackId);
+    // Offsets of each tile of the piece from its first tile after rotation, z included.
+    // Indexed the same as the span returned by getTrackPiece / getRoadPiece.
+    std::span<const World::Pos3> getTrackPieceOffsets(size_t trackId, uint8_t rotation);
+    std::span<const World::Pos3> getRoadPieceOffsets(size_t roadId, uint8_t rotation);
     const TrackCoordinates& getUnkTrack(uint16_t trackAndDirection);
     const TrackCoordinates& getUnkRoad(uint16_t trackAndDirection);
 
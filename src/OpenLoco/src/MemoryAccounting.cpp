@@ -0,0 +1,109 @@
+#include "MemoryAccounting.h"
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::MemoryAccounting
+{
+    static constexpr std::array<std::string_view, kCategoryCount> kCategoryNames = {
+        "TileElements",
+        "Entities",
+        "G1Data",
+        "ObjectData",
+        "ObjectImages",
+        "PaintArenas",
+        "AudioSamples",
+        "Caches",
+        "Network",
+    };
+
+    // Providers may be registered from worker threads, e.g. by paint sessions
+    static std::mutex _mutex;
+    static std::array<std::vector<Provider>, kCategoryCount> _providers;
+    static std::array<Usage, kCategoryCount> _usage{};
+    static size_t _peakTotal = 0;
+
+    void registerProvider(Category category, Provider provider)
+    {
+        std::lock_guard lock(_mutex);
+        auto& providers = _providers[static_cast<size_t>(category)];
+        if (std::find(providers.begin(), providers.end(), provider) == providers.end())
+        {
+            providers.push_back(provider);
+        }
+    }
+
+    static size_t sample(Category category)
+    {
+        size_t current = 0;
+        for (const auto provider : _providers[static_cast<size_t>(category)])
+        {
+            current += provider();
+        }
+
+        auto& usage = _usage[static_cast<size_t>(category)];
+        usage.current = current;
+        usage.peak = std::max(usage.peak, current);
+        return current;
+    }
+
+    static void updateAll()
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < kCategoryCount; i++)
+        {
+            total += sample(static_cast<Category>(i));
+        }
+        _peakTotal = std::max(_peakTotal, total);
+    }
+
+    void update()
+    {
+        std::lock_guard lock(_mutex);
+        updateAll();
+    }
+
+    std::string_view getName(Category category)
+    {
+        return kCategoryNames[static_cast<size_t>(category)];
+    }
+
+    Usage getUsage(Category category)
+    {
+        std::lock_guard lock(_mutex);
+        sample(category);
+        return _usage[static_cast<size_t>(category)];
+    }
+
+    Usage getTotalUsage()
+    {
+        std::lock_guard lock(_mutex);
+        updateAll();
+
+        Usage total{};
+        for (const auto& usage : _usage)
+        {
+            total.current += usage.current;
+        }
+        total.peak = _peakTotal;
+        return total;
+    }
+
+    void logReport()
+    {
+        const auto total = getTotalUsage();
+
+        std::lock_guard lock(_mutex);
+        Logging::info("Memory usage by subsystem:");
+        for (size_t i = 0; i < kCategoryCount; i++)
+        {
+            const auto& usage = _usage[i];
+            Logging::info("  {:<14} {:>10} KiB, peak {:>10} KiB", kCategoryNames[i], usage.current / 1024, usage.peak / 1024);
+        }
+        Logging::info("  {:<14} {:>10} KiB, peak {:>10} KiB", "Total", total.current / 1024, total.peak / 1024);
+    }
+}
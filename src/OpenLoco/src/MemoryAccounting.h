@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace OpenLoco::MemoryAccounting
+{
+    // Areas the memory use is reported for, each subsystem registers providers for its own.
+    enum class Category : uint8_t
+    {
+        tileElements,
+        entities,
+        g1Data,
+        objectData,
+        objectImages,
+        paintArenas,
+        audioSamples,
+        caches,
+        network,
+        count,
+    };
+
+    static constexpr auto kCategoryCount = static_cast<size_t>(Category::count);
+
+    struct Usage
+    {
+        size_t current{};
+        size_t peak{};
+    };
+
+    // Returns the bytes currently used, called on the main thread so it has to be cheap.
+    using Provider = size_t (*)();
+
+    // Registering the same provider again has no effect, so it can be done when a subsystem is initialised.
+    void registerProvider(Category category, Provider provider);
+
+    // Samples the providers and updates the peaks, called once per tick.
+    void update();
+
+    std::string_view getName(Category category);
+    Usage getUsage(Category category);
+    Usage getTotalUsage();
+
+    // Logs the usage of each category.
+    void logReport();
+}
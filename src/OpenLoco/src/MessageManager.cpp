@@ -16,6 +16,7 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <unordered_map>
 
 using namespace OpenLoco::Interop;
 
@@ -26,6 +27,60 @@ namespace OpenLoco::MessageManager
     static auto& rawMessages() { return getGameState().messages; }
     uint16_t getNumMessages() { return getGameState().numMessages; }
 
+    // Number of references from the current messages to each (argument type, subject) pair so that
+    // deleting an entity nothing refers to does not have to scan the messages.
+    static std::unordered_map<uint32_t, uint16_t> _subjectRefCounts;
+    static bool _subjectIndexValid = false;
+
+    static constexpr uint32_t getSubjectKey(const uint16_t subject, const MessageItemArgumentType type)
+    {
+        return (static_cast<uint32_t>(type) << 16) | subject;
+    }
+
+    template<typename TFunc>
+    static void forEachSubjectKey(const Message& message, TFunc&& func)
+    {
+        const auto& descriptor = getMessageTypeDescriptor(message.type);
+        for (auto j = 0; j < Message::kNumSubjects; ++j)
+        {
+            if (descriptor.argumentTypes[j] != MessageItemArgumentType::null && message.itemSubjects[j] != 0xFFFF)
+            {
+                func(getSubjectKey(message.itemSubjects[j], descriptor.argumentTypes[j]));
+            }
+        }
+    }
+
+    static void addSubjectRefs(const Message& message)
+    {
+        forEachSubjectKey(message, [](const uint32_t key) { _subjectRefCounts[key]++; });
+    }
+
+    static void removeSubjectRefs(const Message& message)
+    {
+        forEachSubjectKey(message, [](const uint32_t key) {
+            auto it = _subjectRefCounts.find(key);
+            if (it != _subjectRefCounts.end() && --it->second == 0)
+            {
+                _subjectRefCounts.erase(it);
+            }
+        });
+    }
+
+    static void rebuildSubjectIndex()
+    {
+        _subjectRefCounts.clear();
+        for (auto i = 0; i < getNumMessages(); ++i)
+        {
+            addSubjectRefs(rawMessages()[i]);
+        }
+        _subjectIndexValid = true;
+    }
+
+    void invalidateSubjectIndex()
+    {
+        _subjectIndexValid = false;
+    }
+
     static void setNumMessages(const uint16_t numMessages)
     {
         getGameState().numMessages = numMessages;
@@ -111,6 +166,10 @@ namespace OpenLoco::MessageManager
         rawMessages()[getNumMessages()] = newMessage;
         auto& message = rawMessages()[getNumMessages()];
         setNumMessages(getNumMessages() + 1);
+        if (_subjectIndexValid)
+        {
+            addSubjectRefs(message);
+        }
         // A buffer that is larger than message.messageString
         char tempBuffer[512]{};
         switch (message.type)
@@ -460,6 +519,10 @@ namespace OpenLoco::MessageManager
                 getGameState().activeMessageIndex = static_cast<MessageId>(enumValue(getGameState().activeMessageIndex) - 1);
             }
         }
+        if (_subjectIndexValid)
+        {
+            removeSubjectRefs(*get(id));
+        }
         setNumMessages(getNumMessages() - 1);
         // Move element to end of array (this seems excessive you could just move to end of numMessages)
         if (enumValue(id) < Limits::kMaxMessages - 1)
@@ -472,6 +535,16 @@ namespace OpenLoco::MessageManager
     // 0x0042851C
     void removeAllSubjectRefs(const uint16_t subject, MessageItemArgumentType type)
     {
+        if (!_subjectIndexValid)
+        {
+            rebuildSubjectIndex();
+        }
+        const auto key = getSubjectKey(subject, type);
+        if (!_subjectRefCounts.contains(key))
+        {
+            return;
+        }
+
         for (auto i = getNumMessages(); i > 0; --i)
         {
             auto& message = rawMessages()[i];
@@ -491,6 +564,18 @@ namespace OpenLoco::MessageManager
                 Ui::WindowManager::invalidate(Ui::WindowType::news);
             }
         }
+
+        // The first message is not visited above (matches vanilla) so it may still hold a reference
+        _subjectRefCounts.erase(key);
+        if (getNumMessages() != 0)
+        {
+            forEachSubjectKey(rawMessages()[0], [key](const uint32_t messageKey) {
+                if (messageKey == key)
+                {
+                    _subjectRefCounts[key]++;
+                }
+            });
+        }
     }
 
     // 0x004284DB
@@ -624,5 +709,6 @@ namespace OpenLoco::MessageManager
         auto& gameState = getGameState();
         gameState.numMessages = 0;
         gameState.activeMessageIndex = MessageId::null;
+        invalidateSubjectIndex();
     }
 }
@@ -25,6 +25,8 @@ namespace OpenLoco::MessageManager
 
     void updateDaily();
     void removeAllSubjectRefs(const uint16_t subject, MessageItemArgumentType type);
+    // Must be called whenever the messages are replaced outside of the manager, i.e. on load
+    void invalidateSubjectIndex();
     void sub_428E47();
     void clearActiveMessage();
     void reset();
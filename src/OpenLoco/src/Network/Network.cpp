@@ -4,11 +4,16 @@
 #include "GameState.h"
 #include "Graphics/Gfx.h"
 #include "Logging.h"
+#include "MemoryAccounting.h"
 #include "NetworkClient.h"
 #include "NetworkServer.h"
+#include "NetworkStats.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "StateHash.h"
 #include "Socket.h"
+#include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
@@ -20,12 +25,44 @@ namespace OpenLoco::Network
     {
         none,
         server,
-        client
+        client,
+        // A spectating client whose game stream is passed on by a server
+        relay,
     };
 
     static NetworkMode _mode;
     static std::unique_ptr<NetworkServer> _server;
     static std::unique_ptr<NetworkClient> _client;
+    // Milliseconds between logging the network stats, 0 if they are not logged
+    static uint32_t _statsLogInterval;
+    static uint32_t _lastStatsLog;
+
+    static size_t getMemoryUsage()
+    {
+        size_t usage = 0;
+        for (const NetworkBase* serverOrClient : { static_cast<NetworkBase*>(_server.get()), static_cast<NetworkBase*>(_client.get()) })
+        {
+            if (serverOrClient != nullptr)
+            {
+                NetworkStats stats;
+                serverOrClient->getStats(stats);
+                for (const auto& peer : stats.peers)
+                {
+                    usage += peer.connection.memoryUsage;
+                }
+            }
+        }
+        return usage;
+    }
+
+    static void initialiseStats()
+    {
+        const auto& cmdlineOptions = getCommandLineOptions();
+        _statsLogInterval = std::max(cmdlineOptions.networkStatsInterval.value_or(0), 0) * 1000;
+        _lastStatsLog = Platform::getTime();
+        Stats::reset();
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::network, getMemoryUsage);
+    }
 
     static NetworkBase* getServerOrClient()
     {
@@ -34,12 +71,52 @@ namespace OpenLoco::Network
             case NetworkMode::server:
                 return _server.get();
             case NetworkMode::client:
+            case NetworkMode::relay:
                 return _client.get();
             default:
                 return nullptr;
         }
     }
 
+    // The relay is only opened once the game has been received from upstream, so it can be passed on
+    static void updateRelay()
+    {
+        _client->update();
+        if (_client->isClosed())
+        {
+            close();
+            return;
+        }
+
+        if (_server == nullptr && _client->getStatus() == NetworkClientStatus::connected)
+        {
+            const auto& cmdlineOptions = getCommandLineOptions();
+            auto server = std::make_unique<NetworkServer>();
+            server->setUpstream(_client.get());
+            try
+            {
+                server->listen(cmdlineOptions.bind, cmdlineOptions.port.value_or(kDefaultPort));
+            }
+            catch (const std::exception& e)
+            {
+                Logging::error("Unable to open relay: {}", e.what());
+                close();
+                return;
+            }
+            _client->setRelay(server.get());
+            _server = std::move(server);
+        }
+
+        if (_server != nullptr)
+        {
+            _server->update();
+            if (_server->isClosed())
+            {
+                close();
+            }
+        }
+    }
+
     void openServer()
     {
         assert(_mode == NetworkMode::none);
@@ -50,9 +127,12 @@ namespace OpenLoco::Network
             auto& bind = cmdlineOptions.bind;
             auto port = cmdlineOptions.port.value_or(kDefaultPort);
 
+            initialiseStats();
             _server = std::make_unique<NetworkServer>();
             _server->listen(bind, port);
 
+            StateHash::setInterval(cmdlineOptions.stateHashInterval.value_or(0));
+
             _mode = NetworkMode::server;
             SceneManager::addSceneFlags(SceneManager::Flags::networked);
             SceneManager::addSceneFlags(SceneManager::Flags::networkHost);
@@ -71,13 +151,19 @@ namespace OpenLoco::Network
     }
 
     void joinServer(std::string_view host, port_t port)
+    {
+        joinServer(host, port, false);
+    }
+
+    void joinServer(std::string_view host, port_t port, bool spectator)
     {
         assert(_mode == NetworkMode::none);
 
         try
         {
+            initialiseStats();
             _client = std::make_unique<NetworkClient>();
-            _client->connect(host, port);
+            _client->connect(host, port, spectator);
             _mode = NetworkMode::client;
         }
         catch (...)
@@ -87,17 +173,39 @@ namespace OpenLoco::Network
         }
     }
 
+    void openRelay(std::string_view host, port_t port)
+    {
+        assert(_mode == NetworkMode::none);
+
+        try
+        {
+            initialiseStats();
+            _client = std::make_unique<NetworkClient>();
+            _client->connect(host, port, true);
+            _mode = NetworkMode::relay;
+        }
+        catch (...)
+        {
+            _client = nullptr;
+            throw;
+        }
+    }
+
     void close()
     {
         _server = nullptr;
         _client = nullptr;
         _mode = NetworkMode::none;
+        StateHash::setInterval(0);
     }
 
     void update()
     {
-        auto serverOrClient = getServerOrClient();
-        if (serverOrClient != nullptr)
+        if (_mode == NetworkMode::relay)
+        {
+            updateRelay();
+        }
+        else if (auto serverOrClient = getServerOrClient())
         {
             serverOrClient->update();
             if (serverOrClient->isClosed())
@@ -105,6 +213,16 @@ namespace OpenLoco::Network
                 close();
             }
         }
+
+        if (_mode != NetworkMode::none)
+        {
+            const auto now = Platform::getTime();
+            if (_statsLogInterval != 0 && now - _lastStatsLog >= _statsLogInterval)
+            {
+                _lastStatsLog = now;
+                Stats::log(getStats());
+            }
+        }
     }
 
     void sendChatMessage(std::string_view message)
@@ -141,7 +259,7 @@ namespace OpenLoco::Network
 
     bool shouldProcessTick(uint32_t tick)
     {
-        if (_mode == NetworkMode::client)
+        if (_mode == NetworkMode::client || _mode == NetworkMode::relay)
         {
             return _client->shouldProcessTick(tick);
         }
@@ -161,6 +279,7 @@ namespace OpenLoco::Network
                 _server->runGameCommands();
                 break;
             case NetworkMode::client:
+            case NetworkMode::relay:
                 _client->runGameCommandsForTick(tick);
                 break;
         }
@@ -176,16 +295,37 @@ namespace OpenLoco::Network
             case NetworkMode::server:
                 return true;
             case NetworkMode::client:
+            case NetworkMode::relay:
                 return _client->getStatus() == NetworkClientStatus::connected;
         }
     }
 
+    bool isOpen()
+    {
+        return _mode != NetworkMode::none;
+    }
+
     uint32_t getServerTick()
     {
-        if (_mode == NetworkMode::client)
+        if (_mode == NetworkMode::client || _mode == NetworkMode::relay)
         {
             return _client->getLocalTick();
         }
         return ScenarioManager::getScenarioTicks();
     }
+
+    NetworkStats getStats()
+    {
+        NetworkStats stats;
+        Stats::getPacketCounters(stats);
+        if (_mode == NetworkMode::relay && _server != nullptr)
+        {
+            _server->getStats(stats);
+        }
+        if (auto serverOrClient = getServerOrClient())
+        {
+            serverOrClient->getStats(stats);
+        }
+        return stats;
+    }
 }
@@ -11,16 +11,20 @@ namespace OpenLoco::Interop
 
 namespace OpenLoco::Network
 {
+    struct NetworkStats;
+
     using client_id_t = uint32_t;
     using port_t = uint16_t;
 
     constexpr port_t kDefaultPort = 11754;
     constexpr uint16_t kMaxPacketSize = 4096;
-    constexpr uint16_t kNetworkVersion = 1;
+    constexpr uint16_t kNetworkVersion = 5;
 
     void openServer();
     void joinServer(std::string_view host);
     void joinServer(std::string_view host, port_t port);
+    void joinServer(std::string_view host, port_t port, bool spectator);
+    void openRelay(std::string_view host, port_t port);
     void close();
     void update();
 
@@ -37,8 +41,18 @@ namespace OpenLoco::Network
      */
     bool isConnected();
 
+    /**
+     * Whether there is a server, client or relay, connected or not.
+     */
+    bool isOpen();
+
     /**
      * Gets the current tick the server is on.
      */
     uint32_t getServerTick();
+
+    /**
+     * Gets the packet counters, the state of each connection and of the game command queue.
+     */
+    NetworkStats getStats();
 }
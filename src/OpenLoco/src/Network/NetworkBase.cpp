@@ -1,6 +1,7 @@
 #include "NetworkBase.h"
 #include "Logging.h"
 #include "Packet.h"
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Platform/Platform.h>
 
 using namespace OpenLoco;
@@ -22,6 +23,8 @@ bool NetworkBase::isClosed() const
 
 void NetworkBase::receivePacketLoop()
 {
+    Diagnostics::Tracing::setThreadName("Network receive");
+
     while (!_endReceivePacketLoop)
     {
         bool receivedPacket{};
@@ -44,13 +47,18 @@ void NetworkBase::receivePacketLoop()
         }
         if (!receivedPacket)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Sleeps until a socket has data or endReceivePacketLoop wakes us
+            _poller->wait(_sockets);
         }
     }
 }
 
 void NetworkBase::beginReceivePacketLoop()
 {
+    if (_poller == nullptr)
+    {
+        _poller = Socket::createPoller();
+    }
     _endReceivePacketLoop = false;
     _receivePacketThread = std::thread([this] { receivePacketLoop(); });
 }
@@ -60,6 +68,7 @@ void NetworkBase::endReceivePacketLoop()
     _endReceivePacketLoop = true;
     if (_receivePacketThread.joinable())
     {
+        _poller->wake();
         _receivePacketThread.join();
     }
     _receivePacketThread = {};
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Network.h"
+#include "NetworkStats.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <thread>
@@ -13,7 +15,8 @@ namespace OpenLoco::Network
     {
     private:
         std::thread _receivePacketThread;
-        bool _endReceivePacketLoop{};
+        std::unique_ptr<ISocketPoller> _poller;
+        std::atomic<bool> _endReceivePacketLoop{};
         bool _isClosed{};
 
         void receivePacketLoop();
@@ -37,5 +40,7 @@ namespace OpenLoco::Network
         void update();
 
         virtual void sendChatMessage(std::string_view message) = 0;
+        // Fills in the stats of the connections and game commands, the packet counters are global
+        virtual void getStats(NetworkStats& stats) const = 0;
     };
 }
@@ -3,11 +3,15 @@
 #include "GameCommands/GameCommands.h"
 #include "Logging.h"
 #include "NetworkConnection.h"
+#include "NetworkServer.h"
 #include "S5/S5.h"
+#include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "StateHash.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/BinaryStream.h>
 #include <OpenLoco/Platform/Platform.h>
+#include <zlib.h>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
@@ -28,8 +32,25 @@ uint32_t NetworkClient::getLocalTick() const
     return _localTick;
 }
 
-void NetworkClient::connect(std::string_view host, port_t port)
+uint32_t NetworkClient::getLocalGameCommandIndex() const
 {
+    return _localGameCommandIndex;
+}
+
+const std::list<GameCommand>& NetworkClient::getReceivedGameCommands() const
+{
+    return _receivedGameCommands;
+}
+
+void NetworkClient::setRelay(NetworkServer* relay)
+{
+    _relay = relay;
+}
+
+void NetworkClient::connect(std::string_view host, port_t port, bool spectator)
+{
+    _isSpectator = spectator;
+
     auto szHost = std::string(host);
     _serverEndpoint = Socket::resolve(Protocol::any, szHost, port);
 
@@ -40,13 +61,14 @@ void NetworkClient::connect(std::string_view host, port_t port)
     auto szHostIpAddress = _serverEndpoint->getIpAddress();
     Logging::info("Resolved endpoint for {}:{}", szHostIpAddress, port);
 
+    // The socket is only created by the first send, it has to exist before the receive loop polls it
+    sendConnectPacket();
+
     beginReceivePacketLoop();
 
     _status = NetworkClientStatus::connecting;
     _timeout = Platform::getTime() + 5000;
 
-    sendConnectPacket();
-
     initStatus("Connecting to " + szHost + "...");
 }
 
@@ -95,6 +117,10 @@ void NetworkClient::onUpdate()
                     break;
                 case NetworkClientStatus::waitingForState:
                     break;
+                case NetworkClientStatus::connected:
+                    sendPendingGameCommands();
+                    checkStateHashes();
+                    break;
                 default:
                     break;
             }
@@ -152,8 +178,28 @@ void NetworkClient::onCancel()
     }
 }
 
+// The parts of the game stream that are the same for every client
+static bool isRelayedPacketKind(PacketKind kind)
+{
+    switch (kind)
+    {
+        case PacketKind::ping:
+        case PacketKind::gameCommandBatch:
+        case PacketKind::stateHash:
+        case PacketKind::receiveChatMessage:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void NetworkClient::onReceivePacketFromServer(const Packet& packet)
 {
+    if (_relay != nullptr && isRelayedPacketKind(packet.header.kind))
+    {
+        _relay->relayPacket(packet);
+    }
+
     switch (packet.header.kind)
     {
         case PacketKind::connectResponse:
@@ -171,8 +217,11 @@ void NetworkClient::onReceivePacketFromServer(const Packet& packet)
         case PacketKind::ping:
             receivePingPacket(*reinterpret_cast<const PingPacket*>(packet.data));
             break;
-        case PacketKind::gameCommand:
-            receiveGameCommandPacket(*reinterpret_cast<const GameCommandPacket*>(packet.data));
+        case PacketKind::gameCommandBatch:
+            receiveGameCommandBatchPacket(*reinterpret_cast<const GameCommandBatchPacket*>(packet.data));
+            break;
+        case PacketKind::stateHash:
+            receiveStateHashPacket(*reinterpret_cast<const StateHashPacket*>(packet.data));
             break;
         default:
             break;
@@ -185,6 +234,7 @@ void NetworkClient::sendConnectPacket()
     ConnectPacket packet;
     std::strncpy(packet.name, config.preferredOwnerName.c_str(), sizeof(packet.name));
     packet.version = kNetworkVersion;
+    packet.spectator = _isSpectator;
     _serverConnection->sendPacket(packet);
 }
 
@@ -192,6 +242,11 @@ void NetworkClient::sendRequestStatePacket()
 {
     _requestStateCookie = (std::rand() << 16) | std::rand();
     _requestStateChunksReceived.clear();
+    _requestStateNumChunks = 0;
+    _requestStateTotalSize = 0;
+    _requestStateCompressedSize = 0;
+    _requestStateReceivedBytes = 0;
+    _requestStateReceivedChunks = 0;
 
     RequestStatePacket packet;
     packet.cookie = _requestStateCookie;
@@ -216,9 +271,11 @@ void NetworkClient::receiveRequestStateResponsePacket(const RequestStateResponse
 {
     if (response.cookie == _requestStateCookie)
     {
+        // Chunks may have overtaken the response
         _requestStateNumChunks = response.numChunks;
         _requestStateTotalSize = response.totalSize;
-        _requestStateReceivedChunks = 0;
+        _requestStateCompressedSize = response.compressedSize;
+        completeStateTransfer();
     }
 }
 
@@ -237,26 +294,50 @@ void NetworkClient::receiveRequestStateResponseChunkPacket(const RequestStateRes
             rchunk.offset = responseChunk.offset;
             rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
             _requestStateReceivedChunks++;
-
             _requestStateReceivedBytes += responseChunk.dataSize;
-            setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
-        }
 
-        if (_requestStateReceivedChunks >= _requestStateNumChunks)
-        {
-            // Construct full data
-            std::vector<uint8_t> fullData;
-            for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
+            if (_requestStateCompressedSize != 0)
             {
-                fullData.insert(fullData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
+                const auto percent = static_cast<uint64_t>(_requestStateReceivedBytes) * 100 / _requestStateCompressedSize;
+                setStatus("Receiving state: " + std::to_string(percent) + "% (" + std::to_string(_requestStateReceivedBytes / 1024) + " / " + std::to_string(_requestStateCompressedSize / 1024) + " KiB)");
             }
+        }
 
-            clearStatus();
-            _status = NetworkClientStatus::connected;
+        completeStateTransfer();
+    }
+}
 
-            processFullState(fullData);
-        }
+void NetworkClient::completeStateTransfer()
+{
+    if (_requestStateNumChunks == 0 || _requestStateReceivedChunks < _requestStateNumChunks)
+    {
+        return;
     }
+
+    // Construct full data
+    std::vector<uint8_t> compressedData;
+    compressedData.reserve(_requestStateCompressedSize);
+    for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
+    {
+        compressedData.insert(compressedData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
+    }
+    _requestStateChunksReceived.clear();
+
+    std::vector<uint8_t> fullData(_requestStateTotalSize);
+    auto length = static_cast<uLongf>(fullData.size());
+    if (uncompress(fullData.data(), &length, compressedData.data(), static_cast<uLong>(compressedData.size())) != Z_OK
+        || length != fullData.size() || length < sizeof(ExtraState))
+    {
+        Logging::error("Received invalid state from server");
+        endStatus("Received invalid state from server");
+        close();
+        return;
+    }
+
+    clearStatus();
+    _status = NetworkClientStatus::connected;
+
+    processFullState(fullData);
 }
 
 void NetworkClient::processFullState(std::span<uint8_t const> fullData)
@@ -264,10 +345,17 @@ void NetworkClient::processFullState(std::span<uint8_t const> fullData)
     auto* extra = reinterpret_cast<const ExtraState*>(fullData.data() + fullData.size() - sizeof(ExtraState));
     _localGameCommandIndex = extra->gameCommandIndex;
     _localTick = extra->tick;
+
+    // Commands that arrived during the transfer may already be part of the state
+    _receivedGameCommands.remove_if([this](const GameCommand& command) { return command.index <= _localGameCommandIndex; });
     updateLocalTick();
 
     BinaryStream bs(fullData.data(), fullData.size() - sizeof(ExtraState));
     S5::importSaveToGameState(bs, S5::LoadFlags::none);
+
+    // Snapshots taken before the state was received say nothing about the server
+    StateHash::reset();
+    _receivedStateHashes.clear();
 }
 
 void NetworkClient::receiveChatMessagePacket(const ReceiveChatMessage& packet)
@@ -293,24 +381,43 @@ void NetworkClient::receivePingPacket(const PingPacket& packet)
     }
 }
 
-void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
+void NetworkClient::receiveGameCommandBatchPacket(const GameCommandBatchPacket& packet)
+{
+    auto commands = packet.read();
+    if (!commands)
+    {
+        Logging::error("Received invalid game commands from server");
+        return;
+    }
+
+    for (const auto& command : *commands)
+    {
+        receiveGameCommand(command);
+    }
+}
+
+void NetworkClient::receiveGameCommand(const GameCommand& packet)
 {
     // Update the latest knowledge of server state
     _serverTick = std::max(_serverTick, packet.tick);
     _serverGameCommandIndex = std::max(_serverGameCommandIndex, packet.index);
 
-    // Catch old or repeated game command index
-    assert(packet.index > _localGameCommandIndex);
+    // A relay can send a command both with the state and as it streams past, the old or repeated one is dropped
+    if (_status == NetworkClientStatus::connected && packet.index <= _localGameCommandIndex)
+    {
+        return;
+    }
 
     // Insert into ordered game command queue
     for (auto it = _receivedGameCommands.begin(); it != _receivedGameCommands.end(); it++)
     {
         auto& p = *it;
+        if (packet.index == p.index)
+        {
+            return;
+        }
 
-        // Catch duplicate game command index
-        assert(packet.index != p.index);
-
-        if (packet.index <= p.index)
+        if (packet.index < p.index)
         {
             _receivedGameCommands.insert(it, packet);
             return;
@@ -321,6 +428,62 @@ void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
     updateLocalTick();
 }
 
+void NetworkClient::receiveStateHashPacket(const StateHashPacket& packet)
+{
+    if (_status != NetworkClientStatus::connected)
+    {
+        return;
+    }
+
+    // The server decides whether, and how often, state is hashed
+    StateHash::setInterval(packet.interval);
+
+    _receivedStateHashes.push_back(packet);
+    if (_receivedStateHashes.size() > StateHash::kHistorySize)
+    {
+        _receivedStateHashes.pop_front();
+    }
+}
+
+void NetworkClient::checkStateHashes()
+{
+    const auto tick = ScenarioManager::getScenarioTicks();
+    while (!_receivedStateHashes.empty())
+    {
+        const auto& packet = _receivedStateHashes.front();
+        if (packet.tick > tick)
+        {
+            // We have not simulated this tick yet
+            break;
+        }
+
+        auto localSnapshot = StateHash::getSnapshot(packet.tick);
+        if (localSnapshot && !_desyncDetected)
+        {
+            StateHash::Snapshot serverSnapshot;
+            serverSnapshot.tick = packet.tick;
+            std::copy(std::begin(packet.hashes), std::end(packet.hashes), serverSnapshot.hashes.begin());
+
+            if (auto subsystem = StateHash::findDivergence(*localSnapshot, serverSnapshot))
+            {
+                _desyncDetected = true;
+                Logging::error("Desync detected at tick {}: {} differ from server", packet.tick, StateHash::getName(*subsystem));
+            }
+        }
+        _receivedStateHashes.pop_front();
+    }
+}
+
+void NetworkClient::getStats(NetworkStats& stats) const
+{
+    if (_serverConnection != nullptr)
+    {
+        stats.peers.push_back({ "Server", _serverConnection->getStats() });
+    }
+    stats.ticksBehindServer = static_cast<int64_t>(_localTick) - ScenarioManager::getScenarioTicks();
+    stats.commandQueueDepth = _receivedGameCommands.size() + _pendingGameCommands.size();
+}
+
 void NetworkClient::sendChatMessage(std::string_view message)
 {
     if (_serverConnection != nullptr)
@@ -334,13 +497,35 @@ void NetworkClient::sendChatMessage(std::string_view message)
 
 void NetworkClient::sendGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs)
 {
-    if (_serverConnection != nullptr && _status == NetworkClientStatus::connected)
+    if (_serverConnection != nullptr && _status == NetworkClientStatus::connected && !_isSpectator)
     {
-        GameCommandPacket packet;
-        packet.company = company;
-        packet.regs = regs;
-        _serverConnection->sendPacket(packet);
+        // Sent with the rest of the frame's commands on the next update
+        GameCommand command;
+        command.company = company;
+        command.regs = regs;
+        _pendingGameCommands.push_back(command);
+    }
+}
+
+void NetworkClient::sendPendingGameCommands()
+{
+    if (_pendingGameCommands.empty())
+    {
+        return;
+    }
+
+    GameCommandBatchPacket batch;
+    for (const auto& command : _pendingGameCommands)
+    {
+        if (!batch.tryAppend(command))
+        {
+            _serverConnection->sendPacket(batch);
+            batch = {};
+            batch.tryAppend(command);
+        }
     }
+    _serverConnection->sendPacket(batch);
+    _pendingGameCommands.clear();
 }
 
 void NetworkClient::updateLocalTick()
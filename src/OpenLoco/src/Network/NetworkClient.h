@@ -11,6 +11,7 @@
 namespace OpenLoco::Network
 {
     class NetworkConnection;
+    class NetworkServer;
 
     enum class NetworkClientStatus
     {
@@ -33,7 +34,13 @@ namespace OpenLoco::Network
         uint32_t _serverGameCommandIndex;
         uint32_t _localTick;
         uint32_t _serverTick;
-        std::list<GameCommandPacket> _receivedGameCommands;
+        std::list<GameCommand> _receivedGameCommands;
+        std::vector<GameCommand> _pendingGameCommands;
+        std::list<StateHashPacket> _receivedStateHashes;
+        bool _desyncDetected{};
+        bool _isSpectator{};
+        // Receives the game stream when this client feeds a relay
+        NetworkServer* _relay{};
 
         struct ReceivedChunk
         {
@@ -43,6 +50,7 @@ namespace OpenLoco::Network
 
         uint32_t _requestStateCookie{};
         uint32_t _requestStateTotalSize{};
+        uint32_t _requestStateCompressedSize{};
         uint16_t _requestStateNumChunks{};
         std::vector<ReceivedChunk> _requestStateChunksReceived;
         uint32_t _requestStateReceivedBytes{};
@@ -52,8 +60,10 @@ namespace OpenLoco::Network
         void processReceivedPackets();
         bool hasTimedOut() const;
         void onReceivePacketFromServer(const Packet& packet);
+        void completeStateTransfer();
         void processFullState(std::span<uint8_t const> data);
         void updateLocalTick();
+        void checkStateHashes();
 
         void initStatus(std::string_view text);
         void setStatus(std::string_view text);
@@ -62,13 +72,16 @@ namespace OpenLoco::Network
 
         void sendConnectPacket();
         void sendRequestStatePacket();
+        void sendPendingGameCommands();
 
         void receiveConnectionResponsePacket(const ConnectResponsePacket& response);
         void receiveRequestStateResponsePacket(const RequestStateResponse& response);
         void receiveRequestStateResponseChunkPacket(const RequestStateResponseChunk& responseChunk);
         void receiveChatMessagePacket(const ReceiveChatMessage& packet);
         void receivePingPacket(const PingPacket& packet);
-        void receiveGameCommandPacket(const GameCommandPacket& packet);
+        void receiveGameCommandBatchPacket(const GameCommandBatchPacket& packet);
+        void receiveGameCommand(const GameCommand& command);
+        void receiveStateHashPacket(const StateHashPacket& packet);
 
     protected:
         void onClose() override;
@@ -80,9 +93,13 @@ namespace OpenLoco::Network
 
         NetworkClientStatus getStatus() const;
         uint32_t getLocalTick() const;
+        uint32_t getLocalGameCommandIndex() const;
+        const std::list<GameCommand>& getReceivedGameCommands() const;
 
-        void connect(std::string_view host, port_t port);
+        void connect(std::string_view host, port_t port, bool spectator);
+        void setRelay(NetworkServer* relay);
         void sendChatMessage(std::string_view message) override;
+        void getStats(NetworkStats& stats) const override;
         void sendGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs);
 
         bool shouldProcessTick(uint32_t tick) const;
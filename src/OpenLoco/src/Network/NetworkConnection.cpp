@@ -1,16 +1,24 @@
 #include "NetworkConnection.h"
 #include "Logging.h"
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
 #include <cstring>
+#include <limits>
 
 using namespace OpenLoco::Network;
 
-constexpr uint32_t kRedeliverTimeout = 1000;
+// Retransmit timeouts follow RFC 6298, with a lower minimum as a game can't wait a second after a loss
+constexpr uint32_t kInitialRetransmitTimeout = 1000;
+constexpr uint32_t kMinRetransmitTimeout = 50;
+constexpr uint32_t kMaxRetransmitTimeout = 8000;
 constexpr uint32_t kConnectionTimeout = 15000;
 
 NetworkConnection::NetworkConnection(IUdpSocket* socket, std::unique_ptr<INetworkEndpoint> endpoint)
     : _socket(socket)
     , _endpoint(std::move(endpoint))
+    , _sentPackets(kInitialSendWindowSize)
+    , _retransmitTimeout(kInitialRetransmitTimeout)
 {
 }
 
@@ -34,51 +42,99 @@ bool NetworkConnection::hasTimedOut() const
     return false;
 }
 
+// Smoothed round trip time in milliseconds, 0 until the first packet has been acknowledged
+uint32_t NetworkConnection::getRoundTripTime() const
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    return _smoothedRoundTripTime;
+}
+
+ConnectionStats NetworkConnection::getStats() const
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    ConnectionStats stats;
+    stats.roundTripTime = _smoothedRoundTripTime;
+    stats.roundTripTimeVariance = _roundTripTimeVariance;
+    stats.retransmitTimeout = _retransmitTimeout;
+    stats.numResends = _numResends;
+    stats.numPacketsInFlight = _numPacketsInFlight;
+    stats.memoryUsage = sizeof(*this) + _sentPackets.capacity() * sizeof(SentPacket) + _resendQueue.size() * sizeof(PendingResend);
+    return stats;
+}
+
+size_t NetworkConnection::getNumPacketsInFlight()
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    return _numPacketsInFlight;
+}
+
 void NetworkConnection::update()
 {
     resendUndeliveredPackets();
 }
 
+bool NetworkConnection::hasReceivedSequence(sequence_t sequence) const
+{
+    // Everything before the next expected sequence has been received
+    if (static_cast<int16_t>(sequence - _nextExpectedSequence) < 0)
+    {
+        return true;
+    }
+    if (static_cast<int16_t>(sequence - _latestReceivedSequence) > 0)
+    {
+        return false;
+    }
+    return _receivedSequences.test(sequence % kReceiveWindowSize);
+}
+
 bool NetworkConnection::checkOrRecordReceivedSequence(sequence_t sequence)
 {
-    for (auto s : _receivedSequences)
+    if (hasReceivedSequence(sequence))
     {
-        if (s == sequence)
-        {
-            return true;
-        }
+        return true;
     }
 
-    while (_receivedSequences.size() >= 1024)
+    // Clear what the window moves over, the sequence can't be further ahead than the size of the window
+    while (static_cast<int16_t>(sequence - _latestReceivedSequence) > 0)
     {
-        _receivedSequences.pop_back();
+        _latestReceivedSequence++;
+        _receivedSequences.reset(_latestReceivedSequence % kReceiveWindowSize);
     }
+    _receivedSequences.set(sequence % kReceiveWindowSize);
 
-    _receivedSequences.push_back(sequence);
+    while (_nextExpectedSequence != static_cast<sequence_t>(_latestReceivedSequence + 1) && _receivedSequences.test(_nextExpectedSequence % kReceiveWindowSize))
+    {
+        _nextExpectedSequence++;
+    }
     return false;
 }
 
 void NetworkConnection::receivePacket(const Packet& packet)
 {
+    OpenLoco::Diagnostics::Tracing::ScopedEvent traceEvent("NetworkReceive", "network");
+
     _timeOfLastReceivedPacket = Platform::getTime();
 
     logPacket(packet, false, false);
     if (packet.header.kind == PacketKind::ack)
     {
-        receiveAcknowledgePacket(packet.header.sequence);
+        receiveAcknowledgePacket(packet);
+    }
+    else if (_receivedPackets.full())
+    {
+        // Leave the packet unacknowledged, it will be sent again once there is room for it
     }
     else
     {
-        // Send ACK back, even if we have already received this packet before
-        // the ACK we sent before, may not have been delivered successfully
-        sendAcknowledgePacket(packet.header.sequence);
-
         // Only store the packet, if this is the first time we received it
         if (!checkOrRecordReceivedSequence(packet.header.sequence))
         {
-            std::unique_lock<std::mutex> lk(_receivedPacketsSync);
-            _receivedPackets.push(packet);
+            _receivedPackets.tryPush(packet);
         }
+
+        // Send ACK back, even if we have already received this packet before
+        // the ACK we sent before, may not have been delivered successfully
+        sendAcknowledgePacket(packet.header.sequence);
     }
 }
 
@@ -95,13 +151,63 @@ void NetworkConnection::sendPacket(PacketKind kind, size_t dataSize, const void*
     sendPacket(packet);
 }
 
+// Sends the contents of a packet received on another connection under the next sequence of this one
+void NetworkConnection::relayPacket(const Packet& packet)
+{
+    sendPacket(packet.header.kind, packet.header.dataSize, packet.data);
+}
+
+NetworkConnection::SentPacket& NetworkConnection::getSentPacket(sequence_t sequence)
+{
+    return _sentPackets[sequence & (_sentPackets.size() - 1)];
+}
+
+void NetworkConnection::growSentPackets(size_t minSize)
+{
+    auto newSize = _sentPackets.size();
+    while (newSize < minSize)
+    {
+        newSize *= 2;
+    }
+
+    std::vector<SentPacket> sentPackets(newSize);
+    for (sequence_t sequence = _oldestSentSequence; sequence != _nextSentSequence; sequence++)
+    {
+        auto& sentPacket = getSentPacket(sequence);
+        if (sentPacket.inFlight)
+        {
+            sentPackets[sequence & (newSize - 1)] = std::move(sentPacket);
+        }
+    }
+    _sentPackets = std::move(sentPackets);
+}
+
 void NetworkConnection::sendPacket(const Packet& packet)
 {
+    OpenLoco::Diagnostics::Tracing::ScopedEvent traceEvent("NetworkSend", "network");
+
     if (packet.header.kind != PacketKind::ack)
     {
         std::unique_lock<std::mutex> lk(_sentPacketsSync);
+        const auto sequence = packet.header.sequence;
+        if (_numPacketsInFlight == 0)
+        {
+            _oldestSentSequence = sequence;
+        }
+
+        // Half the sequence range, beyond that old and new sequences can't be told apart
+        const auto span = static_cast<size_t>(static_cast<sequence_t>(sequence - _oldestSentSequence)) + 1;
+        assert(span <= 0x8000);
+        if (span > _sentPackets.size())
+        {
+            growSentPackets(span);
+        }
+
         auto timestamp = getTime();
-        _sentPackets.push_back({ timestamp, packet });
+        getSentPacket(sequence) = { timestamp, 0, true, packet };
+        _nextSentSequence = sequence + 1;
+        _numPacketsInFlight++;
+        _resendQueue.push({ timestamp + _retransmitTimeout, sequence, timestamp });
     }
 
     size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
@@ -109,25 +215,106 @@ void NetworkConnection::sendPacket(const Packet& packet)
     logPacket(packet, true, false);
 }
 
-void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+void NetworkConnection::updateRoundTripTime(uint32_t sample)
+{
+    if (_smoothedRoundTripTime == 0)
+    {
+        _smoothedRoundTripTime = sample;
+        _roundTripTimeVariance = sample / 2;
+    }
+    else
+    {
+        const auto delta = _smoothedRoundTripTime > sample ? _smoothedRoundTripTime - sample : sample - _smoothedRoundTripTime;
+        _roundTripTimeVariance = (_roundTripTimeVariance * 3 + delta) / 4;
+        _smoothedRoundTripTime = (_smoothedRoundTripTime * 7 + sample) / 8;
+    }
+    _retransmitTimeout = std::clamp(_smoothedRoundTripTime + std::max<uint32_t>(_roundTripTimeVariance * 4, 1), kMinRetransmitTimeout, kMaxRetransmitTimeout);
+}
+
+// Doubles with every resend of the packet
+uint32_t NetworkConnection::getRetransmitTimeout(const SentPacket& sentPacket) const
+{
+    const auto timeout = static_cast<uint64_t>(_retransmitTimeout) << std::min<uint8_t>(sentPacket.numResends, 8);
+    return static_cast<uint32_t>(std::min<uint64_t>(timeout, kMaxRetransmitTimeout));
+}
+
+void NetworkConnection::acknowledgeSentPacket(sequence_t sequence, bool sampleRoundTripTime)
+{
+    const auto offset = static_cast<sequence_t>(sequence - _oldestSentSequence);
+    if (_numPacketsInFlight == 0 || offset >= static_cast<sequence_t>(_nextSentSequence - _oldestSentSequence))
+    {
+        return;
+    }
+
+    auto& sentPacket = getSentPacket(sequence);
+    if (!sentPacket.inFlight)
+    {
+        return;
+    }
+
+    // A resent packet can't tell which of its sends was acknowledged
+    if (sampleRoundTripTime && sentPacket.numResends == 0)
+    {
+        updateRoundTripTime(std::max<uint32_t>(getTime() - sentPacket.timestamp, 1));
+    }
+    sentPacket.inFlight = false;
+    _numPacketsInFlight--;
+
+    while (_oldestSentSequence != _nextSentSequence && !getSentPacket(_oldestSentSequence).inFlight)
+    {
+        _oldestSentSequence++;
+    }
+}
+
+void NetworkConnection::receiveAcknowledgePacket(const Packet& packet)
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    acknowledgeSentPacket(packet.header.sequence, true);
+
+    auto ack = packet.as<PacketKind::ack, AckPacket>();
+    if (ack == nullptr)
+    {
+        return;
+    }
+
+    // Everything before the next expected sequence, ignored if it is ahead of what has been sent
+    if (static_cast<int16_t>(ack->nextExpectedSequence - _nextSentSequence) <= 0)
     {
-        if (_sentPackets[i].packet.header.sequence == sequence)
+        while (_numPacketsInFlight != 0 && static_cast<int16_t>(ack->nextExpectedSequence - _oldestSentSequence) > 0)
         {
-            _sentPackets.erase(_sentPackets.begin() + i);
-            break;
+            acknowledgeSentPacket(_oldestSentSequence, false);
+        }
+    }
+
+    // Packets received out of order, these acks may have been held back so they don't give a round trip time
+    acknowledgeSentPacket(ack->latestSequence, false);
+    for (uint32_t i = 0; i < 64 && _numPacketsInFlight != 0; i++)
+    {
+        if (ack->receivedMask & (1ULL << i))
+        {
+            acknowledgeSentPacket(static_cast<sequence_t>(ack->latestSequence - 1 - i), false);
         }
     }
 }
 
 void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
 {
+    AckPacket ack;
+    ack.nextExpectedSequence = _nextExpectedSequence;
+    ack.latestSequence = _latestReceivedSequence;
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        if (hasReceivedSequence(static_cast<sequence_t>(_latestReceivedSequence - 1 - i)))
+        {
+            ack.receivedMask |= 1ULL << i;
+        }
+    }
+
     Packet packet;
     packet.header.kind = PacketKind::ack;
     packet.header.sequence = sequence;
-    packet.header.dataSize = 0;
+    packet.header.dataSize = static_cast<uint16_t>(ack.size());
+    std::memcpy(packet.data, &ack, ack.size());
     sendPacket(packet);
 }
 
@@ -135,54 +322,41 @@ void NetworkConnection::resendUndeliveredPackets()
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
     auto now = getTime();
-    auto timestamp = now - kRedeliverTimeout;
 
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    while (!_resendQueue.empty() && _resendQueue.top().deadline <= now)
     {
-        auto& sentPacket = _sentPackets[i];
-        if (sentPacket.timestamp < timestamp)
+        const auto pending = _resendQueue.top();
+        _resendQueue.pop();
+
+        auto& sentPacket = getSentPacket(pending.sequence);
+        if (!sentPacket.inFlight || sentPacket.packet.header.sequence != pending.sequence || sentPacket.timestamp != pending.timestamp)
         {
-            size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
-            _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
-            logPacket(sentPacket.packet, true, true);
+            continue;
+        }
+
+        size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
+        _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
+        logPacket(sentPacket.packet, true, true);
 
-            sentPacket.timestamp = now;
+        sentPacket.timestamp = now;
+        if (sentPacket.numResends != std::numeric_limits<uint8_t>::max())
+        {
+            sentPacket.numResends++;
         }
+        _numResends++;
+        _resendQueue.push({ now + getRetransmitTimeout(sentPacket), pending.sequence, now });
     }
 }
 
 std::optional<Packet> NetworkConnection::takeNextPacket()
 {
-    std::unique_lock<std::mutex> lk(_receivedPacketsSync);
-    if (!_receivedPackets.empty())
-    {
-        auto packet = _receivedPackets.front();
-        _receivedPackets.pop();
-        return packet;
-    }
-    return std::nullopt;
+    return _receivedPackets.tryPop();
 }
 
-[[maybe_unused]] static const char* getPacketKindString(PacketKind kind)
+void NetworkConnection::logPacket(const Packet& packet, bool sent, bool resend)
 {
-    switch (kind)
-    {
-        case PacketKind::ack: return "ACK";
-        case PacketKind::ping: return "PING";
-        case PacketKind::connect: return "CONNECT";
-        case PacketKind::connectResponse: return "CONNECT RESPONSE";
-        case PacketKind::requestState: return "REQUEST STATE";
-        case PacketKind::requestStateResponse: return "REQUEST STATE RESPONSE";
-        case PacketKind::requestStateResponseChunk: return "REQUEST STATE RESPONSE CHUNK";
-        case PacketKind::sendChatMessage: return "SEND CHAT";
-        case PacketKind::receiveChatMessage: return "RECEIVE CHAT";
-        case PacketKind::gameCommand: return "GAME COMMAND";
-        default: return "UNKNOWN";
-    }
-}
+    Stats::recordPacket(packet.header.kind, sizeof(PacketHeader) + packet.header.dataSize, sent, resend);
 
-void NetworkConnection::logPacket([[maybe_unused]] const Packet& packet, [[maybe_unused]] bool sent, [[maybe_unused]] bool resend)
-{
 #if defined(DEBUG)
 #ifdef LOG_PACKETS
     auto szDirection = sent ? "SENT" : "RECV";
@@ -198,15 +372,15 @@ void NetworkConnection::logPacket([[maybe_unused]] const Packet& packet, [[maybe
     {
         Logging::info("[{}] #{:04} | RESEND", szDirection, seq);
     }
-    else if (packet.header.kind == PacketKind::gameCommand)
+    else if (packet.header.kind == PacketKind::gameCommandBatch)
     {
-        auto kind = getPacketKindString(packet.header.kind);
-        const auto& gc = packet.Cast<GameCommandPacket>();
-        Logging::info("[{}] #{:04} | {} (Index = {} Tick = {} Command = {})", szDirection, seq, kind, gc->index, gc->tick, gc->regs.esi);
+        auto kind = getPacketKindName(packet.header.kind);
+        const auto* batch = packet.cast<GameCommandBatchPacket>();
+        Logging::info("[{}] #{:04} | {} (Index = {} Tick = {} Commands = {} {} bytes)", szDirection, seq, kind, batch->firstIndex, batch->tick, batch->numCommands, bytes);
     }
     else
     {
-        auto kind = getPacketKindString(packet.header.kind);
+        auto kind = getPacketKindName(packet.header.kind);
         Logging::info("[{}] #{:04} | {} ({} bytes)", szDirection, seq, kind, bytes);
     }
 #endif
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "Network.h"
+#include "NetworkStats.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <OpenLoco/Core/SpscQueue.hpp>
+#include <bitset>
 #include <cassert>
 #include <cstdint>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -20,22 +22,62 @@ namespace OpenLoco::Network
         struct SentPacket
         {
             uint32_t timestamp;
+            uint8_t numResends{};
+            bool inFlight{};
             Packet packet;
         };
 
+        struct PendingResend
+        {
+            uint32_t deadline;
+            sequence_t sequence;
+            uint32_t timestamp;
+
+            bool operator>(const PendingResend& other) const
+            {
+                return deadline > other.deadline;
+            }
+        };
+
+        // Filled by the receive thread and drained by the game thread
+        static constexpr size_t kReceiveQueueSize = 512;
+        // Half the sequence range, the furthest a sequence can be ahead of the next expected one
+        static constexpr size_t kReceiveWindowSize = 0x8000;
+        static constexpr size_t kInitialSendWindowSize = 64;
+
         IUdpSocket* _socket;
         std::unique_ptr<INetworkEndpoint> _endpoint;
-        std::mutex _sentPacketsSync;
-        std::mutex _receivedPacketsSync;
+
+        // Unacknowledged packets, indexed by sequence modulo the size, which grows as needed
+        mutable std::mutex _sentPacketsSync;
         std::vector<SentPacket> _sentPackets;
-        std::queue<Packet> _receivedPackets;
-        std::deque<sequence_t> _receivedSequences;
+        sequence_t _oldestSentSequence{};
+        sequence_t _nextSentSequence{};
+        size_t _numPacketsInFlight{};
+        // Earliest deadline first, entries of acknowledged packets are skipped
+        std::priority_queue<PendingResend, std::vector<PendingResend>, std::greater<PendingResend>> _resendQueue;
+        uint32_t _smoothedRoundTripTime{};
+        uint32_t _roundTripTimeVariance{};
+        uint32_t _retransmitTimeout;
+        uint32_t _numResends{};
+
+        Core::SpscQueue<Packet, kReceiveQueueSize> _receivedPackets;
+        // Indexed by sequence modulo the size, only meaningful from _nextExpectedSequence to _latestReceivedSequence
+        std::bitset<kReceiveWindowSize> _receivedSequences;
+        sequence_t _latestReceivedSequence = static_cast<sequence_t>(-1);
+        sequence_t _nextExpectedSequence{};
         uint16_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
 
         static uint32_t getTime();
         bool checkOrRecordReceivedSequence(sequence_t sequence);
-        void receiveAcknowledgePacket(sequence_t sequence);
+        bool hasReceivedSequence(sequence_t sequence) const;
+        SentPacket& getSentPacket(sequence_t sequence);
+        void growSentPackets(size_t minSize);
+        void updateRoundTripTime(uint32_t sample);
+        uint32_t getRetransmitTimeout(const SentPacket& sentPacket) const;
+        void acknowledgeSentPacket(sequence_t sequence, bool sampleRoundTripTime);
+        void receiveAcknowledgePacket(const Packet& packet);
         void sendAcknowledgePacket(sequence_t sequence);
         void resendUndeliveredPackets();
         void sendPacket(PacketKind kind, size_t dataSize, const void* packetData);
@@ -46,9 +88,13 @@ namespace OpenLoco::Network
 
         const INetworkEndpoint& getEndpoint() const;
         bool hasTimedOut() const;
+        uint32_t getRoundTripTime() const;
+        ConnectionStats getStats() const;
+        size_t getNumPacketsInFlight();
         void update();
         void receivePacket(const Packet& packet);
         void sendPacket(const Packet& packet);
+        void relayPacket(const Packet& packet);
         std::optional<Packet> takeNextPacket();
 
         template<typename T>
@@ -2,21 +2,30 @@
 #include "GameCommands/GameCommands.h"
 #include "GameState.h"
 #include "Logging.h"
+#include "NetworkClient.h"
 #include "NetworkConnection.h"
 #include "S5/S5.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "StateHash.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/MemoryStream.h>
 #include <OpenLoco/Platform/Platform.h>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
 #include <span>
+#include <zlib.h>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
 using namespace OpenLoco::Diagnostics;
 
 constexpr uint32_t kPingInterval = 30;
+constexpr uint16_t kStateChunkSize = 4000;
+// The rate a state transfer aims for, the send window is sized to keep this going over the round trip time
+constexpr size_t kStateTransferRate = 4 * 1024 * 1024;
+constexpr size_t kMinStateTransferWindow = 8;
+constexpr size_t kMaxStateTransferWindow = 512;
 
 NetworkServer::~NetworkServer()
 {
@@ -54,10 +63,14 @@ void NetworkServer::listen(const std::string& bind, port_t port)
 
     beginReceivePacketLoop();
 
-    SceneManager::addSceneFlags(SceneManager::Flags::networked);
-    SceneManager::addSceneFlags(SceneManager::Flags::networkHost);
+    // A relay follows the game like any other client
+    if (_upstream == nullptr)
+    {
+        SceneManager::addSceneFlags(SceneManager::Flags::networked);
+        SceneManager::addSceneFlags(SceneManager::Flags::networkHost);
+    }
 
-    Logging::info("Server opened");
+    Logging::info("{} opened", _upstream == nullptr ? "Server" : "Relay");
     for (const auto& socket : _sockets)
     {
         auto ipAddress = socket->getIpAddress();
@@ -69,8 +82,18 @@ void NetworkServer::listen(const std::string& bind, port_t port)
     }
 }
 
+void NetworkServer::setUpstream(NetworkClient* upstream)
+{
+    _upstream = upstream;
+}
+
 void NetworkServer::onClose()
 {
+    if (_upstream != nullptr)
+    {
+        Logging::info("Relay closed");
+        return;
+    }
     SceneManager::removeSceneFlags(SceneManager::Flags::networked);
     SceneManager::removeSceneFlags(SceneManager::Flags::networkHost);
     Logging::info("Server closed");
@@ -94,6 +117,8 @@ void NetworkServer::createNewClient(std::unique_ptr<NetworkConnection> conn, con
     newClient->id = _nextClientId++;
     newClient->connection = std::move(conn);
     newClient->name = Utility::nullTerminatedView(packet.name);
+    // Everyone watching through a relay is a spectator
+    newClient->isSpectator = packet.spectator || _upstream != nullptr;
     _clients.push_back(std::move(newClient));
 
     auto& newClientPtr = *_clients.back();
@@ -102,7 +127,7 @@ void NetworkServer::createNewClient(std::unique_ptr<NetworkConnection> conn, con
     response.result = ConnectionResult::success;
     newClientPtr.connection->sendPacket(response);
 
-    Logging::info("Accepted new client: {}", newClientPtr.name);
+    Logging::info("Accepted new {}: {}", newClientPtr.isSpectator ? "spectator" : "client", newClientPtr.name);
 }
 
 void NetworkServer::onReceivePacket(IUdpSocket& socket, std::unique_ptr<INetworkEndpoint> endpoint, const Packet& packet)
@@ -136,8 +161,8 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
         case PacketKind::sendChatMessage:
             onReceiveSendChatMessagePacket(client, *packet.cast<SendChatMessage>());
             break;
-        case PacketKind::gameCommand:
-            onReceiveGameCommandPacket(client, *packet.cast<GameCommandPacket>());
+        case PacketKind::gameCommandBatch:
+            onReceiveGameCommandBatchPacket(client, *packet.cast<GameCommandBatchPacket>());
             break;
         default:
             break;
@@ -146,52 +171,155 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
 
 void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
 {
-    constexpr uint16_t kChunkSize = 4000;
-
     // Dump S5 data to stream
-    MemoryStream ms;
+    MemoryStream ms(_lastStateSize);
     S5::exportGameStateToFile(ms, S5::SaveFlags::noWindowClose);
 
     // Append extra state
     ExtraState extra;
-    extra.gameCommandIndex = _gameCommandIndex;
+    extra.gameCommandIndex = _upstream != nullptr ? _upstream->getLocalGameCommandIndex() : _gameCommandIndex;
     extra.tick = ScenarioManager::getScenarioTicks();
     ms.write(&extra, sizeof(extra));
+    _lastStateSize = ms.getLength();
+
+    StateTransfer transfer;
+    transfer.cookie = request.cookie;
+    auto compressedSize = compressBound(static_cast<uLong>(ms.getLength()));
+    transfer.data.resize(compressedSize);
+    if (compress2(transfer.data.data(), &compressedSize, reinterpret_cast<const Bytef*>(ms.data()), static_cast<uLong>(ms.getLength()), Z_BEST_SPEED) != Z_OK)
+    {
+        Logging::error("Unable to compress state for {}", client.name);
+        return;
+    }
+    transfer.data.resize(compressedSize);
+    transfer.numChunks = static_cast<uint16_t>((compressedSize + (kStateChunkSize - 1)) / kStateChunkSize);
 
     RequestStateResponse response;
     response.cookie = request.cookie;
-    response.totalSize = ms.getLength();
-    response.numChunks = static_cast<uint16_t>((ms.getLength() + (kChunkSize - 1)) / kChunkSize);
+    response.totalSize = static_cast<uint32_t>(ms.getLength());
+    response.compressedSize = static_cast<uint32_t>(compressedSize);
+    response.numChunks = transfer.numChunks;
     client.connection->sendPacket(response);
 
-    uint32_t offset = 0;
-    uint32_t remaining = response.totalSize;
-    uint16_t index = 0;
-    while (index < response.numChunks)
+    Logging::info("Sending state to {}: {} bytes compressed to {}", client.name, response.totalSize, response.compressedSize);
+
+    // The chunks are sent as the window allows, a new request replaces any previous transfer
+    client.stateTransfer = std::move(transfer);
+    sendStateChunks(client);
+
+    sendUpstreamGameCommands(client);
+}
+
+// The relay has received these but not run them yet, so they are not part of the state it sent
+void NetworkServer::sendUpstreamGameCommands(Client& client)
+{
+    if (_upstream == nullptr)
+    {
+        return;
+    }
+
+    // A batch holds commands of one tick with consecutive indices
+    GameCommandBatchPacket batch;
+    for (const auto& command : _upstream->getReceivedGameCommands())
+    {
+        const auto isNextInBatch = batch.numCommands != 0 && command.tick == batch.tick && command.index == batch.firstIndex + batch.numCommands;
+        if (batch.numCommands != 0 && (!isNextInBatch || !batch.tryAppend(command)))
+        {
+            client.connection->sendPacket(batch);
+            batch = {};
+        }
+        if (batch.numCommands == 0)
+        {
+            batch.tick = command.tick;
+            batch.firstIndex = command.index;
+            batch.tryAppend(command);
+        }
+    }
+
+    if (batch.numCommands != 0)
+    {
+        client.connection->sendPacket(batch);
+    }
+}
+
+void NetworkServer::relayPacket(const Packet& packet)
+{
+    for (auto& client : _clients)
+    {
+        client->connection->relayPacket(packet);
+    }
+}
+
+// Enough chunks in flight to sustain kStateTransferRate over the given round trip time
+static size_t getStateTransferWindow(uint32_t roundTripTime)
+{
+    const auto window = kStateTransferRate * roundTripTime / 1000 / kStateChunkSize;
+    return std::clamp(window, kMinStateTransferWindow, kMaxStateTransferWindow);
+}
+
+void NetworkServer::sendStateChunks(Client& client)
+{
+    auto& transfer = client.stateTransfer;
+    if (!transfer)
+    {
+        return;
+    }
+
+    const auto window = getStateTransferWindow(client.connection->getRoundTripTime());
+    while (transfer->nextChunk < transfer->numChunks && client.connection->getNumPacketsInFlight() < window)
     {
+        const auto offset = static_cast<uint32_t>(transfer->nextChunk) * kStateChunkSize;
+
         RequestStateResponseChunk chunk;
-        chunk.cookie = request.cookie;
-        chunk.index = index;
+        chunk.cookie = transfer->cookie;
+        chunk.index = transfer->nextChunk;
         chunk.offset = offset;
-        chunk.dataSize = std::min<uint32_t>(kChunkSize, remaining - offset);
-        std::memcpy(chunk.data, reinterpret_cast<const uint8_t*>(ms.data()) + offset, chunk.dataSize);
+        chunk.dataSize = std::min<uint32_t>(kStateChunkSize, static_cast<uint32_t>(transfer->data.size()) - offset);
+        std::memcpy(chunk.data, transfer->data.data() + offset, chunk.dataSize);
 
         client.connection->sendPacket(chunk);
 
-        offset += chunk.dataSize;
-        index++;
+        transfer->nextChunk++;
+    }
+
+    if (transfer->nextChunk >= transfer->numChunks)
+    {
+        transfer.reset();
     }
 }
 
 void NetworkServer::onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet)
 {
+    // Comes back from upstream along with everyone else's messages
+    if (_upstream != nullptr)
+    {
+        _upstream->sendChatMessage(packet.getText());
+        return;
+    }
+
     std::unique_lock<std::mutex> lk(_chatMessageQueueSync);
     _chatMessageQueue.push({ client.id, std::string(packet.getText()) });
 }
 
-void NetworkServer::onReceiveGameCommandPacket([[maybe_unused]] Client& client, const GameCommandPacket& packet)
+void NetworkServer::onReceiveGameCommandBatchPacket(Client& client, const GameCommandBatchPacket& packet)
 {
-    queueGameCommand(packet.company, packet.regs);
+    if (client.isSpectator)
+    {
+        Logging::warn("Ignoring game commands from spectator {}", client.name);
+        return;
+    }
+
+    auto commands = packet.read();
+    if (!commands)
+    {
+        Logging::error("Received invalid game commands from {}", client.name);
+        return;
+    }
+
+    for (const auto& command : *commands)
+    {
+        queueGameCommand(command.company, command.regs);
+    }
 }
 
 void NetworkServer::removedTimedOutClients()
@@ -217,7 +345,7 @@ void NetworkServer::removedTimedOutClients()
 void NetworkServer::sendPings()
 {
     auto now = Platform::getTime();
-    if (now - _lastPing > kPingInterval)
+    if (_upstream == nullptr && now - _lastPing > kPingInterval)
     {
         _lastPing = now;
 
@@ -235,6 +363,22 @@ void NetworkServer::sendPings()
     }
 }
 
+void NetworkServer::sendStateHashes()
+{
+    auto snapshot = StateHash::getLatest();
+    if (_upstream != nullptr || !snapshot || snapshot->tick == _lastStateHashTick)
+    {
+        return;
+    }
+    _lastStateHashTick = snapshot->tick;
+
+    StateHashPacket packet;
+    packet.tick = snapshot->tick;
+    packet.interval = StateHash::getInterval();
+    std::copy(snapshot->hashes.begin(), snapshot->hashes.end(), packet.hashes);
+    sendPacketToAll(packet);
+}
+
 void NetworkServer::sendChatMessages()
 {
     std::unique_lock<std::mutex> lk(_chatMessageQueueSync);
@@ -291,6 +435,7 @@ void NetworkServer::onUpdate()
     updateClients();
     sendChatMessages();
     sendPings();
+    sendStateHashes();
     removedTimedOutClients();
 }
 
@@ -298,29 +443,29 @@ void NetworkServer::updateClients()
 {
     for (auto& client : _clients)
     {
+        sendStateChunks(*client);
         client->connection->update();
     }
 }
 
-void NetworkServer::sendChatMessage(std::string_view message)
+void NetworkServer::getStats(NetworkStats& stats) const
 {
-    std::unique_lock<std::mutex> lk(_chatMessageQueueSync);
-    _chatMessageQueue.push({ 0, std::string(message) });
+    for (const auto& client : _clients)
+    {
+        stats.peers.push_back({ client->name, client->connection->getStats() });
+    }
+    stats.commandQueueDepth = _gameCommands.size();
 }
 
-void NetworkServer::sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::Interop::registers& regs)
+void NetworkServer::sendChatMessage(std::string_view message)
 {
-    GameCommandPacket packet;
-    packet.index = index;
-    packet.tick = tick;
-    packet.company = company;
-    packet.regs = regs;
-    sendPacketToAll(packet);
+    std::unique_lock<std::mutex> lk(_chatMessageQueueSync);
+    _chatMessageQueue.push({ 0, std::string(message) });
 }
 
 void NetworkServer::queueGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs)
 {
-    GameCommandPacket newPacket;
+    GameCommand newPacket;
     newPacket.index = ++_gameCommandIndex;
     newPacket.tick = 0;
     newPacket.company = company;
@@ -333,6 +478,10 @@ void NetworkServer::runGameCommands()
     auto& gameState = getGameState();
     auto tick = gameState.scenarioTicks;
 
+    // All the commands of the tick go out together, in as few packets as they fit in
+    GameCommandBatchPacket batch;
+    batch.tick = tick;
+
     // Execute all following commands if previously received
     while (!_gameCommands.empty())
     {
@@ -344,9 +493,24 @@ void NetworkServer::runGameCommands()
         //      otherwise we skip a game command index
         // if (result != 0x80000000)
         // {
-        sendGameCommand(gc.index, tick, gc.company, gc.regs);
+        if (!batch.tryAppend(gc))
+        {
+            sendPacketToAll(batch);
+            batch = {};
+            batch.tick = tick;
+            batch.tryAppend(gc);
+        }
+        if (batch.numCommands == 1)
+        {
+            batch.firstIndex = gc.index;
+        }
         // }
 
         _gameCommands.pop();
     }
+
+    if (batch.numCommands != 0)
+    {
+        sendPacketToAll(batch);
+    }
 }
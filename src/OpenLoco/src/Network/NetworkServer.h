@@ -5,16 +5,30 @@
 #include "NetworkConnection.h"
 #include "Socket.h"
 #include <mutex>
+#include <optional>
+#include <queue>
+#include <vector>
 
 namespace OpenLoco::Network
 {
+    class NetworkClient;
     class NetworkConnection;
 
+    struct StateTransfer
+    {
+        uint32_t cookie{};
+        std::vector<uint8_t> data;
+        uint16_t numChunks{};
+        uint16_t nextChunk{};
+    };
+
     struct Client
     {
         client_id_t id{};
         std::unique_ptr<NetworkConnection> connection;
         std::string name;
+        bool isSpectator{};
+        std::optional<StateTransfer> stateTransfer;
     };
 
     struct ChatMessage
@@ -35,17 +49,25 @@ namespace OpenLoco::Network
         client_id_t _nextClientId = 1;
         uint32_t _lastPing{};
         uint32_t _gameCommandIndex{};
-        std::queue<GameCommandPacket> _gameCommands;
+        uint32_t _lastStateHashTick{};
+        // Size of the last state sent, reserved up front for the next one
+        size_t _lastStateSize{};
+        std::queue<GameCommand> _gameCommands;
+        // Set when relaying, the game, pings and state hashes then come from the upstream server
+        NetworkClient* _upstream{};
 
         Client* findClient(const INetworkEndpoint& endpoint);
         void createNewClient(std::unique_ptr<NetworkConnection> conn, const ConnectPacket& packet);
         void onReceivePacketFromClient(Client& client, const Packet& packet);
         void onReceiveStateRequestPacket(Client& client, const RequestStatePacket& packet);
         void onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet);
-        void onReceiveGameCommandPacket(Client& client, const GameCommandPacket& packet);
+        void onReceiveGameCommandBatchPacket(Client& client, const GameCommandBatchPacket& packet);
         void removedTimedOutClients();
         void sendPings();
         void sendChatMessages();
+        void sendStateHashes();
+        void sendStateChunks(Client& client);
+        void sendUpstreamGameCommands(Client& client);
         void processIncomingConnections();
         void processPackets();
         void updateClients();
@@ -68,8 +90,10 @@ namespace OpenLoco::Network
         ~NetworkServer() override;
 
         void listen(const std::string& bind, port_t port);
+        void setUpstream(NetworkClient* upstream);
+        void relayPacket(const Packet& packet);
         void sendChatMessage(std::string_view message) override;
-        void sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::Interop::registers& regs);
+        void getStats(NetworkStats& stats) const override;
 
         void queueGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs);
         void runGameCommands();
@@ -0,0 +1,93 @@
+#include "NetworkStats.h"
+#include "Logging.h"
+#include <atomic>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Network
+{
+    struct AtomicPacketCounters
+    {
+        std::atomic<uint64_t> numPackets{};
+        std::atomic<uint64_t> numBytes{};
+    };
+
+    static std::array<AtomicPacketCounters, kPacketKindCount> _sent;
+    static std::array<AtomicPacketCounters, kPacketKindCount> _received;
+    static std::atomic<uint64_t> _numResends;
+
+    const char* getPacketKindName(PacketKind kind)
+    {
+        switch (kind)
+        {
+            case PacketKind::ack: return "ACK";
+            case PacketKind::ping: return "PING";
+            case PacketKind::connect: return "CONNECT";
+            case PacketKind::connectResponse: return "CONNECT RESPONSE";
+            case PacketKind::requestState: return "REQUEST STATE";
+            case PacketKind::requestStateResponse: return "REQUEST STATE RESPONSE";
+            case PacketKind::requestStateResponseChunk: return "REQUEST STATE RESPONSE CHUNK";
+            case PacketKind::sendChatMessage: return "SEND CHAT";
+            case PacketKind::receiveChatMessage: return "RECEIVE CHAT";
+            case PacketKind::gameCommandBatch: return "GAME COMMAND BATCH";
+            case PacketKind::stateHash: return "STATE HASH";
+            default: return "UNKNOWN";
+        }
+    }
+
+    void Stats::reset()
+    {
+        for (auto* counters : { &_sent, &_received })
+        {
+            for (auto& counter : *counters)
+            {
+                counter.numPackets = 0;
+                counter.numBytes = 0;
+            }
+        }
+        _numResends = 0;
+    }
+
+    void Stats::recordPacket(PacketKind kind, size_t size, bool sent, bool resend)
+    {
+        // Anything can arrive at the socket, kinds that don't exist are counted as unknown
+        const auto index = static_cast<size_t>(kind) < kPacketKindCount ? static_cast<size_t>(kind) : static_cast<size_t>(PacketKind::unknown);
+        auto& counter = sent ? _sent[index] : _received[index];
+        counter.numPackets.fetch_add(1, std::memory_order_relaxed);
+        counter.numBytes.fetch_add(size, std::memory_order_relaxed);
+        if (resend)
+        {
+            _numResends.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Stats::getPacketCounters(NetworkStats& stats)
+    {
+        for (size_t i = 0; i < kPacketKindCount; i++)
+        {
+            stats.sent[i] = { _sent[i].numPackets.load(std::memory_order_relaxed), _sent[i].numBytes.load(std::memory_order_relaxed) };
+            stats.received[i] = { _received[i].numPackets.load(std::memory_order_relaxed), _received[i].numBytes.load(std::memory_order_relaxed) };
+        }
+        stats.numResends = _numResends.load(std::memory_order_relaxed);
+    }
+
+    void Stats::log(const NetworkStats& stats)
+    {
+        Logging::info("Network: {} ticks behind server, {} queued commands, {} resends", stats.ticksBehindServer, stats.commandQueueDepth, stats.numResends);
+        for (const auto& peer : stats.peers)
+        {
+            const auto& connection = peer.connection;
+            Logging::info("  {}: rtt {} ms (var {} ms), rto {} ms, {} in flight, {} resends", peer.name, connection.roundTripTime, connection.roundTripTimeVariance, connection.retransmitTimeout, connection.numPacketsInFlight, connection.numResends);
+        }
+        for (size_t i = 0; i < kPacketKindCount; i++)
+        {
+            const auto& sent = stats.sent[i];
+            const auto& received = stats.received[i];
+            if (sent.numPackets == 0 && received.numPackets == 0)
+            {
+                continue;
+            }
+            Logging::info("  {}: sent {} ({} bytes), received {} ({} bytes)", getPacketKindName(static_cast<PacketKind>(i)), sent.numPackets, sent.numBytes, received.numPackets, received.numBytes);
+        }
+    }
+}
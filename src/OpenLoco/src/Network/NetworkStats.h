@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Packet.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OpenLoco::Network
+{
+    // Times are in milliseconds, the round trip time and its variance are 0 until the first sample
+    struct ConnectionStats
+    {
+        uint32_t roundTripTime{};
+        uint32_t roundTripTimeVariance{};
+        uint32_t retransmitTimeout{};
+        uint32_t numResends{};
+        size_t numPacketsInFlight{};
+        // Bytes held by the connection for unacknowledged and received packets
+        size_t memoryUsage{};
+    };
+
+    struct PeerStats
+    {
+        std::string name;
+        ConnectionStats connection;
+    };
+
+    // Sizes include the packet header, resends are counted as sent packets as well
+    struct PacketCounters
+    {
+        uint64_t numPackets{};
+        uint64_t numBytes{};
+    };
+
+    struct NetworkStats
+    {
+        std::array<PacketCounters, kPacketKindCount> sent{};
+        std::array<PacketCounters, kPacketKindCount> received{};
+        uint64_t numResends{};
+        std::vector<PeerStats> peers;
+        int64_t ticksBehindServer{};
+        size_t commandQueueDepth{};
+    };
+
+    const char* getPacketKindName(PacketKind kind);
+}
+
+// Counters of all the packets since the network was opened, safe to update from any thread.
+namespace OpenLoco::Network::Stats
+{
+    void reset();
+    void recordPacket(PacketKind kind, size_t size, bool sent, bool resend);
+    void getPacketCounters(NetworkStats& stats);
+    void log(const NetworkStats& stats);
+}
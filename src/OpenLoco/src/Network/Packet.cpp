@@ -0,0 +1,115 @@
+#include "Packet.h"
+#include <array>
+#include <cstring>
+
+namespace OpenLoco::Network
+{
+    static constexpr size_t kNumRegisters = 7;
+    // Company, register mask and a varint of up to 5 bytes for each register
+    static constexpr size_t kMaxEncodedCommandSize = 2 + kNumRegisters * 5;
+
+    // The registers struct is packed, so its members are copied rather than pointed to
+    using RegisterValues = std::array<int32_t, kNumRegisters>;
+    static_assert(sizeof(RegisterValues) == sizeof(OpenLoco::Interop::registers));
+
+    // Small negative values such as -1 are common, zigzag keeps them short
+    static uint32_t zigzagEncode(int32_t value)
+    {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    static int32_t zigzagDecode(uint32_t value)
+    {
+        return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    bool GameCommandBatchPacket::tryAppend(const GameCommand& command)
+    {
+        uint8_t encoded[kMaxEncodedCommandSize];
+        size_t length = 0;
+        encoded[length++] = enumValue(command.company);
+        const auto maskOffset = length++;
+        encoded[maskOffset] = 0;
+
+        RegisterValues registers;
+        std::memcpy(registers.data(), &command.regs, sizeof(registers));
+        for (size_t i = 0; i < kNumRegisters; i++)
+        {
+            if (registers[i] == kDefaultRegValue)
+            {
+                continue;
+            }
+            encoded[maskOffset] |= 1 << i;
+
+            auto value = zigzagEncode(registers[i]);
+            while (value >= 0x80)
+            {
+                encoded[length++] = static_cast<uint8_t>(value | 0x80);
+                value >>= 7;
+            }
+            encoded[length++] = static_cast<uint8_t>(value);
+        }
+
+        if (dataSize + length > sizeof(data))
+        {
+            return false;
+        }
+        std::memcpy(data + dataSize, encoded, length);
+        dataSize += static_cast<uint16_t>(length);
+        numCommands++;
+        return true;
+    }
+
+    std::optional<std::vector<GameCommand>> GameCommandBatchPacket::read() const
+    {
+        if (dataSize > sizeof(data))
+        {
+            return std::nullopt;
+        }
+
+        std::vector<GameCommand> commands;
+        commands.reserve(numCommands);
+        size_t offset = 0;
+        for (uint16_t i = 0; i < numCommands; i++)
+        {
+            if (offset + 2 > dataSize)
+            {
+                return std::nullopt;
+            }
+
+            auto& command = commands.emplace_back();
+            command.index = firstIndex + i;
+            command.tick = tick;
+            command.company = static_cast<CompanyId>(data[offset++]);
+            const auto mask = data[offset++];
+
+            RegisterValues registers;
+            std::memcpy(registers.data(), &command.regs, sizeof(registers));
+            for (size_t j = 0; j < kNumRegisters; j++)
+            {
+                if ((mask & (1 << j)) == 0)
+                {
+                    continue;
+                }
+
+                uint32_t value = 0;
+                for (uint32_t shift = 0;; shift += 7)
+                {
+                    if (offset >= dataSize || shift > 28)
+                    {
+                        return std::nullopt;
+                    }
+                    const auto byte = data[offset++];
+                    value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        break;
+                    }
+                }
+                registers[j] = zigzagDecode(value);
+            }
+            std::memcpy(static_cast<void*>(&command.regs), registers.data(), sizeof(registers));
+        }
+        return commands;
+    }
+}
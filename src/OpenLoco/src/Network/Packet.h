@@ -2,9 +2,12 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include "Network.h"
+#include "StateHash.h"
 #include <OpenLoco/Interop/Interop.hpp>
 
 namespace OpenLoco::Network
@@ -24,9 +27,13 @@ namespace OpenLoco::Network
         requestStateResponseChunk,
         sendChatMessage,
         receiveChatMessage,
-        gameCommand,
+        gameCommandBatch,
+        stateHash,
+        count,
     };
 
+    constexpr size_t kPacketKindCount = static_cast<size_t>(PacketKind::count);
+
     struct PacketHeader
     {
         PacketKind kind{};
@@ -58,6 +65,19 @@ namespace OpenLoco::Network
         }
     };
 
+    // Acknowledges the packet with the sequence in the header and everything else the receiver knows it has
+    struct AckPacket
+    {
+        static constexpr PacketKind kind = PacketKind::ack;
+        size_t size() const { return sizeof(AckPacket); }
+
+        // Every sequence before this one has been received
+        sequence_t nextExpectedSequence{};
+        sequence_t latestSequence{};
+        // Bit i is set if latestSequence - 1 - i has been received
+        uint64_t receivedMask{};
+    };
+
     struct PingPacket
     {
         static constexpr PacketKind kind = PacketKind::ping;
@@ -76,6 +96,8 @@ namespace OpenLoco::Network
 
         uint16_t version{};
         char name[32]{};
+        // Spectators receive the game but can't run game commands
+        bool spectator{};
     };
 
     enum class ConnectionResult
@@ -101,6 +123,7 @@ namespace OpenLoco::Network
         uint32_t cookie{};
     };
 
+    // The state is deflate compressed, the offsets of the chunks are into the compressed data
     struct RequestStateResponse
     {
         static constexpr PacketKind kind = PacketKind::requestStateResponse;
@@ -108,6 +131,7 @@ namespace OpenLoco::Network
 
         uint32_t cookie{};
         uint32_t totalSize{};
+        uint32_t compressedSize{};
         uint16_t numChunks{};
     };
 
@@ -164,15 +188,42 @@ namespace OpenLoco::Network
     };
     // static_assert(sizeof(SendChatMessage) <= kMaxPacketDataSize); // COMMENTED FOR 64-BIT DEBUG
 
-    struct GameCommandPacket
+    // A game command as it is queued and run, these are sent in a GameCommandBatchPacket
+    struct GameCommand
     {
-        static constexpr PacketKind kind = PacketKind::gameCommand;
-        size_t size() const { return sizeof(GameCommandPacket); }
-
         uint32_t index{};
         uint32_t tick{};
         CompanyId company{};
         OpenLoco::Interop::registers regs;
     };
+
+    // Consecutive game commands of a tick. Each is stored as its company, a mask of the registers that
+    // don't hold the default register value and then those registers as zigzag encoded varints.
+    struct GameCommandBatchPacket
+    {
+        static constexpr PacketKind kind = PacketKind::gameCommandBatch;
+        size_t size() const { return reinterpret_cast<size_t>(this->data + dataSize) - reinterpret_cast<size_t>(this); }
+
+        uint32_t tick{};
+        uint32_t firstIndex{};
+        uint16_t numCommands{};
+        uint16_t dataSize{};
+        uint8_t data[kMaxPacketDataSize - 12]{};
+
+        // Returns false if there is no room left for the command
+        bool tryAppend(const GameCommand& command);
+        // Returns nothing if the commands can't be decoded
+        std::optional<std::vector<GameCommand>> read() const;
+    };
+
+    struct StateHashPacket
+    {
+        static constexpr PacketKind kind = PacketKind::stateHash;
+        size_t size() const { return sizeof(StateHashPacket); }
+
+        uint32_t tick{};
+        uint32_t interval{};
+        uint64_t hashes[StateHash::kSubsystemCount]{};
+    };
 #pragma pack(pop)
 }
@@ -32,6 +32,8 @@
         #define SHUT_RDWR SD_BOTH
     #endif
     #define FLAG_NO_PIPE 0
+    #define poll WSAPoll
+    using nfds_t = ULONG;
 #else
     #include <arpa/inet.h>
     #include <cerrno>
@@ -40,6 +42,7 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
     #include <unistd.h>
@@ -535,6 +538,11 @@ namespace OpenLoco::Network
             return endpoint.getProtocol();
         }
 
+        SOCKET getHandle() const
+        {
+            return _socket;
+        }
+
         std::string getIpAddress() const override
         {
             NetworkEndpoint endpoint(&_listeningAddress, _listeningAddressLen);
@@ -611,6 +619,125 @@ namespace OpenLoco::Network
         }
     };
 
+    class SocketPoller final : public ISocketPoller, protected BaseSocket
+    {
+    private:
+#ifdef _WIN32
+        // WSAPoll only accepts sockets, so a loopback socket that sends to itself stands in for a pipe
+        SOCKET _wakeSocket = INVALID_SOCKET;
+        sockaddr_in _wakeAddress{};
+#else
+        int _wakePipe[2] = { -1, -1 };
+#endif
+        std::vector<pollfd> _fds;
+
+    public:
+        SocketPoller()
+        {
+#ifdef _WIN32
+            _wakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            _wakeAddress.sin_family = AF_INET;
+            _wakeAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t addressLen = sizeof(_wakeAddress);
+            if (_wakeSocket == INVALID_SOCKET
+                || bind(_wakeSocket, reinterpret_cast<sockaddr*>(&_wakeAddress), sizeof(_wakeAddress)) != 0
+                || getsockname(_wakeSocket, reinterpret_cast<sockaddr*>(&_wakeAddress), &addressLen) != 0
+                || !setNonBlocking(_wakeSocket, true))
+            {
+                closeHandles();
+                throw SocketException("Unable to create wake socket.");
+            }
+#else
+            if (pipe(_wakePipe) != 0)
+            {
+                throw SocketException("Unable to create wake pipe.");
+            }
+            if (!setNonBlocking(_wakePipe[0], true) || !setNonBlocking(_wakePipe[1], true))
+            {
+                closeHandles();
+                throw SocketException("Unable to create wake pipe.");
+            }
+#endif
+        }
+
+        ~SocketPoller() override
+        {
+            closeHandles();
+        }
+
+        void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets) override
+        {
+            _fds.clear();
+            _fds.push_back({ getWakeHandle(), POLLIN, 0 });
+            for (const auto& socket : sockets)
+            {
+                auto handle = static_cast<const UdpSocket&>(*socket).getHandle();
+                if (handle != INVALID_SOCKET)
+                {
+                    _fds.push_back({ handle, POLLIN, 0 });
+                }
+            }
+
+            // An interrupted wait just returns, the caller reads whatever is there and waits again
+            if (poll(_fds.data(), static_cast<nfds_t>(_fds.size()), -1) > 0 && (_fds[0].revents & POLLIN))
+            {
+                char buffer[64];
+#ifdef _WIN32
+                while (recv(_wakeSocket, buffer, sizeof(buffer), 0) > 0)
+#else
+                while (read(_wakePipe[0], buffer, sizeof(buffer)) > 0)
+#endif
+                {
+                }
+            }
+        }
+
+        void wake() override
+        {
+            const char value = 0;
+#ifdef _WIN32
+            sendto(_wakeSocket, &value, sizeof(value), 0, reinterpret_cast<const sockaddr*>(&_wakeAddress), sizeof(_wakeAddress));
+#else
+            // A full pipe already has a wake up pending
+            [[maybe_unused]] auto result = write(_wakePipe[1], &value, sizeof(value));
+#endif
+        }
+
+    private:
+#ifdef _WIN32
+        SOCKET getWakeHandle() const
+        {
+            return _wakeSocket;
+        }
+
+        void closeHandles()
+        {
+            if (_wakeSocket != INVALID_SOCKET)
+            {
+                closesocket(_wakeSocket);
+                _wakeSocket = INVALID_SOCKET;
+            }
+        }
+#else
+        int getWakeHandle() const
+        {
+            return _wakePipe[0];
+        }
+
+        void closeHandles()
+        {
+            for (auto& fd : _wakePipe)
+            {
+                if (fd != -1)
+                {
+                    ::close(fd);
+                    fd = -1;
+                }
+            }
+        }
+#endif
+    };
+
     namespace Socket
     {
         std::unique_ptr<IUdpSocket> createUdp()
@@ -619,6 +746,12 @@ namespace OpenLoco::Network
             return std::make_unique<UdpSocket>();
         }
 
+        std::unique_ptr<ISocketPoller> createPoller()
+        {
+            initialiseWSA();
+            return std::make_unique<SocketPoller>();
+        }
+
         std::unique_ptr<INetworkEndpoint> resolve(Protocol protocol, const std::string& address, uint16_t port)
         {
             initialiseWSA();
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -73,9 +75,22 @@ namespace OpenLoco::Network
         virtual void close() = 0;
     };
 
+    /**
+     * Blocks until one of a set of sockets has data to read, another thread can wake it early.
+     */
+    struct ISocketPoller
+    {
+    public:
+        virtual ~ISocketPoller() = default;
+
+        virtual void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets) = 0;
+        virtual void wake() = 0;
+    };
+
     namespace Socket
     {
         [[nodiscard]] std::unique_ptr<IUdpSocket> createUdp();
+        [[nodiscard]] std::unique_ptr<ISocketPoller> createPoller();
         std::unique_ptr<INetworkEndpoint> resolve(Protocol protocol, const std::string& address, uint16_t port);
     }
 }
@@ -186,4 +186,62 @@ namespace OpenLoco
         return std::span<const MovementEdge>(ptr, numMovementEdges);
     }
 
+    static std::array<AirportMovementGraph, ObjectManager::getMaxObjects(ObjectType::airport)> _movementGraphs;
+
+    static void buildEdgeLists(AirportMovementEdgeLists& lists, const AirportObject& airportObj, AirportMovementNodeFlags excludedNextNode)
+    {
+        const auto movementNodes = airportObj.getMovementNodes();
+        const auto movementEdges = airportObj.getMovementEdges();
+
+        std::array<uint16_t, 256> numEdges{};
+        for (uint8_t i = 0; i < movementEdges.size(); i++)
+        {
+            const auto& edge = movementEdges[i];
+            if (!movementNodes[edge.nextNode].hasFlags(excludedNextNode))
+            {
+                numEdges[edge.curNode]++;
+            }
+        }
+
+        lists.nodeStart[0] = 0;
+        for (size_t node = 0; node < numEdges.size(); node++)
+        {
+            lists.nodeStart[node + 1] = lists.nodeStart[node] + numEdges[node];
+        }
+
+        auto nextSlot = lists.nodeStart;
+        for (uint8_t i = 0; i < movementEdges.size(); i++)
+        {
+            const auto& edge = movementEdges[i];
+            if (!movementNodes[edge.nextNode].hasFlags(excludedNextNode))
+            {
+                lists.edges[nextSlot[edge.curNode]++] = i;
+            }
+        }
+    }
+
+    void buildAirportMovementGraph(LoadedObjectId airportObjectId)
+    {
+        auto& graph = _movementGraphs[airportObjectId];
+        graph = {};
+
+        const auto* airportObj = ObjectManager::get<AirportObject>(airportObjectId);
+        buildEdgeLists(graph.planeEdges, *airportObj, AirportMovementNodeFlags::heliTakeoffBegin);
+        buildEdgeLists(graph.helicopterEdges, *airportObj, AirportMovementNodeFlags::takeoffBegin);
+
+        const auto movementNodes = airportObj->getMovementNodes();
+        const auto movementEdges = airportObj->getMovementEdges();
+        for (uint8_t i = 0; i < movementEdges.size(); i++)
+        {
+            if (movementNodes[movementEdges[i].curNode].hasFlags(AirportMovementNodeFlags::flag2))
+            {
+                graph.entryEdges[graph.numEntryEdges++] = i;
+            }
+        }
+    }
+
+    const AirportMovementGraph& getAirportMovementGraph(LoadedObjectId airportObjectId)
+    {
+        return _movementGraphs[airportObjectId];
+    }
 }
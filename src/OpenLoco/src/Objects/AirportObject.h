@@ -5,6 +5,7 @@
 #include "Types.hpp"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
 #include <span>
 
 namespace OpenLoco
@@ -128,5 +129,32 @@ namespace OpenLoco
     };
 #pragma pack(pop)
 
+    // Movement edges grouped by the node they leave, keeping the edge order within each node
+    struct AirportMovementEdgeLists
+    {
+        std::array<uint16_t, 257> nodeStart{};
+        std::array<uint8_t, 256> edges{};
+
+        std::span<const uint8_t> getEdgesLeaving(uint8_t node) const
+        {
+            return std::span<const uint8_t>(edges.data() + nodeStart[node], edges.data() + nodeStart[node + 1]);
+        }
+    };
+
+    // Lets aircraft pick their next edge by only visiting the edges leaving their node. Planes and
+    // helicopters have a list each as both skip the edges towards the take off of the other.
+    struct AirportMovementGraph
+    {
+        AirportMovementEdgeLists planeEdges;
+        AirportMovementEdgeLists helicopterEdges;
+        // Edges leaving the nodes aircraft enter the airport from (flag2)
+        std::array<uint8_t, 256> entryEdges{};
+        uint16_t numEntryEdges = 0;
+    };
+
+    // Rebuilt whenever the object is loaded
+    void buildAirportMovementGraph(LoadedObjectId airportObjectId);
+    const AirportMovementGraph& getAirportMovementGraph(LoadedObjectId airportObjectId);
+
     // static_assert(sizeof(AirportObject) == 0xBA); // COMMENTED FOR 64-BIT DEBUG
 }
@@ -1,7 +1,13 @@
 #include "ObjectImageTable.h"
 #include "Graphics/Gfx.h"
+#include "Graphics/SpriteCache.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -10,6 +16,91 @@ namespace OpenLoco::ObjectManager
     // 0x0050D154
     static uint32_t _totalNumImages = 0;
 
+    struct ImageTable
+    {
+        uint32_t firstImage;
+        uint32_t numImages;
+        const Gfx::G1Element32* entries;
+        uint8_t* imageData;
+        size_t imageDataSize;
+        bool isLoaded;
+    };
+
+    // Sorted by first image, the ranges don't overlap
+    static std::vector<ImageTable> _imageTables;
+    static constexpr uint32_t kMaxImages = Gfx::G1ExpectedCount::kDisc + Gfx::G1ExpectedCount::kTemporary + Gfx::G1ExpectedCount::kObjects;
+    // A bit for every image of a table that isn't filled in yet, keeps the check on each lookup cheap
+    static std::array<std::atomic<uint64_t>, (kMaxImages + 63) / 64> _pendingImages{};
+    // Images are looked up by the viewport drawing threads, recursive as filling in a table looks up the
+    // element before it which may be in another pending table
+    static std::recursive_mutex _imageTablesMutex;
+
+    static void setImagesPending(uint32_t firstImage, uint32_t numImages, bool isPending)
+    {
+        const auto end = std::min(firstImage + numImages, kMaxImages);
+        for (auto i = firstImage; i < end;)
+        {
+            const auto bit = i % 64;
+            const auto count = std::min<uint32_t>(64 - bit, end - i);
+            const auto mask = (count == 64 ? ~0ULL : (1ULL << count) - 1) << bit;
+            if (isPending)
+            {
+                _pendingImages[i / 64].fetch_or(mask, std::memory_order_relaxed);
+            }
+            else
+            {
+                _pendingImages[i / 64].fetch_and(~mask, std::memory_order_release);
+            }
+            i += count;
+        }
+    }
+
+    static bool isImagePending(uint32_t image)
+    {
+        return image < kMaxImages && ((_pendingImages[image / 64].load(std::memory_order_acquire) >> (image % 64)) & 1) != 0;
+    }
+
+    static void clearPendingImages(const ImageTable& table)
+    {
+        if (!table.isLoaded)
+        {
+            setImagesPending(table.firstImage, table.numImages, false);
+        }
+    }
+
+    static void fillImageTable(const ImageTable& table)
+    {
+        // The table is already marked as loaded so this doesn't come back here
+        auto* elements = Gfx::getG1Element(table.firstImage);
+
+        const auto* g32Ptr = table.entries;
+        for (uint32_t i = 0; i < table.numImages; ++i, ++g32Ptr)
+        {
+            auto g1Element = Gfx::G1Element(*g32Ptr);
+            g1Element.offset = table.imageData + g32Ptr->offset;
+            if (g1Element.hasFlags(Gfx::G1ElementFlags::duplicatePrevious))
+            {
+                g1Element = i == 0 ? *Gfx::getG1Element(table.firstImage - 1) : elements[i - 1];
+                g1Element.xOffset += g32Ptr->xOffset;
+                g1Element.yOffset += g32Ptr->yOffset;
+            }
+            elements[i] = g1Element;
+        }
+    }
+
+    // Drops the tables that overlap the images, their elements are about to be replaced
+    static void removeImageTables(uint32_t firstImage, uint32_t numImages)
+    {
+        std::erase_if(_imageTables, [firstImage, numImages](const ImageTable& table) {
+            if (table.firstImage >= firstImage + numImages || firstImage >= table.firstImage + table.numImages)
+            {
+                return false;
+            }
+            clearPendingImages(table);
+            return true;
+        });
+    }
+
     // 0x0047221F
     ImageTableResult loadImageTable(std::span<const std::byte> data)
     {
@@ -32,22 +123,88 @@ namespace OpenLoco::ObjectManager
         // Urgh messy...
         auto* const imageDataBegin = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(remainingData.data()));
 
-        for (uint32_t i = 0; i < g1Header.numEntries; ++i, ++g32Ptr)
+        if (g1Header.numEntries != 0)
         {
-            auto g1Element = Gfx::G1Element(*g32Ptr);
-            g1Element.offset = imageDataBegin + g32Ptr->offset;
-            if (g1Element.hasFlags(Gfx::G1ElementFlags::duplicatePrevious))
-            {
-                g1Element = *Gfx::getG1Element(_totalNumImages + i - 1);
-                g1Element.xOffset += g32Ptr->xOffset;
-                g1Element.yOffset += g32Ptr->yOffset;
-            }
-            *Gfx::getG1Element(_totalNumImages + i) = g1Element;
+            std::lock_guard lock(_imageTablesMutex);
+            removeImageTables(_totalNumImages, g1Header.numEntries);
+            const ImageTable table{ _totalNumImages, g1Header.numEntries, g32Ptr, imageDataBegin, g1Header.totalSize, false };
+            const auto it = std::ranges::lower_bound(_imageTables, table.firstImage, {}, &ImageTable::firstImage);
+            _imageTables.insert(it, table);
+            setImagesPending(table.firstImage, table.numImages, true);
         }
         _totalNumImages += g1Header.numEntries;
+
+        // Image data of previously loaded objects may have been freed and reused.
+        Gfx::SpriteCache::clear();
         return res;
     }
 
+    void ensureImageLoaded(uint32_t imageIndex)
+    {
+        if (!isImagePending(imageIndex))
+        {
+            return;
+        }
+
+        std::lock_guard lock(_imageTablesMutex);
+        auto it = std::ranges::upper_bound(_imageTables, imageIndex, {}, &ImageTable::firstImage);
+        if (it == _imageTables.begin())
+        {
+            return;
+        }
+        auto& table = *std::prev(it);
+        if (table.isLoaded || imageIndex >= table.firstImage + table.numImages)
+        {
+            return;
+        }
+
+        table.isLoaded = true;
+        fillImageTable(table);
+        // Only now can other threads use the images of the table without taking the lock
+        setImagesPending(table.firstImage, table.numImages, false);
+    }
+
+    void unloadImageTables(std::span<const std::byte> objectData)
+    {
+        const auto* begin = reinterpret_cast<const uint8_t*>(objectData.data());
+        const auto* end = begin + objectData.size();
+        std::lock_guard lock(_imageTablesMutex);
+        std::erase_if(_imageTables, [begin, end](const ImageTable& table) {
+            const auto* entries = reinterpret_cast<const uint8_t*>(table.entries);
+            if (entries < begin || entries >= end)
+            {
+                return false;
+            }
+            clearPendingImages(table);
+            return true;
+        });
+    }
+
+    ImageTableStats getImageTableStats()
+    {
+        ImageTableStats stats{};
+        std::lock_guard lock(_imageTablesMutex);
+        for (const auto& table : _imageTables)
+        {
+            stats.numTables++;
+            stats.numImages += table.numImages;
+            stats.numLoadedImages += table.isLoaded ? table.numImages : 0;
+            stats.imageDataSize += table.imageDataSize;
+        }
+        return stats;
+    }
+
+    size_t getImageTableMemoryUsage()
+    {
+        std::lock_guard lock(_imageTablesMutex);
+        size_t size = (_imageTables.capacity() * sizeof(ImageTable)) + sizeof(_pendingImages);
+        for (const auto& table : _imageTables)
+        {
+            size += table.imageDataSize;
+        }
+        return size;
+    }
+
     uint32_t getTotalNumImages()
     {
         return _totalNumImages;
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
@@ -10,7 +11,25 @@ namespace OpenLoco::ObjectManager
         uint32_t tableLength;
     };
 
+    struct ImageTableStats
+    {
+        uint32_t numTables;
+        uint32_t numImages;
+        // Images whose G1 element has been filled in
+        uint32_t numLoadedImages;
+        // Image data the tables refer to, which lives in the object data
+        size_t imageDataSize;
+    };
+
+    // The G1 elements of the table are only filled in once one of its images is first looked up.
     ImageTableResult loadImageTable(std::span<const std::byte> data);
+    // Makes sure the G1 element of the image is filled in, called by Gfx::getG1Element.
+    void ensureImageLoaded(uint32_t imageIndex);
+    // Forgets the tables of an object whose data is about to be freed.
+    void unloadImageTables(std::span<const std::byte> objectData);
+    ImageTableStats getImageTableStats();
+    // Image data of the tables together with the bookkeeping of them.
+    size_t getImageTableMemoryUsage();
     uint32_t getTotalNumImages();
     void setTotalNumImages(uint32_t count);
 }
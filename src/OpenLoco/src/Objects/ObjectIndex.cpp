@@ -30,14 +30,22 @@
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/Station.h"
+#include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/JobSystem.h>
 #include <OpenLoco/Core/Numerics.hpp>
 #include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 #include <cstdint>
 #include <fstream>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -47,16 +55,38 @@ namespace OpenLoco::ObjectManager
     // Was previously 0x0050D13C count was in 0x0112A110
     static std::vector<ObjectIndexEntry> _installedObjectList;
 
+    // Lookup tables over _installedObjectList, rebuilt whenever the index is loaded
+    struct ObjectSearchIndex
+    {
+        // Lower case name and file name of each object, separated by a new line
+        std::vector<std::string> keys;
+        // Objects of each type in index order
+        std::array<std::vector<ObjectIndexId>, kMaxObjectTypes> objectsByType;
+        // Objects whose key contains the three characters, in index order
+        std::unordered_map<uint32_t, std::vector<ObjectIndexId>> trigrams;
+        // Objects by the key of their type and name, in index order. ObjectHeader equality only looks at
+        // the type and name unless both headers are custom, so those are all that can be hashed.
+        std::unordered_map<uint64_t, std::vector<ObjectIndexId>> headers;
+    };
+    static ObjectSearchIndex _searchIndex;
+
     static bool _customObjectsInIndex = false; // Was loco_global at 0x0112A17E
     static bool _isFirstTime = false; // Was loco_global at 0x0050AEAD
-    static bool _isPartialLoaded = false; // Was loco_global at 0x0050D161
     static int32_t _50D144refCount = 0; // Was loco_global at 0x0050D148
     static SelectedObjectsFlags* _50D144 = nullptr; // Was loco_global at 0x0050D144
     static ObjectSelectionMeta _objectSelectionMeta = {}; // Was loco_global at 0x0112C1C5
     static std::array<uint16_t, kMaxObjectTypes> _numObjectsPerType = {}; // Was loco_global at 0x0112C181
 
-    static constexpr uint8_t kCurrentIndexVersion = 5;
-    static constexpr uint32_t kMaxStringLength = 1024;
+    static constexpr uint8_t kCurrentIndexVersion = 7;
+
+    struct ObjectFileRecord
+    {
+        std::string path; // u8string
+        uint64_t fileSize = 0;
+        int64_t lastWrite = 0;
+
+        bool operator==(const ObjectFileRecord& rhs) const = default;
+    };
 
     struct ObjectFolderState
     {
@@ -64,6 +94,9 @@ namespace OpenLoco::ObjectManager
         uint32_t totalFileSize = 0;
         uint32_t dateHash = 0;
         std::string basePath = "";
+        // Every object file of the folder sorted by path, not part of the comparison as it is only
+        // needed to work out what changed once the totals differ.
+        std::vector<ObjectFileRecord> files;
 
         constexpr bool operator==(const ObjectFolderState& rhs) const
         {
@@ -77,6 +110,11 @@ namespace OpenLoco::ObjectManager
         ObjectFolderState install;
         ObjectFolderState customObjects;
 
+        auto folders() const
+        {
+            return std::array{ &vanillaInstall, &install, &customObjects };
+        }
+
         constexpr bool operator==(const ObjectFoldersState& rhs) const
         {
             return (vanillaInstall == rhs.vanillaInstall) && (install == rhs.install) && (customObjects == rhs.customObjects);
@@ -91,6 +129,9 @@ namespace OpenLoco::ObjectManager
         uint32_t numObjects; // duplicates ObjectFolderState.numObjects but without high 1 and includes corrupted .dat's
     };
 
+    // Object files that have an entry in the index, their checksums were verified when they were indexed
+    static std::unordered_map<std::string, ObjectFileRecord> _verifiedFiles;
+
     // Iterates an objects folder
     // optionally recurses
     // func takes a const fs::directory_entry parameter and returns false to stop iteration
@@ -149,9 +190,13 @@ namespace OpenLoco::ObjectManager
             currentState.dateHash ^= ((lastWrite >> 32) ^ (lastWrite & 0xFFFFFFFF));
             currentState.dateHash = std::rotr(currentState.dateHash, 5);
             currentState.totalFileSize += file.file_size();
+            currentState.files.push_back({ file.path().u8string(), file.file_size(), static_cast<int64_t>(lastWrite) });
             return true;
         });
 
+        // Sorted so that the index, and which of two duplicates is kept, doesn't depend on the directory order
+        std::ranges::sort(currentState.files, {}, &ObjectFileRecord::path);
+
         return currentState;
     }
 
@@ -168,153 +213,248 @@ namespace OpenLoco::ObjectManager
         return false;
     }
 
-    static void serialiseEntry(Stream& stream, const ObjectIndexEntry& entry)
-    {
-        // Header
-        stream.writeValue(entry._header);
+    // The index file is a flat layout of fixed size records. All strings are kept in one pool at the end of
+    // the file and the object lists of all entries in one shared array, so a mapped index is read in place.
+    static constexpr char kIndexMagic[4] = { 'O', 'L', 'O', 'I' };
 
-        // Filepath
-        stream.writeValue<uint32_t>(entry._filepath.size());
-        stream.write(entry._filepath.data(), entry._filepath.size());
+#pragma pack(push, 1)
+    struct IndexFileHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t fileSize;
+        uint32_t numObjects;
+        uint32_t numFolders;
+        uint32_t numFiles;
+        uint32_t numEntries;
+        uint32_t numObjectRefs;
+        uint32_t stringPoolSize;
+    };
+    static_assert(sizeof(IndexFileHeader) == 36);
 
-        // Header2
-        stream.writeValue(entry._header2.decodedFileSize);
+    struct IndexString
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
 
-        // Name
-        stream.writeValue<uint32_t>(entry._name.size());
-        stream.write(entry._name.data(), entry._name.size());
+    struct IndexFolderRecord
+    {
+        uint32_t numObjects;
+        uint32_t totalFileSize;
+        uint32_t dateHash;
+        IndexString basePath;
+        uint32_t firstFile;
+        uint32_t numFiles;
+    };
+    static_assert(sizeof(IndexFolderRecord) == 28);
 
-        // Header3
-        stream.write(&entry._displayData, sizeof(entry._displayData));
+    struct IndexFileRecord
+    {
+        IndexString path;
+        uint64_t fileSize;
+        int64_t lastWrite;
+    };
+    static_assert(sizeof(IndexFileRecord) == 24);
 
-        // ObjectList1
-        stream.writeValue<uint32_t>(entry._alsoLoadObjects.size());
-        for (auto& alo : entry._alsoLoadObjects)
-        {
-            stream.writeValue(alo);
-        }
+    // The object lists are ranges of the shared object ref array
+    struct IndexEntryRecord
+    {
+        ObjectHeader header;
+        ObjectHeader2 header2;
+        ObjectHeader3 displayData;
+        IndexString filepath;
+        IndexString name;
+        uint32_t firstRequiredObject;
+        uint32_t numRequiredObjects;
+        uint32_t firstAlsoLoadObject;
+        uint32_t numAlsoLoadObjects;
+    };
+    static_assert(sizeof(IndexEntryRecord) == 64);
+#pragma pack(pop)
 
-        // ObjectList2
-        stream.writeValue<uint32_t>(entry._requiredObjects.size());
-        for (auto& ro : entry._requiredObjects)
-        {
-            stream.writeValue(ro);
-        }
+    static IndexString addIndexString(std::string& pool, std::string_view str)
+    {
+        const IndexString result{ static_cast<uint32_t>(pool.size()), static_cast<uint32_t>(str.size()) };
+        pool.append(str);
+        return result;
     }
 
-    static void serialiseFolderState(Stream& stream, const ObjectFolderState& ofs)
+    template<typename T>
+    static void writeIndexArray(Stream& stream, std::span<const T> data)
     {
-        stream.writeValue(ofs.numObjects);
-        stream.writeValue(ofs.totalFileSize);
-        stream.writeValue(ofs.dateHash);
-
-        stream.writeValue<uint32_t>(ofs.basePath.size());
-        stream.write(ofs.basePath.data(), ofs.basePath.size());
+        stream.write(data.data(), data.size_bytes());
     }
 
-    static void serialiseHeader(Stream& stream, const IndexHeader& header)
+    static void serialiseIndex(Stream& stream, const IndexHeader& header, const std::vector<ObjectIndexEntry>& entries)
     {
-        stream.writeValue(header.version);
+        std::string stringPool;
+
+        std::vector<IndexFolderRecord> folders;
+        std::vector<IndexFileRecord> files;
+        for (const auto* folder : header.state.folders())
+        {
+            IndexFolderRecord record{};
+            record.numObjects = folder->numObjects;
+            record.totalFileSize = folder->totalFileSize;
+            record.dateHash = folder->dateHash;
+            record.basePath = addIndexString(stringPool, folder->basePath);
+            record.firstFile = static_cast<uint32_t>(files.size());
+            record.numFiles = static_cast<uint32_t>(folder->files.size());
+            for (const auto& file : folder->files)
+            {
+                files.push_back({ addIndexString(stringPool, file.path), file.fileSize, file.lastWrite });
+            }
+            folders.push_back(record);
+        }
+
+        std::vector<IndexEntryRecord> records;
+        std::vector<ObjectHeader> objectRefs;
+        records.reserve(entries.size());
+        for (const auto& entry : entries)
+        {
+            IndexEntryRecord record{};
+            record.header = entry._header;
+            record.header2 = entry._header2;
+            record.displayData = entry._displayData;
+            record.filepath = addIndexString(stringPool, entry._filepath);
+            record.name = addIndexString(stringPool, entry._name);
+            record.firstRequiredObject = static_cast<uint32_t>(objectRefs.size());
+            record.numRequiredObjects = static_cast<uint32_t>(entry._requiredObjects.size());
+            objectRefs.insert(objectRefs.end(), entry._requiredObjects.begin(), entry._requiredObjects.end());
+            record.firstAlsoLoadObject = static_cast<uint32_t>(objectRefs.size());
+            record.numAlsoLoadObjects = static_cast<uint32_t>(entry._alsoLoadObjects.size());
+            objectRefs.insert(objectRefs.end(), entry._alsoLoadObjects.begin(), entry._alsoLoadObjects.end());
+            records.push_back(record);
+        }
+
+        IndexFileHeader fileHeader{};
+        std::memcpy(fileHeader.magic, kIndexMagic, sizeof(kIndexMagic));
+        fileHeader.version = header.version;
+        fileHeader.fileSize = header.fileSize;
+        fileHeader.numObjects = header.numObjects;
+        fileHeader.numFolders = static_cast<uint32_t>(folders.size());
+        fileHeader.numFiles = static_cast<uint32_t>(files.size());
+        fileHeader.numEntries = static_cast<uint32_t>(records.size());
+        fileHeader.numObjectRefs = static_cast<uint32_t>(objectRefs.size());
+        fileHeader.stringPoolSize = static_cast<uint32_t>(stringPool.size());
+
+        stream.writeValue(fileHeader);
+        writeIndexArray<IndexFolderRecord>(stream, folders);
+        writeIndexArray<IndexFileRecord>(stream, files);
+        writeIndexArray<IndexEntryRecord>(stream, records);
+        writeIndexArray<ObjectHeader>(stream, objectRefs);
+        writeIndexArray<char>(stream, stringPool);
+    }
 
-        serialiseFolderState(stream, header.state.vanillaInstall);
-        serialiseFolderState(stream, header.state.install);
-        serialiseFolderState(stream, header.state.customObjects);
+    // Arrays of a mapped index are used in place, otherwise they are read into storage.
+    template<typename T>
+    static std::span<const T> readIndexArray(Stream& stream, size_t count, std::vector<T>& storage)
+    {
+        static_assert(alignof(T) == 1, "Index records must be packed");
 
-        stream.writeValue(header.fileSize);
-        stream.writeValue(header.numObjects);
+        if (count > (stream.getLength() - stream.getPosition()) / sizeof(T))
+        {
+            throw Exception::RuntimeError("Object index is truncated");
+        }
+        const auto view = stream.readView(count * sizeof(T));
+        if (view.size() == count * sizeof(T))
+        {
+            return std::span(reinterpret_cast<const T*>(view.data()), count);
+        }
+        storage.resize(count);
+        stream.read(storage.data(), count * sizeof(T));
+        return storage;
     }
 
-    static void serialiseIndex(Stream& stream, const IndexHeader& header, const std::vector<ObjectIndexEntry>& entries)
+    static std::string_view getIndexString(std::string_view pool, const IndexString& str)
     {
-        serialiseHeader(stream, header);
-        stream.writeValue<uint32_t>(entries.size());
-        for (auto& entry : entries)
+        if (str.offset > pool.size() || str.length > pool.size() - str.offset)
         {
-            serialiseEntry(stream, entry);
+            throw Exception::RuntimeError("Invalid object index string");
         }
+        return pool.substr(str.offset, str.length);
     }
 
-    static std::string deserialiseString(Stream& stream)
+    static std::vector<ObjectHeader> getIndexObjectRefs(std::span<const ObjectHeader> objectRefs, uint32_t first, uint32_t count)
     {
-        std::string result;
-        const auto size = stream.readValue<uint32_t>();
-        if (size > kMaxStringLength) // Arbitrary max length to prevent issues of massive allocation on bad data
+        if (first > objectRefs.size() || count > objectRefs.size() - first)
         {
-            return result;
+            throw Exception::RuntimeError("Invalid object index object list");
         }
-        result.resize(size);
-        stream.read(result.data(), result.size());
-        return result;
+        const auto refs = objectRefs.subspan(first, count);
+        return std::vector<ObjectHeader>(refs.begin(), refs.end());
     }
 
-    static ObjectIndexEntry deserialiseEntry(Stream& stream)
+    // Returns nothing if the file is not an index of the current version.
+    static std::optional<IndexHeader> deserialiseIndex(Stream& stream, std::vector<ObjectIndexEntry>& entries)
     {
-        ObjectIndexEntry entry{};
-        // Header
-        entry._header = stream.readValue<ObjectHeader>();
-
-        // Filepath
-        entry._filepath = deserialiseString(stream);
-
-        // Header2
-        entry._header2.decodedFileSize = stream.readValue<uint32_t>();
-
-        // Name
-        entry._name = deserialiseString(stream);
-
-        // Header3
-        entry._displayData = stream.readValue<ObjectHeader3>();
-
-        // ObjectList1
-        entry._alsoLoadObjects.resize(stream.readValue<uint32_t>());
-        for (auto& alo : entry._alsoLoadObjects)
+        if (stream.getLength() - stream.getPosition() < sizeof(IndexFileHeader))
         {
-            alo = stream.readValue<ObjectHeader>();
+            return std::nullopt;
         }
-
-        // ObjectList2
-        entry._requiredObjects.resize(stream.readValue<uint32_t>());
-        for (auto& ro : entry._requiredObjects)
+        const auto fileHeader = stream.readValue<IndexFileHeader>();
+        if (std::memcmp(fileHeader.magic, kIndexMagic, sizeof(kIndexMagic)) != 0 || fileHeader.version != kCurrentIndexVersion)
         {
-            ro = stream.readValue<ObjectHeader>();
+            return std::nullopt;
         }
-        return entry;
-    }
 
-    static ObjectFolderState deserialiseFolderState(Stream& stream)
-    {
-        ObjectFolderState ofs{};
-        ofs.numObjects = stream.readValue<uint32_t>();
-        ofs.totalFileSize = stream.readValue<uint32_t>();
-        ofs.dateHash = stream.readValue<uint32_t>();
-
-        ofs.basePath = deserialiseString(stream);
-        return ofs;
-    }
-
-    static IndexHeader deserialiseHeader(Stream& stream)
-    {
         IndexHeader header{};
-        header.version = stream.readValue<uint32_t>();
-
-        header.state.vanillaInstall = deserialiseFolderState(stream);
-        header.state.install = deserialiseFolderState(stream);
-        header.state.customObjects = deserialiseFolderState(stream);
-
-        header.fileSize = stream.readValue<uint32_t>();
-        header.numObjects = stream.readValue<uint32_t>();
-        return header;
-    }
+        auto folderStates = std::array{ &header.state.vanillaInstall, &header.state.install, &header.state.customObjects };
+        if (fileHeader.numFolders != folderStates.size())
+        {
+            throw Exception::RuntimeError("Invalid object index folder count");
+        }
+
+        std::vector<IndexFolderRecord> folderStorage;
+        std::vector<IndexFileRecord> fileStorage;
+        std::vector<IndexEntryRecord> recordStorage;
+        std::vector<ObjectHeader> objectRefStorage;
+        std::vector<char> stringPoolStorage;
+        const auto folders = readIndexArray(stream, fileHeader.numFolders, folderStorage);
+        const auto files = readIndexArray(stream, fileHeader.numFiles, fileStorage);
+        const auto records = readIndexArray(stream, fileHeader.numEntries, recordStorage);
+        const auto objectRefs = readIndexArray(stream, fileHeader.numObjectRefs, objectRefStorage);
+        const auto stringPoolData = readIndexArray(stream, fileHeader.stringPoolSize, stringPoolStorage);
+        const auto stringPool = std::string_view(stringPoolData.data(), stringPoolData.size());
+
+        header.version = fileHeader.version;
+        header.fileSize = fileHeader.fileSize;
+        header.numObjects = fileHeader.numObjects;
+        for (size_t i = 0; i < folders.size(); i++)
+        {
+            const auto& record = folders[i];
+            auto& state = *folderStates[i];
+            state.numObjects = record.numObjects;
+            state.totalFileSize = record.totalFileSize;
+            state.dateHash = record.dateHash;
+            state.basePath = getIndexString(stringPool, record.basePath);
+            if (record.firstFile > files.size() || record.numFiles > files.size() - record.firstFile)
+            {
+                throw Exception::RuntimeError("Invalid object index file list");
+            }
+            state.files.reserve(record.numFiles);
+            for (const auto& file : files.subspan(record.firstFile, record.numFiles))
+            {
+                state.files.push_back({ std::string(getIndexString(stringPool, file.path)), file.fileSize, file.lastWrite });
+            }
+        }
 
-    static std::vector<ObjectIndexEntry> deserialiseIndex(Stream& stream)
-    {
-        std::vector<ObjectIndexEntry> entries;
-        entries.resize(stream.readValue<uint32_t>());
-        for (auto& entry : entries)
+        entries.clear();
+        entries.resize(records.size());
+        for (size_t i = 0; i < records.size(); i++)
         {
-            entry = deserialiseEntry(stream);
+            const auto& record = records[i];
+            auto& entry = entries[i];
+            entry._header = record.header;
+            entry._header2 = record.header2;
+            entry._displayData = record.displayData;
+            entry._filepath = getIndexString(stringPool, record.filepath);
+            entry._name = getIndexString(stringPool, record.name);
+            entry._requiredObjects = getIndexObjectRefs(objectRefs, record.firstRequiredObject, record.numRequiredObjects);
+            entry._alsoLoadObjects = getIndexObjectRefs(objectRefs, record.firstAlsoLoadObject, record.numAlsoLoadObjects);
         }
-        return entries;
+        return header;
     }
 
     static void saveIndex(const IndexHeader& header)
@@ -334,34 +474,6 @@ namespace OpenLoco::ObjectManager
         Logging::verbose("Saved object index in {} milliseconds.", saveTimer.elapsed());
     }
 
-    static ObjectIndexEntry createPartialNewEntry(const ObjectHeader& objHeader, const fs::path filepath)
-    {
-        ObjectIndexEntry entry{};
-
-        // Header
-        entry._header = objHeader;
-
-        // Filepath
-        entry._filepath = filepath.u8string();
-
-        // Header2 NULL
-        entry._header2.decodedFileSize = std::numeric_limits<uint32_t>::max();
-
-        // Name NULL
-        entry._name = "";
-
-        // Header3 NULL
-        entry._displayData = ObjectHeader3{};
-
-        // ObjectList1
-        entry._alsoLoadObjects.clear();
-
-        // ObjectList2
-        entry._requiredObjects.clear();
-
-        return entry;
-    }
-
     static ObjectIndexEntry createNewEntry(const ObjectHeader& objHeader, const fs::path filepath, const TempLoadMetaData& metaData)
     {
         ObjectIndexEntry entry{};
@@ -390,35 +502,38 @@ namespace OpenLoco::ObjectManager
         return entry;
     }
 
-    // Adds a new object to the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
-    static void addObjectToIndex(const fs::path filepath)
+    // Object files are read and checksummed on worker threads a batch at a time, loading them to fill in
+    // their entries has to happen on the main thread.
+    static constexpr size_t kObjectReadBatchSize = 256;
+
+    struct ObjectFileResult
     {
-        ObjectHeader objHeader{};
-        try
-        {
-            FileStream stream;
-            stream.open(filepath, StreamMode::read);
-            if (!stream.isOpen())
+        std::optional<ObjectFile> file;
+        std::string error;
+    };
+
+    static void readObjectFiles(std::span<const fs::path> paths, std::span<ObjectFileResult> results)
+    {
+        Core::JobSystem::get().parallelFor("Read object files", paths.size(), 1, [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; i++)
             {
-                Logging::error("Unable to open object index file.");
-                return;
+                try
+                {
+                    results[i].file = readObjectFile(paths[i]);
+                }
+                catch (const std::exception& ex)
+                {
+                    results[i].error = ex.what();
+                }
             }
-            objHeader = stream.readValue<ObjectHeader>();
-        }
-        catch (const std::runtime_error& ex)
-        {
-            Logging::error("Unable to read object index header: {}", ex.what());
-            return;
-        }
-
-        const auto partialNewEntry = createPartialNewEntry(objHeader, filepath);
-        _installedObjectList.push_back(partialNewEntry);
-
-        _isPartialLoaded = true;
-        const auto loadResult = loadTemporaryObject(objHeader);
-        _isPartialLoaded = false;
-        _installedObjectList.pop_back();
+        });
+    }
 
+    // Adds a new object to the index by loading it to create its full index entry
+    static void addObjectToIndex(const fs::path& filepath, const ObjectFile& file)
+    {
+        const auto& objHeader = file.header;
+        const auto loadResult = loadTemporaryObject(file);
         if (!loadResult.has_value())
         {
             Logging::error("Unable to load the object '{}', can't add to index", objHeader.getName());
@@ -440,35 +555,55 @@ namespace OpenLoco::ObjectManager
         _installedObjectList.push_back(newEntry); // Previously ordered by name...
     }
 
-    static void addObjectsInFolder(fs::path path, bool shouldRecurse, uint32_t numObjects)
+    // Files are added in order, a file holding an object that is already in the index is skipped
+    static void addObjectFiles(std::span<const fs::path> paths)
     {
         uint8_t progress = 0; // Progress is used for the ProgressBar Ui element
         uint32_t i = 0;
-        iterateObjectFolder(path, shouldRecurse, [&i, &numObjects, &progress](const fs::directory_entry& file) {
-            Input::processMessagesMini();
-            i++;
+        std::vector<ObjectFileResult> results;
+        for (size_t batchStart = 0; batchStart < paths.size(); batchStart += kObjectReadBatchSize)
+        {
+            const auto batch = paths.subspan(batchStart, std::min(kObjectReadBatchSize, paths.size() - batchStart));
+            results.clear();
+            results.resize(batch.size());
+            readObjectFiles(batch, results);
 
-            // Cheap calculation of (curObjectCount / totalObjectCount) * 256
-            const auto newProgress = (i << 8) / ((numObjects & 0xFFFFFF) + 1);
-            if (progress != newProgress)
+            for (size_t j = 0; j < batch.size(); j++)
             {
-                progress = newProgress;
-                Ui::ProgressBar::setProgress(newProgress);
-            }
+                Input::processMessagesMini();
+                i++;
 
-            // For now there are a few places that assume there are int16_t max items
-            if (_installedObjectList.size() >= static_cast<size_t>(std::numeric_limits<ObjectIndexId>::max()))
-            {
-                return false;
+                // Cheap calculation of (curObjectCount / totalObjectCount) * 256
+                const auto newProgress = (i << 8) / ((paths.size() & 0xFFFFFF) + 1);
+                if (progress != newProgress)
+                {
+                    progress = newProgress;
+                    Ui::ProgressBar::setProgress(newProgress);
+                }
+
+                // For now there are a few places that assume there are int16_t max items
+                if (_installedObjectList.size() >= static_cast<size_t>(std::numeric_limits<ObjectIndexId>::max()))
+                {
+                    return;
+                }
+
+                auto& result = results[j];
+                if (!result.file.has_value())
+                {
+                    Logging::error("Unable to read object file '{}', can't add to index: {}", batch[j].u8string(), result.error);
+                    continue;
+                }
+                addObjectToIndex(batch[j], *result.file);
+                result.file.reset();
             }
-            addObjectToIndex(file.path());
-            return true;
-        });
+        }
     }
 
     // 0x0047118B
     static void createIndex(const ObjectFoldersState& currentState)
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("ObjectIndexCreate", "objects");
+
         Input::processMessagesMini();
         const auto progressString = _isFirstTime ? StringIds::starting_for_the_first_time : StringIds::checking_object_files;
         Ui::ProgressBar::begin(progressString);
@@ -480,12 +615,15 @@ namespace OpenLoco::ObjectManager
         // Create new index by iterating all DAT files and processing
         IndexHeader header{};
         header.version = kCurrentIndexVersion;
-        const auto vanillaObjectPath = Environment::getPathNoWarning(Environment::PathId::vanillaObjects);
-        addObjectsInFolder(vanillaObjectPath, false, currentState.vanillaInstall.numObjects);
-        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
-        addObjectsInFolder(objectPath, true, currentState.install.numObjects);
-        const auto customObjectPath = Environment::getPathNoWarning(Environment::PathId::customObjects);
-        addObjectsInFolder(customObjectPath, true, currentState.customObjects.numObjects);
+        for (const auto* folder : currentState.folders())
+        {
+            std::vector<fs::path> paths;
+            for (const auto& file : folder->files)
+            {
+                paths.push_back(fs::u8path(file.path));
+            }
+            addObjectFiles(paths);
+        }
         std::ranges::sort(_installedObjectList, {}, [](const auto& entry) { return entry._name; });
 
         // New index creation completed. Reset and save result.
@@ -498,6 +636,84 @@ namespace OpenLoco::ObjectManager
         Ui::ProgressBar::end();
     }
 
+    // Brings a loaded index up to date with the object folders. Only the files that were added or changed
+    // since the index was saved are indexed again and the entries of removed files are dropped.
+    static void updateIndex(const ObjectFoldersState& indexedState, const ObjectFoldersState& currentState)
+    {
+        Diagnostics::Tracing::ScopedEvent traceEvent("ObjectIndexUpdate", "objects");
+
+        Core::Timer updateTimer;
+
+        std::unordered_map<std::string_view, const ObjectFileRecord*> indexedFiles;
+        for (const auto* folder : indexedState.folders())
+        {
+            for (const auto& file : folder->files)
+            {
+                indexedFiles.emplace(file.path, &file);
+            }
+        }
+
+        std::unordered_set<std::string_view> unchangedFiles;
+        for (const auto* folder : currentState.folders())
+        {
+            for (const auto& file : folder->files)
+            {
+                const auto it = indexedFiles.find(file.path);
+                if (it != indexedFiles.end() && *it->second == file)
+                {
+                    unchangedFiles.insert(file.path);
+                }
+            }
+        }
+
+        const auto numEntries = _installedObjectList.size();
+        std::erase_if(_installedObjectList, [&unchangedFiles](const ObjectIndexEntry& entry) {
+            return !unchangedFiles.contains(entry._filepath);
+        });
+        const auto numDropped = numEntries - _installedObjectList.size();
+
+        // Unchanged files without an entry were skipped before, e.g. as the duplicate of another object.
+        // They get another go when entries were dropped as the object they clashed with may be gone.
+        std::unordered_set<std::string_view> indexedPaths;
+        for (const auto& entry : _installedObjectList)
+        {
+            indexedPaths.insert(entry._filepath);
+        }
+        std::vector<fs::path> paths;
+        for (const auto* folder : currentState.folders())
+        {
+            for (const auto& file : folder->files)
+            {
+                const auto isUnchanged = unchangedFiles.contains(file.path);
+                if (!isUnchanged || (numDropped != 0 && !indexedPaths.contains(file.path)))
+                {
+                    paths.push_back(fs::u8path(file.path));
+                }
+            }
+        }
+        // Entries are added below, the views into them must not be used past this point
+        indexedPaths.clear();
+
+        if (!paths.empty())
+        {
+            Input::processMessagesMini();
+            Ui::ProgressBar::begin(StringIds::checking_object_files);
+            reloadAll();
+            addObjectFiles(paths);
+            std::ranges::sort(_installedObjectList, {}, [](const auto& entry) { return entry._name; });
+            Ui::ProgressBar::end();
+        }
+
+        IndexHeader header{};
+        header.version = kCurrentIndexVersion;
+        header.fileSize = 0;
+        header.numObjects = _installedObjectList.size();
+        header.state = currentState;
+        saveIndex(header);
+
+        Logging::verbose("Updated object index, {} files indexed and {} entries dropped in {} milliseconds.", paths.size(), numDropped, updateTimer.elapsed());
+    }
+
     static bool tryLoadIndex(const ObjectFoldersState& currentState)
     {
         Core::Timer loadTimer;
@@ -509,44 +725,138 @@ namespace OpenLoco::ObjectManager
             return false;
         }
         FileStream stream;
-        stream.open(indexPath, StreamMode::read);
+        stream.open(indexPath, StreamMode::readMapped);
         if (!stream.isOpen())
         {
             Logging::error("Unable to load the object index.");
             return false;
         }
 
+        IndexHeader header{};
         try
         {
-            auto header = deserialiseHeader(stream);
-            if (header.version != kCurrentIndexVersion || header.state != currentState)
+            auto loadedHeader = deserialiseIndex(stream, _installedObjectList);
+            if (!loadedHeader.has_value() || _installedObjectList.empty())
             {
                 return false;
             }
-            else
-            {
-                _installedObjectList = deserialiseIndex(stream);
-                if (_installedObjectList.empty())
-                {
-                    return false;
-                }
-                Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
-            }
+            header = std::move(*loadedHeader);
+            Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
         }
         catch (const std::runtime_error& ex)
         {
             Logging::error("Unable to load the object index: {}", ex.what());
             return false;
         }
+        // The index file gets rewritten if it has to be updated
+        stream.close();
+
+        if (header.state != currentState)
+        {
+            updateIndex(header.state, currentState);
+        }
 
         reloadAll();
 
         return true;
     }
 
+    static std::string toSearchKey(std::string_view str)
+    {
+        std::string key(str);
+        std::ranges::transform(key, key.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+        return key;
+    }
+
+    static uint32_t getTrigram(std::string_view key, size_t offset)
+    {
+        return static_cast<uint8_t>(key[offset]) | (static_cast<uint8_t>(key[offset + 1]) << 8) | (static_cast<uint8_t>(key[offset + 2]) << 16);
+    }
+
+    static uint64_t getHeaderKey(const ObjectHeader& header)
+    {
+        uint64_t name;
+        std::memcpy(&name, header.name, sizeof(name));
+        return name ^ (static_cast<uint64_t>(header.getType()) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    static void buildSearchIndex()
+    {
+        Diagnostics::Tracing::ScopedEvent traceEvent("ObjectIndexBuildSearch", "objects");
+
+        _searchIndex = ObjectSearchIndex{};
+        _searchIndex.keys.reserve(_installedObjectList.size());
+
+        for (ObjectIndexId i = 0; i < static_cast<int16_t>(_installedObjectList.size()); i++)
+        {
+            const auto& entry = _installedObjectList[i];
+            _searchIndex.objectsByType[enumValue(entry._header.getType())].push_back(i);
+            _searchIndex.headers[getHeaderKey(entry._header)].push_back(i);
+
+            const auto filename = fs::u8path(entry._filepath).filename().u8string();
+            auto& key = _searchIndex.keys.emplace_back(toSearchKey(entry._name) + '\n' + toSearchKey(filename));
+
+            for (size_t j = 0; j + 3 <= key.size(); j++)
+            {
+                auto& list = _searchIndex.trigrams[getTrigram(key, j)];
+                // Repeated trigrams of one key would otherwise be listed more than once
+                if (list.empty() || list.back() != i)
+                {
+                    list.push_back(i);
+                }
+            }
+        }
+    }
+
+    static void buildVerifiedFiles(const ObjectFoldersState& state)
+    {
+        std::unordered_set<std::string_view> indexedPaths;
+        for (const auto& entry : _installedObjectList)
+        {
+            indexedPaths.insert(entry._filepath);
+        }
+
+        _verifiedFiles.clear();
+        for (const auto* folder : state.folders())
+        {
+            for (const auto& file : folder->files)
+            {
+                if (indexedPaths.contains(file.path))
+                {
+                    _verifiedFiles.emplace(file.path, file);
+                }
+            }
+        }
+    }
+
+    bool isObjectFileVerified(std::string_view filepath)
+    {
+        const auto it = _verifiedFiles.find(std::string(filepath));
+        if (it == _verifiedFiles.end())
+        {
+            return false;
+        }
+
+        std::error_code ec;
+        const auto path = fs::u8path(filepath);
+        const auto fileSize = fs::file_size(path, ec);
+        if (ec)
+        {
+            return false;
+        }
+        const auto lastWrite = fs::last_write_time(path, ec);
+        if (ec)
+        {
+            return false;
+        }
+        return fileSize == it->second.fileSize && static_cast<int64_t>(lastWrite.time_since_epoch().count()) == it->second.lastWrite;
+    }
+
     // 0x00470F3C
     void loadIndex()
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("ObjectIndexLoad", "objects");
+
         // 0x00112A138 -> 144
         const auto vanillaObjectPath = Environment::getPathNoWarning(Environment::PathId::vanillaObjects);
         const auto vanillaState = getCurrentObjectFolderState(vanillaObjectPath, false);
@@ -557,12 +867,16 @@ namespace OpenLoco::ObjectManager
 
         const auto currentState = ObjectFoldersState{ vanillaState, objectState, customState };
 
+        // The lookups refer to entries by position, they are rebuilt once the index is complete
+        _searchIndex = ObjectSearchIndex{};
         if (!tryLoadIndex(currentState))
         {
             createIndex(currentState);
         }
 
         _customObjectsInIndex = hasCustomObjectsInIndex();
+        buildSearchIndex();
+        buildVerifiedFiles(currentState);
     }
 
     uint32_t getNumInstalledObjects()
@@ -570,29 +884,80 @@ namespace OpenLoco::ObjectManager
         return _installedObjectList.size();
     }
 
+    uint32_t getNumInstalledObjects(ObjectType type)
+    {
+        return _searchIndex.objectsByType[enumValue(type)].size();
+    }
+
     std::vector<ObjIndexPair> getAvailableObjects(ObjectType type)
     {
         std::vector<ObjIndexPair> list;
 
-        for (ObjectIndexId i = 0; i < static_cast<int16_t>(_installedObjectList.size()); i++)
+        const auto& objects = _searchIndex.objectsByType[enumValue(type)];
+        list.reserve(objects.size());
+        for (const auto i : objects)
+        {
+            list.push_back(ObjIndexPair{ i, _installedObjectList[i] });
+        }
+
+        return list;
+    }
+
+    std::vector<ObjectIndexId> findObjectsByName(ObjectType type, std::string_view pattern)
+    {
+        const auto& objects = _searchIndex.objectsByType[enumValue(type)];
+        const auto lowerPattern = toSearchKey(pattern);
+
+        // Only the objects sharing the rarest trigram of the pattern can possibly contain it
+        const std::vector<ObjectIndexId>* candidates = &objects;
+        if (lowerPattern.size() >= 3)
         {
-            if (_installedObjectList[i]._header.getType() == type)
+            for (size_t i = 0; i + 3 <= lowerPattern.size(); i++)
             {
-                list.push_back(ObjIndexPair{ i, _installedObjectList[i] });
+                const auto it = _searchIndex.trigrams.find(getTrigram(lowerPattern, i));
+                if (it == _searchIndex.trigrams.end())
+                {
+                    return {};
+                }
+                if (it->second.size() < candidates->size())
+                {
+                    candidates = &it->second;
+                }
             }
         }
 
-        return list;
+        std::vector<ObjectIndexId> matches;
+        for (const auto i : *candidates)
+        {
+            if (_installedObjectList[i]._header.getType() != type)
+            {
+                continue;
+            }
+            if (_searchIndex.keys[i].find(lowerPattern) != std::string::npos)
+            {
+                matches.push_back(i);
+            }
+        }
+        return matches;
     }
 
+    // Finds the first object in index order that matches the header
     static std::optional<ObjIndexPair> internalFindObjectInIndex(const ObjectHeader& objectHeader)
     {
-        auto res = std::ranges::find(_installedObjectList, objectHeader, &ObjectIndexEntry::_header);
-        if (res == std::end(_installedObjectList))
+        const auto it = _searchIndex.headers.find(getHeaderKey(objectHeader));
+        if (it == _searchIndex.headers.end())
         {
             return std::nullopt;
         }
-        return ObjIndexPair{ static_cast<ObjectIndexId>(std::distance(std::begin(_installedObjectList), res)), *res };
+        for (const auto i : it->second)
+        {
+            const auto& entry = _installedObjectList[i];
+            if (entry._header == objectHeader)
+            {
+                return ObjIndexPair{ i, entry };
+            }
+        }
+        return std::nullopt;
     }
 
     std::optional<ObjectIndexEntry> findObjectInIndex(const ObjectHeader& objectHeader)
@@ -7,6 +7,7 @@
 #include <optional>
 #include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace OpenLoco::ObjectManager
@@ -46,11 +47,16 @@ namespace OpenLoco::ObjectManager
     };
 
     uint32_t getNumInstalledObjects();
+    uint32_t getNumInstalledObjects(ObjectType type);
 
     void loadIndex();
 
     std::vector<ObjIndexPair> getAvailableObjects(ObjectType type);
+    // Objects of the type whose name or file name contains the pattern, ignoring case, in index order.
+    std::vector<ObjectIndexId> findObjectsByName(ObjectType type, std::string_view pattern);
     bool isObjectInstalled(const ObjectHeader& objectHeader);
+    // Whether the object file is unchanged since its checksum was verified when it was indexed.
+    bool isObjectFileVerified(std::string_view filepath);
     std::optional<ObjectIndexEntry> findObjectInIndex(const ObjectHeader& objectHeader);
     const ObjectIndexEntry& getObjectInIndex(ObjectIndexId index);
     ObjIndexPair getActiveObject(ObjectType objectType, std::span<SelectedObjectsFlags> objectIndexFlags);
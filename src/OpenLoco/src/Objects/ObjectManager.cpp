@@ -9,6 +9,7 @@
 #include "CurrencyObject.h"
 #include "Date.h"
 #include "DockObject.h"
+#include "Economy/Economy.h"
 #include "Environment.h"
 #include "GameState.h"
 #include "Graphics/Colour.h"
@@ -25,10 +26,14 @@
 #include "Localisation/Formatting.h"
 #include "Localisation/StringIds.h"
 #include "Logging.h"
+#include "MemoryAccounting.h"
 #include "MessageManager.h"
 #include "ObjectImageTable.h"
 #include "ObjectIndex.h"
 #include "ObjectStringTable.h"
+#include "Paint/PaintBuilding.h"
+#include "Paint/PaintIndustry.h"
+#include "Paint/PaintTileCache.h"
 #include "RegionObject.h"
 #include "RoadExtraObject.h"
 #include "RoadObject.h"
@@ -51,6 +56,7 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "VehicleObject.h"
+#include "Vehicles/VehicleDraw.h"
 #include "Vehicles/VehicleManager.h"
 #include "WallObject.h"
 #include "WaterObject.h"
@@ -61,7 +67,10 @@
 #include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Core/Traits.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <cstring>
 #include <vector>
 
 using namespace OpenLoco::Interop;
@@ -99,6 +108,7 @@ namespace OpenLoco::ObjectManager
     static bool _isTemporaryObject = false;
     // 0x0050D15C
     static Object* _temporaryObject = nullptr;
+    static size_t _temporaryObjectSize = 0;
 
     static ObjectRepositoryItem& getRepositoryItem(ObjectType type)
     {
@@ -305,6 +315,11 @@ namespace OpenLoco::ObjectManager
 
     static void callObjectUnload(const ObjectType type, Object& obj)
     {
+        if (type == ObjectType::cargo)
+        {
+            // A new cargo object can be loaded at the same address
+            Economy::invalidateCargoUnitPayments();
+        }
         return visitObject(type, obj, [](auto&& obj) {
             return obj->unload();
         });
@@ -312,14 +327,44 @@ namespace OpenLoco::ObjectManager
 
     static void callObjectLoad(const LoadedObjectHandle& handle, Object& obj, std::span<const std::byte> data, DependentObjects* dependencies = nullptr)
     {
-        return visitObject(handle.type, obj, [&](auto&& obj) {
+        visitObject(handle.type, obj, [&](auto&& obj) {
             return obj->load(handle, data, dependencies);
         });
+        // Image indices change whenever an object is (re)loaded, temporary objects are not painted
+        if (handle.type == ObjectType::vehicle && getAny(handle) == &obj)
+        {
+            buildBodyImageTable(handle.id);
+        }
+        else if (handle.type == ObjectType::building && getAny(handle) == &obj)
+        {
+            Paint::buildBuildingPaintSequences(handle.id);
+        }
+        else if (handle.type == ObjectType::industry && getAny(handle) == &obj)
+        {
+            Paint::buildIndustryPaintSequences(handle.id);
+        }
+        else if (handle.type == ObjectType::airport && getAny(handle) == &obj)
+        {
+            buildAirportMovementGraph(handle.id);
+        }
+    }
+
+    // Image data is part of the object data, it is reported separately as object images.
+    static size_t getObjectDataMemoryUsage()
+    {
+        size_t size = 0;
+        forEachLoadedObject([&size](const LoadedObjectHandle& handle) {
+            size += getByteLength(handle);
+        });
+        return size - std::min(size, getImageTableStats().imageDataSize);
     }
 
     // 0x0047237D
     void reloadAll()
     {
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::objectData, getObjectDataMemoryUsage);
+        MemoryAccounting::registerProvider(MemoryAccounting::Category::objectImages, getImageTableMemoryUsage);
+
         Core::Timer reloadTimer;
         size_t loadedObjects{};
 
@@ -332,14 +377,47 @@ namespace OpenLoco::ObjectManager
             loadedObjects++;
         });
 
+        Paint::PaintTileCache::clear();
+
         Logging::verbose("Loaded {} objects in {} milliseconds.", loadedObjects, reloadTimer.elapsed());
+
+        const auto imageStats = getImageTableStats();
+        Logging::verbose("Object images: {} tables, {} of {} images loaded, {} bytes of image data.", imageStats.numTables, imageStats.numLoadedImages, imageStats.numImages, imageStats.imageDataSize);
     }
 
     // 0x00472754
     static uint32_t computeChecksum(std::span<const std::byte> data, uint32_t seed)
     {
+        // Rotating distributes over xor, so each byte ends up rotated by 11 times the number of bytes after it,
+        // and 32 rotations of 11 add up to a full turn. Bytes 32 apart are therefore rotated by the same amount,
+        // which lets whole blocks of 32 bytes be xored together first and only the result be rotated.
+        constexpr size_t kBlockSize = 32;
+        constexpr size_t kWordsPerBlock = kBlockSize / sizeof(uint64_t);
+        const auto numBlocks = data.size() / kBlockSize;
+
+        std::array<uint64_t, kWordsPerBlock> folded{};
+        for (size_t i = 0; i < numBlocks; i++)
+        {
+            std::array<uint64_t, kWordsPerBlock> block;
+            std::memcpy(block.data(), data.data() + i * kBlockSize, kBlockSize);
+            for (size_t j = 0; j < kWordsPerBlock; j++)
+            {
+                folded[j] ^= block[j];
+            }
+        }
+
         auto checksum = seed;
-        for (auto d : data)
+        if (numBlocks != 0)
+        {
+            std::array<uint8_t, kBlockSize> foldedBytes;
+            std::memcpy(foldedBytes.data(), folded.data(), kBlockSize);
+            for (size_t j = 0; j < kBlockSize; j++)
+            {
+                checksum ^= std::rotl(static_cast<uint32_t>(foldedBytes[j]), static_cast<int>((11 * (kBlockSize - j)) % 32));
+            }
+        }
+
+        for (auto d : data.subspan(numBlocks * kBlockSize))
         {
             checksum = std::rotl(checksum ^ static_cast<uint8_t>(d), 11);
         }
@@ -370,8 +448,10 @@ namespace OpenLoco::ObjectManager
     {
         if (_temporaryObject != nullptr)
         {
+            unloadImageTables(std::span(reinterpret_cast<const std::byte*>(_temporaryObject), _temporaryObjectSize));
             free(_temporaryObject);
             _temporaryObject = nullptr;
+            _temporaryObjectSize = 0;
         }
     }
 
@@ -382,6 +462,29 @@ namespace OpenLoco::ObjectManager
         ObjectHeader header;
     };
 
+    // Copies the object into Loco freeable memory (required for when load loads the object) and validates it.
+    static std::optional<PreLoadedObject> preLoadObject(const ObjectHeader& header, std::span<const std::byte> data)
+    {
+        PreLoadedObject preLoadObj{};
+        preLoadObj.header = header;
+        preLoadObj.object = reinterpret_cast<Object*>(malloc(data.size()));
+        if (preLoadObj.object == nullptr)
+        {
+            return std::nullopt;
+        }
+        std::copy(std::begin(data), std::end(data), reinterpret_cast<std::byte*>(preLoadObj.object));
+
+        preLoadObj.objectData = std::span<std::byte>(reinterpret_cast<std::byte*>(preLoadObj.object), data.size());
+
+        if (!callObjectValidate(preLoadObj.header.getType(), *preLoadObj.object))
+        {
+            free(preLoadObj.object);
+            return std::nullopt;
+        }
+
+        return preLoadObj;
+    }
+
     static std::optional<PreLoadedObject> findAndPreLoadObject(const ObjectHeader& header)
     {
         auto installedObject = findObjectInIndex(header);
@@ -392,11 +495,11 @@ namespace OpenLoco::ObjectManager
 
         const auto filePath = fs::u8path(installedObject->_filepath);
 
-        FileStream fs(filePath, StreamMode::read);
+        FileStream fs(filePath, StreamMode::readMapped);
         SawyerStreamReader stream(fs);
-        PreLoadedObject preLoadObj{};
-        stream.read(&preLoadObj.header, sizeof(preLoadObj.header));
-        if (preLoadObj.header != header)
+        ObjectHeader fileHeader{};
+        stream.read(&fileHeader, sizeof(fileHeader));
+        if (fileHeader != header)
         {
             // Something wrong has happened and installed object does not match index
             // Vanilla continued to search for subsequent matching installed headers.
@@ -416,48 +519,53 @@ namespace OpenLoco::ObjectManager
             Logging::error("Data could not be read!");
             return std::nullopt;
         }
-        if (!computeObjectChecksum(preLoadObj.header, data))
+        // The checksum was verified when the file was indexed
+        if (!isObjectFileVerified(installedObject->_filepath) && !computeObjectChecksum(fileHeader, data))
         {
             // Something wrong has happened and installed object checksum is broken
             Logging::error("Mismatch between installed object header checksum and object file checksum!");
             return std::nullopt;
         }
 
-        // Copy the object into Loco freeable memory (required for when load loads the object)
-        preLoadObj.object = reinterpret_cast<Object*>(malloc(data.size()));
-        if (preLoadObj.object == nullptr)
+        auto preLoadObj = preLoadObject(fileHeader, data);
+        if (!preLoadObj.has_value())
         {
-            return std::nullopt;
+            // Object failed validation
+            Logging::error("Object {} in index failed validation! (This should not be possible)", header.getName());
         }
-        std::copy(std::begin(data), std::end(data), reinterpret_cast<std::byte*>(preLoadObj.object));
+        return preLoadObj;
+    }
 
-        preLoadObj.objectData = std::span<std::byte>(reinterpret_cast<std::byte*>(preLoadObj.object), data.size());
+    ObjectFile readObjectFile(const fs::path& filePath)
+    {
+        FileStream fs(filePath, StreamMode::readMapped);
+        SawyerStreamReader stream(fs);
 
-        if (!callObjectValidate(preLoadObj.header.getType(), *preLoadObj.object))
+        ObjectFile file{};
+        stream.read(&file.header, sizeof(file.header));
+        const auto data = stream.readChunk();
+        if (!computeObjectChecksum(file.header, data))
         {
-            free(preLoadObj.object);
-            // Object failed validation
-            Logging::error("Object {} in index failed validation! (This should not be possible)", header.getName());
-            return std::nullopt;
+            throw Exception::RuntimeError("Object file checksum does not match its header");
         }
-
-        return preLoadObj;
+        file.data.assign(data.begin(), data.end());
+        return file;
     }
 
-    // 0x0047176D
     // TODO: Return a std::unique_ptr and a ObjectHeader3 & ObjectHeader2 for the metadata
-    std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header)
+    static std::optional<TempLoadMetaData> loadPreLoadedTemporaryObject(std::optional<PreLoadedObject> preLoadObj)
     {
-        auto preLoadObj = findAndPreLoadObject(header);
         if (!preLoadObj.has_value())
         {
             return std::nullopt;
         }
+        const auto& header = preLoadObj->header;
 
         const uint32_t oldNumImages = getTotalNumImages();
         setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
 
         _temporaryObject = preLoadObj->object;
+        _temporaryObjectSize = preLoadObj->objectData.size();
         _isPartialLoaded = true;
         _isTemporaryObject = true;
 
@@ -500,6 +608,17 @@ namespace OpenLoco::ObjectManager
         return result;
     }
 
+    // 0x0047176D
+    std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header)
+    {
+        return loadPreLoadedTemporaryObject(findAndPreLoadObject(header));
+    }
+
+    std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectFile& file)
+    {
+        return loadPreLoadedTemporaryObject(preLoadObject(file.header, file.data));
+    }
+
     Object* getTemporaryObject()
     {
         return _temporaryObject;
@@ -536,6 +655,7 @@ namespace OpenLoco::ObjectManager
         if (!_isPartialLoaded)
         {
             callObjectLoad({ preLoadObj->header.getType(), id }, *preLoadObj->object, preLoadObj->objectData);
+            Paint::PaintTileCache::clear();
         }
 
         return true;
@@ -554,6 +674,15 @@ namespace OpenLoco::ObjectManager
     }
 
     // 0x00471FF8
+    static void unloadAndFree(const LoadedObjectHandle& handle)
+    {
+        unload(handle);
+        auto* obj = _objectRepository[enumValue(handle.type)].objects[handle.id];
+        unloadImageTables(std::span(reinterpret_cast<const std::byte*>(obj), getByteLength(handle)));
+        free(obj);
+        _objectRepository[enumValue(handle.type)].objects[handle.id] = reinterpret_cast<Object*>(-1);
+    }
+
     void unload(const ObjectHeader& header)
     {
         auto handle = findObjectHandle(header);
@@ -561,9 +690,7 @@ namespace OpenLoco::ObjectManager
         {
             return;
         }
-        unload(*handle);
-        free(_objectRepository[enumValue(handle->type)].objects[handle->id]);
-        _objectRepository[enumValue(handle->type)].objects[handle->id] = reinterpret_cast<Object*>(-1);
+        unloadAndFree(*handle);
     }
 
     // 0x00471BCE
@@ -593,18 +720,49 @@ namespace OpenLoco::ObjectManager
         return kNullObjectId;
     }
 
-    LoadObjectsResult loadAll(std::span<ObjectHeader> objects)
+    // Unloads every object that is not already at its index in objects, returns which indices are kept.
+    static std::vector<bool> unloadAllExcept(std::span<const ObjectHeader> objects)
+    {
+        std::vector<bool> isKept(objects.size());
+        LoadedObjectIndex index = 0;
+        for (size_t type = 0; type < kMaxObjectTypes; type++)
+        {
+            const auto objectType = static_cast<ObjectType>(type);
+            for (LoadedObjectId id = 0; id < getMaxObjects(objectType); id++, index++)
+            {
+                const LoadedObjectHandle handle{ objectType, id };
+                if (getAny(handle) == nullptr)
+                {
+                    continue;
+                }
+                if (!_isPartialLoaded && index < objects.size() && getHeader(handle) == objects[index])
+                {
+                    isKept[index] = true;
+                    continue;
+                }
+                unloadAndFree(handle);
+            }
+        }
+        // Assigns the image ranges from the start again, as unloadAll does
+        reloadAll();
+        return isKept;
+    }
+
+    LoadObjectsResult loadAll(std::span<const ObjectHeader> objects)
     {
         LoadObjectsResult result;
         result.success = true;
 
-        unloadAll();
+        // Objects that are already loaded at the same index are not read from disk again, so
+        // loading a save that shares its objects with the last one (like the title sequence
+        // starting over) skips most of the object loading. Identical headers include the checksum.
+        const auto isKept = unloadAllExcept(objects);
 
         LoadedObjectIndex index = 0;
         for (const auto& header : objects)
         {
             auto id = getObjectId(index);
-            if (!header.isEmpty() && !load(header, id))
+            if (!header.isEmpty() && !isKept[index] && !load(header, id))
             {
                 result.success = false;
                 result.problemObjects.push_back(header);
@@ -791,33 +949,35 @@ namespace OpenLoco::ObjectManager
         }
     }
 
-    // 0x00472633
-    // 0x004722FF
-    void writePackedObjects(SawyerStreamWriter& fs, const std::vector<ObjectHeader>& packedObjects)
+    std::span<const std::byte> getPackedObjectData(const ObjectHeader& header)
     {
         // TODO at some point, change this to just pack the object file directly from
         //      disc rather than using the in-memory version. This then avoids having
         //      to unload the object temporarily to save the S5.
-        for (const auto& header : packedObjects)
+        auto handle = ObjectManager::findObjectHandle(header);
+        if (!handle)
         {
-            auto handle = ObjectManager::findObjectHandle(header);
-            if (handle)
-            {
-                // Unload the object so that the object data is restored to
-                // its original file state
-                ObjectManager::unload(*handle);
+            throw Exception::RuntimeError("Unable to pack object: object not loaded");
+        }
 
-                auto encodingType = getBestEncodingForObjectType(header.getType());
-                auto obj = ObjectManager::getAny(*handle);
-                auto objSize = ObjectManager::getByteLength(*handle);
+        // Unload the object so that the object data is restored to
+        // its original file state
+        ObjectManager::unload(*handle);
 
-                fs.write(header);
-                fs.writeChunk(encodingType, obj, objSize);
-            }
-            else
-            {
-                throw Exception::RuntimeError("Unable to pack object: object not loaded");
-            }
+        auto obj = ObjectManager::getAny(*handle);
+        auto objSize = ObjectManager::getByteLength(*handle);
+        return std::span(reinterpret_cast<const std::byte*>(obj), objSize);
+    }
+
+    // 0x00472633
+    // 0x004722FF
+    void writePackedObjects(SawyerStreamWriter& fs, const std::vector<ObjectHeader>& packedObjects)
+    {
+        for (const auto& header : packedObjects)
+        {
+            auto data = getPackedObjectData(header);
+            fs.write(header);
+            fs.writeChunk(getBestEncodingForObjectType(header.getType()), data.data(), data.size());
         }
     }
 
@@ -834,6 +994,7 @@ namespace OpenLoco::ObjectManager
         if (obj != nullptr)
         {
             callObjectUnload(handle.type, *obj);
+            Paint::PaintTileCache::clear();
         }
         else
         {
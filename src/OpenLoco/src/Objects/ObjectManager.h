@@ -2,6 +2,7 @@
 
 #include "Engine/Limits.h"
 #include "Object.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <optional>
 #include <span>
@@ -161,8 +162,21 @@ namespace OpenLoco::ObjectManager
         DependentObjects dependentObjects;
     };
 
+    // The header and decoded data of an object file
+    struct ObjectFile
+    {
+        ObjectHeader header;
+        std::vector<std::byte> data;
+    };
+
+    // Reads an object file and verifies its checksum, throws if it can't. Doesn't touch any
+    // object manager state so it is safe to call from worker threads.
+    ObjectFile readObjectFile(const fs::path& filePath);
+
     void freeTemporaryObject();
     std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header);
+    // Loads an object read by readObjectFile, the object does not have to be in the index.
+    std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectFile& file);
     Object* getTemporaryObject();
     bool isTemporaryObjectLoad();
 
@@ -174,8 +188,10 @@ namespace OpenLoco::ObjectManager
     ObjectHeader& getHeader(const LoadedObjectHandle& handle);
     std::vector<ObjectHeader> getHeaders();
 
-    LoadObjectsResult loadAll(std::span<ObjectHeader> objects);
+    LoadObjectsResult loadAll(std::span<const ObjectHeader> objects);
     void writePackedObjects(SawyerStreamWriter& fs, const std::vector<ObjectHeader>& packedObjects);
+    // Unloads the object so that its data is in the original file state, valid until the object is loaded again.
+    std::span<const std::byte> getPackedObjectData(const ObjectHeader& header);
 
     void unloadAll();
     // Only unloads the entry (clears entry for packing does not free)
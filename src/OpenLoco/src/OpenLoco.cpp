@@ -1,12 +1,18 @@
 #include "CommandLine.h"
 #include "Scenario.h"
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <csignal>
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <setjmp.h>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -33,11 +39,13 @@
 #include "Entities/EntityTweener.h"
 #include "Environment.h"
 #include "Game.h"
+#include "GameCommandLog.h"
 #include "GameCommands/GameCommands.h"
 #include "GameException.hpp"
 #include "GameState.h"
 #include "GameStateFlags.h"
 #include "Graphics/Colour.h"
+#include "Graphics/FPSCounter.h"
 #include "Graphics/Gfx.h"
 #include "Gui.h"
 #include "Input.h"
@@ -52,26 +60,34 @@
 #include "Map/AnimationManager.h"
 #include "Map/TileManager.h"
 #include "Map/WaveManager.h"
+#include "MemoryAccounting.h"
 #include "MessageManager.h"
 #include "MultiPlayer.h"
 #include "Network/Network.h"
 #include "Objects/ObjectIndex.h"
 #include "Objects/ObjectManager.h"
 #include "OpenLoco.h"
+#include "Paint/PaintBenchmark.h"
 #include "Random.h"
 #include "S5/S5.h"
 #include "ScenarioManager.h"
 #include "ScenarioOptions.h"
 #include "SceneManager.h"
+#include "StateHash.h"
+#include "StressWorld.h"
+#include "Telemetry.h"
+#include "TickProfiler.h"
 #include "Title.h"
 #include "Tutorial.h"
 #include "Ui.h"
 #include "Ui/ProgressBar.h"
+#include "Ui/Screenshot.h"
 #include "Ui/ToolTip.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
+#include "World/CompanyAi/CompanyAi.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
@@ -83,7 +99,11 @@
 #ifdef OPENLOCO_FORCE_64BIT
 #include "StructureLayoutLogger.h"
 #endif
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/JobSystem.h>
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Core/Timer.hpp>
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Crash.h>
 #include <OpenLoco/Platform/Platform.h>
@@ -108,10 +128,19 @@ namespace OpenLoco
     static uint16_t _time_since_last_tick = 0; // Was loco_global at 0x0050C19C
     static uint32_t _last_tick_time = 0; // Was loco_global at 0x0050C19E
 
+    // Used instead of the millisecond time with high resolution frame pacing. The fraction of a millisecond
+    // that was not counted is carried over to the next tick so the elapsed time does not drift.
+    static Timepoint _lastTickTimepoint{};
+    static double _tickTimeRemainder = 0.0;
+
     static int32_t _monthsSinceLastAutosave;
+    static std::future<bool> _autosaveTask;
 
     static void autosaveReset();
+    static void autosaveUpdate();
+    static void autosaveWait();
     static void tickLogic(int32_t count);
+    static void tickLogicForDuration(uint32_t budgetMs);
     static void tickLogic();
     static void dateTick();
 
@@ -132,9 +161,34 @@ namespace OpenLoco
         exitCleanly();
     }
 
+    // Writes the trace captured since startup when it was asked for on the command line.
+    static void writeCommandLineTrace(const CommandLineOptions& options)
+    {
+        if (options.tracePath.empty())
+        {
+            return;
+        }
+
+        Diagnostics::Tracing::stop();
+        const auto path = fs::u8path(options.tracePath);
+        if (Diagnostics::Tracing::writeChromeTrace(path))
+        {
+            Logging::info("Wrote trace to {}", path);
+        }
+        else
+        {
+            Logging::error("Unable to write trace to {}", path);
+        }
+    }
+
     // 0x004BE65E
     [[noreturn]] void exitCleanly()
     {
+        GameCommandLog::stopRecording();
+        if (Tutorial::state() == Tutorial::State::recording)
+        {
+            Tutorial::stop();
+        }
         Audio::close();
         Audio::disposeDSound();
         Ui::disposeCursors();
@@ -148,6 +202,8 @@ namespace OpenLoco
             fs::remove(tempFilePath);
         }
         CrashHandler::shutdown(_exHandler);
+        writeCommandLineTrace(getCommandLineOptions());
+        MemoryAccounting::logReport();
 
         // Logging should be the last before terminating.
         Logging::shutdown();
@@ -193,10 +249,50 @@ namespace OpenLoco
         autosaveReset();
     }
 
+    // A phase of initialise and how long it took, reported with --startup_profile.
+    struct StartupPhase
+    {
+        std::string_view name;
+        std::chrono::duration<double, std::milli> duration;
+    };
+    static std::vector<StartupPhase> _startupPhases;
+
+    template<typename TFunc>
+    static StartupPhase timeStartupPhase(std::string_view name, TFunc&& func)
+    {
+        Tracing::ScopedEvent event(name, "startup");
+        const auto begin = Clock::now();
+        func();
+        return StartupPhase{ name, Clock::now() - begin };
+    }
+
+    template<typename TFunc>
+    static void runStartupPhase(std::string_view name, TFunc&& func)
+    {
+        _startupPhases.push_back(timeStartupPhase(name, std::forward<TFunc>(func)));
+    }
+
+    static void logStartupProfile(std::chrono::duration<double, std::milli> total)
+    {
+        Logging::info("Startup took {:.1f} ms", total.count());
+        if (!getCommandLineOptions().startupProfile)
+        {
+            return;
+        }
+
+        // Phases running in the background overlap the others, so they can add up to more than the total.
+        for (const auto& phase : _startupPhases)
+        {
+            Logging::info("  {:<28} {:>9.1f} ms", phase.name, phase.duration.count());
+        }
+    }
+
     static void initialise()
     {
         Logging::info("INIT: Starting game initialization...");
-        
+        const auto startupBegin = Clock::now();
+        _startupPhases.clear();
+
         Logging::info("INIT: Getting platform time...");
         _last_tick_time = Platform::getTime();
         Logging::info("INIT: Platform time obtained successfully");
@@ -205,64 +301,74 @@ namespace OpenLoco
         std::srand(std::time(nullptr));
         Logging::info("INIT: Random number generator seeded");
 
-        Logging::info("INIT: Allocating map elements...");
-        World::TileManager::allocateMapElements();
-        Logging::info("INIT: Map elements allocated successfully");
-        
         Logging::info("INIT: Resolving environment paths...");
-        Environment::resolvePaths();
+        runStartupPhase("Resolve paths", Environment::resolvePaths);
         Logging::info("INIT: Environment paths resolved");
-        
+
+        // G1 is only read from disk until the graphics are initialised, so it is loaded in the
+        // background while the map is allocated and the language files are read.
+        Logging::info("INIT: Loading G1 graphics in the background...");
+        auto g1Loaded = std::async(std::launch::async, []() {
+            Tracing::setThreadName("Startup");
+            return timeStartupPhase("Load G1 (background)", Gfx::loadG1);
+        });
+
+        Logging::info("INIT: Allocating map elements...");
+        runStartupPhase("Allocate map elements", World::TileManager::allocateMapElements);
+        Logging::info("INIT: Map elements allocated successfully");
+
         Logging::info("INIT: Enumerating languages...");
-        Localisation::enumerateLanguages();
+        runStartupPhase("Enumerate languages", Localisation::enumerateLanguages);
         Logging::info("INIT: Languages enumerated successfully");
-        
+
         Logging::info("INIT: Loading language file...");
-        Localisation::loadLanguageFile();
+        runStartupPhase("Load language file", Localisation::loadLanguageFile);
         Logging::info("INIT: Language file loaded successfully");
-        
+
+        // Rethrows if loading failed, startup checks can exit so nothing may still be running
+        _startupPhases.push_back(g1Loaded.get());
+        Logging::info("INIT: G1 graphics loaded successfully");
+
         Logging::info("INIT: Running startup checks...");
-        startupChecks();
+        runStartupPhase("Startup checks", startupChecks);
         Logging::info("INIT: Startup checks completed");
 
-        Logging::info("INIT: Loading G1 graphics (CRITICAL - likely 64-bit crash point)...");
-        Gfx::loadG1();
-        Logging::info("INIT: G1 graphics loaded successfully");
-        
         Logging::info("INIT: Initializing graphics system...");
-        Gfx::initialise();
+        runStartupPhase("Initialise graphics", Gfx::initialise);
         Logging::info("INIT: Graphics system initialized");
 
         Logging::info("INIT: Initializing UI system...");
-        Ui::initialise();
+        runStartupPhase("Initialise UI", Ui::initialise);
         Logging::info("INIT: UI system initialized");
-        
+
         Logging::info("INIT: Initializing cursors...");
-        Ui::initialiseCursors();
+        runStartupPhase("Initialise cursors", Ui::initialiseCursors);
         Logging::info("INIT: Cursors initialized");
-        
+
         Logging::info("INIT: Initializing viewports...");
-        initialiseViewports();
+        runStartupPhase("Initialise viewports", initialiseViewports);
         Logging::info("INIT: Viewports initialized");
-        
+
         Logging::info("INIT: Initializing GUI...");
-        Gui::init();
+        runStartupPhase("Initialise GUI", Gui::init);
         Logging::info("INIT: GUI initialized");
 
         Logging::info("INIT: Resetting message manager...");
         MessageManager::reset();
         Logging::info("INIT: Message manager reset");
-        
+
         Logging::info("INIT: Resetting scenario...");
-        Scenario::reset();
+        runStartupPhase("Reset scenario", Scenario::reset);
         Logging::info("INIT: Scenario reset");
 
+        // The object and scenario indexes show a progress bar and load objects while they are
+        // built, so they stay on the main thread.
         Logging::info("INIT: Loading object index...");
-        ObjectManager::loadIndex();
+        runStartupPhase("Load object index", ObjectManager::loadIndex);
         Logging::info("INIT: Object index loaded");
-        
+
         Logging::info("INIT: Loading scenario index...");
-        ScenarioManager::loadIndex();
+        runStartupPhase("Load scenario index", []() { ScenarioManager::loadIndex(); });
         Logging::info("INIT: Scenario index loaded");
 
         Logging::info("INIT: Checking command line options...");
@@ -279,8 +385,10 @@ namespace OpenLoco
         }
 
         Logging::info("INIT: Starting title sequence...");
-        Title::start();
+        runStartupPhase("Start title sequence", Title::start);
         Logging::info("INIT: Game initialization completed successfully!");
+
+        logStartupProfile(Clock::now() - startupBegin);
     }
 
     static void loadFile(const fs::path& path)
@@ -301,6 +409,18 @@ namespace OpenLoco
         loadFile(fs::u8path(path));
     }
 
+    static void startRecordingGameCommands(const fs::path& path)
+    {
+        try
+        {
+            GameCommandLog::startRecording(path);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to record game commands to {}: {}", path.u8string(), e.what());
+        }
+    }
+
     static void launchGameFromCmdLineOptions()
     {
         const auto& cmdLineOptions = getCommandLineOptions();
@@ -311,19 +431,36 @@ namespace OpenLoco
         }
         else if (cmdLineOptions.action == CommandLineAction::join)
         {
-            if (cmdLineOptions.port)
+            Network::joinServer(cmdLineOptions.address, cmdLineOptions.port.value_or(Network::kDefaultPort), cmdLineOptions.spectate);
+        }
+        else if (cmdLineOptions.action == CommandLineAction::relay)
+        {
+            Network::openRelay(cmdLineOptions.address, cmdLineOptions.upstreamPort.value_or(Network::kDefaultPort));
+        }
+        else if (!cmdLineOptions.path.empty())
+        {
+            try
             {
-                Network::joinServer(cmdLineOptions.address, *cmdLineOptions.port);
+                loadFile(cmdLineOptions.path);
             }
-            else
+            catch (const GameException i)
             {
-                Network::joinServer(cmdLineOptions.address);
+                // Loading a save ends the tick early, the recording starts from the loaded state
+                if (i == GameException::Interrupt && !cmdLineOptions.recordPath.empty())
+                {
+                    startRecordingGameCommands(fs::u8path(cmdLineOptions.recordPath));
+                }
+                if (i == GameException::Interrupt && !cmdLineOptions.recordInputPath.empty())
+                {
+                    Tutorial::startRecording(fs::u8path(cmdLineOptions.recordInputPath));
+                }
+                else if (i == GameException::Interrupt && !cmdLineOptions.playInputPath.empty())
+                {
+                    Tutorial::startPlayback(fs::u8path(cmdLineOptions.playInputPath));
+                }
+                throw;
             }
         }
-        else if (!cmdLineOptions.path.empty())
-        {
-            loadFile(cmdLineOptions.path);
-        }
     }
 
     void sub_431695(uint16_t var_F253A0)
@@ -349,14 +486,36 @@ namespace OpenLoco
         Logging::info("Tick interrupted");
     }
 
+    static void updateTimeSinceLastTick()
+    {
+        uint32_t time = Platform::getTime();
+        _time_since_last_tick = (uint16_t)std::min(time - _last_tick_time, 500U);
+        _last_tick_time = time;
+
+        if (!Config::get().highResolutionFramePacing)
+        {
+            _lastTickTimepoint = {};
+            return;
+        }
+
+        const auto now = Clock::now();
+        if (_lastTickTimepoint != Timepoint{})
+        {
+            const auto elapsed = std::chrono::duration<double, std::milli>(now - _lastTickTimepoint).count() + _tickTimeRemainder;
+            const auto wholeMs = std::min(std::floor(elapsed), 500.0);
+            _tickTimeRemainder = elapsed > 500.0 ? 0.0 : elapsed - wholeMs;
+            _time_since_last_tick = static_cast<uint16_t>(wholeMs);
+        }
+        _lastTickTimepoint = now;
+    }
+
     // 0x0046A794
     static void tick()
     {
+        Gfx::FramePhaseTimer frameTimer(Gfx::FramePhase::tick);
         try
         {
-            uint32_t time = Platform::getTime();
-            _time_since_last_tick = (uint16_t)std::min(time - _last_tick_time, 500U);
-            _last_tick_time = time;
+            updateTimeSinceLastTick();
 
             if (Tutorial::state() != Tutorial::State::none)
             {
@@ -365,6 +524,7 @@ namespace OpenLoco
 
             GameCommands::resetCommandNestLevel();
             Ui::update();
+            autosaveUpdate();
 
             {
                 // Original called 0x00440DEC here which handled legacy cmd line options
@@ -447,7 +607,14 @@ namespace OpenLoco
                         numUpdates = 4;
                     }
 
-                    tickLogic(numUpdates);
+                    if (SceneManager::getGameSpeed() == GameSpeed::Turbo && numUpdates != 0 && !SceneManager::isNetworked())
+                    {
+                        tickLogicForDuration(Engine::TurboTickBudgetMs);
+                    }
+                    else
+                    {
+                        tickLogic(numUpdates);
+                    }
 
                     getGameState().var_014A++;
                     if (SceneManager::isEditorMode())
@@ -469,6 +636,20 @@ namespace OpenLoco
         }
     }
 
+    static void handleCursorInput()
+    {
+        Gfx::FramePhaseTimer frameTimer(Gfx::FramePhase::tick);
+        try
+        {
+            GameCommands::resetCommandNestLevel();
+            Ui::handleCursorInput();
+        }
+        catch (GameException)
+        {
+            tickInterrupted();
+        }
+    }
+
     static void tickLogic(int32_t count)
     {
         for (int32_t i = 0; i < count; i++)
@@ -477,9 +658,31 @@ namespace OpenLoco
         }
     }
 
+    // Runs logic ticks until the budget is used up, always runs at least one.
+    // Stops early if the game speed is changed or the game gets paused by one of the ticks.
+    static void tickLogicForDuration(uint32_t budgetMs)
+    {
+        Core::Timer timer;
+        do
+        {
+            tickLogic();
+        } while (timer.elapsed() < budgetMs && SceneManager::getGameSpeed() == GameSpeed::Turbo && !SceneManager::isPaused());
+    }
+
     static int8_t _loadErrorCode = 0; // Was loco_global at 0x0050C197
     static StringId _loadErrorMessage = 0; // Was loco_global at 0x0050C198
 
+    // Set while running as a dedicated server, there is no graphics or ui to show anything with.
+    static bool _isDedicatedServer = false;
+    static std::atomic<bool> _isDedicatedServerRunning = false;
+
+    template<typename TFunc>
+    static void profileSubsystem(TickProfiler::Subsystem subsystem, TFunc&& func)
+    {
+        TickProfiler::ScopedTimer timer(subsystem);
+        func();
+    }
+
     // 0x0046ABCB
     static void tickLogic()
     {
@@ -488,29 +691,46 @@ namespace OpenLoco
             return;
         }
 
+        // Replayed commands were issued between the ticks so they run before the tick starts
+        GameCommandLog::replayCommandsForTick(ScenarioManager::getScenarioTicks() + 1);
+        GameCommandLog::TickScope tickScope;
+
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
         Network::processGameCommands(ScenarioManager::getScenarioTicks());
 
-        recordTickStartPrng();
-        World::TileManager::defragmentTilePeriodic();
-        addr<0x00F25374, uint8_t>() = Scenario::getOptions().madeAnyChanges;
-        dateTick();
-        World::TileManager::update();
-        World::WaveManager::update();
-        TownManager::update();
-        IndustryManager::update();
-        VehicleManager::update();
-        StationManager::update();
-        EffectsManager::update();
-        CompanyManager::update();
-        World::AnimationManager::update();
-        Audio::updateVehicleNoise();
-        Audio::updateAmbientNoise();
-        Title::update();
+        {
+            TickProfiler::ScopedTimer profileTotal(TickProfiler::Subsystem::total);
+
+            recordTickStartPrng();
+            profileSubsystem(TickProfiler::Subsystem::defragmentTiles, World::TileManager::defragmentTilePeriodic);
+            addr<0x00F25374, uint8_t>() = Scenario::getOptions().madeAnyChanges;
+            profileSubsystem(TickProfiler::Subsystem::dateTick, dateTick);
+            profileSubsystem(TickProfiler::Subsystem::tileManager, World::TileManager::update);
+            profileSubsystem(TickProfiler::Subsystem::waveManager, World::WaveManager::update);
+            profileSubsystem(TickProfiler::Subsystem::townManager, TownManager::update);
+            profileSubsystem(TickProfiler::Subsystem::industryManager, IndustryManager::update);
+            profileSubsystem(TickProfiler::Subsystem::vehicleManager, VehicleManager::update);
+            profileSubsystem(TickProfiler::Subsystem::stationManager, StationManager::update);
+            profileSubsystem(TickProfiler::Subsystem::effectsManager, EffectsManager::update);
+            profileSubsystem(TickProfiler::Subsystem::companyManager, CompanyManager::update);
+            profileSubsystem(TickProfiler::Subsystem::animationManager, World::AnimationManager::update);
+            profileSubsystem(TickProfiler::Subsystem::vehicleNoise, Audio::updateVehicleNoise);
+            profileSubsystem(TickProfiler::Subsystem::ambientNoise, Audio::updateAmbientNoise);
+            profileSubsystem(TickProfiler::Subsystem::title, Title::update);
+            profileSubsystem(TickProfiler::Subsystem::stateHash, [] { StateHash::update(ScenarioManager::getScenarioTicks()); });
+        }
+        TickProfiler::endTick();
+        MemoryAccounting::update();
+        Telemetry::update();
 
         Scenario::getOptions().madeAnyChanges = addr<0x00F25374, uint8_t>();
-        if (_loadErrorCode != 0)
+        if (_loadErrorCode != 0 && _isDedicatedServer)
+        {
+            Logging::error("Unable to load objects of the scenario");
+            _loadErrorCode = 0;
+        }
+        else if (_loadErrorCode != 0)
         {
             if (_loadErrorCode == -2)
             {
@@ -578,8 +798,15 @@ namespace OpenLoco
         }
     }
 
+    // Only the snapshot is taken on the game thread, encoding and writing the file happens on another thread.
     static void autosave()
     {
+        if (_autosaveTask.valid())
+        {
+            Logging::warn("Previous autosave has not finished yet, skipping autosave.");
+            return;
+        }
+
         // Format filename
         auto time = std::time(nullptr);
         auto localTime = std::localtime(&time);
@@ -605,7 +832,16 @@ namespace OpenLoco
 
             auto autosaveFullPath8 = autosaveFullPath.u8string();
             Logging::info("Autosaving game to {}", autosaveFullPath8.c_str());
-            S5::exportGameStateToFile(autosaveFullPath, S5::SaveFlags::isAutosave | S5::SaveFlags::noWindowClose);
+            auto flags = S5::SaveFlags::isAutosave | S5::SaveFlags::noWindowClose;
+            if (Config::get().compressSaves)
+            {
+                flags |= S5::SaveFlags::compressed;
+            }
+
+            auto snapshot = S5::takeGameStateSnapshot(flags);
+            _autosaveTask = std::async(std::launch::async, [snapshot = std::move(snapshot), autosaveFullPath, flags]() {
+                return S5::exportSnapshotToFile(autosaveFullPath, *snapshot, flags);
+            });
         }
         catch (const std::exception& e)
         {
@@ -613,6 +849,36 @@ namespace OpenLoco
         }
     }
 
+    static void autosaveUpdate()
+    {
+        using namespace std::chrono_literals;
+
+        if (!_autosaveTask.valid() || _autosaveTask.wait_for(0s) != std::future_status::ready)
+        {
+            return;
+        }
+
+        if (_autosaveTask.get())
+        {
+            Logging::info("Autosave complete.");
+            autosaveClean();
+        }
+        else
+        {
+            Ui::Windows::Error::open(StringIds::error_autosave_failed, StringIds::null);
+        }
+    }
+
+    // Lets a pending autosave finish writing before the game exits.
+    static void autosaveWait()
+    {
+        if (_autosaveTask.valid())
+        {
+            _autosaveTask.wait();
+            autosaveUpdate();
+        }
+    }
+
     static void autosaveCheck()
     {
         _monthsSinceLastAutosave++;
@@ -623,12 +889,45 @@ namespace OpenLoco
             if (freq > 0 && _monthsSinceLastAutosave >= freq)
             {
                 autosave();
-                autosaveClean();
                 autosaveReset();
             }
         }
     }
 
+    struct DeferredPeriodicJob
+    {
+        int32_t dayOfMonth;
+        bool yearly;
+        void (*update)();
+    };
+
+    // The heavier month and year end updates are spread over the days following the first of the month so that
+    // they don't all land on the same tick. The schedule only depends on the current date which
+    // keeps it deterministic for saved games and multiplayer without any extra state.
+    static constexpr std::array<DeferredPeriodicJob, 5> kDeferredPeriodicJobs = {
+        DeferredPeriodicJob{ 2, false, TownManager::updateMonthly },
+        DeferredPeriodicJob{ 3, false, IndustryManager::updateMonthly },
+        DeferredPeriodicJob{ 4, false, VehicleManager::updateMonthly },
+        DeferredPeriodicJob{ 5, true, World::TileManager::updateYearly },
+        DeferredPeriodicJob{ 6, false, autosaveCheck },
+    };
+
+    static void updateDeferredPeriodicJobs(const Date& today)
+    {
+        for (const auto& job : kDeferredPeriodicJobs)
+        {
+            if (today.day != job.dayOfMonth)
+            {
+                continue;
+            }
+            if (job.yearly && today.month != MonthId::january)
+            {
+                continue;
+            }
+            job.update();
+        }
+    }
+
     // 0x004968C7
     static void dateTick()
     {
@@ -652,11 +951,8 @@ namespace OpenLoco
                 {
                     // End of every month
                     Scenario::getObjectiveProgress().monthsInChallenge++;
-                    TownManager::updateMonthly();
-                    IndustryManager::updateMonthly();
                     CompanyManager::updateMonthly1();
                     CompanyManager::updateMonthlyHeadquarters();
-                    VehicleManager::updateMonthly();
 
                     if (today.year <= 2029)
                     {
@@ -679,12 +975,11 @@ namespace OpenLoco
                         CompanyManager::updateYearly();
                         ObjectManager::updateDefaultLevelCrossingType();
                         ObjectManager::updateYearly2();
-                        World::TileManager::updateYearly();
                     }
-
-                    autosaveCheck();
                 }
 
+                updateDeferredPeriodicJobs(today);
+
                 CompanyManager::updateDaily();
             }
         }
@@ -729,21 +1024,46 @@ namespace OpenLoco
 
         const auto alpha = std::min<float>(_accumulator / UpdateTime, 1.0);
 
+        bool hasTicked = false;
         while (_accumulator > UpdateTime)
         {
             tweener.preTick();
 
             tick();
             _accumulator -= UpdateTime;
+            hasTicked = true;
 
             tweener.postTick();
         }
 
+        // Frames are drawn more often than the game ticks, keep the cursor and tools responsive in between.
+        if (!hasTicked)
+        {
+            handleCursorInput();
+        }
+
         tweener.tween(alpha);
 
         Ui::render();
     }
 
+    // Sleeping is only accurate to the scheduler granularity, which can be far more than a millisecond,
+    // so the last part of the wait is spent yielding instead.
+    static void waitForNextUpdate(double remaining)
+    {
+        constexpr auto kSpinThreshold = std::chrono::milliseconds(2);
+
+        const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(remaining));
+        while (deadline - Clock::now() > kSpinThreshold)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
     static void fixedUpdate()
     {
         auto& tweener = EntityTweener::get();
@@ -751,7 +1071,14 @@ namespace OpenLoco
 
         if (_accumulator < UpdateTime)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (Config::get().highResolutionFramePacing)
+            {
+                waitForNextUpdate(UpdateTime - _accumulator);
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
         }
         else
         {
@@ -762,8 +1089,36 @@ namespace OpenLoco
         }
     }
 
+    // Longest the main loop blocks on input while the game is paused and can't be seen
+    constexpr uint32_t kMinimisedPausedWaitMs = 250;
+
+    // Input playback draws every frame straight after the last one, as fast as the game can go
+    static void playbackUpdate()
+    {
+        const auto begin = Clock::now();
+        EntityTweener::get().reset();
+        tick();
+        Ui::render();
+        Tutorial::addFrameTime(std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+
+        _accumulator = 0.0;
+        _lastUpdate = Clock::now();
+    }
+
     static void update()
     {
+        if (Tutorial::isPlayingRecording())
+        {
+            playbackUpdate();
+            return;
+        }
+
+        // Nothing changes or can be seen, so only wake for input or the occasional update
+        if (SceneManager::isPaused() && Ui::isMinimised() && !SceneManager::isNetworked())
+        {
+            Ui::waitForEvents(kMinimisedPausedWaitMs);
+        }
+
         auto timeNow = Clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timeNow - _lastUpdate).count() / 1'000'000.0;
 
@@ -772,7 +1127,8 @@ namespace OpenLoco
         _accumulator = std::min(_accumulator + elapsed, MaxUpdateTime);
         _lastUpdate = timeNow;
 
-        if (Config::get().uncapFPS)
+        // Extra frames only smooth what the player is watching
+        if (Config::get().uncapFPS && Ui::hasInputFocus() && !Ui::isMinimised())
         {
             variableUpdate();
         }
@@ -815,6 +1171,8 @@ namespace OpenLoco
             }
         }
         Logging::info("MAIN LOOP: Message processing loop ended after {} iterations", loopCount);
+        autosaveWait();
+        Ui::waitForPendingScreenshots();
 
 #ifdef _WIN32
         Logging::info("MAIN LOOP: Uninitializing COM (Windows)...");
@@ -824,9 +1182,18 @@ namespace OpenLoco
         Logging::info("MAIN LOOP: Main game loop completed successfully");
     }
 
-    void simulateGame(const fs::path& savePath, int32_t ticks)
+    // Restarts the shared job pool with the configured thread count once the config has been read.
+    static void configureJobSystem()
+    {
+        const auto numThreads = static_cast<uint32_t>(std::max(Config::get().jobThreads, 0));
+        Core::JobSystem::configure(numThreads, Tracing::getJobTraceHooks());
+    }
+
+    // Reads the config and resolves the paths for the command line only commands.
+    static void prepareHeadless()
     {
         Config::read();
+        configureJobSystem();
 
         if (getCommandLineOptions().locomotionDataPath.has_value())
         {
@@ -835,6 +1202,12 @@ namespace OpenLoco
         }
 
         Environment::resolvePaths();
+    }
+
+    // Loads the save without opening a window for the command line only commands.
+    static void loadGameHeadless(const fs::path& savePath)
+    {
+        prepareHeadless();
 
         try
         {
@@ -843,20 +1216,227 @@ namespace OpenLoco
         }
         catch (const std::exception& e)
         {
-            Logging::error("Unable to simulate park: {}", e.what());
+            Logging::error("Unable to load park: {}", e.what());
+        }
+        catch (const GameException i)
+        {
+            if (i != GameException::Interrupt)
+            {
+                Logging::error("Unable to load park!");
+            }
+            else
+            {
+                Logging::info("File loaded.");
+            }
+        }
+    }
+
+    float simulateGame(const fs::path& savePath, int32_t ticks, int32_t warmupTicks, int32_t checkpointInterval, const std::function<void()>& checkpoint)
+    {
+        loadGameHeadless(savePath);
+
+        if (warmupTicks > 0)
+        {
+            Logging::info("Warming up for {} ticks.", warmupTicks);
+            tickLogic(warmupTicks);
+        }
+
+        TickProfiler::reset();
+        resetAiThinkStateStats();
+        Core::Timer timer;
+        if (checkpointInterval > 0 && checkpoint)
+        {
+            checkpoint();
+            for (int32_t ticksDone = 0; ticksDone < ticks; ticksDone += checkpointInterval)
+            {
+                tickLogic(std::min(checkpointInterval, ticks - ticksDone));
+                checkpoint();
+            }
+        }
+        else
+        {
+            tickLogic(ticks);
+        }
+        return timer.elapsed();
+    }
+
+    std::vector<Paint::Benchmark::ViewResult> benchmarkPaint(const fs::path& savePath, int32_t iterations)
+    {
+        loadGameHeadless(savePath);
+
+        const auto views = Paint::Benchmark::getDefaultViews();
+        return Paint::Benchmark::run(views, iterations);
+    }
+
+    uint32_t replayGame(const fs::path& savePath, const fs::path& logPath)
+    {
+        loadGameHeadless(savePath);
+        GameCommandLog::startReplay(logPath);
+
+        const auto startTick = ScenarioManager::getScenarioTicks();
+        if (startTick != GameCommandLog::getReplayStartTick())
+        {
+            GameCommandLog::stopReplay();
+            throw Exception::RuntimeError("Game command log was recorded from a different save");
+        }
+
+        const auto endTick = GameCommandLog::getReplayEndTick();
+        tickLogic(static_cast<int32_t>(endTick - startTick));
+        // Commands issued after the last tick of the recording are part of its final state
+        GameCommandLog::replayCommandsForTick(endTick + 1);
+        GameCommandLog::stopReplay();
+        return endTick - startTick;
+    }
+
+    StressWorld::Result generateStressWorld(const fs::path& scenarioPath, const StressWorld::Options& options)
+    {
+        prepareHeadless();
+        initialise();
+        if (!Scenario::load(scenarioPath))
+        {
+            throw Exception::RuntimeError("Unable to load scenario");
+        }
+
+        StressWorld::prepareScenarioOptions();
+        try
+        {
+            Scenario::start();
         }
         catch (const GameException i)
         {
+            // Starting ends by interrupting the game loop, which isn't running here
             if (i != GameException::Interrupt)
             {
-                Logging::error("Unable to simulate park!");
+                throw Exception::RuntimeError("Unable to start scenario");
+            }
+        }
+        return StressWorld::build(options);
+    }
+
+    // Like initialise but leaves out the graphics, ui and title sequence.
+    static void initialiseDedicatedServer()
+    {
+        _last_tick_time = Platform::getTime();
+        std::srand(std::time(nullptr));
+        World::TileManager::allocateMapElements();
+        Environment::resolvePaths();
+        Localisation::enumerateLanguages();
+        Localisation::loadLanguageFile();
+        startupChecks();
+
+        // The game logic still looks up windows and viewports, these are left empty.
+        Ui::WindowManager::init();
+        Ui::ViewportManager::init();
+        autosaveReset();
+
+        MessageManager::reset();
+        Scenario::reset();
+        ObjectManager::loadIndex();
+        ScenarioManager::loadIndex();
+        Intro::state(Intro::State::end);
+    }
+
+    static void onDedicatedServerSignal(int)
+    {
+        _isDedicatedServerRunning = false;
+    }
+
+    static int32_t getNumDedicatedServerTicks()
+    {
+        if (SceneManager::isPaused())
+        {
+            return 0;
+        }
+        switch (SceneManager::getGameSpeed())
+        {
+            case GameSpeed::FastForward:
+                return 3;
+            case GameSpeed::ExtraFastForward:
+            case GameSpeed::Turbo:
+                return 9;
+            default:
+                return 1;
+        }
+    }
+
+    // Serves the game to clients without a window, ticking at the same rate as the game normally does.
+    static int runDedicatedServer(const CommandLineOptions& options)
+    {
+        _isDedicatedServer = true;
+        initialiseDedicatedServer();
+
+        try
+        {
+            if (options.action == CommandLineAction::relay)
+            {
+                Network::openRelay(options.address, options.upstreamPort.value_or(Network::kDefaultPort));
             }
             else
             {
-                Logging::info("File loaded. Starting simulation.");
+                Network::openServer();
+                loadFile(options.path);
             }
         }
-        tickLogic(ticks);
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to load park: {}", e.what());
+            return 1;
+        }
+        catch (const GameException i)
+        {
+            if (i != GameException::Interrupt)
+            {
+                Logging::error("Unable to load park!");
+                return 1;
+            }
+        }
+        if (!Network::isOpen())
+        {
+            Logging::error("Unable to start server");
+            return 1;
+        }
+
+        _isDedicatedServerRunning = true;
+        std::signal(SIGINT, onDedicatedServerSignal);
+        std::signal(SIGTERM, onDedicatedServerSignal);
+        Logging::info("Dedicated server running, press Ctrl+C to stop.");
+
+        // Ticks are scheduled against a fixed start so that the rate does not drift, after a long stall
+        // the schedule is restarted rather than running all the missed ticks at once.
+        constexpr auto kTickPeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::milliseconds(Engine::UpdateRateInMs));
+        constexpr auto kMaxTickLag = kTickPeriod * 8;
+        auto nextTick = Clock::now();
+        while (_isDedicatedServerRunning && Network::isOpen())
+        {
+            try
+            {
+                GameCommands::resetCommandNestLevel();
+                autosaveUpdate();
+                Network::update();
+                tickLogic(getNumDedicatedServerTicks());
+                getGameState().var_014A++;
+            }
+            catch (GameException)
+            {
+                tickInterrupted();
+            }
+
+            nextTick += kTickPeriod;
+            const auto now = Clock::now();
+            if (now - nextTick > kMaxTickLag)
+            {
+                nextTick = now;
+            }
+            else if (nextTick > now)
+            {
+                waitForNextUpdate(std::chrono::duration<double>(nextTick - now).count());
+            }
+        }
+
+        Logging::info("Stopping dedicated server.");
+        Network::close();
+        autosaveWait();
+        return 0;
     }
 
     // 0x004078FE
@@ -894,6 +1474,16 @@ namespace OpenLoco
         // Always print the product name and version first.
         Logging::info("{}", OpenLoco::getVersionInfo());
 
+        Diagnostics::Tracing::setThreadName("Main");
+        if (!options.tracePath.empty())
+        {
+            Diagnostics::Tracing::start();
+        }
+        if (!options.telemetryPath.empty())
+        {
+            Telemetry::start(fs::u8path(options.telemetryPath), options.telemetryInterval.value_or(Telemetry::kDefaultIntervalDays));
+        }
+
 #ifdef OPENLOCO_FORCE_64BIT
         // Log structure layouts for 64-bit debugging
         Debug::StructureLayoutLogger::initialize();
@@ -946,6 +1536,7 @@ namespace OpenLoco
         auto ret = runCommandLineOnlyCommand(options);
         if (ret)
         {
+            writeCommandLineTrace(options);
             return *ret;
         }
 
@@ -974,12 +1565,24 @@ namespace OpenLoco
 
             Logging::info("Step 2: Reading configuration...");
             const auto& cfg = Config::read();
+            configureJobSystem();
             Logging::info("Step 2: Configuration read successfully");
             
             Logging::info("Step 3: Resolving environment paths...");
             Environment::resolvePaths();
             Logging::info("Step 3: Environment paths resolved successfully");
 
+            if ((options.action == CommandLineAction::host || options.action == CommandLineAction::relay) && options.headless)
+            {
+                const auto result = runDedicatedServer(options);
+                Localisation::unloadLanguageFile();
+                CrashHandler::shutdown(_exHandler);
+                writeCommandLineTrace(options);
+                MemoryAccounting::logReport();
+                Logging::shutdown();
+                return result;
+            }
+
             Logging::info("Step 4: Creating UI window (CRITICAL STEP - likely crash point)...");
             Ui::createWindow(cfg.display);
             Logging::info("Step 4: UI window created successfully");
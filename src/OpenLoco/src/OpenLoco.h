@@ -4,6 +4,18 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
+
+namespace OpenLoco::Paint::Benchmark
+{
+    struct ViewResult;
+}
+
+namespace OpenLoco::StressWorld
+{
+    struct Options;
+    struct Result;
+}
 
 namespace OpenLoco
 {
@@ -15,6 +27,8 @@ namespace OpenLoco
         constexpr uint32_t UpdateRateHz = 40;
         constexpr uint32_t UpdateRateInMs = 1000 / UpdateRateHz;
         constexpr uint32_t MaxUpdates = 3;
+        // Time per frame spent on logic ticks in turbo speed, the remainder is left for input and rendering.
+        constexpr uint32_t TurboTickBudgetMs = 20;
     }
 
     extern const char version[];
@@ -22,7 +36,15 @@ namespace OpenLoco
 
     void* hInstance();
     void initialiseViewports();
-    void simulateGame(const fs::path& path, int32_t ticks);
+    // Returns the wall time in milliseconds spent on the measured ticks, excluding loading and warmup.
+    // With a checkpoint interval, checkpoint is called before the first measured tick and after every interval.
+    float simulateGame(const fs::path& path, int32_t ticks, int32_t warmupTicks = 0, int32_t checkpointInterval = 0, const std::function<void()>& checkpoint = {});
+    // Paints the benchmark views of the save the given amount of times.
+    std::vector<Paint::Benchmark::ViewResult> benchmarkPaint(const fs::path& path, int32_t iterations);
+    // Runs the game commands of the log against the save the log was recorded from, returns the amount of ticks run.
+    uint32_t replayGame(const fs::path& path, const fs::path& logPath);
+    // Starts the scenario on a flat generated map and builds the stress network on it, see StressWorld.h.
+    StressWorld::Result generateStressWorld(const fs::path& scenarioPath, const StressWorld::Options& options);
 
     void sub_431695(uint16_t var_F253A0);
     int main(std::vector<std::string>&& argv);
@@ -1,4 +1,5 @@
 #include "Paint.h"
+#include "Config.h"
 #include "Game.h"
 #include "GameStateFlags.h"
 #include "Graphics/Gfx.h"
@@ -11,6 +12,7 @@
 #include "Logging.h"
 #include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
+#include "MemoryAccounting.h"
 #include "PaintEntity.h"
 #include "PaintRoad.h"
 #include "PaintTile.h"
@@ -19,15 +21,75 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Interop/Interop.hpp>
-
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui::ViewportInteraction;
 
 namespace OpenLoco::Paint
 {
+    // The paint structs of a session copied into separate arrays in their initial order, index 0 being
+    // the list head. Sorting them this way avoids chasing pointers through the paint entry blocks.
+    struct FlatPaintStructs
+    {
+        static constexpr uint32_t kNoNext = std::numeric_limits<uint32_t>::max();
+
+        std::vector<PaintStruct*> structs;
+        std::vector<uint32_t> next;
+        std::vector<uint16_t> quadrantIndex;
+        std::vector<QuadrantFlags> quadrantFlags;
+        std::vector<PaintStructBoundBox> bounds;
+    };
+
+    struct PaintSession::PaintEntryArena
+    {
+        // Blocks are never moved or freed so entries stay valid while the arena grows.
+        std::vector<std::unique_ptr<PaintEntry[]>> blocks;
+        uint32_t numEntries{};
+        bool hasDroppedEntries{};
+        FlatPaintStructs flatStructs;
+    };
+
+    // Arenas not used by any session, more than one is needed when viewports are painted by several threads.
+    static std::mutex _freeArenasMutex;
+    static std::vector<std::unique_ptr<PaintSession::PaintEntryArena>> _freeArenas;
+    static std::atomic<uint32_t> _paintEntryHighWaterMark = 0;
+    static std::atomic<size_t> _paintEntryBlocksSize = 0;
+    static std::atomic<bool> _hasReportedDroppedEntries = false;
+
+    uint32_t getPaintEntryHighWaterMark()
+    {
+        return _paintEntryHighWaterMark;
+    }
+
     PaintSession::PaintSession(const Gfx::RenderTarget& rt, const SessionOptions& options)
     {
+        {
+            std::lock_guard lock(_freeArenasMutex);
+            if (_freeArenas.empty())
+            {
+                _arena = new PaintEntryArena();
+                MemoryAccounting::registerProvider(MemoryAccounting::Category::paintArenas, []() -> size_t {
+                    return _paintEntryBlocksSize.load(std::memory_order_relaxed);
+                });
+            }
+            else
+            {
+                _arena = _freeArenas.back().release();
+                _freeArenas.pop_back();
+            }
+        }
+        _arena->numEntries = 0;
+        _arena->hasDroppedEntries = false;
+
         _renderTarget = &rt;
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
@@ -41,11 +103,49 @@ namespace OpenLoco::Paint
 
         _viewFlags = options.viewFlags;
         currentRotation = options.rotation;
+        _levelOfDetail = Config::get().paintLevelOfDetail;
 
         // TODO: unused
         _foregroundCullingHeight = options.foregroundCullHeight;
     }
 
+    PaintSession::~PaintSession()
+    {
+        auto highWaterMark = _paintEntryHighWaterMark.load();
+        while (_arena->numEntries > highWaterMark && !_paintEntryHighWaterMark.compare_exchange_weak(highWaterMark, _arena->numEntries))
+        {
+        }
+        if (_arena->hasDroppedEntries && !_hasReportedDroppedEntries.exchange(true))
+        {
+            Logging::warn("Paint session ran out of paint entries, sprites have been dropped. Consider raising maxPaintEntries.");
+        }
+
+        std::lock_guard lock(_freeArenasMutex);
+        _freeArenas.emplace_back(_arena);
+    }
+
+    PaintSession::PaintEntry* PaintSession::allocatePaintEntry()
+    {
+        auto& arena = *_arena;
+        if (arena.numEntries >= static_cast<uint32_t>(std::max(Config::get().maxPaintEntries, static_cast<int32_t>(kPaintEntriesPerBlock))))
+        {
+            arena.hasDroppedEntries = true;
+            return nullptr;
+        }
+
+        const auto blockIndex = arena.numEntries / kPaintEntriesPerBlock;
+        if (blockIndex == arena.blocks.size())
+        {
+            arena.blocks.push_back(std::make_unique<PaintEntry[]>(kPaintEntriesPerBlock));
+            _paintEntryBlocksSize.fetch_add(sizeof(PaintEntry) * kPaintEntriesPerBlock, std::memory_order_relaxed);
+            Logging::verbose("Paint entry arena grown to {} entries", arena.blocks.size() * kPaintEntriesPerBlock);
+        }
+
+        auto& entry = arena.blocks[blockIndex][arena.numEntries % kPaintEntriesPerBlock];
+        arena.numEntries++;
+        return &entry;
+    }
+
     void PaintSession::setEntityPosition(const World::Pos2& pos)
     {
         _spritePositionX = pos.x;
@@ -157,6 +257,8 @@ namespace OpenLoco::Paint
     // 0x004FD120
     PaintStringStruct* PaintSession::addToStringPlotList(const uint32_t amount, const StringId stringId, const uint16_t z, const int16_t xOffset, const int8_t* yOffsets, const uint16_t colour)
     {
+        markRecordingUnreplayable();
+
         auto* psString = allocatePaintStruct<PaintStringStruct>();
         if (psString == nullptr)
         {
@@ -241,6 +343,8 @@ namespace OpenLoco::Paint
     // 0x004FD140
     PaintStruct* PaintSession::addToPlotListAsParent(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
+        record(PaintCommand::Type::addToPlotListAsParent, imageId, offset, boundBoxOffset, boundBoxSize);
+
         _lastPS = nullptr;
 
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
@@ -262,6 +366,9 @@ namespace OpenLoco::Paint
     // 0x004FD200
     PaintStruct* PaintSession::addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
+        // Depends on the render target so can not be replayed for another one.
+        markRecordingUnreplayable();
+
         _lastPS = nullptr;
 
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
@@ -335,9 +442,15 @@ namespace OpenLoco::Paint
     // 0x004FD1E0
     PaintStruct* PaintSession::addToPlotListAsChild(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
+        record(PaintCommand::Type::addToPlotListAsChild, imageId, offset, boundBoxOffset, boundBoxSize);
+
         if (_lastPS == nullptr)
         {
-            return addToPlotListAsParent(imageId, offset, boundBoxOffset, boundBoxSize);
+            // Already recorded as a child, replaying it will take the same path.
+            auto* recording = std::exchange(_recording, nullptr);
+            auto* ps = addToPlotListAsParent(imageId, offset, boundBoxOffset, boundBoxSize);
+            _recording = recording;
+            return ps;
         }
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
         if (ps == nullptr)
@@ -352,6 +465,8 @@ namespace OpenLoco::Paint
     // 0x004FD170
     PaintStruct* PaintSession::addToPlotListTrackRoad(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
+        markRecordingUnreplayable();
+
         _lastPS = nullptr;
 
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
@@ -369,6 +484,8 @@ namespace OpenLoco::Paint
     // 0x004FD180
     PaintStruct* PaintSession::addToPlotListTrackRoadAddition(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
+        markRecordingUnreplayable();
+
         _lastPS = nullptr;
 
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
@@ -386,6 +503,8 @@ namespace OpenLoco::Paint
     // 0x0045E779
     AttachedPaintStruct* PaintSession::attachToPrevious(ImageId imageId, const Ui::Point& offset)
     {
+        record(PaintCommand::Type::attachToPrevious, imageId, World::Pos3(offset.x, offset.y, 0), {}, {});
+
         if (_lastPS == nullptr)
         {
             return nullptr;
@@ -402,6 +521,105 @@ namespace OpenLoco::Paint
         return attached;
     }
 
+    PaintStruct* PaintSession::addToPlotListAsParentMasked(ImageId imageId, ImageId maskedImageId, const World::Pos3& offset, const World::Pos3& boundBoxSize)
+    {
+        auto* ps = addToPlotListAsParent(imageId, offset, boundBoxSize);
+        if (_recording != nullptr)
+        {
+            _recording->commands.back().maskedImageId = maskedImageId;
+        }
+        if (ps != nullptr)
+        {
+            ps->flags |= PaintStructFlags::hasMaskedImage;
+            ps->maskedImageId = maskedImageId;
+        }
+        return ps;
+    }
+
+    AttachedPaintStruct* PaintSession::attachToPreviousMasked(ImageId imageId, ImageId maskedImageId, const Ui::Point& offset)
+    {
+        auto* attachedPs = attachToPrevious(imageId, offset);
+        if (_recording != nullptr)
+        {
+            _recording->commands.back().maskedImageId = maskedImageId;
+        }
+        if (attachedPs != nullptr)
+        {
+            attachedPs->flags |= PaintStructFlags::hasMaskedImage;
+            attachedPs->maskedImageId = maskedImageId;
+        }
+        return attachedPs;
+    }
+
+    void PaintSession::record(PaintCommand::Type type, ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        if (_recording == nullptr)
+        {
+            return;
+        }
+        _recording->commands.push_back(PaintCommand{ type, _recording->elementIndex, _itemType, imageId, std::nullopt, offset, boundBoxOffset, boundBoxSize });
+    }
+
+    void PaintSession::replay(const PaintCommand& command)
+    {
+        _itemType = command.itemType;
+        switch (command.type)
+        {
+            case PaintCommand::Type::addToPlotListAsParent:
+                if (command.maskedImageId.has_value())
+                {
+                    addToPlotListAsParentMasked(command.imageId, *command.maskedImageId, command.offset, command.boundBoxSize);
+                }
+                else
+                {
+                    addToPlotListAsParent(command.imageId, command.offset, command.boundBoxOffset, command.boundBoxSize);
+                }
+                break;
+            case PaintCommand::Type::addToPlotListAsChild:
+                addToPlotListAsChild(command.imageId, command.offset, command.boundBoxOffset, command.boundBoxSize);
+                break;
+            case PaintCommand::Type::attachToPrevious:
+            {
+                const auto offset = Ui::Point(command.offset.x, command.offset.y);
+                if (command.maskedImageId.has_value())
+                {
+                    attachToPreviousMasked(command.imageId, *command.maskedImageId, offset);
+                }
+                else
+                {
+                    attachToPrevious(command.imageId, offset);
+                }
+                break;
+            }
+        }
+    }
+
+    PaintTileState PaintSession::getTileState() const
+    {
+        PaintTileState state{};
+        std::copy(std::begin(_supportSegments), std::end(_supportSegments), state.supportSegments.begin());
+        state.support = _support;
+        state.waterHeight = _waterHeight;
+        state.waterHeight2 = _waterHeight2;
+        state.surfaceHeight = _surfaceHeight;
+        state.surfaceSlope = _surfaceSlope;
+        state.didPassSurface = _didPassSurface;
+        state.itemType = _itemType;
+        return state;
+    }
+
+    void PaintSession::setTileState(const PaintTileState& state)
+    {
+        std::copy(state.supportSegments.begin(), state.supportSegments.end(), std::begin(_supportSegments));
+        _support = state.support;
+        _waterHeight = state.waterHeight;
+        _waterHeight2 = state.waterHeight2;
+        _surfaceHeight = state.surfaceHeight;
+        _surfaceSlope = state.surfaceSlope;
+        _didPassSurface = state.didPassSurface;
+        _itemType = state.itemType;
+    }
+
     void PaintSession::setSegmentsSupportHeight(const SegmentFlags segments, const uint16_t height, const uint8_t slope)
     {
         for (int32_t s = 0; s < 9; s++)
@@ -596,9 +814,38 @@ namespace OpenLoco::Paint
         return ps;
     }
 
+    Ui::ViewportRect getImageScreenBounds(uint32_t imageIndex, const World::Pos2& pos, const World::Pos3& offset, uint8_t rotation)
+    {
+        auto* const g1 = Gfx::getG1Element(imageIndex);
+        if (g1 == nullptr)
+        {
+            return {};
+        }
+
+        // The sprite position of the tile as set up by paintTileElementsSetup
+        constexpr World::Pos2 kTileOrigins[4] = {
+            { 0, 0 },
+            { 32, 0 },
+            { 32, 32 },
+            { 0, 32 },
+        };
+        auto coord = World::Pos3{ Math::Vector::rotate(offset, directionFlipXAxis(rotation)), offset.z };
+        coord += World::Pos3{ pos + kTileOrigins[rotation], 0 };
+        const auto vpPos = World::gameToScreen(coord, rotation);
+
+        Ui::ViewportRect rect;
+        rect.left = vpPos.x + g1->xOffset;
+        rect.top = vpPos.y + g1->yOffset;
+        rect.right = rect.left + g1->width;
+        rect.bottom = rect.top + g1->height;
+        return rect;
+    }
+
     // 0x004622A2
     void PaintSession::generate()
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("PaintGenerate", "paint");
+
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
         {
             return;
@@ -776,6 +1023,184 @@ namespace OpenLoco::Paint
         }
     }
 
+    // Identical to arrangeStructsHelperRotation but operating on indices into the flat arrays.
+    template<uint8_t TRotation>
+    static uint32_t arrangeFlatStructsHelperRotation(FlatPaintStructs& flat, uint32_t psNext, const uint16_t quadrantIndex, const QuadrantFlags flag)
+    {
+        constexpr auto kNoNext = FlatPaintStructs::kNoNext;
+        auto& nexts = flat.next;
+        auto& quadrantFlags = flat.quadrantFlags;
+        const auto& quadrantIndices = flat.quadrantIndex;
+
+        uint32_t ps = 0;
+
+        // Get the first node in the specified quadrant.
+        do
+        {
+            ps = psNext;
+            psNext = nexts[psNext];
+            if (psNext == kNoNext)
+            {
+                return ps;
+            }
+        } while (quadrantIndex > quadrantIndices[psNext]);
+
+        const auto psQuadrantEntry = ps;
+
+        auto psTemp = ps;
+        do
+        {
+            ps = nexts[ps];
+            if (ps == kNoNext)
+            {
+                break;
+            }
+
+            if (quadrantIndices[ps] > quadrantIndex + 1)
+            {
+                quadrantFlags[ps] = QuadrantFlags::outsideQuadrant;
+            }
+            else if (quadrantIndices[ps] == quadrantIndex + 1)
+            {
+                quadrantFlags[ps] = QuadrantFlags::neighbour | QuadrantFlags::pendingVisit;
+            }
+            else if (quadrantIndices[ps] == quadrantIndex)
+            {
+                quadrantFlags[ps] = flag | QuadrantFlags::pendingVisit;
+            }
+        } while (quadrantIndices[ps] <= quadrantIndex + 1);
+        ps = psTemp;
+
+        while (true)
+        {
+            while (true)
+            {
+                psNext = nexts[ps];
+                if (psNext == kNoNext)
+                {
+                    return psQuadrantEntry;
+                }
+                if ((quadrantFlags[psNext] & QuadrantFlags::outsideQuadrant) != QuadrantFlags::none)
+                {
+                    return psQuadrantEntry;
+                }
+                if ((quadrantFlags[psNext] & QuadrantFlags::pendingVisit) != QuadrantFlags::none)
+                {
+                    break;
+                }
+                ps = psNext;
+            }
+
+            quadrantFlags[psNext] &= ~QuadrantFlags::pendingVisit;
+            psTemp = ps;
+
+            const auto initialBBox = flat.bounds[psNext];
+            while (true)
+            {
+                ps = psNext;
+                psNext = nexts[psNext];
+                if (psNext == kNoNext)
+                {
+                    break;
+                }
+                if ((quadrantFlags[psNext] & QuadrantFlags::outsideQuadrant) != QuadrantFlags::none)
+                {
+                    break;
+                }
+                if ((quadrantFlags[psNext] & QuadrantFlags::neighbour) == QuadrantFlags::none)
+                {
+                    continue;
+                }
+
+                if (checkBoundingBox<TRotation>(initialBBox, flat.bounds[psNext]))
+                {
+                    nexts[ps] = nexts[psNext];
+                    const auto psTemp2 = nexts[psTemp];
+                    nexts[psTemp] = psNext;
+                    nexts[psNext] = psTemp2;
+                    psNext = ps;
+                }
+            }
+
+            ps = psTemp;
+        }
+    }
+
+    static uint32_t arrangeFlatStructsHelper(FlatPaintStructs& flat, uint32_t psNext, uint16_t quadrantIndex, QuadrantFlags flag, uint8_t rotation)
+    {
+        switch (rotation)
+        {
+            case 0:
+                return arrangeFlatStructsHelperRotation<0>(flat, psNext, quadrantIndex, flag);
+            case 1:
+                return arrangeFlatStructsHelperRotation<1>(flat, psNext, quadrantIndex, flag);
+            case 2:
+                return arrangeFlatStructsHelperRotation<2>(flat, psNext, quadrantIndex, flag);
+            case 3:
+                return arrangeFlatStructsHelperRotation<3>(flat, psNext, quadrantIndex, flag);
+        }
+        return 0;
+    }
+
+    // Sorts the list starting after psHead into flat, leaving the paint structs themselves untouched.
+    static void arrangeFlatStructs(FlatPaintStructs& flat, const PaintStruct& psHead, uint32_t backIndex, uint32_t frontIndex, uint8_t rotation)
+    {
+        flat.structs.clear();
+        flat.next.clear();
+        flat.quadrantIndex.clear();
+        flat.quadrantFlags.clear();
+        flat.bounds.clear();
+
+        flat.structs.push_back(nullptr);
+        flat.quadrantIndex.push_back(psHead.quadrantIndex);
+        flat.bounds.push_back(psHead.bounds);
+        for (auto* ps = psHead.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
+        {
+            flat.structs.push_back(ps);
+            flat.quadrantIndex.push_back(ps->quadrantIndex);
+            flat.bounds.push_back(ps->bounds);
+        }
+        for (uint32_t i = 1; i < flat.structs.size(); i++)
+        {
+            flat.next.push_back(i);
+        }
+        flat.next.push_back(FlatPaintStructs::kNoNext);
+        flat.quadrantFlags.resize(flat.structs.size(), QuadrantFlags::none);
+
+        auto psCache = arrangeFlatStructsHelper(flat, 0, backIndex & 0xFFFF, QuadrantFlags::neighbour, rotation);
+
+        auto quadrantIndex = backIndex;
+        while (++quadrantIndex < frontIndex)
+        {
+            psCache = arrangeFlatStructsHelper(flat, psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, rotation);
+        }
+    }
+
+    static void linkFlatStructs(const FlatPaintStructs& flat, PaintStruct& psHead)
+    {
+        auto* ps = &psHead;
+        for (auto i = flat.next[0]; i != FlatPaintStructs::kNoNext; i = flat.next[i])
+        {
+            ps->nextQuadrantPS = flat.structs[i];
+            ps = flat.structs[i];
+        }
+        ps->nextQuadrantPS = nullptr;
+    }
+
+    static bool isSameOrder(const FlatPaintStructs& flat, const PaintStruct& psHead)
+    {
+        auto* ps = psHead.nextQuadrantPS;
+        for (auto i = flat.next[0]; i != FlatPaintStructs::kNoNext; i = flat.next[i])
+        {
+            if (ps != flat.structs[i])
+            {
+                return false;
+            }
+            ps = ps->nextQuadrantPS;
+        }
+        return ps == nullptr;
+    }
+
     static PaintStruct* arrangeStructsHelper(PaintStruct* psNext, uint16_t quadrantIndex, QuadrantFlags flag, uint8_t rotation)
     {
         switch (rotation)
@@ -795,6 +1220,8 @@ namespace OpenLoco::Paint
     // 0x0045E7B5
     void PaintSession::arrangeStructs()
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("PaintArrange", "paint");
+
         PaintStruct psHead{};
 
         auto* ps = &psHead;
@@ -820,6 +1247,19 @@ namespace OpenLoco::Paint
             }
         } while (++quadrantIndex <= _quadrantFrontIndex);
 
+        const auto& config = Config::get();
+        if (config.flatPaintSorting || config.paintSortingConformanceCheck)
+        {
+            auto& flat = _arena->flatStructs;
+            arrangeFlatStructs(flat, psHead, _quadrantBackIndex, _quadrantFrontIndex, currentRotation);
+            if (!config.paintSortingConformanceCheck)
+            {
+                linkFlatStructs(flat, psHead);
+                _paintHead = psHead.nextQuadrantPS;
+                return;
+            }
+        }
+
         PaintStruct* psCache = arrangeStructsHelper(
             &psHead, _quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, currentRotation);
 
@@ -829,6 +1269,11 @@ namespace OpenLoco::Paint
             psCache = arrangeStructsHelper(psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, currentRotation);
         }
 
+        if (config.paintSortingConformanceCheck && !isSameOrder(_arena->flatStructs, psHead))
+        {
+            Logging::error("Flat paint sorting produced a different draw order for {} paint structs", _arena->flatStructs.structs.size() - 1);
+        }
+
         _paintHead = psHead.nextQuadrantPS;
     }
 
@@ -1031,6 +1476,8 @@ namespace OpenLoco::Paint
     // 0x0045EA23
     void PaintSession::drawStructs(Gfx::DrawingContext& drawingCtx)
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("PaintDraw", "paint");
+
         const Gfx::RenderTarget& rt = drawingCtx.currentRenderTarget();
 
         for (const auto* ps = _paintHead; ps != nullptr; ps = ps->nextQuadrantPS)
@@ -1070,9 +1517,21 @@ namespace OpenLoco::Paint
         }
     }
 
+    uint32_t PaintSession::getNumPaintEntries() const
+    {
+        return _arena->numEntries;
+    }
+
+    bool PaintSession::isDetailHidden(uint8_t minZoom) const
+    {
+        return _levelOfDetail && _renderTarget->zoomLevel >= minZoom;
+    }
+
     // 0x0045A60E
     void PaintSession::drawStringStructs(Gfx::DrawingContext& drawingCtx)
     {
+        Diagnostics::Tracing::ScopedEvent traceEvent("PaintDrawStrings", "paint");
+
         PaintStringStruct* psString = _paintStringHead;
         if (psString == nullptr)
         {
@@ -8,8 +8,10 @@
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <array>
+#include <optional>
 #include <sfl/static_vector.hpp>
 #include <span>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -227,17 +229,75 @@ namespace OpenLoco::Paint
         }
     };
 
-    static constexpr auto kMaxPaintEntries = 4000U;
+    // Paint entries are allocated in blocks of the amount the original game supported in total.
+    static constexpr auto kPaintEntriesPerBlock = 4000U;
     static constexpr auto kMaxPaintQuadrants = 1024;
 
+    // The most paint entries a single session has used since startup.
+    uint32_t getPaintEntryHighWaterMark();
+
+    // The screen area of an image painted for the tile at pos with the offset given to the paint session,
+    // for the view rotation. Lets a change to a single sprite invalidate just that sprite.
+    Ui::ViewportRect getImageScreenBounds(uint32_t imageIndex, const World::Pos2& pos, const World::Pos3& offset, uint8_t rotation);
+
+    // A paint struct call made while painting the elements of a tile, see PaintTileCache.
+    struct PaintCommand
+    {
+        enum class Type : uint8_t
+        {
+            addToPlotListAsParent,
+            addToPlotListAsChild,
+            attachToPrevious,
+        };
+
+        Type type;
+        uint8_t elementIndex;
+        Ui::ViewportInteraction::InteractionItem itemType;
+        ImageId imageId;
+        std::optional<ImageId> maskedImageId;
+        World::Pos3 offset;
+        World::Pos3 boundBoxOffset;
+        World::Pos3 boundBoxSize;
+    };
+
+    struct PaintRecording
+    {
+        std::vector<PaintCommand> commands;
+        uint8_t elementIndex{};
+        // Cleared when a call that can not be replayed was made.
+        bool isReplayable = true;
+    };
+
+    // The session state painting the elements of a tile leaves behind for the elements painted after it.
+    struct PaintTileState
+    {
+        std::array<SupportHeight, 9> supportSegments;
+        SupportHeight support;
+        int16_t waterHeight;
+        int16_t waterHeight2;
+        int16_t surfaceHeight;
+        uint8_t surfaceSlope;
+        bool didPassSurface;
+        Ui::ViewportInteraction::InteractionItem itemType;
+    };
+
     struct PaintSession
     {
     public:
         PaintSession(const Gfx::RenderTarget& rt, const SessionOptions& options);
+        ~PaintSession();
+
+        PaintSession(const PaintSession&) = delete;
+        PaintSession& operator=(const PaintSession&) = delete;
+
+        // Storage of the paint entries, kept between sessions and only grown on demand.
+        struct PaintEntryArena;
 
         void generate();
         void arrangeStructs();
         void drawStructs(Gfx::DrawingContext& drawingCtx);
+        // Paint entries allocated by this session, paint structs and attachments alike.
+        uint32_t getNumPaintEntries() const;
         void drawStringStructs(Gfx::DrawingContext& drawingCtx);
 
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getNormalInteractionInfo(const Ui::ViewportInteraction::InteractionItemFlags flags);
@@ -276,6 +336,8 @@ namespace OpenLoco::Paint
             return World::Pos2{ _spritePositionX, _spritePositionY };
         }
         Ui::ViewportFlags getViewFlags() { return _viewFlags; }
+        // True when level of detail is enabled and the details only shown below minZoom should be skipped.
+        bool isDetailHidden(uint8_t minZoom) const;
         // TileElement or Entity
         void setCurrentItem(void* item) { _currentItem = item; }
         void* getCurrentItem() { return _currentItem; }
@@ -310,7 +372,19 @@ namespace OpenLoco::Paint
         void setWaterHeight(int16_t height) { _waterHeight = height; }
         void setWaterHeight2(int16_t height) { _waterHeight2 = height; }
         PaintStruct* getLastPS() { return _lastPS; }
-        void setLastPS(PaintStruct* ps) { _lastPS = ps; }
+        void setLastPS(PaintStruct* ps)
+        {
+            _lastPS = ps;
+            markRecordingUnreplayable();
+        }
+
+        // While recording every paint struct call is appended to the recording until it is stopped.
+        void startRecording(PaintRecording& recording) { _recording = &recording; }
+        void stopRecording() { _recording = nullptr; }
+        bool isRecording() const { return _recording != nullptr; }
+        void replay(const PaintCommand& command);
+        PaintTileState getTileState() const;
+        void setTileState(const PaintTileState& state);
 
         /*
          * @param amount    @<eax>
@@ -427,7 +501,19 @@ namespace OpenLoco::Paint
          */
         AttachedPaintStruct* attachToPrevious(ImageId imageId, const Ui::Point& offset);
 
+        // Same as addToPlotListAsParent and attachToPrevious but masking the image with maskedImageId.
+        PaintStruct* addToPlotListAsParentMasked(ImageId imageId, ImageId maskedImageId, const World::Pos3& offset, const World::Pos3& boundBoxSize);
+        AttachedPaintStruct* attachToPreviousMasked(ImageId imageId, ImageId maskedImageId, const Ui::Point& offset);
+
     private:
+        void record(PaintCommand::Type type, ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        void markRecordingUnreplayable()
+        {
+            if (_recording != nullptr)
+            {
+                _recording->isReplayable = false;
+            }
+        }
         void generateTilesAndEntities(GenerationParameters&& p);
         void finaliseOrdering(std::span<PaintStruct*> paintStructs);
 
@@ -441,8 +527,10 @@ namespace OpenLoco::Paint
         };
         assert_struct_size(PaintEntry, 0x34);
 
-        // Do not null-initialize this, its too expensive, this is storage.
-        sfl::static_vector<PaintEntry, kMaxPaintEntries> _paintEntries;
+        PaintEntryArena* _arena{};
+        PaintRecording* _recording{};
+
+        PaintEntry* allocatePaintEntry();
 
         const Gfx::RenderTarget* _renderTarget{};
         PaintStruct* _paintHead{};
@@ -462,6 +550,7 @@ namespace OpenLoco::Paint
         void* _currentItem{};
         uint8_t currentRotation{}; // new field set from 0x00E3F0B8 but split out into this struct as separate item
         Ui::ViewportFlags _viewFlags{};
+        bool _levelOfDetail{};
         std::array<PaintStruct*, kMaxPaintQuadrants> _quadrants;
         uint32_t _quadrantBackIndex;
         uint32_t _quadrantFrontIndex;
@@ -518,14 +607,13 @@ namespace OpenLoco::Paint
         {
     // static_assert(std::same_as<T, PaintStruct> || std::same_as<T, AttachedPaintStruct> || std::same_as<T, PaintStringStruct>); // COMMENTED FOR 64-BIT DEBUG
 
-            if (_paintEntries.full())
+            auto* ps = allocatePaintEntry();
+            if (ps == nullptr)
             {
                 return nullptr;
             }
 
-            auto& ps = _paintEntries.emplace_back();
-
-            auto* specificPs = reinterpret_cast<T*>(&ps);
+            auto* specificPs = reinterpret_cast<T*>(ps);
             *specificPs = {}; // Zero out the struct
 
             return specificPs;
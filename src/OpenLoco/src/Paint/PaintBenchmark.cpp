@@ -0,0 +1,147 @@
+#include "PaintBenchmark.h"
+#include "Graphics/RenderTarget.h"
+#include "Graphics/SoftwareDrawingContext.h"
+#include "Map/TileManager.h"
+#include "Paint.h"
+#include <OpenLoco/Core/Timer.hpp>
+
+namespace OpenLoco::Paint::Benchmark
+{
+    static constexpr uint8_t kNumZoomLevels = 4;
+    static constexpr uint8_t kNumRotations = 4;
+    // Tiles along each side of the areas searched for track and road, roughly a zoomed in view.
+    static constexpr coord_t kDenseAreaSize = 32;
+
+    // Centre of the area with the most track and road elements, so that one set of views
+    // measures track and road paint even when the diagonal only crosses open countryside.
+    static World::Pos2 findTrackDenseLocation()
+    {
+        World::Pos2 best{ World::kMapWidth / 2, World::kMapHeight / 2 };
+        uint32_t bestCount = 0;
+        for (coord_t areaY = 0; areaY < World::kMapRows; areaY += kDenseAreaSize)
+        {
+            for (coord_t areaX = 0; areaX < World::kMapColumns; areaX += kDenseAreaSize)
+            {
+                uint32_t count = 0;
+                for (coord_t y = areaY; y < areaY + kDenseAreaSize; y++)
+                {
+                    for (coord_t x = areaX; x < areaX + kDenseAreaSize; x++)
+                    {
+                        for (const auto& el : World::TileManager::get(World::TilePos2(x, y)))
+                        {
+                            if (el.type() == World::ElementType::track || el.type() == World::ElementType::road)
+                            {
+                                count++;
+                            }
+                        }
+                    }
+                }
+                if (count > bestCount)
+                {
+                    bestCount = count;
+                    best = World::toWorldSpace(World::TilePos2(areaX + kDenseAreaSize / 2, areaY + kDenseAreaSize / 2));
+                }
+            }
+        }
+        return best;
+    }
+
+    std::vector<View> getDefaultViews()
+    {
+        const World::Pos2 locations[] = {
+            { World::kMapWidth / 4, World::kMapHeight / 4 },
+            { World::kMapWidth / 2, World::kMapHeight / 2 },
+            { World::kMapWidth * 3 / 4, World::kMapHeight * 3 / 4 },
+            findTrackDenseLocation(),
+        };
+
+        std::vector<View> views;
+        for (const auto& loc : locations)
+        {
+            const auto centre = World::Pos3(loc, World::TileManager::getHeight(loc).landHeight);
+            for (uint8_t zoom = 0; zoom < kNumZoomLevels; zoom++)
+            {
+                for (uint8_t rotation = 0; rotation < kNumRotations; rotation++)
+                {
+                    views.push_back(View{ centre, rotation, zoom });
+                }
+            }
+        }
+        return views;
+    }
+
+    // Splits the view into the 32 pixel columns the viewport is painted in, see Viewport::paint.
+    static std::vector<Gfx::RenderTarget> getColumns(const View& view, uint8_t* bits)
+    {
+        const auto centre = World::gameToScreen(view.centre, view.rotation);
+        const int32_t width = kViewWidth << view.zoomLevel;
+        const int32_t height = kViewHeight << view.zoomLevel;
+        const int32_t left = (centre.x - width / 2) & ~0x1F;
+        const int32_t top = centre.y - height / 2;
+
+        std::vector<Gfx::RenderTarget> columns;
+        for (auto columnX = left; columnX < left + width; columnX += 32)
+        {
+            Gfx::RenderTarget columnRt{};
+            columnRt.x = columnX;
+            columnRt.y = top;
+            columnRt.width = 32;
+            columnRt.height = height;
+            columnRt.zoomLevel = view.zoomLevel;
+            columnRt.bits = bits + ((columnX - left) >> view.zoomLevel);
+            columnRt.pitch = kViewWidth - (32 >> view.zoomLevel);
+            columns.push_back(columnRt);
+        }
+        return columns;
+    }
+
+    static void runView(ViewResult& result, Gfx::DrawingContext& drawingCtx, uint8_t* bits, int32_t iterations)
+    {
+        const auto columns = getColumns(result.view, bits);
+        result.numColumns = static_cast<uint32_t>(columns.size());
+
+        SessionOptions options{};
+        options.rotation = result.view.rotation;
+
+        for (auto i = 0; i < iterations; i++)
+        {
+            for (const auto& columnRt : columns)
+            {
+                drawingCtx.pushRenderTarget(columnRt);
+
+                auto session = PaintSession(columnRt, options);
+
+                Core::Timer timer;
+                session.generate();
+                result.generateMs += timer.elapsed();
+
+                timer.reset();
+                session.arrangeStructs();
+                result.arrangeMs += timer.elapsed();
+
+                timer.reset();
+                session.drawStructs(drawingCtx);
+                result.drawMs += timer.elapsed();
+
+                result.numPaintEntries += session.getNumPaintEntries();
+
+                drawingCtx.popRenderTarget();
+            }
+        }
+    }
+
+    std::vector<ViewResult> run(std::span<const View> views, int32_t iterations)
+    {
+        std::vector<uint8_t> buffer(kViewWidth * kViewHeight);
+        Gfx::SoftwareDrawingContext drawingCtx;
+
+        std::vector<ViewResult> results;
+        for (const auto& view : views)
+        {
+            auto& result = results.emplace_back();
+            result.view = view;
+            runView(result, drawingCtx, buffer.data(), iterations);
+        }
+        return results;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Paints fixed views of the loaded scene into offscreen buffers, timing each stage of the paint
+// pipeline separately so that paint optimisations can be compared between builds.
+namespace OpenLoco::Paint::Benchmark
+{
+    // Size in screen pixels of each benchmarked view.
+    static constexpr int16_t kViewWidth = 1024;
+    static constexpr int16_t kViewHeight = 768;
+
+    struct View
+    {
+        World::Pos3 centre;
+        uint8_t rotation;
+        uint8_t zoomLevel;
+    };
+
+    struct ViewResult
+    {
+        View view;
+        uint32_t numColumns{};
+        // Totals over all iterations.
+        double generateMs{};
+        double arrangeMs{};
+        double drawMs{};
+        uint64_t numPaintEntries{};
+    };
+
+    // Three locations along the map diagonal and the area with the most track and road, at
+    // every zoom level and rotation.
+    std::vector<View> getDefaultViews();
+
+    std::vector<ViewResult> run(std::span<const View> views, int32_t iterations);
+}
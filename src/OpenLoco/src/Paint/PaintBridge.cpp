@@ -4,6 +4,7 @@
 #include "Objects/BridgeObject.h"
 #include "Objects/ObjectManager.h"
 #include "Paint.h"
+#include "PaintTileCache.h"
 #include "Ui/ViewportInteraction.h"
 #include <OpenLoco/Core/Numerics.hpp>
 
@@ -1186,7 +1187,7 @@ namespace OpenLoco::Paint
     }
 
     // 0x0042AC9C
-    bool paintBridge(PaintSession& session)
+    static bool paintBridgeDeckAndSupports(PaintSession& session)
     {
         session.setItemType(Ui::ViewportInteraction::InteractionItem::bridge);
 
@@ -1415,4 +1416,70 @@ namespace OpenLoco::Paint
         }
         return true;
     }
+
+    static PaintTileCache::BridgeKey makeBridgeKey(PaintSession& session, const BridgeEntry& bridgeEntry)
+    {
+        const auto* bridgeObj = ObjectManager::get<BridgeObject>(bridgeEntry.objectId);
+        const auto spanTile = World::toTileSpace(Math::Vector::rotate(session.getUnkPosition(), session.getRotation())) + kTwosToOnesCompliment[session.getRotation()];
+
+        PaintTileCache::BridgeKey key{};
+        key.imageBase = bridgeEntry.imageBase.toUInt32();
+        key.subType = bridgeEntry.subType;
+        key.height = bridgeEntry.height;
+        key.edgesQuarters = bridgeEntry.edgesQuarters;
+        key.objectId = bridgeEntry.objectId;
+        key.generalSupportHeight = session.getGeneralSupportHeight().height;
+        key.generalSupportSlope = session.getGeneralSupportHeight().slope;
+        for (uint8_t segment = 0; segment < 9; ++segment)
+        {
+            if (session.getSupportHeight(segment).height == 0xFFFFU)
+            {
+                key.freeSupportSegments |= 1U << segment;
+            }
+        }
+        key.waterHeight = session.getWaterHeight();
+        key.waterHeight2 = session.getWaterHeight2();
+        key.surfaceHeight = session.getSurfaceHeight();
+        key.surfaceSlope = session.getSurfaceSlope();
+        key.rotation = session.getRotation();
+        key.spanX = static_cast<uint8_t>(spanTile.x & (bridgeObj->spanLength - 1));
+        key.spanY = static_cast<uint8_t>(spanTile.y & (bridgeObj->spanLength - 1));
+        key.paintShadow = session.getRenderTarget()->zoomLevel <= 1;
+        return key;
+    }
+
+    bool paintBridge(PaintSession& session)
+    {
+        const auto& bridgeEntry = session.getBridgeEntry();
+        if (bridgeEntry.isEmpty() || !PaintTileCache::isEnabled() || session.isRecording())
+        {
+            return paintBridgeDeckAndSupports(session);
+        }
+
+        // The deck and supports only depend on the session state, so the paint calls made for one
+        // tile are replayed for every other tile with the same state.
+        const auto key = makeBridgeKey(session, bridgeEntry);
+        {
+            const PaintTileCache::BridgeLookup lookup(key);
+            if (lookup.get() != nullptr)
+            {
+                session.setItemType(Ui::ViewportInteraction::InteractionItem::bridge);
+                for (const auto& command : lookup.get()->commands)
+                {
+                    session.replay(command);
+                }
+                return lookup.get()->isPainted;
+            }
+        }
+
+        PaintRecording recording;
+        session.startRecording(recording);
+        const auto isPainted = paintBridgeDeckAndSupports(session);
+        session.stopRecording();
+        if (recording.isReplayable)
+        {
+            PaintTileCache::storeBridge(key, std::move(recording.commands), isPainted);
+        }
+        return isPainted;
+    }
 }
@@ -7,6 +7,8 @@
 #include "Paint.h"
 #include "ScenarioManager.h"
 #include "Ui/ViewportInteraction.h"
+#include <array>
+#include <vector>
 
 namespace OpenLoco::Paint
 {
@@ -19,6 +21,84 @@ namespace OpenLoco::Paint
     constexpr World::Pos3 kBBSizeBase1x1 = { 26, 26, 0 };
     constexpr World::Pos3 kBBSizeBase2x2 = { 38, 38, 0 };
 
+    struct BuildingPaintPart
+    {
+        uint32_t imageIndex; // Rotation 0, add the rotation for the others
+        uint16_t zOffset;
+    };
+
+    // The parts of a completed variation in paint order, static when none of them animate
+    struct BuildingPaintSequence
+    {
+        std::vector<BuildingPaintPart> parts;
+        bool isStatic;
+    };
+
+    // Built when a building object is loaded as paint runs on several threads
+    static std::array<std::vector<BuildingPaintSequence>, ObjectManager::getMaxObjects(ObjectType::building)> _paintSequences;
+
+    void buildBuildingPaintSequences(const uint16_t buildingObjectId)
+    {
+        auto& sequences = _paintSequences[buildingObjectId];
+        sequences.clear();
+
+        const auto* buildingObj = ObjectManager::get<BuildingObject>(buildingObjectId);
+        const auto partHeights = buildingObj->getBuildingPartHeights();
+        const auto partAnimations = buildingObj->getBuildingPartAnimations();
+        for (auto variation = 0; variation < buildingObj->numVariations; ++variation)
+        {
+            auto& sequence = sequences.emplace_back();
+            sequence.isStatic = true;
+            uint16_t zOffset = 0;
+            const auto parts = buildingObj->getBuildingParts(variation);
+            // The section count used while painting wraps around with this many parts
+            if (parts.size() > 64)
+            {
+                sequence.isStatic = false;
+            }
+            for (const auto part : parts)
+            {
+                // A frame count of 0 still animates through the whole tick count
+                if (partAnimations[part].numFrames != 1)
+                {
+                    sequence.isStatic = false;
+                }
+                sequence.parts.push_back(BuildingPaintPart{ part * 4 + buildingObj->image, zOffset });
+                zOffset += partHeights[part];
+            }
+        }
+    }
+
+    static void paintElevators(PaintSession& session, const BuildingObject& buildingObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation)
+    {
+        for (auto animIdx = 0; animIdx < buildingObj.numElevatorSequences; ++animIdx)
+        {
+            auto sequence = buildingObj.getElevatorHeightSequence(animIdx);
+            auto tickThing = ScenarioManager::getScenarioTicks() / 2;
+            auto pos = World::toTileSpace(session.getUnkPosition());
+            tickThing += pos.x * 8;
+            tickThing += pos.y * 8;
+            // Sequence is always a power of 2 so (& -1) is like modulo
+            const auto seqIdx = tickThing & (sequence.size() - 1);
+            const auto elevatorHeight = sequence[seqIdx];
+
+            const auto image = baseColour.withIndex(buildingObj.image + buildingObj.numParts * 4 + animIdx * 4 + rotation);
+
+            const auto offset = imageOffset + World::Pos3(0, 0, elevatorHeight);
+            session.addToPlotListAsChild(image, offset, bbOffset, bbSize);
+        }
+    }
+
+    // Completed buildings without animated parts, the common case in towns
+    static void paintStaticBuildingParts(PaintSession& session, const BuildingPaintSequence& sequence, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation)
+    {
+        for (const auto& part : sequence.parts)
+        {
+            const auto image = baseColour.withIndex(part.imageIndex + rotation);
+            session.addToPlotListAsChild(image, imageOffset + World::Pos3(0, 0, part.zOffset), bbOffset, bbSize);
+        }
+    }
+
     static void paintBuildingBuilding(PaintSession& session, const World::BuildingElement& elBuilding, const BuildingObject& buildingObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation, const bool isMultiTile)
     {
         // 0xE0C3A0
@@ -34,6 +114,14 @@ namespace OpenLoco::Paint
         }
 
         uint32_t variation = elBuilding.variation();
+        const auto& sequences = _paintSequences[elBuilding.objectId()];
+        if (numSections == 0xF0 && variation < sequences.size() && sequences[variation].isStatic)
+        {
+            paintStaticBuildingParts(session, sequences[variation], imageOffset, bbOffset, bbSize, baseColour, rotation);
+            paintElevators(session, buildingObj, imageOffset, bbOffset, bbSize, baseColour, rotation);
+            return;
+        }
+
         const auto parts = buildingObj.getBuildingParts(variation);
 
         // 0x00525D4F
@@ -142,22 +230,7 @@ namespace OpenLoco::Paint
 
         if (totalSectionHeight == 0)
         {
-            for (auto animIdx = 0; animIdx < buildingObj.numElevatorSequences; ++animIdx)
-            {
-                auto sequence = buildingObj.getElevatorHeightSequence(animIdx);
-                auto tickThing = ScenarioManager::getScenarioTicks() / 2;
-                auto pos = World::toTileSpace(session.getUnkPosition());
-                tickThing += pos.x * 8;
-                tickThing += pos.y * 8;
-                // Sequence is always a power of 2 so (& -1) is like modulo
-                const auto seqIdx = tickThing & (sequence.size() - 1);
-                const auto elevatorHeight = sequence[seqIdx];
-
-                const auto image = baseColour.withIndex(buildingObj.image + buildingObj.numParts * 4 + animIdx * 4 + rotation);
-
-                const auto offset = imageOffset + World::Pos3(0, 0, elevatorHeight);
-                session.addToPlotListAsChild(image, offset, bbOffset, bbSize);
-            }
+            paintElevators(session, buildingObj, imageOffset, bbOffset, bbSize, baseColour, rotation);
         }
     }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace OpenLoco::World
 {
     struct BuildingElement;
@@ -9,4 +11,7 @@ namespace OpenLoco::Paint
     struct PaintSession;
 
     void paintBuilding(PaintSession& session, const World::BuildingElement& elBuilding);
+
+    // Precomputes the part images and heights of each variation, call when the object is loaded
+    void buildBuildingPaintSequences(uint16_t buildingObjectId);
 }
@@ -9,6 +9,8 @@
 #include "Ui.h"
 #include "Ui/ViewportInteraction.h"
 #include "World/Industry.h"
+#include <array>
+#include <vector>
 
 namespace OpenLoco::Paint
 {
@@ -21,7 +23,64 @@ namespace OpenLoco::Paint
     constexpr World::Pos3 kBBSizeBase1x1 = { 26, 26, 0 };
     constexpr World::Pos3 kBBSizeBase2x2 = { 38, 38, 0 };
 
-    static void paintIndustryBuilding(PaintSession& session, const World::IndustryElement& elIndustry, const IndustryObject& indObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation, const bool isMultiTile)
+    struct IndustryPaintPart
+    {
+        uint32_t imageIndex; // Rotation 0, add the rotation for the others
+        uint16_t zOffset;
+    };
+
+    // The parts of a completed building type in paint order, static when none of them animate
+    struct IndustryPaintSequence
+    {
+        std::vector<IndustryPaintPart> parts;
+        bool isStatic;
+    };
+
+    // Built when an industry object is loaded as paint runs on several threads
+    static std::array<std::vector<IndustryPaintSequence>, ObjectManager::getMaxObjects(ObjectType::industry)> _paintSequences;
+
+    void buildIndustryPaintSequences(const uint16_t industryObjectId)
+    {
+        auto& sequences = _paintSequences[industryObjectId];
+        sequences.clear();
+
+        const auto* indObj = ObjectManager::get<IndustryObject>(industryObjectId);
+        const auto partHeights = indObj->getBuildingPartHeights();
+        const auto partAnimations = indObj->getBuildingPartAnimations();
+        for (auto buildingType = 0; buildingType < indObj->numBuildingVariations; ++buildingType)
+        {
+            auto& sequence = sequences.emplace_back();
+            sequence.isStatic = true;
+            uint16_t zOffset = 0;
+            const auto parts = indObj->getBuildingParts(buildingType);
+            // The section count used while painting wraps around with this many parts
+            if (parts.size() > 64)
+            {
+                sequence.isStatic = false;
+            }
+            for (const auto part : parts)
+            {
+                if (partAnimations[part].numFrames > 1)
+                {
+                    sequence.isStatic = false;
+                }
+                sequence.parts.push_back(IndustryPaintPart{ part * 4 + indObj->buildingImageIds, zOffset });
+                zOffset += partHeights[part];
+            }
+        }
+    }
+
+    // Completed buildings without animated parts or an active animation sequence
+    static void paintStaticIndustryParts(PaintSession& session, const IndustryPaintSequence& sequence, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation)
+    {
+        for (const auto& part : sequence.parts)
+        {
+            const auto image = baseColour.withIndex(part.imageIndex + rotation);
+            session.addToPlotListAsChild(image, imageOffset + World::Pos3(0, 0, part.zOffset), bbOffset, bbSize);
+        }
+    }
+
+    static void paintIndustryBuilding(PaintSession& session, const World::IndustryElement& elIndustry, const uint8_t objectId, const IndustryObject& indObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation, const bool isMultiTile)
     {
         // 0xE0C3A0
         auto ticks = ScenarioManager::getScenarioTicks();
@@ -42,6 +101,13 @@ namespace OpenLoco::Paint
         }
 
         uint32_t buildingType = elIndustry.buildingType();
+        const auto& sequences = _paintSequences[objectId];
+        if (numSections == 0xF0 && animationSequence.empty() && buildingType < sequences.size() && sequences[buildingType].isStatic)
+        {
+            paintStaticIndustryParts(session, sequences[buildingType], imageOffset, bbOffset, bbSize, baseColour, rotation);
+            return;
+        }
+
         const auto buildingParts = indObj.getBuildingParts(buildingType);
         const auto partHeights = indObj.getBuildingPartHeights();
         const auto buildingPartAnims = indObj.getBuildingPartAnimations();
@@ -211,14 +277,14 @@ namespace OpenLoco::Paint
             // Only the front of the 2x2 area will draw. Images are sized to overlap into the other tiles.
             if ((sequenceIndex ^ (1 << 1)) == ((-session.getRotation()) & 0x3))
             {
-                paintIndustryBuilding(session, elIndustry, *indObj, imageOffset, bbOffset, bbSize, baseColour, rotation, isMultiTile);
+                paintIndustryBuilding(session, elIndustry, industry->objectId, *indObj, imageOffset, bbOffset, bbSize, baseColour, rotation, isMultiTile);
             }
             session.setSegmentsSupportHeight(SegmentFlags::all, 0xFFFF, 0);
             session.setGeneralSupportHeight(0xFFFF, 0); // TODO: Check if this works previously would not set slope to zero
         }
         else
         {
-            paintIndustryBuilding(session, elIndustry, *indObj, imageOffset, bbOffset, bbSize, baseColour, rotation, isMultiTile);
+            paintIndustryBuilding(session, elIndustry, industry->objectId, *indObj, imageOffset, bbOffset, bbSize, baseColour, rotation, isMultiTile);
         }
     }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace OpenLoco::World
 {
     struct IndustryElement;
@@ -9,4 +11,7 @@ namespace OpenLoco::Paint
     struct PaintSession;
 
     void paintIndustry(PaintSession& session, const World::IndustryElement& elIndustry);
+
+    // Precomputes the part images and heights of each variation, call when the object is loaded
+    void buildIndustryPaintSequences(uint16_t industryObjectId);
 }
@@ -170,6 +170,44 @@ namespace OpenLoco::Paint
         }
     }
 
+    std::optional<Ui::ViewportRect> getLevelCrossingScreenBounds(const World::RoadElement& elRoad, const World::Pos2& pos, const uint8_t frame, const uint8_t viewRotation)
+    {
+        if (!elRoad.hasLevelCrossing())
+        {
+            return std::nullopt;
+        }
+
+        auto* crossingObj = ObjectManager::get<LevelCrossingObject>(elRoad.levelCrossingObjectId());
+        const auto rotation = (viewRotation + elRoad.rotation()) & 0x3;
+        const auto offset = World::Pos3{ 0, 0, elRoad.baseHeight() };
+
+        std::optional<Ui::ViewportRect> bounds;
+        auto addFrame = [&](uint32_t paintedFrame) {
+            const uint32_t imageIndex0 = crossingObj->image + ((rotation & 1) * 4) + (paintedFrame * 8);
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                const auto imageBounds = getImageScreenBounds(imageIndex0 + i, pos, offset, viewRotation);
+                bounds = bounds ? bounds->getUnion(imageBounds) : imageBounds;
+            }
+        };
+        for (const auto elementFrame : { elRoad.unk6l(), frame })
+        {
+            if (elementFrame == 15)
+            {
+                // Flashing, see paintLevelCrossing
+                for (uint32_t i = 0; i < crossingObj->closingFrames; i++)
+                {
+                    addFrame(crossingObj->closedFrames + 1 + i);
+                }
+            }
+            else
+            {
+                addFrame(elementFrame);
+            }
+        }
+        return bounds;
+    }
+
     constexpr std::array<std::array<uint32_t, 4>, 3> kStreetlightImageFromStyle = {
         std::array<uint32_t, 4>{
             Streetlight::ImageIds::kStyle0NE,
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Viewport.hpp"
+#include <optional>
+
 namespace OpenLoco::World
 {
     struct RoadElement;
@@ -10,4 +13,8 @@ namespace OpenLoco::Paint
 
     void paintRoad(PaintSession& session, const World::RoadElement& elRoad);
     void finalisePaintRoad(PaintSession& session);
+
+    // The screen area of the level crossing of the road element for both its current frame and frame,
+    // nothing when it has no level crossing.
+    std::optional<Ui::ViewportRect> getLevelCrossingScreenBounds(const World::RoadElement& elRoad, const World::Pos2& pos, uint8_t frame, uint8_t viewRotation);
 }
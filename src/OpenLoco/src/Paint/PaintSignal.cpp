@@ -22,6 +22,9 @@ using namespace OpenLoco::Ui::ViewportInteraction;
 
 namespace OpenLoco::Paint
 {
+    // Level of detail, see PaintSession::isDetailHidden. Vanilla only skips signals beyond zoom level 1.
+    static constexpr uint8_t kSignalMinZoom = 1;
+
     struct OffsetAndBBOffset
     {
         World::Pos2 offset;
@@ -143,6 +146,23 @@ namespace OpenLoco::Paint
         }
     }
 
+    struct SignalPlacement
+    {
+        const OffsetAndBBOffset& offsetAndBBOffset;
+        World::Pos3 offset;
+        uint32_t imageRotationOffset;
+    };
+
+    static SignalPlacement getSignalPlacement(const TrainSignalObject& signalObj, const bool isRight, const uint8_t trackId, const uint8_t rotation, const coord_t height)
+    {
+        const auto trackRotation = getTrackRotation(isRight, trackId, rotation);
+        const auto& offsetAndBBoffsetArr = signalObj.hasFlags(TrainSignalObjectFlags::isLeft) ? _4FE870 : _4FE830;
+        const auto& offsetAndBBoffset = offsetAndBBoffsetArr[trackRotation];
+        const auto imageRotationOffset = ((trackRotation & 0x3) << 1) | (trackRotation >= 12 ? 1 : 0);
+        const World::Pos3 offset(offsetAndBBoffset.offset.x, offsetAndBBoffset.offset.y, getSignalHeightOffset(isRight, trackId) + height);
+        return SignalPlacement{ offsetAndBBoffset, offset, static_cast<uint32_t>(imageRotationOffset) };
+    }
+
     static void paintSignalSide(PaintSession& session, const World::SignalElement::Side& side, const bool isRight, const bool isGhost, const uint8_t trackId, const uint8_t rotation, const coord_t height)
     {
         if (side.hasSignal())
@@ -150,10 +170,9 @@ namespace OpenLoco::Paint
             session.setItemType(InteractionItem::signal);
             session.setTrackModId(isRight ? 1 : 0);
             auto* signalObj = ObjectManager::get<TrainSignalObject>(side.signalObjectId());
-            const auto trackRotation = getTrackRotation(isRight, trackId, rotation);
-            const auto& offsetAndBBoffsetArr = signalObj->hasFlags(TrainSignalObjectFlags::isLeft) ? _4FE870 : _4FE830;
-            const auto& offsetAndBBoffset = offsetAndBBoffsetArr[trackRotation];
-            const auto imageRotationOffset = ((trackRotation & 0x3) << 1) | (trackRotation >= 12 ? 1 : 0);
+            const auto placement = getSignalPlacement(*signalObj, isRight, trackId, rotation, height);
+            const auto& offsetAndBBoffset = placement.offsetAndBBOffset;
+            const auto imageRotationOffset = placement.imageRotationOffset;
             const auto imageOffset = imageRotationOffset + signalObj->image + (side.frame() << 3);
 
             ImageId imageId{ imageOffset };
@@ -162,7 +181,7 @@ namespace OpenLoco::Paint
                 session.setItemType(InteractionItem::noInteraction);
                 imageId = Gfx::applyGhostToImage(imageOffset);
             }
-            World::Pos3 offset(offsetAndBBoffset.offset.x, offsetAndBBoffset.offset.y, getSignalHeightOffset(isRight, trackId) + height);
+            World::Pos3 offset = placement.offset;
             World::Pos3 bbOffset(offsetAndBBoffset.boundingOffset.x, offsetAndBBoffset.boundingOffset.y, offset.z + 4);
             World::Pos3 bbSize(1, 1, 14);
             session.addToPlotListAsParent(imageId, offset, bbOffset, bbSize);
@@ -230,7 +249,7 @@ namespace OpenLoco::Paint
             return;
         }
 
-        if (session.getRenderTarget()->zoomLevel > 1)
+        if (session.getRenderTarget()->zoomLevel > 1 || session.isDetailHidden(kSignalMinZoom))
         {
             return;
         }
@@ -253,4 +272,43 @@ namespace OpenLoco::Paint
         const bool rightIsGhost = elSignal.isGhost() || elSignal.isRightGhost();
         paintSignalSide(session, rightSignal, true, rightIsGhost, trackId, rotation, height);
     }
+
+    std::optional<Ui::ViewportRect> getSignalSideScreenBounds(const World::SignalElement& elSignal, const World::Pos2& pos, const bool isRight, const uint8_t viewRotation)
+    {
+        if (elSignal.isAiAllocated())
+        {
+            return std::nullopt;
+        }
+        auto* elTrack = elSignal.prev()->as<World::TrackElement>();
+        if (elTrack == nullptr)
+        {
+            return std::nullopt;
+        }
+        // Same sides as paintSignal
+        if (isRight ? !elTrack->isFlag6() : elTrack->sequenceIndex() != 0)
+        {
+            return std::nullopt;
+        }
+        const auto& side = isRight ? elSignal.getRight() : elSignal.getLeft();
+        if (!side.hasSignal())
+        {
+            return std::nullopt;
+        }
+
+        const auto* signalObj = ObjectManager::get<TrainSignalObject>(side.signalObjectId());
+        const auto rotation = (viewRotation + elSignal.rotation()) & 0x3;
+        const auto placement = getSignalPlacement(*signalObj, isRight, elTrack->trackId(), rotation, elSignal.baseHeight());
+        const auto imageBase = placement.imageRotationOffset + signalObj->image;
+
+        auto bounds = getImageScreenBounds(imageBase + (side.frame() << 3), pos, placement.offset, viewRotation);
+        if (signalObj->hasFlags(TrainSignalObjectFlags::hasLights))
+        {
+            // Whichever lights were on before the change are covered as well
+            for (const auto lightOffset : { TrainSignal::ImageIds::redLights, TrainSignal::ImageIds::redLights2, TrainSignal::ImageIds::greenLights, TrainSignal::ImageIds::greenLights2 })
+            {
+                bounds = bounds.getUnion(getImageScreenBounds(imageBase + lightOffset, pos, placement.offset, viewRotation));
+            }
+        }
+        return bounds;
+    }
 }
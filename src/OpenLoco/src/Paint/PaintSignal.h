@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Viewport.hpp"
+#include <optional>
+
 namespace OpenLoco::World
 {
     struct SignalElement;
@@ -9,4 +12,8 @@ namespace OpenLoco::Paint
     struct PaintSession;
 
     void paintSignal(PaintSession& session, const World::SignalElement& elSignal);
+
+    // The screen area of one side of the signal covering its current frame and all of its lights, nothing
+    // when that side has no signal or isn't painted.
+    std::optional<Ui::ViewportRect> getSignalSideScreenBounds(const World::SignalElement& elSignal, const World::Pos2& pos, bool isRight, uint8_t viewRotation);
 }
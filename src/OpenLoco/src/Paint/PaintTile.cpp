@@ -24,12 +24,14 @@
 #include "PaintSignal.h"
 #include "PaintStation.h"
 #include "PaintSurface.h"
+#include "PaintTileCache.h"
 #include "PaintTrack.h"
 #include "PaintTree.h"
 #include "PaintWall.h"
 #include "Ui.h"
 #include "Ui/ViewportInteraction.h"
 #include "World/Station.h"
+#include <optional>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui::ViewportInteraction;
@@ -293,6 +295,149 @@ namespace OpenLoco::Paint
         }
     }
 
+    static void paintTileElement(PaintSession& session, World::TileElement& el)
+    {
+        switch (el.type())
+        {
+            case World::ElementType::surface:
+            {
+                auto& elSurface = el.get<World::SurfaceElement>();
+                paintSurface(session, elSurface);
+                break;
+            }
+            case World::ElementType::track:
+            {
+                auto& elTrack = el.get<World::TrackElement>();
+                paintTrack(session, elTrack);
+                break;
+            }
+            case World::ElementType::station:
+            {
+                auto& elStation = el.get<World::StationElement>();
+                paintStation(session, elStation);
+                break;
+            }
+            case World::ElementType::signal:
+            {
+                auto& elSignal = el.get<World::SignalElement>();
+                paintSignal(session, elSignal);
+                break;
+            }
+            case World::ElementType::building:
+            {
+                auto& elBuilding = el.get<World::BuildingElement>();
+                paintBuilding(session, elBuilding);
+
+                break;
+            }
+            case World::ElementType::tree:
+            {
+                auto& elTree = el.get<World::TreeElement>();
+                paintTree(session, elTree);
+                break;
+            }
+            case World::ElementType::wall:
+            {
+                auto& elWall = el.get<World::WallElement>();
+                paintWall(session, elWall);
+                break;
+            }
+            case World::ElementType::road:
+            {
+                auto& elRoad = el.get<World::RoadElement>();
+                paintRoad(session, elRoad);
+                break;
+            }
+            case World::ElementType::industry:
+            {
+                auto& elIndustry = el.get<World::IndustryElement>();
+                paintIndustry(session, elIndustry);
+                break;
+            }
+        }
+    }
+
+    static void paintTileElementsLoop(PaintSession& session, World::Tile& tile, int16_t vpY, PaintRecording* recording)
+    {
+        uint8_t elementIndex = 0;
+        for (auto& el : tile)
+        {
+            if (recording != nullptr)
+            {
+                recording->elementIndex = elementIndex++;
+            }
+            session.setUnkVpY(vpY - el.baseHeight());
+            session.setCurrentItem(&el);
+            paintTileElement(session, el);
+            paintTileElementsEndLoop(session, el);
+        }
+    }
+
+    static void replayTileElements(PaintSession& session, World::Tile& tile, int16_t vpY, const PaintTileCache::CachedTile& cachedTile)
+    {
+        auto command = cachedTile.commands.begin();
+        uint8_t elementIndex = 0;
+        for (auto& el : tile)
+        {
+            session.setUnkVpY(vpY - el.baseHeight());
+            session.setCurrentItem(&el);
+            for (; command != cachedTile.commands.end() && command->elementIndex == elementIndex; ++command)
+            {
+                session.replay(*command);
+            }
+            elementIndex++;
+            paintTileElementsEndLoop(session, el);
+        }
+        session.setTileState(cachedTile.state);
+    }
+
+    // Paints the elements of the tile as usual apart from the surface, whose paint calls are replayed
+    // when the tile has not changed since they were recorded.
+    static void paintTileElementsCachedSurface(PaintSession& session, const World::Pos2& loc, World::Tile& tile, int16_t vpY)
+    {
+        const auto key = PaintTileCache::makeKey(session, loc, tile);
+
+        std::optional<PaintRecording> recording;
+        PaintTileState recordedState{};
+        for (auto& el : tile)
+        {
+            session.setUnkVpY(vpY - el.baseHeight());
+            session.setCurrentItem(&el);
+            if (el.type() != World::ElementType::surface)
+            {
+                paintTileElement(session, el);
+                paintTileElementsEndLoop(session, el);
+                continue;
+            }
+
+            {
+                const PaintTileCache::Lookup lookup(key);
+                if (lookup.get() != nullptr)
+                {
+                    for (const auto& command : lookup.get()->commands)
+                    {
+                        session.replay(command);
+                    }
+                    session.setTileState(lookup.get()->state);
+                    paintTileElementsEndLoop(session, el);
+                    continue;
+                }
+            }
+
+            recording.emplace();
+            session.startRecording(*recording);
+            paintTileElement(session, el);
+            session.stopRecording();
+            recordedState = session.getTileState();
+            paintTileElementsEndLoop(session, el);
+        }
+
+        if (recording.has_value() && recording->isReplayable)
+        {
+            PaintTileCache::store(key, std::move(recording->commands), recordedState);
+        }
+    }
+
     // 0x00461CF8
     void paintTileElements(PaintSession& session, const World::Pos2& loc)
     {
@@ -309,69 +454,34 @@ namespace OpenLoco::Paint
         }
 
         auto tile = TileManager::get(loc);
-        for (auto& el : tile)
+        if (!PaintTileCache::isCacheable(tile))
         {
-            session.setUnkVpY(vpPos->y - el.baseHeight());
-            session.setCurrentItem(&el);
-            switch (el.type())
+            if (PaintTileCache::isSurfaceCacheable(tile))
             {
-                case World::ElementType::surface:
-                {
-                    auto& elSurface = el.get<World::SurfaceElement>();
-                    paintSurface(session, elSurface);
-                    break;
-                }
-                case World::ElementType::track:
-                {
-                    auto& elTrack = el.get<World::TrackElement>();
-                    paintTrack(session, elTrack);
-                    break;
-                }
-                case World::ElementType::station:
-                {
-                    auto& elStation = el.get<World::StationElement>();
-                    paintStation(session, elStation);
-                    break;
-                }
-                case World::ElementType::signal:
-                {
-                    auto& elSignal = el.get<World::SignalElement>();
-                    paintSignal(session, elSignal);
-                    break;
-                }
-                case World::ElementType::building:
-                {
-                    auto& elBuilding = el.get<World::BuildingElement>();
-                    paintBuilding(session, elBuilding);
+                paintTileElementsCachedSurface(session, loc, tile, vpPos->y);
+                return;
+            }
+            paintTileElementsLoop(session, tile, vpPos->y, nullptr);
+            return;
+        }
 
-                    break;
-                }
-                case World::ElementType::tree:
-                {
-                    auto& elTree = el.get<World::TreeElement>();
-                    paintTree(session, elTree);
-                    break;
-                }
-                case World::ElementType::wall:
-                {
-                    auto& elWall = el.get<World::WallElement>();
-                    paintWall(session, elWall);
-                    break;
-                }
-                case World::ElementType::road:
-                {
-                    auto& elRoad = el.get<World::RoadElement>();
-                    paintRoad(session, elRoad);
-                    break;
-                }
-                case World::ElementType::industry:
-                {
-                    auto& elIndustry = el.get<World::IndustryElement>();
-                    paintIndustry(session, elIndustry);
-                    break;
-                }
+        const auto key = PaintTileCache::makeKey(session, loc, tile);
+        {
+            const PaintTileCache::Lookup lookup(key);
+            if (lookup.get() != nullptr)
+            {
+                replayTileElements(session, tile, vpPos->y, *lookup.get());
+                return;
             }
-            paintTileElementsEndLoop(session, el);
+        }
+
+        PaintRecording recording;
+        session.startRecording(recording);
+        paintTileElementsLoop(session, tile, vpPos->y, &recording);
+        session.stopRecording();
+        if (recording.isReplayable)
+        {
+            PaintTileCache::store(key, std::move(recording.commands), session.getTileState());
         }
     }
 
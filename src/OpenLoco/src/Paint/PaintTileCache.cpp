@@ -0,0 +1,240 @@
+#include "PaintTileCache.h"
+#include "Config.h"
+#include "Graphics/RenderTarget.h"
+#include "Map/MapSelection.h"
+#include "Map/SurfaceElement.h"
+#include "Map/TileManager.h"
+#include <array>
+#include <cstring>
+#include <mutex>
+
+namespace OpenLoco::Paint::PaintTileCache
+{
+    // Tiles are stored in the slot their location hashes to, replacing whatever was there before.
+    static constexpr size_t kNumSlots = 8192;
+
+    struct Slot
+    {
+        bool isUsed = false;
+        CachedTile tile;
+    };
+
+    static std::shared_mutex _mutex;
+    static std::vector<Slot> _slots;
+
+    // Bridges only have a handful of distinct looks, so few slots are needed.
+    static constexpr size_t kNumBridgeSlots = 1024;
+
+    struct BridgeSlot
+    {
+        bool isUsed = false;
+        CachedBridge bridge;
+    };
+
+    static std::vector<BridgeSlot> _bridgeSlots;
+
+    static size_t getSlotIndex(const World::Pos2& loc)
+    {
+        const auto tilePos = World::toTileSpace(loc);
+        return ((static_cast<uint32_t>(tilePos.x) * 0x9E3779B1U) ^ static_cast<uint32_t>(tilePos.y)) % kNumSlots;
+    }
+
+    static size_t getBridgeSlotIndex(const BridgeKey& key)
+    {
+        uint32_t hash = key.imageBase;
+        const auto combine = [&hash](uint32_t value) { hash = (hash ^ value) * 0x01000193U; };
+        combine(key.subType | (static_cast<uint16_t>(key.height) << 16));
+        combine(key.edgesQuarters | (key.objectId << 8) | (key.generalSupportSlope << 16) | (key.surfaceSlope << 24));
+        combine(key.generalSupportHeight | (key.freeSupportSegments << 16));
+        combine(static_cast<uint16_t>(key.waterHeight) | (static_cast<uint16_t>(key.waterHeight2) << 16));
+        combine(static_cast<uint16_t>(key.surfaceHeight) | (key.rotation << 16) | (key.spanX << 20) | (key.spanY << 24) | (key.paintShadow << 28));
+        return hash % kNumBridgeSlots;
+    }
+
+    static uint64_t toContents(const World::TileElement& el)
+    {
+        uint64_t value;
+        static_assert(sizeof(value) == sizeof(el));
+        std::memcpy(&value, &el, sizeof(value));
+        return value;
+    }
+
+    bool isEnabled()
+    {
+        return Config::get().cacheStaticTilePaint;
+    }
+
+    bool isCacheable(const World::Tile& tile)
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        // Selections and catchment areas are drawn onto the surfaces.
+        constexpr auto kSurfaceSelectionFlags = World::MapSelectionFlags::enable | World::MapSelectionFlags::enableConstruct | World::MapSelectionFlags::catchmentArea;
+        if (World::hasMapSelectionFlag(kSurfaceSelectionFlags))
+        {
+            return false;
+        }
+
+        size_t numElements = 0;
+        for (const auto& el : tile)
+        {
+            if (++numElements > kMaxTileElements)
+            {
+                return false;
+            }
+            switch (el.type())
+            {
+                case World::ElementType::surface:
+                    // Water is animated by the waves.
+                    if (el.get<World::SurfaceElement>().water() != 0)
+                    {
+                        return false;
+                    }
+                    break;
+                case World::ElementType::tree:
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    bool isSurfaceCacheable(const World::Tile& tile)
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        constexpr auto kSurfaceSelectionFlags = World::MapSelectionFlags::enable | World::MapSelectionFlags::enableConstruct | World::MapSelectionFlags::catchmentArea;
+        if (World::hasMapSelectionFlag(kSurfaceSelectionFlags))
+        {
+            return false;
+        }
+
+        // Elements painted before the surface, such as tunnels, are part of the key so the surface
+        // paint calls are still only reused for an identical tile.
+        size_t numElements = 0;
+        size_t numSurfaces = 0;
+        for (const auto& el : tile)
+        {
+            if (++numElements > kMaxTileElements)
+            {
+                return false;
+            }
+            if (el.type() == World::ElementType::surface)
+            {
+                if (el.get<World::SurfaceElement>().water() != 0)
+                {
+                    return false;
+                }
+                numSurfaces++;
+            }
+        }
+        return numSurfaces == 1;
+    }
+
+    TileKey makeKey(PaintSession& session, const World::Pos2& loc, const World::Tile& tile)
+    {
+        TileKey key{};
+        key.loc = loc;
+        key.rotation = session.getRotation();
+        key.zoomLevel = session.getRenderTarget()->zoomLevel;
+        key.viewFlags = session.getViewFlags();
+        key.landscapeSmoothing = Config::get().landscapeSmoothing;
+        key.levelOfDetail = Config::get().paintLevelOfDetail;
+
+        for (const auto& el : tile)
+        {
+            key.contents.push_back(toContents(el));
+        }
+
+        constexpr std::array<World::Pos2, 4> kNeighbourOffsets = {
+            World::Pos2{ -World::kTileSize, 0 },
+            World::Pos2{ 0, World::kTileSize },
+            World::Pos2{ World::kTileSize, 0 },
+            World::Pos2{ 0, -World::kTileSize },
+        };
+        for (const auto& offset : kNeighbourOffsets)
+        {
+            const auto neighbourPos = loc + offset;
+            const World::SurfaceElement* surface = nullptr;
+            if (World::validCoords(neighbourPos))
+            {
+                surface = World::TileManager::get(neighbourPos).surface();
+            }
+            // An element with every bit set is not a surface so this can not be confused with one.
+            key.contents.push_back(surface != nullptr ? toContents(*reinterpret_cast<const World::TileElement*>(surface)) : ~0ULL);
+        }
+        return key;
+    }
+
+    Lookup::Lookup(const TileKey& key)
+        : _lock(_mutex)
+    {
+        if (_slots.empty())
+        {
+            return;
+        }
+        const auto& slot = _slots[getSlotIndex(key.loc)];
+        if (slot.isUsed && slot.tile.key == key)
+        {
+            _tile = &slot.tile;
+        }
+    }
+
+    void store(const TileKey& key, std::vector<PaintCommand>&& commands, const PaintTileState& state)
+    {
+        std::unique_lock lock(_mutex);
+        if (_slots.empty())
+        {
+            _slots.resize(kNumSlots);
+        }
+
+        auto& slot = _slots[getSlotIndex(key.loc)];
+        slot.isUsed = true;
+        slot.tile.key = key;
+        slot.tile.commands = std::move(commands);
+        slot.tile.state = state;
+    }
+
+    BridgeLookup::BridgeLookup(const BridgeKey& key)
+        : _lock(_mutex)
+    {
+        if (_bridgeSlots.empty())
+        {
+            return;
+        }
+        const auto& slot = _bridgeSlots[getBridgeSlotIndex(key)];
+        if (slot.isUsed && slot.bridge.key == key)
+        {
+            _bridge = &slot.bridge;
+        }
+    }
+
+    void storeBridge(const BridgeKey& key, std::vector<PaintCommand>&& commands, bool isPainted)
+    {
+        std::unique_lock lock(_mutex);
+        if (_bridgeSlots.empty())
+        {
+            _bridgeSlots.resize(kNumBridgeSlots);
+        }
+
+        auto& slot = _bridgeSlots[getBridgeSlotIndex(key)];
+        slot.isUsed = true;
+        slot.bridge.key = key;
+        slot.bridge.commands = std::move(commands);
+        slot.bridge.isPainted = isPainted;
+    }
+
+    void clear()
+    {
+        std::unique_lock lock(_mutex);
+        _slots.clear();
+        _bridgeSlots.clear();
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Paint.h"
+#include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
+#include <sfl/static_vector.hpp>
+#include <shared_mutex>
+#include <vector>
+
+namespace OpenLoco::World
+{
+    struct Tile;
+}
+
+// Remembers the paint calls made for tiles that only consist of surface and tree elements, and for the
+// surfaces of other tiles, so that the calls can be replayed rather than worked out again every time
+// such a tile is painted. Replaying goes through the same session functions, so culling against the
+// render target and the sorting of the resulting paint structs with vehicles and neighbouring tiles is
+// unaffected.
+namespace OpenLoco::Paint::PaintTileCache
+{
+    static constexpr size_t kMaxTileElements = 8;
+
+    struct TileKey
+    {
+        World::Pos2 loc;
+        uint8_t rotation;
+        uint8_t zoomLevel;
+        Ui::ViewportFlags viewFlags;
+        bool landscapeSmoothing;
+        bool levelOfDetail;
+        // The raw tile elements followed by the surfaces of the four neighbouring tiles, which the
+        // surface edges are painted from. Comparing the contents makes the cache keep itself valid.
+        sfl::static_vector<uint64_t, kMaxTileElements + 4> contents;
+
+        bool operator==(const TileKey&) const = default;
+    };
+
+    struct CachedTile
+    {
+        TileKey key;
+        std::vector<PaintCommand> commands;
+        PaintTileState state;
+    };
+
+    bool isEnabled();
+
+    // Whether painting the tile only depends on what is captured by its key.
+    bool isCacheable(const World::Tile& tile);
+
+    // Whether painting the surface of a tile that is not cacheable only depends on what is captured
+    // by its key. The other elements of such tiles are painted as usual and only the surface is cached.
+    bool isSurfaceCacheable(const World::Tile& tile);
+
+    TileKey makeKey(PaintSession& session, const World::Pos2& loc, const World::Tile& tile);
+
+    // Keeps the cached tile for the key, if any, from being replaced while it is replayed.
+    class Lookup
+    {
+        std::shared_lock<std::shared_mutex> _lock;
+        const CachedTile* _tile{};
+
+    public:
+        explicit Lookup(const TileKey& key);
+
+        const CachedTile* get() const { return _tile; }
+    };
+
+    void store(const TileKey& key, std::vector<PaintCommand>&& commands, const PaintTileState& state);
+
+    // Everything painting a bridge deck and its supports depends on. It is all session state, not the
+    // location, so the many tiles of a bridge that look the same share one set of paint calls.
+    struct BridgeKey
+    {
+        uint32_t imageBase;
+        uint16_t subType;
+        int16_t height;
+        uint8_t edgesQuarters;
+        uint8_t objectId;
+        uint16_t generalSupportHeight;
+        uint8_t generalSupportSlope;
+        // Bit set for each support segment that is unoccupied
+        uint16_t freeSupportSegments;
+        int16_t waterHeight;
+        int16_t waterHeight2;
+        int16_t surfaceHeight;
+        uint8_t surfaceSlope;
+        uint8_t rotation;
+        // Position of the tile within a span of the bridge
+        uint8_t spanX;
+        uint8_t spanY;
+        bool paintShadow;
+
+        bool operator==(const BridgeKey&) const = default;
+    };
+
+    struct CachedBridge
+    {
+        BridgeKey key;
+        std::vector<PaintCommand> commands;
+        bool isPainted;
+    };
+
+    class BridgeLookup
+    {
+        std::shared_lock<std::shared_mutex> _lock;
+        const CachedBridge* _bridge{};
+
+    public:
+        explicit BridgeLookup(const BridgeKey& key);
+
+        const CachedBridge* get() const { return _bridge; }
+    };
+
+    void storeBridge(const BridgeKey& key, std::vector<PaintCommand>&& commands, bool isPainted);
+
+    // Required whenever the images of objects may have changed.
+    void clear();
+}
@@ -146,7 +146,7 @@ namespace OpenLoco::Paint
         uint8_t tunnelType;               // 0x0113605E
     };
 
-    static void paintTrackPPMergeable(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const uint8_t rotation, const TrackPaintPiece& tpp)
+    static void paintTrackPPMergeable(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const CompactTrackPaintPiece& tpp)
     {
         const auto height = elTrack.baseHeight();
         const auto heightOffset = World::Pos3{ 0,
@@ -156,9 +156,9 @@ namespace OpenLoco::Paint
         {
             auto newBridgeEntry = BridgeEntry(
                 height,
-                tpp.bridgeType[rotation],
-                tpp.bridgeEdges[rotation],
-                tpp.bridgeQuarters[rotation],
+                tpp.bridgeType,
+                tpp.bridgeEdges,
+                tpp.bridgeQuarters,
                 elTrack.bridge(),
                 trackSession.bridgeColoursBaseImageId);
             // There may be other bridge edge/quarters due to merging so OR them together
@@ -169,31 +169,31 @@ namespace OpenLoco::Paint
         const auto baseImage = trackSession.trackBaseImageId;
 
         session.addToPlotListTrackRoad(
-            baseImage.withIndexOffset(tpp.imageIndexOffsets[rotation][0]),
+            baseImage.withIndexOffset(tpp.imageIndexOffsets[0]),
             0,
             heightOffset,
-            tpp.boundingBoxOffsets[rotation] + heightOffset,
-            tpp.boundingBoxSizes[rotation]);
+            tpp.boundingBoxOffset + heightOffset,
+            tpp.boundingBoxSize);
         session.addToPlotListTrackRoad(
-            baseImage.withIndexOffset(tpp.imageIndexOffsets[rotation][1]),
+            baseImage.withIndexOffset(tpp.imageIndexOffsets[1]),
             1,
             heightOffset,
-            tpp.boundingBoxOffsets[rotation] + heightOffset,
-            tpp.boundingBoxSizes[rotation]);
+            tpp.boundingBoxOffset + heightOffset,
+            tpp.boundingBoxSize);
         session.addToPlotListTrackRoad(
-            baseImage.withIndexOffset(tpp.imageIndexOffsets[rotation][2]),
+            baseImage.withIndexOffset(tpp.imageIndexOffsets[2]),
             3,
             heightOffset,
-            tpp.boundingBoxOffsets[rotation] + heightOffset,
-            tpp.boundingBoxSizes[rotation]);
+            tpp.boundingBoxOffset + heightOffset,
+            tpp.boundingBoxSize);
 
-        session.insertTunnels(tpp.tunnelHeights[rotation], height, trackSession.tunnelType);
+        session.insertTunnels(tpp.tunnelHeights, height, trackSession.tunnelType);
 
-        session.set525CF8(session.get525CF8() | tpp.segments[rotation]);
-        session.setOccupiedAdditionSupportSegments(session.getOccupiedAdditionSupportSegments() | tpp.segments[rotation]);
+        session.set525CF8(session.get525CF8() | tpp.segments);
+        session.setOccupiedAdditionSupportSegments(session.getOccupiedAdditionSupportSegments() | tpp.segments);
     }
 
-    static void paintTrackPPStandard(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const uint8_t rotation, const TrackPaintPiece& tpp)
+    static void paintTrackPPStandard(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const CompactTrackPaintPiece& tpp)
     {
         const auto height = elTrack.baseHeight();
         const auto heightOffset = World::Pos3{ 0,
@@ -203,9 +203,9 @@ namespace OpenLoco::Paint
         {
             auto newBridgeEntry = BridgeEntry(
                 height,
-                tpp.bridgeType[rotation],
-                tpp.bridgeEdges[rotation],
-                tpp.bridgeQuarters[rotation],
+                tpp.bridgeType,
+                tpp.bridgeEdges,
+                tpp.bridgeQuarters,
                 elTrack.bridge(),
                 trackSession.bridgeColoursBaseImageId);
             // There may be other bridge edge/quarters due to merging so OR them together
@@ -216,26 +216,26 @@ namespace OpenLoco::Paint
         const auto baseImage = trackSession.trackBaseImageId;
 
         session.addToPlotList4FD150(
-            baseImage.withIndexOffset(tpp.imageIndexOffsets[rotation][0]),
+            baseImage.withIndexOffset(tpp.imageIndexOffsets[0]),
             heightOffset,
-            tpp.boundingBoxOffsets[rotation] + heightOffset,
-            tpp.boundingBoxSizes[rotation]);
+            tpp.boundingBoxOffset + heightOffset,
+            tpp.boundingBoxSize);
 
-        session.insertTunnels(tpp.tunnelHeights[rotation], height, trackSession.tunnelType);
+        session.insertTunnels(tpp.tunnelHeights, height, trackSession.tunnelType);
 
-        session.set525CF8(session.get525CF8() | tpp.segments[rotation]);
-        session.setOccupiedAdditionSupportSegments(session.getOccupiedAdditionSupportSegments() | tpp.segments[rotation]);
+        session.set525CF8(session.get525CF8() | tpp.segments);
+        session.setOccupiedAdditionSupportSegments(session.getOccupiedAdditionSupportSegments() | tpp.segments);
     }
 
-    static void paintTrackPP(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const uint8_t rotation, const TrackPaintPiece& tpp)
+    static void paintTrackPP(PaintSession& session, const World::TrackElement& elTrack, const TrackPaintCommon& trackSession, const CompactTrackPaintPiece& tpp)
     {
         if (tpp.isMergeable)
         {
-            paintTrackPPMergeable(session, elTrack, trackSession, rotation, tpp);
+            paintTrackPPMergeable(session, elTrack, trackSession, tpp);
         }
         else
         {
-            paintTrackPPStandard(session, elTrack, trackSession, rotation, tpp);
+            paintTrackPPStandard(session, elTrack, trackSession, tpp);
         }
     }
 
@@ -289,9 +289,8 @@ namespace OpenLoco::Paint
         {
             if (elTrack.trackId() < kTrackPaintParts.size() && elTrack.sequenceIndex() < kTrackPaintParts[elTrack.trackId()].size())
             {
-                auto& parts = kTrackPaintParts[elTrack.trackId()];
-                auto& tpp = parts[elTrack.sequenceIndex()];
-                paintTrackPP(session, elTrack, trackSession, rotation, tpp);
+                const auto& tpp = kCompactTrackPaintPieces[rotation][kCompactTrackPaintPieceOffsets[elTrack.trackId()] + elTrack.sequenceIndex()];
+                paintTrackPP(session, elTrack, trackSession, tpp);
             }
             else
             {
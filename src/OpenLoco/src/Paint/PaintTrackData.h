@@ -3,6 +3,7 @@
 #include "Paint.h"
 #include <OpenLoco/Core/Numerics.hpp>
 #include <array>
+#include <limits>
 #include <span>
 
 namespace OpenLoco::Paint
@@ -1910,4 +1911,82 @@ namespace OpenLoco::Paint
         kRightCurveSmallSteepSlopeDownTPP,
     };
 
+    // Everything needed to paint one track piece at one rotation, two to a cache line. The
+    // pieces of all track ids are stored one rotation after another so that painting reads
+    // a single 32 byte entry rather than picking fields out of a ~150 byte TrackPaintPiece.
+    struct alignas(32) CompactTrackPaintPiece
+    {
+        std::array<uint16_t, 3> imageIndexOffsets{};
+        World::Pos3 boundingBoxOffset{};
+        World::Pos3 boundingBoxSize{};
+        std::array<int16_t, 4> tunnelHeights{};
+        SegmentFlags segments{};
+        uint8_t bridgeEdges{};
+        uint8_t bridgeQuarters{};
+        uint8_t bridgeType{};
+        bool isMergeable{};
+    };
+    static_assert(sizeof(CompactTrackPaintPiece) == 32);
+
+    // Index of the first piece of each track id, the last entry is the total
+    constexpr auto kCompactTrackPaintPieceOffsets = []() {
+        std::array<uint16_t, kTrackPaintParts.size() + 1> offsets{};
+        for (size_t trackId = 0; trackId < kTrackPaintParts.size(); ++trackId)
+        {
+            offsets[trackId + 1] = static_cast<uint16_t>(offsets[trackId] + kTrackPaintParts[trackId].size());
+        }
+        return offsets;
+    }();
+
+    constexpr bool trackPaintImageOffsetsFitCompact()
+    {
+        for (const auto& parts : kTrackPaintParts)
+        {
+            for (const auto& tpp : parts)
+            {
+                for (const auto& rotationOffsets : tpp.imageIndexOffsets)
+                {
+                    for (const auto offset : rotationOffsets)
+                    {
+                        if (offset > std::numeric_limits<uint16_t>::max())
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    static_assert(trackPaintImageOffsetsFitCompact());
+
+    using CompactTrackPaintPieces = std::array<std::array<CompactTrackPaintPiece, kCompactTrackPaintPieceOffsets.back()>, 4>;
+
+    constexpr CompactTrackPaintPieces kCompactTrackPaintPieces = []() {
+        CompactTrackPaintPieces pieces{};
+        for (size_t trackId = 0; trackId < kTrackPaintParts.size(); ++trackId)
+        {
+            for (size_t sequenceIndex = 0; sequenceIndex < kTrackPaintParts[trackId].size(); ++sequenceIndex)
+            {
+                const auto& tpp = kTrackPaintParts[trackId][sequenceIndex];
+                for (size_t rotation = 0; rotation < 4; ++rotation)
+                {
+                    auto& piece = pieces[rotation][kCompactTrackPaintPieceOffsets[trackId] + sequenceIndex];
+                    for (size_t i = 0; i < piece.imageIndexOffsets.size(); ++i)
+                    {
+                        piece.imageIndexOffsets[i] = static_cast<uint16_t>(tpp.imageIndexOffsets[rotation][i]);
+                    }
+                    piece.boundingBoxOffset = tpp.boundingBoxOffsets[rotation];
+                    piece.boundingBoxSize = tpp.boundingBoxSizes[rotation];
+                    piece.tunnelHeights = tpp.tunnelHeights[rotation];
+                    piece.segments = tpp.segments[rotation];
+                    piece.bridgeEdges = tpp.bridgeEdges[rotation];
+                    piece.bridgeQuarters = tpp.bridgeQuarters[rotation];
+                    piece.bridgeType = tpp.bridgeType[rotation];
+                    piece.isMergeable = tpp.isMergeable;
+                }
+            }
+        }
+        return pieces;
+    }();
 }
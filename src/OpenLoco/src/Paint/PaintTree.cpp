@@ -22,6 +22,8 @@ namespace OpenLoco::Paint
         World::Pos2{ 23, 23 },
         World::Pos2{ 23, 7 },
     };
+    // Level of detail, see PaintSession::isDetailHidden.
+    constexpr uint8_t kTreeSeasonBlendMinZoom = 2;
 
     // 0x004BAEDA
     void paintTree(PaintSession& session, const World::TreeElement& elTree)
@@ -36,7 +38,8 @@ namespace OpenLoco::Paint
         bool hasImage2 = false;
         uint32_t imageIndex2 = 0;
         uint8_t noiseMask = 0;
-        if (elTree.unk7l() != 7)
+        // The second image blends between seasons, at a distance the tree is drawn in a single season.
+        if (elTree.unk7l() != 7 && !session.isDetailHidden(kTreeSeasonBlendMinZoom))
         {
             hasImage2 = true;
 
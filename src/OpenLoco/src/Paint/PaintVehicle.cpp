@@ -237,12 +237,14 @@ namespace OpenLoco::Paint
             pitch = kReversePitch[static_cast<uint8_t>(body->spritePitch)];
         }
 
-        uint32_t bodyImageIndex = getBodyImageIndex(sprite, pitch, yaw, body->animationFrame, body->cargoFrame);
+        const auto pitchImageIndex = getPitchBodyImageIndex(body->objectId, body->objectSpriteType, pitch, yaw);
+        uint32_t bodyImageIndex = pitchImageIndex + body->animationFrame + body->cargoFrame;
 
         std::optional<uint32_t> brakingImageIndex = {};
         if (sprite.hasFlags(BodySpriteFlags::hasBrakingLights))
         {
-            brakingImageIndex = getBrakingImageIndex(sprite, pitch, yaw);
+            // Braking image is the last frame for a rotation
+            brakingImageIndex = pitchImageIndex + sprite.numFramesPerRotation - 1;
         }
 
         World::Pos3 offsets = { 0, 0, body->position.z };
@@ -13,6 +13,10 @@ using namespace OpenLoco::Ui::ViewportInteraction;
 
 namespace OpenLoco::Paint
 {
+    // Level of detail, see PaintSession::isDetailHidden.
+    static constexpr uint8_t kWallMinZoom = 3;
+    static constexpr uint8_t kWallGlassMinZoom = 2;
+
     static constexpr World::Pos3 kOffsets[4] = {
         { 0, 0, 0 },
         { 1, 31, 0 },
@@ -109,6 +113,11 @@ namespace OpenLoco::Paint
     // 0x004C3D7C
     void paintWall(PaintSession& session, const World::WallElement& elWall)
     {
+        if (session.isDetailHidden(kWallMinZoom))
+        {
+            return;
+        }
+
         const auto* wallObject = ObjectManager::get<WallObject>(elWall.wallObjectId());
         assert(wallObject != nullptr);
 
@@ -137,7 +146,7 @@ namespace OpenLoco::Paint
                 bboxOffset,
                 bboxLength);
 
-            if (!isGhost)
+            if (!isGhost && !session.isDetailHidden(kWallGlassMinZoom))
             {
                 const auto blendColour = Colours::getGlass(imageId.getPrimary());
                 const auto glassImageIndex = wallObject->sprite + getWallImageIndexOffsetGlass(elWall, rotation);
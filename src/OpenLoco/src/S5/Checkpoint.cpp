@@ -0,0 +1,93 @@
+#include "Checkpoint.h"
+#include "Audio/Audio.h"
+#include "GameState.h"
+#include "Graphics/Gfx.h"
+#include "Map/AnimationManager.h"
+#include "Map/TileManager.h"
+#include "Objects/ObjectManager.h"
+#include "S5.h"
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace OpenLoco::S5
+{
+    using BlockList = std::vector<std::shared_ptr<const Checkpoint::Block>>;
+
+    static_assert(std::is_trivially_copyable_v<GameState>);
+    static_assert(std::is_trivially_copyable_v<World::TileElement>);
+
+    static BlockList copyBlocks(std::span<const std::byte> data, const BlockList* previous)
+    {
+        constexpr auto kBlockSize = Checkpoint::kBlockSize;
+        const auto numBlocks = (data.size() + kBlockSize - 1) / kBlockSize;
+
+        BlockList blocks;
+        blocks.reserve(numBlocks);
+        for (size_t i = 0; i < numBlocks; i++)
+        {
+            const auto* src = data.data() + i * kBlockSize;
+            const auto length = std::min(kBlockSize, data.size() - i * kBlockSize);
+
+            // Only the first length bytes are ever restored, so a last block of a longer state can be shared
+            if (previous != nullptr && i < previous->size() && std::memcmp((*previous)[i]->data(), src, length) == 0)
+            {
+                blocks.push_back((*previous)[i]);
+                continue;
+            }
+
+            auto block = std::make_shared<Checkpoint::Block>();
+            std::memcpy(block->data(), src, length);
+            blocks.push_back(std::move(block));
+        }
+        return blocks;
+    }
+
+    static void restoreBlocks(std::span<std::byte> data, const BlockList& blocks)
+    {
+        constexpr auto kBlockSize = Checkpoint::kBlockSize;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            const auto length = std::min(kBlockSize, data.size() - i * kBlockSize);
+            std::memcpy(data.data() + i * kBlockSize, blocks[i]->data(), length);
+        }
+    }
+
+    std::unique_ptr<Checkpoint> takeCheckpoint(const Checkpoint* previous)
+    {
+        auto checkpoint = std::make_unique<Checkpoint>();
+
+        const auto gameState = std::as_bytes(std::span(&getGameState(), 1));
+        checkpoint->gameStateBlocks = copyBlocks(gameState, previous != nullptr ? &previous->gameStateBlocks : nullptr);
+
+        const auto elements = World::TileManager::getElements();
+        checkpoint->tileElementBlocks = copyBlocks(std::as_bytes(elements), previous != nullptr ? &previous->tileElementBlocks : nullptr);
+        checkpoint->numTileElements = elements.size();
+
+        // Usually the same as those of the previous checkpoint, but they are few enough to not bother sharing
+        checkpoint->objects = ObjectManager::getHeaders();
+        return checkpoint;
+    }
+
+    bool restoreCheckpoint(const Checkpoint& checkpoint)
+    {
+        // The state refers to objects by their loaded index
+        if (ObjectManager::getHeaders() != checkpoint.objects)
+        {
+            return false;
+        }
+
+        restoreBlocks(std::as_writable_bytes(std::span(&getGameState(), 1)), checkpoint.gameStateBlocks);
+
+        std::vector<World::TileElement> elements(checkpoint.numTileElements);
+        restoreBlocks(std::as_writable_bytes(std::span(elements)), checkpoint.tileElementBlocks);
+        World::TileManager::setElements(elements);
+
+        Audio::stopVehicleNoise();
+        rebuildDerivedState();
+        World::AnimationManager::rebuildSchedule();
+        Gfx::invalidateScreen();
+        return true;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Objects/Object.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Checkpoints copy the simulation state in memory without any of the clean up that a save does,
+// so they are cheap enough to take every tick. The state is copied in blocks and a checkpoint
+// taken against an earlier one shares the blocks that have not changed since, a ring of recent
+// ticks then costs little more memory than the state that changed between them.
+namespace OpenLoco::S5
+{
+    struct Checkpoint
+    {
+        static constexpr size_t kBlockSize = 4096;
+        using Block = std::array<std::byte, kBlockSize>;
+
+        std::vector<std::shared_ptr<const Block>> gameStateBlocks;
+        std::vector<std::shared_ptr<const Block>> tileElementBlocks;
+        size_t numTileElements{};
+        std::vector<ObjectHeader> objects;
+    };
+
+    // Copies the game state and every tile element, ghosts included. Blocks that match those of
+    // previous are shared rather than copied.
+    std::unique_ptr<Checkpoint> takeCheckpoint(const Checkpoint* previous = nullptr);
+
+    // Replaces the game state and tile elements with those of the checkpoint and rebuilds what is
+    // derived from them. Fails when the loaded objects differ from when it was taken.
+    bool restoreCheckpoint(const Checkpoint& checkpoint);
+}
@@ -0,0 +1,351 @@
+#include "CompressedSave.h"
+#include "S5.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/JobSystem.h>
+#include <OpenLoco/Core/Stream.hpp>
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <vector>
+#include <zlib.h>
+
+namespace OpenLoco::S5::CompressedSave
+{
+    static constexpr char kMagic[4] = { 'O', 'L', 'S', 'Z' };
+    static constexpr uint16_t kVersion = 1;
+    static constexpr size_t kBlockSize = 1024 * 1024;
+
+    enum class ChunkType : uint8_t
+    {
+        header,
+        scenarioOptions,
+        saveDetails,
+        packedObjectHeader,
+        packedObjectData,
+        requiredObjects,
+        gameState,
+        tileElements,
+    };
+
+#pragma pack(push, 1)
+    struct ContainerHeader
+    {
+        char magic[4];
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t numBlocks;
+    };
+    static_assert(sizeof(ContainerHeader) == 12);
+
+    // A chunk is stored in one or more consecutive blocks, the first of which is at chunkOffset 0.
+    struct BlockEntry
+    {
+        ChunkType chunk;
+        uint8_t reserved[3];
+        uint32_t chunkOffset;
+        uint32_t length;
+        uint32_t compressedLength;
+        uint32_t crc;
+    };
+    static_assert(sizeof(BlockEntry) == 20);
+#pragma pack(pop)
+
+    struct Chunk
+    {
+        ChunkType type;
+        std::span<const std::byte> data;
+    };
+
+    // Runs job(i) for every i in [0, count) on the shared job pool, rethrows the failure of the lowest i.
+    template<typename TJob>
+    static void runInParallel(size_t count, TJob&& job)
+    {
+        Core::JobSystem::get().parallelFor("Compressed save blocks", count, 1, [&job](size_t begin, size_t end) {
+            for (auto i = begin; i < end; i++)
+            {
+                job(i);
+            }
+        });
+    }
+
+    bool isCompressed(Stream& stream)
+    {
+        const auto position = stream.getPosition();
+        if (stream.getLength() - position < sizeof(kMagic))
+        {
+            return false;
+        }
+
+        char magic[sizeof(kMagic)];
+        stream.read(magic, sizeof(magic));
+        stream.setPosition(position);
+        return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+    }
+
+    template<typename T>
+    static std::span<const std::byte> asChunkData(const T& value)
+    {
+        return std::as_bytes(std::span(&value, 1));
+    }
+
+    static std::vector<Chunk> getChunks(const S5File& file)
+    {
+        std::vector<Chunk> chunks;
+        chunks.push_back({ ChunkType::header, asChunkData(file.header) });
+        if (file.scenarioOptions != nullptr)
+        {
+            chunks.push_back({ ChunkType::scenarioOptions, asChunkData(*file.scenarioOptions) });
+        }
+        if (file.saveDetails != nullptr)
+        {
+            chunks.push_back({ ChunkType::saveDetails, asChunkData(*file.saveDetails) });
+        }
+        for (const auto& [header, data] : file.packedObjects)
+        {
+            chunks.push_back({ ChunkType::packedObjectHeader, asChunkData(header) });
+            chunks.push_back({ ChunkType::packedObjectData, std::span(data) });
+        }
+        chunks.push_back({ ChunkType::requiredObjects, asChunkData(file.requiredObjects) });
+        chunks.push_back({ ChunkType::gameState, asChunkData(file.gameState) });
+        chunks.push_back({ ChunkType::tileElements, std::as_bytes(std::span(file.tileElements)) });
+        return chunks;
+    }
+
+    void write(Stream& stream, const S5File& file)
+    {
+        struct PendingBlock
+        {
+            BlockEntry entry;
+            std::span<const std::byte> data;
+            std::vector<uint8_t> compressed;
+        };
+
+        std::vector<PendingBlock> blocks;
+        for (const auto& chunk : getChunks(file))
+        {
+            // Even an empty chunk gets a block so that the reader sees it
+            size_t offset = 0;
+            do
+            {
+                const auto length = std::min(kBlockSize, chunk.data.size() - offset);
+                PendingBlock block{};
+                block.entry.chunk = chunk.type;
+                block.entry.chunkOffset = static_cast<uint32_t>(offset);
+                block.entry.length = static_cast<uint32_t>(length);
+                block.data = chunk.data.subspan(offset, length);
+                blocks.push_back(std::move(block));
+                offset += length;
+            } while (offset < chunk.data.size());
+        }
+
+        runInParallel(blocks.size(), [&blocks](size_t i) {
+            auto& block = blocks[i];
+            if (block.data.empty())
+            {
+                return;
+            }
+
+            const auto* src = reinterpret_cast<const Bytef*>(block.data.data());
+            auto compressedLength = compressBound(static_cast<uLong>(block.data.size()));
+            block.compressed.resize(compressedLength);
+            if (compress2(block.compressed.data(), &compressedLength, src, static_cast<uLong>(block.data.size()), Z_BEST_SPEED) != Z_OK)
+            {
+                throw Exception::RuntimeError("Unable to compress block");
+            }
+            block.compressed.resize(compressedLength);
+            block.entry.compressedLength = static_cast<uint32_t>(compressedLength);
+            block.entry.crc = static_cast<uint32_t>(crc32(0, src, static_cast<uInt>(block.data.size())));
+        });
+
+        ContainerHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.numBlocks = static_cast<uint32_t>(blocks.size());
+        stream.writeValue(header);
+        for (const auto& block : blocks)
+        {
+            stream.writeValue(block.entry);
+        }
+        for (const auto& block : blocks)
+        {
+            stream.write(block.compressed.data(), block.compressed.size());
+        }
+    }
+
+    template<typename T>
+    static std::span<std::byte> getFixedDestination(T& value, size_t length)
+    {
+        if (length != sizeof(T))
+        {
+            throw Exception::RuntimeError("Invalid chunk length");
+        }
+        return std::as_writable_bytes(std::span(&value, 1));
+    }
+
+    static bool isHeaderChunk(ChunkType type)
+    {
+        return type == ChunkType::header || type == ChunkType::scenarioOptions || type == ChunkType::saveDetails;
+    }
+
+    std::unique_ptr<S5File> read(Stream& stream, bool headerOnly)
+    {
+        const auto header = stream.readValue<ContainerHeader>();
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion)
+        {
+            throw Exception::RuntimeError("Unsupported save container");
+        }
+        if (header.numBlocks > (stream.getLength() - stream.getPosition()) / sizeof(BlockEntry))
+        {
+            throw Exception::RuntimeError("Invalid block count");
+        }
+
+        std::vector<BlockEntry> entries(header.numBlocks);
+        stream.read(entries.data(), entries.size() * sizeof(BlockEntry));
+
+        // Work out the length of every chunk from its blocks
+        struct ChunkInfo
+        {
+            ChunkType type;
+            size_t length;
+        };
+        std::vector<ChunkInfo> chunks;
+        size_t numPackedObjects = 0;
+        for (const auto& entry : entries)
+        {
+            if (entry.chunkOffset == 0)
+            {
+                chunks.push_back({ entry.chunk, 0 });
+                if (entry.chunk == ChunkType::packedObjectHeader)
+                {
+                    numPackedObjects++;
+                }
+            }
+            else if (chunks.empty() || chunks.back().type != entry.chunk || chunks.back().length != entry.chunkOffset)
+            {
+                throw Exception::RuntimeError("Invalid block index");
+            }
+            chunks.back().length += entry.length;
+        }
+        if (chunks.empty() || chunks.front().type != ChunkType::header)
+        {
+            throw Exception::RuntimeError("Missing header chunk");
+        }
+
+        // Set up the destination of each chunk, chunks that aren't wanted are left empty
+        auto file = std::make_unique<S5File>();
+        file->packedObjects.resize(numPackedObjects);
+        std::vector<std::span<std::byte>> destinations;
+        size_t packedObjectIndex = 0;
+        for (const auto& chunk : chunks)
+        {
+            if (headerOnly && !isHeaderChunk(chunk.type))
+            {
+                destinations.emplace_back();
+                continue;
+            }
+
+            switch (chunk.type)
+            {
+                case ChunkType::header:
+                    destinations.push_back(getFixedDestination(file->header, chunk.length));
+                    break;
+                case ChunkType::scenarioOptions:
+                    file->scenarioOptions = std::make_unique<Options>();
+                    destinations.push_back(getFixedDestination(*file->scenarioOptions, chunk.length));
+                    break;
+                case ChunkType::saveDetails:
+                    file->saveDetails = std::make_unique<SaveDetails>();
+                    destinations.push_back(getFixedDestination(*file->saveDetails, chunk.length));
+                    break;
+                case ChunkType::packedObjectHeader:
+                    destinations.push_back(getFixedDestination(file->packedObjects[packedObjectIndex++].first, chunk.length));
+                    break;
+                case ChunkType::packedObjectData:
+                {
+                    if (packedObjectIndex == 0)
+                    {
+                        throw Exception::RuntimeError("Invalid packed object");
+                    }
+                    auto& data = file->packedObjects[packedObjectIndex - 1].second;
+                    data.resize(chunk.length);
+                    destinations.push_back(std::span(data));
+                    break;
+                }
+                case ChunkType::requiredObjects:
+                    destinations.push_back(getFixedDestination(file->requiredObjects, chunk.length));
+                    break;
+                case ChunkType::gameState:
+                    destinations.push_back(getFixedDestination(file->gameState, chunk.length));
+                    break;
+                case ChunkType::tileElements:
+                    if (chunk.length % sizeof(TileElement) != 0)
+                    {
+                        throw Exception::RuntimeError("Invalid chunk length");
+                    }
+                    file->tileElements.resize(chunk.length / sizeof(TileElement));
+                    destinations.push_back(std::as_writable_bytes(std::span(file->tileElements)));
+                    break;
+                default:
+                    throw Exception::RuntimeError("Unknown chunk");
+            }
+        }
+
+        // Only read the compressed data up to the last block that is needed
+        struct PendingBlock
+        {
+            const BlockEntry* entry;
+            std::span<std::byte> destination;
+            size_t compressedOffset;
+        };
+        std::vector<PendingBlock> blocks;
+        size_t compressedOffset = 0;
+        size_t compressedLength = 0;
+        size_t chunkIndex = 0;
+        for (const auto& entry : entries)
+        {
+            if (entry.chunkOffset == 0 && &entry != &entries.front())
+            {
+                chunkIndex++;
+            }
+            const auto& destination = destinations[chunkIndex];
+            if (!destination.empty() && entry.length != 0)
+            {
+                blocks.push_back({ &entry, destination.subspan(entry.chunkOffset, entry.length), compressedOffset });
+                compressedLength = compressedOffset + entry.compressedLength;
+            }
+            compressedOffset += entry.compressedLength;
+        }
+        if (compressedLength > stream.getLength() - stream.getPosition())
+        {
+            throw Exception::RuntimeError("Unexpected end of file");
+        }
+
+        // Mapped files are decompressed in place
+        std::vector<std::byte> compressedBuffer;
+        auto compressed = stream.readView(compressedLength);
+        if (compressed.size() != compressedLength)
+        {
+            compressedBuffer.resize(compressedLength);
+            stream.read(compressedBuffer.data(), compressedBuffer.size());
+            compressed = compressedBuffer;
+        }
+
+        runInParallel(blocks.size(), [&blocks, &compressed](size_t i) {
+            const auto& block = blocks[i];
+            auto* dst = reinterpret_cast<Bytef*>(block.destination.data());
+            auto length = static_cast<uLongf>(block.destination.size());
+            const auto* src = reinterpret_cast<const Bytef*>(compressed.data() + block.compressedOffset);
+            if (uncompress(dst, &length, src, block.entry->compressedLength) != Z_OK
+                || length != block.destination.size())
+            {
+                throw Exception::RuntimeError("Invalid compressed block");
+            }
+            if (crc32(0, dst, static_cast<uInt>(length)) != block.entry->crc)
+            {
+                throw Exception::RuntimeError("Invalid checksum");
+            }
+        });
+
+        return file;
+    }
+}
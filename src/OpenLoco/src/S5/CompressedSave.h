@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+namespace OpenLoco
+{
+    class Stream;
+}
+
+namespace OpenLoco::S5
+{
+    struct S5File;
+}
+
+// An alternative container to the Sawyer encoded S5 files. It stores the same chunks but compressed with
+// deflate, in blocks of up to 1 MiB that are encoded and decoded in parallel. An index of all the blocks
+// follows the container header so a reader can pick out chunks without decoding the rest of the file.
+// Vanilla Locomotion can't read this container.
+namespace OpenLoco::S5::CompressedSave
+{
+    // Checks the container magic without moving the stream position.
+    bool isCompressed(Stream& stream);
+
+    void write(Stream& stream, const S5File& file);
+
+    // With headerOnly set only the header, scenario options and save details are decoded.
+    std::unique_ptr<S5File> read(Stream& stream, bool headerOnly = false);
+}
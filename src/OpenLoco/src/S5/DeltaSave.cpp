@@ -0,0 +1,295 @@
+#include "DeltaSave.h"
+#include "S5.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/Stream.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace OpenLoco::S5::DeltaSave
+{
+    static constexpr char kMagic[4] = { 'O', 'L', 'S', 'D' };
+    static constexpr uint16_t kVersion = 1;
+    // Small enough that a changed entity or a few tile elements only cost a block or two
+    static constexpr size_t kBlockSize = 256;
+
+#pragma pack(push, 1)
+    struct DeltaHeader
+    {
+        char magic[4];
+        uint16_t version;
+        uint16_t numSections;
+        uint64_t parentHash;
+        uint64_t hash;
+    };
+    static_assert(sizeof(DeltaHeader) == 24);
+
+    // Followed by the index of each changed block and then the data of those blocks.
+    struct SectionHeader
+    {
+        Section section;
+        uint8_t reserved[3];
+        uint32_t length;
+        uint32_t numBlocks;
+    };
+    static_assert(sizeof(SectionHeader) == 12);
+#pragma pack(pop)
+
+    // 64-bit FNV-1a, a word at a time.
+    class Hasher
+    {
+        static constexpr uint64_t kOffsetBasis = 0xCBF29CE484222325ULL;
+        static constexpr uint64_t kPrime = 0x100000001B3ULL;
+
+        uint64_t _hash = kOffsetBasis;
+
+        void mix(uint64_t value)
+        {
+            _hash ^= value;
+            _hash *= kPrime;
+        }
+
+    public:
+        void append(std::span<const std::byte> data)
+        {
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, data.data() + i, sizeof(word));
+                mix(word);
+            }
+            for (; i < data.size(); i++)
+            {
+                mix(static_cast<uint64_t>(data[i]));
+            }
+        }
+
+        void append(uint64_t value)
+        {
+            mix(value);
+        }
+
+        uint64_t get() const { return _hash; }
+    };
+
+    template<typename T>
+    static std::span<const std::byte> asSectionData(const T* value)
+    {
+        if (value == nullptr)
+        {
+            return {};
+        }
+        return std::as_bytes(std::span(value, 1));
+    }
+
+    // The packed object count is left out as the packed objects always come from the base.
+    static std::array<std::span<const std::byte>, kNumSections> getSections(const S5File& file, Header& header)
+    {
+        header = file.header;
+        header.numPackedObjects = 0;
+
+        std::array<std::span<const std::byte>, kNumSections> sections;
+        sections[static_cast<size_t>(Section::header)] = asSectionData(&header);
+        sections[static_cast<size_t>(Section::scenarioOptions)] = asSectionData(file.scenarioOptions.get());
+        sections[static_cast<size_t>(Section::saveDetails)] = asSectionData(file.saveDetails.get());
+        sections[static_cast<size_t>(Section::requiredObjects)] = std::as_bytes(std::span(file.requiredObjects));
+        sections[static_cast<size_t>(Section::gameState)] = asSectionData(&file.gameState);
+        sections[static_cast<size_t>(Section::tileElements)] = std::as_bytes(std::span(file.tileElements));
+        return sections;
+    }
+
+    static size_t getNumBlocks(size_t length)
+    {
+        return (length + kBlockSize - 1) / kBlockSize;
+    }
+
+    static std::span<const std::byte> getBlock(std::span<const std::byte> data, size_t index)
+    {
+        const auto offset = index * kBlockSize;
+        return data.subspan(offset, std::min(kBlockSize, data.size() - offset));
+    }
+
+    Fingerprint getFingerprint(const S5File& file)
+    {
+        Header header;
+        const auto sections = getSections(file, header);
+
+        Fingerprint fingerprint;
+        Hasher stateHasher;
+        for (size_t i = 0; i < kNumSections; i++)
+        {
+            const auto data = sections[i];
+            auto& hashes = fingerprint.blockHashes[i];
+            hashes.resize(getNumBlocks(data.size()));
+            for (size_t j = 0; j < hashes.size(); j++)
+            {
+                Hasher hasher;
+                hasher.append(getBlock(data, j));
+                hashes[j] = hasher.get();
+                stateHasher.append(hashes[j]);
+            }
+            fingerprint.lengths[i] = data.size();
+            stateHasher.append(static_cast<uint64_t>(data.size()));
+        }
+        fingerprint.hash = stateHasher.get();
+        return fingerprint;
+    }
+
+    Fingerprint write(Stream& stream, const S5File& file, const Fingerprint& parent)
+    {
+        Header header;
+        const auto sections = getSections(file, header);
+        const auto fingerprint = getFingerprint(file);
+
+        DeltaHeader deltaHeader{};
+        std::memcpy(deltaHeader.magic, kMagic, sizeof(kMagic));
+        deltaHeader.version = kVersion;
+        deltaHeader.numSections = static_cast<uint16_t>(kNumSections);
+        deltaHeader.parentHash = parent.hash;
+        deltaHeader.hash = fingerprint.hash;
+        stream.writeValue(deltaHeader);
+
+        for (size_t i = 0; i < kNumSections; i++)
+        {
+            const auto& hashes = fingerprint.blockHashes[i];
+            const auto& parentHashes = parent.blockHashes[i];
+
+            // A block also changes when the section length changes within it
+            const auto commonLength = std::min(fingerprint.lengths[i], parent.lengths[i]);
+            const auto hasLengthChanged = fingerprint.lengths[i] != parent.lengths[i];
+            std::vector<uint32_t> changedBlocks;
+            for (size_t j = 0; j < hashes.size(); j++)
+            {
+                const auto isPastCommonLength = hasLengthChanged && (j + 1) * kBlockSize > commonLength;
+                if (j >= parentHashes.size() || hashes[j] != parentHashes[j] || isPastCommonLength)
+                {
+                    changedBlocks.push_back(static_cast<uint32_t>(j));
+                }
+            }
+
+            SectionHeader sectionHeader{};
+            sectionHeader.section = static_cast<Section>(i);
+            sectionHeader.length = static_cast<uint32_t>(sections[i].size());
+            sectionHeader.numBlocks = static_cast<uint32_t>(changedBlocks.size());
+            stream.writeValue(sectionHeader);
+            stream.write(changedBlocks.data(), changedBlocks.size() * sizeof(uint32_t));
+            for (const auto index : changedBlocks)
+            {
+                const auto block = getBlock(sections[i], index);
+                stream.write(block.data(), block.size());
+            }
+        }
+
+        return fingerprint;
+    }
+
+    template<typename T>
+    static std::span<std::byte> resizeOptionalSection(std::unique_ptr<T>& value, size_t length)
+    {
+        if (length == 0)
+        {
+            value.reset();
+            return {};
+        }
+        if (length != sizeof(T))
+        {
+            throw Exception::RuntimeError("Invalid section length");
+        }
+        if (value == nullptr)
+        {
+            value = std::make_unique<T>();
+        }
+        return std::as_writable_bytes(std::span(value.get(), 1));
+    }
+
+    template<typename T>
+    static std::span<std::byte> getFixedSection(T& value, size_t length)
+    {
+        if (length != sizeof(T))
+        {
+            throw Exception::RuntimeError("Invalid section length");
+        }
+        return std::as_writable_bytes(std::span(&value, 1));
+    }
+
+    static std::span<std::byte> resizeSection(S5File& file, Section section, size_t length)
+    {
+        switch (section)
+        {
+            case Section::header:
+                return getFixedSection(file.header, length);
+            case Section::scenarioOptions:
+                return resizeOptionalSection(file.scenarioOptions, length);
+            case Section::saveDetails:
+                return resizeOptionalSection(file.saveDetails, length);
+            case Section::requiredObjects:
+                return getFixedSection(file.requiredObjects, length);
+            case Section::gameState:
+                return getFixedSection(file.gameState, length);
+            case Section::tileElements:
+                if (length % sizeof(TileElement) != 0)
+                {
+                    throw Exception::RuntimeError("Invalid section length");
+                }
+                file.tileElements.resize(length / sizeof(TileElement));
+                return std::as_writable_bytes(std::span(file.tileElements));
+            default:
+                throw Exception::RuntimeError("Unknown section");
+        }
+    }
+
+    void apply(Stream& stream, S5File& file)
+    {
+        const auto deltaHeader = stream.readValue<DeltaHeader>();
+        if (std::memcmp(deltaHeader.magic, kMagic, sizeof(kMagic)) != 0 || deltaHeader.version != kVersion)
+        {
+            throw Exception::RuntimeError("Not a delta save");
+        }
+        if (getFingerprint(file).hash != deltaHeader.parentHash)
+        {
+            throw Exception::RuntimeError("Delta save was written against a different state");
+        }
+
+        const auto numPackedObjects = file.header.numPackedObjects;
+        for (size_t i = 0; i < deltaHeader.numSections; i++)
+        {
+            const auto sectionHeader = stream.readValue<SectionHeader>();
+            const auto data = resizeSection(file, sectionHeader.section, sectionHeader.length);
+            if (sectionHeader.numBlocks > getNumBlocks(data.size()))
+            {
+                throw Exception::RuntimeError("Invalid block count");
+            }
+
+            std::vector<uint32_t> changedBlocks(sectionHeader.numBlocks);
+            stream.read(changedBlocks.data(), changedBlocks.size() * sizeof(uint32_t));
+            for (const auto index : changedBlocks)
+            {
+                if (index >= getNumBlocks(data.size()))
+                {
+                    throw Exception::RuntimeError("Invalid block index");
+                }
+                const auto offset = index * kBlockSize;
+                stream.read(data.data() + offset, std::min(kBlockSize, data.size() - offset));
+            }
+        }
+        file.header.numPackedObjects = numPackedObjects;
+
+        if (getFingerprint(file).hash != deltaHeader.hash)
+        {
+            throw Exception::RuntimeError("Delta save produced a different state");
+        }
+    }
+
+    std::unique_ptr<S5File> importChain(const fs::path& basePath, std::span<const fs::path> deltaPaths)
+    {
+        FileStream baseStream(basePath, StreamMode::readMapped);
+        auto file = importSave(baseStream);
+        for (const auto& deltaPath : deltaPaths)
+        {
+            FileStream deltaStream(deltaPath, StreamMode::readMapped);
+            apply(deltaStream, *file);
+        }
+        return file;
+    }
+}
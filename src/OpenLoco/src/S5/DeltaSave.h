@@ -0,0 +1,58 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace OpenLoco
+{
+    class Stream;
+}
+
+namespace OpenLoco::S5
+{
+    struct S5File;
+}
+
+// Delta saves only store the parts of a save that changed since the state they are written against,
+// which is either a full save or the result of an earlier delta. Each part is split into blocks that
+// are hashed, a delta holds the blocks whose hash differs. Packed objects are always those of the base.
+namespace OpenLoco::S5::DeltaSave
+{
+    constexpr const char* extensionSVD = ".SVD";
+
+    enum class Section : uint8_t
+    {
+        header,
+        scenarioOptions,
+        saveDetails,
+        requiredObjects,
+        gameState,
+        tileElements,
+        count,
+    };
+
+    constexpr size_t kNumSections = static_cast<size_t>(Section::count);
+
+    // Block hashes of a saved state, a delta is written against these rather than the full state.
+    struct Fingerprint
+    {
+        std::array<size_t, kNumSections> lengths{};
+        std::array<std::vector<uint64_t>, kNumSections> blockHashes;
+        uint64_t hash{};
+    };
+
+    Fingerprint getFingerprint(const S5File& file);
+
+    // Writes the blocks of file that differ from parent, returns the fingerprint of file.
+    Fingerprint write(Stream& stream, const S5File& file, const Fingerprint& parent);
+
+    // Applies the delta to file, which must be the state the delta was written against.
+    void apply(Stream& stream, S5File& file);
+
+    // Loads the base save and applies each delta in order.
+    std::unique_ptr<S5File> importChain(const fs::path& basePath, std::span<const fs::path> deltaPaths);
+}
@@ -25,6 +25,8 @@ namespace OpenLoco::S5::Limits
     constexpr size_t maxNormalEntities = kMaxEntities - kMaxMoneyEntities;
     // Money is not counted in this limit
     constexpr size_t kMaxMiscEntities = 4000;
+    // Misc entities share the normal pool with vehicles so raising their cap does not change the save layout
+    constexpr size_t kMaxMiscEntitiesExtended = 8000;
     constexpr size_t kMaxStationCargoDensity = 15;
 
     constexpr size_t kMaxInterfaceObjects = 1;
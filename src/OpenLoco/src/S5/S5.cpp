@@ -1,6 +1,7 @@
 #define DO_TITLE_SEQUENCE_CHECKS
 
 #include "S5.h"
+#include "CompressedSave.h"
 
 #include "Audio/Audio.h"
 #include "EditorController.h"
@@ -16,8 +17,10 @@
 #include "Localisation/Formatting.h"
 #include "Localisation/StringIds.h"
 #include "Localisation/StringManager.h"
+#include "Map/AnimationManager.h"
 #include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
+#include "MessageManager.h"
 #include "Objects/LandObject.h"
 #include "Objects/ObjectIndex.h"
 #include "Objects/ObjectManager.h"
@@ -31,16 +34,24 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/RoutingManager.h"
+#include "Vehicles/Vehicle.h"
+#include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/JobSystem.h>
 #include <OpenLoco/Core/Stream.hpp>
+#include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Tracing.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 
 using namespace OpenLoco::Interop;
@@ -63,7 +74,13 @@ namespace OpenLoco::S5
     // TODO: move this?
     static std::vector<ObjectHeader> _loadErrorObjectsList;
 
+    struct ExportChunks;
     static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    static bool exportChunks(Stream& stream, const ExportChunks& chunks, const std::vector<ObjectHeader>& packedObjects);
+    static bool exportLiveGameState(Stream& stream, SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects);
+    static bool importSaveToGameState(Stream* stream, const S5File* decodedFile, LoadFlags flags);
+    static bool exportCompressedGameState(Stream& stream, S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    static void fixState(GameState& state);
 
     constexpr bool hasSaveFlags(SaveFlags flags, SaveFlags flagsToTest)
     {
@@ -94,6 +111,13 @@ namespace OpenLoco::S5
         result.version = kCurrentVersion;
         result.magic = kMagicNumber;
 
+        if (kMapColumns != kVanillaMapSize || kMapRows != kVanillaMapSize)
+        {
+            result.flags |= HeaderFlags::hasMapSize;
+            result.mapColumns = kMapColumns;
+            result.mapRows = kMapRows;
+        }
+
         if (hasSaveFlags(flags, SaveFlags::raw))
         {
             result.flags |= HeaderFlags::isRaw;
@@ -184,6 +208,69 @@ namespace OpenLoco::S5
         }
     }
 
+    // The main viewport already shows the preview when it has the same zoom and flags, as the
+    // preview is centred on it. Copying its pixels from the last frame saves a paint pass, as
+    // long as no other window covers that part of the screen.
+    static bool copySavePreviewFromScreen(void* pixels, Ui::Size size, const Viewport& mainViewport, const Viewport& saveVp)
+    {
+        if (mainViewport.zoom != saveVp.zoom || mainViewport.flags != saveVp.flags)
+        {
+            return false;
+        }
+
+        auto& drawingEngine = Gfx::getDrawingEngine();
+        const auto& screenRT = drawingEngine.getScreenRT();
+        if (screenRT.bits == nullptr || drawingEngine.isShowingDirtyRegions())
+        {
+            return false;
+        }
+
+        // Pixels only line up when both views start on the same pixel boundary
+        const auto offsetX = saveVp.viewX - mainViewport.viewX;
+        const auto offsetY = saveVp.viewY - mainViewport.viewY;
+        const auto zoomMask = (1 << saveVp.zoom) - 1;
+        if ((offsetX & zoomMask) != 0 || (offsetY & zoomMask) != 0)
+        {
+            return false;
+        }
+
+        const auto left = mainViewport.x + (offsetX >> saveVp.zoom);
+        const auto top = mainViewport.y + (offsetY >> saveVp.zoom);
+        const auto right = left + size.width;
+        const auto bottom = top + size.height;
+        if (left < mainViewport.x || top < mainViewport.y
+            || right > mainViewport.x + mainViewport.width || bottom > mainViewport.y + mainViewport.height
+            || left < screenRT.x || top < screenRT.y
+            || right > screenRT.x + screenRT.width || bottom > screenRT.y + screenRT.height)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < WindowManager::count(); i++)
+        {
+            const auto* w = WindowManager::get(i);
+            if (w->type == WindowType::main)
+            {
+                continue;
+            }
+            if (w->x < right && w->x + w->width > left && w->y < bottom && w->y + w->height > top)
+            {
+                return false;
+            }
+        }
+
+        const auto stride = screenRT.width + screenRT.pitch;
+        const auto* src = screenRT.bits + (top - screenRT.y) * stride + (left - screenRT.x);
+        auto* dst = static_cast<uint8_t*>(pixels);
+        for (auto y = 0; y < size.height; y++)
+        {
+            std::memcpy(dst, src, size.width);
+            dst += size.width;
+            src += stride;
+        }
+        return true;
+    }
+
     static void drawSavePreviewImage(void* pixels, Ui::Size size)
     {
         auto mainViewport = WindowManager::getMainViewport();
@@ -209,6 +296,11 @@ namespace OpenLoco::S5
         saveVp.viewX = viewPos.x;
         saveVp.viewY = viewPos.y;
 
+        if (copySavePreviewFromScreen(pixels, size, *mainViewport, saveVp))
+        {
+            return;
+        }
+
         Gfx::RenderTarget rt{};
         rt.bits = static_cast<uint8_t*>(pixels);
         rt.x = 0;
@@ -248,37 +340,43 @@ namespace OpenLoco::S5
      */
     static void removeGhostElements(std::vector<TileElement>& elements)
     {
+        // Compacts the kept elements in place rather than erasing, which would move the rest every time
+        size_t numKept = 0;
         for (size_t i = 0; i < elements.size(); i++)
         {
             if (elements[i].isGhost())
             {
-                if (elements[i].isLast())
+                if (!elements[i].isLast())
                 {
-                    if (i == 0 || elements[i - 1].isLast())
-                    {
-                        // First element of tile, can not remove...
-                    }
-                    else
-                    {
-                        elements[i - 1].setLast(true);
-                        elements.erase(elements.begin() + i);
-                        i--;
-                    }
+                    continue;
                 }
-                else
+                if (numKept != 0 && !elements[numKept - 1].isLast())
                 {
-                    elements.erase(elements.begin() + i);
-                    i--;
+                    elements[numKept - 1].setLast(true);
+                    continue;
                 }
+                // First element of tile, can not remove...
             }
+            elements[numKept++] = elements[i];
         }
+        elements.resize(numKept);
     }
 
-    static std::unique_ptr<S5File> prepareGameState(SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects)
+    // Stores the main view and magic number in the game state, which the game only reads back on load
+    static void prepareSavedView(GameState& state)
     {
         auto mainWindow = WindowManager::getMainWindow();
         auto savedView = mainWindow != nullptr && mainWindow->viewports[0] != nullptr ? mainWindow->viewports[0]->toSavedView() : SavedViewSimple{ 0, 0, 0, 0 };
 
+        state.savedViewX = savedView.viewX;
+        state.savedViewY = savedView.viewY;
+        state.savedViewZoom = static_cast<uint8_t>(savedView.zoomLevel);
+        state.savedViewRotation = savedView.rotation;
+        state.magicNumber = kMagicNumber; // Match implementation at 0x004437FC
+    }
+
+    static std::unique_ptr<S5File> prepareGameState(SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects)
+    {
         auto file = std::make_unique<S5File>();
         file->header = prepareHeader(flags, packedObjects.size());
         if (file->header.type == S5Type::scenario || file->header.type == S5Type::landscape)
@@ -291,16 +389,16 @@ namespace OpenLoco::S5
         }
         std::memcpy(file->requiredObjects, requiredObjects.data(), sizeof(file->requiredObjects));
         file->gameState = _gameState;
-        file->gameState.savedViewX = savedView.viewX;
-        file->gameState.savedViewY = savedView.viewY;
-        file->gameState.savedViewZoom = static_cast<uint8_t>(savedView.zoomLevel);
-        file->gameState.savedViewRotation = savedView.rotation;
-        file->gameState.magicNumber = kMagicNumber; // Match implementation at 0x004437FC
+        prepareSavedView(file->gameState);
 
         auto tileElements = TileManager::getElements();
         file->tileElements.resize(tileElements.size());
         std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size_bytes());
         removeGhostElements(file->tileElements);
+        if (file->tileElements.size() > TileManager::kMaxElements)
+        {
+            Logging::warn("Saving {} tile elements, Locomotion is limited to {}", file->tileElements.size(), TileManager::kMaxElements);
+        }
         return file;
     }
 
@@ -312,21 +410,8 @@ namespace OpenLoco::S5
             && !SceneManager::isNetworked();
     }
 
-    // 0x00441C26
-    bool exportGameStateToFile(const fs::path& path, SaveFlags flags)
+    static void prepareExport(SaveFlags flags)
     {
-        FileStream fs(path, StreamMode::write);
-        return exportGameStateToFile(fs, flags);
-    }
-
-    bool exportGameStateToFile(Stream& stream, SaveFlags flags)
-    {
-        if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
-        {
-            Ui::ProgressBar::begin(StringIds::please_wait);
-            Ui::ProgressBar::setProgress(20);
-        }
-
         if ((flags & SaveFlags::noWindowClose) == SaveFlags::none
             && (flags & SaveFlags::raw) == SaveFlags::none
             && (flags & SaveFlags::dump) == SaveFlags::none)
@@ -343,6 +428,35 @@ namespace OpenLoco::S5
             Vehicles::OrderManager::zeroUnusedOrderTable();
         }
 
+        World::AnimationManager::toVanillaLayout();
+    }
+
+    static void finishExport(SaveFlags flags)
+    {
+        if ((flags & SaveFlags::raw) == SaveFlags::none
+            && (flags & SaveFlags::dump) == SaveFlags::none)
+        {
+            ObjectManager::reloadAll();
+        }
+    }
+
+    // 0x00441C26
+    bool exportGameStateToFile(const fs::path& path, SaveFlags flags)
+    {
+        FileStream fs(path, StreamMode::write);
+        return exportGameStateToFile(fs, flags);
+    }
+
+    bool exportGameStateToFile(Stream& stream, SaveFlags flags)
+    {
+        if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
+        {
+            Ui::ProgressBar::begin(StringIds::please_wait);
+            Ui::ProgressBar::setProgress(20);
+        }
+
+        prepareExport(flags);
+
         if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
         {
             Ui::ProgressBar::setProgress(40);
@@ -359,8 +473,15 @@ namespace OpenLoco::S5
                 });
             }
 
-            auto file = prepareGameState(flags, requiredObjects, packedObjects);
-            saveResult = exportGameState(stream, *file, packedObjects);
+            if ((flags & SaveFlags::compressed) != SaveFlags::none)
+            {
+                auto file = prepareGameState(flags, requiredObjects, packedObjects);
+                saveResult = exportCompressedGameState(stream, *file, packedObjects);
+            }
+            else
+            {
+                saveResult = exportLiveGameState(stream, flags, requiredObjects, packedObjects);
+            }
         }
 
         if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
@@ -368,11 +489,7 @@ namespace OpenLoco::S5
             Ui::ProgressBar::setProgress(230);
         }
 
-        if ((flags & SaveFlags::raw) == SaveFlags::none
-            && (flags & SaveFlags::dump) == SaveFlags::none)
-        {
-            ObjectManager::reloadAll();
-        }
+        finishExport(flags);
 
         if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
         {
@@ -393,35 +510,98 @@ namespace OpenLoco::S5
         return false;
     }
 
-    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    std::unique_ptr<S5File> takeGameStateSnapshot(SaveFlags flags)
+    {
+        prepareExport(flags);
+        auto file = prepareGameState(flags, ObjectManager::getHeaders(), {});
+        finishExport(flags);
+
+        Gfx::invalidateScreen();
+        if ((flags & SaveFlags::raw) == SaveFlags::none)
+        {
+            SceneManager::resetSceneAge();
+        }
+        return file;
+    }
+
+    bool exportSnapshotToFile(const fs::path& path, const S5File& file, SaveFlags flags)
     {
         try
         {
-            SawyerStreamWriter fs(stream);
-            fs.writeChunk(SawyerEncoding::rotate, file.header);
-            if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
+            FileStream fs(path, StreamMode::write);
+            if ((flags & SaveFlags::compressed) != SaveFlags::none)
             {
-                fs.writeChunk(SawyerEncoding::rotate, *file.scenarioOptions);
+                CompressedSave::write(fs, file);
+                return true;
             }
-            if (file.header.hasFlags(HeaderFlags::hasSaveDetails))
+            return exportGameState(fs, file, {});
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to save S5: {}", e.what());
+            return false;
+        }
+    }
+
+    // The chunks of a save in the order they are written. Nothing is owned, so the game state and
+    // tile elements can be written straight from the live state without copying them first.
+    struct ExportChunks
+    {
+        const Header& header;
+        const Options* scenarioOptions;
+        const SaveDetails* saveDetails;
+        const ObjectHeader* requiredObjects;
+        const GameState& gameState;
+        std::span<const TileElement> tileElements;
+    };
+
+    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    {
+        const ExportChunks chunks{ file.header, file.scenarioOptions.get(), file.saveDetails.get(), file.requiredObjects, file.gameState, file.tileElements };
+        return exportChunks(stream, chunks, packedObjects);
+    }
+
+    static bool exportChunks(Stream& stream, const ExportChunks& file, const std::vector<ObjectHeader>& packedObjects)
+    {
+        try
+        {
+            Diagnostics::Tracing::ScopedEvent traceExport("S5Export", "s5");
+
+            SawyerStreamWriter fs(stream);
             {
-                fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+                Diagnostics::Tracing::ScopedEvent traceEvent("header", "s5");
+                fs.writeChunk(SawyerEncoding::rotate, file.header);
+                if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
+                {
+                    fs.writeChunk(SawyerEncoding::rotate, *file.scenarioOptions);
+                }
+                if (file.header.hasFlags(HeaderFlags::hasSaveDetails))
+                {
+                    fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+                }
             }
             if (file.header.numPackedObjects != 0)
             {
+                Diagnostics::Tracing::ScopedEvent traceEvent("packed objects", "s5");
                 ObjectManager::writePackedObjects(fs, packedObjects);
             }
-            fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(file.requiredObjects));
-
-            if (file.header.type == S5Type::scenario)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+                Diagnostics::Tracing::ScopedEvent traceEvent("required objects", "s5");
+                fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(S5File::requiredObjects));
             }
-            else
+
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                Diagnostics::Tracing::ScopedEvent traceEvent("game state", "s5");
+                if (file.header.type == S5Type::scenario)
+                {
+                    fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
+                    fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
+                    fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+                }
+                else
+                {
+                    fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                }
             }
 
             if (file.header.hasFlags(HeaderFlags::isRaw))
@@ -430,7 +610,8 @@ namespace OpenLoco::S5
             }
             else
             {
-                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+                Diagnostics::Tracing::ScopedEvent traceEvent("tile elements", "s5");
+                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size_bytes());
             }
 
             fs.writeChecksum();
@@ -443,6 +624,76 @@ namespace OpenLoco::S5
         }
     }
 
+    // Writes the game state and tile elements from where they live instead of from a copy, which
+    // would double the memory they take while saving. Only the few fields that differ in a save are
+    // swapped in and restored afterwards.
+    static bool exportLiveGameState(Stream& stream, SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects)
+    {
+        // Ghosts are left out of saves, which needs the copy to remove them from
+        const auto liveElements = TileManager::getElements();
+        if (std::any_of(liveElements.begin(), liveElements.end(), [](const World::TileElement& el) { return el.isGhost(); }))
+        {
+            auto file = prepareGameState(flags, requiredObjects, packedObjects);
+            return exportGameState(stream, *file, packedObjects);
+        }
+        // Same layout, as for loading
+        const auto tileElements = std::span<const TileElement>(reinterpret_cast<const TileElement*>(liveElements.data()), liveElements.size());
+        if (tileElements.size() > TileManager::kMaxElements)
+        {
+            Logging::warn("Saving {} tile elements, Locomotion is limited to {}", tileElements.size(), TileManager::kMaxElements);
+        }
+
+        const auto header = prepareHeader(flags, packedObjects.size());
+        std::unique_ptr<Options> scenarioOptions;
+        if (header.type == S5Type::scenario || header.type == S5Type::landscape)
+        {
+            scenarioOptions = std::make_unique<Options>(_activeOptions);
+        }
+        std::unique_ptr<SaveDetails> saveDetails;
+        if (header.hasFlags(HeaderFlags::hasSaveDetails))
+        {
+            saveDetails = prepareSaveDetails(_gameState);
+        }
+        std::vector<ObjectHeader> requiredObjectsChunk(sizeof(S5File::requiredObjects) / sizeof(ObjectHeader));
+        std::copy_n(requiredObjects.begin(), std::min(requiredObjects.size(), requiredObjectsChunk.size()), requiredObjectsChunk.begin());
+
+        const auto savedViewX = _gameState.savedViewX;
+        const auto savedViewY = _gameState.savedViewY;
+        const auto savedViewZoom = _gameState.savedViewZoom;
+        const auto savedViewRotation = _gameState.savedViewRotation;
+        const auto magicNumber = _gameState.magicNumber;
+        prepareSavedView(_gameState);
+
+        const ExportChunks chunks{ header, scenarioOptions.get(), saveDetails.get(), requiredObjectsChunk.data(), _gameState, tileElements };
+        const auto result = exportChunks(stream, chunks, packedObjects);
+
+        _gameState.savedViewX = savedViewX;
+        _gameState.savedViewY = savedViewY;
+        _gameState.savedViewZoom = savedViewZoom;
+        _gameState.savedViewRotation = savedViewRotation;
+        _gameState.magicNumber = magicNumber;
+        return result;
+    }
+
+    static bool exportCompressedGameState(Stream& stream, S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    {
+        try
+        {
+            for (const auto& header : packedObjects)
+            {
+                auto data = ObjectManager::getPackedObjectData(header);
+                file.packedObjects.emplace_back(header, std::vector<std::byte>(data.begin(), data.end()));
+            }
+            CompressedSave::write(stream, file);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to save S5: {}", e.what());
+            return false;
+        }
+    }
+
     // 0x00445A4A
     static void fixState(GameState& state)
     {
@@ -483,8 +734,67 @@ namespace OpenLoco::S5
     }
 
     // 0x00441FC9
+    // A chunk copied as is from the stream, it is decoded by a reader of its own on a worker thread.
+    struct PendingChunk
+    {
+        const char* name;
+        std::unique_ptr<MemoryStream> data;
+        std::function<void(SawyerStreamReader&)> decode;
+        float decodeTime{};
+    };
+
+    static std::unique_ptr<MemoryStream> readEncodedChunk(Stream& stream)
+    {
+        constexpr size_t kChunkHeaderSize = sizeof(SawyerEncoding) + sizeof(uint32_t);
+
+        std::byte header[kChunkHeaderSize];
+        stream.read(header, sizeof(header));
+        uint32_t length;
+        std::memcpy(&length, header + sizeof(SawyerEncoding), sizeof(length));
+        if (length > stream.getLength() - stream.getPosition())
+        {
+            throw Exception::RuntimeError("Chunk exceeds the end of the file");
+        }
+
+        auto chunk = std::make_unique<MemoryStream>();
+        chunk->resize(kChunkHeaderSize + length);
+        std::memcpy(chunk->data(), header, sizeof(header));
+        stream.read(chunk->data() + kChunkHeaderSize, length);
+        return chunk;
+    }
+
+    static bool hasAnotherChunk(const Stream& stream)
+    {
+        // Only the checksum follows the last chunk
+        return stream.getLength() - stream.getPosition() > sizeof(uint32_t);
+    }
+
+    static void decodeChunks(std::vector<PendingChunk>& chunks)
+    {
+        Core::JobSystem::get().parallelFor("Decode save chunks", chunks.size(), 1, [&chunks](size_t begin, size_t end) {
+            for (auto i = begin; i < end; i++)
+            {
+                auto& chunk = chunks[i];
+                Diagnostics::Tracing::ScopedEvent traceEvent(chunk.name, "s5");
+                Core::Timer timer;
+                SawyerStreamReader reader(*chunk.data);
+                chunk.decode(reader);
+                chunk.decodeTime = timer.elapsed();
+            }
+        });
+    }
+
     std::unique_ptr<S5File> importSave(Stream& stream)
     {
+        if (CompressedSave::isCompressed(stream))
+        {
+            auto file = CompressedSave::read(stream);
+            fixState(file->gameState);
+            return file;
+        }
+
+        Diagnostics::Tracing::ScopedEvent traceImport("S5Import", "s5");
+
         SawyerStreamReader fs(stream);
         if (!fs.validateChecksum())
         {
@@ -500,7 +810,7 @@ namespace OpenLoco::S5
         if (file->header.hasFlags(HeaderFlags::hasSaveDetails))
         {
             file->saveDetails = std::make_unique<SaveDetails>();
-            fs.readChunk(file->saveDetails.get(), sizeof(file->saveDetails));
+            fs.readChunk(file->saveDetails.get(), sizeof(*file->saveDetails));
         }
         if (file->header.type == S5Type::scenario)
         {
@@ -523,43 +833,80 @@ namespace OpenLoco::S5
             // 0x004420B2
         }
 
+        // The remaining chunks hold nearly all of the data, they are read first and then decoded in parallel
+        Core::Timer readTimer;
+        std::vector<PendingChunk> chunks;
+        auto addChunk = [&chunks, &stream](const char* name, std::function<void(SawyerStreamReader&)> decode) {
+            chunks.push_back(PendingChunk{ name, readEncodedChunk(stream), std::move(decode) });
+        };
+
+        // Load required objects
+        addChunk("required objects", [&file](SawyerStreamReader& reader) {
+            reader.readChunk(file->requiredObjects, sizeof(file->requiredObjects));
+        });
+
+        auto* gameStateStart = reinterpret_cast<std::byte*>(&file->gameState);
+        auto* gameStateEnd = reinterpret_cast<std::byte*>(&file->gameState + 1);
         if (file->header.type == S5Type::scenario)
         {
-            // Load required objects
-            fs.readChunk(file->requiredObjects, sizeof(file->requiredObjects));
+            // Each part is limited to its own range of the game state so that they can be decoded at the same time
+            auto* towns = reinterpret_cast<std::byte*>(&file->gameState.towns);
+            auto* animations = reinterpret_cast<std::byte*>(&file->gameState.animations);
 
             // Load game state up to just before companies
-            fs.readChunk(&file->gameState, sizeof(file->gameState));
+            addChunk("game state", [=](SawyerStreamReader& reader) {
+                reader.readChunk(gameStateStart, static_cast<size_t>(towns - gameStateStart));
+            });
             // Load game state towns industry and stations
-            fs.readChunk(&file->gameState.towns, sizeof(file->gameState));
+            addChunk("towns, industries and stations", [=](SawyerStreamReader& reader) {
+                reader.readChunk(towns, static_cast<size_t>(animations - towns));
+            });
             // Load the rest of gamestate after animations
-            fs.readChunk(&file->gameState.animations, sizeof(file->gameState));
-            file->gameState.fixFlags |= S5FixFlags::fixFlag1;
-            fixState(file->gameState);
-
-            if ((file->gameState.flags & GameStateFlags::tileManagerLoaded) != GameStateFlags::none)
+            addChunk("animations", [=](SawyerStreamReader& reader) {
+                reader.readChunk(animations, static_cast<size_t>(gameStateEnd - animations));
+            });
+            if (hasAnotherChunk(stream))
             {
                 // Load tile elements
-                auto tileElements = fs.readChunk();
-                auto numTileElements = tileElements.size() / sizeof(TileElement);
-                file->tileElements.resize(numTileElements);
-                std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+                addChunk("tile elements", [&file](SawyerStreamReader& reader) {
+                    reader.readChunk(file->tileElements);
+                });
             }
         }
         else
         {
-            // Load required objects
-            fs.readChunk(file->requiredObjects, sizeof(file->requiredObjects));
-
             // Load game state
-            fs.readChunk(&file->gameState, sizeof(file->gameState));
+            addChunk("game state", [=](SawyerStreamReader& reader) {
+                reader.readChunk(gameStateStart, sizeof(file->gameState));
+            });
+            // Load tile elements
+            addChunk("tile elements", [&file](SawyerStreamReader& reader) {
+                reader.readChunk(file->tileElements);
+            });
+        }
+        const auto readTime = readTimer.elapsed();
+
+        decodeChunks(chunks);
+
+        Logging::verbose("Read {} chunks in {:.2f} ms", chunks.size(), readTime);
+        for (const auto& chunk : chunks)
+        {
+            Logging::verbose("  {}: {} bytes decoded in {:.2f} ms", chunk.name, chunk.data->getLength(), chunk.decodeTime);
+        }
+
+        if (file->header.type == S5Type::scenario)
+        {
+            file->gameState.fixFlags |= S5FixFlags::fixFlag1;
             fixState(file->gameState);
 
-            // Load tile elements
-            auto tileElements = fs.readChunk();
-            auto numTileElements = tileElements.size() / sizeof(TileElement);
-            file->tileElements.resize(numTileElements);
-            std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+            if ((file->gameState.flags & GameStateFlags::tileManagerLoaded) == GameStateFlags::none)
+            {
+                file->tileElements.clear();
+            }
+        }
+        else
+        {
+            fixState(file->gameState);
         }
 
         return file;
@@ -610,14 +957,41 @@ namespace OpenLoco::S5
         getGameState().lastWallOption = 0xFF;
     }
 
+    void rebuildDerivedState()
+    {
+        EntityManager::resetSpatialIndex();
+        EntityManager::invalidateVehicleHeadIds();
+        VehicleManager::invalidateIdleHeads();
+        Vehicles::invalidateNetworkConnections();
+        Vehicles::RoutingManager::updateFreeRoutingSlots();
+        StationManager::rebuildStationTileIndex();
+        StationManager::rebuildActiveStations();
+        TownManager::rebuildOccupancy();
+        TownManager::invalidateClosestTownMap();
+        TownManager::invalidateBuildingIndex();
+        IndustryManager::rebuildOccupancy();
+        MessageManager::invalidateSubjectIndex();
+    }
+
     // 0x00441FA7
     bool importSaveToGameState(const fs::path& path, LoadFlags flags)
     {
-        FileStream fs(path, StreamMode::read);
+        FileStream fs(path, StreamMode::readMapped);
         return importSaveToGameState(fs, flags);
     }
 
     bool importSaveToGameState(Stream& stream, LoadFlags flags)
+    {
+        return importSaveToGameState(&stream, nullptr, flags);
+    }
+
+    bool importSaveToGameState(const S5File& file, LoadFlags flags)
+    {
+        return importSaveToGameState(nullptr, &file, flags);
+    }
+
+    // Loads either from the stream or from a file that was decoded before, which is only read from
+    static bool importSaveToGameState(Stream* stream, const S5File* decodedFile, LoadFlags flags)
     {
         SceneManager::setGameSpeed(GameSpeed::Normal);
         if ((flags & LoadFlags::titleSequence) == LoadFlags::none
@@ -632,7 +1006,13 @@ namespace OpenLoco::S5
             Ui::ProgressBar::begin(StringIds::loading);
             Ui::ProgressBar::setProgress(10);
 
-            auto file = importSave(stream);
+            std::unique_ptr<S5File> streamFile;
+            const S5File* file = decodedFile;
+            if (file == nullptr)
+            {
+                streamFile = importSave(*stream);
+                file = streamFile.get();
+            }
 
             Ui::ProgressBar::setProgress(90);
 
@@ -641,6 +1021,11 @@ namespace OpenLoco::S5
                 throw LoadException("Unsupported S5 version", StringIds::error_file_contains_invalid_data);
             }
 
+            if (!file->header.hasCurrentMapSize())
+            {
+                throw LoadException("File is for a different map size", StringIds::error_file_contains_invalid_data);
+            }
+
 #ifdef DO_TITLE_SEQUENCE_CHECKS
             if ((flags & LoadFlags::titleSequence) != LoadFlags::none)
             {
@@ -666,10 +1051,6 @@ namespace OpenLoco::S5
                     Ui::ProgressBar::end();
                     return false;
                 }
-                if (static_cast<EditorController::Step>(file->scenarioOptions->editorStep) == EditorController::Step::null)
-                {
-                    file->scenarioOptions->editorStep = enumValue(EditorController::Step::landscapeEditor);
-                }
             }
 
             Ui::ProgressBar::setProgress(100);
@@ -768,10 +1149,14 @@ namespace OpenLoco::S5
             if (hasLoadFlags(flags, LoadFlags::scenario | LoadFlags::landscape))
             {
                 _activeOptions = *file->scenarioOptions;
+                if (hasLoadFlags(flags, LoadFlags::landscape) && static_cast<EditorController::Step>(_activeOptions.editorStep) == EditorController::Step::null)
+                {
+                    _activeOptions.editorStep = enumValue(EditorController::Step::landscapeEditor);
+                }
             }
             if ((file->gameState.flags & GameStateFlags::tileManagerLoaded) != GameStateFlags::none)
             {
-                TileManager::setElements(std::span<World::TileElement>(reinterpret_cast<World::TileElement*>(file->tileElements.data()), file->tileElements.size()));
+                TileManager::setElements(std::span<const World::TileElement>(reinterpret_cast<const World::TileElement*>(file->tileElements.data()), file->tileElements.size()));
             }
             else
             {
@@ -789,10 +1174,12 @@ namespace OpenLoco::S5
             }
 
             Audio::stopVehicleNoise();
-            EntityManager::resetSpatialIndex();
+            Audio::resetAmbientNoise();
+            rebuildDerivedState();
             CompanyManager::updateColours();
             ObjectManager::sub_4748FA();
             TileManager::resetSurfaceClearance();
+            World::AnimationManager::rebuildSchedule();
             IndustryManager::createAllMapAnimations();
 
             Ui::ProgressBar::setProgress(225);
@@ -902,70 +1289,91 @@ namespace OpenLoco::S5
     // 0x00442403
     std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path)
     {
-        FileStream stream(path, StreamMode::read);
-        SawyerStreamReader fs(stream);
-        if (!fs.validateChecksum())
+        try
         {
-            return nullptr;
-        }
+            FileStream stream(path, StreamMode::readMapped);
+            if (CompressedSave::isCompressed(stream))
+            {
+                auto file = CompressedSave::read(stream, true);
+                if (file->header.version != kCurrentVersion
+                    || !file->header.hasCurrentMapSize()
+                    || file->header.hasFlags(HeaderFlags::isTitleSequence | HeaderFlags::isDump | HeaderFlags::isRaw))
+                {
+                    return nullptr;
+                }
+                return std::move(file->saveDetails);
+            }
 
-        Header s5Header{};
+            // The checksum covers the whole file so it is only validated when the file is loaded,
+            // the header and the chunk after it are all that is read here.
+            SawyerStreamReader fs(stream);
+            Header s5Header{};
 
-        // Read header
-        fs.readChunk(&s5Header, sizeof(s5Header));
+            // Read header
+            fs.readChunk(&s5Header, sizeof(s5Header));
 
-        if (s5Header.version != kCurrentVersion)
-        {
-            return nullptr;
-        }
+            if (s5Header.version != kCurrentVersion || !s5Header.hasCurrentMapSize())
+            {
+                return nullptr;
+            }
 
-        if (s5Header.hasFlags(HeaderFlags::isTitleSequence | HeaderFlags::isDump | HeaderFlags::isRaw))
-        {
+            if (s5Header.hasFlags(HeaderFlags::isTitleSequence | HeaderFlags::isDump | HeaderFlags::isRaw))
+            {
+                return nullptr;
+            }
+
+            if (s5Header.hasFlags(HeaderFlags::hasSaveDetails))
+            {
+                // 0x0050AEA8
+                auto ret = std::make_unique<SaveDetails>();
+                fs.readChunk(ret.get(), sizeof(*ret));
+                return ret;
+            }
             return nullptr;
         }
-
-        if (s5Header.hasFlags(HeaderFlags::hasSaveDetails))
+        catch (const std::exception& e)
         {
-            // 0x0050AEA8
-            auto ret = std::make_unique<SaveDetails>();
-            fs.readChunk(ret.get(), sizeof(*ret));
-            return ret;
+            Logging::warn("Unable to read {}: {}", path.u8string(), e.what());
+            return nullptr;
         }
-        return nullptr;
     }
 
     // 0x00442AFC
     std::unique_ptr<Scenario::Options> readScenarioOptions(const fs::path& path)
     {
-        FileStream stream(path, StreamMode::read);
-        SawyerStreamReader fs(stream);
-        if (!fs.validateChecksum())
+        try
         {
-            return nullptr;
-        }
+            FileStream stream(path, StreamMode::readMapped);
+            // Checksum is validated when the file is loaded
+            SawyerStreamReader fs(stream);
+            Header s5Header{};
 
-        Header s5Header{};
+            // Read header
+            fs.readChunk(&s5Header, sizeof(s5Header));
 
-        // Read header
-        fs.readChunk(&s5Header, sizeof(s5Header));
+            if (s5Header.version != kCurrentVersion || !s5Header.hasCurrentMapSize())
+            {
+                return nullptr;
+            }
 
-        if (s5Header.version != kCurrentVersion)
-        {
+            if (s5Header.type == S5Type::scenario)
+            {
+                // 0x009DA285 = 1
+                // 0x009CCA54 _previewOptions
+
+                // TODO: For now OpenLoco::Options and S5::Options are identical in the future
+                // there should be an import and validation step that converts from one to the
+                // other
+                auto ret = std::make_unique<Scenario::Options>();
+                fs.readChunk(ret.get(), sizeof(*ret));
+                return ret;
+            }
             return nullptr;
         }
-
-        if (s5Header.type == S5Type::scenario)
+        catch (const std::exception& e)
         {
-            // 0x009DA285 = 1
-            // 0x009CCA54 _previewOptions
-
-            // TODO: For now OpenLoco::Options and S5::Options are identical in the future
-            // there should be an import and validation step that converts from one to the
-            // other
-            auto ret = std::make_unique<Scenario::Options>();
-            fs.readChunk(ret.get(), sizeof(*ret));
-            return ret;
+            Logging::warn("Unable to read {}: {}", path.u8string(), e.what());
+            return nullptr;
         }
-        return nullptr;
     }
 }
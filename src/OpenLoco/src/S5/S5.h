@@ -7,6 +7,7 @@
 #include "World/CompanyManager.h"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Engine/World.hpp>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -39,6 +40,8 @@ namespace OpenLoco::S5
         isDump = 1U << 1,
         isTitleSequence = 1U << 2,
         hasSaveDetails = 1U << 3,
+        // Set when the map isn't the size of the original game, the size is then in the header.
+        hasMapSize = 1U << 4,
     };
     OPENLOCO_ENABLE_ENUM_OPERATORS(HeaderFlags);
 
@@ -50,11 +53,22 @@ namespace OpenLoco::S5
         uint16_t numPackedObjects;
         uint32_t version;
         uint32_t magic;
-        std::byte padding[20];
+        uint16_t mapColumns;
+        uint16_t mapRows;
+        std::byte padding[16];
         constexpr bool hasFlags(HeaderFlags flagsToTest) const
         {
             return (flags & flagsToTest) != HeaderFlags::none;
         }
+        // Whether the save is for the map size of this build.
+        constexpr bool hasCurrentMapSize() const
+        {
+            if (hasFlags(HeaderFlags::hasMapSize))
+            {
+                return mapColumns == World::kMapColumns && mapRows == World::kMapRows;
+            }
+            return World::kMapColumns == World::kVanillaMapSize && World::kMapRows == World::kVanillaMapSize;
+        }
     };
 #pragma pack(pop)
     // static_assert(sizeof(Header) == 0x20); // COMMENTED FOR 64-BIT DEBUG
@@ -383,6 +397,7 @@ namespace OpenLoco::S5
         packCustomObjects = 1U << 0,
         scenario = 1U << 1,
         landscape = 1U << 2,
+        compressed = 1U << 3, // Use the compressed container, which vanilla can't load
         isAutosave = 1U << 28,
         noWindowClose = 1U << 29,
         raw = 1U << 30,  // Save raw data including pointers with no clean up
@@ -401,11 +416,21 @@ namespace OpenLoco::S5
     bool exportGameStateToFile(const fs::path& path, SaveFlags flags);
     bool exportGameStateToFile(Stream& stream, SaveFlags flags);
 
+    // Copies everything that gets saved, does not pack any objects. Only the copy is used by
+    // exportSnapshotToFile so that can run on another thread while the game continues.
+    std::unique_ptr<S5File> takeGameStateSnapshot(SaveFlags flags);
+    bool exportSnapshotToFile(const fs::path& path, const S5File& file, SaveFlags flags);
+
     const std::vector<ObjectHeader>& getObjectErrorList();
 
     std::unique_ptr<S5File> importSave(Stream& stream);
     bool importSaveToGameState(const fs::path& path, LoadFlags flags);
     bool importSaveToGameState(Stream& stream, LoadFlags flags);
+    // Loads a save that was decoded by importSave, the file is left as it was so it can be loaded again.
+    bool importSaveToGameState(const S5File& file, LoadFlags flags);
+    // Rebuilds the indices and caches derived from the game state and tile elements after both
+    // have been replaced.
+    void rebuildDerivedState();
     std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path);
     std::unique_ptr<Scenario::Options> readScenarioOptions(const fs::path& path);
 
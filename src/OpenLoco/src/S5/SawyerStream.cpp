@@ -7,6 +7,14 @@
 #include <memory>
 #include <stdexcept>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENLOCO_SAWYER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define OPENLOCO_SAWYER_NEON
+#include <arm_neon.h>
+#endif
+
 using namespace OpenLoco;
 
 constexpr const char* exceptionReadError = "Failed to read data from stream";
@@ -14,6 +22,139 @@ constexpr const char* exceptionWriteError = "Failed to write data to stream";
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
 
+// Byte scanning helpers for the encoders and checksums, these look at 16 bytes at a time where the
+// target guarantees SSE2 or NEON and produce exactly the same results as the scalar loops.
+namespace OpenLoco::SawyerScan
+{
+#if defined(OPENLOCO_SAWYER_SSE2)
+    static uint32_t getEqualMask(const uint8_t* a, const uint8_t* b)
+    {
+        const auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        const auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    }
+
+    static uint32_t getEqualMask(const uint8_t* a, uint8_t value)
+    {
+        const auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, _mm_set1_epi8(static_cast<char>(value)))));
+    }
+#elif defined(OPENLOCO_SAWYER_NEON)
+    static uint32_t getMask(uint8x16_t isEqual)
+    {
+        static constexpr uint8_t kBits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const auto bits = vandq_u8(isEqual, vld1q_u8(kBits));
+        return vaddv_u8(vget_low_u8(bits)) | (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+    }
+
+    static uint32_t getEqualMask(const uint8_t* a, const uint8_t* b)
+    {
+        return getMask(vceqq_u8(vld1q_u8(a), vld1q_u8(b)));
+    }
+
+    static uint32_t getEqualMask(const uint8_t* a, uint8_t value)
+    {
+        return getMask(vceqq_u8(vld1q_u8(a), vdupq_n_u8(value)));
+    }
+#endif
+
+    // Sum of all bytes, the Sawyer checksum.
+    static uint32_t sumBytes(const uint8_t* data, size_t length)
+    {
+        uint32_t sum = 0;
+        size_t i = 0;
+#if defined(OPENLOCO_SAWYER_SSE2)
+        const auto zero = _mm_setzero_si128();
+        auto acc = _mm_setzero_si128();
+        for (; i + 16 <= length; i += 16)
+        {
+            const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+        }
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        sum = static_cast<uint32_t>(lanes[0] + lanes[1]);
+#elif defined(OPENLOCO_SAWYER_NEON)
+        for (; i + 16 <= length; i += 16)
+        {
+            sum += vaddlvq_u8(vld1q_u8(data + i));
+        }
+#endif
+        for (; i < length; i++)
+        {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    // Index of the first k < length where data[k] == data[k + 1], or length. data[length] must be readable.
+    static size_t findRepeat(const uint8_t* data, size_t length)
+    {
+        size_t i = 0;
+#if defined(OPENLOCO_SAWYER_SSE2) || defined(OPENLOCO_SAWYER_NEON)
+        for (; i + 16 <= length; i += 16)
+        {
+            const auto mask = getEqualMask(data + i, data + i + 1);
+            if (mask != 0)
+            {
+                return i + std::countr_zero(mask);
+            }
+        }
+#endif
+        for (; i < length; i++)
+        {
+            if (data[i] == data[i + 1])
+            {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    // Number of leading bytes equal to data[0], at most length.
+    static size_t countRun(const uint8_t* data, size_t length)
+    {
+        const auto value = data[0];
+        size_t i = 0;
+#if defined(OPENLOCO_SAWYER_SSE2) || defined(OPENLOCO_SAWYER_NEON)
+        for (; i + 16 <= length; i += 16)
+        {
+            const auto mask = getEqualMask(data + i, value);
+            if (mask != 0xFFFF)
+            {
+                return i + std::countr_one(mask);
+            }
+        }
+#endif
+        for (; i < length; i++)
+        {
+            if (data[i] != value)
+            {
+                return i;
+            }
+        }
+        return length;
+    }
+
+    // Bit n is set if window[n] == value, for the 32 bytes of the window.
+    static uint32_t findInWindow(const uint8_t* window, uint8_t value)
+    {
+#if defined(OPENLOCO_SAWYER_SSE2) || defined(OPENLOCO_SAWYER_NEON)
+        return getEqualMask(window, value) | (getEqualMask(window + 16, value) << 16);
+#else
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < 32; i++)
+        {
+            if (window[i] == value)
+            {
+                mask |= 1U << i;
+            }
+        }
+        return mask;
+#endif
+    }
+}
+
 SawyerStreamReader::SawyerStreamReader(Stream& stream)
     : _stream(stream)
 {
@@ -21,23 +162,36 @@ SawyerStreamReader::SawyerStreamReader(Stream& stream)
 
 std::span<const std::byte> SawyerStreamReader::readChunk()
 {
-    SawyerEncoding encoding;
-    read(&encoding, sizeof(encoding));
-
-    uint32_t length;
-    read(&length, sizeof(length));
-
-    _decodeBuffer.resize(length);
-    read(_decodeBuffer.data(), length);
+    const auto length = readChunkData();
+    if (_chunkEncoding == SawyerEncoding::uncompressed)
+    {
+        return _chunkData;
+    }
 
-    return decode(encoding, _decodeBuffer.getSpan());
+    // The encoded data is held in one of the buffers, decode into the other
+    auto& output = _chunkData.data() == _decodeBuffer.data() ? _decodeBuffer2 : _decodeBuffer;
+    output.resize(length);
+    decodeChunkData(output.getSpan());
+    return output.getSpan();
 }
 
 size_t SawyerStreamReader::readChunk(void* data, size_t maxDataLen)
 {
-    auto chunkData = readChunk();
-    std::memcpy(data, chunkData.data(), std::min(chunkData.size(), maxDataLen));
-    return chunkData.size();
+    const auto length = readChunkData();
+    decodeChunkData(std::span(static_cast<std::byte*>(data), maxDataLen));
+    return length;
+}
+
+std::span<const std::byte> SawyerStreamReader::readView(size_t dataLen)
+{
+    try
+    {
+        return _stream.readView(dataLen);
+    }
+    catch (...)
+    {
+        throw Exception::RuntimeError(exceptionReadError);
+    }
 }
 
 void SawyerStreamReader::read(void* data, size_t dataLen)
@@ -67,14 +221,18 @@ bool SawyerStreamReader::validateChecksum()
         // Calculate checksum
         uint32_t actualChecksum = 0;
         _stream.setPosition(0);
-        uint8_t buffer[2048];
-        for (uint32_t i = 0; i < fileLength - 4; i += sizeof(buffer))
+        if (const auto view = _stream.readView(fileLength - 4); view.size() == fileLength - 4)
+        {
+            actualChecksum = SawyerScan::sumBytes(reinterpret_cast<const uint8_t*>(view.data()), view.size());
+        }
+        else
         {
-            auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
-            _stream.read(buffer, readLength);
-            for (size_t j = 0; j < readLength; j++)
+            uint8_t buffer[2048];
+            for (uint32_t i = 0; i < fileLength - 4; i += sizeof(buffer))
             {
-                actualChecksum += buffer[j];
+                auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
+                _stream.read(buffer, readLength);
+                actualChecksum += SawyerScan::sumBytes(buffer, readLength);
             }
         }
 
@@ -87,46 +245,168 @@ bool SawyerStreamReader::validateChecksum()
     return valid;
 }
 
-std::span<const std::byte> SawyerStreamReader::decode(SawyerEncoding encoding, std::span<const std::byte> data)
+namespace
 {
-    switch (encoding)
+    // Decoded bytes are written straight into the destination, anything past its end is only counted.
+    class DecodeOutput
+    {
+    private:
+        std::span<std::byte> _destination;
+        size_t _length{};
+
+    public:
+        DecodeOutput(std::span<std::byte> destination)
+            : _destination(destination)
+        {
+        }
+
+        size_t getLength() const
+        {
+            return _length;
+        }
+
+        void write(const std::byte* data, size_t count)
+        {
+            if (_length < _destination.size())
+            {
+                std::memcpy(&_destination[_length], data, std::min(count, _destination.size() - _length));
+            }
+            _length += count;
+        }
+
+        void writeValue(std::byte value)
+        {
+            if (_length < _destination.size())
+            {
+                _destination[_length] = value;
+            }
+            _length++;
+        }
+
+        void fill(std::byte value, size_t count)
+        {
+            if (_length < _destination.size())
+            {
+                std::memset(&_destination[_length], static_cast<int>(value), std::min(count, _destination.size() - _length));
+            }
+            _length += count;
+        }
+
+        // Repeats bytes already written, the source may overlap the bytes being written.
+        void copyFromBack(size_t distance, size_t count)
+        {
+            if (distance == 0 || distance > _length)
+            {
+                throw Exception::RuntimeError(exceptionInvalidRLE);
+            }
+            for (size_t i = 0; i < count; i++, _length++)
+            {
+                if (_length < _destination.size())
+                {
+                    _destination[_length] = _destination[_length - distance];
+                }
+            }
+        }
+    };
+}
+
+static size_t getRunLengthSingleDecodedLength(std::span<const std::byte> data)
+{
+    size_t length = 0;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        uint8_t rleCodeByte = static_cast<uint8_t>(data[i]);
+        if (rleCodeByte & 128)
+        {
+            i++;
+            length += 257 - rleCodeByte;
+        }
+        else
+        {
+            i += rleCodeByte + 1;
+            length += rleCodeByte + 1;
+        }
+    }
+    return length;
+}
+
+static size_t getRunLengthMultiDecodedLength(std::span<const std::byte> data)
+{
+    size_t length = 0;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        if (data[i] == std::byte{ 0xFF })
+        {
+            i++;
+            length++;
+        }
+        else
+        {
+            length += (static_cast<size_t>(data[i]) & 7) + 1;
+        }
+    }
+    return length;
+}
+
+// Reads the next chunk, for runLengthMulti the first pass is done here as well. Returns the length of the decoded data.
+size_t SawyerStreamReader::readChunkData()
+{
+    read(&_chunkEncoding, sizeof(_chunkEncoding));
+
+    uint32_t length;
+    read(&length, sizeof(length));
+
+    // Streams that hold the file in memory can be decoded from directly
+    _chunkData = readView(length);
+    if (_chunkData.size() != length)
+    {
+        _decodeBuffer.resize(length);
+        read(_decodeBuffer.data(), length);
+        _chunkData = _decodeBuffer.getSpan();
+    }
+
+    switch (_chunkEncoding)
     {
         case SawyerEncoding::uncompressed:
-            return data;
+        case SawyerEncoding::rotate:
+            return _chunkData.size();
         case SawyerEncoding::runLengthSingle:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRunLengthSingle(_decodeBuffer2, data);
-            return _decodeBuffer2.getSpan();
+            return getRunLengthSingleDecodedLength(_chunkData);
         case SawyerEncoding::runLengthMulti:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRunLengthSingle(_decodeBuffer2, data);
-
-            _decodeBuffer.clear();
-            _decodeBuffer.reserve(_decodeBuffer2.getLength());
-            decodeRunLengthMulti(_decodeBuffer, _decodeBuffer2.getSpan());
-            return _decodeBuffer.getSpan();
-        case SawyerEncoding::rotate:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRotate(_decodeBuffer2, data);
-            return _decodeBuffer2.getSpan();
+            _decodeBuffer2.resize(getRunLengthSingleDecodedLength(_chunkData));
+            decodeRunLengthSingle(_decodeBuffer2.getSpan(), _chunkData);
+            _chunkData = _decodeBuffer2.getSpan();
+            return getRunLengthMultiDecodedLength(_chunkData);
         default:
             throw Exception::RuntimeError(exceptionUnknownEncoding);
     }
 }
 
-static void fillStream(MemoryStream& buffer, std::byte value, size_t count)
+// Decodes the chunk read by readChunkData, data that does not fit the destination is dropped.
+void SawyerStreamReader::decodeChunkData(std::span<std::byte> destination)
 {
-    for (size_t i = 0; i < count; i++)
+    switch (_chunkEncoding)
     {
-        buffer.writeValue(value);
+        case SawyerEncoding::uncompressed:
+            std::memcpy(destination.data(), _chunkData.data(), std::min(destination.size(), _chunkData.size()));
+            break;
+        case SawyerEncoding::runLengthSingle:
+            decodeRunLengthSingle(destination, _chunkData);
+            break;
+        case SawyerEncoding::runLengthMulti:
+            decodeRunLengthMulti(destination, _chunkData);
+            break;
+        case SawyerEncoding::rotate:
+            decodeRotate(destination, _chunkData);
+            break;
+        default:
+            throw Exception::RuntimeError(exceptionUnknownEncoding);
     }
 }
 
-void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<const std::byte> data)
+void SawyerStreamReader::decodeRunLengthSingle(std::span<std::byte> destination, std::span<const std::byte> data)
 {
+    DecodeOutput output(destination);
     for (size_t i = 0; i < data.size(); i++)
     {
         uint8_t rleCodeByte = static_cast<uint8_t>(data[i]);
@@ -140,7 +420,7 @@ void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<c
 
             auto copyLen = static_cast<size_t>(257 - rleCodeByte);
             auto copyByte = data[i];
-            fillStream(buffer, copyByte, copyLen);
+            output.fill(copyByte, copyLen);
         }
         else
         {
@@ -150,14 +430,15 @@ void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<c
             }
 
             auto copyLen = static_cast<size_t>(rleCodeByte + 1);
-            buffer.write(&data[i + 1], copyLen);
+            output.write(&data[i + 1], copyLen);
             i += rleCodeByte + 1;
         }
     }
 }
 
-void SawyerStreamReader::decodeRunLengthMulti(MemoryStream& buffer, std::span<const std::byte> data)
+void SawyerStreamReader::decodeRunLengthMulti(std::span<std::byte> destination, std::span<const std::byte> data)
 {
+    DecodeOutput output(destination);
     for (size_t i = 0; i < data.size(); i++)
     {
         if (data[i] == std::byte{ 0xFF })
@@ -167,35 +448,25 @@ void SawyerStreamReader::decodeRunLengthMulti(MemoryStream& buffer, std::span<co
             {
                 throw Exception::RuntimeError(exceptionInvalidRLE);
             }
-            buffer.writeValue(data[i]);
+            output.writeValue(data[i]);
         }
         else
         {
             auto offset = static_cast<int32_t>(data[i] >> 3) - 32;
             assert(offset < 0);
-            if (static_cast<size_t>(-offset) > buffer.getLength())
-            {
-                throw Exception::RuntimeError(exceptionInvalidRLE);
-            }
-            auto copySrc = buffer.data() + buffer.getLength() + offset;
             auto copyLen = (static_cast<size_t>(data[i]) & 7) + 1;
-
-            // Copy it to temp buffer first as we can't copy buffer to itself due to potential
-            // realloc in between reserve and push
-            std::byte copyBuffer[32];
-            assert(copyLen <= sizeof(copyBuffer));
-            std::memcpy(copyBuffer, copySrc, copyLen);
-            buffer.write(copyBuffer, copyLen);
+            output.copyFromBack(static_cast<size_t>(-offset), copyLen);
         }
     }
 }
 
-void SawyerStreamReader::decodeRotate(MemoryStream& buffer, std::span<const std::byte> data)
+void SawyerStreamReader::decodeRotate(std::span<std::byte> destination, std::span<const std::byte> data)
 {
+    DecodeOutput output(destination);
     uint8_t code = 1;
     for (size_t i = 0; i < data.size(); i++)
     {
-        buffer.writeValue(std::rotr(static_cast<uint8_t>(data[i]), code));
+        output.writeValue(static_cast<std::byte>(std::rotr(static_cast<uint8_t>(data[i]), code)));
         code = (code + 2) & 7;
     }
 }
@@ -216,11 +487,7 @@ void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data,
 void SawyerStreamWriter::write(const void* data, size_t dataLen)
 {
     writeStream(data, dataLen);
-    auto data8 = reinterpret_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < dataLen; i++)
-    {
-        _checksum += data8[i];
-    }
+    _checksum += SawyerScan::sumBytes(reinterpret_cast<const uint8_t*>(data), dataLen);
 }
 
 void SawyerStreamWriter::writeChecksum()
@@ -288,13 +555,7 @@ void SawyerStreamWriter::encodeRunLengthSingle(MemoryStream& buffer, std::span<c
         }
         if (src[0] == src[1])
         {
-            for (; count < 125 && src + count < srcEnd; count++)
-            {
-                if (src[0] != src[count])
-                {
-                    break;
-                }
-            }
+            count = static_cast<uint8_t>(SawyerScan::countRun(reinterpret_cast<const uint8_t*>(src), std::min<size_t>(125, srcEnd - src)));
             buffer.writeValue(static_cast<std::byte>(257 - count));
             buffer.writeValue(src[0]);
             src += count;
@@ -303,8 +564,11 @@ void SawyerStreamWriter::encodeRunLengthSingle(MemoryStream& buffer, std::span<c
         }
         else
         {
-            count++;
-            src++;
+            // Take all the bytes up to the next repeat at once, at most as many as fit into the literal run
+            const auto limit = std::min<size_t>(126 - count, srcEnd - 1 - src);
+            const auto numLiterals = SawyerScan::findRepeat(reinterpret_cast<const uint8_t*>(src), limit);
+            count += static_cast<uint8_t>(numLiterals);
+            src += numLiterals;
         }
     }
     if (src == srcEnd - 1)
@@ -337,10 +601,16 @@ void SawyerStreamWriter::encodeRunLengthMulti(MemoryStream& buffer, std::span<co
         size_t searchIndex = (i < 32) ? 0 : (i - 32);
         size_t searchEnd = i - 1;
 
+        // Only the positions starting with the same byte can repeat it, visited in the same order as before
+        uint32_t candidates = i >= 32
+            ? SawyerScan::findInWindow(reinterpret_cast<const uint8_t*>(src + searchIndex), static_cast<uint8_t>(src[i]))
+            : (1U << i) - 1;
+
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        for (; candidates != 0; candidates &= candidates - 1)
         {
+            const size_t repeatIndex = searchIndex + std::countr_zero(candidates);
             size_t repeatCount = 0;
             size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), srcLen - i - 1);
             // maxRepeatCount should not exceed srcLen
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <memory>
 #include <span>
+#include <vector>
 
 namespace OpenLoco
 {
@@ -23,17 +24,31 @@ namespace OpenLoco
         Stream& _stream;
         MemoryStream _decodeBuffer;
         MemoryStream _decodeBuffer2;
+        SawyerEncoding _chunkEncoding{};
+        std::span<const std::byte> _chunkData;
 
-        std::span<const std::byte> decode(SawyerEncoding encoding, std::span<const std::byte> data);
-        static void decodeRunLengthSingle(MemoryStream& buffer, std::span<const std::byte> data);
-        static void decodeRunLengthMulti(MemoryStream& buffer, std::span<const std::byte> data);
-        static void decodeRotate(MemoryStream& buffer, std::span<const std::byte> data);
+        size_t readChunkData();
+        std::span<const std::byte> readView(size_t dataLen);
+        void decodeChunkData(std::span<std::byte> destination);
+        static void decodeRunLengthSingle(std::span<std::byte> destination, std::span<const std::byte> data);
+        static void decodeRunLengthMulti(std::span<std::byte> destination, std::span<const std::byte> data);
+        static void decodeRotate(std::span<std::byte> destination, std::span<const std::byte> data);
 
     public:
         SawyerStreamReader(Stream& stream);
 
         std::span<const std::byte> readChunk();
+        // Decodes the chunk straight into data, returns the decoded length which may exceed maxDataLen.
         size_t readChunk(void* data, size_t maxDataLen);
+
+        // Decodes the chunk straight into the vector, which is sized to the number of whole elements it holds.
+        template<typename T>
+        void readChunk(std::vector<T>& data)
+        {
+            const auto length = readChunkData();
+            data.resize(length / sizeof(T));
+            decodeChunkData(std::as_writable_bytes(std::span(data)));
+        }
         void read(void* data, size_t dataLen);
         bool validateChecksum();
     };
@@ -20,7 +20,14 @@
 #include <OpenLoco/Core/Stream.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace OpenLoco::ScenarioManager
 {
@@ -287,22 +294,21 @@ namespace OpenLoco::ScenarioManager
         return std::nullopt;
     }
 
-    // 0x004447DF
-    static void createIndex(const ScenarioFolderState& currentState)
+    struct ScenarioFile
     {
-        Input::processMessagesMini();
-        Ui::ProgressBar::begin(StringIds::checkingScenarioFiles);
-
-        _scenarioHeader.state = currentState;
-        _scenarioHeader.state.numFiles = (currentState.numFiles & 0xFFFFFF) | (1 << 24);
-
-        for (auto& entry : _scenarioList)
-        {
-            entry.flags &= ~ScenarioIndexFlags::flag_0;
-        }
+        fs::path path;
+        std::string u8FileName;
+        uint32_t size;
+        int64_t time;
+        std::optional<uint32_t> entryId;
+        bool needsParse;
+        std::unique_ptr<Scenario::Options> options;
+    };
 
+    static std::vector<ScenarioFile> findScenarioFiles(bool reparseAll)
+    {
+        std::vector<ScenarioFile> files;
         const auto scenarioPath = Environment::getPathNoWarning(Environment::PathId::scenarios);
-        auto numScenariosDetected = 0;
         for (const auto& file : fs::directory_iterator(scenarioPath, fs::directory_options::skip_permission_denied))
         {
             if (!file.is_regular_file())
@@ -314,31 +320,98 @@ namespace OpenLoco::ScenarioManager
                 continue;
             }
 
-            numScenariosDetected++;
+            std::error_code ec;
+            const auto time = file.last_write_time(ec);
+
+            auto& scenarioFile = files.emplace_back();
+            scenarioFile.path = file.path();
+            scenarioFile.u8FileName = file.path().filename().u8string();
+            scenarioFile.size = static_cast<uint32_t>(file.file_size());
+            scenarioFile.time = ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+            scenarioFile.entryId = findScenario(scenarioFile.u8FileName);
+
+            // Entries from an index written by vanilla have no size or time so they are parsed once
+            scenarioFile.needsParse = true;
+            if (!reparseAll && scenarioFile.entryId.has_value() && scenarioFile.time != 0)
+            {
+                const auto& entry = _scenarioList[scenarioFile.entryId.value()];
+                scenarioFile.needsParse = entry.fileSize != scenarioFile.size || entry.fileTime != scenarioFile.time;
+            }
         }
+        return files;
+    }
 
-        auto currentScenarioOffset = 0;
-        for (const auto& file : fs::directory_iterator(scenarioPath, fs::directory_options::skip_permission_denied))
+    // Reading the options is only file access and decompression, so the files are read on a
+    // few threads while loading the objects they refer to is left to the main thread.
+    static void readScenarioOptions(std::vector<ScenarioFile>& files)
+    {
+        std::vector<ScenarioFile*> toRead;
+        for (auto& file : files)
         {
-            if (!file.is_regular_file())
+            if (file.needsParse)
             {
-                continue;
+                toRead.push_back(&file);
             }
-            if (!Utility::iequals(file.path().extension().u8string(), ".sc5"))
+        }
+
+        std::atomic<size_t> nextFile = 0;
+        auto readFiles = [&]() {
+            for (auto i = nextFile++; i < toRead.size(); i = nextFile++)
             {
-                continue;
+                toRead[i]->options = S5::readScenarioOptions(toRead[i]->path);
             }
+        };
 
+        const auto numThreads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(toRead.size(), 1));
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads - 1);
+        for (size_t i = 1; i < numThreads; i++)
+        {
+            workers.emplace_back(readFiles);
+        }
+        readFiles();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // 0x004447DF
+    static void createIndex(const ScenarioFolderState& currentState, bool reparseAll)
+    {
+        Input::processMessagesMini();
+        Ui::ProgressBar::begin(StringIds::checkingScenarioFiles);
+
+        _scenarioHeader.state = currentState;
+        _scenarioHeader.state.numFiles = (currentState.numFiles & 0xFFFFFF) | (1 << 24);
+
+        for (auto& entry : _scenarioList)
+        {
+            entry.flags &= ~ScenarioIndexFlags::flag_0;
+        }
+
+        auto files = findScenarioFiles(reparseAll);
+        readScenarioOptions(files);
+
+        auto currentScenarioOffset = 0;
+        for (auto& file : files)
+        {
             Input::processMessagesMini();
 
             currentScenarioOffset++;
-            auto currentScenarioProgress = currentScenarioOffset * 225 / numScenariosDetected;
+            auto currentScenarioProgress = currentScenarioOffset * 225 / static_cast<int32_t>(files.size());
             Ui::ProgressBar::setProgress(currentScenarioProgress);
 
-            const auto u8FileName = file.path().filename().u8string();
-            auto foundId = findScenario(u8FileName);
+            auto foundId = file.entryId;
+            if (!file.needsParse)
+            {
+                // Unchanged since the index was written
+                _scenarioList[foundId.value()].flags |= ScenarioIndexFlags::flag_0;
+                continue;
+            }
 
-            const auto options = S5::readScenarioOptions(file.path());
+            const auto& options = file.options;
             if (options == nullptr)
             {
                 continue;
@@ -351,7 +424,7 @@ namespace OpenLoco::ScenarioManager
             {
                 // This is a new entry so we will need to clear fields and add to the list
                 ScenarioIndexEntry entry{};
-                std::strcpy(entry.filename, u8FileName.c_str());
+                std::strcpy(entry.filename, file.u8FileName.c_str());
                 foundId = _scenarioList.size();
                 _scenarioList.push_back(entry);
                 _scenarioHeader.numScenarios++;
@@ -359,6 +432,8 @@ namespace OpenLoco::ScenarioManager
             ScenarioIndexEntry& entry = _scenarioList[foundId.value()];
 
             entry.flags |= ScenarioIndexFlags::flag_0;
+            entry.fileSize = file.size;
+            entry.fileTime = file.time;
             entry.category = options->difficulty;
             entry.flags &= ~ScenarioIndexFlags::hasPreviewImage;
             if ((options->scenarioFlags & Scenario::ScenarioFlags::landscapeGenerationDone) != Scenario::ScenarioFlags::none)
@@ -397,7 +472,8 @@ namespace OpenLoco::ScenarioManager
         // when adding/removing scenarios
         if (!tryLoadIndex(currentState) || forceReload)
         {
-            createIndex(currentState);
+            // Without a forced reload only the files that changed since the index was written are parsed
+            createIndex(currentState, forceReload);
         }
 
         setSceneFlags(oldFlags);
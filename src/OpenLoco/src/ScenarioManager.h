@@ -29,7 +29,10 @@ namespace OpenLoco::ScenarioManager
         uint8_t category;               // 0x100
         uint8_t numCompetingCompanies;  // 0x101
         uint8_t competingCompanyDelay;  // 0x102
-        uint8_t pad_103[0x120 - 0x103]; // 0x103
+        uint8_t pad_103;                // 0x103
+        uint32_t fileSize;              // 0x104 Not in original, zero in vanilla indexes
+        int64_t fileTime;               // 0x108 Not in original, zero in vanilla indexes
+        uint8_t pad_110[0x120 - 0x110]; // 0x110
         uint16_t startYear;             // 0x120
         uint16_t completedMonths;       // 0x122
         char scenarioName[0x40];        // 0x124
@@ -10,7 +10,8 @@ namespace OpenLoco
         Normal = 0,
         FastForward = 1,
         ExtraFastForward = 2,
-        MAX = ExtraFastForward,
+        Turbo = 3, // new in OpenLoco, runs as many ticks as fit in a frame
+        MAX = Turbo,
     };
 
     namespace SceneManager
@@ -0,0 +1,207 @@
+#include "StateHash.h"
+#include "GameState.h"
+#include "Map/TileManager.h"
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+namespace OpenLoco::StateHash
+{
+    static constexpr std::array<std::string_view, kSubsystemCount> kSubsystemNames = {
+        "PRNG",
+        "Entities",
+        "TileElements",
+        "Companies",
+        "Stations",
+    };
+
+    static uint32_t _interval = 0;
+    static std::array<Snapshot, kHistorySize> _history{};
+    static size_t _writeIndex = 0;
+    static size_t _numSnapshots = 0;
+
+    // 64-bit FNV-1a, consuming a word at a time rather than a byte at a time to keep the
+    // cost of hashing several megabytes of state low.
+    class Hasher
+    {
+        static constexpr uint64_t kOffsetBasis = 0xCBF29CE484222325ULL;
+        static constexpr uint64_t kPrime = 0x100000001B3ULL;
+
+        uint64_t _hash = kOffsetBasis;
+
+        void mix(uint64_t value)
+        {
+            _hash ^= value;
+            _hash *= kPrime;
+        }
+
+    public:
+        void append(std::span<const uint8_t> data)
+        {
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, data.data() + i, sizeof(word));
+                mix(word);
+            }
+            for (; i < data.size(); i++)
+            {
+                mix(data[i]);
+            }
+        }
+
+        template<typename T>
+        void append(const T& value)
+        {
+            append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(&value), sizeof(T)));
+        }
+
+        uint64_t get() const { return _hash; }
+    };
+
+    static uint64_t hashPrng(const GameState& gs)
+    {
+        Hasher hasher;
+        hasher.append(gs.rng.srand_0());
+        hasher.append(gs.rng.srand_1());
+        return hasher.get();
+    }
+
+    static uint64_t hashEntities(const GameState& gs)
+    {
+        Hasher hasher;
+        for (size_t i = 0; i < std::size(gs.entities); i++)
+        {
+            const auto& entity = gs.entities[i];
+            if (entity.baseType == EntityBaseType::null)
+            {
+                continue;
+            }
+            // Include the slot so that an entity allocated at a different index is also caught.
+            hasher.append(static_cast<uint32_t>(i));
+            hasher.append(entity);
+        }
+        return hasher.get();
+    }
+
+    static uint64_t hashTileElements()
+    {
+        const auto elements = World::TileManager::getElements();
+        Hasher hasher;
+        hasher.append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(elements.data()), elements.size_bytes()));
+        return hasher.get();
+    }
+
+    static uint64_t hashCompanies(const GameState& gs)
+    {
+        Hasher hasher;
+        for (const auto& company : gs.companies)
+        {
+            if (!company.empty())
+            {
+                hasher.append(company);
+            }
+        }
+        return hasher.get();
+    }
+
+    static uint64_t hashStations(const GameState& gs)
+    {
+        Hasher hasher;
+        for (const auto& station : gs.stations)
+        {
+            if (!station.empty())
+            {
+                hasher.append(station);
+            }
+        }
+        return hasher.get();
+    }
+
+    std::string_view getName(Subsystem subsystem)
+    {
+        return kSubsystemNames[static_cast<size_t>(subsystem)];
+    }
+
+    uint32_t getInterval()
+    {
+        return _interval;
+    }
+
+    void setInterval(uint32_t ticks)
+    {
+        if (ticks != _interval)
+        {
+            _interval = ticks;
+            reset();
+        }
+    }
+
+    bool isEnabled()
+    {
+        return _interval != 0;
+    }
+
+    void update(uint32_t tick)
+    {
+        if (!isEnabled() || (tick % _interval) != 0)
+        {
+            return;
+        }
+
+        const auto& gs = getGameState();
+
+        auto& snapshot = _history[_writeIndex];
+        snapshot.tick = tick;
+        snapshot.hashes[static_cast<size_t>(Subsystem::prng)] = hashPrng(gs);
+        snapshot.hashes[static_cast<size_t>(Subsystem::entities)] = hashEntities(gs);
+        snapshot.hashes[static_cast<size_t>(Subsystem::tileElements)] = hashTileElements();
+        snapshot.hashes[static_cast<size_t>(Subsystem::companies)] = hashCompanies(gs);
+        snapshot.hashes[static_cast<size_t>(Subsystem::stations)] = hashStations(gs);
+
+        _writeIndex = (_writeIndex + 1) % kHistorySize;
+        _numSnapshots = std::min(_numSnapshots + 1, kHistorySize);
+    }
+
+    std::optional<Snapshot> getLatest()
+    {
+        if (_numSnapshots == 0)
+        {
+            return std::nullopt;
+        }
+        return _history[(_writeIndex + kHistorySize - 1) % kHistorySize];
+    }
+
+    std::optional<Snapshot> getSnapshot(uint32_t tick)
+    {
+        for (size_t i = 0; i < _numSnapshots; i++)
+        {
+            const auto& snapshot = _history[(_writeIndex + kHistorySize - 1 - i) % kHistorySize];
+            if (snapshot.tick == tick)
+            {
+                return snapshot;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void reset()
+    {
+        _history.fill(Snapshot{});
+        _writeIndex = 0;
+        _numSnapshots = 0;
+    }
+
+    std::optional<Subsystem> findDivergence(const Snapshot& a, const Snapshot& b)
+    {
+        for (size_t i = 0; i < kSubsystemCount; i++)
+        {
+            if (a.hashes[i] != b.hashes[i])
+            {
+                return static_cast<Subsystem>(i);
+            }
+        }
+        return std::nullopt;
+    }
+}
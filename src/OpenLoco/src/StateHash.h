@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace OpenLoco::StateHash
+{
+    // Parts of the authoritative game state that are hashed separately so a desync can be attributed.
+    enum class Subsystem : uint8_t
+    {
+        prng,
+        entities,
+        tileElements,
+        companies,
+        stations,
+        count,
+    };
+
+    static constexpr auto kSubsystemCount = static_cast<size_t>(Subsystem::count);
+
+    // Amount of snapshots kept so hashes received for past ticks can still be compared.
+    static constexpr size_t kHistorySize = 32;
+
+    struct Snapshot
+    {
+        uint32_t tick{};
+        std::array<uint64_t, kSubsystemCount> hashes{};
+    };
+
+    std::string_view getName(Subsystem subsystem);
+
+    // An interval of 0 disables state hashing.
+    uint32_t getInterval();
+    void setInterval(uint32_t ticks);
+    bool isEnabled();
+
+    // Called at the end of each tick, computes a snapshot when the tick is a multiple of the interval.
+    void update(uint32_t tick);
+
+    std::optional<Snapshot> getLatest();
+    std::optional<Snapshot> getSnapshot(uint32_t tick);
+    void reset();
+
+    // Returns the first subsystem whose hash differs between the two snapshots.
+    std::optional<Subsystem> findDivergence(const Snapshot& a, const Snapshot& b);
+}
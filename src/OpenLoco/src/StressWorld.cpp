@@ -0,0 +1,306 @@
+#include "StressWorld.h"
+#include "GameCommands/CommandBatch.h"
+#include "GameCommands/GameCommands.h"
+#include "GameCommands/Track/CreateSignal.h"
+#include "GameCommands/Track/CreateTrack.h"
+#include "GameCommands/Track/CreateTrainStation.h"
+#include "GameCommands/Vehicles/CreateVehicle.h"
+#include "GameCommands/Vehicles/VehicleChangeRunningMode.h"
+#include "GameCommands/Vehicles/VehicleOrderInsert.h"
+#include "GameCommands/Vehicles/VehiclePlace.h"
+#include "GameCommands/Vehicles/VehicleSell.h"
+#include "GameState.h"
+#include "GameStateFlags.h"
+#include "Map/StationElement.h"
+#include "Map/TileManager.h"
+#include "Objects/ObjectManager.h"
+#include "Objects/ObjectUtils.h"
+#include "Objects/TrackObject.h"
+#include "Objects/VehicleObject.h"
+#include "ScenarioOptions.h"
+#include "Vehicles/Orders.h"
+#include "World/Company.h"
+#include "World/CompanyManager.h"
+#include <algorithm>
+#include <initializer_list>
+#include <optional>
+
+using namespace OpenLoco::World;
+
+namespace OpenLoco::StressWorld
+{
+    // Tiles of each platform, enough for a locomotive and a few cars.
+    static constexpr int32_t kPlatformLength = 4;
+    // Tiles between the signals of a section.
+    static constexpr int32_t kSignalSpacing = 4;
+    // Rows from one line to the next, the free row in between keeps the tracks from touching.
+    static constexpr int32_t kLineSpacing = 2;
+    // Tiles left free along the edges of the map.
+    static constexpr int32_t kMapMargin = 2;
+
+    static constexpr uint8_t kStraightTrackId = 0;
+    static constexpr uint8_t kRotation = 0;
+    static constexpr uint8_t kNoBridge = 0xFF;
+    static constexpr uint16_t kBothSignalSides = 0xC000;
+    static constexpr uint8_t kFlags = GameCommands::Flags::apply | GameCommands::Flags::noPayment;
+
+    struct NetworkObjects
+    {
+        uint8_t trackObjectId;
+        uint8_t signalType;
+        uint8_t stationType;
+        uint16_t vehicleType;
+    };
+
+    void prepareScenarioOptions()
+    {
+        auto& options = Scenario::getOptions();
+
+        // The simplex generator gives every tile the same height when there is no hill frequency
+        options.generator = Scenario::LandGeneratorType::Simplex;
+        options.topographyStyle = Scenario::TopographyStyle::flatLand;
+        options.hillDensity = 0;
+        options.scenarioFlags &= ~Scenario::ScenarioFlags::hillsEdgeOfMap;
+        options.numRiverbeds = 0;
+        options.numberOfForests = 0;
+        options.numberRandomTrees = 0;
+        options.numberOfTowns = 0;
+        options.maxCompetingCompanies = 0;
+        CompanyManager::setMaxCompetingCompanies(0);
+
+        getGameState().flags &= ~GameStateFlags::tileManagerLoaded;
+    }
+
+    // A powered rail vehicle the player can buy that needs no track mods.
+    static std::optional<uint16_t> findLocomotive(const Company& company, uint8_t trackObjectId)
+    {
+        for (uint16_t i = 0; i < ObjectManager::getMaxObjects(ObjectType::vehicle); i++)
+        {
+            const auto* vehicleObj = ObjectManager::get<VehicleObject>(i);
+            if (vehicleObj == nullptr || vehicleObj->mode != TransportMode::rail || vehicleObj->trackType != trackObjectId)
+            {
+                continue;
+            }
+            if (vehicleObj->power == 0 || vehicleObj->numTrackExtras != 0 || !company.isVehicleIndexUnlocked(static_cast<uint8_t>(i)))
+            {
+                continue;
+            }
+            return i;
+        }
+        return std::nullopt;
+    }
+
+    // The first track type with a signal, a station and a locomotive to go with it.
+    static std::optional<NetworkObjects> findNetworkObjects(const Company& company)
+    {
+        for (uint8_t trackObjectId = 0; trackObjectId < ObjectManager::getMaxObjects(ObjectType::track); trackObjectId++)
+        {
+            if (ObjectManager::get<TrackObject>(trackObjectId) == nullptr)
+            {
+                continue;
+            }
+
+            const auto signals = getAvailableCompatibleSignals(trackObjectId);
+            const auto stations = getAvailableCompatibleStations(trackObjectId, TransportMode::rail);
+            const auto vehicleType = findLocomotive(company, trackObjectId);
+            if (signals.empty() || stations.empty() || !vehicleType)
+            {
+                continue;
+            }
+            return NetworkObjects{ trackObjectId, signals[0], stations[0], *vehicleType };
+        }
+        return std::nullopt;
+    }
+
+    static StationId getStationId(const Pos3& pos)
+    {
+        for (const auto& el : TileManager::get(pos))
+        {
+            const auto* elStation = el.as<StationElement>();
+            if (elStation != nullptr && elStation->baseHeight() == pos.z)
+            {
+                return elStation->stationId();
+            }
+        }
+        return StationId::null;
+    }
+
+    static GameCommands::TrackPlacementArgs getTrackArgs(const Pos3& pos, const NetworkObjects& objects)
+    {
+        GameCommands::TrackPlacementArgs args;
+        args.pos = pos;
+        args.rotation = kRotation;
+        args.trackId = kStraightTrackId;
+        args.mods = 0;
+        args.unkFlags = 0;
+        args.bridge = kNoBridge;
+        args.trackObjectId = objects.trackObjectId;
+        args.unk = false;
+        return args;
+    }
+
+    // Buys a locomotive, puts it on the first platform and sends it back and forth between the
+    // stations. Returns false once no more vehicles can be bought.
+    static bool addTrain(const Pos3& pos, StationId stationA, StationId stationB, const NetworkObjects& objects, Result& result)
+    {
+        GameCommands::VehicleCreateArgs createArgs{};
+        createArgs.vehicleId = EntityId::null;
+        createArgs.vehicleType = objects.vehicleType;
+        if (GameCommands::doCommand(createArgs, kFlags) == GameCommands::FAILURE)
+        {
+            return false;
+        }
+        const auto head = GameCommands::getLastCreatedVehicleId();
+
+        GameCommands::VehiclePlacementArgs placeArgs{};
+        placeArgs.pos = pos;
+        placeArgs.trackAndDirection = (kStraightTrackId << 3) | kRotation;
+        placeArgs.trackProgress = 0;
+        placeArgs.head = head;
+        if (GameCommands::doCommand(placeArgs, GameCommands::Flags::apply) == GameCommands::FAILURE)
+        {
+            GameCommands::VehicleSellArgs sellArgs{};
+            sellArgs.car = head;
+            GameCommands::doCommand(sellArgs, GameCommands::Flags::apply);
+            return true;
+        }
+
+        uint32_t orderOffset = 0;
+        for (const auto station : { stationA, stationB })
+        {
+            GameCommands::VehicleOrderInsertArgs insertArgs{};
+            insertArgs.head = head;
+            insertArgs.orderOffset = orderOffset;
+            Vehicles::OrderStopAt stopAt{ station };
+            insertArgs.rawOrder = stopAt.getRaw();
+            if (GameCommands::doCommand(insertArgs, GameCommands::Flags::apply) != GameCommands::FAILURE)
+            {
+                orderOffset += sizeof(stopAt);
+            }
+        }
+
+        GameCommands::VehicleChangeRunningModeArgs startArgs{};
+        startArgs.head = head;
+        startArgs.mode = GameCommands::VehicleChangeRunningModeArgs::Mode::startVehicle;
+        GameCommands::doCommand(startArgs, GameCommands::Flags::apply);
+
+        result.numVehicles++;
+        return true;
+    }
+
+    // Returns whether the section was built, a section blocked by anything on the map is skipped
+    // before any of it is placed.
+    static bool buildSection(const TilePos2& start, int32_t length, const NetworkObjects& objects, bool& canAddTrains, Result& result)
+    {
+        const auto z = TileManager::getHeight(toWorldSpace(start)).landHeight;
+        GameCommands::CommandBatch track;
+        for (int32_t i = 0; i < length; i++)
+        {
+            const auto pos = Pos3(toWorldSpace(start + TilePos2(i, 0)), z);
+            if (TileManager::getHeight(pos).landHeight != z)
+            {
+                return false;
+            }
+            track.add(getTrackArgs(pos, objects));
+        }
+        if (track.execute(kFlags) == GameCommands::FAILURE)
+        {
+            return false;
+        }
+        result.numTrackPieces += static_cast<uint32_t>(track.size());
+
+        // Platforms at both ends
+        for (int32_t i = 0; i < length; i++)
+        {
+            if (i >= kPlatformLength && i < length - kPlatformLength)
+            {
+                continue;
+            }
+
+            GameCommands::TrainStationPlacementArgs stationArgs{};
+            stationArgs.pos = Pos3(toWorldSpace(start + TilePos2(i, 0)), z);
+            stationArgs.rotation = kRotation;
+            stationArgs.trackId = kStraightTrackId;
+            stationArgs.index = 0;
+            stationArgs.trackObjectId = objects.trackObjectId;
+            stationArgs.type = objects.stationType;
+            if (GameCommands::doCommand(stationArgs, kFlags) != GameCommands::FAILURE)
+            {
+                result.numStationPieces++;
+            }
+        }
+
+        // Two way signals along the track between the platforms
+        for (int32_t i = kPlatformLength; i < length - kPlatformLength; i += kSignalSpacing)
+        {
+            GameCommands::SignalPlacementArgs signalArgs{};
+            signalArgs.pos = Pos3(toWorldSpace(start + TilePos2(i, 0)), z);
+            signalArgs.rotation = kRotation;
+            signalArgs.trackId = kStraightTrackId;
+            signalArgs.index = 0;
+            signalArgs.type = objects.signalType;
+            signalArgs.trackObjType = objects.trackObjectId;
+            signalArgs.sides = kBothSignalSides;
+            if (GameCommands::doCommand(signalArgs, kFlags) != GameCommands::FAILURE)
+            {
+                result.numSignals++;
+            }
+        }
+
+        const auto firstPlatform = Pos3(toWorldSpace(start + TilePos2(1, 0)), z);
+        const auto stationA = getStationId(firstPlatform);
+        const auto stationB = getStationId(Pos3(toWorldSpace(start + TilePos2(length - 1, 0)), z));
+        if (canAddTrains && stationA != StationId::null && stationB != StationId::null)
+        {
+            canAddTrains = addTrain(firstPlatform, stationA, stationB, objects, result);
+        }
+        return true;
+    }
+
+    Result build(const Options& options)
+    {
+        Result result{};
+
+        const auto companyId = CompanyManager::getControllingId();
+        GameCommands::setUpdatingCompanyId(companyId);
+        const auto* company = CompanyManager::get(companyId);
+        if (company == nullptr)
+        {
+            return result;
+        }
+
+        const auto objects = findNetworkObjects(*company);
+        if (!objects)
+        {
+            return result;
+        }
+
+        // Sections need both platforms and at least one signal between them
+        const auto sectionLength = std::max(options.sectionLength, kPlatformLength * 2 + 1);
+        bool canAddTrains = true;
+        for (int32_t line = 0; line < options.numLines; line++)
+        {
+            const auto y = kMapMargin + line * kLineSpacing;
+            if (y >= kMapRows - kMapMargin)
+            {
+                break;
+            }
+
+            for (int32_t section = 0; section < options.sectionsPerLine; section++)
+            {
+                // One free tile between sections keeps them apart
+                const auto x = kMapMargin + section * (sectionLength + 1);
+                if (x + sectionLength > kMapColumns - kMapMargin)
+                {
+                    break;
+                }
+
+                if (buildSection(TilePos2(x, y), sectionLength, *objects, canAddTrains, result))
+                {
+                    result.numSections++;
+                }
+            }
+        }
+        return result;
+    }
+}
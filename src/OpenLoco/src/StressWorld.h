@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+// Builds a dense rail network through the game commands on a flat generated map, so that the
+// benchmarks can be run against a reproducible world at the limits of the game.
+namespace OpenLoco::StressWorld
+{
+    struct Options
+    {
+        int32_t numLines{};        // Parallel rows of track.
+        int32_t sectionsPerLine{}; // Separate stretches of track along each row.
+        int32_t sectionLength{};   // Tiles of each section, including the platforms at both ends.
+    };
+
+    struct Result
+    {
+        uint32_t numSections{};
+        uint32_t numTrackPieces{};
+        uint32_t numSignals{};
+        uint32_t numStationPieces{};
+        uint32_t numVehicles{};
+    };
+
+    // Changes the options of the loaded scenario so that starting it generates flat land without
+    // towns, forests, rivers or competitors, and drops any landscape the scenario came with.
+    void prepareScenarioOptions();
+
+    // Builds the network on the current map as the player company. Each section is a straight
+    // track with a station at both ends and two way signals in between, served by one train that
+    // shuttles between the stations. Sections that can't be built are left out, trains stop being
+    // added once the vehicle limit is reached.
+    Result build(const Options& options);
+}
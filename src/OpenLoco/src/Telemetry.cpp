@@ -0,0 +1,234 @@
+#include "Telemetry.h"
+#include "Date.h"
+#include "Entities/EntityManager.h"
+#include "Graphics/FPSCounter.h"
+#include "Map/TileManager.h"
+#include "MemoryAccounting.h"
+#include "Network/Network.h"
+#include "Network/NetworkStats.h"
+#include "ScenarioManager.h"
+#include "SceneManager.h"
+#include "TickProfiler.h"
+#include <OpenLoco/Core/Timer.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <fmt/os.h>
+#include <optional>
+#include <string>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Telemetry
+{
+    static std::optional<fmt::ostream> _file;
+    static int32_t _intervalDays = kDefaultIntervalDays;
+    static uint32_t _lastRecordDay = 0;
+    static uint32_t _lastRecordTick = 0;
+    static Core::Timer _sinceLastRecord;
+    // Subsystem totals at the last record, the records hold the average of the ticks in between.
+    static std::array<TickProfiler::Totals, TickProfiler::kSubsystemCount> _lastTotals{};
+
+    static void resetInterval()
+    {
+        _lastRecordDay = getCurrentDay();
+        _lastRecordTick = ScenarioManager::getScenarioTicks();
+        _sinceLastRecord.reset();
+        for (size_t i = 0; i < TickProfiler::kSubsystemCount; i++)
+        {
+            _lastTotals[i] = TickProfiler::getTotals(static_cast<TickProfiler::Subsystem>(i));
+        }
+    }
+
+    bool start(const fs::path& path, int32_t intervalDays)
+    {
+        stop();
+        try
+        {
+            if (path.has_parent_path())
+            {
+                fs::create_directories(path.parent_path());
+            }
+            _file.emplace(fmt::output_file(path.string(), fmt::file::WRONLY | fmt::file::CREATE | fmt::file::APPEND));
+        }
+        catch (const std::exception& e)
+        {
+            _file.reset();
+            Logging::error("Unable to open telemetry output '{}': {}", path.string(), e.what());
+            return false;
+        }
+
+        _intervalDays = std::max(intervalDays, 1);
+        resetInterval();
+        Logging::info("Writing telemetry to '{}' every {} days", path.string(), _intervalDays);
+        return true;
+    }
+
+    void stop()
+    {
+        _file.reset();
+    }
+
+    bool isEnabled()
+    {
+        return _file.has_value();
+    }
+
+    static std::string formatSubsystems()
+    {
+        std::string json = "{";
+        for (size_t i = 0; i < TickProfiler::kSubsystemCount; i++)
+        {
+            const auto subsystem = static_cast<TickProfiler::Subsystem>(i);
+            const auto totals = TickProfiler::getTotals(subsystem);
+
+            // The profiler can be reset in between, then all of its totals are new
+            const auto& last = totals.numTicks >= _lastTotals[i].numTicks ? _lastTotals[i] : TickProfiler::Totals{};
+            const auto numTicks = totals.numTicks - last.numTicks;
+            const auto avgMs = numTicks > 0 ? (totals.totalMs - last.totalMs) / numTicks : 0.0;
+
+            json += fmt::format("{}\"{}\":{:.4f}", i != 0 ? "," : "", TickProfiler::getName(subsystem), avgMs);
+        }
+        json += "}";
+        return json;
+    }
+
+    static std::string formatFrames()
+    {
+        const auto stats = Gfx::getFrameStats();
+        return fmt::format(
+            "{{\"p50Ms\":{:.2f},\"p95Ms\":{:.2f},\"p99Ms\":{:.2f},\"tickMs\":{:.2f},\"paintMs\":{:.2f},\"drawMs\":{:.2f},\"presentMs\":{:.2f}}}",
+            stats.p50,
+            stats.p95,
+            stats.p99,
+            stats.phaseAvg[static_cast<size_t>(Gfx::FramePhase::tick)],
+            stats.phaseAvg[static_cast<size_t>(Gfx::FramePhase::paint)],
+            stats.phaseAvg[static_cast<size_t>(Gfx::FramePhase::draw)],
+            stats.phaseAvg[static_cast<size_t>(Gfx::FramePhase::present)]);
+    }
+
+    static std::string formatEntities()
+    {
+        using EntityManager::EntityListType;
+        return fmt::format(
+            "{{\"vehicleHeads\":{},\"vehicleComponents\":{},\"misc\":{},\"free\":{}}}",
+            EntityManager::getListCount(EntityListType::vehicleHead),
+            EntityManager::getListCount(EntityListType::vehicle),
+            EntityManager::getListCount(EntityListType::misc),
+            EntityManager::getListCount(EntityListType::null) + EntityManager::getListCount(EntityListType::nullMoney));
+    }
+
+    static std::string formatMemory()
+    {
+        std::string json = "{";
+        for (size_t i = 0; i < MemoryAccounting::kCategoryCount; i++)
+        {
+            const auto category = static_cast<MemoryAccounting::Category>(i);
+            json += fmt::format("\"{}\":{},", MemoryAccounting::getName(category), MemoryAccounting::getUsage(category).current);
+        }
+        json += fmt::format("\"Total\":{},\"PeakProcess\":{}}}", MemoryAccounting::getTotalUsage().current, Platform::getPeakMemoryUsage());
+        return json;
+    }
+
+    static std::string formatNetwork()
+    {
+        if (!SceneManager::isNetworked())
+        {
+            return "null";
+        }
+
+        const auto stats = Network::getStats();
+        Network::PacketCounters sent{};
+        Network::PacketCounters received{};
+        for (size_t i = 0; i < stats.sent.size(); i++)
+        {
+            sent.numPackets += stats.sent[i].numPackets;
+            sent.numBytes += stats.sent[i].numBytes;
+            received.numPackets += stats.received[i].numPackets;
+            received.numBytes += stats.received[i].numBytes;
+        }
+
+        uint32_t maxRoundTripTime = 0;
+        for (const auto& peer : stats.peers)
+        {
+            maxRoundTripTime = std::max(maxRoundTripTime, peer.connection.roundTripTime);
+        }
+
+        return fmt::format(
+            "{{\"peers\":{},\"packetsSent\":{},\"bytesSent\":{},\"packetsReceived\":{},\"bytesReceived\":{},\"resends\":{},\"maxRoundTripMs\":{},\"ticksBehindServer\":{},\"commandQueueDepth\":{}}}",
+            stats.peers.size(),
+            sent.numPackets,
+            sent.numBytes,
+            received.numPackets,
+            received.numBytes,
+            stats.numResends,
+            maxRoundTripTime,
+            stats.ticksBehindServer,
+            stats.commandQueueDepth);
+    }
+
+    static void writeRecord()
+    {
+        const auto ticks = ScenarioManager::getScenarioTicks();
+        const auto elapsedMs = _sinceLastRecord.elapsed();
+        const auto ticksPerSecond = elapsedMs > 0.0f ? (ticks - _lastRecordTick) * 1000.0 / elapsedMs : 0.0;
+        const auto date = calcDate(getCurrentDay());
+
+        _file->print(
+            "{{\"day\":{},\"date\":\"{:04}-{:02}-{:02}\",\"scenarioTicks\":{},\"wallTimeMs\":{:.0f},\"ticksPerSecond\":{:.2f},"
+            "\"subsystemAvgMs\":{},\"frames\":{},\"entities\":{},"
+            "\"tileElements\":{{\"used\":{},\"free\":{},\"capacity\":{}}},\"memoryBytes\":{},\"network\":{}}}\n",
+            getCurrentDay(),
+            date.year,
+            enumValue(date.month) + 1,
+            date.day,
+            ticks,
+            elapsedMs,
+            ticksPerSecond,
+            formatSubsystems(),
+            formatFrames(),
+            formatEntities(),
+            World::TileManager::numUsedElements(),
+            World::TileManager::numFreeElements(),
+            World::TileManager::getElementsCapacity(),
+            formatMemory(),
+            formatNetwork());
+
+        // Readers of a long run see each record as soon as it is written
+        _file->flush();
+    }
+
+    void update()
+    {
+        if (!_file.has_value())
+        {
+            return;
+        }
+
+        const auto today = getCurrentDay();
+        if (today < _lastRecordDay)
+        {
+            // Another game was loaded
+            resetInterval();
+            return;
+        }
+        if (today - _lastRecordDay < static_cast<uint32_t>(_intervalDays))
+        {
+            return;
+        }
+
+        try
+        {
+            writeRecord();
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to write telemetry: {}", e.what());
+            stop();
+            return;
+        }
+        resetInterval();
+    }
+}
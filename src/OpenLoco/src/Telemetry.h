@@ -0,0 +1,21 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <cstdint>
+
+// Periodic machine readable records of the performance of long running sessions. Every interval
+// of game days one JSON object is appended to the output as a line of its own, with the tick rate,
+// the cost of each tick subsystem, the frame times, the entity and tile element counts, the memory
+// of each subsystem and the network counters.
+namespace OpenLoco::Telemetry
+{
+    static constexpr int32_t kDefaultIntervalDays = 30;
+
+    // Opens the output for appending, it can also be a named pipe another process reads from.
+    bool start(const fs::path& path, int32_t intervalDays);
+    void stop();
+    bool isEnabled();
+
+    // Called once per tick, only checks whether telemetry is enabled unless a record is due.
+    void update();
+}
@@ -0,0 +1,192 @@
+#include "TickProfiler.h"
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <fmt/os.h>
+#include <limits>
+#include <optional>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::TickProfiler
+{
+    static constexpr std::array<std::string_view, kSubsystemCount> kSubsystemNames = {
+        "Total",
+        "DefragmentTiles",
+        "DateTick",
+        "TileManager",
+        "WaveManager",
+        "TownManager",
+        "IndustryManager",
+        "VehicleManager",
+        "StationManager",
+        "EffectsManager",
+        "CompanyManager",
+        "AnimationManager",
+        "VehicleNoise",
+        "AmbientNoise",
+        "Title",
+        "StateHash",
+    };
+
+    static std::array<std::array<float, kSampleWindow>, kSubsystemCount> _samples{};
+    static std::array<float, kSubsystemCount> _currentTick{};
+    static std::array<Totals, kSubsystemCount> _totals{};
+    static size_t _writeIndex = 0;
+    static size_t _numSamples = 0;
+    static uint64_t _tickNumber = 0;
+
+    static std::optional<fmt::ostream> _csvFile;
+
+    ScopedTimer::ScopedTimer(Subsystem subsystem)
+        : _traceEvent{ subsystem == Subsystem::total ? "TickLogic" : getName(subsystem), "tick" }
+        , _subsystem{ subsystem }
+    {
+    }
+
+    ScopedTimer::~ScopedTimer()
+    {
+        record(_subsystem, _timer.elapsed());
+    }
+
+    std::string_view getName(Subsystem subsystem)
+    {
+        return kSubsystemNames[static_cast<size_t>(subsystem)];
+    }
+
+    void record(Subsystem subsystem, float elapsedMs)
+    {
+        // Subsystems may be entered more than once per tick, accumulate.
+        _currentTick[static_cast<size_t>(subsystem)] += elapsedMs;
+    }
+
+    static void writeCsvRow()
+    {
+        if (!_csvFile.has_value())
+        {
+            return;
+        }
+
+        _csvFile->print("{}", _tickNumber);
+        for (const auto value : _currentTick)
+        {
+            _csvFile->print(",{:.4f}", value);
+        }
+        _csvFile->print("\n");
+    }
+
+    void endTick()
+    {
+        for (size_t i = 0; i < kSubsystemCount; i++)
+        {
+            _samples[i][_writeIndex] = _currentTick[i];
+
+            auto& totals = _totals[i];
+            totals.totalMs += _currentTick[i];
+            totals.maxMs = std::max(totals.maxMs, _currentTick[i]);
+            totals.numTicks++;
+        }
+        _writeIndex = (_writeIndex + 1) % kSampleWindow;
+        _numSamples = std::min(_numSamples + 1, kSampleWindow);
+        _tickNumber++;
+
+        writeCsvRow();
+
+        _currentTick.fill(0.0f);
+    }
+
+    Stats getStats(Subsystem subsystem)
+    {
+        Stats stats{};
+        if (_numSamples == 0)
+        {
+            return stats;
+        }
+
+        const auto& samples = _samples[static_cast<size_t>(subsystem)];
+        std::array<float, kSampleWindow> sorted{};
+        std::copy_n(samples.begin(), _numSamples, sorted.begin());
+
+        stats.numSamples = static_cast<uint32_t>(_numSamples);
+        stats.last = samples[(_writeIndex + kSampleWindow - 1) % kSampleWindow];
+        stats.min = std::numeric_limits<float>::max();
+
+        float sum = 0.0f;
+        for (size_t i = 0; i < _numSamples; i++)
+        {
+            stats.min = std::min(stats.min, sorted[i]);
+            sum += sorted[i];
+        }
+        stats.avg = sum / _numSamples;
+
+        const auto p99Index = std::min(_numSamples - 1, (_numSamples * 99) / 100);
+        std::nth_element(sorted.begin(), sorted.begin() + p99Index, sorted.begin() + _numSamples);
+        stats.p99 = sorted[p99Index];
+
+        return stats;
+    }
+
+    Totals getTotals(Subsystem subsystem)
+    {
+        return _totals[static_cast<size_t>(subsystem)];
+    }
+
+    void reset()
+    {
+        for (auto& samples : _samples)
+        {
+            samples.fill(0.0f);
+        }
+        _currentTick.fill(0.0f);
+        _totals.fill(Totals{});
+        _writeIndex = 0;
+        _numSamples = 0;
+    }
+
+    bool isCsvLoggingEnabled()
+    {
+        return _csvFile.has_value();
+    }
+
+    fs::path getCsvLogPath()
+    {
+        return Platform::getUserDirectory() / "logs" / "tick_profile.csv";
+    }
+
+    void setCsvLoggingEnabled(bool enabled)
+    {
+        if (enabled == isCsvLoggingEnabled())
+        {
+            return;
+        }
+
+        if (!enabled)
+        {
+            _csvFile.reset();
+            return;
+        }
+
+        const auto path = getCsvLogPath();
+        try
+        {
+            fs::create_directories(path.parent_path());
+            _csvFile.emplace(fmt::output_file(path.string()));
+
+            _csvFile->print("tick");
+            for (const auto name : kSubsystemNames)
+            {
+                _csvFile->print(",{}", name);
+            }
+            _csvFile->print("\n");
+
+            Logging::info("Logging tick profile to '{}'", path.string());
+        }
+        catch (const std::exception& e)
+        {
+            _csvFile.reset();
+            Logging::error("Unable to open tick profile log '{}': {}", path.string(), e.what());
+        }
+    }
+}
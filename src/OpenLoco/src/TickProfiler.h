@@ -0,0 +1,87 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Core/Timer.hpp>
+#include <OpenLoco/Diagnostics/Tracing.h>
+#include <cstdint>
+#include <string_view>
+
+namespace OpenLoco::TickProfiler
+{
+    // Subsystems that are timed individually during tickLogic.
+    enum class Subsystem : uint8_t
+    {
+        total,
+        defragmentTiles,
+        dateTick,
+        tileManager,
+        waveManager,
+        townManager,
+        industryManager,
+        vehicleManager,
+        stationManager,
+        effectsManager,
+        companyManager,
+        animationManager,
+        vehicleNoise,
+        ambientNoise,
+        title,
+        stateHash,
+        count,
+    };
+
+    static constexpr auto kSubsystemCount = static_cast<size_t>(Subsystem::count);
+
+    // Amount of ticks the rolling statistics are computed over.
+    static constexpr size_t kSampleWindow = 256;
+
+    struct Stats
+    {
+        float last{};
+        float min{};
+        float avg{};
+        float p99{};
+        uint32_t numSamples{};
+    };
+
+    // Accumulated since the last reset, unlike Stats which only covers the rolling window.
+    struct Totals
+    {
+        double totalMs{};
+        float maxMs{};
+        uint64_t numTicks{};
+    };
+
+    // Measures the time between construction and destruction and records it against the subsystem,
+    // also adds it as an event to a trace being captured.
+    class ScopedTimer
+    {
+        Diagnostics::Tracing::ScopedEvent _traceEvent;
+        Core::Timer _timer;
+        Subsystem _subsystem;
+
+    public:
+        explicit ScopedTimer(Subsystem subsystem);
+
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+
+    std::string_view getName(Subsystem subsystem);
+
+    void record(Subsystem subsystem, float elapsedMs);
+
+    // Called once all subsystems of a tick have been recorded, advances the rolling window.
+    void endTick();
+
+    Stats getStats(Subsystem subsystem);
+    Totals getTotals(Subsystem subsystem);
+    void reset();
+
+    // When enabled every tick appends the recorded timings as a row to the CSV log.
+    bool isCsvLoggingEnabled();
+    void setCsvLoggingEnabled(bool enabled);
+    fs::path getCsvLogPath();
+}
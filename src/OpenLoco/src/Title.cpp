@@ -19,8 +19,11 @@
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include "World/CompanyManager.h"
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
+#include <memory>
 #include <variant>
 #include <vector>
 
@@ -91,15 +94,42 @@ namespace OpenLoco::Title
     }
 
     // 0x004442C4
+    // The title save is decoded once and kept, the sequence loads it again on every start and reload
+    static std::unique_ptr<S5::S5File> _titleFile;
+
+    static const S5::S5File* getTitleFile()
+    {
+        if (_titleFile == nullptr)
+        {
+            try
+            {
+                FileStream fs(Environment::getPath(Environment::PathId::title), StreamMode::readMapped);
+                _titleFile = S5::importSave(fs);
+            }
+            catch (const std::exception& e)
+            {
+                Diagnostics::Logging::error("Unable to decode the title sequence: {}", e.what());
+            }
+        }
+        return _titleFile.get();
+    }
+
     static void loadTitle()
     {
         Scenario::sub_46115C();
         if (Intro::state() == Intro::State::none)
         {
             uint16_t backupWord = getGameState().var_014A;
-            auto titlePath = Environment::getPath(Environment::PathId::title);
             SceneManager::removeSceneFlags(SceneManager::Flags::networked);
-            S5::importSaveToGameState(titlePath, S5::LoadFlags::titleSequence);
+            if (const auto* titleFile = getTitleFile())
+            {
+                S5::importSaveToGameState(*titleFile, S5::LoadFlags::titleSequence);
+            }
+            else
+            {
+                // Reports the error the same as any other load
+                S5::importSaveToGameState(Environment::getPath(Environment::PathId::title), S5::LoadFlags::titleSequence);
+            }
 
             CompanyManager::setControllingId(CompanyId(0));
             CompanyManager::setSecondaryPlayerId(CompanyId::null);
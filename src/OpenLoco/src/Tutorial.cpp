@@ -1,19 +1,28 @@
 #include "Tutorial.h"
+#include "CommandLine.h"
 #include "Config.h"
 #include "Environment.h"
 #include "GameState.h"
 #include "Gui.h"
 #include "Localisation/StringIds.h"
+#include "OpenLoco.h"
 #include "Scenario.h"
 #include "SceneManager.h"
 #include "Ui.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Utility/String.hpp>
 
+#include <algorithm>
+#include <fmt/os.h>
 #include <fstream>
 #include <iterator>
+#include <numeric>
 #include <vector>
 
 using namespace OpenLoco::Interop;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::Tutorial
 {
@@ -29,6 +38,12 @@ namespace OpenLoco::Tutorial
     static std::vector<uint16_t> _tutorialData;
     static std::vector<uint16_t>::const_iterator _tutorialIt;
 
+    // Set while recording or playing back a recording rather than a tutorial
+    static bool _hasExtendedInput = false;
+    static fs::path _recordingPath;
+    static std::vector<uint16_t> _recording;
+    static std::vector<double> _frameTimes;
+
     constexpr Config::Resolution tutorialResolution = { 1024, 768 };
 
     State state()
@@ -42,7 +57,7 @@ namespace OpenLoco::Tutorial
         file.unsetf(std::ios::skipws);
         if (!file)
         {
-            throw;
+            throw Exception::RuntimeError("Unable to open file");
         }
 
         std::vector<uint16_t> tutorial;
@@ -57,7 +72,7 @@ namespace OpenLoco::Tutorial
             // We expect an even number of bytes
             if (it == end)
             {
-                throw;
+                throw Exception::RuntimeError("Odd number of bytes");
             }
 
             auto const secondByte = *it;
@@ -139,10 +154,102 @@ namespace OpenLoco::Tutorial
         Scenario::start();
     }
 
+    static void writeRecording()
+    {
+        std::ofstream file(_recordingPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        for (auto value : _recording)
+        {
+            const char bytes[] = { static_cast<char>(value & 0xFF), static_cast<char>(value >> 8) };
+            file.write(bytes, sizeof(bytes));
+        }
+        if (!file)
+        {
+            Logging::error("Unable to write input recording to {}", _recordingPath.u8string());
+            return;
+        }
+        Logging::info("Recorded {} input words to {}", _recording.size(), _recordingPath.u8string());
+    }
+
+    static void writePlaybackResults()
+    {
+        if (_frameTimes.empty())
+        {
+            Logging::info("Input playback ended without drawing a frame");
+            return;
+        }
+
+        auto sorted = _frameTimes;
+        std::sort(sorted.begin(), sorted.end());
+        const auto totalMs = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+        const auto percentile = [&sorted](double fraction) {
+            return sorted[std::min(sorted.size() - 1, static_cast<size_t>(fraction * sorted.size()))];
+        };
+
+        Logging::info(
+            "Input playback: {} frames in {:.1f} ms, mean {:.3f} ms, median {:.3f} ms, 95th {:.3f} ms, 99th {:.3f} ms, max {:.3f} ms",
+            sorted.size(),
+            totalMs,
+            totalMs / sorted.size(),
+            percentile(0.5),
+            percentile(0.95),
+            percentile(0.99),
+            sorted.back());
+
+        const auto& benchmarkPath = getCommandLineOptions().benchmarkPath;
+        if (benchmarkPath.empty())
+        {
+            return;
+        }
+
+        std::string json = "{\n";
+        json += fmt::format("  \"version\": \"{}\",\n", getVersionInfo());
+        json += fmt::format("  \"path\": \"{}\",\n", Utility::escapeJson(_recordingPath.u8string()));
+        json += fmt::format("  \"frames\": {},\n", sorted.size());
+        json += fmt::format("  \"totalMs\": {:.3f},\n", totalMs);
+        json += fmt::format("  \"meanMs\": {:.4f},\n", totalMs / sorted.size());
+        json += fmt::format("  \"minMs\": {:.4f},\n", sorted.front());
+        json += fmt::format("  \"medianMs\": {:.4f},\n", percentile(0.5));
+        json += fmt::format("  \"p95Ms\": {:.4f},\n", percentile(0.95));
+        json += fmt::format("  \"p99Ms\": {:.4f},\n", percentile(0.99));
+        json += fmt::format("  \"maxMs\": {:.4f}\n", sorted.back());
+        json += "}\n";
+
+        if (benchmarkPath == "-")
+        {
+            fmt::print("{}", json);
+            return;
+        }
+        try
+        {
+            auto file = fmt::output_file(benchmarkPath);
+            file.print("{}", json);
+            Logging::info("Benchmark results written to {}", benchmarkPath);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to write benchmark results to {}: {}", benchmarkPath, e.what());
+        }
+    }
+
     // 0x0043C70E
     void stop()
     {
+        const auto previousState = _state;
+        const auto wasExtended = _hasExtendedInput;
         _state = State::none;
+        _hasExtendedInput = false;
+
+        if (wasExtended && previousState == State::recording)
+        {
+            writeRecording();
+            _recording.clear();
+        }
+        else if (wasExtended && previousState == State::playing)
+        {
+            writePlaybackResults();
+            exitCleanly();
+        }
+
         Gfx::invalidateScreen();
         Gui::resize();
     }
@@ -150,6 +257,12 @@ namespace OpenLoco::Tutorial
     // 0x0043C7A2
     uint16_t nextInput()
     {
+        // Reads in the frame the data ran out see the same as a released mouse
+        if (_tutorialIt == _tutorialData.end())
+        {
+            return 0;
+        }
+
         uint16_t next = *_tutorialIt;
         _tutorialIt++;
 
@@ -173,4 +286,67 @@ namespace OpenLoco::Tutorial
     {
         return _tutorialNumber;
     }
+
+    void startRecording(const fs::path& path)
+    {
+        if (_state != State::none)
+        {
+            return;
+        }
+
+        _recordingPath = path;
+        _recording.clear();
+        _hasExtendedInput = true;
+        _state = State::recording;
+        Logging::info("Recording input to {}", path.u8string());
+    }
+
+    void record(uint16_t value)
+    {
+        _recording.push_back(value);
+    }
+
+    void startPlayback(const fs::path& path)
+    {
+        if (_state != State::none)
+        {
+            return;
+        }
+
+        try
+        {
+            _tutorialData = readTutorialFile(path);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to read input recording {}: {}", path.u8string(), e.what());
+            return;
+        }
+        if (_tutorialData.empty())
+        {
+            return;
+        }
+
+        _tutorialIt = _tutorialData.cbegin();
+        _recordingPath = path;
+        _frameTimes.clear();
+        _hasExtendedInput = true;
+        _state = State::playing;
+        Logging::info("Playing back input from {}", path.u8string());
+    }
+
+    void addFrameTime(double ms)
+    {
+        _frameTimes.push_back(ms);
+    }
+
+    bool hasExtendedInput()
+    {
+        return _hasExtendedInput;
+    }
+
+    bool isPlayingRecording()
+    {
+        return _hasExtendedInput && _state == State::playing;
+    }
 }
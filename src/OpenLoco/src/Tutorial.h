@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Types.hpp"
+#include <OpenLoco/Core/FileSystem.hpp>
 
 namespace OpenLoco::Tutorial
 {
@@ -20,4 +21,18 @@ namespace OpenLoco::Tutorial
     StringId nextString();
 
     uint8_t getTutorialNumber();
+
+    // Records the input words that tutorials play back, from the current game, to the file.
+    // Recordings also hold the keys and the mouse wheel, which tutorial files do not.
+    void startRecording(const fs::path& path);
+    void record(uint16_t value);
+
+    // Plays a recording back one frame after another with no frame pacing, then reports the frame
+    // times and exits. Only reproduces the session when started from the same save.
+    void startPlayback(const fs::path& path);
+    void addFrameTime(double ms);
+
+    // Whether the keys and mouse wheel go through the recording as well.
+    bool hasExtendedInput();
+    bool isPlayingRecording();
 }
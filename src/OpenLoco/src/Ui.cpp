@@ -33,6 +33,7 @@
 #include "Game.h"
 #include "GameCommands/GameCommands.h"
 #include "GameCommands/General/LoadSaveQuit.h"
+#include "Graphics/FPSCounter.h"
 #include "Graphics/Gfx.h"
 #include "Gui.h"
 #include "Input.h"
@@ -398,12 +399,24 @@ namespace OpenLoco::Ui
             return;
         }
 
+        // Invalidated regions are kept until the window is restored
+        if (isMinimised())
+        {
+            return;
+        }
+
         if (!Intro::isActive())
         {
+            Gfx::FramePhaseTimer frameTimer(Gfx::FramePhase::draw);
             drawingEngine.render();
         }
 
-        drawingEngine.present();
+        {
+            Gfx::FramePhaseTimer frameTimer(Gfx::FramePhase::present);
+            drawingEngine.present();
+        }
+
+        Gfx::endFrame();
     }
 
     void showMessageBox(const std::string& title, const std::string& message)
@@ -749,6 +762,33 @@ namespace OpenLoco::Ui
         WindowManager::callEvent9OnAllWindows();
     }
 
+    // Runs on frames between game ticks so that the cursor, hover highlights and the ghost of the active
+    // tool follow the mouse at the display rate. Mouse buttons, keys and anything counted in ticks are
+    // still handled by handleInput from the tick, which is also where other game commands are issued.
+    void handleCursorInput()
+    {
+        if (!Ui::isInitialized() || Tutorial::state() != Tutorial::State::none || SceneManager::isNetworked())
+        {
+            return;
+        }
+
+        // Dragging a viewport is driven by the mouse events themselves.
+        if (Input::hasFlag(Input::Flags::rightMousePressed))
+        {
+            return;
+        }
+
+        Input::processMouseMovement();
+        Input::updateCursorPosition();
+
+        const auto cursor = Input::getMouseLocation2();
+        const auto x = std::clamp<int16_t>(cursor.x, 0, Ui::width() - 1);
+        const auto y = std::clamp<int16_t>(cursor.y, 0, Ui::height() - 1);
+
+        Input::processMouseOver(x, y);
+        processMouseTool(x, y);
+    }
+
     // 0x004C98CF
     void minimalHandleInput()
     {
@@ -816,4 +856,20 @@ namespace OpenLoco::Ui
         return (windowFlags & SDL_WINDOW_INPUT_FOCUS) != 0;
     }
 
+    bool isMinimised()
+    {
+        if (_window == nullptr)
+        {
+            return false;
+        }
+        const uint32_t windowFlags = SDL_GetWindowFlags(_window);
+        return (windowFlags & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN)) != 0;
+    }
+
+    void waitForEvents(uint32_t timeoutMs)
+    {
+        // Leaves the event in the queue for processMessages
+        SDL_WaitEventTimeout(nullptr, static_cast<int>(timeoutMs));
+    }
+
 }
@@ -121,9 +121,13 @@ namespace OpenLoco::Ui
     Resolution getClosestResolution(int32_t inWidth, int32_t inHeight);
     void handleInput();
     void minimalHandleInput();
+    void handleCursorInput();
     void setWindowScaling(float newScaleFactor);
     void adjustWindowScale(float adjust_by);
     bool hasInputFocus();
+    bool isMinimised();
+    // Blocks until there is an event to process or the timeout has passed.
+    void waitForEvents(uint32_t timeoutMs);
 
     void windowPositionChanged(int32_t x, int32_t y);
     void windowSizeChanged(int32_t width, int32_t height);
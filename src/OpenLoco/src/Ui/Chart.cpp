@@ -1,8 +1,11 @@
 #include "Chart.h"
 #include "Economy/Currency.h"
+#include "Graphics/Gfx.h"
+#include "Graphics/RenderTarget.h"
 #include "Graphics/SoftwareDrawingEngine.h"
 #include "Graphics/TextRenderer.h"
 #include "Ui/Window.h"
+#include <vector>
 
 namespace OpenLoco::Ui
 {
@@ -243,13 +246,8 @@ namespace OpenLoco::Ui
         }
     }
 
-    // 0x004CF824
-    void drawGraph(GraphSettings& gs, Window& self, Gfx::DrawingContext& drawingCtx)
+    static void drawGraphUncached(GraphSettings& gs, Window& self, Gfx::DrawingContext& drawingCtx)
     {
-        gs.canvasLeft = gs.xOffset + gs.left;
-        gs.canvasHeight = gs.height - gs.yOffset;
-        gs.canvasBottom = gs.top + gs.height - gs.yOffset;
-
         int64_t maxValue = graphGetMaxValue(gs);
 
         // 0x004CFA02
@@ -293,4 +291,127 @@ namespace OpenLoco::Ui
             }
         }
     }
+
+    // Labels may be drawn a little outside of the graph area
+    static constexpr int16_t kGraphImageMarginX = 64;
+    static constexpr int16_t kGraphImageMarginY = 16;
+
+    // The last graph drawn with its axes and labels, which the company list redraws on every
+    // invalidation even though the data only changes once a month. Kept relative to the graph
+    // so that moving the window does not redraw it.
+    struct GraphImage
+    {
+        std::vector<std::byte> key;
+        std::vector<PaletteIndex_t> pixels;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        uint8_t numValueShifts = 0;
+    };
+    static GraphImage _graphImage;
+    static std::vector<std::byte> _graphImageKey;
+
+    template<typename T>
+    static void appendKey(std::vector<std::byte>& key, const T& value)
+    {
+        const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+        key.insert(key.end(), bytes, bytes + sizeof(T));
+    }
+
+    // Everything but the position that the drawing depends on, including the data itself
+    static void buildGraphImageKey(std::vector<std::byte>& key, const GraphSettings& gs, const Window& self)
+    {
+        key.clear();
+        appendKey(key, self.getColour(WindowColour::secondary));
+        appendKey(key, gs.width);
+        appendKey(key, gs.height);
+        appendKey(key, gs.xOffset);
+        appendKey(key, gs.yOffset);
+        appendKey(key, gs.yAxisLabelIncrement);
+        appendKey(key, gs.lineCount);
+        appendKey(key, gs.dataTypeSize);
+        appendKey(key, gs.linesToExclude);
+        appendKey(key, gs.dataEnd);
+        appendKey(key, gs.xLabel);
+        appendKey(key, gs.xAxisRange);
+        appendKey(key, gs.xAxisStepSize);
+        appendKey(key, gs.xAxisTickIncrement);
+        appendKey(key, gs.xAxisLabelIncrement);
+        appendKey(key, gs.yLabel);
+        appendKey(key, gs.flags);
+        appendKey(key, gs.pointFlags);
+
+        const bool isFrontToBack = (gs.flags & GraphFlags::dataFrontToBack) != GraphFlags::none;
+        for (auto lineIndex = 0U; lineIndex < gs.lineCount; lineIndex++)
+        {
+            appendKey(key, gs.dataStart[lineIndex]);
+            appendKey(key, gs.lineColour[lineIndex]);
+
+            const auto numValues = isFrontToBack ? gs.dataEnd - gs.dataStart[lineIndex] : gs.dataEnd;
+            const auto* data = gs.yData[lineIndex];
+            key.insert(key.end(), data, data + numValues * gs.dataTypeSize);
+        }
+    }
+
+    void invalidateGraphImages()
+    {
+        _graphImage.key.clear();
+    }
+
+    // 0x004CF824
+    void drawGraph(GraphSettings& gs, Window& self, Gfx::DrawingContext& drawingCtx)
+    {
+        gs.canvasLeft = gs.xOffset + gs.left;
+        gs.canvasHeight = gs.height - gs.yOffset;
+        gs.canvasBottom = gs.top + gs.height - gs.yOffset;
+
+        // Highlighted lines are drawn on their own and blink, they are cheap to draw as they are
+        if ((gs.flags & GraphFlags::hideAxesAndLabels) != GraphFlags::none)
+        {
+            drawGraphUncached(gs, self, drawingCtx);
+            return;
+        }
+
+        const int16_t imageLeft = gs.left - kGraphImageMarginX;
+        const int16_t imageTop = gs.top - kGraphImageMarginY;
+
+        buildGraphImageKey(_graphImageKey, gs, self);
+        if (_graphImageKey != _graphImage.key)
+        {
+            _graphImage.width = gs.width + kGraphImageMarginX * 2;
+            _graphImage.height = gs.height + kGraphImageMarginY * 2;
+            _graphImage.pixels.assign(_graphImage.width * _graphImage.height, PaletteIndex::transparent);
+
+            Gfx::RenderTarget rt{};
+            rt.bits = reinterpret_cast<uint8_t*>(_graphImage.pixels.data());
+            rt.x = imageLeft;
+            rt.y = imageTop;
+            rt.width = _graphImage.width;
+            rt.height = _graphImage.height;
+            rt.pitch = 0;
+            rt.zoomLevel = 0;
+
+            drawingCtx.pushRenderTarget(rt);
+            drawGraphUncached(gs, self, drawingCtx);
+            drawingCtx.popRenderTarget();
+
+            _graphImage.numValueShifts = gs.numValueShifts;
+            _graphImage.key.swap(_graphImageKey);
+        }
+        gs.numValueShifts = _graphImage.numValueShifts;
+
+        // Drawn through the first image slot like the map window does with its map
+        auto* element = Gfx::getG1Element(0);
+        const auto backupElement = *element;
+
+        element->offset = reinterpret_cast<uint8_t*>(_graphImage.pixels.data());
+        element->width = _graphImage.width;
+        element->height = _graphImage.height;
+        element->xOffset = 0;
+        element->yOffset = 0;
+        element->flags = Gfx::G1ElementFlags::hasTransparency;
+
+        drawingCtx.drawImage(imageLeft, imageTop, 0);
+
+        *element = backupElement;
+    }
 }
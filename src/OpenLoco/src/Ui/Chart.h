@@ -67,4 +67,7 @@ namespace OpenLoco::Ui
     };
 
     void drawGraph(GraphSettings& gs, Window& self, Gfx::DrawingContext& drawingCtx);
+
+    // Drops the cached graph image, for when its labels would be formatted differently
+    void invalidateGraphImages();
 }
@@ -1,4 +1,5 @@
 #include "Screenshot.h"
+#include "Config.h"
 #include "Entities/EntityManager.h"
 #include "Environment.h"
 #include "Graphics/Gfx.h"
@@ -13,10 +14,16 @@
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <png.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
@@ -38,8 +45,52 @@ namespace OpenLoco::Ui
     static std::string saveScreenshot();
     static std::string saveGiantScreenshot();
 
+    // Screenshots still being encoded, each resolves to the file name or throws
+    static std::vector<std::future<std::string>> _pendingScreenshots;
+
+    static void reportScreenshot(std::future<std::string>& pending)
+    {
+        try
+        {
+            const auto fileName = pending.get();
+            FormatArguments::common(fileName.c_str());
+            Windows::Error::openQuiet(StringIds::screenshot_saved_as, StringIds::null);
+        }
+        catch (const std::exception&)
+        {
+            Windows::Error::open(StringIds::screenshot_failed);
+        }
+    }
+
+    static void updatePendingScreenshots()
+    {
+        using namespace std::chrono_literals;
+
+        for (auto it = _pendingScreenshots.begin(); it != _pendingScreenshots.end();)
+        {
+            if (it->wait_for(0s) != std::future_status::ready)
+            {
+                ++it;
+                continue;
+            }
+            reportScreenshot(*it);
+            it = _pendingScreenshots.erase(it);
+        }
+    }
+
+    void waitForPendingScreenshots()
+    {
+        for (auto& pending : _pendingScreenshots)
+        {
+            pending.wait();
+        }
+        updatePendingScreenshots();
+    }
+
     void handleScreenshotCountdown()
     {
+        updatePendingScreenshots();
+
         if (_screenshotCountdown != 0)
         {
             _screenshotCountdown--;
@@ -47,18 +98,17 @@ namespace OpenLoco::Ui
             {
                 try
                 {
-                    std::string fileName;
                     if (_screenshotType == ScreenshotType::giant)
                     {
-                        fileName = saveGiantScreenshot();
+                        const auto fileName = saveGiantScreenshot();
+                        FormatArguments::common(fileName.c_str());
+                        Windows::Error::openQuiet(StringIds::screenshot_saved_as, StringIds::null);
                     }
                     else
                     {
-                        fileName = saveScreenshot();
+                        // Reported once the encoding has finished
+                        saveScreenshot();
                     }
-
-                    FormatArguments::common(fileName.c_str());
-                    Windows::Error::openQuiet(StringIds::screenshot_saved_as, StringIds::null);
                 }
                 catch (const std::exception&)
                 {
@@ -80,75 +130,139 @@ namespace OpenLoco::Ui
         ostream->flush();
     }
 
-    static void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream)
+    // Only the first 246 palette entries are written, the rest are reserved for the system
+    static constexpr size_t kPngPaletteSize = 246;
+    using PngPalette = std::array<png_color, kPngPaletteSize>;
+
+    static PngPalette capturePalette()
     {
-        auto rgbaPalette = Gfx::getRgbaPalette();
+        const auto rgbaPalette = Gfx::getRgbaPalette();
+        PngPalette palette{};
+        for (size_t i = 0; i < palette.size(); i++)
+        {
+            palette[i].blue = rgbaPalette[i].b;
+            palette[i].green = rgbaPalette[i].g;
+            palette[i].red = rgbaPalette[i].r;
+        }
+        return palette;
+    }
 
-        png_structp pngPtr = nullptr;
-        png_colorp palette = nullptr;
-        try
+    // Writes a paletted PNG row by row so that an image can be produced in strips
+    // without ever holding the whole picture in memory. Only uses the palette it is
+    // given, so it may run on any thread.
+    class PngStreamWriter
+    {
+    private:
+        png_structp _pngPtr = nullptr;
+        png_infop _infoPtr = nullptr;
+        png_colorp _palette = nullptr;
+
+    public:
+        PngStreamWriter(std::ostream& outputStream, int32_t width, int32_t height, const PngPalette& palette)
         {
-            pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
-            if (pngPtr == nullptr)
+            _pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+            if (_pngPtr == nullptr)
             {
                 throw Exception::RuntimeError("png_create_write_struct failed.");
             }
 
-            png_set_write_fn(pngPtr, &outputStream, pngWriteData, pngFlush);
+            png_set_write_fn(_pngPtr, &outputStream, pngWriteData, pngFlush);
 
             // Set error handler
-            if (setjmp(png_jmpbuf(pngPtr)))
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
+                release();
                 throw Exception::RuntimeError("PNG ERROR");
             }
 
-            auto infoPtr = png_create_info_struct(pngPtr);
-            if (infoPtr == nullptr)
+            _infoPtr = png_create_info_struct(_pngPtr);
+            if (_infoPtr == nullptr)
             {
+                release();
                 throw Exception::RuntimeError("png_create_info_struct failed.");
             }
 
-            palette = (png_colorp)png_malloc(pngPtr, 246 * sizeof(png_color));
-            if (palette == nullptr)
+            _palette = (png_colorp)png_malloc(_pngPtr, kPngPaletteSize * sizeof(png_color));
+            if (_palette == nullptr)
             {
+                release();
                 throw Exception::RuntimeError("png_malloc failed.");
             }
 
-            for (size_t i = 0; i < 246; i++)
+            std::copy(palette.begin(), palette.end(), _palette);
+            png_set_PLTE(_pngPtr, _infoPtr, _palette, kPngPaletteSize);
+
+            // Paletted images compress best unfiltered, and the low levels are several times faster
+            // than the zlib default for little larger files.
+            png_set_filter(_pngPtr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE);
+            png_set_compression_level(_pngPtr, std::clamp(Config::get().screenshotCompressionLevel, 0, 9));
+
+            png_byte transparentIndex = 0;
+            png_set_tRNS(_pngPtr, _infoPtr, &transparentIndex, 1, nullptr);
+            png_set_IHDR(_pngPtr, _infoPtr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+            png_write_info(_pngPtr, _infoPtr);
+        }
+
+        PngStreamWriter(const PngStreamWriter&) = delete;
+        PngStreamWriter& operator=(const PngStreamWriter&) = delete;
+
+        ~PngStreamWriter()
+        {
+            release();
+        }
+
+        // Appends rows of width pixels, each stride bytes after the last, to the image.
+        void writeRows(const uint8_t* data, int32_t numRows, int32_t stride)
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
-                palette[i].blue = rgbaPalette[i].b;
-                palette[i].green = rgbaPalette[i].g;
-                palette[i].red = rgbaPalette[i].r;
+                throw Exception::RuntimeError("PNG ERROR");
             }
-            png_set_PLTE(pngPtr, infoPtr, palette, 246);
 
-            png_byte transparentIndex = 0;
-            png_set_tRNS(pngPtr, infoPtr, &transparentIndex, 1, nullptr);
-            png_set_IHDR(pngPtr, infoPtr, rt.width, rt.height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(pngPtr, infoPtr);
+            for (int32_t y = 0; y < numRows; y++)
+            {
+                png_write_row(_pngPtr, data);
+                data += stride;
+            }
+        }
 
-            uint8_t* data = rt.bits;
-            for (int y = 0; y < rt.height; y++)
+        // Appends all rows of the render target to the image.
+        void writeRows(const Gfx::RenderTarget& rt)
+        {
+            writeRows(rt.bits, rt.height, rt.pitch + rt.width);
+        }
+
+        void finish()
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
-                png_write_row(pngPtr, data);
-                data += rt.pitch + rt.width;
+                throw Exception::RuntimeError("PNG ERROR");
             }
 
-            png_write_end(pngPtr, nullptr);
-            png_destroy_info_struct(pngPtr, &infoPtr);
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
+            png_write_end(_pngPtr, nullptr);
         }
-        catch (const std::exception&)
+
+    private:
+        void release()
         {
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
-            throw;
+            if (_pngPtr == nullptr)
+            {
+                return;
+            }
+            if (_palette != nullptr)
+            {
+                png_free(_pngPtr, _palette);
+                _palette = nullptr;
+            }
+            if (_infoPtr != nullptr)
+            {
+                png_destroy_info_struct(_pngPtr, &_infoPtr);
+            }
+            png_destroy_write_struct(&_pngPtr, nullptr);
         }
-    }
+    };
 
-    // 0x00452667
-    static std::string prepareSaveScreenshot(const Gfx::RenderTarget& rt)
+    static std::pair<fs::path, std::string> getScreenshotPath()
     {
         auto screenshotsFolderPath = Environment::getPathNoWarning(Environment::PathId::screenshots);
         Environment::autoCreateDirectory(screenshotsFolderPath);
@@ -178,8 +292,34 @@ namespace OpenLoco::Ui
             throw Exception::RuntimeError("Failed finding filename");
         }
 
+        return { path, fileName };
+    }
+
+    // 0x00452667
+    static std::string prepareSaveScreenshot(const Gfx::RenderTarget& rt)
+    {
+        // The file is created straight away so the next screenshot picks another name
+        const auto [path, fileName] = getScreenshotPath();
         std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
-        saveRenderTargetToPng(rt, outputStream);
+
+        // Only the pixels and palette are copied on the game thread, the encoding happens in the background
+        const auto width = rt.width;
+        const auto height = rt.height;
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height);
+        for (int32_t y = 0; y < height; y++)
+        {
+            const auto* row = rt.bits + static_cast<size_t>(y) * (rt.pitch + rt.width);
+            std::copy_n(row, width, pixels.data() + static_cast<size_t>(y) * width);
+        }
+
+        _pendingScreenshots.push_back(std::async(
+            std::launch::async,
+            [outputStream = std::move(outputStream), pixels = std::move(pixels), palette = capturePalette(), width, height, fileName]() mutable {
+                PngStreamWriter writer(outputStream, width, height, palette);
+                writer.writeRows(pixels.data(), height, width);
+                writer.finish();
+                return fileName;
+            }));
 
         return fileName;
     }
@@ -215,6 +355,9 @@ namespace OpenLoco::Ui
         return viewport;
     }
 
+    // Number of rows painted per strip, this bounds the memory used regardless of the map size.
+    static constexpr int32_t kGiantScreenshotBandHeight = 256;
+
     static std::string saveGiantScreenshot()
     {
         const auto& main = WindowManager::getMainWindow();
@@ -228,31 +371,56 @@ namespace OpenLoco::Ui
         // Ensure sprites appear regardless of rotation
         EntityManager::resetSpatialIndex();
 
-        Gfx::RenderTarget rt{};
-        rt.bits = static_cast<uint8_t*>(malloc(resolutionWidth * resolutionHeight));
-        if (rt.bits == nullptr)
+        const auto [path, fileName] = getScreenshotPath();
+        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
+        PngStreamWriter writer(outputStream, resolutionWidth, resolutionHeight, capturePalette());
+
+        // Paint the map one horizontal strip at a time and stream each strip into the image, so
+        // only two strips are ever resident. Each strip is encoded in the background while the
+        // next one is painted.
+        std::array<std::vector<uint8_t>, 2> bands;
+        for (auto& band : bands)
         {
-            return {};
+            band.resize(static_cast<size_t>(resolutionWidth) * kGiantScreenshotBandHeight);
         }
-
-        rt.x = 0;
-        rt.y = 0;
-        rt.width = resolutionWidth;
-        rt.height = resolutionHeight;
-        rt.pitch = 0;
-        rt.zoomLevel = 0;
+        std::future<void> pendingBand;
 
         auto& drawingEngine = Gfx::getDrawingEngine();
         auto& drawingCtx = drawingEngine.getDrawingContext();
 
-        drawingCtx.pushRenderTarget(rt);
+        for (int32_t bandTop = 0, bandIndex = 0; bandTop < resolutionHeight; bandTop += kGiantScreenshotBandHeight, bandIndex ^= 1)
+        {
+            auto& band = bands[bandIndex];
+            std::fill(band.begin(), band.end(), PaletteIndex::transparent);
+
+            Gfx::RenderTarget rt{};
+            rt.bits = band.data();
+            rt.x = 0;
+            rt.y = bandTop;
+            rt.width = resolutionWidth;
+            rt.height = std::min<int32_t>(kGiantScreenshotBandHeight, resolutionHeight - bandTop);
+            rt.pitch = 0;
+            rt.zoomLevel = 0;
+
+            drawingCtx.pushRenderTarget(rt);
+
+            viewport.render(drawingCtx);
 
-        viewport.render(drawingCtx);
+            drawingCtx.popRenderTarget();
 
-        drawingCtx.popRenderTarget();
+            // Rethrows anything the last strip threw
+            if (pendingBand.valid())
+            {
+                pendingBand.get();
+            }
+            pendingBand = std::async(std::launch::async, [&writer, rt]() { writer.writeRows(rt); });
+        }
 
-        auto fileName = prepareSaveScreenshot(rt);
-        free(rt.bits);
+        if (pendingBand.valid())
+        {
+            pendingBand.get();
+        }
+        writer.finish();
 
         return fileName;
     }
@@ -12,4 +12,6 @@ namespace OpenLoco::Ui
 
     void triggerScreenshotCountdown(int8_t numTicks, ScreenshotType type);
     void handleScreenshotCountdown();
+    // Lets screenshots still being encoded finish writing before the game exits.
+    void waitForPendingScreenshots();
 }
@@ -13,6 +13,7 @@
 #include "GameCommands/Track/RemoveSignal.h"
 #include "GameCommands/Track/RemoveTrackMod.h"
 #include "GameCommands/Track/RemoveTrainStation.h"
+#include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
 #include "Input.h"
 #include "Localisation/FormatArguments.hpp"
@@ -41,6 +42,7 @@
 #include "Objects/WallObject.h"
 #include "Paint/Paint.h"
 #include "SceneManager.h"
+#include "ScenarioManager.h"
 #include "Ui.h"
 #include "Ui/ScrollView.h"
 #include "Ui/ToolManager.h"
@@ -54,6 +56,7 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <optional>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -359,14 +362,38 @@ namespace OpenLoco::Ui::ViewportInteraction
         }
     }
 
-    // 0x004CD658
-    InteractionArg getItemLeft(int16_t tempX, int16_t tempY)
+    // Sets the map tooltip for the item, returns false when the item has nothing to show.
+    // TODO: Rework so that getting the interaction arguments and getting the map tooltip format arguments are separated
+    static bool getItemLeftArguments(InteractionArg& interaction)
     {
-        if (SceneManager::isTitleMode())
+        switch (interaction.type)
         {
-            return InteractionArg{};
+            case InteractionItem::track:
+                return _track(interaction);
+            case InteractionItem::road:
+                return _road(interaction);
+            case InteractionItem::townLabel:
+                return getTownArguments(static_cast<TownId>(interaction.value));
+            case InteractionItem::stationLabel:
+                return getStationArguments(static_cast<StationId>(interaction.value));
+            case InteractionItem::trainStation:
+            case InteractionItem::roadStation:
+            case InteractionItem::airport:
+            case InteractionItem::dock:
+                return getStationArguments(interaction);
+            case InteractionItem::industry:
+                return getIndustryArguments(interaction);
+            case InteractionItem::headquarterBuilding:
+                return getHeadquarterArguments(interaction);
+            case InteractionItem::entity:
+                return getVehicleArguments(interaction);
+            default:
+                return false;
         }
+    }
 
+    static InteractionArg findItemLeft(int16_t tempX, int16_t tempY)
+    {
         auto interactionsToInclude = ~(InteractionItemFlags::entity | InteractionItemFlags::townLabel | InteractionItemFlags::stationLabel);
         auto res = getMapCoordinatesFromPos(tempX, tempY, interactionsToInclude);
 
@@ -382,42 +409,7 @@ namespace OpenLoco::Ui::ViewportInteraction
             interaction = res.first;
         }
 
-        // TODO: Rework so that getting the interaction arguments and getting the map tooltip format arguments are separated
-        bool success = false;
-        switch (interaction.type)
-        {
-            case InteractionItem::track:
-                success = _track(interaction);
-                break;
-
-            case InteractionItem::road:
-                success = _road(interaction);
-                break;
-            case InteractionItem::townLabel:
-                success = getTownArguments(static_cast<TownId>(interaction.value));
-                break;
-            case InteractionItem::stationLabel:
-                success = getStationArguments(static_cast<StationId>(interaction.value));
-                break;
-            case InteractionItem::trainStation:
-            case InteractionItem::roadStation:
-            case InteractionItem::airport:
-            case InteractionItem::dock:
-                success = getStationArguments(interaction);
-                break;
-            case InteractionItem::industry:
-                success = getIndustryArguments(interaction);
-                break;
-            case InteractionItem::headquarterBuilding:
-                success = getHeadquarterArguments(interaction);
-                break;
-            case InteractionItem::entity:
-                success = getVehicleArguments(interaction);
-                break;
-            default:
-                break;
-        }
-        if (success == true)
+        if (getItemLeftArguments(interaction))
         {
             return interaction;
         }
@@ -464,6 +456,94 @@ namespace OpenLoco::Ui::ViewportInteraction
         return InteractionArg{};
     }
 
+    // The item found by the last hover query. The cursor usually rests over the same item for many
+    // frames, so the two hit tests and the vehicle scan are only redone once the point under the
+    // cursor moves in the view or the world changes. The tooltip is still set from the item every
+    // time as its text depends on the hover timeout and on values outside of the key.
+    struct HoverCache
+    {
+        bool isValid = false;
+        Window* window = nullptr;
+        Viewport* viewport = nullptr;
+        viewport_pos viewPos{};
+        uint8_t zoom = 0;
+        uint8_t rotation = 0;
+        ViewportFlags viewFlags = ViewportFlags::none;
+        uint32_t invalidationGeneration = 0;
+        uint32_t scenarioTicks = 0;
+        uint32_t numCommandsIssued = 0;
+        InteractionArg interaction{};
+    };
+
+    static HoverCache _hoverCache;
+
+    static HoverCache getHoverKey(int16_t tempX, int16_t tempY)
+    {
+        HoverCache key{};
+        key.window = WindowManager::findAt(tempX, tempY);
+        if (key.window != nullptr)
+        {
+            for (auto* vp : key.window->viewports)
+            {
+                if (vp != nullptr && vp->containsUi({ tempX, tempY }))
+                {
+                    key.viewport = vp;
+                    key.viewPos = vp->screenToViewport({ tempX, tempY });
+                    key.zoom = vp->zoom;
+                    key.rotation = vp->getRotation();
+                    key.viewFlags = vp->flags;
+                    break;
+                }
+            }
+        }
+        key.invalidationGeneration = Gfx::getInvalidationGeneration();
+        key.scenarioTicks = ScenarioManager::getScenarioTicks();
+        key.numCommandsIssued = GameCommands::getNumCommandsIssued();
+        return key;
+    }
+
+    static bool hoverKeyMatches(const HoverCache& a, const HoverCache& b)
+    {
+        return a.window == b.window
+            && a.viewport == b.viewport
+            && a.viewPos.x == b.viewPos.x
+            && a.viewPos.y == b.viewPos.y
+            && a.zoom == b.zoom
+            && a.rotation == b.rotation
+            && a.viewFlags == b.viewFlags
+            && a.invalidationGeneration == b.invalidationGeneration
+            && a.scenarioTicks == b.scenarioTicks
+            && a.numCommandsIssued == b.numCommandsIssued;
+    }
+
+    // 0x004CD658
+    InteractionArg getItemLeft(int16_t tempX, int16_t tempY)
+    {
+        if (SceneManager::isTitleMode())
+        {
+            return InteractionArg{};
+        }
+
+        auto& cache = _hoverCache;
+        const auto key = getHoverKey(tempX, tempY);
+        if (cache.isValid && hoverKeyMatches(cache, key))
+        {
+            auto interaction = cache.interaction;
+            if (interaction.type == InteractionItem::noInteraction || getItemLeftArguments(interaction))
+            {
+                // Hovering a station invalidates it, which must not count as a change
+                cache.invalidationGeneration = Gfx::getInvalidationGeneration();
+                return interaction;
+            }
+        }
+
+        cache = key;
+        cache.interaction = findItemLeft(tempX, tempY);
+        cache.isValid = true;
+        cache.invalidationGeneration = Gfx::getInvalidationGeneration();
+        return cache.interaction;
+    }
+
     // 0x004CE1D4
     static bool rightOverTrack(InteractionArg& interaction)
     {
@@ -1470,6 +1550,76 @@ namespace OpenLoco::Ui::ViewportInteraction
         }
     }
 
+    // The arranged paint session of the last hit test. Tools query the same pixel several times per
+    // event with different filters, and every frame while the cursor rests, so the session is kept
+    // until the pixel, the viewport or anything visible changes. The filter is only applied when
+    // walking the paint structs so it is not part of the key.
+    struct HitTestCache
+    {
+        Viewport* viewport = nullptr;
+        int32_t x = 0;
+        int32_t y = 0;
+        uint8_t zoom = 0;
+        uint8_t rotation = 0;
+        ViewportFlags viewFlags = ViewportFlags::none;
+        uint32_t invalidationGeneration = 0;
+        uint32_t scenarioTicks = 0;
+        uint32_t numCommandsIssued = 0;
+        Gfx::RenderTarget rt{};
+        std::optional<Paint::PaintSession> session;
+
+        bool matches(const Viewport& vp, const Gfx::RenderTarget& otherRt) const
+        {
+            return session.has_value()
+                && viewport == &vp
+                && x == otherRt.x
+                && y == otherRt.y
+                && zoom == otherRt.zoomLevel
+                && rotation == vp.getRotation()
+                && viewFlags == vp.flags
+                && invalidationGeneration == Gfx::getInvalidationGeneration()
+                && scenarioTicks == ScenarioManager::getScenarioTicks()
+                && numCommandsIssued == GameCommands::getNumCommandsIssued();
+        }
+    };
+
+    static HitTestCache _hitTestCache;
+
+    static Paint::PaintSession& getHitTestSession(Viewport& vp, const Gfx::RenderTarget& rt)
+    {
+        auto& cache = _hitTestCache;
+        if (cache.matches(vp, rt))
+        {
+            return *cache.session;
+        }
+
+        // Release the previous session first so its paint entries can be reused.
+        cache.session.reset();
+
+        cache.viewport = &vp;
+        cache.x = rt.x;
+        cache.y = rt.y;
+        cache.zoom = rt.zoomLevel;
+        cache.rotation = vp.getRotation();
+        cache.viewFlags = vp.flags;
+        cache.rt = rt;
+
+        Paint::SessionOptions options{};
+        options.rotation = vp.getRotation();
+        options.viewFlags = vp.flags;
+        // Todo: should this pass the cullHeight...
+
+        auto& session = cache.session.emplace(cache.rt, options);
+        session.generate();
+        session.arrangeStructs();
+
+        // Painting may itself invalidate, so take the generation once the session is complete.
+        cache.invalidationGeneration = Gfx::getInvalidationGeneration();
+        cache.scenarioTicks = ScenarioManager::getScenarioTicks();
+        cache.numCommandsIssued = GameCommands::getNumCommandsIssued();
+        return session;
+    }
+
     // 0x00459E54
     std::pair<ViewportInteraction::InteractionArg, Viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, InteractionItemFlags flags)
     {
@@ -1511,14 +1661,7 @@ namespace OpenLoco::Ui::ViewportInteraction
             _rt2->height = 1;
             _rt2->zoomLevel = _rt1->zoomLevel;
 
-            Paint::SessionOptions options{};
-            options.rotation = vp->getRotation();
-            options.viewFlags = vp->flags;
-            // Todo: should this pass the cullHeight...
-
-            auto session = Paint::PaintSession(_rt2, options);
-            session.generate();
-            session.arrangeStructs();
+            auto& session = getHitTestSession(*vp, _rt2);
             interaction = session.getNormalInteractionInfo(flags);
             if (!vp->hasFlags(ViewportFlags::station_names_displayed))
             {
@@ -0,0 +1,12 @@
+#include "VirtualList.h"
+#include "Graphics/RenderTarget.h"
+
+namespace OpenLoco::Ui::Widgets::VirtualList
+{
+    RowRange getVisibleRows(const Gfx::RenderTarget& rt, int32_t rowHeight, int32_t numRows)
+    {
+        const auto first = std::clamp<int32_t>(rt.y / rowHeight, 0, numRows);
+        const auto last = std::clamp<int32_t>((rt.y + rt.height + rowHeight - 1) / rowHeight, first, numRows);
+        return { first, last };
+    }
+}
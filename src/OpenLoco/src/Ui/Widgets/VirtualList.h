@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Ui/Window.h"
+#include <OpenLoco/Core/EnumFlags.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace OpenLoco::Gfx
+{
+    struct RenderTarget;
+}
+
+// Helpers for the scroll view lists of windows that show one row per entity, using Window::rowInfo
+// for the entity ids in display order and Window::var_83C for the number of rows.
+namespace OpenLoco::Ui::Widgets::VirtualList
+{
+    // Number of ticks between the re-sorts done from a window update.
+    constexpr uint16_t kRefreshInterval = 8;
+
+    constexpr size_t kMaxRows = std::extent_v<decltype(Window::rowInfo)>;
+
+    // Rows [first, last) are the ones that intersect the render target.
+    struct RowRange
+    {
+        int32_t first;
+        int32_t last;
+    };
+
+    RowRange getVisibleRows(const Gfx::RenderTarget& rt, int32_t rowHeight, int32_t numRows);
+
+    // Whether the list is due its periodic re-sort.
+    constexpr bool shouldRefresh(const Window& self)
+    {
+        return self.frameNo % kRefreshInterval == 0;
+    }
+
+    // Updates the rows of the window to the given ids, ordered by isOrderedBefore. The previous order is
+    // the starting point so a list that barely changed since the last update is sorted in close to linear
+    // time, rather than picking out every row anew. Returns true if the rows changed.
+    template<typename TId, typename TIds, typename TCompare>
+    bool updateRows(Window& self, const TIds& ids, TCompare&& isOrderedBefore)
+    {
+        std::vector<int16_t> rows;
+        std::vector<uint8_t> isListed;
+        for (const auto id : ids)
+        {
+            const auto index = static_cast<size_t>(enumValue(id));
+            if (index >= isListed.size())
+            {
+                isListed.resize(index + 1);
+            }
+            isListed[index] = 1;
+        }
+
+        // Keep the rows that are still listed in their previous order, then add the new ones.
+        const auto previousCount = std::min<size_t>(self.var_83C, kMaxRows);
+        for (size_t i = 0; i < previousCount; i++)
+        {
+            const auto index = static_cast<size_t>(static_cast<uint16_t>(self.rowInfo[i]));
+            if (index < isListed.size() && isListed[index] == 1)
+            {
+                rows.push_back(self.rowInfo[i]);
+                isListed[index] = 2;
+            }
+        }
+        for (const auto id : ids)
+        {
+            const auto index = static_cast<size_t>(enumValue(id));
+            if (isListed[index] == 1)
+            {
+                rows.push_back(static_cast<int16_t>(enumValue(id)));
+                isListed[index] = 2;
+            }
+        }
+
+        const auto compare = [&isOrderedBefore](int16_t lhs, int16_t rhs) {
+            return isOrderedBefore(TId(static_cast<std::underlying_type_t<TId>>(lhs)), TId(static_cast<std::underlying_type_t<TId>>(rhs)));
+        };
+
+        // Insertion sort, rows that are already in place only cost a single comparison.
+        for (auto it = rows.begin(); it != rows.end(); ++it)
+        {
+            if (it == rows.begin() || !compare(*it, *(it - 1)))
+            {
+                continue;
+            }
+            auto position = std::upper_bound(rows.begin(), it, *it, compare);
+            std::rotate(position, it, it + 1);
+        }
+
+        if (rows.size() > kMaxRows)
+        {
+            rows.resize(kMaxRows);
+        }
+
+        const bool hasChanged = rows.size() != self.var_83C || !std::equal(rows.begin(), rows.end(), self.rowInfo);
+        if (hasChanged)
+        {
+            std::copy(rows.begin(), rows.end(), self.rowInfo);
+            self.var_83C = static_cast<uint16_t>(rows.size());
+            self.invalidate();
+        }
+        self.rowCount = static_cast<uint16_t>(rows.size());
+
+        return hasChanged;
+    }
+}
@@ -209,7 +209,9 @@ namespace OpenLoco::Ui
             return;
         }
 
-        if (vp->hasFlags(ViewportFlags::seeThroughTracks | ViewportFlags::seeThroughScenery | ViewportFlags::seeThroughRoads | ViewportFlags::seeThroughBuildings | ViewportFlags::seeThroughTrees | ViewportFlags::seeThroughBridges) || w->hasFlags(WindowFlags::flag_8))
+        // See-through rendering only changes which images are drawn translucent, which does not depend on where
+        // the viewport is, so those can shift the existing pixels and only paint the exposed strips as well.
+        if (w->hasFlags(WindowFlags::flag_8))
         {
             auto rect = Ui::Rect(vp->x, vp->y, vp->width, vp->height);
             Gfx::render(rect);
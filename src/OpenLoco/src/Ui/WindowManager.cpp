@@ -35,6 +35,7 @@
 #include <cinttypes>
 #include <memory>
 #include <sfl/static_vector.hpp>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -54,11 +55,37 @@ namespace OpenLoco::Ui::WindowManager
 
     static std::array<AdvancedColour, enumValue(WindowColour::count)> _windowColours;
 
+    enum class InvalidationKind : uint8_t
+    {
+        allOfType,
+        window,
+        widget,
+        vehicleRouteTab, // sub_4B93A5
+    };
+
+    struct PendingInvalidation
+    {
+        InvalidationKind kind;
+        WindowType type;
+        WindowNumber_t number;
+        WidgetIndex_t widgetIndex;
+
+        bool operator==(const PendingInvalidation&) const = default;
+    };
+
+    // Invalidations requested by window type are collected here and applied once before the frame is
+    // rendered, so that the many identical requests made during a tick only redraw the window once.
+    static std::vector<PendingInvalidation> _pendingInvalidations;
+    static std::array<uint32_t, 256> _invalidationRequestsByType;
+    static uint32_t _numInvalidationRequests = 0;
+    static InvalidationStats _lastInvalidationStats;
+
     static void viewportRedrawAfterShift(Window* window, Viewport* viewport, int16_t x, int16_t y);
 
     void init()
     {
         _windows.clear();
+        _pendingInvalidations.clear();
         _523508 = 0;
     }
 
@@ -293,67 +320,113 @@ namespace OpenLoco::Ui::WindowManager
         return nullptr;
     }
 
-    // 0x004CB966
-    void invalidate(WindowType type)
+    static void requestInvalidation(const PendingInvalidation& request)
     {
-        for (auto& w : _windows)
-        {
-            if (w.type != type)
-            {
-                continue;
-            }
+        _numInvalidationRequests++;
+        _invalidationRequestsByType[enumValue(request.type)]++;
 
-            w.invalidate();
+        if (std::ranges::find(_pendingInvalidations, request) == _pendingInvalidations.end())
+        {
+            _pendingInvalidations.push_back(request);
         }
     }
 
+    // 0x004CB966
+    void invalidate(WindowType type)
+    {
+        requestInvalidation({ InvalidationKind::allOfType, type, 0, 0 });
+    }
+
     // 0x004CB966
     void invalidate(WindowType type, WindowNumber_t number)
+    {
+        requestInvalidation({ InvalidationKind::window, type, number, 0 });
+    }
+
+    // 0x004CB966
+    void invalidateWidget(WindowType type, WindowNumber_t number, WidgetIndex_t widgetIndex)
+    {
+        requestInvalidation({ InvalidationKind::widget, type, number, widgetIndex });
+    }
+
+    static void applyInvalidation(const PendingInvalidation& request)
     {
         for (auto& w : _windows)
         {
-            if (w.type != type)
+            if (w.type != request.type)
             {
                 continue;
             }
 
-            if (w.number != number)
+            if (request.kind == InvalidationKind::allOfType)
             {
+                w.invalidate();
                 continue;
             }
 
-            w.invalidate();
-        }
-    }
-
-    // 0x004CB966
-    void invalidateWidget(WindowType type, WindowNumber_t number, WidgetIndex_t widgetIndex)
-    {
-        for (auto&& w : _windows)
-        {
-            if (w.type != type)
+            if (w.number != request.number)
             {
                 continue;
             }
 
-            if (w.number != number)
+            switch (request.kind)
             {
-                continue;
-            }
+                case InvalidationKind::window:
+                    w.invalidate();
+                    break;
 
-            auto widget = w.widgets[widgetIndex];
+                case InvalidationKind::widget:
+                {
+                    auto widget = w.widgets[request.widgetIndex];
 
-            if (widget.left != -2)
-            {
-                Gfx::invalidateRegion(
-                    w.x + widget.left,
-                    w.y + widget.top,
-                    w.x + widget.right + 1,
-                    w.y + widget.bottom + 1);
+                    if (widget.left != -2)
+                    {
+                        Gfx::invalidateRegion(
+                            w.x + widget.left,
+                            w.y + widget.top,
+                            w.x + widget.right + 1,
+                            w.y + widget.bottom + 1);
+                    }
+                    break;
+                }
+
+                case InvalidationKind::vehicleRouteTab:
+                    if (w.currentTab == 4)
+                    {
+                        w.invalidate();
+                    }
+                    break;
+
+                default:
+                    break;
             }
         }
     }
 
+    void flushInvalidations()
+    {
+        for (const auto& request : _pendingInvalidations)
+        {
+            applyInvalidation(request);
+        }
+
+        _lastInvalidationStats = InvalidationStats{};
+        _lastInvalidationStats.numRequested = _numInvalidationRequests;
+        _lastInvalidationStats.numApplied = static_cast<uint32_t>(_pendingInvalidations.size());
+        const auto busiest = std::ranges::max_element(_invalidationRequestsByType);
+        _lastInvalidationStats.busiestType = static_cast<WindowType>(std::distance(_invalidationRequestsByType.begin(), busiest));
+        _lastInvalidationStats.busiestTypeRequests = *busiest;
+
+        _pendingInvalidations.clear();
+        _invalidationRequestsByType = {};
+        _numInvalidationRequests = 0;
+    }
+
+    InvalidationStats getInvalidationStats()
+    {
+        return _lastInvalidationStats;
+    }
+
     // 0x004C9984
     void invalidateAllWindowsAfterInput()
     {
@@ -1092,25 +1165,7 @@ namespace OpenLoco::Ui::WindowManager
     // 0x004B93A5
     void sub_4B93A5(WindowNumber_t number)
     {
-        for (auto& w : _windows)
-        {
-            if (w.type != WindowType::vehicle)
-            {
-                continue;
-            }
-
-            if (w.number != number)
-            {
-                continue;
-            }
-
-            if (w.currentTab != 4)
-            {
-                continue;
-            }
-
-            w.invalidate();
-        }
+        requestInvalidation({ InvalidationKind::vehicleRouteTab, WindowType::vehicle, number, 0 });
     }
 
     // 0x004A0AB0
@@ -1959,6 +2014,25 @@ namespace OpenLoco::Ui::WindowManager
         return false;
     }
 
+    // True when a single opaque window above w covers the whole region. windowDrawSplit comes to
+    // the same conclusion, but only after splitting the region around every window above w.
+    static bool isCoveredByWindowAbove(const Window& w, int32_t left, int32_t top, int32_t right, int32_t bottom)
+    {
+        for (size_t index = indexOf(w) + 1; index < count(); index++)
+        {
+            const auto* above = get(index);
+            if (above->isTranslucent())
+            {
+                continue;
+            }
+            if (above->x <= left && above->y <= top && above->x + above->width >= right && above->y + above->height >= bottom)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void render(Gfx::DrawingContext& drawingCtx, const Rect& rect)
     {
         for (auto& w : _windows)
@@ -1978,6 +2052,17 @@ namespace OpenLoco::Ui::WindowManager
                 continue;
             }
 
+            // Windows hidden behind a dialog or a larger window, e.g. the main viewport behind
+            // a full screen window, are not drawn at all
+            const auto left = std::max<int32_t>(rect.left(), w.x);
+            const auto top = std::max<int32_t>(rect.top(), w.y);
+            const auto right = std::min<int32_t>(rect.right(), w.x + w.width);
+            const auto bottom = std::min<int32_t>(rect.bottom(), w.y + w.height);
+            if (isCoveredByWindowAbove(w, left, top, right, bottom))
+            {
+                continue;
+            }
+
             windowDraw(drawingCtx, &w, rect);
         }
     }
@@ -67,6 +67,19 @@ namespace OpenLoco::Ui::WindowManager
     void invalidate(WindowType type, WindowNumber_t number);
     void invalidateWidget(WindowType type, WindowNumber_t number, WidgetIndex_t widgetIndex);
     void invalidateAllWindowsAfterInput();
+
+    // Counts of the invalidation requests coalesced by the last flush.
+    struct InvalidationStats
+    {
+        uint32_t numRequested{};
+        uint32_t numApplied{};
+        WindowType busiestType{};
+        uint32_t busiestTypeRequests{};
+    };
+
+    // Applies the invalidations requested since the last call, done once per frame before rendering.
+    void flushInvalidations();
+    InvalidationStats getInvalidationStats();
     void close(WindowType type);
     void close(WindowType type, WindowNumber_t id);
     void close(Window* window);
@@ -24,6 +24,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/TableHeaderWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "World/Company.h"
 #include "World/CompanyManager.h"
@@ -240,61 +241,16 @@ namespace OpenLoco::Ui::Windows::CompanyList
         // 0x00437AE2
         static void updateCompanyList(Window& self)
         {
-            CompanyId chosenCompany = CompanyId::null;
-
+            std::vector<CompanyId> companyIds;
             for (auto& company : CompanyManager::companies())
             {
-                if ((company.challengeFlags & CompanyFlags::sorted) != CompanyFlags::none)
-                {
-                    continue;
-                }
-
-                if (chosenCompany == CompanyId::null)
-                {
-                    chosenCompany = company.id();
-                    continue;
-                }
-
-                if (getOrder(SortMode(self.sortMode), company, *CompanyManager::get(chosenCompany)))
-                {
-                    chosenCompany = company.id();
-                }
-            }
-
-            if (chosenCompany != CompanyId::null)
-            {
-                bool shouldInvalidate = false;
-
-                CompanyManager::get(chosenCompany)->challengeFlags |= CompanyFlags::sorted;
-
-                if (chosenCompany != CompanyId(self.rowInfo[self.rowCount]))
-                {
-                    self.rowInfo[self.rowCount] = enumValue(chosenCompany);
-                    shouldInvalidate = true;
-                }
-
-                self.rowCount++;
-                if (self.rowCount > self.var_83C)
-                {
-                    self.var_83C = self.rowCount;
-                    shouldInvalidate = true;
-                }
-
-                if (shouldInvalidate)
-                {
-                    self.invalidate();
-                }
+                companyIds.push_back(company.id());
             }
-            else
-            {
-                if (self.var_83C != self.rowCount)
-                {
-                    self.var_83C = self.rowCount;
-                    self.invalidate();
-                }
 
-                Common::refreshCompanyList(self);
-            }
+            const auto sortMode = SortMode(self.sortMode);
+            Widgets::VirtualList::updateRows<CompanyId>(self, companyIds, [sortMode](CompanyId lhs, CompanyId rhs) {
+                return getOrder(sortMode, *CompanyManager::get(lhs), *CompanyManager::get(rhs));
+            });
         }
 
         // 0x004362C0
@@ -307,10 +263,10 @@ namespace OpenLoco::Ui::Windows::CompanyList
 
             _hoverItemTicks++;
 
-            // Add three companies every tick.
-            updateCompanyList(self);
-            updateCompanyList(self);
-            updateCompanyList(self);
+            if (Widgets::VirtualList::shouldRefresh(self))
+            {
+                updateCompanyList(self);
+            }
         }
 
         // 0x004362F7
@@ -1727,12 +1683,7 @@ namespace OpenLoco::Ui::Windows::CompanyList
         // 0x00437AB6
         static void refreshCompanyList(Window& self)
         {
-            self.rowCount = 0;
-
-            for (auto& company : CompanyManager::companies())
-            {
-                company.challengeFlags &= ~CompanyFlags::sorted;
-            }
+            CompanyList::updateCompanyList(self);
         }
 
         // 0x00437810
@@ -12,6 +12,7 @@
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <optional>
 #include <sfl/static_vector.hpp>
 
 using namespace OpenLoco::Interop;
@@ -35,6 +36,32 @@ namespace OpenLoco::Ui::Windows::Construction
     static uint8_t _byte_522095 = 0; // Was loco_global at 0x00522095
     static GhostVisibilityFlags _ghostVisibilityFlags = 0; // Was loco_global at 0x00522096
 
+    // Remembers the last ghost placement that was refused, so that while the cursor stays where the piece
+    // can not be built the same query is not repeated until something on the map changes.
+    template<typename TKey>
+    class FailedGhostCache
+    {
+        std::optional<TKey> _key;
+        uint32_t _tileChangeCount = 0;
+
+    public:
+        bool contains(const TKey& key) const
+        {
+            return _key == key && _tileChangeCount == TileManager::getTileChangeCount();
+        }
+
+        void store(const TKey& key)
+        {
+            _key = key;
+            _tileChangeCount = TileManager::getTileChangeCount();
+        }
+
+        void clear()
+        {
+            _key.reset();
+        }
+    };
+
 #pragma pack(push, 1)
     struct ConstructionState
     {
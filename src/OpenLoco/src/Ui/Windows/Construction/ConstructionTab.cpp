@@ -2408,6 +2408,24 @@ namespace OpenLoco::Ui::Windows::Construction::Construction
         return args;
     }
 
+    // Everything the outcome of constructionGhostLoop depends on besides the map itself.
+    struct TrackGhostKey
+    {
+        Pos3 pos;
+        uint8_t trackType;
+        uint8_t trackPiece;
+        uint8_t gradient;
+        uint8_t rotation;
+        uint8_t bridge;
+        uint16_t mods;
+        uint8_t flags;
+        bool isShiftHeld;
+
+        bool operator==(const TrackGhostKey&) const = default;
+    };
+
+    static FailedGhostCache<TrackGhostKey> _failedTrackGhost;
+
     template<typename GetPlacementArgsFunc, typename PlaceGhostFunc>
     static void constructionGhostLoop(const Pos3& mapPos, uint32_t maxRetries, GetPlacementArgsFunc&& getPlacementArgs, PlaceGhostFunc&& placeGhost)
     {
@@ -2428,6 +2446,23 @@ namespace OpenLoco::Ui::Windows::Construction::Construction
         {
             return;
         }
+
+        const TrackGhostKey ghostKey = {
+            mapPos,
+            _cState->trackType,
+            _cState->lastSelectedTrackPiece,
+            _cState->lastSelectedTrackGradient,
+            _cState->constructionRotation,
+            _cState->lastSelectedBridge,
+            _cState->lastSelectedMods,
+            _cState->byte_113607E,
+            Input::hasKeyModifier(Input::KeyModifier::shift),
+        };
+        if ((_ghostVisibilityFlags & GhostVisibilityFlags::track) == GhostVisibilityFlags::none && _failedTrackGhost.contains(ghostKey))
+        {
+            return;
+        }
+
         while (true)
         {
 
@@ -2455,6 +2490,12 @@ namespace OpenLoco::Ui::Windows::Construction::Construction
                         }
                     }
                 }
+
+                _failedTrackGhost.store(ghostKey);
+            }
+            else
+            {
+                _failedTrackGhost.clear();
             }
             activateSelectedConstructionWidgets();
             return;
@@ -282,6 +282,34 @@ namespace OpenLoco::Ui::Windows::Construction::Station
         }
     }
 
+    struct StationGhostKey
+    {
+        World::Pos3 pos;
+        uint16_t ghostType;
+        uint8_t rotation;
+        uint8_t trackId;
+        uint8_t tileIndex;
+        uint8_t dockAirportType;
+        uint8_t stationObjectType;
+
+        bool operator==(const StationGhostKey&) const = default;
+    };
+
+    static FailedGhostCache<StationGhostKey> _failedStationGhost;
+
+    static StationGhostKey getStationGhostKey(uint8_t stationObjectType)
+    {
+        return StationGhostKey{
+            _cState->stationGhostPos,
+            _cState->stationGhostType,
+            _cState->stationGhostRotation,
+            _cState->stationGhostTrackId,
+            _cState->stationGhostTileIndex,
+            _cState->stationGhostTypeDockAirport,
+            stationObjectType,
+        };
+    }
+
     // 0x004A4F3B
     static void onToolUpdateAirport(const Ui::Point& mousePos)
     {
@@ -315,6 +343,12 @@ namespace OpenLoco::Ui::Windows::Construction::Station
         _cState->stationGhostTypeDockAirport = args->type;
         _cState->stationGhostType = (1U << 15);
 
+        const auto ghostKey = getStationGhostKey(args->type);
+        if (_failedStationGhost.contains(ghostKey))
+        {
+            return;
+        }
+
         const auto cost = GameCommands::doCommand(*args, GameCommands::Flags::apply | GameCommands::Flags::noErrorWindow | GameCommands::Flags::noPayment | GameCommands::Flags::ghost);
 
         _cState->stationCost = cost;
@@ -323,8 +357,10 @@ namespace OpenLoco::Ui::Windows::Construction::Station
 
         if (cost == GameCommands::FAILURE)
         {
+            _failedStationGhost.store(ghostKey);
             return;
         }
+        _failedStationGhost.clear();
 
         _ghostVisibilityFlags = _ghostVisibilityFlags | GhostVisibilityFlags::station;
         World::setMapSelectionFlags(World::MapSelectionFlags::catchmentArea);
@@ -378,6 +414,12 @@ namespace OpenLoco::Ui::Windows::Construction::Station
         _cState->stationGhostTypeDockAirport = args->type;
         _cState->stationGhostType = (1U << 14);
 
+        const auto ghostKey = getStationGhostKey(args->type);
+        if (_failedStationGhost.contains(ghostKey))
+        {
+            return;
+        }
+
         const auto cost = GameCommands::doCommand(*args, GameCommands::Flags::apply | GameCommands::Flags::noErrorWindow | GameCommands::Flags::noPayment | GameCommands::Flags::ghost);
 
         _cState->stationCost = cost;
@@ -386,8 +428,10 @@ namespace OpenLoco::Ui::Windows::Construction::Station
 
         if (cost == GameCommands::FAILURE)
         {
+            _failedStationGhost.store(ghostKey);
             return;
         }
+        _failedStationGhost.clear();
 
         _ghostVisibilityFlags = _ghostVisibilityFlags | GhostVisibilityFlags::station;
         World::setMapSelectionFlags(World::MapSelectionFlags::catchmentArea);
@@ -437,6 +481,12 @@ namespace OpenLoco::Ui::Windows::Construction::Station
         _cState->stationGhostTileIndex = args->index;
         _cState->stationGhostType = args->roadObjectId | (1 << 7);
 
+        const auto ghostKey = getStationGhostKey(args->type);
+        if (_failedStationGhost.contains(ghostKey))
+        {
+            return;
+        }
+
         const auto cost = GameCommands::doCommand(*args, GameCommands::Flags::apply | GameCommands::Flags::noErrorWindow | GameCommands::Flags::noPayment | GameCommands::Flags::ghost);
 
         _cState->stationCost = cost;
@@ -445,8 +495,10 @@ namespace OpenLoco::Ui::Windows::Construction::Station
 
         if (cost == GameCommands::FAILURE)
         {
+            _failedStationGhost.store(ghostKey);
             return;
         }
+        _failedStationGhost.clear();
 
         _ghostVisibilityFlags = _ghostVisibilityFlags | GhostVisibilityFlags::station;
         World::setMapSelectionFlags(World::MapSelectionFlags::catchmentArea);
@@ -509,6 +561,12 @@ namespace OpenLoco::Ui::Windows::Construction::Station
         _cState->stationGhostTileIndex = args->index;
         _cState->stationGhostType = args->trackObjectId;
 
+        const auto ghostKey = getStationGhostKey(args->type);
+        if (_failedStationGhost.contains(ghostKey))
+        {
+            return;
+        }
+
         const auto cost = GameCommands::doCommand(*args, GameCommands::Flags::apply | GameCommands::Flags::noErrorWindow | GameCommands::Flags::noPayment | GameCommands::Flags::ghost);
 
         _cState->stationCost = cost;
@@ -517,8 +575,10 @@ namespace OpenLoco::Ui::Windows::Construction::Station
 
         if (cost == GameCommands::FAILURE)
         {
+            _failedStationGhost.store(ghostKey);
             return;
         }
+        _failedStationGhost.clear();
 
         _ghostVisibilityFlags = _ghostVisibilityFlags | GhostVisibilityFlags::station;
         World::setMapSelectionFlags(World::MapSelectionFlags::catchmentArea);
@@ -2,10 +2,13 @@
 #include "Graphics/Gfx.h"
 #include "Graphics/ImageIds.h"
 #include "Graphics/SoftwareDrawingEngine.h"
+#include "Graphics/SpriteCache.h"
 #include "Graphics/TextRenderer.h"
 #include "Localisation/StringIds.h"
+#include "MemoryAccounting.h"
 #include "Objects/InterfaceSkinObject.h"
 #include "Objects/ObjectManager.h"
+#include "TickProfiler.h"
 #include "Ui/Widget.h"
 #include "Ui/Widgets/ButtonWidget.h"
 #include "Ui/Widgets/CaptionWidget.h"
@@ -16,11 +19,13 @@
 #include "Ui/Widgets/PanelWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/WindowManager.h"
+#include <array>
+#include <cstdio>
+#include <string>
 #include <vector>
 
 namespace OpenLoco::Ui::Windows::Debug
 {
-    static constexpr Ui::Size32 kWindowSize = { 400, 260 };
     static constexpr int32_t kMargin = 2;
 
     static constexpr int32_t kTitlebarHeight = 13;
@@ -31,6 +36,20 @@ namespace OpenLoco::Ui::Windows::Debug
     static constexpr int32_t kTabWidth = 31;
     static constexpr int32_t kTabHeight = 27;
 
+    // Tick profiler section, placed below the widget showcase.
+    static constexpr int32_t kProfilerTop = 280;
+    static constexpr int32_t kProfilerRowHeight = 10;
+    static constexpr int32_t kProfilerTableTop = kProfilerTop + ((kLabelHeight + kMargin) * 2);
+    // Memory usage table, placed below the sprite cache statistics.
+    static constexpr int32_t kMemoryTableTop = kProfilerTableTop + static_cast<int32_t>(TickProfiler::kSubsystemCount + 2) * kProfilerRowHeight;
+    // Header, one row per subsystem, the sprite cache statistics, then a header, one row per memory category and the total.
+    static constexpr int32_t kProfilerHeight = ((kLabelHeight + kMargin) * 2) + (kProfilerRowHeight * (TickProfiler::kSubsystemCount + MemoryAccounting::kCategoryCount + 4)) + kMargin;
+
+    static constexpr Ui::Size32 kWindowSize = { 400, kProfilerTop + kProfilerHeight };
+
+    // Refresh the profiler statistics every n window updates.
+    static constexpr uint16_t kProfilerRefreshRate = 8;
+
     namespace widx
     {
         constexpr auto frame = WidgetId("frame");
@@ -51,6 +70,10 @@ namespace OpenLoco::Ui::Windows::Debug
         constexpr auto checkbox_3 = WidgetId("checkbox_3");
         constexpr auto checkbox_4 = WidgetId("checkbox_4");
 
+        constexpr auto profiler_panel = WidgetId("profiler_panel");
+        constexpr auto profiler_csv = WidgetId("profiler_csv");
+        constexpr auto dirty_regions = WidgetId("dirty_regions");
+
         // constexpr auto tab_4 = WidgetId("tab_4");
     }
 
@@ -81,9 +104,25 @@ namespace OpenLoco::Ui::Windows::Debug
 
             Tab(widx::tab_1, { kMargin + ((kTabWidth + kMargin) * 0), kTitlebarHeight + kMargin + (9 * (kRowSize + kMargin)) }, { kTabWidth, kTabHeight }, WindowColour::secondary, ImageIds::tab, StringIds::tooltip_town),
             Tab(widx::tab_2, { kMargin + ((kTabWidth + kMargin) * 1), kTitlebarHeight + kMargin + (9 * (kRowSize + kMargin)) }, { kTabWidth, kTabHeight }, WindowColour::secondary, ImageIds::tab, StringIds::tooltip_population_graph),
-            Tab(widx::tab_3, { kMargin + ((kTabWidth + kMargin) * 2), kTitlebarHeight + kMargin + (9 * (kRowSize + kMargin)) }, { kTabWidth, kTabHeight }, WindowColour::secondary, ImageIds::tab, StringIds::tooltip_town_ratings_each_company)
+            Tab(widx::tab_3, { kMargin + ((kTabWidth + kMargin) * 2), kTitlebarHeight + kMargin + (9 * (kRowSize + kMargin)) }, { kTabWidth, kTabHeight }, WindowColour::secondary, ImageIds::tab, StringIds::tooltip_town_ratings_each_company),
+
+            Panel(widx::profiler_panel, { 0, kProfilerTop }, { kWindowSize.width, kProfilerHeight }, WindowColour::secondary),
+            Checkbox(widx::profiler_csv, { kMargin, kProfilerTop + kMargin }, { kWindowSize.width - (kMargin * 2), kLabelHeight }, WindowColour::secondary, StringIds::debug_tick_profiler_log_csv, StringIds::debug_tick_profiler_log_csv_tooltip),
+            Checkbox(widx::dirty_regions, { kMargin, kProfilerTop + kMargin + kLabelHeight + kMargin }, { kWindowSize.width - (kMargin * 2), kLabelHeight }, WindowColour::secondary, StringIds::debug_show_dirty_regions, StringIds::debug_show_dirty_regions_tooltip)
             //
         );
+
+        static Widget& getWidgetById(Window& window, const WidgetId id)
+        {
+            for (auto& widget : window.widgets)
+            {
+                if (widget.id == id)
+                {
+                    return widget;
+                }
+            }
+            throw std::runtime_error("Widget not found");
+        }
     }
 
     // 0x0043B26C
@@ -104,17 +143,6 @@ namespace OpenLoco::Ui::Windows::Debug
         // window->disabledWidgets = 1U << widx::tab_3;
         window->initScrollWidgets();
 
-        auto getWidgetById = [&](Window& window, const WidgetId id) -> Widget& {
-            for (auto& widget : window.widgets)
-            {
-                if (widget.id == id)
-                {
-                    return widget;
-                }
-            }
-            throw std::runtime_error("Widget not found");
-        };
-
         auto& chkbox2 = getWidgetById(*window, widx::checkbox_2);
         chkbox2.activated = true;
 
@@ -142,7 +170,137 @@ namespace OpenLoco::Ui::Windows::Debug
             case widx::close:
                 WindowManager::close(window.type);
                 break;
+
+            case widx::profiler_csv:
+                TickProfiler::setCsvLoggingEnabled(!TickProfiler::isCsvLoggingEnabled());
+                window.invalidate();
+                break;
+
+            case widx::dirty_regions:
+            {
+                auto& drawingEngine = Gfx::getDrawingEngine();
+                drawingEngine.setShowDirtyRegions(!drawingEngine.isShowingDirtyRegions());
+                break;
+            }
+        }
+    }
+
+    static void onUpdate(Ui::Window& window)
+    {
+        window.frameNo++;
+        if (window.frameNo % kProfilerRefreshRate == 0)
+        {
+            window.invalidate();
+        }
+    }
+
+    static void prepareDraw(Ui::Window& window)
+    {
+        getWidgetById(window, widx::profiler_csv).activated = TickProfiler::isCsvLoggingEnabled();
+        getWidgetById(window, widx::dirty_regions).activated = Gfx::getDrawingEngine().isShowingDirtyRegions();
+    }
+
+    static void drawTickProfiler(Ui::Window& window, Gfx::DrawingContext& drawingCtx)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+        tr.setCurrentFont(Gfx::Font::small);
+
+        static constexpr std::array<int32_t, 6> kColumnOffsets = { 0, 110, 166, 222, 278, 334 };
+
+        const auto drawRow = [&](int32_t y, const char* name, const std::array<char[16], 5>& values) {
+            tr.drawString(Ui::Point(window.x + kMargin + kColumnOffsets[0], window.y + y), Colour::black, name);
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                tr.drawString(Ui::Point(window.x + kMargin + kColumnOffsets[i + 1], window.y + y), Colour::black, values[i]);
+            }
+        };
+
+        std::array<char[16], 5> values{};
+        std::snprintf(values[0], std::size(values[0]), "last ms");
+        std::snprintf(values[1], std::size(values[1]), "min ms");
+        std::snprintf(values[2], std::size(values[2]), "avg ms");
+        std::snprintf(values[3], std::size(values[3]), "p99 ms");
+        std::snprintf(values[4], std::size(values[4]), "worst ms");
+        drawRow(kProfilerTableTop, "Subsystem", values);
+
+        for (size_t i = 0; i < TickProfiler::kSubsystemCount; i++)
+        {
+            const auto subsystem = static_cast<TickProfiler::Subsystem>(i);
+            const auto stats = TickProfiler::getStats(subsystem);
+            const auto totals = TickProfiler::getTotals(subsystem);
+
+            std::snprintf(values[0], std::size(values[0]), "%.3f", stats.last);
+            std::snprintf(values[1], std::size(values[1]), "%.3f", stats.min);
+            std::snprintf(values[2], std::size(values[2]), "%.3f", stats.avg);
+            std::snprintf(values[3], std::size(values[3]), "%.3f", stats.p99);
+            std::snprintf(values[4], std::size(values[4]), "%.3f", totals.maxMs);
+
+            const auto name = std::string(TickProfiler::getName(subsystem));
+            drawRow(kProfilerTableTop + static_cast<int32_t>(i + 1) * kProfilerRowHeight, name.c_str(), values);
+        }
+    }
+
+    static void drawSpriteCacheStats(Ui::Window& window, Gfx::DrawingContext& drawingCtx)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+        tr.setCurrentFont(Gfx::Font::small);
+
+        char buffer[128];
+        const auto stats = Gfx::SpriteCache::getStats();
+        if (stats.capacity == 0)
+        {
+            std::snprintf(buffer, std::size(buffer), "Sprite cache: disabled");
+        }
+        else
+        {
+            const auto lookups = stats.hits + stats.misses;
+            const auto hitRate = lookups != 0 ? (static_cast<double>(stats.hits) * 100.0) / lookups : 0.0;
+            std::snprintf(
+                buffer,
+                std::size(buffer),
+                "Sprite cache: %u images, %zu / %zu KiB, %.1f%% hit rate",
+                stats.numSprites,
+                stats.memoryUsed / 1024,
+                stats.capacity / 1024,
+                hitRate);
         }
+
+        const auto y = kProfilerTableTop + static_cast<int32_t>(TickProfiler::kSubsystemCount + 1) * kProfilerRowHeight;
+        tr.drawString(Ui::Point(window.x + kMargin, window.y + y), Colour::black, buffer);
+    }
+
+    static void drawMemoryUsage(Ui::Window& window, Gfx::DrawingContext& drawingCtx)
+    {
+        auto tr = Gfx::TextRenderer(drawingCtx);
+        tr.setCurrentFont(Gfx::Font::small);
+
+        static constexpr std::array<int32_t, 3> kColumnOffsets = { 0, 110, 166 };
+
+        const auto drawRow = [&](int32_t y, const char* name, const char* current, const char* peak) {
+            tr.drawString(Ui::Point(window.x + kMargin + kColumnOffsets[0], window.y + y), Colour::black, name);
+            tr.drawString(Ui::Point(window.x + kMargin + kColumnOffsets[1], window.y + y), Colour::black, current);
+            tr.drawString(Ui::Point(window.x + kMargin + kColumnOffsets[2], window.y + y), Colour::black, peak);
+        };
+
+        drawRow(kMemoryTableTop, "Memory", "KiB", "peak KiB");
+
+        char current[16];
+        char peak[16];
+        for (size_t i = 0; i < MemoryAccounting::kCategoryCount; i++)
+        {
+            const auto category = static_cast<MemoryAccounting::Category>(i);
+            const auto usage = MemoryAccounting::getUsage(category);
+            std::snprintf(current, std::size(current), "%zu", usage.current / 1024);
+            std::snprintf(peak, std::size(peak), "%zu", usage.peak / 1024);
+
+            const auto name = std::string(MemoryAccounting::getName(category));
+            drawRow(kMemoryTableTop + static_cast<int32_t>(i + 1) * kProfilerRowHeight, name.c_str(), current, peak);
+        }
+
+        const auto total = MemoryAccounting::getTotalUsage();
+        std::snprintf(current, std::size(current), "%zu", total.current / 1024);
+        std::snprintf(peak, std::size(peak), "%zu", total.peak / 1024);
+        drawRow(kMemoryTableTop + static_cast<int32_t>(MemoryAccounting::kCategoryCount + 1) * kProfilerRowHeight, "Total", current, peak);
     }
 
     // 0x0043B2E4
@@ -150,10 +308,16 @@ namespace OpenLoco::Ui::Windows::Debug
     {
         // Draw widgets.
         window.draw(drawingCtx);
+
+        drawTickProfiler(window, drawingCtx);
+        drawSpriteCacheStats(window, drawingCtx);
+        drawMemoryUsage(window, drawingCtx);
     }
 
     static constexpr WindowEventList kEvents = {
         .onMouseUp = onMouseUp,
+        .onUpdate = onUpdate,
+        .prepareDraw = prepareDraw,
         .draw = draw,
     };
 
@@ -35,6 +35,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/TableHeaderWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "World/IndustryManager.h"
 #include <OpenLoco/Engine/World.hpp>
@@ -370,62 +371,16 @@ namespace OpenLoco::Ui::Windows::IndustryList
         // 0x00457991
         static void updateIndustryList(Window* self)
         {
-            auto chosenIndustry = IndustryId::null;
-
+            std::vector<IndustryId> industryIds;
             for (auto& industry : IndustryManager::industries())
             {
-                if (industry.hasFlags(IndustryFlags::sorted))
-                {
-                    continue;
-                }
-
-                if (chosenIndustry == IndustryId::null)
-                {
-                    chosenIndustry = industry.id();
-                    continue;
-                }
-
-                if (getOrder(SortMode(self->sortMode), industry, *IndustryManager::get(chosenIndustry)))
-                {
-                    chosenIndustry = industry.id();
-                }
-            }
-
-            if (chosenIndustry != IndustryId::null)
-            {
-                bool shouldInvalidate = false;
-
-                IndustryManager::get(chosenIndustry)->flags |= IndustryFlags::sorted;
-
-                auto ebp = self->rowCount;
-                if (chosenIndustry != IndustryId(self->rowInfo[ebp]))
-                {
-                    self->rowInfo[ebp] = enumValue(chosenIndustry);
-                    shouldInvalidate = true;
-                }
-
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
-                {
-                    self->var_83C = self->rowCount;
-                    shouldInvalidate = true;
-                }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
+                industryIds.push_back(industry.id());
             }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
 
-                Common::refreshIndustryList(self);
-            }
+            const auto sortMode = SortMode(self->sortMode);
+            Widgets::VirtualList::updateRows<IndustryId>(*self, industryIds, [sortMode](IndustryId lhs, IndustryId rhs) {
+                return getOrder(sortMode, *IndustryManager::get(lhs), *IndustryManager::get(rhs));
+            });
         }
 
         // 0x004580AE
@@ -436,10 +391,10 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::industryList, self.number, self.currentTab + Common::widx::tab_industry_list);
 
-            // Add three industries every tick.
-            updateIndustryList(&self);
-            updateIndustryList(&self);
-            updateIndustryList(&self);
+            if (Widgets::VirtualList::shouldRefresh(self))
+            {
+                updateIndustryList(&self);
+            }
         }
 
         // 0x00457EE8
@@ -465,13 +420,14 @@ namespace OpenLoco::Ui::Windows::IndustryList
             auto shade = Colours::getShade(self.getColour(WindowColour::secondary).c(), 4);
             drawingCtx.clearSingle(shade);
 
-            uint16_t yPos = 0;
-            for (uint16_t i = 0; i < self.var_83C; i++)
+            const auto visibleRows = Widgets::VirtualList::getVisibleRows(rt, kRowHeight, self.var_83C);
+            uint16_t yPos = visibleRows.first * kRowHeight;
+            for (auto i = visibleRows.first; i < visibleRows.last; i++)
             {
                 IndustryId industryId = IndustryId(self.rowInfo[i]);
 
-                // Skip items outside of view, or irrelevant to the current filter.
-                if (yPos + kRowHeight < rt.y || yPos >= yPos + kRowHeight + rt.height || industryId == IndustryId::null)
+                // Skip items irrelevant to the current filter.
+                if (industryId == IndustryId::null)
                 {
                     yPos += kRowHeight;
                     continue;
@@ -1487,12 +1443,7 @@ namespace OpenLoco::Ui::Windows::IndustryList
         // 0x00457964
         static void refreshIndustryList(Window* window)
         {
-            window->rowCount = 0;
-
-            for (auto& industry : IndustryManager::industries())
-            {
-                industry.flags &= ~IndustryFlags::sorted;
-            }
+            IndustryList::updateIndustryList(window);
         }
     }
 }
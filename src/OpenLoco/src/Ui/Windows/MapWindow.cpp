@@ -48,6 +48,10 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Ui::WindowManager;
 using namespace OpenLoco::World;
@@ -81,10 +85,25 @@ namespace OpenLoco::Ui::Windows::MapWindow
     static PaletteIndex_t* _mapPixels; // 0x00F253A8
     static PaletteIndex_t* _mapAltPixels;
 
+    static constexpr uint8_t kNumMapTabs = 5;
+
+    // The rendered map of a tab, kept while the window is open so that only the rows containing
+    // tiles that changed have to be drawn again.
+    struct MapLayer
+    {
+        std::vector<PaletteIndex_t> pixels; // kRenderedMapSize regular pixels followed by as many flashing ones
+        TileManager::ChangedTiles staleTiles;
+        uint32_t flashingItems = 0;
+        bool isBuilt = false;
+    };
+    static std::array<MapLayer, kNumMapTabs> _mapLayers;
+
+    // Below this a refresh is not worth starting threads for.
+    static constexpr size_t kMinRowsPerMapThread = 32;
+
     static std::array<uint16_t, 6> _vehicleTypeCounts = {};
 
     static uint32_t _flashingItems;              // 0x00F253A4
-    static uint32_t _drawMapRowIndex;            // 0x00F253AC
     static uint8_t _assignedIndustryColours[16]; // 0x00F253CE
     static uint8_t _routeToObjectIdMap[19];      // 0x00F253DF
     static uint8_t _routeColours[19];            // 0x00F253F2
@@ -181,7 +200,12 @@ namespace OpenLoco::Ui::Windows::MapWindow
         Ui::getLastMapWindowAttributes().var88C = self.var_88C;
         Ui::getLastMapWindowAttributes().flags = self.flags | WindowFlags::flag_31;
 
-        free(_mapPixels);
+        for (auto& layer : _mapLayers)
+        {
+            layer = {};
+        }
+        _mapPixels = nullptr;
+        _mapAltPixels = nullptr;
     }
 
     // 0x0046B8CF
@@ -409,12 +433,6 @@ namespace OpenLoco::Ui::Windows::MapWindow
             mapPtr += kRenderedMapWidth + 1;
             mapAltPtr += kRenderedMapWidth + 1;
         }
-
-        _drawMapRowIndex++;
-        if (_drawMapRowIndex > kMapColumns)
-        {
-            _drawMapRowIndex = 0;
-        }
     }
 
     // 0x0046C873
@@ -497,12 +515,6 @@ namespace OpenLoco::Ui::Windows::MapWindow
             mapPtr += kRenderedMapWidth + 1;
             mapAltPtr += kRenderedMapWidth + 1;
         }
-
-        _drawMapRowIndex++;
-        if (_drawMapRowIndex > kMapColumns)
-        {
-            _drawMapRowIndex = 0;
-        }
     }
 
     // 0x004FB464
@@ -633,12 +645,6 @@ namespace OpenLoco::Ui::Windows::MapWindow
             mapPtr += kRenderedMapWidth + 1;
             mapAltPtr += kRenderedMapWidth + 1;
         }
-
-        _drawMapRowIndex++;
-        if (_drawMapRowIndex > kMapColumns)
-        {
-            _drawMapRowIndex = 0;
-        }
     }
 
     // 0x0046CB68
@@ -789,12 +795,6 @@ namespace OpenLoco::Ui::Windows::MapWindow
             mapPtr += kRenderedMapWidth + 1;
             mapAltPtr += kRenderedMapWidth + 1;
         }
-
-        _drawMapRowIndex++;
-        if (_drawMapRowIndex > kMapColumns)
-        {
-            _drawMapRowIndex = 0;
-        }
     }
 
     // 0x0046CD31
@@ -913,45 +913,38 @@ namespace OpenLoco::Ui::Windows::MapWindow
             mapPtr += kRenderedMapWidth + 1;
             mapAltPtr += kRenderedMapWidth + 1;
         }
-
-        _drawMapRowIndex++;
-        if (_drawMapRowIndex > kMapColumns)
-        {
-            _drawMapRowIndex = 0;
-        }
     }
 
     // 0x0046C544
-    static void setMapPixels(const Window& self)
+    static void setMapPixels(uint8_t tab, PaletteIndex_t* pixels, uint32_t rowIndex)
     {
-        _flashingItems = self.var_854;
-        auto offset = _drawMapRowIndex * (kRenderedMapWidth - 1) + (kMapRows - 1);
-        auto* mapPtr = &_mapPixels[offset];
-        auto* mapAltPtr = &_mapAltPixels[offset];
+        auto offset = rowIndex * (kRenderedMapWidth - 1) + (kMapRows - 1);
+        auto* mapPtr = &pixels[offset];
+        auto* mapAltPtr = &pixels[kRenderedMapSize + offset];
 
         Pos2 pos{};
         Pos2 delta{};
         switch (WindowManager::getCurrentRotation())
         {
             case 0:
-                pos = Pos2(_drawMapRowIndex * kTileSize, 0);
+                pos = Pos2(rowIndex * kTileSize, 0);
                 delta = { 0, kTileSize };
                 break;
             case 1:
-                pos = Pos2(kMapWidth - kTileSize, _drawMapRowIndex * kTileSize);
+                pos = Pos2(kMapWidth - kTileSize, rowIndex * kTileSize);
                 delta = { -kTileSize, 0 };
                 break;
             case 2:
-                pos = Pos2((kMapColumns - 1 - _drawMapRowIndex) * kTileSize, kMapWidth - kTileSize);
+                pos = Pos2((kMapColumns - 1 - rowIndex) * kTileSize, kMapWidth - kTileSize);
                 delta = { 0, -kTileSize };
                 break;
             case 3:
-                pos = Pos2(0, (kMapColumns - 1 - _drawMapRowIndex) * kTileSize);
+                pos = Pos2(0, (kMapColumns - 1 - rowIndex) * kTileSize);
                 delta = { kTileSize, 0 };
                 break;
         }
 
-        switch (self.currentTab)
+        switch (tab)
         {
             case 0: setMapPixelsOverall(mapPtr, mapAltPtr, pos, delta); return;
             case 1: setMapPixelsVehicles(mapPtr, mapAltPtr, pos, delta); return;
@@ -961,6 +954,112 @@ namespace OpenLoco::Ui::Windows::MapWindow
         }
     }
 
+    // Rows hold the tiles of one map column or row depending on the rotation.
+    static std::vector<uint32_t> getStaleMapRows(const TileManager::ChangedTiles& staleTiles)
+    {
+        std::vector<uint32_t> rows;
+        for (uint32_t i = 0; i < kMapColumns; i++)
+        {
+            switch (WindowManager::getCurrentRotation())
+            {
+                case 0:
+                    if (staleTiles.columns.test(i))
+                    {
+                        rows.push_back(i);
+                    }
+                    break;
+                case 1:
+                    if (staleTiles.rows.test(i))
+                    {
+                        rows.push_back(i);
+                    }
+                    break;
+                case 2:
+                    if (staleTiles.columns.test(kMapColumns - 1 - i))
+                    {
+                        rows.push_back(i);
+                    }
+                    break;
+                case 3:
+                    if (staleTiles.rows.test(kMapColumns - 1 - i))
+                    {
+                        rows.push_back(i);
+                    }
+                    break;
+            }
+        }
+        return rows;
+    }
+
+    static void setMapPixelsRows(uint8_t tab, MapLayer& layer, const std::vector<uint32_t>& rows)
+    {
+        const size_t numThreads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(rows.size() / kMinRowsPerMapThread, 1));
+        if (numThreads == 1)
+        {
+            for (auto row : rows)
+            {
+                setMapPixels(tab, layer.pixels.data(), row);
+            }
+            return;
+        }
+
+        // Each row writes its own pixels and only reads the map, so bands of rows can be drawn at once.
+        const size_t rowsPerBand = (rows.size() + numThreads - 1) / numThreads;
+        auto drawBand = [&](size_t band) {
+            const auto end = std::min(rows.size(), (band + 1) * rowsPerBand);
+            for (auto i = band * rowsPerBand; i < end; i++)
+            {
+                setMapPixels(tab, layer.pixels.data(), rows[i]);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads - 1);
+        for (size_t band = 1; band < numThreads; band++)
+        {
+            workers.emplace_back(drawBand, band);
+        }
+        drawBand(0);
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    static void updateMapLayer(uint8_t tab)
+    {
+        auto& layer = _mapLayers[tab];
+        if (layer.pixels.empty())
+        {
+            layer.pixels.resize(kRenderedMapSize * 2);
+        }
+
+        // Legend items flash on the alternate pixels so those have to be drawn again for the new items.
+        if (layer.flashingItems != _flashingItems)
+        {
+            layer.flashingItems = _flashingItems;
+            layer.isBuilt = false;
+        }
+
+        if (!layer.isBuilt)
+        {
+            std::fill(layer.pixels.begin(), layer.pixels.end(), PaletteIndex::black0);
+            layer.staleTiles.columns.set();
+            layer.staleTiles.rows.set();
+            layer.isBuilt = true;
+        }
+
+        if (layer.staleTiles.columns.any() || layer.staleTiles.rows.any())
+        {
+            setMapPixelsRows(tab, layer, getStaleMapRows(layer.staleTiles));
+            layer.staleTiles = {};
+        }
+
+        _mapPixels = layer.pixels.data();
+        _mapAltPixels = &_mapPixels[kRenderedMapSize];
+    }
+
     // 0x0046D34D based on
     static void setHoverItem(Window* self, int16_t y, int index)
     {
@@ -1082,7 +1181,10 @@ namespace OpenLoco::Ui::Windows::MapWindow
     // 0x0046B69C
     static void clearMap()
     {
-        std::fill(_mapPixels, _mapPixels + kRenderedMapSize * 2, PaletteIndex::black0);
+        for (auto& layer : _mapLayers)
+        {
+            layer.isBuilt = false;
+        }
     }
 
     // 0x00F2541D
@@ -1104,14 +1206,16 @@ namespace OpenLoco::Ui::Windows::MapWindow
             clearMap();
         }
 
-        auto i = 80;
-
-        while (i > 0)
+        const auto changedTiles = TileManager::takeChangedTiles();
+        for (auto& layer : _mapLayers)
         {
-            setMapPixels(self);
-            i--;
+            layer.staleTiles.columns |= changedTiles.columns;
+            layer.staleTiles.rows |= changedTiles.rows;
         }
 
+        _flashingItems = self.var_854;
+        updateMapLayer(self.currentTab);
+
         self.invalidate();
 
         auto x = self.x + self.width - 104;
@@ -2400,15 +2504,6 @@ namespace OpenLoco::Ui::Windows::MapWindow
             return;
         }
 
-        auto ptr = malloc(kRenderedMapSize * 2);
-        if (ptr == nullptr)
-        {
-            return;
-        }
-
-        _mapPixels = static_cast<PaletteIndex_t*>(ptr);
-        _mapAltPixels = &_mapPixels[kRenderedMapSize];
-
         Ui::Size32 size = { 350, 272 };
 
         if (Ui::getLastMapWindowAttributes().flags != WindowFlags::none)
@@ -2437,6 +2532,7 @@ namespace OpenLoco::Ui::Windows::MapWindow
         window->var_846 = getCurrentRotation();
 
         clearMap();
+        TileManager::takeChangedTiles();
 
         centerOnViewPoint();
 
@@ -2447,6 +2543,9 @@ namespace OpenLoco::Ui::Windows::MapWindow
         assignIndustryColours();
         assignRouteColours();
 
+        _flashingItems = 0;
+        updateMapLayer(window->currentTab);
+
         mapFrameNumber = 0;
     }
 
@@ -61,6 +61,7 @@
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/FileSystem.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
 #include <array>
 #include <numeric>
 #include <ranges>
@@ -218,10 +219,8 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
         return std::span<ObjectManager::SelectedObjectsFlags>(_objectSelection, ObjectManager::getNumInstalledObjects());
     }
 
-    // _tabObjectCounts can be integrated after implementing sub_473A95
-    static std::array<uint16_t, 33> _tabObjectCounts = {}; // Was loco_global at 0x00112C181
-
     static std::vector<TabObjectEntry> _tabObjectList;
+    static ObjectType _tabObjectType;
     static uint16_t _numVisibleObjectsListed;
     static bool _filterByVehicleType = false;
     static VehicleType _currentVehicleType;
@@ -330,14 +329,14 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
         }
 
         // Skip all types that don't have any objects
-        auto objectType = enumValue(tabInfo.objectType);
-        if (_tabObjectCounts[objectType] == 0)
+        const auto numObjects = ObjectManager::getNumInstalledObjects(tabInfo.objectType);
+        if (numObjects == 0)
         {
             return false;
         }
 
         // Skip certain object types that only have one entry in game
-        if ((tabFlags & ObjectTabFlags::showEvenIfSingular) == ObjectTabFlags::none && _tabObjectCounts[objectType] == 1)
+        if ((tabFlags & ObjectTabFlags::showEvenIfSingular) == ObjectTabFlags::none && numObjects == 1)
         {
             return false;
         }
@@ -394,14 +393,6 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
         }
     }
 
-    static bool contains(const std::string_view& a, const std::string_view& b)
-    {
-        return std::search(a.begin(), a.end(), b.begin(), b.end(), [](char a, char b) {
-                   return tolower(a) == tolower(b);
-               })
-            != a.end();
-    }
-
     static std::optional<VehicleType> getVehicleTypeFromObject(TabObjectEntry& entry)
     {
         auto& displayData = entry.object._displayData;
@@ -417,6 +408,7 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
     static void applyFilterToObjectList(FilterFlags filterFlags)
     {
         std::string_view pattern = inputSession.buffer;
+        const auto matches = pattern.empty() ? std::vector<ObjectManager::ObjectIndexId>{} : ObjectManager::findObjectsByName(_tabObjectType, pattern);
         _numVisibleObjectsListed = 0;
         for (auto& entry : _tabObjectList)
         {
@@ -457,13 +449,7 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
                 continue;
             }
 
-            const std::string_view name = entry.object._name;
-            const auto filename = fs::u8path(entry.object._filepath).filename().u8string();
-
-            const bool containsName = contains(name, pattern);
-            const bool containsFileName = contains(filename, pattern);
-
-            entry.display = containsName || containsFileName ? Visibility::shown : Visibility::hidden;
+            entry.display = std::ranges::binary_search(matches, entry.index) ? Visibility::shown : Visibility::hidden;
 
             if (entry.display == Visibility::shown)
             {
@@ -475,6 +461,7 @@ namespace OpenLoco::Ui::Windows::ObjectSelectionWindow
     static void populateTabObjectList(ObjectType objectType, FilterFlags filterFlags)
     {
         _tabObjectList.clear();
+        _tabObjectType = objectType;
 
         const auto objects = ObjectManager::getAvailableObjects(objectType);
         _tabObjectList.reserve(objects.size());
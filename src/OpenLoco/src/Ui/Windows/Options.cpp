@@ -288,7 +288,7 @@ namespace OpenLoco::Ui::Windows::Options
 
     namespace Display
     {
-        static constexpr Ui::Size32 kWindowSize = { 400, 151 };
+        static constexpr Ui::Size32 kWindowSize = { 400, 167 };
 
         namespace Widx
         {
@@ -305,6 +305,9 @@ namespace OpenLoco::Ui::Windows::Options
                 display_scale,
                 display_scale_down_btn,
                 display_scale_up_btn,
+                render_driver_label,
+                render_driver,
+                render_driver_btn,
                 uncap_fps,
                 show_fps,
             };
@@ -312,7 +315,7 @@ namespace OpenLoco::Ui::Windows::Options
 
         static constexpr auto _widgets = makeWidgets(
             Common::makeCommonWidgets(kWindowSize, StringIds::options_title_display),
-            Widgets::GroupBox({ 4, 49 }, { 392, 97 }, WindowColour::secondary, StringIds::frame_hardware),
+            Widgets::GroupBox({ 4, 49 }, { 392, 113 }, WindowColour::secondary, StringIds::frame_hardware),
 
             Widgets::Label({ 10, 63 }, { 215, 12 }, WindowColour::secondary, ContentAlign::left, StringIds::options_screen_mode),
             Widgets::dropdownWidgets({ 235, 63 }, { 154, 12 }, WindowColour::secondary, StringIds::empty),
@@ -323,8 +326,11 @@ namespace OpenLoco::Ui::Windows::Options
             Widgets::Label({ 10, 95 }, { 215, 12 }, WindowColour::secondary, ContentAlign::left, StringIds::window_scale_factor),
             Widgets::stepperWidgets({ 235, 95 }, { 154, 12 }, WindowColour::secondary, StringIds::scale_formatted),
 
-            Widgets::Checkbox({ 10, 111 }, { 174, 12 }, WindowColour::secondary, StringIds::option_uncap_fps, StringIds::option_uncap_fps_tooltip),
-            Widgets::Checkbox({ 10, 127 }, { 174, 12 }, WindowColour::secondary, StringIds::option_show_fps_counter, StringIds::option_show_fps_counter_tooltip)
+            Widgets::Label({ 10, 111 }, { 215, 12 }, WindowColour::secondary, ContentAlign::left, StringIds::display_render_driver),
+            Widgets::dropdownWidgets({ 235, 111 }, { 154, 12 }, WindowColour::secondary, StringIds::stringid),
+
+            Widgets::Checkbox({ 10, 127 }, { 174, 12 }, WindowColour::secondary, StringIds::option_uncap_fps, StringIds::option_uncap_fps_tooltip),
+            Widgets::Checkbox({ 10, 143 }, { 174, 12 }, WindowColour::secondary, StringIds::option_show_fps_counter, StringIds::option_show_fps_counter_tooltip)
 
         );
 
@@ -436,6 +442,55 @@ namespace OpenLoco::Ui::Windows::Options
             Ui::setDisplayMode(Config::ScreenMode::fullscreen, { resolutions[index].width, resolutions[index].height });
         }
 
+#pragma mark - Render driver dropdown
+
+        static void renderDriverMouseDown(Window* w, [[maybe_unused]] WidgetIndex_t wi)
+        {
+            static std::vector<std::string> _renderDrivers;
+            _renderDrivers = Gfx::SoftwareDrawingEngine::getRenderDrivers();
+
+            Widget dropdown = w->widgets[Widx::render_driver];
+            Dropdown::show(w->x + dropdown.left, w->y + dropdown.top, dropdown.width() - 4, dropdown.height(), w->getColour(WindowColour::secondary), _renderDrivers.size() + 1, 0x80);
+
+            const auto& current = Config::get().display.renderDriver;
+            Dropdown::add(0, StringIds::dropdown_stringid, StringIds::display_render_driver_automatic);
+            if (current.empty())
+            {
+                Dropdown::setItemSelected(0);
+            }
+            for (size_t i = 0; i < _renderDrivers.size(); i++)
+            {
+                Dropdown::add(i + 1, StringIds::dropdown_stringid, { StringIds::stringptr, _renderDrivers[i].c_str() });
+                if (_renderDrivers[i] == current)
+                {
+                    Dropdown::setItemSelected(static_cast<int16_t>(i + 1));
+                }
+            }
+        }
+
+        static void renderDriverDropdown(Window* w, int16_t index)
+        {
+            if (index == -1)
+            {
+                return;
+            }
+
+            std::string driver;
+            if (index > 0)
+            {
+                const auto drivers = Gfx::SoftwareDrawingEngine::getRenderDrivers();
+                if (static_cast<size_t>(index - 1) >= drivers.size())
+                {
+                    return;
+                }
+                driver = drivers[index - 1];
+            }
+
+            Gfx::getDrawingEngine().setRenderDriver(driver);
+            Gfx::invalidateScreen();
+            w->invalidate();
+        }
+
 #pragma mark -
 
         static void displayScaleMouseDown([[maybe_unused]] Window* w, [[maybe_unused]] WidgetIndex_t wi, float adjust_by)
@@ -460,6 +515,9 @@ namespace OpenLoco::Ui::Windows::Options
                 case Widx::display_scale_up_btn:
                     displayScaleMouseDown(&w, wi, OpenLoco::Ui::ScaleFactor::step);
                     break;
+                case Widx::render_driver_btn:
+                    renderDriverMouseDown(&w, wi);
+                    break;
             }
         }
 
@@ -474,6 +532,9 @@ namespace OpenLoco::Ui::Windows::Options
                 case Widx::display_resolution_btn:
                     resolutionDropdown(&w, item_index);
                     break;
+                case Widx::render_driver_btn:
+                    renderDriverDropdown(&w, item_index);
+                    break;
             }
         }
 
@@ -530,6 +591,23 @@ namespace OpenLoco::Ui::Windows::Options
                 args.push<int32_t>(Config::get().scaleFactor * 100);
             }
 
+            // Render driver.
+            {
+                static std::string _renderDriverName;
+                _renderDriverName = Gfx::getDrawingEngine().getRenderDriverName();
+
+                auto args = FormatArguments(w.widgets[Widx::render_driver].textArgs);
+                if (Config::get().display.renderDriver.empty() || _renderDriverName.empty())
+                {
+                    args.push(StringIds::display_render_driver_automatic);
+                }
+                else
+                {
+                    args.push(StringIds::stringptr);
+                    args.push(_renderDriverName.c_str());
+                }
+            }
+
             w.activatedWidgets &= ~(1ULL << Widx::show_fps);
             if (Config::get().showFPS)
             {
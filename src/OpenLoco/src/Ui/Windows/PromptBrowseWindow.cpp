@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <cstring>
 #include <string>
+#include <unordered_map>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -81,10 +82,63 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
 
     static std::array<char, 512> _savePath = {}; // Was loco_global at 0x0112CE04
 
+    // Details of files that have already been previewed, keyed by path. An entry is only used while the
+    // modification time and size of the file are unchanged.
+    template<typename T>
+    class FileDetailsCache
+    {
+    private:
+        static constexpr size_t kMaxEntries = 64;
+
+        struct Entry
+        {
+            fs::file_time_type lastWriteTime;
+            uintmax_t size;
+            uint32_t lastUse;
+            std::shared_ptr<T> details;
+        };
+
+        std::unordered_map<std::string, Entry> _entries;
+        uint32_t _useCounter = 0;
+
+    public:
+        template<typename TRead>
+        std::shared_ptr<T> get(const fs::path& path, TRead&& read)
+        {
+            std::error_code ec;
+            const auto lastWriteTime = fs::last_write_time(path, ec);
+            const auto size = ec ? 0 : fs::file_size(path, ec);
+            if (ec)
+            {
+                return read(path);
+            }
+
+            const auto key = path.u8string();
+            auto it = _entries.find(key);
+            if (it == _entries.end() || it->second.lastWriteTime != lastWriteTime || it->second.size != size)
+            {
+                if (it == _entries.end() && _entries.size() >= kMaxEntries)
+                {
+                    // Make room by dropping the least recently used entry
+                    auto oldest = std::min_element(_entries.begin(), _entries.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.second.lastUse < rhs.second.lastUse;
+                    });
+                    _entries.erase(oldest);
+                }
+                it = _entries.insert_or_assign(key, Entry{ lastWriteTime, size, 0, read(path) }).first;
+            }
+            it->second.lastUse = ++_useCounter;
+            return it->second.details;
+        }
+    };
+
+    static FileDetailsCache<S5::SaveDetails> _saveDetailsCache;
+    static FileDetailsCache<Scenario::Options> _scenarioOptionsCache;
+
     // 0x0050AEA8
-    static std::unique_ptr<S5::SaveDetails> _previewSaveDetails;
+    static std::shared_ptr<S5::SaveDetails> _previewSaveDetails;
     // 0x009CCA54
-    static std::unique_ptr<Scenario::Options> _previewScenarioOptions;
+    static std::shared_ptr<Scenario::Options> _previewScenarioOptions;
 
     static Ui::TextInput::InputSession inputSession;
 
@@ -371,7 +425,7 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
         // We'll ensure the folder width does not reach the parent button.
         const uint16_t maxWidth = self.widgets[widx::parent_button].left - folderLabelWidth - 10;
         auto nameBuffer = _currentDirectory.u8string();
-        nameBuffer = Localisation::convertUnicodeToLoco(nameBuffer);
+        nameBuffer = Localisation::convertUnicodeToLocoCached(nameBuffer);
         strncpy(&_displayFolderBuffer[0], nameBuffer.c_str(), 512);
         uint16_t folderWidth = Gfx::TextRenderer::getStringWidth(Gfx::Font::medium_bold, _displayFolderBuffer);
 
@@ -439,7 +493,7 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
                 auto y = window.y + 45;
 
                 auto nameBuffer = selectedFile.stem().u8string();
-                nameBuffer = Localisation::convertUnicodeToLoco(nameBuffer);
+                nameBuffer = Localisation::convertUnicodeToLocoCached(nameBuffer);
 
                 auto args = getStringPtrFormatArgs(nameBuffer.c_str());
                 auto point = Point(x + (width / 2), y);
@@ -675,7 +729,7 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
 
             // Copy name to our work buffer (if drive letter use the full path)
             auto nameBuffer = isRootPath(entry) ? entry.u8string() : entry.stem().u8string();
-            nameBuffer = Localisation::convertUnicodeToLoco(nameBuffer);
+            nameBuffer = Localisation::convertUnicodeToLocoCached(nameBuffer);
 
             // Draw the name
             auto args = getStringPtrFormatArgs(nameBuffer.c_str());
@@ -1010,10 +1064,14 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
         switch (_fileType)
         {
             case BrowseFileType::savedGame:
-                _previewSaveDetails = S5::readSaveDetails(path);
+                _previewSaveDetails = _saveDetailsCache.get(path, [](const fs::path& filePath) {
+                    return std::shared_ptr<S5::SaveDetails>(S5::readSaveDetails(filePath));
+                });
                 break;
             case BrowseFileType::landscape:
-                _previewScenarioOptions = S5::readScenarioOptions(path);
+                _previewScenarioOptions = _scenarioOptionsCache.get(path, [](const fs::path& filePath) {
+                    return std::shared_ptr<Scenario::Options>(S5::readScenarioOptions(filePath));
+                });
                 break;
             default:
                 break;
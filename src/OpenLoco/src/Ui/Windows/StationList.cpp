@@ -24,6 +24,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/TableHeaderWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
@@ -102,20 +103,6 @@ namespace OpenLoco::Ui::Windows::StationList
         CargoAccepted,
     };
 
-    // 0x004910E8
-    static void refreshStationList(Window* window)
-    {
-        window->rowCount = 0;
-
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner == CompanyId(window->number))
-            {
-                station.flags &= ~StationFlags::flag_4;
-            }
-        }
-    }
-
     // 0x004911FD
     static bool orderByName(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
     {
@@ -206,8 +193,9 @@ namespace OpenLoco::Ui::Windows::StationList
     // 0x0049111A
     static void updateStationList(Window* window)
     {
-        StationId edi = StationId::null;
+        const StationFlags mask = tabInformationByType[window->currentTab].stationMask;
 
+        std::vector<StationId> stationIds;
         for (auto& station : StationManager::stations())
         {
             if (station.owner != CompanyId(window->number))
@@ -220,64 +208,24 @@ namespace OpenLoco::Ui::Windows::StationList
                 continue;
             }
 
-            const StationFlags mask = tabInformationByType[window->currentTab].stationMask;
             if ((station.flags & mask) == StationFlags::none)
             {
                 continue;
             }
 
-            if ((station.flags & StationFlags::flag_4) != StationFlags::none)
-            {
-                continue;
-            }
-
-            if (edi == StationId::null)
-            {
-                edi = station.id();
-                continue;
-            }
-
-            if (getOrder(SortMode(window->sortMode), station, *StationManager::get(edi)))
-            {
-                edi = station.id();
-            }
+            stationIds.push_back(station.id());
         }
 
-        if (edi != StationId::null)
-        {
-            bool dl = false;
-
-            StationManager::get(edi)->flags |= StationFlags::flag_4;
-
-            auto ebp = window->rowCount;
-            if (edi != StationId(window->rowInfo[ebp]))
-            {
-                window->rowInfo[ebp] = enumValue(edi);
-                dl = true;
-            }
-
-            window->rowCount += 1;
-            if (window->rowCount > window->var_83C)
-            {
-                window->var_83C = window->rowCount;
-                dl = true;
-            }
-
-            if (dl)
-            {
-                window->invalidate();
-            }
-        }
-        else
-        {
-            if (window->var_83C != window->rowCount)
-            {
-                window->var_83C = window->rowCount;
-                window->invalidate();
-            }
+        const auto sortMode = SortMode(window->sortMode);
+        Widgets::VirtualList::updateRows<StationId>(*window, stationIds, [sortMode](StationId lhs, StationId rhs) {
+            return getOrder(sortMode, *StationManager::get(lhs), *StationManager::get(rhs));
+        });
+    }
 
-            refreshStationList(window);
-        }
+    // 0x004910E8
+    static void refreshStationList(Window* window)
+    {
+        updateStationList(window);
     }
 
     // 0x004910AB
@@ -488,21 +436,18 @@ namespace OpenLoco::Ui::Windows::StationList
         auto shade = Colours::getShade(window.getColour(WindowColour::secondary).c(), 4);
         drawingCtx.clearSingle(shade);
 
-        uint16_t yPos = 0;
-        for (uint16_t i = 0; i < window.var_83C; i++)
+        const auto visibleRows = Widgets::VirtualList::getVisibleRows(rt, kRowHeight, window.var_83C);
+        uint16_t yPos = visibleRows.first * kRowHeight;
+        for (auto i = visibleRows.first; i < visibleRows.last; i++)
         {
             auto stationId = StationId(window.rowInfo[i]);
 
-            // Skip items outside of view, or irrelevant to the current filter.
-            if (yPos + kRowHeight < rt.y || stationId == StationId::null)
+            // Skip items irrelevant to the current filter.
+            if (stationId == StationId::null)
             {
                 yPos += kRowHeight;
                 continue;
             }
-            else if (yPos >= yPos + kRowHeight + rt.height)
-            {
-                break;
-            }
 
             StringId text_colour_id = StringIds::black_stringid;
 
@@ -650,12 +595,11 @@ namespace OpenLoco::Ui::Windows::StationList
         window.owner = companyId;
         window.sortMode = 0;
         window.rowCount = 0;
-
-        refreshStationList(&window);
-
         window.var_83C = 0;
         window.rowHover = -1;
 
+        refreshStationList(&window);
+
         window.callOnResize();
         window.callPrepareDraw();
         window.initScrollWidgets();
@@ -778,10 +722,10 @@ namespace OpenLoco::Ui::Windows::StationList
         window.callPrepareDraw();
         WindowManager::invalidateWidget(WindowType::stationList, window.number, window.currentTab + 4);
 
-        // Add three stations every tick.
-        updateStationList(&window);
-        updateStationList(&window);
-        updateStationList(&window);
+        if (Widgets::VirtualList::shouldRefresh(window))
+        {
+            updateStationList(&window);
+        }
     }
 
     // 0x00491999
@@ -28,6 +28,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/ViewportWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/Vehicle.h"
@@ -503,6 +504,7 @@ namespace OpenLoco::Ui::Windows::Station
         // 0x0048E986
         static void drawScroll(Window& self, Gfx::DrawingContext& drawingCtx, [[maybe_unused]] const uint32_t scrollIndex)
         {
+            const auto& rt = drawingCtx.currentRenderTarget();
             auto tr = Gfx::TextRenderer(drawingCtx);
 
             drawingCtx.clearSingle(Colours::getShade(self.getColour(WindowColour::secondary).c(), 4));
@@ -521,6 +523,15 @@ namespace OpenLoco::Ui::Windows::Station
                     continue;
                 }
 
+                // Skip cargo outside of view, its height only depends on whether the origin is shown.
+                const int16_t entryHeight = cargo.origin != StationId(self.number) ? 22 : 12;
+                if (y + entryHeight <= rt.y || y >= rt.y + rt.height)
+                {
+                    y += entryHeight;
+                    cargoId++;
+                    continue;
+                }
+
                 quantity = std::min(int(quantity), 400);
 
                 auto units = (quantity + 9) / 10;
@@ -830,9 +841,6 @@ namespace OpenLoco::Ui::Windows::Station
 
         static void refreshVehicleList(Window* self)
         {
-            auto currentVehicleType = getCurrentVehicleType(self);
-            self->rowCount = 0;
-
             for (auto* vehicle : VehicleManager::VehicleList())
             {
                 if (!vehicleStopsAtActiveStation(vehicle, StationId(self->number)))
@@ -841,13 +849,6 @@ namespace OpenLoco::Ui::Windows::Station
                 }
 
                 Common::setVehicleTypeAvailable(*self, vehicle->vehicleType);
-
-                if (vehicle->vehicleType != currentVehicleType)
-                {
-                    continue;
-                }
-
-                vehicle->vehicleFlags &= ~VehicleFlags::sorted;
             }
         }
 
@@ -873,8 +874,8 @@ namespace OpenLoco::Ui::Windows::Station
         static void updateVehicleList(Window* self)
         {
             auto currentVehicleType = getCurrentVehicleType(self);
-            EntityId insertId = EntityId::null;
 
+            std::vector<EntityId> vehicleIds;
             for (auto* vehicle : VehicleManager::VehicleList())
             {
                 if (vehicle->vehicleType != currentVehicleType)
@@ -882,66 +883,17 @@ namespace OpenLoco::Ui::Windows::Station
                     continue;
                 }
 
-                if (vehicle->hasVehicleFlags(VehicleFlags::sorted))
-                {
-                    continue;
-                }
-
                 if (!vehicleStopsAtActiveStation(vehicle, StationId(self->number)))
                 {
                     continue;
                 }
 
-                if (insertId == EntityId::null)
-                {
-                    insertId = vehicle->id;
-                    continue;
-                }
-
-                auto* insertVehicle = EntityManager::get<VehicleHead>(insertId);
-                if (insertVehicle == nullptr)
-                {
-                    continue;
-                }
-                if (orderByName(*vehicle, *insertVehicle))
-                {
-                    insertId = vehicle->id;
-                    continue;
-                }
+                vehicleIds.push_back(vehicle->id);
             }
 
-            if (insertId != EntityId::null)
-            {
-                auto vehicle = EntityManager::get<VehicleHead>(insertId);
-                if (vehicle == nullptr)
-                {
-                    self->var_83C = self->rowCount;
-                    refreshVehicleList(self);
-                    return;
-                }
-                vehicle->vehicleFlags |= VehicleFlags::sorted;
-
-                if (vehicle->id != EntityId(self->rowInfo[self->rowCount]))
-                {
-                    self->rowInfo[self->rowCount] = enumValue(vehicle->id);
-                }
-
-                self->rowCount++;
-
-                if (self->rowCount > self->var_83C)
-                {
-                    self->var_83C = self->rowCount;
-                }
-            }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                }
-
-                refreshVehicleList(self);
-            }
+            Widgets::VirtualList::updateRows<EntityId>(*self, vehicleIds, [](EntityId lhs, EntityId rhs) {
+                return orderByName(*EntityManager::get<VehicleHead>(lhs), *EntityManager::get<VehicleHead>(rhs));
+            });
         }
 
         void removeTrainFromList(Window& self, EntityId head)
@@ -1014,21 +966,18 @@ namespace OpenLoco::Ui::Windows::Station
             auto shade = Colours::getShade(self.getColour(WindowColour::secondary).c(), 1);
             drawingCtx.clearSingle(shade);
 
-            auto yPos = 0;
-            for (auto i = 0; i < self.var_83C; i++)
+            const auto visibleRows = Widgets::VirtualList::getVisibleRows(rt, self.rowHeight, self.var_83C);
+            auto yPos = visibleRows.first * self.rowHeight;
+            for (auto i = visibleRows.first; i < visibleRows.last; i++)
             {
                 const auto vehicleId = EntityId(self.rowInfo[i]);
 
-                // Item not in rendering context, or no vehicle available for this slot?
-                if (yPos + self.rowHeight < rt.y || vehicleId == EntityId::null)
+                // No vehicle available for this slot?
+                if (vehicleId == EntityId::null)
                 {
                     yPos += self.rowHeight;
                     continue;
                 }
-                else if (yPos >= rt.y + rt.height + self.rowHeight)
-                {
-                    break;
-                }
 
                 auto head = EntityManager::get<VehicleHead>(vehicleId);
                 if (head == nullptr)
@@ -1087,9 +1036,11 @@ namespace OpenLoco::Ui::Windows::Station
             self.frameNo++;
             self.callPrepareDraw();
 
-            updateVehicleList(&self);
-            updateVehicleList(&self);
-            updateVehicleList(&self);
+            // The list is emptied when switching between vehicle types, so it is filled straight away.
+            if (Widgets::VirtualList::shouldRefresh(self) || self.var_83C == 0)
+            {
+                updateVehicleList(&self);
+            }
 
             self.invalidate();
         }
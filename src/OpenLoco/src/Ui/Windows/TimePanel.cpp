@@ -109,7 +109,7 @@ namespace OpenLoco::Ui::Windows::TimePanel
         {
             window.widgets[Widx::fast_forward_btn].image = Gfx::recolour(ImageIds::speed_fast_forward_active);
         }
-        else if (SceneManager::getGameSpeed() == GameSpeed::ExtraFastForward)
+        else if (SceneManager::getGameSpeed() == GameSpeed::ExtraFastForward || SceneManager::getGameSpeed() == GameSpeed::Turbo)
         {
             window.widgets[Widx::extra_fast_forward_btn].image = Gfx::recolour(ImageIds::speed_extra_fast_forward_active);
         }
@@ -193,6 +193,10 @@ namespace OpenLoco::Ui::Windows::ToolbarTop::Game
         {
             flags = S5::SaveFlags::packCustomObjects;
         }
+        if (Config::get().compressSaves)
+        {
+            flags |= S5::SaveFlags::compressed;
+        }
 
         if (!S5::exportGameStateToFile(path, flags))
         {
@@ -36,6 +36,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/TableHeaderWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "World/Town.h"
 #include "World/TownManager.h"
@@ -172,13 +173,14 @@ namespace OpenLoco::Ui::Windows::TownList
             auto shade = Colours::getShade(self.getColour(WindowColour::secondary).c(), 3);
             drawingCtx.clearSingle(shade);
 
-            uint16_t yPos = 0;
-            for (uint16_t i = 0; i < self.var_83C; i++)
+            const auto visibleRows = Widgets::VirtualList::getVisibleRows(rt, kRowHeight, self.var_83C);
+            uint16_t yPos = visibleRows.first * kRowHeight;
+            for (auto i = visibleRows.first; i < visibleRows.last; i++)
             {
                 const auto townId = TownId(self.rowInfo[i]);
 
-                // Skip items outside of view, or irrelevant to the current filter.
-                if (yPos + kRowHeight < rt.y || yPos >= yPos + kRowHeight + rt.height || townId == TownId::null)
+                // Skip items irrelevant to the current filter.
+                if (townId == TownId::null)
                 {
                     yPos += kRowHeight;
                     continue;
@@ -395,60 +397,16 @@ namespace OpenLoco::Ui::Windows::TownList
         // 0x00499E0B
         static void updateTownList(Window& self)
         {
-            TownId chosenTown = TownId::null;
+            std::vector<TownId> townIds;
             for (auto& town : TownManager::towns())
             {
-                if ((town.flags & TownFlags::sorted) != TownFlags::none)
-                {
-                    continue;
-                }
-
-                if (chosenTown == TownId::null)
-                {
-                    chosenTown = town.id();
-                    continue;
-                }
-
-                if (getOrder(SortMode(self.sortMode), town, *TownManager::get(chosenTown)))
-                {
-                    chosenTown = town.id();
-                }
+                townIds.push_back(town.id());
             }
 
-            if (chosenTown != TownId::null)
-            {
-                bool shouldInvalidate = false;
-
-                TownManager::get(chosenTown)->flags |= TownFlags::sorted;
-
-                if (chosenTown != TownId(self.rowInfo[self.rowCount]))
-                {
-                    self.rowInfo[self.rowCount] = enumValue(chosenTown);
-                    shouldInvalidate = true;
-                }
-
-                self.rowCount += 1;
-                if (self.rowCount > self.var_83C)
-                {
-                    self.var_83C = self.rowCount;
-                    shouldInvalidate = true;
-                }
-
-                if (shouldInvalidate)
-                {
-                    self.invalidate();
-                }
-            }
-            else
-            {
-                if (self.var_83C != self.rowCount)
-                {
-                    self.var_83C = self.rowCount;
-                    self.invalidate();
-                }
-
-                Common::refreshTownList(self);
-            }
+            const auto sortMode = SortMode(self.sortMode);
+            Widgets::VirtualList::updateRows<TownId>(self, townIds, [sortMode](TownId lhs, TownId rhs) {
+                return getOrder(sortMode, *TownManager::get(lhs), *TownManager::get(rhs));
+            });
         }
 
         // 0x0049A4A0
@@ -459,10 +417,10 @@ namespace OpenLoco::Ui::Windows::TownList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::townList, self.number, self.currentTab + Common::widx::tab_town_list);
 
-            // Add three towns every tick.
-            updateTownList(self);
-            updateTownList(self);
-            updateTownList(self);
+            if (Widgets::VirtualList::shouldRefresh(self))
+            {
+                updateTownList(self);
+            }
         }
 
         // 0x0049A4D0
@@ -1781,12 +1739,7 @@ namespace OpenLoco::Ui::Windows::TownList
         // 0x00499DDE
         static void refreshTownList(Window& self)
         {
-            self.rowCount = 0;
-
-            for (auto& town : TownManager::towns())
-            {
-                town.flags &= ~TownFlags::sorted;
-            }
+            TownList::updateTownList(self);
         }
     }
 }
@@ -28,6 +28,7 @@
 #include "Ui/Widgets/ScrollViewWidget.h"
 #include "Ui/Widgets/TabWidget.h"
 #include "Ui/Widgets/TableHeaderWidget.h"
+#include "Ui/Widgets/VirtualList.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/Orders.h"
@@ -153,31 +154,6 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return false;
     }
 
-    // 0x004C1D4F
-    static void refreshVehicleList(Window& self)
-    {
-        self.rowCount = 0;
-        for (auto* vehicle : VehicleManager::VehicleList())
-        {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self.currentTab))
-            {
-                continue;
-            }
-
-            if (vehicle->owner != CompanyId(self.number))
-            {
-                continue;
-            }
-
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self.var_88C))
-            {
-                continue;
-            }
-
-            vehicle->vehicleFlags &= ~VehicleFlags::sorted;
-        }
-    }
-
     // 0x004C1E4F
     static bool orderByName(const VehicleHead& lhs, const VehicleHead& rhs)
     {
@@ -248,8 +224,7 @@ namespace OpenLoco::Ui::Windows::VehicleList
     // 0x004C1D92
     static void updateVehicleList(Window& self)
     {
-        EntityId insertId = EntityId::null;
-
+        std::vector<EntityId> vehicleIds;
         for (auto* vehicle : VehicleManager::VehicleList())
         {
             if (vehicle->vehicleType != static_cast<VehicleType>(self.currentTab))
@@ -262,66 +237,24 @@ namespace OpenLoco::Ui::Windows::VehicleList
                 continue;
             }
 
-            if (vehicle->hasVehicleFlags(VehicleFlags::sorted))
-            {
-                continue;
-            }
-
             if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self.var_88C))
             {
                 continue;
             }
 
-            if (insertId == EntityId::null)
-            {
-                insertId = vehicle->id;
-                continue;
-            }
-
-            auto* insertVehicle = EntityManager::get<VehicleHead>(insertId);
-            if (insertVehicle == nullptr)
-            {
-                continue;
-            }
-            if (getOrder(SortMode(self.sortMode), *vehicle, *insertVehicle))
-            {
-                insertId = vehicle->id;
-                continue;
-            }
+            vehicleIds.push_back(vehicle->id);
         }
 
-        if (insertId != EntityId::null)
-        {
-            auto vehicle = EntityManager::get<VehicleHead>(insertId);
-            if (vehicle == nullptr)
-            {
-                self.var_83C = self.rowCount;
-                refreshVehicleList(self);
-                return;
-            }
-            vehicle->vehicleFlags |= VehicleFlags::sorted;
-
-            if (vehicle->id != EntityId(self.rowInfo[self.rowCount]))
-            {
-                self.rowInfo[self.rowCount] = enumValue(vehicle->id);
-            }
-
-            self.rowCount++;
-
-            if (self.rowCount > self.var_83C)
-            {
-                self.var_83C = self.rowCount;
-            }
-        }
-        else
-        {
-            if (self.var_83C != self.rowCount)
-            {
-                self.var_83C = self.rowCount;
-            }
+        const auto sortMode = SortMode(self.sortMode);
+        Widgets::VirtualList::updateRows<EntityId>(self, vehicleIds, [sortMode](EntityId lhs, EntityId rhs) {
+            return getOrder(sortMode, *EntityManager::get<VehicleHead>(lhs), *EntityManager::get<VehicleHead>(rhs));
+        });
+    }
 
-            refreshVehicleList(self);
-        }
+    // 0x004C1D4F
+    static void refreshVehicleList(Window& self)
+    {
+        updateVehicleList(self);
     }
 
     // 0x004C2A6E
@@ -689,21 +622,18 @@ namespace OpenLoco::Ui::Windows::VehicleList
         auto shade = Colours::getShade(self.getColour(WindowColour::secondary).c(), 1);
         drawingCtx.clearSingle(shade);
 
-        auto yPos = 0;
-        for (auto i = 0; i < self.var_83C; i++)
+        const auto visibleRows = Widgets::VirtualList::getVisibleRows(rt, self.rowHeight, self.var_83C);
+        auto yPos = visibleRows.first * self.rowHeight;
+        for (auto i = visibleRows.first; i < visibleRows.last; i++)
         {
             const auto vehicleId = EntityId(self.rowInfo[i]);
 
-            // Item not in rendering context, or no vehicle available for this slot?
-            if (yPos + self.rowHeight < rt.y || vehicleId == EntityId::null)
+            // No vehicle available for this slot?
+            if (vehicleId == EntityId::null)
             {
                 yPos += self.rowHeight;
                 continue;
             }
-            else if (yPos >= rt.y + rt.height + self.rowHeight)
-            {
-                break;
-            }
 
             auto head = EntityManager::get<VehicleHead>(vehicleId);
             if (head == nullptr)
@@ -816,11 +746,11 @@ namespace OpenLoco::Ui::Windows::VehicleList
         }
 
         self.rowCount = 0;
-        refreshVehicleList(self);
-
         self.var_83C = 0;
         self.rowHover = -1;
 
+        refreshVehicleList(self);
+
         self.callOnResize();
         self.callOnPeriodicUpdate();
         self.callPrepareDraw();
@@ -951,11 +881,11 @@ namespace OpenLoco::Ui::Windows::VehicleList
         disableUnavailableVehicleTypes(self);
 
         self.rowCount = 0;
-        refreshVehicleList(self);
-
         self.var_83C = 0;
         self.rowHover = -1;
 
+        refreshVehicleList(self);
+
         self.callOnResize();
         self.callPrepareDraw();
         self.initScrollWidgets();
@@ -1001,10 +931,10 @@ namespace OpenLoco::Ui::Windows::VehicleList
         auto widgetIndex = getTabFromType(static_cast<VehicleType>(self.currentTab));
         WindowManager::invalidateWidget(WindowType::vehicleList, self.number, widgetIndex);
 
-        // It adds 3 vehicles per update, this is not an accident.
-        updateVehicleList(self);
-        updateVehicleList(self);
-        updateVehicleList(self);
+        if (Widgets::VirtualList::shouldRefresh(self))
+        {
+            updateVehicleList(self);
+        }
 
         self.invalidate();
     }
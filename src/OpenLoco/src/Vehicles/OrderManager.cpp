@@ -107,14 +107,16 @@ namespace OpenLoco::Vehicles::OrderManager
     Order* orders() { return reinterpret_cast<Order*>(getGameState().orders); }
     uint32_t& orderTableLength() { return getGameState().orderTableLength; }
 
+    // Entries past orderTableLength are unused and zeroed before saving so the shifts
+    // only need to move the live part of the table rather than rotating it.
     void shiftOrdersLeft(const uint32_t offsetToShiftTowards, const int16_t sizeToShiftBy)
     {
-        std::rotate(&orders()[offsetToShiftTowards], &orders()[offsetToShiftTowards + sizeToShiftBy], &orders()[orderTableLength()]);
+        std::copy(&orders()[offsetToShiftTowards + sizeToShiftBy], &orders()[orderTableLength()], &orders()[offsetToShiftTowards]);
     }
 
     void shiftOrdersRight(const uint32_t offsetToShiftFrom, const int16_t sizeToShiftBy)
     {
-        std::rotate(&orders()[offsetToShiftFrom], &orders()[orderTableLength()], &orders()[orderTableLength() + sizeToShiftBy]);
+        std::copy_backward(&orders()[offsetToShiftFrom], &orders()[orderTableLength()], &orders()[orderTableLength() + sizeToShiftBy]);
     }
 
     // 0x00470795
@@ -491,27 +493,26 @@ namespace OpenLoco::Vehicles::OrderManager
     // 0x0047062B
     void removeOrdersForStation(const StationId stationId)
     {
-        for (auto i = 0U; i < orderTableLength();)
+        // Walk each vehicle's own orders so a matching order is always deleted from the vehicle
+        // it belongs to, and without searching the vehicle list for every match.
+        for (auto* head : VehicleManager::VehicleList())
         {
-            auto& order = orders()[i];
-            auto* stationOrder = order.as<OrderStation>();
-            if (stationOrder != nullptr)
+            for (uint16_t offset = 0; offset < head->sizeOfOrderTable;)
             {
-                if (stationOrder->getStation() == stationId)
+                auto& order = orders()[head->orderTableOffset + offset];
+                if (order.getType() == OrderType::End)
                 {
-                    // Find the vehicle that has the order
-                    for (auto* head : VehicleManager::VehicleList())
-                    {
-                        if (head->orderTableOffset >= i
-                            && i < head->orderTableOffset + head->sizeOfOrderTable)
-                        {
-                            deleteOrder(head, i);
-                            break;
-                        }
-                    }
+                    break;
+                }
+                auto* stationOrder = order.as<OrderStation>();
+                if (stationOrder != nullptr && stationOrder->getStation() == stationId)
+                {
+                    // The following order now starts at this offset
+                    deleteOrder(head, offset);
+                    continue;
                 }
+                offset += kOrderSizes[enumValue(order.getType())];
             }
-            i += kOrderSizes[enumValue(order.getType())];
         }
     }
 }
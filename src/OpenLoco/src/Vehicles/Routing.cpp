@@ -11,16 +11,19 @@
 #include "Map/Track/TrackData.h"
 #include "Map/Track/TrackModSection.h"
 #include "Map/TrackElement.h"
+#include "Objects/ObjectManager.h"
 #include "Objects/RoadExtraObject.h"
 #include "Objects/RoadObject.h"
 #include "Objects/TrackExtraObject.h"
 #include "Objects/TrackObject.h"
+#include "Objects/TrainSignalObject.h"
 #include "Vehicle.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <sfl/static_vector.hpp>
+#include <unordered_map>
 
 namespace OpenLoco::Vehicles
 {
@@ -194,6 +197,11 @@ namespace OpenLoco::Vehicles
 
     static std::optional<std::pair<World::SignalElement*, World::TrackElement*>> findSignalOnTrack(const World::Pos3& signalLoc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, const uint8_t index)
     {
+        if (!World::TileManager::hasElementType(World::toTileSpace(signalLoc), World::ElementType::signal))
+        {
+            return std::nullopt;
+        }
+
         auto tile = World::TileManager::get(signalLoc);
         for (auto& el : tile)
         {
@@ -255,8 +263,7 @@ namespace OpenLoco::Vehicles
         auto& trackPieces = World::TrackData::getTrackPiece(trackAndDirection.id());
         auto& trackPiece = trackPieces[0];
 
-        auto signalLoc = trackStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ trackPiece.x, trackPiece.y }, trackAndDirection.cardinalDirection()), 0 };
-        signalLoc.z += trackPiece.z;
+        const auto signalLoc = trackStart + World::TrackData::getTrackPieceOffsets(trackAndDirection.id(), trackAndDirection.cardinalDirection())[0];
         auto res = findSignalOnTrack(signalLoc, trackAndDirection, trackType, trackPiece.index);
 
         if (!res)
@@ -304,6 +311,12 @@ namespace OpenLoco::Vehicles
         return ret;
     }
 
+    // Whether the lights of the side are drawn, otherwise changing them leaves the sprite as it was
+    static bool hasSignalLights(const World::SignalElement::Side& side)
+    {
+        return side.hasSignal() && ObjectManager::get<TrainSignalObject>(side.signalObjectId())->hasFlags(TrainSignalObjectFlags::hasLights);
+    }
+
     // 0x0048963F
     void setSignalState(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, uint32_t flags)
     {
@@ -322,10 +335,11 @@ namespace OpenLoco::Vehicles
         }
 
         auto& trackPieces = World::TrackData::getTrackPiece(trackAndDirection.id());
-        for (auto& trackPiece : trackPieces)
+        const auto pieceOffsets = World::TrackData::getTrackPieceOffsets(trackAndDirection.id(), trackAndDirection.cardinalDirection());
+        for (size_t i = 0; i < trackPieces.size(); ++i)
         {
-            auto signalLoc = trackStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ trackPiece.x, trackPiece.y }, trackAndDirection.cardinalDirection()), 0 };
-            signalLoc.z += trackPiece.z;
+            const auto& trackPiece = trackPieces[i];
+            const auto signalLoc = trackStart + pieceOffsets[i];
             auto res = findSignalOnTrack(signalLoc, trackAndDirection, trackType, trackPiece.index);
 
             if (!res)
@@ -338,7 +352,8 @@ namespace OpenLoco::Vehicles
             auto [elSignal, foundTrack] = *res;
 
             // edx
-            auto& signalSide = (flags & (1ULL << 31)) ? elSignal->getRight() : elSignal->getLeft();
+            const bool isRight = flags & (1ULL << 31);
+            auto& signalSide = isRight ? elSignal->getRight() : elSignal->getLeft();
             if (unk1 == 16)
             {
                 uint8_t lightStates = 0;
@@ -361,20 +376,10 @@ namespace OpenLoco::Vehicles
 
                 if (signalSide.allLights() != lightStates)
                 {
-                    bool shouldInvalidate = false;
                     signalSide.setAllLights(lightStates);
-                    if (flags & (1ULL << 31))
-                    {
-                        shouldInvalidate = foundTrack->sequenceIndex() == 0;
-                    }
-                    else
-                    {
-                        shouldInvalidate = foundTrack->isFlag6();
-                    }
-
-                    if (shouldInvalidate)
+                    if (hasSignalLights(signalSide))
                     {
-                        Ui::ViewportManager::invalidate(signalLoc, signalLoc.z, signalLoc.z + 24, ZoomLevel::half);
+                        Ui::ViewportManager::invalidateSignal(signalLoc, *elSignal, isRight);
                     }
                 }
             }
@@ -389,10 +394,14 @@ namespace OpenLoco::Vehicles
             else
             {
                 signalSide.setUnk4(unk1 & 0x3);
-                if ((unk1 & 0x3) == 0)
+                if ((unk1 & 0x3) == 0 && (signalSide.allLights() & 0x3) != 0)
                 {
                     // Clear lights 0b1100_0000
                     signalSide.setAllLights(signalSide.allLights() & 0xC);
+                    if (hasSignalLights(signalSide))
+                    {
+                        Ui::ViewportManager::invalidateSignal(signalLoc, *elSignal, isRight);
+                    }
                 }
                 bool animate = false;
                 if (flags & (1ULL << 31))
@@ -411,8 +420,8 @@ namespace OpenLoco::Vehicles
                 }
                 if (animate)
                 {
+                    // The frame only changes as the animation runs, which invalidates the signal then
                     World::AnimationManager::createAnimation(0, signalLoc, signalLoc.z / 4);
-                    Ui::ViewportManager::invalidate(signalLoc, signalLoc.z, signalLoc.z + 24, ZoomLevel::half);
                 }
             }
         }
@@ -423,6 +432,15 @@ namespace OpenLoco::Vehicles
     // Returns true for signal block end
     static bool findOccupationByBlock(const LocationOfInterest& interest, uint16_t& routingTransformData)
     {
+        const bool isBlockEnd = interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal;
+
+        // The search still has to visit the rest of the block so that all of its signals
+        // are found, but once a vehicle has been found there is no need to look for more.
+        if (routingTransformData != 0)
+        {
+            return isBlockEnd;
+        }
+
         auto nextLoc = interest.loc;
         const auto tad = interest.tad();
         auto& trackSize = World::TrackData::getUnkTrack(tad._data);
@@ -436,10 +454,9 @@ namespace OpenLoco::Vehicles
         backwardTaD.setReversed(!backwardTaD.isReversed());
         const auto startLoc = tad.isReversed() ? nextLoc : interest.loc;
 
-        for (const auto& trackPiece : TrackData::getTrackPiece(tad.id()))
+        for (const auto& pieceOffset : TrackData::getTrackPieceOffsets(tad.id(), tad.cardinalDirection()))
         {
-            const auto rotPos = Math::Vector::rotate(Pos2{ trackPiece.x, trackPiece.y }, tad.cardinalDirection());
-            const auto trackLoc = Pos2{ startLoc } + rotPos;
+            const auto trackLoc = Pos2{ startLoc } + Pos2{ pieceOffset };
 
             for (auto* entity : EntityManager::EntityTileList(trackLoc))
             {
@@ -457,17 +474,17 @@ namespace OpenLoco::Vehicles
                 if (vehicle->getTrackLoc() == interest.loc && vehicle->getTrackAndDirection().track == tad)
                 {
                     routingTransformData = 1;
-                    break;
+                    return isBlockEnd;
                 }
 
                 if (vehicle->getTrackLoc() == nextLoc && vehicle->getTrackAndDirection().track == backwardTaD)
                 {
                     routingTransformData = 1;
-                    break;
+                    return isBlockEnd;
                 }
             }
         }
-        return interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal;
+        return isBlockEnd;
     }
 
     // 0x004A2CE7
@@ -508,6 +525,98 @@ namespace OpenLoco::Vehicles
     // The hash map can have a maximum of 4096 entries so the queue can't be larger than that.
     using LocationOfInterestQueue = sfl::static_vector<LocationOfInterest, 4096>;
 
+    // Connections of the track network only change when a game command modifies the map
+    // so the network searches keep them between calls rather than rescanning the tiles.
+    struct NetworkConnectionKey
+    {
+        World::Pos3 loc;
+        uint8_t rotation;
+        CompanyId company;
+        uint8_t objectId;
+        bool isRoad;
+
+        bool operator==(const NetworkConnectionKey& rhs) const
+        {
+            return loc == rhs.loc && rotation == rhs.rotation && company == rhs.company && objectId == rhs.objectId && isRoad == rhs.isRoad;
+        }
+    };
+
+    struct NetworkConnectionKeyHash
+    {
+        size_t operator()(const NetworkConnectionKey& key) const
+        {
+            uint64_t packed = static_cast<uint16_t>(key.loc.x);
+            packed = (packed << 16) | static_cast<uint16_t>(key.loc.y);
+            packed = (packed << 16) | static_cast<uint16_t>(key.loc.z);
+            packed = (packed << 4) | (key.rotation & 0xF);
+            packed = (packed << 4) | (enumValue(key.company) & 0xF);
+            packed = (packed << 7) | (key.objectId & 0x7F);
+            packed = (packed << 1) | (key.isRoad ? 1 : 0);
+            return std::hash<uint64_t>{}(packed);
+        }
+    };
+
+    using NetworkConnections = sfl::static_vector<uint16_t, 16>;
+
+    // Bounds the memory used by the cache, it is simply dropped and refilled once full.
+    constexpr size_t kMaxCachedNetworkConnections = 0x10000;
+
+    static std::unordered_map<NetworkConnectionKey, NetworkConnections, NetworkConnectionKeyHash> _networkConnections;
+    static uint32_t _networkChangeDepth = 0;
+
+    void invalidateNetworkConnections()
+    {
+        _networkConnections.clear();
+    }
+
+    void beginNetworkChange()
+    {
+        _networkChangeDepth++;
+        invalidateNetworkConnections();
+    }
+
+    void endNetworkChange()
+    {
+        _networkChangeDepth--;
+        invalidateNetworkConnections();
+    }
+
+    template<typename GetConnectionsFunction>
+    static NetworkConnections getCachedConnections(const NetworkConnectionKey& key, GetConnectionsFunction&& getConnections)
+    {
+        // While the map is being modified the cache could go stale mid command.
+        if (_networkChangeDepth != 0)
+        {
+            return getConnections().connections;
+        }
+
+        auto it = _networkConnections.find(key);
+        if (it != _networkConnections.end())
+        {
+            return it->second;
+        }
+
+        if (_networkConnections.size() >= kMaxCachedNetworkConnections)
+        {
+            _networkConnections.clear();
+        }
+        return _networkConnections.emplace(key, getConnections().connections).first->second;
+    }
+
+    static NetworkConnections getCachedTrackConnections(const World::Pos3& loc, const uint8_t rotation, const CompanyId company, const uint8_t trackType)
+    {
+        return getCachedConnections(NetworkConnectionKey{ loc, rotation, company, trackType, false }, [&]() {
+            return World::Track::getTrackConnections(loc, rotation, company, trackType, 0, 0);
+        });
+    }
+
+    static NetworkConnections getCachedRoadConnections(const World::Pos3& loc, const uint8_t rotation, const CompanyId company, const uint8_t roadType)
+    {
+        return getCachedConnections(NetworkConnectionKey{ loc, rotation, company, roadType, true }, [&]() {
+            return World::Track::getRoadConnections(loc, rotation, company, roadType, 0, 0);
+        });
+    }
+
     template<typename FilterFunction>
     static void findAllUsableTrackInNetwork(LocationOfInterestQueue& additionalTrackToCheck, const LocationOfInterest& initialInterest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap);
 
@@ -533,10 +642,13 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        for (auto& piece : World::TrackData::getTrackPiece(tad.id()))
+        const auto& pieces = World::TrackData::getTrackPiece(tad.id());
+        const auto pieceOffsets = World::TrackData::getTrackPieceOffsets(tad.id(), tad.cardinalDirection());
+        for (size_t i = 0; i < pieces.size(); ++i)
         {
+            const auto& piece = pieces[i];
             const auto connectFlags = piece.connectFlags[tad.cardinalDirection()];
-            const auto pieceLoc = nextLoc + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, tad.cardinalDirection()), piece.z };
+            const auto pieceLoc = nextLoc + pieceOffsets[i];
             auto tile = World::TileManager::get(pieceLoc);
             for (auto& el : tile)
             {
@@ -613,11 +725,11 @@ namespace OpenLoco::Vehicles
     static void findAllUsableTrackInNetwork(LocationOfInterestQueue& additionalTrackToCheck, const LocationOfInterest& initialInterest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap)
     {
         const auto [trackEndLoc, trackEndRotation] = World::Track::getTrackConnectionEnd(initialInterest.loc, initialInterest.tad()._data);
-        auto tc = World::Track::getTrackConnections(trackEndLoc, trackEndRotation, initialInterest.company, initialInterest.trackType, 0, 0);
+        const auto connections = getCachedTrackConnections(trackEndLoc, trackEndRotation, initialInterest.company, initialInterest.trackType);
 
-        if (!tc.connections.empty())
+        if (!connections.empty())
         {
-            for (auto c : tc.connections)
+            for (auto c : connections)
             {
                 uint16_t trackAndDirection2 = c & World::Track::AdditionalTaDFlags::basicTaDWithSignalMask;
                 LocationOfInterest interest{ trackEndLoc, trackAndDirection2, initialInterest.company, initialInterest.trackType };
@@ -648,8 +760,8 @@ namespace OpenLoco::Vehicles
             }
 
             const auto rotation = World::kReverseRotation[trackSize.rotationEnd];
-            auto tc2 = World::Track::getTrackConnections(nextLoc, rotation, initialInterest.company, initialInterest.trackType, 0, 0);
-            for (auto c : tc2.connections)
+            const auto connections2 = getCachedTrackConnections(nextLoc, rotation, initialInterest.company, initialInterest.trackType);
+            for (auto c : connections2)
             {
                 uint16_t trackAndDirection2 = c & World::Track::AdditionalTaDFlags::basicTaDWithSignalMask;
                 LocationOfInterest interest{ nextLoc, trackAndDirection2, initialInterest.company, initialInterest.trackType };
@@ -716,10 +828,13 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        for (auto& piece : World::TrackData::getRoadPiece(rad.id()))
+        const auto& pieces = World::TrackData::getRoadPiece(rad.id());
+        const auto pieceOffsets = World::TrackData::getRoadPieceOffsets(rad.id(), rad.cardinalDirection());
+        for (size_t i = 0; i < pieces.size(); ++i)
         {
+            const auto& piece = pieces[i];
             const auto connectFlags = piece.connectFlags[rad.cardinalDirection()];
-            const auto pieceLoc = nextLoc + World::Pos3{ Math::Vector::rotate(World::Pos2{ piece.x, piece.y }, rad.cardinalDirection()), piece.z };
+            const auto pieceLoc = nextLoc + pieceOffsets[i];
             auto tile = World::TileManager::get(pieceLoc);
             for (auto& el : tile)
             {
@@ -796,11 +911,11 @@ namespace OpenLoco::Vehicles
     static void findAllUsableRoadInNetwork(LocationOfInterestQueue& additionalRoadToCheck, const LocationOfInterest& initialInterest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap)
     {
         const auto [roadEndLoc, roadEndRotation] = World::Track::getRoadConnectionEnd(initialInterest.loc, initialInterest.rad()._data);
-        auto tc = World::Track::getRoadConnections(roadEndLoc, roadEndRotation, initialInterest.company, initialInterest.trackType, 0, 0);
+        const auto connections = getCachedRoadConnections(roadEndLoc, roadEndRotation, initialInterest.company, initialInterest.trackType);
 
-        if (!tc.connections.empty())
+        if (!connections.empty())
         {
-            for (auto c : tc.connections)
+            for (auto c : connections)
             {
                 uint16_t trackAndDirection2 = c & World::Track::AdditionalTaDFlags::basicRaDWithSignalMask;
                 LocationOfInterest interest{ roadEndLoc, trackAndDirection2, initialInterest.company, initialInterest.trackType };
@@ -831,8 +946,8 @@ namespace OpenLoco::Vehicles
             }
 
             const auto rotation = World::kReverseRotation[roadSize.rotationEnd];
-            auto tc2 = World::Track::getRoadConnections(nextLoc, rotation, initialInterest.company, initialInterest.trackType, 0, 0);
-            for (auto c : tc2.connections)
+            const auto connections2 = getCachedRoadConnections(nextLoc, rotation, initialInterest.company, initialInterest.trackType);
+            for (auto c : connections2)
             {
                 uint16_t trackAndDirection2 = c & World::Track::AdditionalTaDFlags::basicRaDWithSignalMask;
                 LocationOfInterest interest{ nextLoc, trackAndDirection2, initialInterest.company, initialInterest.trackType };
@@ -897,7 +1012,8 @@ namespace OpenLoco::Vehicles
         // 0x001135F88
         uint16_t routingTransformData = 0;
 
-        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
+        // Only the answer is needed here so stop expanding the search as soon as a vehicle has been found.
+        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData) || routingTransformData != 0; };
 
         LocationOfInterestHashMap interestMap{ kSignalHashMapSize };
 
@@ -1069,10 +1185,12 @@ namespace OpenLoco::Vehicles
                 }
             }
 
-            for (auto& trackPiece : TrackData::getTrackPiece(tad.id()))
+            const auto& trackPieces = TrackData::getTrackPiece(tad.id());
+            const auto pieceOffsets = TrackData::getTrackPieceOffsets(tad.id(), tad.cardinalDirection());
+            for (size_t i = 0; i < trackPieces.size(); ++i)
             {
-                auto trackLoc = trackStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ trackPiece.x, trackPiece.y }, tad.cardinalDirection()), 0 };
-                trackLoc.z += trackPiece.z;
+                const auto& trackPiece = trackPieces[i];
+                const auto trackLoc = trackStart + pieceOffsets[i];
 
                 auto tile = TileManager::get(trackLoc);
                 World::TrackElement* elTrack = nullptr;
@@ -1210,10 +1328,12 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        for (auto& trackPiece : TrackData::getTrackPiece(tad.id()))
+        const auto& trackPieces = TrackData::getTrackPiece(tad.id());
+        const auto pieceOffsets = TrackData::getTrackPieceOffsets(tad.id(), tad.cardinalDirection());
+        for (size_t i = 0; i < trackPieces.size(); ++i)
         {
-            auto trackLoc = trackStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ trackPiece.x, trackPiece.y }, tad.cardinalDirection()), 0 };
-            trackLoc.z += trackPiece.z;
+            const auto& trackPiece = trackPieces[i];
+            const auto trackLoc = trackStart + pieceOffsets[i];
 
             auto tile = TileManager::get(trackLoc);
             World::TrackElement* elTrack = nullptr;
@@ -1411,10 +1531,12 @@ namespace OpenLoco::Vehicles
                 }
             }
 
-            for (auto& roadPiece : TrackData::getRoadPiece(rad.id()))
+            const auto& roadPieces = TrackData::getRoadPiece(rad.id());
+            const auto pieceOffsets = TrackData::getRoadPieceOffsets(rad.id(), rad.cardinalDirection());
+            for (size_t i = 0; i < roadPieces.size(); ++i)
             {
-                auto roadLoc = roadStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ roadPiece.x, roadPiece.y }, rad.cardinalDirection()), 0 };
-                roadLoc.z += roadPiece.z;
+                const auto& roadPiece = roadPieces[i];
+                const auto roadLoc = roadStart + pieceOffsets[i];
 
                 auto tile = TileManager::get(roadLoc);
                 World::RoadElement* elRoad = nullptr;
@@ -1576,10 +1698,12 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        for (auto& roadPiece : TrackData::getRoadPiece(rad.id()))
+        const auto& roadPieces = TrackData::getRoadPiece(rad.id());
+        const auto pieceOffsets = TrackData::getRoadPieceOffsets(rad.id(), rad.cardinalDirection());
+        for (size_t i = 0; i < roadPieces.size(); ++i)
         {
-            auto roadLoc = roadStart + World::Pos3{ Math::Vector::rotate(World::Pos2{ roadPiece.x, roadPiece.y }, rad.cardinalDirection()), 0 };
-            roadLoc.z += roadPiece.z;
+            const auto& roadPiece = roadPieces[i];
+            const auto roadLoc = roadStart + pieceOffsets[i];
 
             auto tile = TileManager::get(roadLoc);
             World::RoadElement* elRoad = nullptr;
@@ -1,20 +1,52 @@
 #include "RoutingManager.h"
 #include "GameState.h"
 #include <algorithm>
+#include <array>
+#include <bit>
 
 namespace OpenLoco::Vehicles::RoutingManager
 {
     static auto& routings() { return getGameState().routings; }
 
-    static std::optional<uint16_t> findFreeRoutingVehicleRef()
+    // One bit per vehicle ref that is set while its routing array is unallocated. Mirrors
+    // routings()[ref][0] == kRoutingNull so finding a free ref doesn't have to scan the table.
+    static constexpr size_t kFreeSlotWordBits = 64;
+    static std::array<uint64_t, (Limits::kMaxVehicles + kFreeSlotWordBits - 1) / kFreeSlotWordBits> _freeRoutingSlots{};
+
+    static void setRoutingSlotFree(const uint16_t vehicleRef, const bool isFree)
+    {
+        const auto mask = 1ULL << (vehicleRef % kFreeSlotWordBits);
+        if (isFree)
+        {
+            _freeRoutingSlots[vehicleRef / kFreeSlotWordBits] |= mask;
+        }
+        else
+        {
+            _freeRoutingSlots[vehicleRef / kFreeSlotWordBits] &= ~mask;
+        }
+    }
+
+    void updateFreeRoutingSlots()
     {
+        _freeRoutingSlots.fill(0);
         const auto& routingArr = routings();
-        const auto res = std::find_if(std::begin(routingArr), std::end(routingArr), [](const auto& route) { return route[0] == kRoutingNull; });
-        if (res == std::end(routingArr))
+        for (uint16_t i = 0; i < Limits::kMaxVehicles; ++i)
+        {
+            setRoutingSlotFree(i, routingArr[i][0] == kRoutingNull);
+        }
+    }
+
+    static std::optional<uint16_t> findFreeRoutingVehicleRef()
+    {
+        // Lowest ref first to allocate exactly as the original linear search did.
+        for (size_t word = 0; word < _freeRoutingSlots.size(); ++word)
         {
-            return std::nullopt;
+            if (_freeRoutingSlots[word] != 0)
+            {
+                return static_cast<uint16_t>(word * kFreeSlotWordBits + std::countr_zero(_freeRoutingSlots[word]));
+            }
         }
-        return std::distance(std::begin(routingArr), res);
+        return std::nullopt;
     }
 
     void resetRoutings(const RoutingHandle handle)
@@ -36,6 +68,7 @@ namespace OpenLoco::Vehicles::RoutingManager
         {
             auto& vehRoutingArr = routings()[*vehicleRef];
             std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRoutingStation);
+            setRoutingSlotFree(*vehicleRef, false);
             return { RoutingHandle(*vehicleRef, 0) };
         }
         return std::nullopt;
@@ -61,12 +94,14 @@ namespace OpenLoco::Vehicles::RoutingManager
     {
         auto& vehRoutingArr = routings()[handle.getVehicleRef()];
         std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kRoutingNull);
+        setRoutingSlotFree(handle.getVehicleRef(), true);
     }
 
     // 0x004A8810
     void resetRoutingTable()
     {
         std::fill_n(&routings()[0][0], Limits::kMaxVehicles * Limits::kMaxRoutingsPerVehicle, kRoutingNull);
+        updateFreeRoutingSlots();
     }
 
     RingView::Iterator::Iterator(const RoutingHandle& begin, bool isEnd, Direction direction)
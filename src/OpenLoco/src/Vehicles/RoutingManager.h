@@ -22,6 +22,8 @@ namespace OpenLoco::Vehicles::RoutingManager
     void resetRoutings(const RoutingHandle handle);
     bool isEmptyRoutingSlotAvailable();
     void resetRoutingTable();
+    // Must be called whenever the routing table is replaced, e.g. after loading a game.
+    void updateFreeRoutingSlots();
 
     struct RingView
     {
@@ -17,14 +17,16 @@
 #include "ViewportManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <utility>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
 namespace OpenLoco::Vehicles
 {
+    static UpdateContext _fallbackUpdateContext;
+    static UpdateContext* _updateContext = &_fallbackUpdateContext;
 
-    static UpdateVar1136114Flags _vehicleUpdate_var_1136114 = 0; // Was loco_global at 0x01136114
-    static EntityId _vehicleUpdate_collisionCarComponent = 0; // Was loco_global at 0x0113610E
     static constexpr int32_t kObjDistToHighPrecisionDistance = 2179;
 
 #pragma pack(push, 1)
@@ -380,19 +382,32 @@ namespace OpenLoco::Vehicles
         return false;
     }
 
-    // 0x004B1876
-    EntityId checkForCollisions(VehicleBogie& bogie, World::Pos3& loc)
+    // The vehicles a bogie could collide with on and around a tile. Nothing but the bogie being
+    // updated moves while it works through its sub positions, so the vehicles filtered on the
+    // criteria that don't depend on position are gathered once per tile rather than once per step.
+    struct CollisionCandidates
     {
-        if (bogie.mode != TransportMode::rail)
-        {
-            return EntityId::null;
-        }
+        const VehicleBogie* bogie = nullptr;
+        World::TilePos2 tile{};
+        std::vector<VehicleBase*> vehicles;
+    };
+    static CollisionCandidates _collisionCandidates;
+
+    static void invalidateCollisionCandidates()
+    {
+        _collisionCandidates.bogie = nullptr;
+    }
 
-        Vehicle srcTrain(bogie.head);
+    static void gatherCollisionCandidates(const VehicleBogie& bogie, const World::TilePos2& tile)
+    {
+        _collisionCandidates.bogie = &bogie;
+        _collisionCandidates.tile = tile;
+        _collisionCandidates.vehicles.clear();
 
+        // Kept in the order vanilla visits them so the first collision found is the same
         for (const auto& nearby : kMooreNeighbourhood)
         {
-            const auto inspectionPos = World::toTileSpace(loc) + nearby;
+            const auto inspectionPos = tile + nearby;
             for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(inspectionPos)))
             {
                 auto* vehicleBase = entity->asBase<VehicleBase>();
@@ -405,19 +420,6 @@ namespace OpenLoco::Vehicles
                     continue;
                 }
 
-                const auto zDiff = std::abs(loc.z - vehicleBase->position.z);
-                if (zDiff > 16)
-                {
-                    continue;
-                }
-
-                // vanilla did some overflow checks here but since we promote to int it shouldn't be needed
-                const auto distance = Math::Vector::manhattanDistance2D(vehicleBase->position, loc);
-                if (distance >= 12)
-                {
-                    continue;
-                }
-
                 const auto subType = vehicleBase->getSubType();
                 // Does it actually have a collidable body
                 if (subType != VehicleEntityType::body_continued && subType != VehicleEntityType::body_start && subType != VehicleEntityType::bogie)
@@ -429,27 +431,65 @@ namespace OpenLoco::Vehicles
                 {
                     continue;
                 }
+                _collisionCandidates.vehicles.push_back(vehicleBase);
+            }
+        }
+    }
 
-                // This is an optimisation compared to vanilla
-                if (vehicleBase->getHead() != bogie.head)
-                {
-                    return vehicleBase->id;
-                }
+    static EntityId findCollision(VehicleBogie& bogie, const World::Pos3& loc)
+    {
+        if (bogie.mode != TransportMode::rail)
+        {
+            return EntityId::null;
+        }
 
-                if (ignoreSelfCollision(bogie, *vehicleBase))
-                {
-                    continue;
-                }
-                if (ignoreSelfCollision(*vehicleBase, bogie))
-                {
-                    continue;
-                }
+        const auto tile = World::toTileSpace(loc);
+        if (_collisionCandidates.bogie != &bogie || _collisionCandidates.tile != tile)
+        {
+            gatherCollisionCandidates(bogie, tile);
+        }
+
+        for (auto* vehicleBase : _collisionCandidates.vehicles)
+        {
+            const auto zDiff = std::abs(loc.z - vehicleBase->position.z);
+            if (zDiff > 16)
+            {
+                continue;
+            }
+
+            // vanilla did some overflow checks here but since we promote to int it shouldn't be needed
+            const auto distance = Math::Vector::manhattanDistance2D(vehicleBase->position, loc);
+            if (distance >= 12)
+            {
+                continue;
+            }
+
+            // This is an optimisation compared to vanilla
+            if (vehicleBase->getHead() != bogie.head)
+            {
                 return vehicleBase->id;
             }
+
+            if (ignoreSelfCollision(bogie, *vehicleBase))
+            {
+                continue;
+            }
+            if (ignoreSelfCollision(*vehicleBase, bogie))
+            {
+                continue;
+            }
+            return vehicleBase->id;
         }
         return EntityId::null;
     }
 
+    // 0x004B1876
+    EntityId checkForCollisions(VehicleBogie& bogie, World::Pos3& loc)
+    {
+        invalidateCollisionCandidates();
+        return findCollision(bogie, loc);
+    }
+
     // 0x0047C7FA
     static int32_t updateRoadMotion(VehicleCommon& component, int32_t distance)
     {
@@ -457,13 +497,15 @@ namespace OpenLoco::Vehicles
         bool hasMoved = false;
         auto returnValue = 0;
         auto intermediatePosition = component.position;
+        // The sub positions and origin only change when moving onto a new road piece so look them up once per piece.
+        auto subPositions = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data);
+        auto pieceOrigin = World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
         while (component.remainingDistance >= 0x368A)
         {
             hasMoved = true;
             auto newSubPosition = component.subPosition + 1U;
-            const auto subPositionDataSize = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data).size();
             // This means we have moved forward by a road piece
-            if (newSubPosition >= subPositionDataSize)
+            if (newSubPosition >= subPositions.size())
             {
                 if (!updateRoadMotionNewRoadPiece(component))
                 {
@@ -475,12 +517,14 @@ namespace OpenLoco::Vehicles
                 else
                 {
                     newSubPosition = 0;
+                    subPositions = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data);
+                    pieceOrigin = World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
                 }
             }
             // 0x0047C95B
             component.subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data)[newSubPosition];
-            const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
+            const auto& moveData = subPositions[newSubPosition];
+            const auto nextNewPosition = moveData.loc + pieceOrigin;
             component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
             component.spriteYaw = moveData.yaw;
@@ -488,11 +532,11 @@ namespace OpenLoco::Vehicles
             if (component.isVehicleBogie())
             {
                 // collision checks
-                auto collideResult = checkForCollisions(*component.asVehicleBogie(), intermediatePosition);
+                auto collideResult = findCollision(*component.asVehicleBogie(), intermediatePosition);
                 if (collideResult != EntityId::null)
                 {
                     setUpdateVar1136114Flags(UpdateVar1136114Flags::crashed);
-                    _vehicleUpdate_collisionCarComponent = collideResult;
+                    getUpdateContext().collisionCarComponent = collideResult;
                 }
             }
         }
@@ -513,17 +557,20 @@ namespace OpenLoco::Vehicles
         }
         else if (component.mode == TransportMode::rail)
         {
+            invalidateCollisionCandidates();
             component.remainingDistance += distance;
             bool hasMoved = false;
             auto returnValue = 0;
             auto intermediatePosition = component.position;
+            // The sub positions and origin only change when moving onto a new track piece so look them up once per piece.
+            auto subPositions = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data);
+            auto pieceOrigin = World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
             while (component.remainingDistance >= 0x368A)
             {
                 hasMoved = true;
                 auto newSubPosition = component.subPosition + 1U;
-                const auto subPositionDataSize = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data).size();
                 // This means we have moved forward by a track piece
-                if (newSubPosition >= subPositionDataSize)
+                if (newSubPosition >= subPositions.size())
                 {
                     if (!updateTrackMotionNewTrackPiece(component))
                     {
@@ -535,12 +582,14 @@ namespace OpenLoco::Vehicles
                     else
                     {
                         newSubPosition = 0;
+                        subPositions = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data);
+                        pieceOrigin = World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
                     }
                 }
                 // 0x004B1761
                 component.subPosition = newSubPosition;
-                const auto& moveData = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data)[newSubPosition];
-                const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
+                const auto& moveData = subPositions[newSubPosition];
+                const auto nextNewPosition = moveData.loc + pieceOrigin;
                 component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
                 intermediatePosition = nextNewPosition;
                 component.spriteYaw = moveData.yaw;
@@ -548,11 +597,11 @@ namespace OpenLoco::Vehicles
                 if (component.isVehicleBogie())
                 {
                     // collision checks
-                    auto collideResult = checkForCollisions(*component.asVehicleBogie(), intermediatePosition);
+                    auto collideResult = findCollision(*component.asVehicleBogie(), intermediatePosition);
                     if (collideResult != EntityId::null)
                     {
                         setUpdateVar1136114Flags(UpdateVar1136114Flags::crashed);
-                        _vehicleUpdate_collisionCarComponent = collideResult;
+                        getUpdateContext().collisionCarComponent = collideResult;
                     }
                 }
             }
@@ -1075,18 +1124,33 @@ namespace OpenLoco::Vehicles
 
     bool hasUpdateVar1136114Flags(UpdateVar1136114Flags flags)
     {
-        return (_vehicleUpdate_var_1136114 & flags) != UpdateVar1136114Flags::none;
+        return (getUpdateContext().var_1136114 & flags) != UpdateVar1136114Flags::none;
     }
     void resetUpdateVar1136114Flags()
     {
-        _vehicleUpdate_var_1136114 = UpdateVar1136114Flags::none;
+        getUpdateContext().var_1136114 = UpdateVar1136114Flags::none;
     }
     void setUpdateVar1136114Flags(UpdateVar1136114Flags flags)
     {
-        _vehicleUpdate_var_1136114 |= flags;
+        getUpdateContext().var_1136114 |= flags;
     }
     void unsetUpdateVar1136114Flags(UpdateVar1136114Flags flags)
     {
-        _vehicleUpdate_var_1136114 &= ~flags;
+        getUpdateContext().var_1136114 &= ~flags;
+    }
+
+    UpdateContext& getUpdateContext()
+    {
+        return *_updateContext;
+    }
+
+    ScopedUpdateContext::ScopedUpdateContext()
+        : _previous(std::exchange(_updateContext, &_context))
+    {
+    }
+
+    ScopedUpdateContext::~ScopedUpdateContext()
+    {
+        _updateContext = _previous;
     }
 }
@@ -130,6 +130,47 @@ namespace OpenLoco::Vehicles
 
     struct VehicleSoundPlayer;
 
+    // Working state of the train being updated that the updates of its components hand to each
+    // other. Every train update gets its own, code that moves a train outside of one shares a
+    // fallback context.
+    struct UpdateContext
+    {
+        VehicleHead* head = nullptr;                                                         // 0x01136118
+        Vehicle1* veh1 = nullptr;                                                            // 0x0113611C
+        Vehicle2* veh2 = nullptr;                                                            // 0x01136120
+        VehicleBogie* frontBogie = nullptr;                                                  // 0x01136124
+        VehicleBogie* backBogie = nullptr;                                                   // 0x01136128
+        bool frontBogieHasMoved = false;                                                     // 0x01136237
+        bool backBogieHasMoved = false;                                                      // 0x01136238
+        int32_t var_113612C = 0;                                                             // 0x0113612C
+        int32_t var_1136130 = 0;                                                             // 0x01136130
+        Speed32 var_1136134 = Speed32(0);                                                    // 0x01136134
+        UpdateVar1136114Flags var_1136114 = UpdateVar1136114Flags::none;                     // 0x01136114
+        EntityId collisionCarComponent = EntityId::null;                                     // 0x0113610E
+        uint32_t manhattanDistanceToStation = 0;                                             // 0x011360D0
+        int16_t targetZ = 0;                                                                 // 0x01136168
+        Status initialStatus = Status::unk_0;                                                // 0x0113646C
+        uint8_t helicopterTargetYaw = 0;                                                     // 0x0113646D
+        AirportMovementNodeFlags helicopterAirportMovement = AirportMovementNodeFlags::none; // 0x00525BB0
+        uint32_t compatibleRoadStationTypes = 0;                                             // 0x0112C30C
+    };
+
+    UpdateContext& getUpdateContext();
+
+    // Gives the update of one train a fresh context for as long as it is in scope.
+    class ScopedUpdateContext
+    {
+    private:
+        UpdateContext _context;
+        UpdateContext* _previous;
+
+    public:
+        ScopedUpdateContext();
+        ~ScopedUpdateContext();
+        ScopedUpdateContext(const ScopedUpdateContext&) = delete;
+        ScopedUpdateContext& operator=(const ScopedUpdateContext&) = delete;
+    };
+
     enum class BreakdownFlags : uint8_t
     {
         none = 0U,
@@ -275,6 +316,11 @@ namespace OpenLoco::Vehicles
 
     void setSignalState(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, uint32_t flags);
     SignalStateFlags getSignalState(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, uint32_t flags);
+    // The track and road network searches cache tile connections. Anything that modifies the map
+    // outside of a game command has to invalidate them, game commands are handled by begin/endNetworkChange.
+    void invalidateNetworkConnections();
+    void beginNetworkChange();
+    void endNetworkChange();
     void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
     void setReverseSignalOccupiedInBlock(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
     bool isBlockOccupied(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
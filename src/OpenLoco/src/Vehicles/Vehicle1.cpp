@@ -17,8 +17,6 @@ using namespace OpenLoco::Literals;
 
 namespace OpenLoco::Vehicles
 {
-    static int32_t _vehicleUpdate_var_113612C = 0; // Was loco_global at 0x0113612C
-    static Speed32 _vehicleUpdate_var_1136134 = {}; // Was loco_global at 0x01136134
 
     // If distance travelled in one tick this is the speed
     constexpr Speed32 speedFromDistanceInATick(int32_t distance)
@@ -112,9 +110,9 @@ namespace OpenLoco::Vehicles
         }
         targetSpeed = newTargetSpeed;
 
-        _vehicleUpdate_var_1136134 = newTargetSpeed;
+        getUpdateContext().var_1136134 = newTargetSpeed;
         int32_t distance1 = distanceTraveledInATick(train.veh2->currentSpeed) - var_3C;
-        const auto unk2 = std::max(_vehicleUpdate_var_113612C * 4, 0xCC48);
+        const auto unk2 = std::max(getUpdateContext().var_113612C * 4, 0xCC48);
 
         distance1 = std::min(distance1, unk2);
         var_3C += distance1 - updateRoadMotion(distance1);
@@ -222,9 +220,9 @@ namespace OpenLoco::Vehicles
         }
         targetSpeed = newTargetSpeed;
 
-        _vehicleUpdate_var_1136134 = newTargetSpeed;
+        getUpdateContext().var_1136134 = newTargetSpeed;
         int32_t distance1 = distanceTraveledInATick(train.veh2->currentSpeed) - var_3C;
-        const auto unk2 = std::max(_vehicleUpdate_var_113612C * 4, 0xCC48);
+        const auto unk2 = std::max(getUpdateContext().var_113612C * 4, 0xCC48);
 
         distance1 = std::min(distance1, unk2);
         resetUpdateVar1136114Flags();
@@ -300,17 +298,19 @@ namespace OpenLoco::Vehicles
                     continue;
                 }
 
-                // Perhaps a little expensive to do this (we don't do it on rail vehicles for example)
-                Vehicle train(vehicleTail->head);
-                if (train.veh1->var_3C < 0x220C0)
+                // Only the first components are needed, building a Vehicle would walk every car
+                auto* otherHead = EntityManager::get<VehicleHead>(vehicleTail->head);
+                auto* otherVeh1 = otherHead->nextVehicleComponent()->asVehicle1();
+                auto* otherVeh2 = otherVeh1->nextVehicleComponent()->asVehicle2();
+                if (otherVeh1->var_3C < 0x220C0)
                 {
                     continue;
                 }
-                if ((train.veh2->var_73 & Flags73::isBrokenDown) != Flags73::none)
+                if ((otherVeh2->var_73 & Flags73::isBrokenDown) != Flags73::none)
                 {
                     continue;
                 }
-                if (veh1.var_3C < train.veh1->var_3C)
+                if (veh1.var_3C < otherVeh1->var_3C)
                 {
                     return OvertakeResult::mayBeOvertaken;
                 }
@@ -319,7 +319,7 @@ namespace OpenLoco::Vehicles
                 {
                     continue;
                 }
-                if (veh2->maxSpeed <= train.veh2->maxSpeed)
+                if (veh2->maxSpeed <= otherVeh2->maxSpeed)
                 {
                     return OvertakeResult::mayBeOvertaken;
                 }
@@ -12,10 +12,6 @@ using namespace OpenLoco::Literals;
 
 namespace OpenLoco::Vehicles
 {
-    static int32_t _vehicleUpdate_var_113612C = 0; // Was loco_global at 0x0113612C
-    static int32_t _vehicleUpdate_var_1136130 = 0; // Was loco_global at 0x01136130
-    static Speed32 _vehicleUpdate_var_1136134 = {}; // Was loco_global at 0x01136134
-    static VehicleHead* _vehicleUpdate_head = nullptr; // Was loco_global at 0x01136118
 
     constexpr const uint8_t kBrakeLightTimeout = 7;
 
@@ -132,16 +128,16 @@ namespace OpenLoco::Vehicles
         }
 
         motorState = MotorState::accelerating;
-        const auto speedDiff = currentSpeed - _vehicleUpdate_var_1136134;
+        const auto speedDiff = currentSpeed - getUpdateContext().var_1136134;
         if (speedDiff > 0.0_mph)
         {
             motorState = MotorState::braking;
             const auto newSpeed = currentSpeed - (currentSpeed / 64 + 0.18311_mph);
-            currentSpeed = std::max(newSpeed, std::max(_vehicleUpdate_var_1136134, 5.0_mph));
+            currentSpeed = std::max(newSpeed, std::max(getUpdateContext().var_1136134, 5.0_mph));
             return sub_4A9F20();
         }
 
-        if (!(_vehicleUpdate_head)->hasVehicleFlags(VehicleFlags::manualControl))
+        if (!(getUpdateContext().head)->hasVehicleFlags(VehicleFlags::manualControl))
         {
             if (speedDiff >= -1.5_mph)
             {
@@ -274,11 +270,11 @@ namespace OpenLoco::Vehicles
             // to behave similar we always take the vehicleUpdate_var_1136134 on negative speed
             if (newSpeed < 0.0_mph)
             {
-                newSpeed = _vehicleUpdate_var_1136134;
+                newSpeed = getUpdateContext().var_1136134;
             }
             else
             {
-                newSpeed = std::min(newSpeed, _vehicleUpdate_var_1136134);
+                newSpeed = std::min(newSpeed, getUpdateContext().var_1136134);
             }
         }
         currentSpeed = newSpeed;
@@ -293,9 +289,9 @@ namespace OpenLoco::Vehicles
 
         resetUpdateVar1136114Flags();
         setUpdateVar1136114Flags(UpdateVar1136114Flags::unk_m15);
-        auto res = updateTrackMotion(_vehicleUpdate_var_113612C);
-        _vehicleUpdate_var_113612C = _vehicleUpdate_var_113612C - res;
-        _vehicleUpdate_var_1136130 = _vehicleUpdate_var_1136130 - res;
+        auto res = updateTrackMotion(getUpdateContext().var_113612C);
+        getUpdateContext().var_113612C = getUpdateContext().var_113612C - res;
+        getUpdateContext().var_1136130 = getUpdateContext().var_1136130 - res;
         if (hasUpdateVar1136114Flags(UpdateVar1136114Flags::noRouteFound))
         {
             destroyTrain();
@@ -313,11 +309,11 @@ namespace OpenLoco::Vehicles
 
         if (motorState == MotorState::stoppedOnIncline)
         {
-            _vehicleUpdate_var_1136130 = _vehicleUpdate_var_113612C + 0x1388;
+            getUpdateContext().var_1136130 = getUpdateContext().var_113612C + 0x1388;
         }
 
-        train.head->var_3C -= _vehicleUpdate_var_113612C;
-        train.veh1->var_3C -= _vehicleUpdate_var_113612C;
+        train.head->var_3C -= getUpdateContext().var_113612C;
+        train.veh1->var_3C -= getUpdateContext().var_113612C;
 
         if (motorState == MotorState::braking)
         {
@@ -25,13 +25,6 @@ using namespace OpenLoco::Literals;
 namespace OpenLoco::Vehicles
 {
 
-    static VehicleHead* _vehicleUpdate_head = nullptr; // Was loco_global at 0x01136118
-    static Vehicle2* _vehicleUpdate_2 = nullptr; // Was loco_global at 0x01136120
-    static VehicleBogie* _vehicleUpdate_frontBogie = nullptr; // Was loco_global at 0x01136124
-    static VehicleBogie* _vehicleUpdate_backBogie = nullptr; // Was loco_global at 0x01136128
-    static int32_t _vehicleUpdate_var_1136130 = 0; // Was loco_global at 0x01136130
-    static bool _vehicleUpdate_frontBogieHasMoved = false; // Was loco_global at 0x01136237
-    static bool _vehicleUpdate_backBogieHasMoved = false; // Was loco_global at 0x01136238
     static std::array<int8_t, 88> _vehicle_arr_4F865C = {}; // Was loco_global at 0x004F865C
 
     // 0x00503E5C
@@ -62,13 +55,13 @@ namespace OpenLoco::Vehicles
             return true;
         }
 
-        if (_vehicleUpdate_frontBogieHasMoved || _vehicleUpdate_backBogieHasMoved)
+        if (getUpdateContext().frontBogieHasMoved || getUpdateContext().backBogieHasMoved)
         {
             invalidateSprite();
-            sub_4AC255(_vehicleUpdate_backBogie, _vehicleUpdate_frontBogie);
+            sub_4AC255(getUpdateContext().backBogie, getUpdateContext().frontBogie);
             invalidateSprite();
         }
-        uint32_t backup1136130 = _vehicleUpdate_var_1136130;
+        uint32_t backup1136130 = getUpdateContext().var_1136130;
         if (wheelSlipping != 0)
         {
             int32_t var_1136130 = wheelSlipping;
@@ -77,11 +70,11 @@ namespace OpenLoco::Vehicles
                 var_1136130 = kWheelSlippingDuration - var_1136130;
             }
 
-            _vehicleUpdate_var_1136130 += var_1136130 * 320 + 500;
+            getUpdateContext().var_1136130 += var_1136130 * 320 + 500;
         }
         animationUpdate();
         sub_4AAB0B();
-        _vehicleUpdate_var_1136130 = backup1136130;
+        getUpdateContext().var_1136130 = backup1136130;
         return true;
     }
 
@@ -93,7 +86,7 @@ namespace OpenLoco::Vehicles
             return;
         }
 
-        VehicleHead* headVeh = _vehicleUpdate_head;
+        VehicleHead* headVeh = getUpdateContext().head;
         if ((headVeh->status == Status::crashed) || (headVeh->status == Status::stuck))
         {
             return;
@@ -143,14 +136,14 @@ namespace OpenLoco::Vehicles
     void VehicleBody::updateSegmentCrashed()
     {
         invalidateSprite();
-        sub_4AC255(_vehicleUpdate_backBogie, _vehicleUpdate_frontBogie);
+        sub_4AC255(getUpdateContext().backBogie, getUpdateContext().frontBogie);
         invalidateSprite();
         animationUpdate();
         sub_4AAB0B();
         if (!hasVehicleFlags(VehicleFlags::unk_5))
         {
-            VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-            VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+            VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+            VehicleBogie* backBogie = getUpdateContext().backBogie;
 
             if (frontBogie->hasVehicleFlags(VehicleFlags::unk_5)
                 || backBogie->hasVehicleFlags(VehicleFlags::unk_5))
@@ -164,7 +157,7 @@ namespace OpenLoco::Vehicles
     // 0x004AAB0B
     void VehicleBody::sub_4AAB0B()
     {
-        int32_t eax = _vehicleUpdate_var_1136130 >> 3;
+        int32_t eax = getUpdateContext().var_1136130 >> 3;
         if (has38Flags(Flags38::isReversed))
         {
             eax = -eax;
@@ -180,14 +173,14 @@ namespace OpenLoco::Vehicles
         uint8_t targetAnimationFrame = 0;
         if (vehicleObj->bodySprites[objectSpriteType].hasFlags(BodySpriteFlags::hasSpeedAnimation))
         {
-            Vehicle2* veh3 = _vehicleUpdate_2;
+            Vehicle2* veh3 = getUpdateContext().veh2;
             targetAnimationFrame = veh3->currentSpeed / (vehicleObj->speed / vehicleObj->bodySprites[objectSpriteType].numAnimationFrames);
             targetAnimationFrame = std::min<uint8_t>(targetAnimationFrame, vehicleObj->bodySprites[objectSpriteType].numAnimationFrames - 1);
         }
         else if (vehicleObj->bodySprites[objectSpriteType].numRollFrames != 1)
         {
-            VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-            Vehicle2* veh3 = _vehicleUpdate_2;
+            VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+            Vehicle2* veh3 = getUpdateContext().veh2;
             targetAnimationFrame = animationFrame;
             int8_t targetTiltFrame = 0;
             if (veh3->currentSpeed < 35.0_mph)
@@ -937,14 +930,14 @@ namespace OpenLoco::Vehicles
     void VehicleBody::steamPuffsAnimationUpdate(uint8_t num, int32_t emitterHorizontalPos)
     {
         const auto* vehicleObject = getObject();
-        VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+        VehicleBogie* backBogie = getUpdateContext().backBogie;
         if (frontBogie->hasBreakdownFlags(BreakdownFlags::brokenDown))
         {
             return;
         }
 
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         bool soundCode = false;
         if (veh_2->motorState == MotorState::accelerating || veh_2->motorState == MotorState::stoppedOnIncline)
         {
@@ -973,7 +966,7 @@ namespace OpenLoco::Vehicles
         }
         else
         {
-            if (_vehicleUpdate_var_1136130 + (uint16_t)(_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+            if (getUpdateContext().var_1136130 + (uint16_t)(_var_44 * 8) < std::numeric_limits<uint16_t>::max())
             {
                 return;
             }
@@ -1098,15 +1091,15 @@ namespace OpenLoco::Vehicles
     // 0x004AB9DD & 0x004AAFFA
     void VehicleBody::dieselExhaust1AnimationUpdate(uint8_t num, int32_t emitterHorizontalPos)
     {
-        VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+        VehicleBogie* backBogie = getUpdateContext().backBogie;
         if (frontBogie->hasBreakdownFlags(BreakdownFlags::brokenDown))
         {
             return;
         }
 
-        VehicleHead* headVeh = _vehicleUpdate_head;
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        VehicleHead* headVeh = getUpdateContext().head;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         const auto* vehicleObject = getObject();
 
         if (headVeh->vehicleType == VehicleType::ship)
@@ -1168,14 +1161,14 @@ namespace OpenLoco::Vehicles
     // 0x004ABB5A & 0x004AB177
     void VehicleBody::dieselExhaust2AnimationUpdate(uint8_t num, int32_t emitterHorizontalPos)
     {
-        VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+        VehicleBogie* backBogie = getUpdateContext().backBogie;
         if (frontBogie->hasBreakdownFlags(BreakdownFlags::brokenDown))
         {
             return;
         }
 
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         const auto* vehicleObject = getObject();
 
         if (veh_2->motorState != MotorState::accelerating)
@@ -1224,14 +1217,14 @@ namespace OpenLoco::Vehicles
     // 0x004ABDAD & 0x004AB3CA
     void VehicleBody::electricSpark1AnimationUpdate(uint8_t num, int32_t emitterHorizontalPos)
     {
-        VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+        VehicleBogie* backBogie = getUpdateContext().backBogie;
         if (frontBogie->hasBreakdownFlags(BreakdownFlags::brokenDown))
         {
             return;
         }
 
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         const auto* vehicleObject = getObject();
 
         if (veh_2->motorState != MotorState::coasting && veh_2->motorState != MotorState::accelerating)
@@ -1246,7 +1239,7 @@ namespace OpenLoco::Vehicles
             _var_44 = -var_44;
         }
 
-        if (((uint16_t)_vehicleUpdate_var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+        if (((uint16_t)getUpdateContext().var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
         {
             return;
         }
@@ -1269,14 +1262,14 @@ namespace OpenLoco::Vehicles
     // 0x004ABEC3 & 0x004AB4E0
     void VehicleBody::electricSpark2AnimationUpdate(uint8_t num, int32_t emitterHorizontalPos)
     {
-        VehicleBogie* frontBogie = _vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = _vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = getUpdateContext().frontBogie;
+        VehicleBogie* backBogie = getUpdateContext().backBogie;
         if (frontBogie->hasBreakdownFlags(BreakdownFlags::brokenDown))
         {
             return;
         }
 
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         const auto* vehicleObject = getObject();
 
         if (veh_2->motorState != MotorState::coasting && veh_2->motorState != MotorState::accelerating)
@@ -1291,7 +1284,7 @@ namespace OpenLoco::Vehicles
             _var_44 = -var_44;
         }
 
-        if (((uint16_t)_vehicleUpdate_var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+        if (((uint16_t)getUpdateContext().var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
         {
             return;
         }
@@ -1332,7 +1325,7 @@ namespace OpenLoco::Vehicles
     // 0x004ABC8A & 0x004AB2A7
     void VehicleBody::shipWakeAnimationUpdate(uint8_t num, int32_t)
     {
-        Vehicle2* veh_2 = _vehicleUpdate_2;
+        Vehicle2* veh_2 = getUpdateContext().veh2;
         const auto* vehicleObject = getObject();
 
         if (veh_2->motorState == MotorState::stopped)
@@ -18,13 +18,6 @@ using namespace OpenLoco::Literals;
 
 namespace OpenLoco::Vehicles
 {
-    static VehicleBogie* _vehicleUpdate_frontBogie = nullptr; // Was loco_global at 0x01136124
-    static VehicleBogie* _vehicleUpdate_backBogie = nullptr; // Was loco_global at 0x01136128
-    static bool _vehicleUpdate_frontBogieHasMoved = false; // Was loco_global at 0x01136237
-    static bool _vehicleUpdate_backBogieHasMoved = false; // Was loco_global at 0x01136238
-    static int32_t _vehicleUpdate_var_113612C = 0; // Was loco_global at 0x0113612C
-    static int32_t _vehicleUpdate_var_1136130 = 0; // Was loco_global at 0x01136130
-    static EntityId _vehicleUpdate_collisionCarComponent = 0; // Was loco_global at 0x0113610E
 
     template<typename T>
     void applyDestructionToComponent(T& component)
@@ -38,8 +31,8 @@ namespace OpenLoco::Vehicles
     // 0x004AA008
     bool VehicleBogie::update()
     {
-        _vehicleUpdate_frontBogie = _vehicleUpdate_backBogie;
-        _vehicleUpdate_backBogie = this;
+        getUpdateContext().frontBogie = getUpdateContext().backBogie;
+        getUpdateContext().backBogie = this;
 
         if (mode == TransportMode::air || mode == TransportMode::water)
         {
@@ -48,13 +41,13 @@ namespace OpenLoco::Vehicles
 
         const auto oldPos = position;
         resetUpdateVar1136114Flags();
-        updateTrackMotion(_vehicleUpdate_var_113612C);
+        updateTrackMotion(getUpdateContext().var_113612C);
 
         const auto hasMoved = oldPos != position;
-        _vehicleUpdate_backBogieHasMoved = _vehicleUpdate_frontBogieHasMoved;
-        _vehicleUpdate_frontBogieHasMoved = hasMoved;
+        getUpdateContext().backBogieHasMoved = getUpdateContext().frontBogieHasMoved;
+        getUpdateContext().frontBogieHasMoved = hasMoved;
 
-        const int32_t stash1136130 = _vehicleUpdate_var_1136130;
+        const int32_t stash1136130 = getUpdateContext().var_1136130;
         if (wheelSlipping != 0)
         {
             auto unk = wheelSlipping;
@@ -62,11 +55,11 @@ namespace OpenLoco::Vehicles
             {
                 unk = kWheelSlippingDuration - unk;
             }
-            _vehicleUpdate_var_1136130 = 500 + unk * 320;
+            getUpdateContext().var_1136130 = 500 + unk * 320;
         }
 
         updateRoll();
-        _vehicleUpdate_var_1136130 = stash1136130;
+        getUpdateContext().var_1136130 = stash1136130;
         if (hasUpdateVar1136114Flags(UpdateVar1136114Flags::noRouteFound))
         {
             destroyTrain();
@@ -84,7 +77,7 @@ namespace OpenLoco::Vehicles
     // 0x004AAC02
     void VehicleBogie::updateRoll()
     {
-        auto unk = _vehicleUpdate_var_1136130 / 8;
+        auto unk = getUpdateContext().var_1136130 / 8;
         if (has38Flags(Flags38::isReversed))
         {
             unk = -unk;
@@ -180,8 +173,8 @@ namespace OpenLoco::Vehicles
     // 0x004AA68E
     void VehicleBogie::updateSegmentCrashed()
     {
-        _vehicleUpdate_frontBogie = _vehicleUpdate_backBogie;
-        _vehicleUpdate_backBogie = this;
+        getUpdateContext().frontBogie = getUpdateContext().backBogie;
+        getUpdateContext().backBogie = this;
 
         Speed32 speed = Speed32(var_5A & 0x7FFFFFFF);
         bool isComponentDestroyed = this->var_5A & (1U << 31);
@@ -192,8 +185,8 @@ namespace OpenLoco::Vehicles
         }
 
         this->var_5A = speed.getRaw() | (isComponentDestroyed ? (1U << 31) : 0);
-        _vehicleUpdate_var_113612C = speed.getRaw() / 128;
-        _vehicleUpdate_var_1136130 = speed.getRaw() / 128;
+        getUpdateContext().var_113612C = speed.getRaw() / 128;
+        getUpdateContext().var_1136130 = speed.getRaw() / 128;
 
         this->updateRoll();
 
@@ -304,7 +297,7 @@ namespace OpenLoco::Vehicles
             resetUpdateVar1136114Flags();
             if (this->mode != TransportMode::road)
             {
-                this->updateTrackMotion(_vehicleUpdate_var_113612C);
+                this->updateTrackMotion(getUpdateContext().var_113612C);
                 if (hasUpdateVar1136114Flags(UpdateVar1136114Flags::unk_m00 | UpdateVar1136114Flags::noRouteFound))
                 {
                     this->var_5A |= 1U << 31;
@@ -341,7 +334,7 @@ namespace OpenLoco::Vehicles
         }
 
         // Apply Collision to collided train
-        auto* collideEntity = EntityManager::get<EntityBase>(_vehicleUpdate_collisionCarComponent);
+        auto* collideEntity = EntityManager::get<EntityBase>(getUpdateContext().collisionCarComponent);
         auto* collideCarComponent = collideEntity->asBase<VehicleBase>();
         if (collideCarComponent != nullptr)
         {
@@ -1,5 +1,6 @@
 #include "VehicleDraw.h"
 #include "Entities/Entity.h"
+#include "Entities/EntityManager.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/ImageId.h"
 #include "Graphics/SoftwareDrawingContext.h"
@@ -15,7 +16,12 @@
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <OpenLoco/Math/Trigonometry.hpp>
 #include <array>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <sfl/static_vector.hpp>
+#include <utility>
+#include <vector>
 
 namespace OpenLoco
 {
@@ -217,6 +223,53 @@ namespace OpenLoco
         return pitchImageIndex + sprite.numFramesPerRotation - 1;
     }
 
+    static constexpr size_t kNumPitches = 13;
+    static constexpr size_t kNumYaws = 64;
+
+    // Pitch image index relative to flatImageId for every pitch and yaw of each body sprite
+    using BodyImageTable = std::array<std::array<uint16_t, kNumPitches * kNumYaws>, VehicleObject::kMaxBodySprites>;
+
+    // Built when a vehicle object is loaded as viewports are painted from several threads. Objects
+    // whose images do not fit the table have none and use the calculation.
+    static std::array<std::unique_ptr<BodyImageTable>, ObjectManager::getMaxObjects(ObjectType::vehicle)> _bodyImageTables;
+
+    void buildBodyImageTable(const uint16_t vehicleObjectId)
+    {
+        auto& table = _bodyImageTables[vehicleObjectId];
+        table.reset();
+
+        const auto* vehObject = ObjectManager::get<VehicleObject>(vehicleObjectId);
+        auto newTable = std::make_unique<BodyImageTable>();
+        for (size_t spriteIndex = 0; spriteIndex < std::size(vehObject->bodySprites); ++spriteIndex)
+        {
+            const auto& sprite = vehObject->bodySprites[spriteIndex];
+            for (size_t pitch = 0; pitch < kNumPitches; ++pitch)
+            {
+                for (size_t yaw = 0; yaw < kNumYaws; ++yaw)
+                {
+                    const auto offset = getPitchBodyImageIndex(sprite, static_cast<Pitch>(pitch), static_cast<uint8_t>(yaw)) - sprite.flatImageId;
+                    if (offset > std::numeric_limits<uint16_t>::max())
+                    {
+                        return;
+                    }
+                    (*newTable)[spriteIndex][pitch * kNumYaws + yaw] = static_cast<uint16_t>(offset);
+                }
+            }
+        }
+        table = std::move(newTable);
+    }
+
+    uint32_t getPitchBodyImageIndex(const uint16_t vehicleObjectId, const uint8_t bodySpriteIndex, const Pitch pitch, const uint8_t yaw)
+    {
+        const auto& sprite = ObjectManager::get<VehicleObject>(vehicleObjectId)->bodySprites[bodySpriteIndex];
+        const auto* table = _bodyImageTables[vehicleObjectId].get();
+        if (table == nullptr || enumValue(pitch) >= kNumPitches || yaw >= kNumYaws)
+        {
+            return getPitchBodyImageIndex(sprite, pitch, yaw);
+        }
+        return sprite.flatImageId + (*table)[bodySpriteIndex][enumValue(pitch) * kNumYaws + yaw];
+    }
+
     constexpr std::array<uint8_t, 8> kUnk500264 = {
         0,
         1,
@@ -352,9 +405,16 @@ namespace OpenLoco
         return drawItems;
     }
 
+    // Only veh2 is needed so this avoids building the whole train, which walks every car of it.
+    static bool hasBrakeLightsOn(const Vehicles::Car& car)
+    {
+        auto* head = EntityManager::get<Vehicles::VehicleHead>(car.front->head);
+        auto* veh2 = head->nextVehicleComponent()->nextVehicleComponent()->asVehicle2();
+        return veh2->brakeLightTimeout != 0;
+    }
+
     static DrawItems getDrawItemsForVehicle(const VehicleObject& vehObject, const uint8_t yaw, const Vehicles::Car& car, const VehicleInlineMode mode)
     {
-        Vehicles::Vehicle train(car.front->head);
         DrawItems drawItems{};
         const auto isCarReversed = car.body->has38Flags(Vehicles::Flags38::isReversed);
         const auto isAnimated = mode == VehicleInlineMode::animated;
@@ -433,7 +493,7 @@ namespace OpenLoco
                 drawItems.items.push_back(DrawItem{ ImageId(spriteIndex, carComponent.body->colourScheme), bodyDist, true });
                 if (isAnimated
                     && bodySprites.hasFlags(BodySpriteFlags::hasBrakingLights)
-                    && train.veh2->brakeLightTimeout != 0)
+                    && hasBrakeLightsOn(car))
                 {
                     const auto brakingImageIndex = getBrakingImageIndex(bodySprites, Pitch::flat, yaw);
                     drawItems.items.push_back(DrawItem{ ImageId(brakingImageIndex, carComponent.body->colourScheme), bodyDist, true });
@@ -604,8 +664,8 @@ namespace OpenLoco
         return screenDistDrawItems.totalDistance;
     }
 
-    // 0x004B6D93
-    int16_t drawVehicleInline(Gfx::DrawingContext& drawingCtx, const Vehicles::Car& car, Ui::Point loc, VehicleInlineMode mode, VehiclePartsToDraw parts, std::optional<Colour> disabled)
+    // Screen space draw items of a car and the point they are drawn relative to.
+    static DrawItems getInlineDrawItems(const Vehicles::Car& car, Ui::Point& loc, VehicleInlineMode mode)
     {
         // This has been simplified from vanilla.
 
@@ -618,8 +678,11 @@ namespace OpenLoco
 
         const auto drawItems = getDrawItemsForVehicle(*vehObject, yaw, car, mode);
 
-        auto screenDistDrawItems = toScreenDistDrawItems(drawItems, yaw);
+        return toScreenDistDrawItems(drawItems, yaw);
+    }
 
+    static void drawInlineDrawItems(Gfx::DrawingContext& drawingCtx, const DrawItems& screenDistDrawItems, Ui::Point loc, VehiclePartsToDraw parts, std::optional<Colour> disabled)
+    {
         for (auto& item : screenDistDrawItems.items)
         {
             if (parts == VehiclePartsToDraw::bodies && !item.isBody)
@@ -642,6 +705,13 @@ namespace OpenLoco
                 drawingCtx.drawImage(loc + Ui::Point(item.dist, 0), item.image);
             }
         }
+    }
+
+    // 0x004B6D93
+    int16_t drawVehicleInline(Gfx::DrawingContext& drawingCtx, const Vehicles::Car& car, Ui::Point loc, VehicleInlineMode mode, VehiclePartsToDraw parts, std::optional<Colour> disabled)
+    {
+        const auto screenDistDrawItems = getInlineDrawItems(car, loc, mode);
+        drawInlineDrawItems(drawingCtx, screenDistDrawItems, loc, parts, disabled);
         return screenDistDrawItems.totalDistance;
     }
 
@@ -661,15 +731,23 @@ namespace OpenLoco
     // 0x004B6D43
     int16_t drawTrainInline(Gfx::DrawingContext& drawingCtx, const Vehicles::Vehicle& train, Ui::Point loc)
     {
-        const auto startX = loc.x;
+        // The bogies of every car are drawn before any of the bodies, the draw items of each
+        // car are worked out once for both passes.
+        std::vector<std::pair<DrawItems, Ui::Point>> carItems;
         for (auto& car : train.cars)
         {
-            loc.x += drawVehicleInline(drawingCtx, car, loc, VehicleInlineMode::animated, VehiclePartsToDraw::bogies);
+            auto carLoc = loc;
+            auto screenDistDrawItems = getInlineDrawItems(car, carLoc, VehicleInlineMode::animated);
+            loc.x += screenDistDrawItems.totalDistance;
+            carItems.emplace_back(std::move(screenDistDrawItems), carLoc);
         }
-        loc.x = startX;
-        for (auto& car : train.cars)
+        for (const auto& [items, carLoc] : carItems)
+        {
+            drawInlineDrawItems(drawingCtx, items, carLoc, VehiclePartsToDraw::bogies, std::nullopt);
+        }
+        for (const auto& [items, carLoc] : carItems)
         {
-            loc.x += drawVehicleInline(drawingCtx, car, loc, VehicleInlineMode::animated, VehiclePartsToDraw::bodies);
+            drawInlineDrawItems(drawingCtx, items, carLoc, VehiclePartsToDraw::bodies, std::nullopt);
         }
         return loc.x;
     }
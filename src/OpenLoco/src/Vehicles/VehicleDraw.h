@@ -20,6 +20,10 @@ namespace OpenLoco
     // roll/animationFrame
     uint32_t getBodyImageIndex(const VehicleObjectBodySprite& sprite, const Pitch pitch, const uint8_t yaw, const uint8_t roll, const uint8_t cargoIndex);
     uint32_t getBrakingImageIndex(const VehicleObjectBodySprite& sprite, const Pitch pitch, const uint8_t yaw);
+    // Same as the pitch part of getBodyImageIndex but looked up from a table built on object load,
+    // add roll and cargo for the body image or numFramesPerRotation - 1 for the braking image.
+    uint32_t getPitchBodyImageIndex(const uint16_t vehicleObjectId, const uint8_t bodySpriteIndex, const Pitch pitch, const uint8_t yaw);
+    void buildBodyImageTable(const uint16_t vehicleObjectId);
 
     void drawVehicleOverview(Gfx::DrawingContext& drawingCtx, Ui::Point offset, const VehicleObject& vehObject, const uint8_t yaw, const uint8_t roll, const ColourScheme colourScheme);
     void drawVehicleOverview(Gfx::DrawingContext& drawingCtx, Ui::Point offset, int16_t vehicleTypeIdx, uint8_t yaw, uint8_t roll, CompanyId companyId);
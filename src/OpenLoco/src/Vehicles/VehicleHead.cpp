@@ -50,9 +50,11 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Math/Bound.hpp>
 #include <OpenLoco/Math/Trigonometry.hpp>
+#include <array>
 #include <cassert>
 #include <numeric>
 #include <optional>
+#include <sfl/static_vector.hpp>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Literals;
@@ -60,20 +62,7 @@ using namespace OpenLoco::World;
 
 namespace OpenLoco::Vehicles
 {
-    static uint32_t _vehicleUpdate_manhattanDistanceToStation = 0; // Was loco_global at 0x011360D0
-    static VehicleHead* _vehicleUpdate_head = nullptr; // Was loco_global at 0x01136118
-    static Vehicle1* _vehicleUpdate_1 = nullptr; // Was loco_global at 0x0113611C
-    static Vehicle2* _vehicleUpdate_2 = nullptr; // Was loco_global at 0x01136120
-    static VehicleBogie* _vehicleUpdate_frontBogie = nullptr; // Was loco_global at 0x01136124
-    static VehicleBogie* _vehicleUpdate_backBogie = nullptr; // Was loco_global at 0x01136128
-    static int32_t _vehicleUpdate_var_113612C = 0; // Was loco_global at 0x0113612C
-    static int32_t _vehicleUpdate_var_1136130 = 0; // Was loco_global at 0x01136130
-    static int16_t _vehicleUpdate_targetZ = 0; // Was loco_global at 0x01136168
     static uint16_t _1136458 = 0; // Was loco_global at 0x01136458
-    static Status _vehicleUpdate_initialStatus = 0; // Was loco_global at 0x0113646C
-    static uint8_t _vehicleUpdate_helicopterTargetYaw = 0; // Was loco_global at 0x0113646D
-    static AirportMovementNodeFlags _vehicleUpdate_helicopterAirportMovement = 0; // Was loco_global at 0x00525BB0
-    static uint32_t _vehicleUpdate_compatibleRoadStationTypes = 0; // Was loco_global at 0x0112C30C
     static std::array<int8_t, 88> _vehicle_arr_4F865C = {}; // Was loco_global at 0x004F865C
     static SignalStateFlags _vehicleManagerIgnoreSignalFlagsMasks = 0; // Was loco_global at 0x005220BC
     static uint8_t _vehicleMangled_113623B = 0; // Was loco_global at 0x0113623B
@@ -145,6 +134,8 @@ namespace OpenLoco::Vehicles
 
     void VehicleHead::updateVehicle()
     {
+        ScopedUpdateContext context;
+
         // TODO: Refactor to use the Vehicle super class
         VehicleBase* v = this;
         while (v != nullptr)
@@ -161,19 +152,19 @@ namespace OpenLoco::Vehicles
     bool VehicleHead::update()
     {
         Vehicle train(head);
-        _vehicleUpdate_head = train.head;
-        _vehicleUpdate_1 = train.veh1;
-        _vehicleUpdate_2 = train.veh2;
+        getUpdateContext().head = train.head;
+        getUpdateContext().veh1 = train.veh1;
+        getUpdateContext().veh2 = train.veh2;
 
-        _vehicleUpdate_initialStatus = status;
+        getUpdateContext().initialStatus = status;
         updateDrivingSounds();
 
-        _vehicleUpdate_frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
-        _vehicleUpdate_backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        getUpdateContext().frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        getUpdateContext().backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
 
-        Vehicle2* veh2 = _vehicleUpdate_2;
-        _vehicleUpdate_var_113612C = veh2->currentSpeed.getRaw() >> 7;
-        _vehicleUpdate_var_1136130 = veh2->currentSpeed.getRaw() >> 7;
+        Vehicle2* veh2 = getUpdateContext().veh2;
+        getUpdateContext().var_113612C = veh2->currentSpeed.getRaw() >> 7;
+        getUpdateContext().var_1136130 = veh2->currentSpeed.getRaw() >> 7;
 
         if (var_5C != 0)
         {
@@ -1062,7 +1053,7 @@ namespace OpenLoco::Vehicles
     // 0x004A88F7
     void VehicleHead::updateDrivingSoundFriction(VehicleSoundPlayer* soundPlayer, const VehicleObjectFrictionSound* snd)
     {
-        Vehicle2* vehType2_2 = _vehicleUpdate_2;
+        Vehicle2* vehType2_2 = getUpdateContext().veh2;
         if (vehType2_2->currentSpeed < snd->minSpeed)
         {
             updateDrivingSoundNone(soundPlayer);
@@ -1099,7 +1090,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = _vehicleUpdate_2;
+        Vehicle2* vehType2_2 = getUpdateContext().veh2;
         uint16_t targetFrequency = snd->idleFrequency;
         uint8_t targetVolume = snd->idleVolume;
 
@@ -1172,7 +1163,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = _vehicleUpdate_2;
+        Vehicle2* vehType2_2 = getUpdateContext().veh2;
         uint16_t targetFrequency = 0;
         uint8_t targetVolume = 0;
         bool transmissionInGear = vehType2_2->motorState == MotorState::accelerating;
@@ -1282,7 +1273,7 @@ namespace OpenLoco::Vehicles
     // 0x004A8C11
     bool VehicleHead::updateLand()
     {
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
 
         // If don't have any running issue and is approaching
         if ((!vehType2->has73Flags(Flags73::isBrokenDown) || vehType2->has73Flags(Flags73::isStillPowered)) && status == Status::approaching)
@@ -1447,7 +1438,7 @@ namespace OpenLoco::Vehicles
     // 0x004A8CB6
     bool VehicleHead::sub_4A8CB6()
     {
-        Vehicle1* vehType1 = _vehicleUpdate_1;
+        Vehicle1* vehType1 = getUpdateContext().veh1;
 
         if (position != vehType1->position)
         {
@@ -1467,7 +1458,7 @@ namespace OpenLoco::Vehicles
         }
 
         status = Status::stopped;
-        vehType2 = _vehicleUpdate_2;
+        vehType2 = getUpdateContext().veh2;
 
         if (vehType2->has73Flags(Flags73::isBrokenDown))
         {
@@ -1480,7 +1471,7 @@ namespace OpenLoco::Vehicles
     // 0x004A8C81
     bool VehicleHead::sub_4A8C81()
     {
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
         if (vehType2->currentSpeed > 1.0_mph)
         {
             return landNormalMovementUpdate();
@@ -1553,7 +1544,7 @@ namespace OpenLoco::Vehicles
     bool VehicleHead::landNormalMovementUpdate()
     {
         advanceToNextRoutableOrder();
-        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, _vehicleUpdate_var_113612C);
+        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, getUpdateContext().var_113612C);
 
         if (mode == TransportMode::road)
         {
@@ -1726,15 +1717,15 @@ namespace OpenLoco::Vehicles
     // 0x004A9051
     bool VehicleHead::updateAir()
     {
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
 
         if (vehType2->currentSpeed >= 20.0_mph)
         {
-            _vehicleUpdate_var_1136130 = 0x4000;
+            getUpdateContext().var_1136130 = 0x4000;
         }
         else
         {
-            _vehicleUpdate_var_1136130 = 0x2000;
+            getUpdateContext().var_1136130 = 0x2000;
         }
 
         Vehicle train(head);
@@ -1763,7 +1754,7 @@ namespace OpenLoco::Vehicles
         auto [newStatus, targetSpeed] = airplaneGetNewStatus();
 
         status = newStatus;
-        Vehicle1* vehType1 = _vehicleUpdate_1;
+        Vehicle1* vehType1 = getUpdateContext().veh1;
         vehType1->targetSpeed = targetSpeed;
 
         advanceToNextRoutableOrder();
@@ -1815,13 +1806,13 @@ namespace OpenLoco::Vehicles
 
         auto [manhattanDistance, targetZ, targetYaw] = sub_427122();
 
-        _vehicleUpdate_manhattanDistanceToStation = manhattanDistance;
-        _vehicleUpdate_targetZ = targetZ;
+        getUpdateContext().manhattanDistanceToStation = manhattanDistance;
+        getUpdateContext().targetZ = targetZ;
 
         // Helicopter
-        if ((_vehicleUpdate_helicopterAirportMovement & (AirportMovementNodeFlags::heliTakeoffEnd)) != AirportMovementNodeFlags::none)
+        if ((getUpdateContext().helicopterAirportMovement & (AirportMovementNodeFlags::heliTakeoffEnd)) != AirportMovementNodeFlags::none)
         {
-            _vehicleUpdate_helicopterTargetYaw = targetYaw;
+            getUpdateContext().helicopterTargetYaw = targetYaw;
             targetYaw = spriteYaw;
             vehType2->motorState = MotorState::accelerating;
             if (targetZ < position.z)
@@ -1881,7 +1872,7 @@ namespace OpenLoco::Vehicles
         }
 
         // Helicopter
-        if ((_vehicleUpdate_helicopterAirportMovement & AirportMovementNodeFlags::heliTakeoffEnd) != AirportMovementNodeFlags::none)
+        if ((getUpdateContext().helicopterAirportMovement & AirportMovementNodeFlags::heliTakeoffEnd) != AirportMovementNodeFlags::none)
         {
             vehType2->currentSpeed = 8.0_mph;
             if (targetZ != position.z)
@@ -2045,7 +2036,7 @@ namespace OpenLoco::Vehicles
         if (hasVehicleFlags(VehicleFlags::commandStop))
         {
             status = Status::stopped;
-            Vehicle2* vehType2 = _vehicleUpdate_2;
+            Vehicle2* vehType2 = getUpdateContext().veh2;
             vehType2->currentSpeed = 0.0_mph;
         }
         else
@@ -2060,7 +2051,7 @@ namespace OpenLoco::Vehicles
     // 0x004A95F5
     bool VehicleHead::airplaneLoadingUpdate()
     {
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
         vehType2->currentSpeed = 0.0_mph;
         vehType2->motorState = MotorState::stopped;
         if (updateLoadCargo())
@@ -2096,13 +2087,13 @@ namespace OpenLoco::Vehicles
     {
         auto yaw = spriteYaw;
         // Helicopter
-        if ((_vehicleUpdate_helicopterAirportMovement & AirportMovementNodeFlags::heliTakeoffEnd) != AirportMovementNodeFlags::none)
+        if ((getUpdateContext().helicopterAirportMovement & AirportMovementNodeFlags::heliTakeoffEnd) != AirportMovementNodeFlags::none)
         {
-            yaw = _vehicleUpdate_helicopterTargetYaw;
+            yaw = getUpdateContext().helicopterTargetYaw;
         }
 
-        Vehicle1* vehType1 = _vehicleUpdate_1;
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle1* vehType1 = getUpdateContext().veh1;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
 
         auto [veh1Loc, veh2Loc] = calculateNextPosition(
             yaw, position, vehType1, vehType2->currentSpeed);
@@ -2113,7 +2104,7 @@ namespace OpenLoco::Vehicles
         if (targetZ != position.z)
         {
             // Final section of landing / helicopter
-            if (_vehicleUpdate_manhattanDistanceToStation <= 28)
+            if (getUpdateContext().manhattanDistanceToStation <= 28)
             {
                 int16_t zShift = 1;
                 if (vehType2->currentSpeed >= 50.0_mph)
@@ -2139,7 +2130,7 @@ namespace OpenLoco::Vehicles
                 int32_t zDiff = targetZ - position.z;
                 // We want a SAR instruction so use >>5
                 int32_t param1 = (zDiff * toSpeed16(vehType2->currentSpeed).getRaw()) >> 5;
-                int32_t param2 = _vehicleUpdate_manhattanDistanceToStation - 18;
+                int32_t param2 = getUpdateContext().manhattanDistanceToStation - 18;
 
                 auto modulo = param1 % param2;
                 if (modulo < 0)
@@ -2260,14 +2251,14 @@ namespace OpenLoco::Vehicles
     // 0x004A9649
     bool VehicleHead::updateWater()
     {
-        Vehicle2* vehType2 = _vehicleUpdate_2;
+        Vehicle2* vehType2 = getUpdateContext().veh2;
         if (vehType2->currentSpeed >= 5.0_mph)
         {
-            _vehicleUpdate_var_1136130 = 0x4000;
+            getUpdateContext().var_1136130 = 0x4000;
         }
         else
         {
-            _vehicleUpdate_var_1136130 = 0x2000;
+            getUpdateContext().var_1136130 = 0x2000;
         }
 
         Vehicle train(head);
@@ -2356,11 +2347,11 @@ namespace OpenLoco::Vehicles
      *  manhattanDistance = regs.ebp
      *  targetZ = regs.dx
      *  targetYaw = regs.bl
-     *  airportFlags = _vehicleUpdate_var_525BB0
+     *  airportFlags = getUpdateContext().helicopterAirportMovement
      */
     std::tuple<uint32_t, uint16_t, uint8_t> VehicleHead::sub_427122()
     {
-        _vehicleUpdate_helicopterAirportMovement = AirportMovementNodeFlags::none;
+        getUpdateContext().helicopterAirportMovement = AirportMovementNodeFlags::none;
         StationId targetStationId = StationId::null;
         std::optional<World::Pos3> targetPos{};
         if (stationId == StationId::null)
@@ -2393,7 +2384,7 @@ namespace OpenLoco::Vehicles
                 else
                 {
                     auto [flags, pos] = airportGetMovementEdgeTarget(stationId, airportMovementEdge);
-                    _vehicleUpdate_helicopterAirportMovement = flags;
+                    getUpdateContext().helicopterAirportMovement = flags;
                     targetPos = pos;
                 }
             }
@@ -2428,6 +2419,22 @@ namespace OpenLoco::Vehicles
         return std::make_tuple(manhattanDistance, targetPos->z, targetYaw);
     }
 
+    static bool isMovementEdgeClear(const Station& station, const AirportObject::MovementEdge& transition)
+    {
+        if (station.airportMovementOccupiedEdges & transition.mustBeClearEdges)
+        {
+            return false;
+        }
+
+        if (transition.atLeastOneClearEdges == 0)
+        {
+            return true;
+        }
+
+        auto occupiedAreas = station.airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
+        return occupiedAreas != transition.atLeastOneClearEdges;
+    }
+
     // 0x00427214 returns next movement edge or -2 if no valid edge or -1 for in flight
     uint8_t VehicleHead::airportGetNextMovementEdge(uint8_t curEdge)
     {
@@ -2453,119 +2460,38 @@ namespace OpenLoco::Vehicles
             auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
             const auto movementNodes = airportObject->getMovementNodes();
             const auto movementEdges = airportObject->getMovementEdges();
+            const auto& movementGraph = getAirportMovementGraph(elStation->objectId());
 
-            if (curEdge == kAirportMovementNodeNull)
-            {
-                for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
+            // Same edge order as walking every edge of the airport
+            const auto findClearEdge = [&](std::span<const uint8_t> candidateEdges) -> uint8_t {
+                for (const auto movementEdge : candidateEdges)
                 {
-                    const auto& transition = movementEdges[movementEdge];
-                    if (!movementNodes[transition.curNode].hasFlags(AirportMovementNodeFlags::flag2))
-                    {
-                        continue;
-                    }
-
-                    if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                    {
-                        continue;
-                    }
-
-                    if (transition.atLeastOneClearEdges == 0)
+                    if (isMovementEdgeClear(*station, movementEdges[movementEdge]))
                     {
                         return movementEdge;
                     }
-
-                    auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                    if (occupiedAreas == transition.atLeastOneClearEdges)
-                    {
-                        continue;
-                    }
-
-                    return movementEdge;
                 }
                 return kAirportMovementNoValidEdge;
-            }
-            else
-            {
-                uint8_t targetNode = movementEdges[curEdge].nextNode;
-                if (status == Status::takingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
-                {
-                    return kAirportMovementNodeNull;
-                }
-                // 0x4272A5
-                Vehicle train(head);
-                auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
-                if (vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter))
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::takeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-                        return movementEdge;
-                    }
-
-                    return kAirportMovementNoValidEdge;
-                }
-                else
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::heliTakeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
+            };
 
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
+            if (curEdge == kAirportMovementNodeNull)
+            {
+                return findClearEdge(std::span<const uint8_t>(movementGraph.entryEdges.data(), movementGraph.numEntryEdges));
+            }
 
-                        return movementEdge;
-                    }
-                    return kAirportMovementNoValidEdge;
-                }
+            uint8_t targetNode = movementEdges[curEdge].nextNode;
+            if (status == Status::takingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
+            {
+                return kAirportMovementNodeNull;
             }
+            // 0x4272A5
+            Vehicle train(head);
+            auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
+            if (vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter))
+            {
+                return findClearEdge(movementGraph.helicopterEdges.getEdgesLeaving(targetNode));
+            }
+            return findClearEdge(movementGraph.planeEdges.getEdgesLeaving(targetNode));
         }
 
         // Tile not found. Todo: fail gracefully
@@ -2639,7 +2565,7 @@ namespace OpenLoco::Vehicles
             return;
         }
 
-        if (_vehicleUpdate_initialStatus != Status::stopped && _vehicleUpdate_initialStatus != Status::waitingAtSignal)
+        if (getUpdateContext().initialStatus != Status::stopped && getUpdateContext().initialStatus != Status::waitingAtSignal)
         {
             return;
         }
@@ -2656,7 +2582,7 @@ namespace OpenLoco::Vehicles
             }
             auto randSoundIndex = gPrng1().randNext(numSounds - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = _vehicleUpdate_2;
+            Vehicle2* veh2 = getUpdateContext().veh2;
             auto tileHeight = TileManager::getHeight(veh2->position);
             auto volume = 0;
             if (veh2->position.z < tileHeight.landHeight)
@@ -2824,7 +2750,7 @@ namespace OpenLoco::Vehicles
     // bit 17 : reachedADestination
     WaterMotionFlags VehicleHead::updateWaterMotion(WaterMotionFlags flags)
     {
-        Vehicle2* veh2 = _vehicleUpdate_2;
+        Vehicle2* veh2 = getUpdateContext().veh2;
 
         // updates the current boats position and sets flags about position
         auto tile = TileManager::get(veh2->position);
@@ -2991,7 +2917,7 @@ namespace OpenLoco::Vehicles
             veh2->spriteYaw &= 0x3F;
         }
 
-        Vehicle1* veh1 = _vehicleUpdate_1;
+        Vehicle1* veh1 = getUpdateContext().veh1;
         auto [newVeh1Pos, newVeh2Pos] = calculateNextPosition(veh2->spriteYaw, veh2->position, veh1, veh2->currentSpeed);
 
         veh1->var_4E = newVeh1Pos.x;
@@ -3297,9 +3223,9 @@ namespace OpenLoco::Vehicles
                 auto company = CompanyManager::get(owner);
                 company->aiThoughts[aiThoughtId].var_80 += cargoProfit;
             }
-            Vehicle2* veh2 = _vehicleUpdate_2;
+            Vehicle2* veh2 = getUpdateContext().veh2;
             veh2->curMonthRevenue += cargoProfit;
-            Vehicle1* veh1 = _vehicleUpdate_1;
+            Vehicle1* veh1 = getUpdateContext().veh1;
             if (cargoProfit != 0)
             {
                 veh1->var_48 |= Flags48::flag2;
@@ -3456,8 +3382,9 @@ namespace OpenLoco::Vehicles
 
         station->var_3B0 = 0;
         station->flags |= StationFlags::flag_7;
-        Vehicle train(head);
-        auto vehMaxSpeed = train.veh2->maxSpeed;
+        // Only called during the head update so veh2 is already known, no need to walk the whole train.
+        Vehicle2* veh2 = getUpdateContext().veh2;
+        auto vehMaxSpeed = veh2->maxSpeed;
         auto carAgeFactor = static_cast<uint8_t>(std::min<uint32_t>(0xFF, (getCurrentDay() - bogie->creationDay) / 256));
 
         if ((stationCargo.flags & StationCargoStatsFlags::flag2) != StationCargoStatsFlags::none)
@@ -3630,7 +3557,7 @@ namespace OpenLoco::Vehicles
         {
             auto randSoundIndex = gPrng1().randNext((vehObj->numStartSounds & NumStartSounds::kMask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = _vehicleUpdate_2;
+            Vehicle2* veh2 = getUpdateContext().veh2;
             Audio::playSound(randSoundId, veh2->position + World::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -3650,27 +3577,30 @@ namespace OpenLoco::Vehicles
         NearbyBoats res{};
         res.startTile = tilePosA;
 
-        for (const auto& tileLoc : getClampedRange(tilePosA, tilePosB))
-        {
-            for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(tileLoc)))
+        const auto searchMin = World::toWorldSpace(tilePosA);
+        const auto searchMax = World::toWorldSpace(tilePosB) + World::Pos2(World::kTileSize - 1, World::kTileSize - 1);
+        EntityManager::forEachEntityInRange(searchMin, searchMax, [&res](EntityBase& entity) {
+            auto* vehicleEntity = entity.asBase<VehicleBase>();
+            if (vehicleEntity == nullptr)
             {
-                auto* vehicleEntity = entity->asBase<VehicleBase>();
-                if (vehicleEntity == nullptr)
-                {
-                    continue;
-                }
-                if (vehicleEntity->getTransportMode() != TransportMode::water)
-                {
-                    continue;
-                }
-                if (vehicleEntity->getSubType() != VehicleEntityType::body_start)
-                {
-                    continue;
-                }
-                const auto resultLoc = tileLoc - res.startTile;
-                res.searchResult[resultLoc.x][resultLoc.y] = true;
+                return;
             }
-        }
+            if (vehicleEntity->getTransportMode() != TransportMode::water)
+            {
+                return;
+            }
+            if (vehicleEntity->getSubType() != VehicleEntityType::body_start)
+            {
+                return;
+            }
+            const auto tileLoc = World::toTileSpace(vehicleEntity->position);
+            if (!World::validCoords(tileLoc))
+            {
+                return;
+            }
+            const auto resultLoc = tileLoc - res.startTile;
+            res.searchResult[resultLoc.x][resultLoc.y] = true;
+        });
         return res;
     }
 
@@ -3736,19 +3666,17 @@ namespace OpenLoco::Vehicles
         constexpr auto operator<=>(const PathFindingResult& rhs) const = default;
     };
 
-    // 0x00428237
-    static PathFindingResult waterPathfindToTarget(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, uint8_t cost, const PathFindingResult& bestResult)
+    static bool canBoatEnterTile(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const NearbyBoats& nearbyVehicles)
     {
-        PathFindingResult result = bestResult;
         if (!validCoords(tilePos))
         {
-            return result;
+            return false;
         }
         auto tile = TileManager::get(tilePos);
         auto* elSurface = tile.surface();
         if (elSurface->water() != waterMicroZ)
         {
-            return result;
+            return false;
         }
         if (!elSurface->isLast())
         {
@@ -3757,7 +3685,7 @@ namespace OpenLoco::Vehicles
             {
                 if (elObsticle->baseZ() / kMicroToSmallZStep - waterMicroZ < 1)
                 {
-                    return result;
+                    return false;
                 }
             }
         }
@@ -3769,27 +3697,62 @@ namespace OpenLoco::Vehicles
         {
             if (nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
             {
-                return result;
+                return false;
             }
         }
-        auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
-        distToTarget.x = std::abs(distToTarget.x);
-        distToTarget.y = std::abs(distToTarget.y);
-        // Lower is better
-        const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
-        auto newResult = PathFindingResult{ score, cost };
-        result = std::min(result, newResult);
-        if (score != 0)
+        return true;
+    }
+
+    // 0x00428237
+    // Vanilla recursed into every path of up to 8 tiles, visiting the same tiles thousands of times.
+    // Only the shortest way to a tile can give its best result, so a breadth first search over the
+    // same tiles, which also stops at the target, finds the same result visiting each tile once.
+    static PathFindingResult waterPathfindToTarget(const World::TilePos2 startPos, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles)
+    {
+        constexpr uint8_t kMaxCost = 7;
+        constexpr int32_t kSearchSize = kMaxCost * 2 + 1;
+
+        std::array<std::array<bool, kSearchSize>, kSearchSize> hasQueued{};
+        sfl::static_vector<World::TilePos2, kSearchSize * kSearchSize> queue;
+        queue.push_back(startPos);
+        hasQueued[kMaxCost][kMaxCost] = true;
+
+        PathFindingResult result{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
+        size_t costBegin = 0;
+        for (uint8_t cost = 0; costBegin < queue.size(); ++cost)
         {
-            if (cost >= 7)
-            {
-                return result;
-            }
-            cost++;
-            for (auto i = 0U; i < 4; ++i)
+            const auto costEnd = queue.size();
+            for (auto i = costBegin; i < costEnd; ++i)
             {
-                result = waterPathfindToTarget(tilePos + toTileSpace(kRotationOffset[i]), waterMicroZ, targetOrderPos, nearbyVehicles, cost, result);
+                const auto tilePos = queue[i];
+                if (!canBoatEnterTile(tilePos, waterMicroZ, nearbyVehicles))
+                {
+                    continue;
+                }
+
+                auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
+                distToTarget.x = std::abs(distToTarget.x);
+                distToTarget.y = std::abs(distToTarget.y);
+                // Lower is better
+                const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
+                result = std::min(result, PathFindingResult{ score, cost });
+                if (score == 0 || cost >= kMaxCost)
+                {
+                    continue;
+                }
+
+                for (auto j = 0U; j < 4; ++j)
+                {
+                    const auto nextPos = tilePos + toTileSpace(kRotationOffset[j]);
+                    auto& queued = hasQueued[nextPos.x - startPos.x + kMaxCost][nextPos.y - startPos.y + kMaxCost];
+                    if (!queued)
+                    {
+                        queued = true;
+                        queue.push_back(nextPos);
+                    }
+                }
             }
+            costBegin = costEnd;
         }
         return result;
     }
@@ -3844,7 +3807,7 @@ namespace OpenLoco::Vehicles
         {
             const auto tilePos = initialTile + toTileSpace(kRotationOffset[i]);
             PathFindingResult initResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
-            const auto pathResult = waterPathfindToTarget(tilePos, waterMicroZ, targetOrderPos, nearbyVehicles, 0, initResult);
+            const auto pathResult = waterPathfindToTarget(tilePos, waterMicroZ, targetOrderPos, nearbyVehicles);
             if (pathResult != initResult && (pathResult < bestResult || (pathResult == bestResult && i == curRotation)))
             {
                 bestResult = pathResult;
@@ -3879,7 +3842,7 @@ namespace OpenLoco::Vehicles
             auto randSoundIndex = gPrng1().randNext((vehObj->numStartSounds & NumStartSounds::kMask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
 
-            Vehicle2* veh2 = _vehicleUpdate_2;
+            Vehicle2* veh2 = getUpdateContext().veh2;
             Audio::playSound(randSoundId, veh2->position + World::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -4045,12 +4008,12 @@ namespace OpenLoco::Vehicles
     void VehicleHead::updateSegmentCrashed()
     {
         Vehicle train(head);
-        _vehicleUpdate_head = this;
-        _vehicleUpdate_frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
-        _vehicleUpdate_backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        getUpdateContext().head = this;
+        getUpdateContext().frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        getUpdateContext().backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
 
-        _vehicleUpdate_1 = train.veh1;
-        _vehicleUpdate_2 = train.veh2;
+        getUpdateContext().veh1 = train.veh1;
+        getUpdateContext().veh2 = train.veh2;
     }
 
     // 0x004A3EF6
@@ -4192,7 +4155,7 @@ namespace OpenLoco::Vehicles
                 compatibleStations |= (1U << i);
             }
         }
-        _vehicleUpdate_compatibleRoadStationTypes = compatibleStations;
+        getUpdateContext().compatibleRoadStationTypes = compatibleStations;
 
         {
             auto routings = RoutingManager::RingView(head.routingHandle);
@@ -6119,7 +6082,7 @@ namespace OpenLoco::Vehicles
 
         const auto requiredMods = head.var_53;
         const auto queryMods = train.veh1->var_49;
-        const auto allowedStationTypes = _vehicleUpdate_compatibleRoadStationTypes;
+        const auto allowedStationTypes = getUpdateContext().compatibleRoadStationTypes;
         Sub4AC3D3State state{};
         {
             auto [nextPos, nextRotation] = Track::getRoadConnectionEnd(World::Pos3(head.tileX, head.tileY, head.tileBaseZ * World::kSmallZStep), head.trackAndDirection.road.basicRad());
@@ -7117,8 +7080,8 @@ namespace OpenLoco::Vehicles
     bool positionVehicleOnTrack(VehicleHead& head)
     {
         Vehicle train(head);
-        _vehicleUpdate_1 = train.veh1;
-        _vehicleUpdate_2 = train.veh2;
+        getUpdateContext().veh1 = train.veh1;
+        getUpdateContext().veh2 = train.veh2;
         for (auto i = 0; i < 32; ++i)
         {
             const auto res = head.sub_4ACEE7(0, 0);
@@ -7137,7 +7100,7 @@ namespace OpenLoco::Vehicles
                     throw std::runtime_error("Expected body component");
                 }
                 auto* vehBody = veh.asVehicleBody();
-                vehBody->sub_4AC255(_vehicleUpdate_backBogie, _vehicleUpdate_frontBogie);
+                vehBody->sub_4AC255(getUpdateContext().backBogie, getUpdateContext().frontBogie);
             }
             else
             {
@@ -7166,8 +7129,8 @@ namespace OpenLoco::Vehicles
                 if (veh.isVehicleBogie())
                 {
                     auto* vehBogie = veh.asVehicleBogie();
-                    _vehicleUpdate_frontBogie = _vehicleUpdate_backBogie;
-                    _vehicleUpdate_backBogie = vehBogie;
+                    getUpdateContext().frontBogie = getUpdateContext().backBogie;
+                    getUpdateContext().backBogie = vehBogie;
                 }
             }
             veh.invalidateSprite();
@@ -13,6 +13,7 @@
 #include "OrderManager.h"
 #include "Orders.h"
 #include "RoutingManager.h"
+#include "S5/Limits.h"
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include "Vehicle.h"
@@ -27,14 +28,49 @@ namespace OpenLoco::VehicleManager
 {
     static Vehicles::SignalStateFlags _vehicleManagerIgnoreSignalFlagsMasks = 0; // Was loco_global at 0x005220BC
 
+    // Heads whose last update found them off the map, which turns their driving sounds off. Only
+    // updates of placed trains turn the sounds back on, so a set bit stays true until then. Not
+    // saved, so cleared whenever the entities are replaced wholesale by a load or a checkpoint restore.
+    static BitSet<Limits::kMaxEntities> _unplacedHeads;
+
+    // An update of a train off the map with cars only turns its driving sounds off and counts
+    // down var_5C. Once both are done the update changes nothing but its own update context, so
+    // it can be skipped until a command places the train, sells its last car or var_5C is set again.
+    static bool isIdleOffMap(Vehicles::VehicleHead& head)
+    {
+        if (!_unplacedHeads.get(enumValue(head.id)) || head.tileX != -1 || head.var_5C != 0)
+        {
+            return false;
+        }
+        auto* veh1 = head.nextVehicleComponent();
+        auto* veh2 = veh1->nextVehicleComponent();
+        return veh2->nextVehicleComponent()->getSubType() != Vehicles::VehicleEntityType::tail;
+    }
+
+    void invalidateIdleHeads()
+    {
+        _unplacedHeads.reset();
+    }
+
     // 0x004A8826
     void update()
     {
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !SceneManager::isEditorMode())
         {
+            // Vehicles must be updated one at a time in list order. Each train has its own
+            // update context, but the updates still read signal, occupancy and cargo state
+            // that earlier vehicles in the same tick may have changed.
             for (auto* v : VehicleList())
             {
+                if (isIdleOffMap(*v))
+                {
+                    continue;
+                }
+                const auto id = enumValue(v->id);
+                // Read before the update as a train without cars may delete itself
+                const bool isUnplaced = v->tileX == -1;
                 v->updateVehicle();
+                _unplacedHeads.set(id, isUnplaced);
             }
         }
     }
@@ -66,13 +102,9 @@ namespace OpenLoco::VehicleManager
     {
         uint16_t availableTypes = 0;
 
-        for (uint32_t i = 0; i < ObjectManager::getMaxObjects(ObjectType::vehicle); ++i)
+        const auto maxVehicles = ObjectManager::getMaxObjects(ObjectType::vehicle);
+        for (auto i = company.unlockedVehicles.findFirst(); i < maxVehicles; i = company.unlockedVehicles.findNext(i + 1))
         {
-            if (!company.unlockedVehicles[i])
-            {
-                continue;
-            }
-
             const auto* vehObj = ObjectManager::get<VehicleObject>(i);
             if (vehObj == nullptr)
             {
@@ -16,7 +16,7 @@ namespace OpenLoco::Vehicles
 
 namespace OpenLoco::VehicleManager
 {
-    using VehicleList = EntityManager::EntityList<EntityManager::EntityListIterator<Vehicles::VehicleHead>, EntityManager::EntityListType::vehicleHead>;
+    using VehicleList = EntityManager::VehicleHeadList<Vehicles::VehicleHead>;
 
     void update();
     void updateMonthly();
@@ -27,6 +27,9 @@ namespace OpenLoco::VehicleManager
     void deleteTrain(Vehicles::VehicleHead& head);
     void deleteCar(Vehicles::Car& car);
 
+    // Forgets which trains were found idle off the map, for when the entities have been replaced.
+    void invalidateIdleHeads();
+
     enum class PlaceDownResult
     {
         Okay,
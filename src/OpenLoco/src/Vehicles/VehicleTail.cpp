@@ -6,7 +6,6 @@
 #include "Map/Track/TrackData.h"
 #include "RoutingManager.h"
 #include "Vehicle.h"
-#include "ViewportManager.h"
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Literals;
@@ -14,7 +13,6 @@ using namespace OpenLoco::World;
 
 namespace OpenLoco::Vehicles
 {
-    static int32_t _vehicleUpdate_var_113612C = 0; // Was loco_global at 0x0113612C
 
     // 0x004794BC
     // This is enter level crossing if unk==8 and leave level crossing if unk==9
@@ -34,6 +32,7 @@ namespace OpenLoco::Vehicles
         auto& trackPiece = World::TrackData::getTrackPiece(trackAndDirection.id());
         levelCrossingLoc += World::Pos3{ Math::Vector::rotate(World::Pos2{ trackPiece[0].x, trackPiece[0].y }, trackAndDirection.cardinalDirection()), 0 };
         levelCrossingLoc.z += trackPiece[0].z;
+        bool hasChanged = false;
         auto tile = World::TileManager::get(levelCrossingLoc);
         for (auto& el : tile)
         {
@@ -53,17 +52,25 @@ namespace OpenLoco::Vehicles
                 continue;
             }
 
-            road->setUnk7_10(false);
-            if (unk != 8)
+            const bool isClosing = unk == 8;
+            if (road->hasUnk7_10() != isClosing)
+            {
+                road->setUnk7_10(isClosing);
+                hasChanged = true;
+            }
+            if (!isClosing)
             {
                 continue;
             }
-            road->setUnk7_10(true);
 
             World::AnimationManager::createAnimation(1, levelCrossingLoc, levelCrossingLoc.z / 4);
         }
 
-        Ui::ViewportManager::invalidate(levelCrossingLoc, levelCrossingLoc.z, levelCrossingLoc.z + 32, ZoomLevel::full);
+        // Only the frame of the crossing is drawn, which the animation changes and invalidates
+        if (hasChanged)
+        {
+            World::TileManager::markTileChanged(levelCrossingLoc);
+        }
     }
 
     // 0x004AA24A
@@ -78,7 +85,7 @@ namespace OpenLoco::Vehicles
         const World::Pos3 _oldTilePos = World::Pos3(tileX, tileY, tileBaseZ * World::kSmallZStep);
 
         resetUpdateVar1136114Flags();
-        updateTrackMotion(_vehicleUpdate_var_113612C);
+        updateTrackMotion(getUpdateContext().var_113612C);
 
         if (hasUpdateVar1136114Flags(UpdateVar1136114Flags::noRouteFound))
         {
@@ -1,11 +1,14 @@
 #include "Viewport.hpp"
 #include "Config.h"
+#include "Graphics/FPSCounter.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/ImageIds.h"
 #include "Graphics/RenderTarget.h"
+#include "Graphics/SoftwareDrawingContext.h"
 #include "Graphics/SoftwareDrawingEngine.h"
 #include "Graphics/TextRenderer.h"
 #include "Input.h"
+#include "LabelFrame.h"
 #include "Localisation/FormatArguments.hpp"
 #include "Localisation/Formatting.h"
 #include "Map/MapSelection.h"
@@ -19,10 +22,18 @@
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/Orders.h"
 #include "Vehicles/VehicleManager.h"
+#include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -52,11 +63,81 @@ namespace OpenLoco::Ui
             return;
         }
         auto intersection = uiRect.intersection(viewRect);
+        Core::Timer timer;
         paint(drawingCtx, screenToViewport(intersection));
+        ViewportManager::recordPaintTime(*this, timer.elapsed());
+    }
+
+    // Labels whose frames intersect the painted area. Gathered once per paint so each column
+    // only tests these rather than every station, town and order, and the routing number
+    // strings are formatted once rather than once per column.
+    struct VisibleLabels
+    {
+        std::vector<const Station*> stations;
+        std::vector<Town*> towns;
+        std::vector<std::pair<const LabelFrame*, std::string>> routingNumbers;
+    };
+
+    static void gatherVisibleLabels(VisibleLabels& labels, const Gfx::RenderTarget& rt, const Paint::SessionOptions& options)
+    {
+        const auto drawableRect = rt.getDrawableRect();
+
+        if (!SceneManager::isTitleMode())
+        {
+            if (!options.hasFlags(ViewportFlags::station_names_displayed) && rt.zoomLevel <= Config::get().stationNamesMinScale)
+            {
+                for (const auto& station : StationManager::stations())
+                {
+                    if ((station.flags & StationFlags::flag_5) != StationFlags::none)
+                    {
+                        continue;
+                    }
+                    if (station.labelFrame.contains(drawableRect, rt.zoomLevel))
+                    {
+                        labels.stations.push_back(&station);
+                    }
+                }
+            }
+            if (!options.hasFlags(ViewportFlags::town_names_displayed))
+            {
+                for (auto& town : TownManager::towns())
+                {
+                    if (town.labelFrame.contains(drawableRect, rt.zoomLevel))
+                    {
+                        labels.towns.push_back(&town);
+                    }
+                }
+            }
+        }
+
+        if (World::hasMapSelectionFlag(World::MapSelectionFlags::unk_04))
+        {
+            auto orderNum = 0;
+            for (auto& orderFrame : Vehicles::OrderManager::displayFrames())
+            {
+                auto orderRing = Vehicles::OrderRingView(orderFrame.orderOffset);
+                auto* order = orderRing.atIndex(0);
+                if (!order || !order->hasFlags(Vehicles::OrderFlags::HasNumber))
+                {
+                    continue;
+                }
+                orderNum++;
+                if (!orderFrame.frame.contains(drawableRect, rt.zoomLevel))
+                {
+                    continue;
+                }
+                auto res = Vehicles::OrderManager::generateOrderUiStringAndLoc(orderFrame.orderOffset, orderNum);
+                if (res.second.empty())
+                {
+                    continue;
+                }
+                labels.routingNumbers.emplace_back(&orderFrame.frame, std::move(res.second));
+            }
+        }
     }
 
     // 0x0048DE97
-    static void drawStationNames(Gfx::DrawingContext& drawingCtx)
+    static void drawStationNames(Gfx::DrawingContext& drawingCtx, std::span<const Station* const> stations)
     {
         const auto& rt = drawingCtx.currentRenderTarget();
 
@@ -69,24 +150,19 @@ namespace OpenLoco::Ui
 
         drawingCtx.pushRenderTarget(unZoomedRt);
 
-        for (const auto& station : StationManager::stations())
+        for (const auto* station : stations)
         {
-            if ((station.flags & StationFlags::flag_5) != StationFlags::none)
-            {
-                continue;
-            }
-
             bool isHovered = (World::hasMapSelectionFlag(World::MapSelectionFlags::hoveringOverStation))
-                && (station.id() == Input::getHoveredStationId());
+                && (station->id() == Input::getHoveredStationId());
 
-            drawStationName(drawingCtx, station, rt.zoomLevel, isHovered);
+            drawStationName(drawingCtx, *station, rt.zoomLevel, isHovered);
         }
 
         drawingCtx.popRenderTarget();
     }
 
     // 0x004977E5
-    static void drawTownNames(Gfx::DrawingContext& drawingCtx)
+    static void drawTownNames(Gfx::DrawingContext& drawingCtx, std::span<Town* const> towns)
     {
         const auto& rt = drawingCtx.currentRenderTarget();
 
@@ -99,18 +175,18 @@ namespace OpenLoco::Ui
 
         drawingCtx.pushRenderTarget(unZoomedRt);
 
-        for (auto& town : TownManager::towns())
+        for (auto* town : towns)
         {
-            town.drawLabel(drawingCtx, rt);
+            town->drawLabel(drawingCtx, rt);
         }
 
         drawingCtx.popRenderTarget();
     }
 
     // 0x00470A62
-    static void drawRoutingNumbers(Gfx::DrawingContext& drawingCtx)
+    static void drawRoutingNumbers(Gfx::DrawingContext& drawingCtx, std::span<const std::pair<const LabelFrame*, std::string>> routingNumbers)
     {
-        if (!World::hasMapSelectionFlag(World::MapSelectionFlags::unk_04))
+        if (routingNumbers.empty())
         {
             return;
         }
@@ -128,39 +204,44 @@ namespace OpenLoco::Ui
 
         auto tr = Gfx::TextRenderer(drawingCtx);
 
-        auto orderNum = 0;
-        for (auto& orderFrame : Vehicles::OrderManager::displayFrames())
+        for (const auto& [frame, orderString] : routingNumbers)
         {
-            auto orderRing = Vehicles::OrderRingView(orderFrame.orderOffset);
-            auto* order = orderRing.atIndex(0);
-            if (!order || !order->hasFlags(Vehicles::OrderFlags::HasNumber))
-            {
-                continue;
-            }
-            orderNum++;
-            if (!orderFrame.frame.contains(rt.getDrawableRect(), rt.zoomLevel))
-            {
-                continue;
-            }
-            auto res = Vehicles::OrderManager::generateOrderUiStringAndLoc(orderFrame.orderOffset, orderNum);
-            auto& orderString = res.second;
-            if (orderString.empty())
+            if (!frame->contains(rt.getDrawableRect(), rt.zoomLevel))
             {
                 continue;
             }
 
             tr.setCurrentFont(Gfx::Font::medium_normal);
 
-            auto point = Point(orderFrame.frame.left[rt.zoomLevel] + 1, orderFrame.frame.top[rt.zoomLevel]);
+            auto point = Point(frame->left[rt.zoomLevel] + 1, frame->top[rt.zoomLevel]);
             tr.drawString(point, AdvancedColour(Colour::white).outline(), const_cast<char*>(orderString.c_str()));
         }
 
         drawingCtx.popRenderTarget();
     }
 
+    // Spawning threads is only worthwhile when each of them gets a few columns to paint.
+    static constexpr size_t kMinColumnsPerPaintThread = 4;
+
+    // Text drawing goes through the shared window colours and string buffers, so columns take
+    // turns drawing their labels.
+    static std::mutex _paintTextMutex;
+
+    static size_t getPaintThreadCount(size_t numColumns)
+    {
+        size_t numThreads = std::max(Config::get().viewportPaintThreads, 0);
+        if (numThreads == 0)
+        {
+            numThreads = std::thread::hardware_concurrency();
+        }
+        return std::clamp<size_t>(numThreads, 1, std::max<size_t>(numColumns / kMinColumnsPerPaintThread, 1));
+    }
+
     // 0x0045A1A4
     void Viewport::paint(Gfx::DrawingContext& drawingCtx, const Rect& rect)
     {
+        Gfx::FramePhaseTimer frameTimer(Gfx::FramePhase::paint);
+
         const auto& rt = drawingCtx.currentRenderTarget();
 
         Paint::SessionOptions options{};
@@ -206,8 +287,7 @@ namespace OpenLoco::Ui
         auto alignedX = zoomViewRt.x & ~0x1F;
 
         // Drawing is performed in columns of 32 pixels (1 tile wide)
-
-        // Generate and sort columns.
+        std::vector<Gfx::RenderTarget> columns;
         for (auto columnX = alignedX; columnX < rightBorder; columnX += 32)
         {
             Gfx::RenderTarget columnRt = zoomViewRt;
@@ -229,37 +309,69 @@ namespace OpenLoco::Ui
             }
 
             columnRt.width = paintRight - columnRt.x;
+            columns.push_back(columnRt);
+        }
+
+        VisibleLabels labels;
+        gatherVisibleLabels(labels, zoomViewRt, options);
 
-            drawingCtx.pushRenderTarget(columnRt);
+        // Generate, sort and draw a column.
+        auto paintColumn = [&](Gfx::DrawingContext& columnCtx, const Gfx::RenderTarget& columnRt) {
+            columnCtx.pushRenderTarget(columnRt);
 
             {
-                drawingCtx.clearSingle(fillColour);
+                columnCtx.clearSingle(fillColour);
                 auto sess = Paint::PaintSession(columnRt, options);
                 sess.generate();
                 sess.arrangeStructs();
-                sess.drawStructs(drawingCtx);
+                sess.drawStructs(columnCtx);
                 // Climate code used to draw here.
 
-                if (!SceneManager::isTitleMode())
-                {
-                    if (!options.hasFlags(ViewportFlags::station_names_displayed))
-                    {
-                        if (columnRt.zoomLevel <= Config::get().stationNamesMinScale)
-                        {
-                            drawStationNames(drawingCtx);
-                        }
-                    }
-                    if (!options.hasFlags(ViewportFlags::town_names_displayed))
-                    {
-                        drawTownNames(drawingCtx);
-                    }
-                }
+                std::lock_guard lock(_paintTextMutex);
+                drawStationNames(columnCtx, labels.stations);
+                drawTownNames(columnCtx, labels.towns);
+
+                sess.drawStringStructs(columnCtx);
+                drawRoutingNumbers(columnCtx, labels.routingNumbers);
+            }
+
+            columnCtx.popRenderTarget();
+        };
+
+        const auto numThreads = getPaintThreadCount(columns.size());
+        if (numThreads == 1)
+        {
+            for (const auto& columnRt : columns)
+            {
+                paintColumn(drawingCtx, columnRt);
+            }
+            return;
+        }
 
-                sess.drawStringStructs(drawingCtx);
-                drawRoutingNumbers(drawingCtx);
+        // Columns cover separate pixels so they can be painted in any order. Each thread takes the
+        // next unpainted column and draws it through a drawing context of its own.
+        std::atomic<size_t> nextColumn = 0;
+        auto paintColumns = [&](Gfx::DrawingContext& columnCtx) {
+            for (auto i = nextColumn++; i < columns.size(); i = nextColumn++)
+            {
+                paintColumn(columnCtx, columns[i]);
             }
+        };
 
-            drawingCtx.popRenderTarget();
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads - 1);
+        for (size_t i = 1; i < numThreads; i++)
+        {
+            workers.emplace_back([&paintColumns]() {
+                Gfx::SoftwareDrawingContext workerCtx;
+                paintColumns(workerCtx);
+            });
+        }
+        paintColumns(drawingCtx);
+
+        for (auto& worker : workers)
+        {
+            worker.join();
         }
     }
 
@@ -43,6 +43,16 @@ namespace OpenLoco::Ui
         {
             return (left < vpos.x && top < vpos.y && right >= vpos.x && bottom >= vpos.y);
         }
+
+        constexpr ViewportRect getUnion(const ViewportRect& rect) const
+        {
+            auto out = ViewportRect();
+            out.left = std::min(left, rect.left);
+            out.top = std::min(top, rect.top);
+            out.right = std::max(right, rect.right);
+            out.bottom = std::max(bottom, rect.bottom);
+            return out;
+        }
     };
 
     enum class ViewportFlags : uint16_t
@@ -4,7 +4,10 @@
 #include "Logging.h"
 #include "Map/MapSelection.h"
 #include "Map/Tile.h"
+#include "Map/TileLoop.hpp"
 #include "Map/TileManager.h"
+#include "Paint/PaintRoad.h"
+#include "Paint/PaintSignal.h"
 #include "Ui/ViewportInteraction.h"
 #include "Ui/Window.h"
 #include "Ui/WindowManager.h"
@@ -12,9 +15,12 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <algorithm>
 #include <cassert>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <ranges>
 #include <sfl/static_vector.hpp>
+#include <vector>
 
 using namespace OpenLoco::Ui;
 using namespace OpenLoco::Interop;
@@ -24,9 +30,61 @@ namespace OpenLoco::Ui::ViewportManager
 {
     static sfl::static_vector<Viewport, kMaxViewports> _viewports{};
 
+    struct ScreenRect
+    {
+        int32_t left;
+        int32_t top;
+        int32_t right;
+        int32_t bottom;
+
+        int64_t getArea() const
+        {
+            return static_cast<int64_t>(right - left) * (bottom - top);
+        }
+    };
+
+    // Entity invalidations are collected here and merged before the frame is rendered, moving trains
+    // invalidate every car before and after each move so most of the rects overlap.
+    static constexpr size_t kMaxPendingEntityRects = 16384;
+    static std::vector<ScreenRect> _pendingEntityRects;
+    static std::vector<ScreenRect> _mergedEntityRects;
+    static EntityInvalidationStats _lastEntityInvalidationStats;
+
+    // Viewport paint time above which the entity invalidations of viewports other than the main one
+    // are only applied every few frames, leaving a frame at 40 FPS room for the tick and the rest.
+    static constexpr float kPaintBudgetMs = 18.0f;
+    static constexpr uint32_t kReducedRefreshInterval = 4;
+    // Weight of the latest frame in the averaged paint times.
+    static constexpr float kPaintTimeSmoothing = 0.1f;
+
+    // Entity invalidations of a secondary viewport held back while over budget, kept in view
+    // coordinates so they stay correct when the viewport scrolls in the meantime.
+    struct DeferredEntityRect
+    {
+        uint16_t viewportIndex;
+        ViewportRect rect;
+    };
+
+    static std::array<float, kMaxViewports> _framePaintTimes{};
+    static std::array<float, kMaxViewports> _averagePaintTimes{};
+    static std::vector<DeferredEntityRect> _deferredEntityRects;
+    static const Viewport* _mainViewport = nullptr;
+    static bool _isReducedRefresh = false;
+    static uint32_t _frameCount = 0;
+
     void init()
     {
         _viewports.clear();
+        _pendingEntityRects.clear();
+        _deferredEntityRects.clear();
+        _framePaintTimes.fill(0.0f);
+        _averagePaintTimes.fill(0.0f);
+        _isReducedRefresh = false;
+    }
+
+    static uint16_t getViewportIndex(const Viewport& viewport)
+    {
+        return static_cast<uint16_t>(&viewport - _viewports.data());
     }
 
     static Viewport* allocate()
@@ -54,6 +112,11 @@ namespace OpenLoco::Ui::ViewportManager
         assert(vp->isValid());
 
         vp->width = 0;
+        _framePaintTimes[getViewportIndex(*vp)] = 0.0f;
+        _averagePaintTimes[getViewportIndex(*vp)] = 0.0f;
+        std::erase_if(_deferredEntityRects, [index = getViewportIndex(*vp)](const DeferredEntityRect& deferred) {
+            return deferred.viewportIndex == index;
+        });
         while (!_viewports.empty() && _viewports.back().width == 0)
         {
             _viewports.pop_back();
@@ -183,7 +246,34 @@ namespace OpenLoco::Ui::ViewportManager
         return viewport;
     }
 
-    static void invalidate(const ViewportRect& rect, ZoomLevel zoom)
+    // The part of the view rect within the viewport in screen coordinates, the rect has to intersect the viewport.
+    static ScreenRect toScreenRect(Viewport& viewport, const ViewportRect& rect)
+    {
+        auto intersection = viewport.getIntersection(rect);
+
+        // offset rect by (negative) viewport origin
+        int16_t left = intersection.left - viewport.viewX;
+        int16_t right = intersection.right - viewport.viewX;
+        int16_t top = intersection.top - viewport.viewY;
+        int16_t bottom = intersection.bottom - viewport.viewY;
+
+        // apply zoom
+        left = left >> viewport.zoom;
+        right = right >> viewport.zoom;
+        top = top >> viewport.zoom;
+        bottom = bottom >> viewport.zoom;
+
+        // offset calculated area by viewport offset
+        left += viewport.x;
+        right += viewport.x;
+        top += viewport.y;
+        bottom += viewport.y;
+
+        return { left, top, right, bottom };
+    }
+
+    template<typename TFunc>
+    static void forEachViewport(const ViewportRect& rect, ZoomLevel zoom, TFunc&& func)
     {
         for (auto& viewport : _viewports)
         {
@@ -204,28 +294,24 @@ namespace OpenLoco::Ui::ViewportManager
                 continue;
             }
 
-            auto intersection = viewport.getIntersection(rect);
-
-            // offset rect by (negative) viewport origin
-            int16_t left = intersection.left - viewport.viewX;
-            int16_t right = intersection.right - viewport.viewX;
-            int16_t top = intersection.top - viewport.viewY;
-            int16_t bottom = intersection.bottom - viewport.viewY;
-
-            // apply zoom
-            left = left >> viewport.zoom;
-            right = right >> viewport.zoom;
-            top = top >> viewport.zoom;
-            bottom = bottom >> viewport.zoom;
+            func(viewport);
+        }
+    }
 
-            // offset calculated area by viewport offset
-            left += viewport.x;
-            right += viewport.x;
-            top += viewport.y;
-            bottom += viewport.y;
+    template<typename TFunc>
+    static void forEachScreenRect(const ViewportRect& rect, ZoomLevel zoom, TFunc&& func)
+    {
+        forEachViewport(rect, zoom, [&](Viewport& viewport) {
+            const auto screenRect = toScreenRect(viewport, rect);
+            func(screenRect.left, screenRect.top, screenRect.right, screenRect.bottom);
+        });
+    }
 
+    static void invalidate(const ViewportRect& rect, ZoomLevel zoom)
+    {
+        forEachScreenRect(rect, zoom, [](int32_t left, int32_t top, int32_t right, int32_t bottom) {
             Gfx::invalidateRegion(left, top, right, bottom);
-        }
+        });
     }
 
     // 0x004CBA2D
@@ -279,6 +365,52 @@ namespace OpenLoco::Ui::ViewportManager
         }
     }
 
+    bool isVisible(const EntityBase* t, int16_t margin)
+    {
+        if (t->spriteLeft == Location::null)
+        {
+            return false;
+        }
+
+        for (const auto& viewport : _viewports)
+        {
+            if (viewport.isValid() == 0)
+            {
+                continue;
+            }
+
+            // The margin is given in screen pixels, scale it to the view.
+            const int32_t viewMargin = margin << viewport.zoom;
+            if (t->spriteRight + viewMargin <= viewport.viewX
+                || t->spriteBottom + viewMargin <= viewport.viewY
+                || t->spriteLeft - viewMargin >= viewport.viewX + viewport.viewWidth
+                || t->spriteTop - viewMargin >= viewport.viewY + viewport.viewHeight)
+            {
+                continue;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // Moves the held back rects of the secondary viewports to the pending rects, at the viewport's current view.
+    static void applyDeferredEntityRects()
+    {
+        for (const auto& deferred : _deferredEntityRects)
+        {
+            if (deferred.viewportIndex >= _viewports.size())
+            {
+                continue;
+            }
+            auto& viewport = _viewports[deferred.viewportIndex];
+            if (viewport.isValid() && viewport.intersects(deferred.rect))
+            {
+                _pendingEntityRects.push_back(toScreenRect(viewport, deferred.rect));
+            }
+        }
+        _deferredEntityRects.clear();
+    }
+
     /**
      * 0x004CBB01 (eight)
      * 0x004CBBD2 (quarter)
@@ -302,11 +434,168 @@ namespace OpenLoco::Ui::ViewportManager
         rect.bottom = t->spriteBottom;
 
         auto level = (ZoomLevel)std::min(Config::get().vehiclesMinScale, (uint8_t)zoom);
-        invalidate(rect, level);
+        forEachViewport(rect, level, [&rect](Viewport& viewport) {
+            if (_isReducedRefresh && &viewport != _mainViewport)
+            {
+                _deferredEntityRects.push_back({ getViewportIndex(viewport), rect });
+                return;
+            }
+            _pendingEntityRects.push_back(toScreenRect(viewport, rect));
+        });
+
+        // Nothing is rendered while the window is minimised, so don't let the rects pile up
+        if (_deferredEntityRects.size() >= kMaxPendingEntityRects)
+        {
+            applyDeferredEntityRects();
+        }
+        if (_pendingEntityRects.size() >= kMaxPendingEntityRects)
+        {
+            flushEntityInvalidations();
+        }
+    }
+
+    // Merges two rects when their bounds cover no more than the two rects do apart, which holds for
+    // rects that overlap by at least as much as the bounds add.
+    static bool tryMerge(ScreenRect& merged, const ScreenRect& rect)
+    {
+        const ScreenRect bounds = {
+            std::min(merged.left, rect.left),
+            std::min(merged.top, rect.top),
+            std::max(merged.right, rect.right),
+            std::max(merged.bottom, rect.bottom),
+        };
+        if (bounds.getArea() > merged.getArea() + rect.getArea())
+        {
+            return false;
+        }
+        merged = bounds;
+        return true;
+    }
+
+    void flushEntityInvalidations()
+    {
+        if (!_isReducedRefresh || _frameCount % kReducedRefreshInterval == 0)
+        {
+            applyDeferredEntityRects();
+        }
+
+        _lastEntityInvalidationStats = EntityInvalidationStats{};
+        _lastEntityInvalidationStats.numRequested = static_cast<uint32_t>(_pendingEntityRects.size());
+
+        // Swept from the top, a merged rect that ends above the next rect can't take any more rects
+        std::ranges::sort(_pendingEntityRects, {}, &ScreenRect::top);
+        _mergedEntityRects.clear();
+        size_t firstOpen = 0;
+        for (const auto& rect : _pendingEntityRects)
+        {
+            while (firstOpen < _mergedEntityRects.size() && _mergedEntityRects[firstOpen].bottom < rect.top)
+            {
+                firstOpen++;
+            }
+
+            bool isMerged = false;
+            for (auto i = firstOpen; i < _mergedEntityRects.size() && !isMerged; i++)
+            {
+                isMerged = tryMerge(_mergedEntityRects[i], rect);
+            }
+            if (!isMerged)
+            {
+                _mergedEntityRects.push_back(rect);
+            }
+        }
+
+        for (const auto& rect : _mergedEntityRects)
+        {
+            Gfx::invalidateRegion(rect.left, rect.top, rect.right, rect.bottom);
+        }
+
+        _lastEntityInvalidationStats.numApplied = static_cast<uint32_t>(_mergedEntityRects.size());
+        _pendingEntityRects.clear();
+    }
+
+    EntityInvalidationStats getEntityInvalidationStats()
+    {
+        return _lastEntityInvalidationStats;
+    }
+
+    void recordPaintTime(const Viewport& viewport, float elapsedMs)
+    {
+        _framePaintTimes[getViewportIndex(viewport)] += elapsedMs;
+    }
+
+    void updateRenderBudget()
+    {
+        _mainViewport = WindowManager::getMainViewport();
+        _frameCount++;
+
+        float mainPaintTime = 0.0f;
+        float secondaryPaintTime = 0.0f;
+        for (auto& viewport : _viewports)
+        {
+            const auto index = getViewportIndex(viewport);
+            auto& average = _averagePaintTimes[index];
+            average += (_framePaintTimes[index] - average) * kPaintTimeSmoothing;
+            _framePaintTimes[index] = 0.0f;
+
+            if (!viewport.isValid())
+            {
+                continue;
+            }
+            if (&viewport == _mainViewport)
+            {
+                mainPaintTime += average;
+            }
+            else
+            {
+                secondaryPaintTime += average;
+            }
+        }
+
+        // The secondary viewports paint less often while refreshed at the reduced rate, estimate what
+        // they would take at the full rate so the rate doesn't flip back and forth.
+        if (_isReducedRefresh)
+        {
+            secondaryPaintTime *= kReducedRefreshInterval;
+        }
+        _isReducedRefresh = secondaryPaintTime > 0.0f && mainPaintTime + secondaryPaintTime > kPaintBudgetMs;
+    }
+
+    ViewportPaintStats getPaintStats()
+    {
+        ViewportPaintStats stats{};
+        stats.isReducedRefresh = _isReducedRefresh;
+
+        std::vector<float> secondaryPaintTimes;
+        for (auto& viewport : _viewports)
+        {
+            if (!viewport.isValid())
+            {
+                continue;
+            }
+            const auto paintTime = _averagePaintTimes[getViewportIndex(viewport)];
+            if (&viewport == _mainViewport)
+            {
+                stats.mainMs = paintTime;
+            }
+            else
+            {
+                secondaryPaintTimes.push_back(paintTime);
+            }
+        }
+
+        // Only the slowest are listed
+        std::ranges::sort(secondaryPaintTimes, std::greater{});
+        stats.numSecondary = static_cast<uint32_t>(secondaryPaintTimes.size());
+        stats.numListed = static_cast<uint32_t>(std::min(secondaryPaintTimes.size(), stats.secondaryMs.size()));
+        std::copy_n(secondaryPaintTimes.begin(), stats.numListed, stats.secondaryMs.begin());
+        return stats;
     }
 
     void invalidate(const World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom, int radius)
     {
+        // Every modification of a tile redraws it through here.
+        World::TileManager::markTileChanged(pos);
+
         auto axbx = World::gameToScreen(World::Pos3(pos.x + 16, pos.y + 16, zMax), WindowManager::getCurrentRotation());
         axbx.x -= radius;
         axbx.y -= radius;
@@ -322,4 +611,66 @@ namespace OpenLoco::Ui::ViewportManager
 
         invalidate(rect, zoom);
     }
+
+    void invalidate(const World::Pos2 min, const World::Pos2 max, coord_t zMin, coord_t zMax, ZoomLevel zoom, int radius)
+    {
+        for (const auto& tilePos : World::getClampedRange(World::toTileSpace(min), World::toTileSpace(max)))
+        {
+            World::TileManager::markTileChanged(World::toWorldSpace(tilePos));
+        }
+
+        // The rectangle that holds the projections of all corners of the region
+        const auto rotation = WindowManager::getCurrentRotation();
+        int32_t left = std::numeric_limits<int32_t>::max();
+        int32_t top = std::numeric_limits<int32_t>::max();
+        int32_t right = std::numeric_limits<int32_t>::min();
+        int32_t bottom = std::numeric_limits<int32_t>::min();
+        for (const auto x : { min.x, max.x })
+        {
+            for (const auto y : { min.y, max.y })
+            {
+                const auto upper = World::gameToScreen(World::Pos3(x + 16, y + 16, zMax), rotation);
+                const auto lower = World::gameToScreen(World::Pos3(x + 16, y + 16, zMin), rotation);
+                left = std::min<int32_t>(left, upper.x - radius);
+                top = std::min<int32_t>(top, upper.y - radius);
+                right = std::max<int32_t>(right, lower.x + radius);
+                bottom = std::max<int32_t>(bottom, lower.y + radius);
+            }
+        }
+
+        ViewportRect rect = {};
+        rect.left = left;
+        rect.top = top;
+        rect.right = right;
+        rect.bottom = bottom;
+        invalidate(rect, zoom);
+    }
+
+    static void invalidateSprite(const World::Pos2 pos, ViewportRect rect, ZoomLevel zoom)
+    {
+        World::TileManager::markTileChanged(pos);
+
+        // Covers the rounding of the rect in the zoomed out viewports
+        rect.right += 1 << static_cast<uint8_t>(zoom);
+        rect.bottom += 1 << static_cast<uint8_t>(zoom);
+        invalidate(rect, zoom);
+    }
+
+    void invalidateSignal(const World::Pos2 pos, const World::SignalElement& elSignal, bool isRight)
+    {
+        // Signals are not painted any further zoomed out
+        if (auto bounds = Paint::getSignalSideScreenBounds(elSignal, pos, isRight, WindowManager::getCurrentRotation()))
+        {
+            invalidateSprite(pos, *bounds, ZoomLevel::half);
+        }
+    }
+
+    void invalidateLevelCrossing(const World::Pos2 pos, const World::RoadElement& elRoad, uint8_t frame)
+    {
+        // Level crossings are not painted any further zoomed out
+        if (auto bounds = Paint::getLevelCrossingScreenBounds(elRoad, pos, frame, WindowManager::getCurrentRotation()))
+        {
+            invalidateSprite(pos, *bounds, ZoomLevel::half);
+        }
+    }
 }
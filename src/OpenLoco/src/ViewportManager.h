@@ -7,6 +7,12 @@
 #include "World/Station.h"
 #include <array>
 
+namespace OpenLoco::World
+{
+    struct RoadElement;
+    struct SignalElement;
+}
+
 namespace OpenLoco::Ui::ViewportManager
 {
     constexpr size_t kMaxViewports = 256;
@@ -17,6 +23,42 @@ namespace OpenLoco::Ui::ViewportManager
     Viewport* create(Window* window, int viewportIndex, Ui::Point origin, Ui::Size size, ZoomLevel zoom, World::Pos3 tile);
     void destroy(Viewport* vp);
     void invalidate(Station* station);
+    // Entity invalidations are deferred until flushEntityInvalidations, which merges overlapping rects.
     void invalidate(EntityBase* t, ZoomLevel zoom);
+    // Whether the sprite of the entity is within any viewport, expanded by margin screen pixels.
+    bool isVisible(const EntityBase* t, int16_t margin);
     void invalidate(World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom = ZoomLevel::eighth, int radius = 32);
+    // Invalidates all tiles from min to max inclusive with a single rectangle.
+    void invalidate(World::Pos2 min, World::Pos2 max, coord_t zMin, coord_t zMax, ZoomLevel zoom = ZoomLevel::eighth, int radius = 32);
+    // Invalidates only the sprites of one side of the signal, for changes to its frame or lights.
+    void invalidateSignal(World::Pos2 pos, const World::SignalElement& elSignal, bool isRight);
+    // Invalidates only the level crossing sprites of the road element, for its current frame and frame.
+    void invalidateLevelCrossing(World::Pos2 pos, const World::RoadElement& elRoad, uint8_t frame);
+
+    // Counts of the entity rects merged by the last flush.
+    struct EntityInvalidationStats
+    {
+        uint32_t numRequested{};
+        uint32_t numApplied{};
+    };
+
+    // Applies the entity invalidations requested since the last call, done once per frame before rendering.
+    void flushEntityInvalidations();
+    EntityInvalidationStats getEntityInvalidationStats();
+
+    // Averaged paint times of the viewports, the secondary ones slowest first.
+    struct ViewportPaintStats
+    {
+        float mainMs{};
+        std::array<float, 4> secondaryMs{};
+        uint32_t numListed{};
+        uint32_t numSecondary{};
+        bool isReducedRefresh{};
+    };
+
+    void recordPaintTime(const Viewport& viewport, float elapsedMs);
+    // Called once per frame before rendering. While the viewports take longer to paint than the
+    // budget, the entity invalidations of all but the main viewport are only applied every few frames.
+    void updateRenderBudget();
+    ViewportPaintStats getPaintStats();
 }
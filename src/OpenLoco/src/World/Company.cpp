@@ -526,32 +526,58 @@ namespace OpenLoco
         setHeadquartersVariation(getHeadquarterPerformanceVariation());
     }
 
-    // 0x00437C8C
-    static int16_t calculatePerformanceIndex(const Company& company)
+    // Walks the vehicle list once for every company rather than once per company and calculation.
+    // Each company's trains are still visited in list order so the saturating sum matches vanilla.
+    CompanyVehicleTotalsArray calculateCompanyVehicleTotals()
     {
-        if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
-        {
-            return 0;
-        }
-
-        currency32_t totalProfit = 0;
+        CompanyVehicleTotalsArray totals{};
         for (auto head : VehicleManager::VehicleList())
         {
-            if (head->owner != company.id())
+            const auto ownerId = enumValue(head->owner);
+            if (ownerId >= totals.size())
             {
                 continue;
             }
+            auto& companyTotals = totals[ownerId];
 
             Vehicles::Vehicle train(*head);
+            const currency32_t recentProfit = train.veh2->totalRecentProfit();
+
             // Unsure why >> 1, /2
             // Note: To match vanilla using >> 1. Use /2 when diverging allowed.
-            currency32_t trainProfit = train.veh2->totalRecentProfit() >> 1;
-            if (static_cast<int64_t>(totalProfit) + trainProfit < std::numeric_limits<currency32_t>::max())
+            currency32_t performanceProfit = recentProfit >> 1;
+            if (static_cast<int64_t>(companyTotals.performanceProfit) + performanceProfit < std::numeric_limits<currency32_t>::max())
             {
-                totalProfit += trainProfit;
+                companyTotals.performanceProfit += performanceProfit;
             }
+
+            if (head->has38Flags(Vehicles::Flags38::isGhost))
+            {
+                continue;
+            }
+
+            // Unsure why >>2, /4
+            // Note: To match vanilla using >> 2. Use /4 when diverging allowed.
+            companyTotals.vehicleProfit += recentProfit >> 2;
+
+            companyTotals.vehicleValue += recentProfit * 8;
+            for (auto& car : train.cars)
+            {
+                companyTotals.vehicleValue += car.front->refundCost;
+            }
+        }
+        return totals;
+    }
+
+    // 0x00437C8C
+    static int16_t calculatePerformanceIndex(const Company& company, const CompanyVehicleTotals& vehicleTotals)
+    {
+        if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
+        {
+            return 0;
         }
-        totalProfit = std::max(0, totalProfit);
+
+        const currency32_t totalProfit = std::max(0, vehicleTotals.performanceProfit);
 
         const auto partialProfitFactor = Math::Vector::fastSquareRoot(totalProfit) * 75;
         const auto ecoFactor = Math::Vector::fastSquareRoot(Economy::getCurrencyMultiplicationFactor(0));
@@ -567,7 +593,7 @@ namespace OpenLoco
     }
 
     // 0x00437D79
-    ProfitAndValue calculateCompanyValue(const Company& company)
+    static ProfitAndValue calculateCompanyValue(const Company& company, const CompanyVehicleTotals& vehicleTotals)
     {
         if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
         {
@@ -576,34 +602,15 @@ namespace OpenLoco
 
         currency48_t totalValue = company.cash;
         totalValue -= company.currentLoan;
-
-        currency48_t totalVehicleProfit = 0;
-        for (auto head : VehicleManager::VehicleList())
-        {
-            if (head->owner != company.id())
-            {
-                continue;
-            }
-            if (head->has38Flags(Vehicles::Flags38::isGhost))
-            {
-                continue;
-            }
-
-            Vehicles::Vehicle train(*head);
-            currency32_t trainProfit = train.veh2->totalRecentProfit();
-            // Unsure why >>2, /4
-            // Note: To match vanilla using >> 2. Use /4 when diverging allowed.
-            totalVehicleProfit += trainProfit >> 2;
-
-            totalValue += trainProfit * 8;
-
-            for (auto& car : train.cars)
-            {
-                totalValue += car.front->refundCost;
-            }
-        }
+        totalValue += vehicleTotals.vehicleValue;
         totalValue = std::max<currency48_t>(0, totalValue);
-        return { totalVehicleProfit, totalValue };
+        return { vehicleTotals.vehicleProfit, totalValue };
+    }
+
+    ProfitAndValue calculateCompanyValue(const Company& company)
+    {
+        const auto totals = calculateCompanyVehicleTotals();
+        return calculateCompanyValue(company, totals[enumValue(company.id())]);
     }
 
     // 0x004389CC
@@ -633,7 +640,7 @@ namespace OpenLoco
         GameCommands::setUpdatingCompanyId(prevUpdateCompany);
     }
 
-    void Company::updateMonthly1()
+    void Company::updateMonthly1(const CompanyVehicleTotals& vehicleTotals)
     {
         std::rotate(std::begin(cargoUnitsDeliveredHistory), std::end(cargoUnitsDeliveredHistory) - 1, std::end(cargoUnitsDeliveredHistory));
         cargoUnitsDeliveredHistory[0] = cargoUnitsTotalDelivered;
@@ -655,7 +662,7 @@ namespace OpenLoco
             }
         }
 
-        const auto newPerformance = calculatePerformanceIndex(*this);
+        const auto newPerformance = calculatePerformanceIndex(*this, vehicleTotals);
         challengeFlags &= ~(CompanyFlags::increasedPerformance | CompanyFlags::decreasedPerformance);
         if (newPerformance != performanceIndex)
         {
@@ -693,7 +700,7 @@ namespace OpenLoco
             companyEmotionEvent(id(), Emotion::scared);
         }
 
-        const auto newValue = calculateCompanyValue(*this);
+        const auto newValue = calculateCompanyValue(*this, vehicleTotals);
         std::rotate(std::begin(companyValueHistory), std::end(companyValueHistory) - 1, std::end(companyValueHistory));
         companyValueHistory[0] = newValue.companyValue;
         vehicleProfit = newValue.vehicleProfit;
@@ -1052,6 +1059,9 @@ namespace OpenLoco
     }
 
     // 0x004385F6
+    // Every input is a counter kept up to date where it changes: cargoDelivered on delivery,
+    // companyValueHistory, vehicleProfit and performanceIndex by the monthly company update, so
+    // the daily evaluation only compares them against the objective.
     uint8_t Company::getNewChallengeProgress() const
     {
         if ((challengeFlags & CompanyFlags::challengeCompleted) != CompanyFlags::none)
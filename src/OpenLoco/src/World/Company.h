@@ -8,6 +8,7 @@
 #include <OpenLoco/Core/BitSet.hpp>
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -140,6 +141,15 @@ namespace OpenLoco
 
     constexpr size_t kExpenditureHistoryCapacity = 16;
 
+    // Sums over a company's vehicles used by the monthly performance and value calculations
+    struct CompanyVehicleTotals
+    {
+        currency32_t performanceProfit = 0;
+        currency48_t vehicleProfit = 0;
+        currency48_t vehicleValue = 0;
+    };
+    using CompanyVehicleTotalsArray = std::array<CompanyVehicleTotals, Limits::kMaxCompanies>;
+
 #pragma pack(push, 1)
     struct Company
     {
@@ -283,7 +293,7 @@ namespace OpenLoco
         void evaluateChallengeProgress();
         void updateDailyControllingPlayer();
         void updateMonthlyHeadquarters();
-        void updateMonthly1();
+        void updateMonthly1(const CompanyVehicleTotals& vehicleTotals);
         void updateLoanAutorepay();
         void updateQuarterly();
         void updateVehicleColours();
@@ -332,4 +342,5 @@ namespace OpenLoco
 
     // 0x00437D79
     ProfitAndValue calculateCompanyValue(const Company& company);
+    CompanyVehicleTotalsArray calculateCompanyVehicleTotals();
 }
@@ -69,11 +69,16 @@
 #include "World/Station.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Core/Timer.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <numeric>
 
+using namespace OpenLoco::Diagnostics;
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
 using namespace OpenLoco::Literals;
@@ -7667,6 +7672,21 @@ namespace OpenLoco
         aiThinkEndCompany,
     };
 
+    // Roughly a tenth of a tick at normal game speed.
+    static constexpr float kThinkBudgetMs = 2.5f;
+
+    static std::array<AiThinkStateStats, kAiThinkStateCount> _thinkStateStats{};
+
+    AiThinkStateStats getAiThinkStateStats(const AiThinkState state)
+    {
+        return _thinkStateStats[enumValue(state)];
+    }
+
+    void resetAiThinkStateStats()
+    {
+        _thinkStateStats.fill(AiThinkStateStats{});
+    }
+
     // 0x00430762
     void aiThink(const CompanyId id)
     {
@@ -7680,9 +7700,28 @@ namespace OpenLoco
 
         auto* company = CompanyManager::get(id);
 
-        const auto thinkFunc1 = _funcs_430786[enumValue(company->var_4A4)];
+        const auto thinkState = company->var_4A4;
+        const auto thinkSubState = company->var_4A5;
+        const auto thinkFunc1 = _funcs_430786[enumValue(thinkState)];
+
+        const auto numCommandsBefore = GameCommands::getNumCommandsIssued();
+        Core::Timer thinkTimer;
         thinkFunc1(*company);
 
+        // AI states always run to completion within a tick, report the ones that blow the budget
+        // so that they can be split into smaller steps.
+        const auto thinkMs = thinkTimer.elapsed();
+
+        auto& stats = _thinkStateStats[enumValue(thinkState)];
+        stats.totalMs += thinkMs;
+        stats.maxMs = std::max(stats.maxMs, thinkMs);
+        stats.numCalls++;
+        stats.numCommands += GameCommands::getNumCommandsIssued() - numCommandsBefore;
+        if (thinkMs > kThinkBudgetMs)
+        {
+            Logging::verbose("AI company {} took {:.2f}ms in think state {}:{}", enumValue(id), thinkMs, enumValue(thinkState), thinkSubState);
+        }
+
         if (company->empty())
         {
             return;
@@ -21,6 +21,7 @@ namespace OpenLoco
         unk9,
         endCompany,
     };
+    constexpr auto kAiThinkStateCount = 11U;
 
     enum class AiPlaceVehicleState : uint8_t
     {
@@ -137,6 +138,17 @@ namespace OpenLoco
 
     void aiThink(CompanyId id);
 
+    // Accumulated cost of each think state since the last reset, reported by the simulate benchmark.
+    struct AiThinkStateStats
+    {
+        double totalMs{};
+        float maxMs{};
+        uint32_t numCalls{};
+        uint32_t numCommands{};
+    };
+    AiThinkStateStats getAiThinkStateStats(AiThinkState state);
+    void resetAiThinkStateStats();
+
     void setAiObservation(CompanyId id);
     void removeEntityFromThought(AiThought& thought, EntityId id);
 }
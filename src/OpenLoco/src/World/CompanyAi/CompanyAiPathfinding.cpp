@@ -1,5 +1,6 @@
 #include "CompanyAiPathfinding.h"
 #include "CompanyAi.h"
+#include "Config.h"
 #include "Economy/Economy.h"
 #include "GameCommands/CompanyAi/AiTrackReplacement.h"
 #include "GameCommands/Road/CreateRoad.h"
@@ -29,7 +30,12 @@
 #include "World/Company.h"
 #include "World/Station.h"
 
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <unordered_map>
+
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::CompanyAi
 {
@@ -45,10 +51,6 @@ namespace OpenLoco::CompanyAi
     static World::SmallZ _unk2PosBaseZ112C517 = {}; // Was loco_global at 0x0112C517
     static World::Pos2 _unk3Pos112C3CC = {}; // Was loco_global at 0x0112C3CC
     static World::SmallZ _unk3PosBaseZ112C59C = {}; // Was loco_global at 0x0112C59C
-    static uint32_t _unk112C364 = 0; // Was loco_global at 0x0112C364
-    static uint32_t _unk112C36C = 0; // Was loco_global at 0x0112C36C
-    static uint32_t _unk112C35C = 0; // Was loco_global at 0x0112C35C
-    static uint32_t _unk112C34C = 0; // Was loco_global at 0x0112C34C
     static uint8_t _unk3Rot112C59E = 0; // Was loco_global at 0x0112C59E
     static uint32_t _createTrackRoadCommandMods = 0; // Was loco_global at 0x0112C388
     static uint32_t _createTrackRoadCommandRackRail = 0; // Was loco_global at 0x0112C38C
@@ -333,6 +335,113 @@ namespace OpenLoco::CompanyAi
         uint32_t bridgeWeighting;               // 0x0112C37C
     };
 
+    // The placement score search reaches the same piece through many different paths and each
+    // visit probes the placement with a query only game command. Nothing modifies the map while
+    // the candidates of a section are scored, so the outcome of each probe is remembered until
+    // the next section.
+    struct PlacementQueryKey
+    {
+        World::Pos3 pos;
+        uint8_t rotation;
+        uint8_t trackRoadId;
+        uint16_t unkFlags;
+
+        bool operator==(const PlacementQueryKey& rhs) const
+        {
+            return pos == rhs.pos && rotation == rhs.rotation && trackRoadId == rhs.trackRoadId && unkFlags == rhs.unkFlags;
+        }
+    };
+
+    struct PlacementQueryKeyHash
+    {
+        size_t operator()(const PlacementQueryKey& key) const
+        {
+            uint64_t packed = static_cast<uint16_t>(key.pos.x);
+            packed = (packed << 16) | static_cast<uint16_t>(key.pos.y);
+            packed = (packed << 16) | static_cast<uint16_t>(key.pos.z);
+            packed = (packed << 4) | (key.rotation & 0xF);
+            packed = (packed << 6) | (key.trackRoadId & 0x3F);
+            packed ^= static_cast<uint64_t>(key.unkFlags) << 48;
+            return std::hash<uint64_t>{}(packed);
+        }
+    };
+
+    // When enabled the placement score search expands the pieces closest to the target first and
+    // stops following a path once it can no longer beat the best result, much like A*. Scores are
+    // unchanged but the search finishes far sooner as the target is usually reached early.
+    static bool _boundedPlacementSearch = false;
+
+    static std::unordered_map<PlacementQueryKey, bool, PlacementQueryKeyHash> _placementQueryCache;
+    static uint32_t _placementQueryCacheHits = 0;
+    static uint32_t _placementQueryCacheMisses = 0;
+
+    static void beginPlacementQueryCache()
+    {
+        _boundedPlacementSearch = Config::get().boundedAiPathfinding;
+        _placementQueryCache.clear();
+        _placementQueryCacheHits = 0;
+        _placementQueryCacheMisses = 0;
+    }
+
+    static void endPlacementQueryCache(const Company& company)
+    {
+        const auto total = _placementQueryCacheHits + _placementQueryCacheMisses;
+        if (total != 0)
+        {
+            Logging::verbose("AI company {} placement queries: {} ({}% cached)", enumValue(company.id()), total, (_placementQueryCacheHits * 100) / total);
+        }
+    }
+
+    template<typename QueryFunction>
+    static bool queryPlacementCached(const PlacementQueryKey& key, QueryFunction&& query)
+    {
+        auto it = _placementQueryCache.find(key);
+        if (it != _placementQueryCache.end())
+        {
+            _placementQueryCacheHits++;
+            return it->second;
+        }
+        _placementQueryCacheMisses++;
+        const bool canPlace = query();
+        _placementQueryCache.emplace(key, canPlace);
+        return canPlace;
+    }
+
+    // Once the target has been reached the only way to improve is to reach it with less weighting,
+    // weighting only ever increases along a path so anything at or above the best can be skipped.
+    static bool canPlacementSearchImprove(const QueryTrackRoadPlacementResult& totalResult, const QueryTrackRoadPlacementState& state)
+    {
+        if (!_boundedPlacementSearch)
+        {
+            return true;
+        }
+        return totalResult.minScore != 0 || state.currentWeighting < totalResult.minWeighting;
+    }
+
+    static uint32_t getDistanceScoreToTarget(const World::Pos3 pos)
+    {
+        const auto diffZ = std::abs(_unk3PosBaseZ112C59C - (pos.z / World::kSmallZStep));
+        const auto diffX = std::abs(_unk3Pos112C3CC->x - pos.x) / 8;
+        const auto diffY = std::abs(_unk3Pos112C3CC->y - pos.y) / 8;
+        return Math::Vector::fastSquareRoot(diffX * diffX + diffY * diffY + diffZ * diffZ);
+    }
+
+    // Orders the candidate pieces so that those ending closest to the target are expanded first.
+    template<typename GetEndOffset>
+    static void sortByDistanceToTarget(sfl::static_vector<uint16_t, 64>& tads, const World::Pos3 pos, GetEndOffset&& getEndOffset)
+    {
+        sfl::static_vector<std::pair<uint32_t, uint16_t>, 64> scored;
+        for (const auto tad : tads)
+        {
+            scored.push_back(std::make_pair(getDistanceScoreToTarget(pos + getEndOffset(tad)), tad));
+        }
+        std::stable_sort(scored.begin(), scored.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        for (size_t i = 0; i < scored.size(); ++i)
+        {
+            tads[i] = scored[i].second;
+        }
+    }
+
     // 0x004854B2
     // pos : ax, cx, dl
     // tad : bp
@@ -409,14 +518,15 @@ namespace OpenLoco::CompanyAi
         args.unk = false;
         args.unkFlags = _createTrackRoadCommandAiUnkFlags >> 20;
 
-        {
+        const auto canPlace = queryPlacementCached(PlacementQueryKey{ pos, args.rotation, args.trackId, args.unkFlags }, [&args]() {
             auto regs = static_cast<Interop::registers>(args);
             regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
             GameCommands::createTrack(regs);
-            if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
-            {
-                return;
-            }
+            return static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE;
+        });
+        if (!canPlace)
+        {
+            return;
         }
 
         totalResult.flags |= (1U << 0);
@@ -472,6 +582,7 @@ namespace OpenLoco::CompanyAi
             }
             else
             {
+                sfl::static_vector<uint16_t, 64> newTads;
                 for (auto newTrackId : validTrackIds)
                 {
                     const auto newTad = (newTrackId << 3) | nextRotation;
@@ -490,6 +601,19 @@ namespace OpenLoco::CompanyAi
                             continue;
                         }
                     }
+                    newTads.push_back(newTad);
+                }
+                if (_boundedPlacementSearch)
+                {
+                    sortByDistanceToTarget(newTads, nextPos, [](const uint16_t newTad) { return World::TrackData::getUnkTrack(newTad).pos; });
+                }
+
+                for (const auto newTad : newTads)
+                {
+                    if (!canPlacementSearchImprove(totalResult, state))
+                    {
+                        break;
+                    }
 
                     // Make a copy of the state as each track needs to be evaluated independently
                     auto tempState = state;
@@ -546,28 +670,30 @@ namespace OpenLoco::CompanyAi
         args.mods = 0;
         args.unkFlags = _createTrackRoadCommandAiUnkFlags >> 16;
 
-        {
+        const auto canPlace = queryPlacementCached(PlacementQueryKey{ pos, args.rotation, args.roadId, args.unkFlags }, [&args]() {
             auto regs = static_cast<Interop::registers>(args);
             regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
             GameCommands::createRoad(regs);
-            if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
+            if (static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE)
             {
-                if ((_createTrackRoadCommandAiUnkFlags & (1U << 20)) && _alternateTrackObjectId != 0xFFU)
-                {
-                    args.roadObjectId = _alternateTrackObjectId;
-                }
-                if (_byte_1136075 != 0xFFU)
-                {
-                    args.bridge = _byte_1136075;
-                }
-                regs = static_cast<Interop::registers>(args);
-                regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
-                GameCommands::createRoad(regs);
-                if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
-                {
-                    return;
-                }
+                return true;
+            }
+            if ((_createTrackRoadCommandAiUnkFlags & (1U << 20)) && _alternateTrackObjectId != 0xFFU)
+            {
+                args.roadObjectId = _alternateTrackObjectId;
+            }
+            if (_byte_1136075 != 0xFFU)
+            {
+                args.bridge = _byte_1136075;
             }
+            regs = static_cast<Interop::registers>(args);
+            regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
+            GameCommands::createRoad(regs);
+            return static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE;
+        });
+        if (!canPlace)
+        {
+            return;
         }
 
         totalResult.flags |= (1U << 0);
@@ -626,9 +752,22 @@ namespace OpenLoco::CompanyAi
             }
             else
             {
+                sfl::static_vector<uint16_t, 64> newTads;
                 for (const auto newRoadId : validRoadIds)
                 {
-                    const auto newTad = (newRoadId << 3) | nextRotation;
+                    newTads.push_back((newRoadId << 3) | nextRotation);
+                }
+                if (_boundedPlacementSearch)
+                {
+                    sortByDistanceToTarget(newTads, nextPos, [](const uint16_t newTad) { return World::TrackData::getUnkRoad(newTad).pos; });
+                }
+
+                for (const auto newTad : newTads)
+                {
+                    if (!canPlacementSearchImprove(totalResult, state))
+                    {
+                        break;
+                    }
 
                     // Make a copy of the state as each track needs to be evaluated independently
                     auto tempState = state;
@@ -810,6 +949,7 @@ namespace OpenLoco::CompanyAi
             tad |= rotation;
             // 0x0112C55B, 0x0112C3D4, 0x00112C454
             sfl::static_vector<std::pair<uint8_t, QueryTrackRoadPlacementResult>, 64> placementResults;
+            beginPlacementQueryCache();
             for (const auto trackId : validTrackIds)
             {
                 const auto rotationBegin = World::TrackData::getUnkTrack(trackId << 3).rotationBegin;
@@ -830,6 +970,7 @@ namespace OpenLoco::CompanyAi
                 const auto newTad = (trackId << 3) | rotation;
                 placementResults.push_back(std::make_pair(trackId, queryTrackPlacementScore(company, pos, newTad, diagFlag, validTrackIds)));
             }
+            endPlacementQueryCache(company);
             // 0x00484813
             uint16_t bestMinScore = 0xFFFFU;
             uint16_t bestMinWeighting = 0xFFFFU;
@@ -1073,11 +1214,13 @@ namespace OpenLoco::CompanyAi
 
             // 0x0112C55B, 0x0112C3D4, 0x00112C454
             sfl::static_vector<std::pair<uint8_t, QueryTrackRoadPlacementResult>, 64> placementResults;
+            beginPlacementQueryCache();
             for (const auto roadId : validRoadIds)
             {
                 const auto newTad = (roadId << 3) | rotation;
                 placementResults.push_back(std::make_pair(roadId, queryRoadPlacementScore(company, pos, newTad, validRoadIds)));
             }
+            endPlacementQueryCache(company);
             // 0x00484EF0
             uint16_t bestMinScore = 0xFFFFU;
             uint16_t bestMinWeighting = 0xFFFFU;
@@ -2128,6 +2271,17 @@ namespace OpenLoco::CompanyAi
         return false;
     }
 
+    // Result of following an already built route from its start to the target. Only depends on the
+    // inputs and the current map so it can be evaluated without touching pathfinding state.
+    struct PathEstimate
+    {
+        uint32_t flags;               // bit 0: target not reached, bit 1: 0x0112C368
+        uint32_t distance;            // 0x0112C364 straight line distance between the ends
+        uint32_t weighting;           // 0x0112C36C
+        uint32_t obstructedWeighting; // 0x0112C35C
+        uint32_t replacementCost;     // 0x0112C34C
+    };
+
     // 0x00485B75
     // startPos.x: 0x0112C3C6
     // startPos.y: 0x0112C3C8
@@ -2138,13 +2292,12 @@ namespace OpenLoco::CompanyAi
     // targetPos.z: 0x0112C515 * World::kSmallZStep
     // targetRot: 0x0112C516
     // trackObjId: 0x0112C519
-    static uint32_t sub_485B75(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t trackObjId, const CompanyId companyId)
+    // totalWeighting: 0x0112C398
+    static PathEstimate sub_485B75(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t trackObjId, const CompanyId companyId, const uint32_t totalWeighting)
     {
-        _unk112C36C = 0U;
-        _unk112C35C = 0U;
+        PathEstimate estimate{};
         bool unk112C368 = false;
-        _unk112C34C = 0U;
-        uint32_t unk112C360 = _pathFindTotalTrackRoadWeighting;
+        uint32_t unk112C360 = totalWeighting;
         World::Pos3 pos = startPos;
         uint16_t tad = startTad;
         for (auto i = 0U; i < 400; ++i)
@@ -2154,14 +2307,15 @@ namespace OpenLoco::CompanyAi
                 // 0x00485DBD
                 const auto posA = startPos + World::TrackData::getUnkTrack(startTad).pos;
                 const auto posB = targetPos + World::Pos3(World::kRotationOffset[targetRot], 0);
-                _unk112C364 = Math::Vector::distance3D(posA, posB);
-                return unk112C368 ? (1U << 1) : 0U;
+                estimate.distance = Math::Vector::distance3D(posA, posB);
+                estimate.flags = unk112C368 ? (1U << 1) : 0U;
+                return estimate;
             }
 
             const uint8_t trackId = (tad >> 3U) & 0x3F;
             const uint8_t rotation = tad & 0x3U;
             const auto unkWeighting = World::TrackData::getTrackMiscData(trackId).unkWeighting;
-            _unk112C36C += unkWeighting;
+            estimate.weighting += unkWeighting;
             unk112C360 -= unkWeighting;
 
             auto posAdjusted = pos;
@@ -2180,14 +2334,14 @@ namespace OpenLoco::CompanyAi
                 GameCommands::aiTrackReplacement(regs);
                 if (static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE)
                 {
-                    _unk112C34C += static_cast<uint32_t>(regs.ebx);
+                    estimate.replacementCost += static_cast<uint32_t>(regs.ebx);
                 }
             }
             if (sub_4A80E1(posAdjusted, rotation, 0, trackId, trackObjId))
             {
-                _unk112C35C += unkWeighting;
+                estimate.obstructedWeighting += unkWeighting;
             }
-            if (_unk112C36C > 128 && unk112C360 > 64)
+            if (estimate.weighting > 128 && unk112C360 > 64)
             {
                 if (sub_4A7E86(posAdjusted, rotation, 0, trackId, trackObjId))
                 {
@@ -2204,7 +2358,8 @@ namespace OpenLoco::CompanyAi
             const auto tc = World::Track::getTrackConnectionsAi(nextPos, nextRot, companyId, trackObjId, 0, 0);
             if (tc.connections.empty() || tc.connections.size() > 1)
             {
-                return 1;
+                estimate.flags = 1U;
+                return estimate;
             }
 
             tad = tc.connections[0] & World::Track::AdditionalTaDFlags::basicTaDMask;
@@ -2221,7 +2376,8 @@ namespace OpenLoco::CompanyAi
                 tad = (tad & 0x3) | (0U << 3);
             }
         }
-        return 1;
+        estimate.flags = 1U;
+        return estimate;
     }
 
     // 0x00485E6A
@@ -2234,12 +2390,10 @@ namespace OpenLoco::CompanyAi
     // targetPos.z: 0x0112C515 * World::kSmallZStep
     // targetRot: 0x0112C516
     // roadObjId: 0x0112C519
-    static uint32_t sub_485E6A(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t roadObjId, const CompanyId companyId)
+    static PathEstimate sub_485E6A(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t roadObjId, const CompanyId companyId)
     {
-        _unk112C36C = 0U;
-        _unk112C35C = 0U;
+        PathEstimate estimate{};
         bool unk112C368 = false;
-        _unk112C34C = 0U;
         World::Pos3 pos = startPos;
         uint16_t tad = startTad;
         bool targetReached = false;
@@ -2254,21 +2408,21 @@ namespace OpenLoco::CompanyAi
             const uint8_t roadId = (tad >> 3U) & 0xF;
             const uint8_t rotation = tad & 0x3U;
             const auto unkWeighting = World::TrackData::getRoadMiscData(roadId).unkWeighting;
-            _unk112C36C += unkWeighting;
+            estimate.weighting += unkWeighting;
 
             auto posAdjusted = pos;
             posAdjusted.z += World::TrackData::getRoadPiece(roadId)[0].z;
 
-            _unk112C34C += static_cast<uint32_t>(RoadReplacePrice::aiRoadReplacementCost(posAdjusted, rotation, 0, roadId, companyId));
+            estimate.replacementCost += static_cast<uint32_t>(RoadReplacePrice::aiRoadReplacementCost(posAdjusted, rotation, 0, roadId, companyId));
 
             if (sub_47B336(posAdjusted, rotation, 0, roadId, companyId))
             {
-                _unk112C35C += unkWeighting;
+                estimate.obstructedWeighting += unkWeighting;
             }
 
             if (willRoadDestroyABuilding(posAdjusted, rotation, 0, roadId, companyId))
             {
-                _unk112C35C += unkWeighting;
+                estimate.obstructedWeighting += unkWeighting;
             }
 
             if (sub_47B7CC(posAdjusted, rotation, 0, roadId, companyId))
@@ -2289,7 +2443,8 @@ namespace OpenLoco::CompanyAi
             const auto rc = World::Track::getRoadConnectionsAiAllocated(nextPos, nextRot, companyId, matchRoadObjId, 0, 0);
             if (rc.connections.size() > 1)
             {
-                return 1;
+                estimate.flags = 1U;
+                return estimate;
             }
             if (rc.connections.empty())
             {
@@ -2316,17 +2471,18 @@ namespace OpenLoco::CompanyAi
             // 0x004860F4
             const auto posA = startPos + World::TrackData::getUnkRoad(startTad).pos;
             const auto posB = targetPos + World::Pos3(World::kRotationOffset[targetRot], 0);
-            _unk112C364 = Math::Vector::distance3D(posA, posB);
-            return unk112C368 ? (1U << 1) : 0U;
+            estimate.distance = Math::Vector::distance3D(posA, posB);
+            estimate.flags = unk112C368 ? (1U << 1) : 0U;
         }
         else
         {
-            return 1;
+            estimate.flags = 1U;
         }
+        return estimate;
     }
 
     // 0x00485B68
-    static uint32_t sub_485B68()
+    static PathEstimate sub_485B68()
     {
         const auto startPos = World::Pos3{ _unk2Pos112C3C6->x, _unk2Pos112C3C6->y, _unk2PosBaseZ112C517 * World::kSmallZStep };
         const auto startTad = _unkTad112C3CA;
@@ -2342,7 +2498,7 @@ namespace OpenLoco::CompanyAi
         else
         {
             const auto trackObjId = trackRoadObjId;
-            return sub_485B75(startPos, startTad, targetPos, targetRot, trackObjId, companyId);
+            return sub_485B75(startPos, startTad, targetPos, targetRot, trackObjId, companyId, _pathFindTotalTrackRoadWeighting);
         }
     }
 
@@ -2364,12 +2520,12 @@ namespace OpenLoco::CompanyAi
     // 0x00484508
     static bool evaluatePathfound(Company& company, AiThought& thought)
     {
-        const auto flags = sub_485B68();
-        if (flags & (1U << 0))
+        const auto estimate = sub_485B68();
+        if (estimate.flags & (1U << 0))
         {
             return true;
         }
-        if (flags & (1U << 1))
+        if (estimate.flags & (1U << 1))
         {
             // 0x004845FF
             aiPathfindNextState(company);
@@ -2377,16 +2533,16 @@ namespace OpenLoco::CompanyAi
         }
         else
         {
-            const auto weighting = std::max<uint32_t>(_unk112C364, 256);
+            const auto weighting = std::max<uint32_t>(estimate.distance, 256);
             // 1.75 x weighting
             const auto adjustedWeighting = weighting + weighting / 2 + weighting / 4;
-            if (adjustedWeighting < _unk112C36C)
+            if (adjustedWeighting < estimate.weighting)
             {
                 // 0x004845FF
                 aiPathfindNextState(company);
                 return false;
             }
-            if (_unk112C35C * 5 >= _unk112C36C)
+            if (estimate.obstructedWeighting * 5 >= estimate.weighting)
             {
                 // 0x004845FF
                 aiPathfindNextState(company);
@@ -2442,7 +2598,7 @@ namespace OpenLoco::CompanyAi
                 }
             }
             company.var_85C2 = 0xFFU;
-            thought.var_76 += _unk112C34C;
+            thought.var_76 += estimate.replacementCost;
             return false;
         }
     }
@@ -2484,8 +2640,8 @@ namespace OpenLoco::CompanyAi
                     {
                         // 0x004845EF
 
-                        const auto flags = sub_485B68();
-                        if (flags & (1U << 0))
+                        const auto estimate = sub_485B68();
+                        if (estimate.flags & (1U << 0))
                         {
                             return true;
                         }
@@ -2582,8 +2738,8 @@ namespace OpenLoco::CompanyAi
                     {
                         // 0x004845EF duplicate
 
-                        const auto flags = sub_485B68();
-                        if (flags & (1U << 0))
+                        const auto estimate = sub_485B68();
+                        if (estimate.flags & (1U << 0))
                         {
                             return true;
                         }
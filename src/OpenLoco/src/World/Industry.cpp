@@ -23,6 +23,7 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
+#include <sfl/static_vector.hpp>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -256,7 +257,7 @@ namespace OpenLoco
                 outputBuffer[i] -= quantityToSend;
                 producedCargoQuantityMonthlyTotal[i] = Math::Bound::add(producedCargoQuantityMonthlyTotal[i], quantityToSend);
 
-                std::vector<StationId> stations;
+                sfl::static_vector<StationId, 4> stations;
                 for (auto stationId : producedCargoStatsStation[i])
                 {
                     if (stationId != StationId::null)
@@ -700,15 +701,9 @@ namespace OpenLoco
                 continue;
             }
 
-            auto id = 0;
-            for (const auto& hasBit : stationsInRange)
+            for (auto id = stationsInRange.findFirst(); id < stationsInRange.size(); id = stationsInRange.findNext(id + 1))
             {
                 const auto stationId = static_cast<StationId>(id);
-                id++;
-                if (!hasBit)
-                {
-                    continue;
-                }
                 const auto* station = StationManager::get(stationId);
                 if (station->empty())
                 {
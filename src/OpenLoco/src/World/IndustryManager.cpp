@@ -18,14 +18,29 @@
 #include "Objects/ObjectManager.h"
 #include "Random.h"
 #include "SceneManager.h"
+#include "StationManager.h"
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Math/Vector.hpp>
 #include <numeric>
+#include <sfl/static_vector.hpp>
 
 namespace OpenLoco::IndustryManager
 {
     static auto& rawIndustries() { return getGameState().industries; }
+
+    // Bits are set when an industry is allocated and only cleared when rebuilt, a removed industry keeps
+    // its bit until then which only costs checking its slot.
+    static FixedVector<Industry, Limits::kMaxIndustries>::Occupancy _industryOccupancy;
+
+    void rebuildOccupancy()
+    {
+        _industryOccupancy.reset();
+        for (auto& industry : FixedVector(rawIndustries()))
+        {
+            _industryOccupancy.set(enumValue(industry.id()), true);
+        }
+    }
     static auto getTotalIndustriesFactor() { return getGameState().numberOfIndustries; }
     Flags getFlags() { return getGameState().industryFlags; }
 
@@ -65,12 +80,13 @@ namespace OpenLoco::IndustryManager
         {
             industry.name = StringIds::null;
         }
+        rebuildOccupancy();
         Ui::Windows::IndustryList::reset();
     }
 
     FixedVector<Industry, Limits::kMaxIndustries> industries()
     {
-        return FixedVector(rawIndustries());
+        return FixedVector(rawIndustries(), _industryOccupancy);
     }
 
     Industry* get(IndustryId id)
@@ -101,10 +117,14 @@ namespace OpenLoco::IndustryManager
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded))
         {
             GameCommands::setUpdatingCompanyId(CompanyId::neutral);
+            // Industries only read the ratings of the stations they deliver to, which deliveries
+            // leave alone, so the cargo can be added once every industry has produced.
+            StationManager::beginCargoDeliveryBatch();
             for (auto& industry : industries())
             {
                 industry.updateDaily();
             }
+            StationManager::applyCargoDeliveryBatch();
         }
     }
 
@@ -220,12 +240,33 @@ namespace OpenLoco::IndustryManager
         }
     }
 
+    // Industries cannot change while a location is searched for, so their positions are gathered
+    // once rather than walking every industry slot for each of the random attempts.
+    struct IndustryPositions
+    {
+        sfl::static_vector<World::Pos2, Limits::kMaxIndustries> all;
+        sfl::static_vector<World::Pos2, Limits::kMaxIndustries> sameType;
+
+        explicit IndustryPositions(const uint8_t indObjId)
+        {
+            for (auto& industry : industries())
+            {
+                const auto pos = World::Pos2{ industry.x, industry.y };
+                all.push_back(pos);
+                if (industry.objectId == indObjId)
+                {
+                    sameType.push_back(pos);
+                }
+            }
+        }
+    };
+
     // 0x00459A05
-    static bool isTooCloseToNearbyIndustries(const World::Pos2& loc)
+    static bool isTooCloseToNearbyIndustries(const World::Pos2& loc, const IndustryPositions& positions)
     {
-        for (auto& industry : industries())
+        for (const auto& pos : positions.all)
         {
-            const auto dist = Math::Vector::manhattanDistance2D(loc, World::Pos2{ industry.x, industry.y });
+            const auto dist = Math::Vector::manhattanDistance2D(loc, pos);
             if (dist < kCloseIndustryDistanceMax)
             {
                 return true;
@@ -235,23 +276,17 @@ namespace OpenLoco::IndustryManager
     }
 
     // 0x00459A50
-    static bool isOutwithCluster(const World::Pos2& loc, const uint8_t indObjId)
+    static bool isOutwithCluster(const World::Pos2& loc, const IndustryPositions& positions)
     {
-        auto numClusters = 0;
-        for (auto& industry : industries())
+        for (const auto& pos : positions.sameType)
         {
-            if (industry.objectId != indObjId)
-            {
-                continue;
-            }
-            numClusters++;
-            const auto dist = Math::Vector::manhattanDistance2D(loc, World::Pos2{ industry.x, industry.y });
+            const auto dist = Math::Vector::manhattanDistance2D(loc, pos);
             if (dist < kIndustryWithinClusterDistance)
             {
                 return false;
             }
         }
-        if (numClusters < kNumIndustryInCluster)
+        if (positions.sameType.size() < kNumIndustryInCluster)
         {
             return false;
         }
@@ -262,6 +297,7 @@ namespace OpenLoco::IndustryManager
     static std::optional<World::Pos2> findRandomNewIndustryLocation(const uint8_t indObjId)
     {
         auto* indObj = ObjectManager::get<IndustryObject>(indObjId);
+        const IndustryPositions positions(indObjId);
         for (auto i = 0; i < kFindRandomNewIndustryAttempts; ++i)
         {
             // Replace the below with this after validating the function
@@ -274,14 +310,14 @@ namespace OpenLoco::IndustryManager
                 (((randomNum >> 16) * World::kMapRows) >> 16),
                 (((randomNum & 0xFFFF) * World::kMapColumns) >> 16)));
 
-            if (isTooCloseToNearbyIndustries(randomPos))
+            if (isTooCloseToNearbyIndustries(randomPos, positions))
             {
                 continue;
             }
 
             if (indObj->hasFlags(IndustryObjectFlags::builtInClusters))
             {
-                if (isOutwithCluster(randomPos, indObjId))
+                if (isOutwithCluster(randomPos, positions))
                 {
                     continue;
                 }
@@ -619,6 +655,7 @@ namespace OpenLoco::IndustryManager
 
             industry->town = nearbyTown;
             industry->name = indObj->var_02;
+            _industryOccupancy.set(i, true);
 
             for (auto& innerInd : IndustryManager::industries())
             {
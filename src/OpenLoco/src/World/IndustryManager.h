@@ -20,6 +20,8 @@ namespace OpenLoco::IndustryManager
 
     void reset();
     FixedVector<Industry, Limits::kMaxIndustries> industries();
+    // Rebuilds the set of used industry slots industries() iterates, needed after the industries are loaded.
+    void rebuildOccupancy();
     Industry* get(IndustryId id);
     Flags getFlags();
     bool hasFlags(const Flags flags);
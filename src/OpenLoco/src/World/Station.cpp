@@ -50,10 +50,27 @@ namespace OpenLoco
     constexpr uint8_t kMaxCargoRating = 200;
     constexpr uint8_t catchmentSize = 4;
 
+    // Inclusive tile range that contains every tile with a catchment flag set.
+    struct CatchmentBounds
+    {
+        tile_coord_t minX = kMapColumns;
+        tile_coord_t minY = kMapRows;
+        tile_coord_t maxX = -1;
+        tile_coord_t maxY = -1;
+
+        bool empty() const
+        {
+            return maxX < minX;
+        }
+    };
+
     struct CargoSearchState
     {
     private:
         static std::array<uint8_t, kMapSize> _map = {}; // Was loco_global at 0x00F00484
+        // Catchments only cover a small part of the map, tracking where flags have been set avoids
+        // resetting and scanning the whole map each time the acceptance is calculated.
+        static inline std::array<CatchmentBounds, 2> _bounds = {};
         static uint32_t _filter = 0; // Was loco_global at 0x0112C68C
         static std::array<uint32_t, kMaxCargoStats> _score = {}; // Was loco_global at 0x0112C690
         static uint32_t _producedCargoTypes = 0; // Was loco_global at 0x0112C710
@@ -78,6 +95,12 @@ namespace OpenLoco
         void setTile(const tile_coord_t x, const tile_coord_t y, const CatchmentFlags flag)
         {
             _map[y * kMapColumns + x] |= (1 << enumValue(flag));
+
+            auto& bounds = _bounds[enumValue(flag)];
+            bounds.minX = std::min(bounds.minX, x);
+            bounds.minY = std::min(bounds.minY, y);
+            bounds.maxX = std::max(bounds.maxX, x);
+            bounds.maxY = std::max(bounds.maxY, y);
         }
 
         void resetTile(const tile_coord_t x, const tile_coord_t y, const CatchmentFlags flag)
@@ -125,6 +148,22 @@ namespace OpenLoco
             }
         }
 
+        // Equivalent to resetting the region covering the whole map.
+        void resetAllTiles(const CatchmentFlags flag)
+        {
+            auto& bounds = _bounds[enumValue(flag)];
+            if (!bounds.empty())
+            {
+                resetTileRegion(bounds.minX, bounds.minY, bounds.maxX - bounds.minX + 1, bounds.maxY - bounds.minY + 1, flag);
+            }
+            bounds = CatchmentBounds{};
+        }
+
+        const CatchmentBounds& getBounds(const CatchmentFlags flag) const
+        {
+            return _bounds[enumValue(flag)];
+        }
+
         uint32_t filter() const
         {
             return _filter;
@@ -295,9 +334,10 @@ namespace OpenLoco
             cargoSearchState.filter(~0U);
         }
 
-        for (tile_coord_t ty = 0; ty < kMapColumns; ty++)
+        const auto bounds = cargoSearchState.getBounds(CatchmentFlags::flag_1);
+        for (tile_coord_t ty = bounds.minY; ty <= bounds.maxY; ty++)
         {
-            for (tile_coord_t tx = 0; tx < kMapRows; tx++)
+            for (tile_coord_t tx = bounds.minX; tx <= bounds.maxX; tx++)
             {
                 if (cargoSearchState.mapHas2(tx, ty))
                 {
@@ -531,7 +571,7 @@ namespace OpenLoco
     void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
     {
         CargoSearchState cargoSearchState;
-        cargoSearchState.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
+        cargoSearchState.resetAllTiles(catchmentFlag);
 
         if (station == nullptr)
         {
@@ -617,12 +657,17 @@ namespace OpenLoco
 
     // 0x0042F489
     void Station::deliverCargoToStation(const uint8_t cargoType, const uint8_t cargoQuantity)
+    {
+        addDeliveredCargo(cargoType, cargoQuantity);
+        updateCargoDistribution();
+    }
+
+    void Station::addDeliveredCargo(const uint8_t cargoType, const uint16_t cargoQuantity)
     {
         auto& stationCargoStat = cargoStats[cargoType];
         stationCargoStat.quantity = Math::Bound::add(stationCargoStat.quantity, cargoQuantity);
         stationCargoStat.enrouteAge = 0;
         stationCargoStat.origin = id();
-        updateCargoDistribution();
     }
 
     // 0x00492A98
@@ -657,6 +702,51 @@ namespace OpenLoco
         return StringManager::formatString(ptr, suffix);
     }
 
+    static uint32_t getActiveCargoMask(const Station& station)
+    {
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < kMaxCargoStats; i++)
+        {
+            mask |= static_cast<uint32_t>(!station.cargoStats[i].empty()) << i;
+        }
+        return mask;
+    }
+
+    // AI stations that have not been serviced yet have their age and waiting cargo ignored
+    static bool hasFixedCargoRating(const Station& station)
+    {
+        return (station.flags & (StationFlags::flag_7 | StationFlags::flag_8)) == StationFlags::none && !CompanyManager::isPlayerCompany(station.owner);
+    }
+
+    // Each threshold adds its bonus on top of the looser ones, so summing the comparisons gives
+    // the same result as the nested checks of vanilla without branching on every cargo.
+    static int32_t calculateTargetCargoRating(const StationCargoStats& cargo, bool hasFixedRating)
+    {
+        int32_t rating = 0;
+
+        // Bonus if cargo is fresh
+        rating += 40 * (cargo.age <= 45) + 45 * (cargo.age <= 30) + 45 * (cargo.age <= 15) + 35 * (cargo.age <= 7);
+
+        // Penalty if lots of cargo waiting
+        rating -= 130;
+        rating += 30 * (cargo.quantity <= 1000) + 30 * (cargo.quantity <= 500) + 30 * (cargo.quantity <= 300) + 20 * (cargo.quantity <= 200) + 20 * (cargo.quantity <= 100);
+
+        if (hasFixedRating)
+        {
+            rating = 120;
+        }
+
+        Speed16 vehicleSpeed = std::min(cargo.vehicleSpeed, 250_mph);
+        if (vehicleSpeed > 35_mph)
+        {
+            rating += ((vehicleSpeed - 35_mph).getRaw()) / 4;
+        }
+
+        rating += 10 * (cargo.vehicleAge < 4) + 10 * (cargo.vehicleAge < 2) + 13 * (cargo.vehicleAge < 1);
+
+        return std::clamp<int32_t>(rating, kMinCargoRating, kMaxCargoRating);
+    }
+
     // 0x00492793
     bool Station::updateCargo()
     {
@@ -666,55 +756,58 @@ namespace OpenLoco
         var_3B0 = std::min(var_3B0 + 1, 255);
         var_3B1 = std::min(var_3B1 + 1, 255);
 
+        // Stations only ever handle a few of the cargo types, visiting the rest in ascending
+        // order keeps the random numbers drawn in the same order as a walk over every slot.
+        uint32_t activeCargo = getActiveCargoMask(*this);
+        const bool hasFixedRating = hasFixedCargoRating(*this);
+
         auto& rng = gPrng1();
-        for (uint32_t i = 0; i < kMaxCargoStats; i++)
+        for (auto i = Numerics::bitScanForward(activeCargo); i != -1; i = Numerics::bitScanForward(activeCargo))
         {
+            activeCargo &= ~(1U << i);
             auto& stationCargo = cargoStats[i];
-            if (!stationCargo.empty())
+            if (stationCargo.quantity != 0 && stationCargo.origin != id())
             {
-                if (stationCargo.quantity != 0 && stationCargo.origin != id())
-                {
-                    stationCargo.enrouteAge = std::min(stationCargo.enrouteAge + 1, 255);
-                }
-                else
-                {
-                    // Change from vanilla to deal with the cargo transfer bug:
-                    // Reset en-route age once the station cargo gets cleared
-                    // or else the age keeps increasing
-                    stationCargo.enrouteAge = 0;
-                }
-                stationCargo.age = std::min(stationCargo.age + 1, 255);
+                stationCargo.enrouteAge = std::min(stationCargo.enrouteAge + 1, 255);
+            }
+            else
+            {
+                // Change from vanilla to deal with the cargo transfer bug:
+                // Reset en-route age once the station cargo gets cleared
+                // or else the age keeps increasing
+                stationCargo.enrouteAge = 0;
+            }
+            stationCargo.age = std::min(stationCargo.age + 1, 255);
 
-                auto targetRating = calculateCargoRating(stationCargo);
-                // Limit to +/- 2 minimum change
-                auto ratingDelta = std::clamp(targetRating - stationCargo.rating, -2, 2);
-                stationCargo.rating += ratingDelta;
+            auto targetRating = calculateTargetCargoRating(stationCargo, hasFixedRating);
+            // Limit to +/- 2 minimum change
+            auto ratingDelta = std::clamp(targetRating - stationCargo.rating, -2, 2);
+            stationCargo.rating += ratingDelta;
 
-                if (stationCargo.rating <= 50)
+            if (stationCargo.rating <= 50)
+            {
+                // Rating < 25%, decrease cargo
+                if (stationCargo.quantity >= 400)
                 {
-                    // Rating < 25%, decrease cargo
-                    if (stationCargo.quantity >= 400)
-                    {
-                        stationCargo.quantity -= rng.randNext(1, 32);
-                        quantityUpdated = true;
-                    }
-                    else if (stationCargo.quantity >= 200)
-                    {
-                        stationCargo.quantity -= rng.randNext(1, 8);
-                        quantityUpdated = true;
-                    }
+                    stationCargo.quantity -= rng.randNext(1, 32);
+                    quantityUpdated = true;
                 }
-                if (stationCargo.rating >= 100)
+                else if (stationCargo.quantity >= 200)
                 {
-                    atLeastOneGoodRating = true;
+                    stationCargo.quantity -= rng.randNext(1, 8);
+                    quantityUpdated = true;
                 }
-                if (stationCargo.rating <= 100 && stationCargo.quantity != 0)
+            }
+            if (stationCargo.rating >= 100)
+            {
+                atLeastOneGoodRating = true;
+            }
+            if (stationCargo.rating <= 100 && stationCargo.quantity != 0)
+            {
+                if (stationCargo.rating <= rng.randNext(0, 127))
                 {
-                    if (stationCargo.rating <= rng.randNext(0, 127))
-                    {
-                        stationCargo.quantity = std::max(0, stationCargo.quantity - rng.randNext(1, 4));
-                        quantityUpdated = true;
-                    }
+                    stationCargo.quantity = std::max(0, stationCargo.quantity - rng.randNext(1, 4));
+                    quantityUpdated = true;
                 }
             }
         }
@@ -733,74 +826,7 @@ namespace OpenLoco
     // 0x004927F6
     int32_t Station::calculateCargoRating(const StationCargoStats& cargo) const
     {
-        int32_t rating = 0;
-
-        // Bonus if cargo is fresh
-        if (cargo.age <= 45)
-        {
-            rating += 40;
-            if (cargo.age <= 30)
-            {
-                rating += 45;
-                if (cargo.age <= 15)
-                {
-                    rating += 45;
-                    if (cargo.age <= 7)
-                    {
-                        rating += 35;
-                    }
-                }
-            }
-        }
-
-        // Penalty if lots of cargo waiting
-        rating -= 130;
-        if (cargo.quantity <= 1000)
-        {
-            rating += 30;
-            if (cargo.quantity <= 500)
-            {
-                rating += 30;
-                if (cargo.quantity <= 300)
-                {
-                    rating += 30;
-                    if (cargo.quantity <= 200)
-                    {
-                        rating += 20;
-                        if (cargo.quantity <= 100)
-                        {
-                            rating += 20;
-                        }
-                    }
-                }
-            }
-        }
-
-        if ((flags & (StationFlags::flag_7 | StationFlags::flag_8)) == StationFlags::none && !CompanyManager::isPlayerCompany(owner))
-        {
-            rating = 120;
-        }
-
-        Speed16 vehicleSpeed = std::min(cargo.vehicleSpeed, 250_mph);
-        if (vehicleSpeed > 35_mph)
-        {
-            rating += ((vehicleSpeed - 35_mph).getRaw()) / 4;
-        }
-
-        if (cargo.vehicleAge < 4)
-        {
-            rating += 10;
-            if (cargo.vehicleAge < 2)
-            {
-                rating += 10;
-                if (cargo.vehicleAge < 1)
-                {
-                    rating += 13;
-                }
-            }
-        }
-
-        return std::clamp<int32_t>(rating, kMinCargoRating, kMaxCargoRating);
+        return calculateTargetCargoRating(cargo, hasFixedCargoRating(*this));
     }
 
     // 0x004929DB
@@ -937,6 +963,9 @@ namespace OpenLoco
         tr.drawString(point, Colour::black, buffer);
     }
 
+    // Labels are repositioned far more often than their text changes (e.g. on every rotation).
+    static std::array<Gfx::StringWidthCache<4>, Limits::kMaxStations> _labelWidthCache;
+
     // 0x0048DCA5
     void Station::updateLabel()
     {
@@ -952,6 +981,8 @@ namespace OpenLoco
         const auto remainingLength = strEnd - buffer;
         StringManager::formatString(strEnd, remainingLength, getTransportIconsFromStationFlags(flags));
 
+        const auto& textWidths = _labelWidthCache[enumValue(id())].getWidths(kZoomToStationFonts, buffer);
+
         for (auto zoom = 0U; zoom < 4; ++zoom)
         {
             Ui::Viewport virtualVp{};
@@ -960,8 +991,7 @@ namespace OpenLoco
             const auto labelCenter = World::Pos3{ x, y, z };
             const auto vpPos = World::gameToScreen(labelCenter, WindowManager::getCurrentRotation());
 
-            const auto font = kZoomToStationFonts[zoom];
-            const auto width = Gfx::TextRenderer::getStringWidth(font, buffer) + kZoomToStationBorder[zoom].width * 2;
+            const auto width = textWidths[zoom] + kZoomToStationBorder[zoom].width * 2;
             const auto height = kZoomToStationBorder[zoom].height;
 
             const auto [zoomWidth, zoomHeight] = ScreenToViewport::scaleTransform(Ui::Point(width, height), virtualVp);
@@ -1200,6 +1230,7 @@ namespace OpenLoco
         station->stationTiles[station->stationTileSize].z &= ~0x3;
         station->stationTiles[station->stationTileSize].z |= (rotation & 0x3);
         station->stationTileSize++;
+        StationManager::addStationTileToIndex(pos);
 
         CargoSearchState cargoSearchState;
         const auto acceptedCargos = station->calcAcceptedCargo(cargoSearchState);
@@ -1258,6 +1289,7 @@ namespace OpenLoco
         // NB: erasing is handled by StationManager::zeroUnused; not calling std::erase due to type mismatches
         std::rotate(foundTilePos, foundTilePos + 1, std::end(station->stationTiles));
         station->stationTileSize--;
+        StationManager::removeStationTileFromIndex(pos);
     }
 
     // 0x0048F482
@@ -156,6 +156,8 @@ namespace OpenLoco
         void invalidateWindow();
 
         void deliverCargoToStation(const uint8_t cargoType, const uint8_t cargoQuantity);
+        // deliverCargoToStation without updating the cargo distribution, see StationManager::applyCargoDeliveryBatch
+        void addDeliveredCargo(const uint8_t cargoType, const uint16_t cargoQuantity);
         void deliverCargoToTown(uint8_t cargoType, uint16_t cargoQuantity);
         void updateCargoDistribution();
 
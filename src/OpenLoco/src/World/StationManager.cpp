@@ -25,9 +25,13 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Math/Vector.hpp>
 
+#include <algorithm>
 #include <bitset>
+#include <limits>
 #include <numeric>
 #include <sfl/static_vector.hpp>
+#include <tuple>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
@@ -39,6 +43,102 @@ namespace OpenLoco::StationManager
 
     static auto& rawStations() { return getGameState().stations; }
 
+    // Number of tiles along each side of a station tile index cell.
+    static constexpr int32_t kStationIndexCellSize = 16;
+    static constexpr int32_t kStationIndexColumns = kMapColumns / kStationIndexCellSize;
+    static constexpr int32_t kStationIndexRows = kMapRows / kStationIndexCellSize;
+
+    static std::array<uint16_t, kStationIndexColumns * kStationIndexRows> _stationTileIndex{};
+
+    static uint16_t& getStationTileIndexCell(const TilePos2& pos)
+    {
+        return _stationTileIndex[(pos.y / kStationIndexCellSize) * kStationIndexColumns + (pos.x / kStationIndexCellSize)];
+    }
+
+    void addStationTileToIndex(const World::Pos2& pos)
+    {
+        const auto tilePos = World::toTileSpace(pos);
+        if (World::validCoords(tilePos))
+        {
+            getStationTileIndexCell(tilePos)++;
+        }
+    }
+
+    void removeStationTileFromIndex(const World::Pos2& pos)
+    {
+        const auto tilePos = World::toTileSpace(pos);
+        if (World::validCoords(tilePos))
+        {
+            auto& count = getStationTileIndexCell(tilePos);
+            count = count > 0 ? count - 1 : 0;
+        }
+    }
+
+    void rebuildStationTileIndex()
+    {
+        _stationTileIndex.fill(0);
+        for (auto& station : stations())
+        {
+            for (auto i = 0U; i < station.stationTileSize; ++i)
+            {
+                addStationTileToIndex(station.stationTiles[i]);
+            }
+        }
+    }
+
+    // Returns true if any cell overlapping the inclusive tile range contains a station tile.
+    static bool mayContainStationTiles(TilePos2 minPos, TilePos2 maxPos)
+    {
+        minPos.x = std::clamp<coord_t>(minPos.x, 0, kMapColumns - 1);
+        minPos.y = std::clamp<coord_t>(minPos.y, 0, kMapRows - 1);
+        maxPos.x = std::clamp<coord_t>(maxPos.x, 0, kMapColumns - 1);
+        maxPos.y = std::clamp<coord_t>(maxPos.y, 0, kMapRows - 1);
+
+        for (auto cellY = minPos.y / kStationIndexCellSize; cellY <= maxPos.y / kStationIndexCellSize; ++cellY)
+        {
+            for (auto cellX = minPos.x / kStationIndexCellSize; cellX <= maxPos.x / kStationIndexCellSize; ++cellX)
+            {
+                if (_stationTileIndex[cellY * kStationIndexColumns + cellX] != 0)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Ids of the stations in use in ascending order, so they can be updated in turn without
+    // visiting the empty slots.
+    static sfl::static_vector<StationId, Limits::kMaxStations> _activeStations;
+    static FixedVector<Station, Limits::kMaxStations>::Occupancy _stationOccupancy;
+
+    void rebuildActiveStations()
+    {
+        _activeStations.clear();
+        _stationOccupancy.reset();
+        for (auto& station : FixedVector(rawStations()))
+        {
+            _activeStations.push_back(station.id());
+            _stationOccupancy.set(enumValue(station.id()), true);
+        }
+    }
+
+    static void addActiveStation(const StationId id)
+    {
+        _activeStations.insert(std::lower_bound(_activeStations.begin(), _activeStations.end(), id), id);
+        _stationOccupancy.set(enumValue(id), true);
+    }
+
+    static void removeActiveStation(const StationId id)
+    {
+        auto it = std::lower_bound(_activeStations.begin(), _activeStations.end(), id);
+        if (it != _activeStations.end() && *it == id)
+        {
+            _activeStations.erase(it);
+        }
+        _stationOccupancy.set(enumValue(id), false);
+    }
+
     // 0x0048B1D8
     void reset()
     {
@@ -46,12 +146,14 @@ namespace OpenLoco::StationManager
         {
             station.name = StringIds::null;
         }
+        rebuildStationTileIndex();
+        rebuildActiveStations();
         Ui::Windows::Station::reset();
     }
 
     FixedVector<Station, Limits::kMaxStations> stations()
     {
-        return FixedVector(rawStations());
+        return FixedVector(rawStations(), _stationOccupancy);
     }
 
     Station* get(StationId id)
@@ -69,11 +171,35 @@ namespace OpenLoco::StationManager
     {
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !SceneManager::isEditorMode())
         {
-            const auto id = StationId(ScenarioManager::getScenarioTicks() & 0x3FF);
-            auto station = get(id);
-            if (station != nullptr && !station->empty())
+            const auto quota = static_cast<uint32_t>(std::max(Config::get().stationUpdatesPerTick, 0));
+            if (quota == 0)
             {
-                station->update();
+                const auto id = StationId(ScenarioManager::getScenarioTicks() & 0x3FF);
+                auto station = get(id);
+                if (station != nullptr && !station->empty())
+                {
+                    station->update();
+                }
+                return;
+            }
+
+            // The position in the rotation is derived from the scenario ticks so that it does not
+            // need to be saved and every client picks the same stations.
+            const auto numActive = static_cast<uint32_t>(_activeStations.size());
+            const auto numUpdates = std::min(quota, numActive);
+            const auto first = static_cast<uint32_t>((static_cast<uint64_t>(ScenarioManager::getScenarioTicks()) * numUpdates) % std::max(numActive, 1U));
+            for (auto i = 0U; i < numUpdates; ++i)
+            {
+                const auto index = (first + i) % numActive;
+                if (index >= _activeStations.size())
+                {
+                    break;
+                }
+                auto* station = get(_activeStations[index]);
+                if (station != nullptr && !station->empty())
+                {
+                    station->update();
+                }
             }
         }
     }
@@ -466,6 +592,10 @@ namespace OpenLoco::StationManager
         const auto catchmentSize = size + TilePos2(8, 8);
 
         CargoStations foundStations;
+        if (!mayContainStationTiles(initialLoc, initialLoc + catchmentSize - TilePos2(1, 1)))
+        {
+            return foundStations;
+        }
         for (TilePos2 searchOffset{ 0, 0 }; searchOffset.y < catchmentSize.y; ++searchOffset.y)
         {
             for (; searchOffset.x < catchmentSize.x; ++searchOffset.x)
@@ -476,6 +606,11 @@ namespace OpenLoco::StationManager
                     continue;
                 }
 
+                if (!TileManager::hasElementType(searchLoc, ElementType::station))
+                {
+                    continue;
+                }
+
                 const auto tile = TileManager::get(searchLoc);
                 for (const auto& el : tile)
                 {
@@ -518,6 +653,57 @@ namespace OpenLoco::StationManager
         return foundStations;
     }
 
+    struct PendingCargoDelivery
+    {
+        StationId stationId;
+        uint8_t cargoType;
+        uint16_t quantity;
+    };
+
+    static bool _isBatchingDeliveries = false;
+    static std::vector<PendingCargoDelivery> _pendingDeliveries;
+
+    void beginCargoDeliveryBatch()
+    {
+        _isBatchingDeliveries = true;
+    }
+
+    void applyCargoDeliveryBatch()
+    {
+        _isBatchingDeliveries = false;
+
+        // Delivering only ever adds cargo and the quantity saturates, so one add of the total is
+        // the same as the separate adds. Grouped by station, keeping the order within a station.
+        std::stable_sort(_pendingDeliveries.begin(), _pendingDeliveries.end(), [](const PendingCargoDelivery& a, const PendingCargoDelivery& b) {
+            return std::tie(a.stationId, a.cargoType) < std::tie(b.stationId, b.cargoType);
+        });
+
+        for (auto it = _pendingDeliveries.begin(); it != _pendingDeliveries.end();)
+        {
+            const auto stationId = it->stationId;
+            auto* station = get(stationId);
+            if (station == nullptr || station->empty())
+            {
+                // Nothing is delivered to a station that no longer exists
+                it = std::find_if(it, _pendingDeliveries.end(), [stationId](const PendingCargoDelivery& delivery) { return delivery.stationId != stationId; });
+                continue;
+            }
+            do
+            {
+                uint32_t quantity = 0;
+                const auto cargoType = it->cargoType;
+                for (; it != _pendingDeliveries.end() && it->stationId == stationId && it->cargoType == cargoType; ++it)
+                {
+                    quantity += it->quantity;
+                }
+                station->addDeliveredCargo(cargoType, std::min<uint32_t>(quantity, std::numeric_limits<uint16_t>::max()));
+            } while (it != _pendingDeliveries.end() && it->stationId == stationId);
+
+            station->updateCargoDistribution();
+        }
+        _pendingDeliveries.clear();
+    }
+
     static uint16_t deliverCargoToStations(const CargoStations& foundStations, const uint8_t cargoType, const uint8_t cargoQty)
     {
         const auto ratingTotal = std::accumulate(foundStations.begin(), foundStations.end(), 0, [](const int32_t a, const std::pair<StationId, uint8_t>& b) { return a + b.second * b.second; });
@@ -543,7 +729,14 @@ namespace OpenLoco::StationManager
                 share++;
             }
             cargoQtyDelivered += share;
-            station->deliverCargoToStation(cargoType, share);
+            if (_isBatchingDeliveries)
+            {
+                _pendingDeliveries.push_back({ stationId, cargoType, static_cast<uint16_t>(share) });
+            }
+            else
+            {
+                station->deliverCargoToStation(cargoType, share);
+            }
         }
 
         return std::min<uint16_t>(cargoQtyDelivered, cargoQty);
@@ -645,6 +838,7 @@ namespace OpenLoco::StationManager
             station.var_3B0 = 0;
             station.var_3B1 = 0;
 
+            addActiveStation(station.id());
             return station.id();
         }
 
@@ -698,6 +892,7 @@ namespace OpenLoco::StationManager
         MessageManager::removeAllSubjectRefs(enumValue(stationId), MessageItemArgumentType::station);
         StringManager::emptyUserString(station->name);
         station->name = StringIds::null;
+        removeActiveStation(stationId);
     }
 
     StationId findNearbyEmptyStation(const World::Pos3 pos, const CompanyId companyId, const int16_t currentMinDistanceStation)
@@ -22,10 +22,24 @@ namespace OpenLoco::StationManager
     void zeroUnused();
     uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const World::Pos2& pos, const World::TilePos2& size);
     uint16_t deliverCargoToStations(std::span<const StationId> stations, const uint8_t cargoType, const uint8_t cargoQty);
+
+    // Cargo delivered between these calls is added to the stations when the batch is applied, so
+    // a station that receives several deliveries only updates its cargo distribution once.
+    void beginCargoDeliveryBatch();
+    void applyCargoDeliveryBatch();
     bool exceedsStationSize(Station& station, World::Pos3 pos);
     StationId allocateNewStation(const World::Pos3 pos, const CompanyId owner, const uint8_t mode);
     void deallocateStation(const StationId stationId);
 
+    // Coarse count of the station tiles in each area of the map, lets cargo producers that are
+    // nowhere near a station skip the catchment search.
+    void addStationTileToIndex(const World::Pos2& pos);
+    void removeStationTileFromIndex(const World::Pos2& pos);
+    void rebuildStationTileIndex();
+
+    // Rebuilds the list of stations in use, must be called whenever stations are loaded.
+    void rebuildActiveStations();
+
     struct NearbyStation
     {
         StationId id;
@@ -103,12 +103,17 @@ namespace OpenLoco
         tr.drawString(point, AdvancedColour(Colour::white).outline(), buffer);
     }
 
+    // Labels are repositioned far more often than their text changes (e.g. on every rotation).
+    static std::array<Gfx::StringWidthCache<4>, Limits::kMaxTowns> _labelWidthCache;
+
     // 0x00497616
     void Town::updateLabel()
     {
         char buffer[256]{};
         StringManager::formatString(buffer, 256, name);
 
+        const auto& nameWidths = _labelWidthCache[enumValue(id())].getWidths(kZoomToTownFonts, buffer);
+
         auto height = TileManager::getHeight(Pos2(x, y));
         auto pos = Pos3(x + kTileSize / 2, y + kTileSize / 2, height.landHeight);
 
@@ -117,9 +122,7 @@ namespace OpenLoco
 
         for (auto zoomLevel = 0; zoomLevel < 4; zoomLevel++)
         {
-            auto font = kZoomToTownFonts[zoomLevel];
-
-            auto nameWidth = (Gfx::TextRenderer::getStringWidth(font, buffer) + 2) << zoomLevel;
+            auto nameWidth = (nameWidths[zoomLevel] + 2) << zoomLevel;
             auto nameHeight = 11 << zoomLevel; // was a lookup on 0x4FF6FC; same for all zoom levels
 
             auto xOffset = rotated.x - (nameWidth / 2);
@@ -435,6 +438,40 @@ namespace OpenLoco
         return potentialBuildings;
     }
 
+    using PotentialBuildings = sfl::static_vector<uint8_t, ObjectManager::getMaxObjects(ObjectType::building)>;
+
+    // A single grow walks up to 75 road pieces and tries to place a building next to each, most of
+    // which ask for the same set of candidate buildings. Objects and the date cannot change during
+    // a grow so the candidates are remembered until the next one starts.
+    struct PotentialBuildingsCacheEntry
+    {
+        uint16_t year;
+        uint16_t density;
+        bool largeTile;
+        uint32_t unk1;
+        uint16_t targetHeight;
+        PotentialBuildings buildings;
+    };
+
+    static sfl::static_vector<PotentialBuildingsCacheEntry, 16> _potentialBuildingsCache;
+
+    static const PotentialBuildings& getPotentialBuildings(uint16_t year, uint16_t density, bool largeTile, uint32_t unk1, uint16_t targetHeight)
+    {
+        for (const auto& entry : _potentialBuildingsCache)
+        {
+            if (entry.year == year && entry.density == density && entry.largeTile == largeTile && entry.unk1 == unk1 && entry.targetHeight == targetHeight)
+            {
+                return entry.buildings;
+            }
+        }
+        if (_potentialBuildingsCache.full())
+        {
+            _potentialBuildingsCache.erase(_potentialBuildingsCache.begin());
+        }
+        _potentialBuildingsCache.push_back(PotentialBuildingsCacheEntry{ year, density, largeTile, unk1, targetHeight, sub_42CEBF(year, density, largeTile, unk1, targetHeight) });
+        return _potentialBuildingsCache.back().buildings;
+    }
+
     // 0x004F6CCC
     // index with tad side doesn't matter
     // Note: only valid for straight and very small curves
@@ -699,14 +736,14 @@ namespace OpenLoco
         }
 
         const auto curYear = getCurrentYear();
-        auto potentialBuildings = sub_42CEBF(curYear, townDensity, isLargeTile, unk525D24, targetHeight);
+        auto potentialBuildings = getPotentialBuildings(curYear, townDensity, isLargeTile, unk525D24, targetHeight);
         if (potentialBuildings.empty())
         {
             if (townDensity == 0)
             {
                 return std::nullopt;
             }
-            potentialBuildings = sub_42CEBF(curYear, townDensity - 1, isLargeTile, unk525D24, targetHeight);
+            potentialBuildings = getPotentialBuildings(curYear, townDensity - 1, isLargeTile, unk525D24, targetHeight);
             if (potentialBuildings.empty())
             {
                 return std::nullopt;
@@ -850,6 +887,7 @@ namespace OpenLoco
                 }
                 elRoad->setOwner(newOwner);
                 elRoad->setRoadObjectId(newRoadObjId);
+                Vehicles::invalidateNetworkConnections();
                 if (!elRoad->hasLevelCrossing())
                 {
                     elRoad->setStreetLightStyle(newStreetLightStyle);
@@ -1195,6 +1233,10 @@ namespace OpenLoco
                 uint32_t numBuildings = 0;
                 for (const auto& tilePos : getClampedRange(tileA, tileB))
                 {
+                    if (!TileManager::hasElementType(tilePos, ElementType::building))
+                    {
+                        continue;
+                    }
                     auto tile = TileManager::get(tilePos);
                     for (const auto& el : tile)
                     {
@@ -1637,6 +1679,8 @@ namespace OpenLoco
      */
     void Town::grow(TownGrowFlags growFlags)
     {
+        _potentialBuildingsCache.clear();
+
         const auto oldUpatingCompany = GameCommands::getUpdatingCompanyId();
         GameCommands::setUpdatingCompanyId(CompanyId::neutral);
 
@@ -22,6 +22,10 @@
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/Numerics.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Math/Vector.hpp>
+#include <limits>
+#include <unordered_set>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -235,6 +239,119 @@ namespace OpenLoco::TownManager
 
     static auto& rawTowns() { return getGameState().towns; }
 
+    // Bits are set when a town is initialised and only cleared when rebuilt, a removed town keeps its
+    // bit until then which only costs checking its slot.
+    static FixedVector<Town, Limits::kMaxTowns>::Occupancy _townOccupancy;
+
+    void rebuildOccupancy()
+    {
+        _townOccupancy.reset();
+        for (auto& town : FixedVector(rawTowns()))
+        {
+            _townOccupancy.set(enumValue(town.id()), true);
+        }
+    }
+
+    // Closest town to the centre of each tile along with how much further away the next closest
+    // town is. Any position within a tile is at most 32 units (manhattan) from its centre, so when
+    // the gap is more than twice that the closest town is the same for the whole tile.
+    struct ClosestTownEntry
+    {
+        TownId town = TownId::null;
+        uint16_t distance = std::numeric_limits<uint16_t>::max();
+        uint16_t nextDistance = std::numeric_limits<uint16_t>::max();
+    };
+
+    static constexpr int32_t kClosestTownMaxGapWithinTile = 64;
+
+    static std::vector<ClosestTownEntry> _closestTownMap;
+    static bool _closestTownMapDirty = true;
+
+    static World::Pos2 getTileCentre(const TilePos2& tilePos)
+    {
+        return World::toWorldSpace(tilePos) + World::Pos2(World::kTileSize / 2, World::kTileSize / 2);
+    }
+
+    static void addTownToClosestTownEntry(ClosestTownEntry& entry, const Town& town, const World::Pos2& centre)
+    {
+        const auto distance = static_cast<uint16_t>(Math::Vector::manhattanDistance2D(World::Pos2(town.x, town.y), centre));
+        if (distance < entry.distance)
+        {
+            entry.nextDistance = entry.distance;
+            entry.distance = distance;
+            entry.town = town.id();
+        }
+        else if (distance < entry.nextDistance)
+        {
+            entry.nextDistance = distance;
+        }
+    }
+
+    static void recalculateClosestTownEntry(ClosestTownEntry& entry, const TilePos2& tilePos)
+    {
+        entry = ClosestTownEntry{};
+        const auto centre = getTileCentre(tilePos);
+        for (const auto& town : towns())
+        {
+            addTownToClosestTownEntry(entry, town, centre);
+        }
+    }
+
+    static void rebuildClosestTownMap()
+    {
+        _closestTownMap.resize(kMapColumns * kMapRows);
+        for (tile_coord_t y = 0; y < kMapRows; ++y)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; ++x)
+            {
+                recalculateClosestTownEntry(_closestTownMap[y * kMapColumns + x], TilePos2(x, y));
+            }
+        }
+        _closestTownMapDirty = false;
+    }
+
+    static void addTownToClosestTownMap(const Town& town)
+    {
+        if (_closestTownMapDirty)
+        {
+            return;
+        }
+        for (tile_coord_t y = 0; y < kMapRows; ++y)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; ++x)
+            {
+                addTownToClosestTownEntry(_closestTownMap[y * kMapColumns + x], town, getTileCentre(TilePos2(x, y)));
+            }
+        }
+    }
+
+    void invalidateClosestTownMap()
+    {
+        _closestTownMapDirty = true;
+    }
+
+    // Must be called once the town is no longer in use.
+    void removeTownFromClosestTownMap(const TownId id)
+    {
+        if (_closestTownMapDirty)
+        {
+            return;
+        }
+        for (tile_coord_t y = 0; y < kMapRows; ++y)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; ++x)
+            {
+                // Tiles where the town was only the next closest are left as is, the gap can only
+                // have grown so the entry remains safe to use.
+                auto& entry = _closestTownMap[y * kMapColumns + x];
+                if (entry.town == id)
+                {
+                    recalculateClosestTownEntry(entry, TilePos2(x, y));
+                }
+            }
+        }
+    }
+
     // 0x00496FE7
     Town* initialiseTown(World::Pos2 pos)
     {
@@ -253,6 +370,7 @@ namespace OpenLoco::TownManager
         {
             return nullptr;
         }
+        _townOccupancy.set(enumValue(town->id()), true);
 
         // Initialise the new town
         town->x = pos.x;
@@ -294,6 +412,8 @@ namespace OpenLoco::TownManager
             return nullptr;
         }
 
+        addTownToClosestTownMap(*town);
+
         // Figure out if we need to reset building influence
         for (auto& otherTown : towns())
         {
@@ -357,17 +477,38 @@ namespace OpenLoco::TownManager
         return town;
     }
 
-    // 0x00497348
-    void resetBuildingsInfluence()
+    // Base tiles of the town buildings, misc buildings and ghosts are left out as they have no influence.
+    // Entries can go stale when a tile is replaced wholesale, they are dropped when next counted.
+    static std::unordered_set<uint64_t> _buildingIndex;
+    static bool _buildingIndexValid = false;
+
+    static uint64_t getBuildingIndexKey(const World::TilePos2& tilePos, World::SmallZ baseZ)
     {
-        for (auto& town : towns())
+        return (static_cast<uint64_t>(static_cast<uint16_t>(tilePos.x)) << 24) | (static_cast<uint64_t>(static_cast<uint16_t>(tilePos.y)) << 8) | baseZ;
+    }
+
+    static World::BuildingElement* getInfluencingBuilding(const World::TilePos2& tilePos, World::SmallZ baseZ)
+    {
+        auto tile = World::TileManager::get(tilePos);
+        for (auto& element : tile)
         {
-            town.numBuildings = 0;
-            town.population = 0;
-            town.populationCapacity = 0;
-            std::fill(std::begin(town.var_150), std::end(town.var_150), 0);
+            auto* building = element.as<World::BuildingElement>();
+            if (building == nullptr || building->baseZ() != baseZ)
+            {
+                continue;
+            }
+            if (building->isGhost() || building->isMiscBuilding() || building->sequenceIndex() != 0)
+            {
+                continue;
+            }
+            return building;
         }
+        return nullptr;
+    }
 
+    static void rebuildBuildingIndex()
+    {
+        _buildingIndex.clear();
         for (const auto& tilePos : World::getWorldRange())
         {
             auto tile = World::TileManager::get(tilePos);
@@ -378,41 +519,85 @@ namespace OpenLoco::TownManager
                 {
                     continue;
                 }
-
-                if (building->isGhost())
+                if (building->isGhost() || building->isMiscBuilding() || building->sequenceIndex() != 0)
                 {
                     continue;
                 }
+                _buildingIndex.insert(getBuildingIndexKey(tilePos, building->baseZ()));
+            }
+        }
+        _buildingIndexValid = true;
+    }
 
-                if (building->isMiscBuilding())
-                {
-                    continue;
-                }
+    void addBuildingToIndex(const World::Pos2& pos, World::SmallZ baseZ)
+    {
+        if (_buildingIndexValid)
+        {
+            _buildingIndex.insert(getBuildingIndexKey(World::toTileSpace(pos), baseZ));
+        }
+    }
 
-                if (building->sequenceIndex() != 0)
-                {
-                    continue;
-                }
+    void removeBuildingFromIndex(const World::Pos2& pos, World::SmallZ baseZ)
+    {
+        if (_buildingIndexValid)
+        {
+            _buildingIndex.erase(getBuildingIndexKey(World::toTileSpace(pos), baseZ));
+        }
+    }
 
-                auto objectId = building->objectId();
-                auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
-                auto producedQuantity = buildingObj->producedQuantity[0];
-                uint32_t population;
-                if (!building->isConstructed())
-                {
-                    population = 0;
-                }
-                else
-                {
-                    population = producedQuantity;
-                }
-                auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
-                if (town != nullptr)
+    void invalidateBuildingIndex()
+    {
+        _buildingIndex.clear();
+        _buildingIndexValid = false;
+    }
+
+    // 0x00497348
+    void resetBuildingsInfluence()
+    {
+        for (auto& town : towns())
+        {
+            town.numBuildings = 0;
+            town.population = 0;
+            town.populationCapacity = 0;
+            std::fill(std::begin(town.var_150), std::end(town.var_150), 0);
+        }
+
+        if (!_buildingIndexValid)
+        {
+            rebuildBuildingIndex();
+        }
+
+        // The counts are sums so the order the buildings are visited in does not matter
+        for (auto it = _buildingIndex.begin(); it != _buildingIndex.end();)
+        {
+            const auto tilePos = World::TilePos2(static_cast<tile_coord_t>((*it >> 24) & 0xFFFF), static_cast<tile_coord_t>((*it >> 8) & 0xFFFF));
+            const auto baseZ = static_cast<World::SmallZ>(*it & 0xFF);
+            auto* building = getInfluencingBuilding(tilePos, baseZ);
+            if (building == nullptr)
+            {
+                it = _buildingIndex.erase(it);
+                continue;
+            }
+            ++it;
+
+            auto objectId = building->objectId();
+            auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
+            auto producedQuantity = buildingObj->producedQuantity[0];
+            uint32_t population;
+            if (!building->isConstructed())
+            {
+                population = 0;
+            }
+            else
+            {
+                population = producedQuantity;
+            }
+            auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
+            if (town != nullptr)
+            {
+                if (buildingObj->var_AC != 0xFF)
                 {
-                    if (buildingObj->var_AC != 0xFF)
-                    {
-                        town->var_150[buildingObj->var_AC] += 1;
-                    }
+                    town->var_150[buildingObj->var_AC] += 1;
                 }
             }
         }
@@ -426,12 +611,15 @@ namespace OpenLoco::TownManager
         {
             town.name = StringIds::null;
         }
+        rebuildOccupancy();
+        invalidateClosestTownMap();
+        invalidateBuildingIndex();
         Ui::Windows::TownList::reset();
     }
 
     FixedVector<Town, Limits::kMaxTowns> towns()
     {
-        return FixedVector(rawTowns());
+        return FixedVector(rawTowns(), _townOccupancy);
     }
 
     Town* get(TownId id)
@@ -483,8 +671,22 @@ namespace OpenLoco::TownManager
     }
 
     // 0x00497E52
-    std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc)
+    static TownId findClosestTown(const World::Pos2& loc)
     {
+        const auto tilePos = World::toTileSpace(loc);
+        if (World::validCoords(tilePos))
+        {
+            if (_closestTownMapDirty)
+            {
+                rebuildClosestTownMap();
+            }
+            const auto& entry = _closestTownMap[tilePos.y * kMapColumns + tilePos.x];
+            if (entry.town != TownId::null && entry.nextDistance - entry.distance > kClosestTownMaxGapWithinTile)
+            {
+                return entry.town;
+            }
+        }
+
         int32_t closestDistance = std::numeric_limits<uint16_t>::max();
         auto closestTown = TownId::null; // ebx
         for (const auto& town : towns())
@@ -496,8 +698,13 @@ namespace OpenLoco::TownManager
                 closestTown = town.id();
             }
         }
+        return closestTown;
+    }
 
-        if (closestDistance == std::numeric_limits<uint16_t>::max())
+    std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc)
+    {
+        const auto closestTown = findClosestTown(loc);
+        if (closestTown == TownId::null)
         {
             return std::nullopt;
         }
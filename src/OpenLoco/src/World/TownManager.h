@@ -11,11 +11,21 @@ namespace OpenLoco::TownManager
     Town* initialiseTown(World::Pos2 pos);
     void reset();
     FixedVector<Town, Limits::kMaxTowns> towns();
+    // Rebuilds the set of used town slots towns() iterates, needed after the towns are loaded.
+    void rebuildOccupancy();
     Town* get(TownId id);
     std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc);
+    // The closest town of each tile is cached, these keep the cache in step with the towns.
+    void invalidateClosestTownMap();
+    void removeTownFromClosestTownMap(TownId id);
     void update();
     void updateLabels();
     void updateMonthly();
     Town* updateTownInfo(const World::Pos2& loc, uint32_t population, uint32_t populationCapacity, int16_t rating, int16_t numBuildings);
+    // Recounts each town's buildings from an index of the town buildings on the map, the index is
+    // kept up to date as buildings are created and removed and only rescanned after a load.
     void resetBuildingsInfluence();
+    void addBuildingToIndex(const World::Pos2& pos, World::SmallZ baseZ);
+    void removeBuildingFromIndex(const World::Pos2& pos, World::SmallZ baseZ);
+    void invalidateBuildingIndex();
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -15,6 +16,20 @@ namespace OpenLoco::Platform
     std::vector<fs::path> getDrives();
     std::string getEnvironmentVariable(const std::string& name);
     bool isRunningInWine();
+    // Returns the peak resident memory of the process in bytes, 0 if unavailable.
+    uint64_t getPeakMemoryUsage();
+
+    // Read-only view of a whole file mapped into the address space of the process.
+    struct FileMapping
+    {
+        const std::byte* data{};
+        size_t size{};
+        void* handle{};
+    };
+
+    // Returns a mapping with data set to nullptr if the file could not be mapped.
+    FileMapping mapFile(const fs::path& path);
+    void unmapFile(FileMapping& mapping);
 #if defined(__APPLE__) && defined(__MACH__)
     fs::path GetBundlePath();
 #endif
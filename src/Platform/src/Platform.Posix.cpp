@@ -6,7 +6,11 @@
 #include <fcntl.h>
 #include <iostream>
 #include <pwd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
 
 #ifdef __linux__
 #include <linux/limits.h>
@@ -116,6 +120,57 @@ namespace OpenLoco::Platform
         return false;
     }
 
+    uint64_t getPeakMemoryUsage()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#if defined(__APPLE__) && defined(__MACH__)
+        // macOS reports bytes.
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        // Linux and the BSDs report kilobytes.
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+
+    FileMapping mapFile(const fs::path& path)
+    {
+        const auto fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return {};
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            close(fd);
+            return {};
+        }
+
+        const auto size = static_cast<size_t>(st.st_size);
+        auto* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file.
+        close(fd);
+        if (address == MAP_FAILED)
+        {
+            return {};
+        }
+        return FileMapping{ static_cast<const std::byte*>(address), size, nullptr };
+    }
+
+    void unmapFile(FileMapping& mapping)
+    {
+        if (mapping.data != nullptr)
+        {
+            munmap(const_cast<std::byte*>(mapping.data), mapping.size);
+        }
+        mapping = {};
+    }
+
     bool isStdOutRedirected()
     {
         // isatty returns a nonzero value if the descriptor is associated with a character device. Otherwise, isatty returns 0.
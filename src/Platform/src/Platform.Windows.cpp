@@ -20,6 +20,7 @@
 #include <shlobj.h>
 #include <windows.h>
 #include <mmsystem.h>
+#include <psapi.h>
 #include <shellapi.h>
 // clang-format on
 
@@ -160,6 +161,58 @@ namespace OpenLoco::Platform
         return false;
     }
 
+    uint64_t getPeakMemoryUsage()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+
+    FileMapping mapFile(const fs::path& path)
+    {
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return {};
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return {};
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping object keeps its own reference to the file.
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return {};
+        }
+
+        auto* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (address == nullptr)
+        {
+            CloseHandle(mapping);
+            return {};
+        }
+        return FileMapping{ static_cast<const std::byte*>(address), static_cast<size_t>(fileSize.QuadPart), mapping };
+    }
+
+    void unmapFile(FileMapping& mapping)
+    {
+        if (mapping.data != nullptr)
+        {
+            UnmapViewOfFile(mapping.data);
+            CloseHandle(mapping.handle);
+        }
+        mapping = {};
+    }
+
     bool isStdOutRedirected()
     {
         // isatty returns a nonzero value if the descriptor is associated with a character device. Otherwise, isatty returns 0.
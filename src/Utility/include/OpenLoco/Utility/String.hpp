@@ -13,6 +13,8 @@ namespace OpenLoco::Utility
     int32_t strlogicalcmp(std::string_view s1, std::string_view s2);
     std::string toUtf8(const std::wstring_view& src);
     std::wstring toUtf16(const std::string_view& src);
+    // Escapes the string so that it can be embedded between quotes in a JSON document.
+    std::string escapeJson(std::string_view src);
 
     inline bool iequals(const std::string_view& a, const std::string_view& b)
     {
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <locale>
 #endif
+#include <cstdio>
 #include <limits>
 
 namespace OpenLoco::Utility
@@ -126,4 +127,44 @@ namespace OpenLoco::Utility
         return std::to_wstring(0);
 #endif
     }
+
+    std::string escapeJson(std::string_view src)
+    {
+        std::string result;
+        result.reserve(src.size());
+        for (const char chr : src)
+        {
+            switch (chr)
+            {
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\r':
+                    result += "\\r";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                default:
+                    if (static_cast<uint8_t>(chr) < 0x20)
+                    {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<uint8_t>(chr));
+                        result += buffer;
+                    }
+                    else
+                    {
+                        result += chr;
+                    }
+                    break;
+            }
+        }
+        return result;
+    }
 }
@@ -223,3 +223,13 @@ TEST(StringTests, trim)
     EXPECT_EQ(Utility::trim(" "), "");
     EXPECT_EQ(Utility::trim(""), "");
 }
+
+TEST(StringTests, escapeJson)
+{
+    EXPECT_EQ(Utility::escapeJson("hello world"), "hello world");
+    EXPECT_EQ(Utility::escapeJson("say \"hi\""), "say \\\"hi\\\"");
+    EXPECT_EQ(Utility::escapeJson("C:\\saves\\test.sv5"), "C:\\\\saves\\\\test.sv5");
+    EXPECT_EQ(Utility::escapeJson("line\nbreak\t"), "line\\nbreak\\t");
+    EXPECT_EQ(Utility::escapeJson(std::string_view("\x01", 1)), "\\u0001");
+    EXPECT_EQ(Utility::escapeJson(""), "");
+}